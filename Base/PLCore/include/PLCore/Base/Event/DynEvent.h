@@ -30,7 +30,6 @@
 //[-------------------------------------------------------]
 //[ Includes                                              ]
 //[-------------------------------------------------------]
-#include "PLCore/Container/SimpleList.h"
 #include "PLCore/Base/Func/Signature.h"
 #include "PLCore/Base/Func/DynSignature.h"
 
@@ -62,10 +61,19 @@ class DynEventHandler;
 *
 *  @note
 *    - Implementation of the observer design pattern (this class is the subject/observable, the source)
+*    - The event handlers are called in the order they were connected
+*    - An event is not thread-safe, it must only be emitted, connected and disconnected by one thread at a time
+*      (usually the main thread), debug builds log an error if an event is emitted by two threads at the same time
 */
 class DynEvent : public DynSignature {
 
 
+	//[-------------------------------------------------------]
+	//[ Friends                                               ]
+	//[-------------------------------------------------------]
+	friend class DynEventHandler;
+
+
 	//[-------------------------------------------------------]
 	//[ Public definitions                                    ]
 	//[-------------------------------------------------------]
@@ -95,6 +103,10 @@ class DynEvent : public DynSignature {
 		*
 		*  @param[in] cHandler
 		*    Event handler
+		*
+		*  @note
+		*    - The runtime only depends on the number of events the given handler is already connected to,
+		*      not on the number of handlers connected to this event
 		*/
 		PLCORE_API void Connect(DynEventHandler &cHandler);
 
@@ -104,6 +116,12 @@ class DynEvent : public DynSignature {
 		*
 		*  @param[in] cHandler
 		*    Event handler
+		*
+		*  @note
+		*    - The runtime only depends on the number of events the given handler is connected to,
+		*      not on the number of handlers connected to this event
+		*    - It's safe to disconnect event handlers while the event is emitted, disconnected
+		*      event handlers are no longer called
 		*/
 		PLCORE_API void Disconnect(DynEventHandler &cHandler);
 
@@ -113,10 +131,6 @@ class DynEvent : public DynSignature {
 		*
 		*  @return
 		*    The number of connections
-		*
-		*  @note
-		*    - Don't use this method within performance critical situations because due internal
-		*      implementation, this request has a linear, not constant runtime!
 		*/
 		inline uint32 GetNumOfConnects() const;
 
@@ -190,11 +204,117 @@ class DynEvent : public DynSignature {
 		PLCORE_API virtual void Emit(const XmlElement &cElement) const;
 
 
+	//[-------------------------------------------------------]
+	//[ Protected definitions                                 ]
+	//[-------------------------------------------------------]
+	protected:
+		/**
+		*  @brief
+		*    Event handler slot
+		*/
+		struct HandlerSlot {
+			DynEventHandler *pHandler;		/**< Connected event handler, null pointer if the handler was disconnected and the slot is not removed yet */
+			uint32			 nEventSlot;	/**< Index of the event slot of this event within the event handler */
+		};
+
+
+	//[-------------------------------------------------------]
+	//[ Protected functions                                   ]
+	//[-------------------------------------------------------]
+	protected:
+		/**
+		*  @brief
+		*    Begin the emission of the event
+		*
+		*  @return
+		*    Number of event handler slots to call, event handlers connected during the emission are not called
+		*
+		*  @note
+		*    - Each call must be matched by a call of "EndEmit()"
+		*    - Disconnected event handler slots are set to a null pointer instead of being removed at once,
+		*      so the slot indices stay valid while the event is emitted
+		*/
+		inline uint32 BeginEmit() const;
+
+		/**
+		*  @brief
+		*    End the emission of the event
+		*
+		*  @note
+		*    - Removes the event handler slots which were disconnected during the emission
+		*      as soon as the outermost emission is finished
+		*/
+		inline void EndEmit() const;
+
+
 	//[-------------------------------------------------------]
 	//[ Protected data                                        ]
 	//[-------------------------------------------------------]
 	protected:
-		SimpleList<DynEventHandler*> m_lstHandlers;	/**< List of event handlers */
+		HandlerSlot		*m_pHandlers;			/**< Contiguous array of event handler slots, can be a null pointer */
+		uint32			 m_nNumOfHandlers;		/**< Number of used event handler slots, including disconnected ones which are not removed yet */
+		uint32			 m_nMaxNumOfHandlers;	/**< Number of allocated event handler slots */
+		uint32			 m_nNumOfConnects;		/**< Number of connected event handlers */
+		mutable uint32	 m_nEmitDepth;			/**< Emission depth, greater zero while the event is emitted (not atomic, the event is only used by one thread at a time) */
+		#ifdef _DEBUG
+			mutable handle m_nEmitThreadID;		/**< ID of the thread emitting the event, only valid while the event is emitted */
+		#endif
+
+
+	//[-------------------------------------------------------]
+	//[ Private functions                                     ]
+	//[-------------------------------------------------------]
+	private:
+		/**
+		*  @brief
+		*    Copy constructor
+		*
+		*  @param[in] cSource
+		*    Source to copy from
+		*/
+		DynEvent(const DynEvent &cSource);
+
+		/**
+		*  @brief
+		*    Copy operator
+		*
+		*  @param[in] cSource
+		*    Source to copy from
+		*
+		*  @return
+		*    Reference to this instance
+		*/
+		DynEvent &operator =(const DynEvent &cSource);
+
+		/**
+		*  @brief
+		*    Remove an event handler slot
+		*
+		*  @param[in] nIndex
+		*    Index of the event handler slot to remove, must be valid
+		*/
+		void RemoveHandlerSlot(uint32 nIndex);
+
+		/**
+		*  @brief
+		*    Remove the disconnected event handler slots
+		*
+		*  @note
+		*    - Keeps the order of the connected event handlers
+		*    - Must not be called while the event is emitted
+		*/
+		PLCORE_API void Compact();
+
+		#ifdef _DEBUG
+			/**
+			*  @brief
+			*    Checks that the event is not used by multiple threads at the same time
+			*
+			*  @note
+			*    - Logs an error if the event is emitted by another thread than the current one
+			*/
+			PLCORE_API void CheckEmitThread() const;
+		#endif
 
 
 };
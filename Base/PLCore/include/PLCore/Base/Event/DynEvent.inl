@@ -37,7 +37,36 @@ namespace PLCore {
 */
 inline uint32 DynEvent::GetNumOfConnects() const
 {
-	return m_lstHandlers.GetNumOfElements();
+	return m_nNumOfConnects;
+}
+
+
+//[-------------------------------------------------------]
+//[ Protected functions                                   ]
+//[-------------------------------------------------------]
+/**
+*  @brief
+*    Begin the emission of the event
+*/
+inline uint32 DynEvent::BeginEmit() const
+{
+	#ifdef _DEBUG
+		CheckEmitThread();
+	#endif
+	m_nEmitDepth++;
+	return m_nNumOfHandlers;
+}
+
+/**
+*  @brief
+*    End the emission of the event
+*/
+inline void DynEvent::EndEmit() const
+{
+	// Remove the disconnected event handler slots after the outermost emission
+	m_nEmitDepth--;
+	if (!m_nEmitDepth && m_nNumOfConnects != m_nNumOfHandlers)
+		const_cast<DynEvent*>(this)->Compact();
 }
 
 
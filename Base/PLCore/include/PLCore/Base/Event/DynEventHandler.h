@@ -30,7 +30,6 @@
 //[-------------------------------------------------------]
 //[ Includes                                              ]
 //[-------------------------------------------------------]
-#include "PLCore/Container/SimpleList.h"
 #include "PLCore/Base/Func/DynSignature.h"
 
 
@@ -101,11 +100,79 @@ class DynEventHandler : public DynSignature {
 		PLCORE_API virtual const EventHandlerDesc *GetDesc() const;
 
 
+	//[-------------------------------------------------------]
+	//[ Protected definitions                                 ]
+	//[-------------------------------------------------------]
+	protected:
+		/**
+		*  @brief
+		*    Event slot
+		*/
+		struct EventSlot {
+			DynEvent *pEvent;		/**< Event this event handler is connected to */
+			uint32	  nHandlerSlot;	/**< Index of the event handler slot of this event handler within the event */
+		};
+
+
 	//[-------------------------------------------------------]
 	//[ Protected data                                        ]
 	//[-------------------------------------------------------]
 	protected:
-		SimpleList<DynEvent*> m_lstEvents;	/**< List of events */
+		EventSlot *m_pEvents;			/**< Contiguous array of event slots, can be a null pointer */
+		uint32	   m_nNumOfEvents;		/**< Number of used event slots */
+		uint32	   m_nMaxNumOfEvents;	/**< Number of allocated event slots */
+
+
+	//[-------------------------------------------------------]
+	//[ Private functions                                     ]
+	//[-------------------------------------------------------]
+	private:
+		/**
+		*  @brief
+		*    Copy constructor
+		*
+		*  @param[in] cSource
+		*    Source to copy from
+		*/
+		DynEventHandler(const DynEventHandler &cSource);
+
+		/**
+		*  @brief
+		*    Copy operator
+		*
+		*  @param[in] cSource
+		*    Source to copy from
+		*
+		*  @return
+		*    Reference to this instance
+		*/
+		DynEventHandler &operator =(const DynEventHandler &cSource);
+
+		/**
+		*  @brief
+		*    Add an event slot
+		*
+		*  @param[in] cEvent
+		*    Event this event handler is connected to
+		*  @param[in] nHandlerSlot
+		*    Index of the event handler slot of this event handler within the event
+		*
+		*  @return
+		*    Index of the added event slot
+		*/
+		uint32 AddEventSlot(DynEvent &cEvent, uint32 nHandlerSlot);
+
+		/**
+		*  @brief
+		*    Remove an event slot
+		*
+		*  @param[in] nIndex
+		*    Index of the event slot to remove, must be valid
+		*
+		*  @note
+		*    - The last event slot is moved into the freed slot, the back reference of the moved event is updated
+		*/
+		void RemoveEventSlot(uint32 nIndex);
 
 
 };
@@ -84,18 +84,15 @@ class PLCORE_TMPL Event : public DynEvent {
 
 		virtual void operator ()(_T0 t0, _T1 t1, _T2 t2, _T3 t3, _T4 t4, _T5 t5, _T6 t6, _T7 t7, _T8 t8, _T9 t9, _T10 t10, _T11 t11, _T12 t12, _T13 t13, _T14 t14, _T15 t15) const
 		{
-			// Iterate through all event handlers
-			const typename SimpleList<DynEventHandler*>::ListElement *pElement = m_lstHandlers.pFirstElement;
-			while (pElement) {
-				// Backup the next element because "pElement" may get invalid within the next step...
-				const typename SimpleList<DynEventHandler*>::ListElement *pNextElement = pElement->pNextElement;
-
-				// Call the functor of the current event handler
-				static_cast<TypeHandler*>(pElement->Data)->m_cFunctor(t0, t1, t2, t3, t4, t5, t6, t7, t8, t9, t10, t11, t12, t13, t14, t15);
-
-				// Next element, please
-				pElement = pNextElement;
+			// Iterate through all event handlers, event handlers connected during the emission are not called
+			const uint32 nNumOfHandlers = BeginEmit();
+			for (uint32 i=0; i<nNumOfHandlers; i++) {
+				// Call the functor of the current event handler, skip event handlers disconnected during the emission
+				DynEventHandler *pHandler = m_pHandlers[i].pHandler;
+				if (pHandler)
+					static_cast<TypeHandler*>(pHandler)->m_cFunctor(t0, t1, t2, t3, t4, t5, t6, t7, t8, t9, t10, t11, t12, t13, t14, t15);
 			}
+			EndEmit();
 		}
 
 		virtual String GetSignature() const override
@@ -218,18 +215,15 @@ class PLCORE_TMPL Event<T0, T1, T2, T3, T4, T5, T6, T7, T8, T9, T10, T11, T12, T
 
 		virtual void operator ()(_T0 t0, _T1 t1, _T2 t2, _T3 t3, _T4 t4, _T5 t5, _T6 t6, _T7 t7, _T8 t8, _T9 t9, _T10 t10, _T11 t11, _T12 t12, _T13 t13, _T14 t14) const
 		{
-			// Iterate through all event handlers
-			const typename SimpleList<DynEventHandler*>::ListElement *pElement = m_lstHandlers.pFirstElement;
-			while (pElement) {
-				// Backup the next element because "pElement" may get invalid within the next step...
-				const typename SimpleList<DynEventHandler*>::ListElement *pNextElement = pElement->pNextElement;
-
-				// Call the functor of the current event handler
-				static_cast<TypeHandler*>(pElement->Data)->m_cFunctor(t0, t1, t2, t3, t4, t5, t6, t7, t8, t9, t10, t11, t12, t13, t14);
-
-				// Next element, please
-				pElement = pNextElement;
+			// Iterate through all event handlers, event handlers connected during the emission are not called
+			const uint32 nNumOfHandlers = BeginEmit();
+			for (uint32 i=0; i<nNumOfHandlers; i++) {
+				// Call the functor of the current event handler, skip event handlers disconnected during the emission
+				DynEventHandler *pHandler = m_pHandlers[i].pHandler;
+				if (pHandler)
+					static_cast<TypeHandler*>(pHandler)->m_cFunctor(t0, t1, t2, t3, t4, t5, t6, t7, t8, t9, t10, t11, t12, t13, t14);
 			}
+			EndEmit();
 		}
 
 		virtual String GetSignature() const override
@@ -350,18 +344,15 @@ class PLCORE_TMPL Event<T0, T1, T2, T3, T4, T5, T6, T7, T8, T9, T10, T11, T12, T
 
 		virtual void operator ()(_T0 t0, _T1 t1, _T2 t2, _T3 t3, _T4 t4, _T5 t5, _T6 t6, _T7 t7, _T8 t8, _T9 t9, _T10 t10, _T11 t11, _T12 t12, _T13 t13) const
 		{
-			// Iterate through all event handlers
-			const typename SimpleList<DynEventHandler*>::ListElement *pElement = m_lstHandlers.pFirstElement;
-			while (pElement) {
-				// Backup the next element because "pElement" may get invalid within the next step...
-				const typename SimpleList<DynEventHandler*>::ListElement *pNextElement = pElement->pNextElement;
-
-				// Call the functor of the current event handler
-				static_cast<TypeHandler*>(pElement->Data)->m_cFunctor(t0, t1, t2, t3, t4, t5, t6, t7, t8, t9, t10, t11, t12, t13);
-
-				// Next element, please
-				pElement = pNextElement;
+			// Iterate through all event handlers, event handlers connected during the emission are not called
+			const uint32 nNumOfHandlers = BeginEmit();
+			for (uint32 i=0; i<nNumOfHandlers; i++) {
+				// Call the functor of the current event handler, skip event handlers disconnected during the emission
+				DynEventHandler *pHandler = m_pHandlers[i].pHandler;
+				if (pHandler)
+					static_cast<TypeHandler*>(pHandler)->m_cFunctor(t0, t1, t2, t3, t4, t5, t6, t7, t8, t9, t10, t11, t12, t13);
 			}
+			EndEmit();
 		}
 
 		virtual String GetSignature() const override
@@ -480,18 +471,15 @@ class PLCORE_TMPL Event<T0, T1, T2, T3, T4, T5, T6, T7, T8, T9, T10, T11, T12> :
 
 		virtual void operator ()(_T0 t0, _T1 t1, _T2 t2, _T3 t3, _T4 t4, _T5 t5, _T6 t6, _T7 t7, _T8 t8, _T9 t9, _T10 t10, _T11 t11, _T12 t12) const
 		{
-			// Iterate through all event handlers
-			const typename SimpleList<DynEventHandler*>::ListElement *pElement = m_lstHandlers.pFirstElement;
-			while (pElement) {
-				// Backup the next element because "pElement" may get invalid within the next step...
-				const typename SimpleList<DynEventHandler*>::ListElement *pNextElement = pElement->pNextElement;
-
-				// Call the functor of the current event handler
-				static_cast<TypeHandler*>(pElement->Data)->m_cFunctor(t0, t1, t2, t3, t4, t5, t6, t7, t8, t9, t10, t11, t12);
-
-				// Next element, please
-				pElement = pNextElement;
+			// Iterate through all event handlers, event handlers connected during the emission are not called
+			const uint32 nNumOfHandlers = BeginEmit();
+			for (uint32 i=0; i<nNumOfHandlers; i++) {
+				// Call the functor of the current event handler, skip event handlers disconnected during the emission
+				DynEventHandler *pHandler = m_pHandlers[i].pHandler;
+				if (pHandler)
+					static_cast<TypeHandler*>(pHandler)->m_cFunctor(t0, t1, t2, t3, t4, t5, t6, t7, t8, t9, t10, t11, t12);
 			}
+			EndEmit();
 		}
 
 		virtual String GetSignature() const override
@@ -608,18 +596,15 @@ class PLCORE_TMPL Event<T0, T1, T2, T3, T4, T5, T6, T7, T8, T9, T10, T11> : publ
 
 		virtual void operator ()(_T0 t0, _T1 t1, _T2 t2, _T3 t3, _T4 t4, _T5 t5, _T6 t6, _T7 t7, _T8 t8, _T9 t9, _T10 t10, _T11 t11) const
 		{
-			// Iterate through all event handlers
-			const typename SimpleList<DynEventHandler*>::ListElement *pElement = m_lstHandlers.pFirstElement;
-			while (pElement) {
-				// Backup the next element because "pElement" may get invalid within the next step...
-				const typename SimpleList<DynEventHandler*>::ListElement *pNextElement = pElement->pNextElement;
-
-				// Call the functor of the current event handler
-				static_cast<TypeHandler*>(pElement->Data)->m_cFunctor(t0, t1, t2, t3, t4, t5, t6, t7, t8, t9, t10, t11);
-
-				// Next element, please
-				pElement = pNextElement;
+			// Iterate through all event handlers, event handlers connected during the emission are not called
+			const uint32 nNumOfHandlers = BeginEmit();
+			for (uint32 i=0; i<nNumOfHandlers; i++) {
+				// Call the functor of the current event handler, skip event handlers disconnected during the emission
+				DynEventHandler *pHandler = m_pHandlers[i].pHandler;
+				if (pHandler)
+					static_cast<TypeHandler*>(pHandler)->m_cFunctor(t0, t1, t2, t3, t4, t5, t6, t7, t8, t9, t10, t11);
 			}
+			EndEmit();
 		}
 
 		virtual String GetSignature() const override
@@ -732,18 +717,15 @@ class PLCORE_TMPL Event<T0, T1, T2, T3, T4, T5, T6, T7, T8, T9, T10> : public Dy
 
 		virtual void operator ()(_T0 t0, _T1 t1, _T2 t2, _T3 t3, _T4 t4, _T5 t5, _T6 t6, _T7 t7, _T8 t8, _T9 t9, _T10 t10) const
 		{
-			// Iterate through all event handlers
-			const typename SimpleList<DynEventHandler*>::ListElement *pElement = m_lstHandlers.pFirstElement;
-			while (pElement) {
-				// Backup the next element because "pElement" may get invalid within the next step...
-				const typename SimpleList<DynEventHandler*>::ListElement *pNextElement = pElement->pNextElement;
-
-				// Call the functor of the current event handler
-				static_cast<TypeHandler*>(pElement->Data)->m_cFunctor(t0, t1, t2, t3, t4, t5, t6, t7, t8, t9, t10);
-
-				// Next element, please
-				pElement = pNextElement;
+			// Iterate through all event handlers, event handlers connected during the emission are not called
+			const uint32 nNumOfHandlers = BeginEmit();
+			for (uint32 i=0; i<nNumOfHandlers; i++) {
+				// Call the functor of the current event handler, skip event handlers disconnected during the emission
+				DynEventHandler *pHandler = m_pHandlers[i].pHandler;
+				if (pHandler)
+					static_cast<TypeHandler*>(pHandler)->m_cFunctor(t0, t1, t2, t3, t4, t5, t6, t7, t8, t9, t10);
 			}
+			EndEmit();
 		}
 
 		virtual String GetSignature() const override
@@ -854,18 +836,15 @@ class PLCORE_TMPL Event<T0, T1, T2, T3, T4, T5, T6, T7, T8, T9> : public DynEven
 
 		virtual void operator ()(_T0 t0, _T1 t1, _T2 t2, _T3 t3, _T4 t4, _T5 t5, _T6 t6, _T7 t7, _T8 t8, _T9 t9) const
 		{
-			// Iterate through all event handlers
-			const typename SimpleList<DynEventHandler*>::ListElement *pElement = m_lstHandlers.pFirstElement;
-			while (pElement) {
-				// Backup the next element because "pElement" may get invalid within the next step...
-				const typename SimpleList<DynEventHandler*>::ListElement *pNextElement = pElement->pNextElement;
-
-				// Call the functor of the current event handler
-				static_cast<TypeHandler*>(pElement->Data)->m_cFunctor(t0, t1, t2, t3, t4, t5, t6, t7, t8, t9);
-
-				// Next element, please
-				pElement = pNextElement;
+			// Iterate through all event handlers, event handlers connected during the emission are not called
+			const uint32 nNumOfHandlers = BeginEmit();
+			for (uint32 i=0; i<nNumOfHandlers; i++) {
+				// Call the functor of the current event handler, skip event handlers disconnected during the emission
+				DynEventHandler *pHandler = m_pHandlers[i].pHandler;
+				if (pHandler)
+					static_cast<TypeHandler*>(pHandler)->m_cFunctor(t0, t1, t2, t3, t4, t5, t6, t7, t8, t9);
 			}
+			EndEmit();
 		}
 
 		virtual String GetSignature() const override
@@ -974,18 +953,15 @@ class PLCORE_TMPL Event<T0, T1, T2, T3, T4, T5, T6, T7, T8> : public DynEvent {
 
 		virtual void operator ()(_T0 t0, _T1 t1, _T2 t2, _T3 t3, _T4 t4, _T5 t5, _T6 t6, _T7 t7, _T8 t8) const
 		{
-			// Iterate through all event handlers
-			const typename SimpleList<DynEventHandler*>::ListElement *pElement = m_lstHandlers.pFirstElement;
-			while (pElement) {
-				// Backup the next element because "pElement" may get invalid within the next step...
-				const typename SimpleList<DynEventHandler*>::ListElement *pNextElement = pElement->pNextElement;
-
-				// Call the functor of the current event handler
-				static_cast<TypeHandler*>(pElement->Data)->m_cFunctor(t0, t1, t2, t3, t4, t5, t6, t7, t8);
-
-				// Next element, please
-				pElement = pNextElement;
+			// Iterate through all event handlers, event handlers connected during the emission are not called
+			const uint32 nNumOfHandlers = BeginEmit();
+			for (uint32 i=0; i<nNumOfHandlers; i++) {
+				// Call the functor of the current event handler, skip event handlers disconnected during the emission
+				DynEventHandler *pHandler = m_pHandlers[i].pHandler;
+				if (pHandler)
+					static_cast<TypeHandler*>(pHandler)->m_cFunctor(t0, t1, t2, t3, t4, t5, t6, t7, t8);
 			}
+			EndEmit();
 		}
 
 		virtual String GetSignature() const override
@@ -1092,18 +1068,15 @@ class PLCORE_TMPL Event<T0, T1, T2, T3, T4, T5, T6, T7> : public DynEvent {
 
 		virtual void operator ()(_T0 t0, _T1 t1, _T2 t2, _T3 t3, _T4 t4, _T5 t5, _T6 t6, _T7 t7) const
 		{
-			// Iterate through all event handlers
-			const typename SimpleList<DynEventHandler*>::ListElement *pElement = m_lstHandlers.pFirstElement;
-			while (pElement) {
-				// Backup the next element because "pElement" may get invalid within the next step...
-				const typename SimpleList<DynEventHandler*>::ListElement *pNextElement = pElement->pNextElement;
-
-				// Call the functor of the current event handler
-				static_cast<TypeHandler*>(pElement->Data)->m_cFunctor(t0, t1, t2, t3, t4, t5, t6, t7);
-
-				// Next element, please
-				pElement = pNextElement;
+			// Iterate through all event handlers, event handlers connected during the emission are not called
+			const uint32 nNumOfHandlers = BeginEmit();
+			for (uint32 i=0; i<nNumOfHandlers; i++) {
+				// Call the functor of the current event handler, skip event handlers disconnected during the emission
+				DynEventHandler *pHandler = m_pHandlers[i].pHandler;
+				if (pHandler)
+					static_cast<TypeHandler*>(pHandler)->m_cFunctor(t0, t1, t2, t3, t4, t5, t6, t7);
 			}
+			EndEmit();
 		}
 
 		virtual String GetSignature() const override
@@ -1206,18 +1179,15 @@ class PLCORE_TMPL Event<T0, T1, T2, T3, T4, T5, T6> : public DynEvent {
 
 		virtual void operator ()(_T0 t0, _T1 t1, _T2 t2, _T3 t3, _T4 t4, _T5 t5, _T6 t6) const
 		{
-			// Iterate through all event handlers
-			const typename SimpleList<DynEventHandler*>::ListElement *pElement = m_lstHandlers.pFirstElement;
-			while (pElement) {
-				// Backup the next element because "pElement" may get invalid within the next step...
-				const typename SimpleList<DynEventHandler*>::ListElement *pNextElement = pElement->pNextElement;
-
-				// Call the functor of the current event handler
-				static_cast<TypeHandler*>(pElement->Data)->m_cFunctor(t0, t1, t2, t3, t4, t5, t6);
-
-				// Next element, please
-				pElement = pNextElement;
+			// Iterate through all event handlers, event handlers connected during the emission are not called
+			const uint32 nNumOfHandlers = BeginEmit();
+			for (uint32 i=0; i<nNumOfHandlers; i++) {
+				// Call the functor of the current event handler, skip event handlers disconnected during the emission
+				DynEventHandler *pHandler = m_pHandlers[i].pHandler;
+				if (pHandler)
+					static_cast<TypeHandler*>(pHandler)->m_cFunctor(t0, t1, t2, t3, t4, t5, t6);
 			}
+			EndEmit();
 		}
 
 		virtual String GetSignature() const override
@@ -1318,18 +1288,15 @@ class PLCORE_TMPL Event<T0, T1, T2, T3, T4, T5> : public DynEvent {
 
 		virtual void operator ()(_T0 t0, _T1 t1, _T2 t2, _T3 t3, _T4 t4, _T5 t5) const
 		{
-			// Iterate through all event handlers
-			const typename SimpleList<DynEventHandler*>::ListElement *pElement = m_lstHandlers.pFirstElement;
-			while (pElement) {
-				// Backup the next element because "pElement" may get invalid within the next step...
-				const typename SimpleList<DynEventHandler*>::ListElement *pNextElement = pElement->pNextElement;
-
-				// Call the functor of the current event handler
-				static_cast<TypeHandler*>(pElement->Data)->m_cFunctor(t0, t1, t2, t3, t4, t5);
-
-				// Next element, please
-				pElement = pNextElement;
+			// Iterate through all event handlers, event handlers connected during the emission are not called
+			const uint32 nNumOfHandlers = BeginEmit();
+			for (uint32 i=0; i<nNumOfHandlers; i++) {
+				// Call the functor of the current event handler, skip event handlers disconnected during the emission
+				DynEventHandler *pHandler = m_pHandlers[i].pHandler;
+				if (pHandler)
+					static_cast<TypeHandler*>(pHandler)->m_cFunctor(t0, t1, t2, t3, t4, t5);
 			}
+			EndEmit();
 		}
 
 		virtual String GetSignature() const override
@@ -1428,18 +1395,15 @@ class PLCORE_TMPL Event<T0, T1, T2, T3, T4> : public DynEvent {
 
 		virtual void operator ()(_T0 t0, _T1 t1, _T2 t2, _T3 t3, _T4 t4) const
 		{
-			// Iterate through all event handlers
-			const typename SimpleList<DynEventHandler*>::ListElement *pElement = m_lstHandlers.pFirstElement;
-			while (pElement) {
-				// Backup the next element because "pElement" may get invalid within the next step...
-				const typename SimpleList<DynEventHandler*>::ListElement *pNextElement = pElement->pNextElement;
-
-				// Call the functor of the current event handler
-				static_cast<TypeHandler*>(pElement->Data)->m_cFunctor(t0, t1, t2, t3, t4);
-
-				// Next element, please
-				pElement = pNextElement;
+			// Iterate through all event handlers, event handlers connected during the emission are not called
+			const uint32 nNumOfHandlers = BeginEmit();
+			for (uint32 i=0; i<nNumOfHandlers; i++) {
+				// Call the functor of the current event handler, skip event handlers disconnected during the emission
+				DynEventHandler *pHandler = m_pHandlers[i].pHandler;
+				if (pHandler)
+					static_cast<TypeHandler*>(pHandler)->m_cFunctor(t0, t1, t2, t3, t4);
 			}
+			EndEmit();
 		}
 
 		virtual String GetSignature() const override
@@ -1536,18 +1500,15 @@ class PLCORE_TMPL Event<T0, T1, T2, T3> : public DynEvent {
 
 		virtual void operator ()(_T0 t0, _T1 t1, _T2 t2, _T3 t3) const
 		{
-			// Iterate through all event handlers
-			const typename SimpleList<DynEventHandler*>::ListElement *pElement = m_lstHandlers.pFirstElement;
-			while (pElement) {
-				// Backup the next element because "pElement" may get invalid within the next step...
-				const typename SimpleList<DynEventHandler*>::ListElement *pNextElement = pElement->pNextElement;
-
-				// Call the functor of the current event handler
-				static_cast<TypeHandler*>(pElement->Data)->m_cFunctor(t0, t1, t2, t3);
-
-				// Next element, please
-				pElement = pNextElement;
+			// Iterate through all event handlers, event handlers connected during the emission are not called
+			const uint32 nNumOfHandlers = BeginEmit();
+			for (uint32 i=0; i<nNumOfHandlers; i++) {
+				// Call the functor of the current event handler, skip event handlers disconnected during the emission
+				DynEventHandler *pHandler = m_pHandlers[i].pHandler;
+				if (pHandler)
+					static_cast<TypeHandler*>(pHandler)->m_cFunctor(t0, t1, t2, t3);
 			}
+			EndEmit();
 		}
 
 		virtual String GetSignature() const override
@@ -1640,18 +1601,15 @@ class PLCORE_TMPL Event<T0, T1, T2> : public DynEvent {
 
 		virtual void operator ()(_T0 t0, _T1 t1, _T2 t2) const
 		{
-			// Iterate through all event handlers
-			const typename SimpleList<DynEventHandler*>::ListElement *pElement = m_lstHandlers.pFirstElement;
-			while (pElement) {
-				// Backup the next element because "pElement" may get invalid within the next step...
-				const typename SimpleList<DynEventHandler*>::ListElement *pNextElement = pElement->pNextElement;
-
-				// Call the functor of the current event handler
-				static_cast<TypeHandler*>(pElement->Data)->m_cFunctor(t0, t1, t2);
-
-				// Next element, please
-				pElement = pNextElement;
+			// Iterate through all event handlers, event handlers connected during the emission are not called
+			const uint32 nNumOfHandlers = BeginEmit();
+			for (uint32 i=0; i<nNumOfHandlers; i++) {
+				// Call the functor of the current event handler, skip event handlers disconnected during the emission
+				DynEventHandler *pHandler = m_pHandlers[i].pHandler;
+				if (pHandler)
+					static_cast<TypeHandler*>(pHandler)->m_cFunctor(t0, t1, t2);
 			}
+			EndEmit();
 		}
 
 		virtual String GetSignature() const override
@@ -1742,18 +1700,15 @@ class PLCORE_TMPL Event<T0, T1> : public DynEvent {
 
 		virtual void operator ()(_T0 t0, _T1 t1) const
 		{
-			// Iterate through all event handlers
-			const SimpleList<DynEventHandler*>::ListElement *pElement = m_lstHandlers.pFirstElement;
-			while (pElement) {
-				// Backup the next element because "pElement" may get invalid within the next step...
-				const SimpleList<DynEventHandler*>::ListElement *pNextElement = pElement->pNextElement;
-
-				// Call the functor of the current event handler
-				static_cast<TypeHandler*>(pElement->Data)->m_cFunctor(t0, t1);
-
-				// Next element, please
-				pElement = pNextElement;
+			// Iterate through all event handlers, event handlers connected during the emission are not called
+			const uint32 nNumOfHandlers = BeginEmit();
+			for (uint32 i=0; i<nNumOfHandlers; i++) {
+				// Call the functor of the current event handler, skip event handlers disconnected during the emission
+				DynEventHandler *pHandler = m_pHandlers[i].pHandler;
+				if (pHandler)
+					static_cast<TypeHandler*>(pHandler)->m_cFunctor(t0, t1);
 			}
+			EndEmit();
 		}
 
 		virtual String GetSignature() const override
@@ -1844,18 +1799,15 @@ class PLCORE_TMPL Event<T0> : public DynEvent {
 
 		virtual void operator ()(_T0 t0) const
 		{
-			// Iterate through all event handlers
-			const SimpleList<DynEventHandler*>::ListElement *pElement = m_lstHandlers.pFirstElement;
-			while (pElement) {
-				// Backup the next element because "pElement" may get invalid within the next step...
-				const SimpleList<DynEventHandler*>::ListElement *pNextElement = pElement->pNextElement;
-
-				// Call the functor of the current event handler
-				static_cast<TypeHandler*>(pElement->Data)->m_cFunctor(t0);
-
-				// Next element, please
-				pElement = pNextElement;
+			// Iterate through all event handlers, event handlers connected during the emission are not called
+			const uint32 nNumOfHandlers = BeginEmit();
+			for (uint32 i=0; i<nNumOfHandlers; i++) {
+				// Call the functor of the current event handler, skip event handlers disconnected during the emission
+				DynEventHandler *pHandler = m_pHandlers[i].pHandler;
+				if (pHandler)
+					static_cast<TypeHandler*>(pHandler)->m_cFunctor(t0);
 			}
+			EndEmit();
 		}
 
 		virtual String GetSignature() const override
@@ -1942,18 +1894,15 @@ class PLCORE_TMPL Event<> : public DynEvent {
 
 		virtual void operator ()() const
 		{
-			// Iterate through all event handlers
-			const SimpleList<DynEventHandler*>::ListElement *pElement = m_lstHandlers.pFirstElement;
-			while (pElement) {
-				// Backup the next element because "pElement" may get invalid within the next step...
-				const SimpleList<DynEventHandler*>::ListElement *pNextElement = pElement->pNextElement;
-
-				// Call the functor of the current event handler
-				static_cast<TypeHandler*>(pElement->Data)->m_cFunctor();
-
-				// Next element, please
-				pElement = pNextElement;
+			// Iterate through all event handlers, event handlers connected during the emission are not called
+			const uint32 nNumOfHandlers = BeginEmit();
+			for (uint32 i=0; i<nNumOfHandlers; i++) {
+				// Call the functor of the current event handler, skip event handlers disconnected during the emission
+				DynEventHandler *pHandler = m_pHandlers[i].pHandler;
+				if (pHandler)
+					static_cast<TypeHandler*>(pHandler)->m_cFunctor();
 			}
+			EndEmit();
 		}
 
 		virtual String GetSignature() const override
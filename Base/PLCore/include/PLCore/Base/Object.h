@@ -208,12 +208,39 @@ class Object : public ObjectBase {
 		*/
 		PLCORE_API Object();
 
+		/**
+		*  @brief
+		*    Copy constructor
+		*
+		*  @param[in] cSource
+		*    Source to copy from
+		*
+		*  @note
+		*    - Signals and the reference count are not copied
+		*/
+		PLCORE_API Object(const Object &cSource);
+
 		/**
 		*  @brief
 		*    Destructor
 		*/
 		PLCORE_API virtual ~Object();
 
+		/**
+		*  @brief
+		*    Copy operator
+		*
+		*  @param[in] cSource
+		*    Source to copy from
+		*
+		*  @return
+		*    Reference to this instance
+		*
+		*  @note
+		*    - Signals and the reference count are not copied
+		*/
+		PLCORE_API Object &operator =(const Object &cSource);
+
 		//[-------------------------------------------------------]
 		//[ Class and members                                     ]
 		//[-------------------------------------------------------]
@@ -0,0 +1,351 @@
+/*********************************************************\
+ *  File: FlatHashMap.h                                  *
+ *
+ *  Copyright (C) 2002-2013 The PixelLight Team (http://www.pixellight.org/)
+ *
+ *  This file is part of PixelLight.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ *  and associated documentation files (the "Software"), to deal in the Software without
+ *  restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ *  Software is furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all copies or
+ *  substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ *  BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ *  DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ *  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+#ifndef __PLCORE_CONTAINER_FLATHASHMAP_H__
+#define __PLCORE_CONTAINER_FLATHASHMAP_H__
+#pragma once
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include "PLCore/Container/Map.h"
+#include "PLCore/Container/Functions.h"
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace PLCore {
+
+
+//[-------------------------------------------------------]
+//[ Forward declarations                                  ]
+//[-------------------------------------------------------]
+template <class KeyType, class ValueType, class Hasher, class Comparer> class FlatHashMapIterator;
+template <class KeyType, class ValueType, class Hasher, class Comparer> class FlatHashMapKeyIterator;
+
+
+//[-------------------------------------------------------]
+//[ Classes                                               ]
+//[-------------------------------------------------------]
+/**
+*  @brief
+*    Open addressing hash map template
+*
+*  @remarks
+*    Unlike "HashMap", which stores each element within an own heap allocated slot which is
+*    linked into a list per bucket, this hash map stores all key/value pairs within one
+*    contiguous array. Collisions are resolved by linear probing using the "Robin Hood"
+*    strategy: During insertion, an element which is farther away from its home slot takes
+*    over the slot of an element which is closer to its home slot. This keeps the probe
+*    sequences short and uniform, allows lookups to stop early and makes it possible to
+*    remove elements by shifting the following elements back instead of using tombstones.
+*
+*    The probe lengths are stored within a separate array, so a lookup usually touches only a
+*    few cache lines and insertion does not need any memory allocation as long as the map does
+*    not have to grow.
+*
+*    The number of slots is always a power of two. The given hasher result is scrambled by
+*    using Fibonacci hashing, so weak hash functions like the identity hash used for integers
+*    by "HashFunction" are distributed well. The map grows as soon as more than 7/8 of the
+*    slots are used.
+*
+*  @note
+*    - Has the same interface as "HashMap" and can be used as drop-in replacement
+*    - "KeyType" and "ValueType" must be default constructable and assignable
+*    - Adding or removing elements invalidates all iterators and references to values
+*    - Use this map if there are many lookups and the number of elements is known at least roughly
+*/
+template <class KeyType, class ValueType, class Hasher = HashFunction, class Comparer = CompareFunction>
+class FlatHashMap : public Map<KeyType, ValueType> {
+
+
+	//[-------------------------------------------------------]
+	//[ Friends                                               ]
+	//[-------------------------------------------------------]
+	friend class FlatHashMapIterator<KeyType, ValueType, Hasher, Comparer>;
+	friend class FlatHashMapKeyIterator<KeyType, ValueType, Hasher, Comparer>;
+
+
+	//[-------------------------------------------------------]
+	//[ Public static variables                               ]
+	//[-------------------------------------------------------]
+	public:
+		static ValueType Null;	/**< 'Null'-object, do NEVER EVER manipulate this object! */
+
+
+	//[-------------------------------------------------------]
+	//[ Public functions                                      ]
+	//[-------------------------------------------------------]
+	public:
+		/**
+		*  @brief
+		*    Constructor
+		*
+		*  @param[in] nNumOfSlots
+		*    Initial number of slots, rounded up to the next power of two (minimum is 8)
+		*
+		*  @remarks
+		*    The slots are created when the first element is added. If you know the number of
+		*    elements in advance, pass "number of elements * 8 / 7 + 1" to avoid growing.
+		*/
+		FlatHashMap(uint32 nNumOfSlots = 16);
+
+		/**
+		*  @brief
+		*    Copy constructor
+		*
+		*  @param[in] cSource
+		*    Source to copy from
+		*/
+		FlatHashMap(const FlatHashMap<KeyType, ValueType, Hasher, Comparer> &cSource);
+
+		/**
+		*  @brief
+		*    Destructor
+		*/
+		virtual ~FlatHashMap();
+
+		/**
+		*  @brief
+		*    Copy operator
+		*
+		*  @param[in] cSource
+		*    'FlatHashMap' to copy from
+		*
+		*  @return
+		*    Reference to this instance
+		*/
+		Map<KeyType, ValueType> &operator =(const FlatHashMap<KeyType, ValueType, Hasher, Comparer> &cSource);
+
+		/**
+		*  @brief
+		*    Returns the current number of slots
+		*
+		*  @return
+		*    Current number of slots, always a power of two
+		*/
+		uint32 GetNumOfSlots() const;
+
+		/**
+		*  @brief
+		*    Ensures that the given number of elements can be stored without growing
+		*
+		*  @param[in] nNumOfElements
+		*    Number of elements the map should be able to hold
+		*
+		*  @note
+		*    - Never shrinks the map
+		*/
+		void Reserve(uint32 nNumOfElements);
+
+		/**
+		*  @brief
+		*    Returns some statistics
+		*
+		*  @param[out] nMaxProbeLength
+		*    Will receive the longest probe sequence of all elements (1 means the element is within its home slot)
+		*  @param[out] fAverageProbeLength
+		*    Will receive the average probe sequence length of all elements
+		*
+		*  @note
+		*    - If the probe sequences are long you should try to use a more efficient hash function
+		*/
+		void GetStatistics(uint32 &nMaxProbeLength, float &fAverageProbeLength) const;
+
+
+	//[-------------------------------------------------------]
+	//[ Private definitions                                   ]
+	//[-------------------------------------------------------]
+	private:
+		static const uint32 MinNumOfSlots = 8;	/**< Minimum number of slots, must be a power of two */
+
+
+	//[-------------------------------------------------------]
+	//[ Private structures                                    ]
+	//[-------------------------------------------------------]
+	private:
+		/**
+		*  @brief
+		*    Internal slot
+		*/
+		struct Slot {
+			KeyType   Key;		/**< The key */
+			ValueType Value;	/**< The value */
+		};
+
+
+	//[-------------------------------------------------------]
+	//[ Private functions                                     ]
+	//[-------------------------------------------------------]
+	private:
+		/**
+		*  @brief
+		*    Returns the home slot index of a key
+		*
+		*  @param[in] Key
+		*    Key to return the home slot index of
+		*
+		*  @return
+		*    The home slot index
+		*
+		*  @note
+		*    - The slots must already be created
+		*/
+		uint32 GetHomeSlot(const KeyType &Key) const;
+
+		/**
+		*  @brief
+		*    Returns the index of the slot with the given key
+		*
+		*  @param[in] Key
+		*    Key to look for
+		*
+		*  @return
+		*    Slot index, >= GetNumOfSlots() if the key was not found
+		*/
+		uint32 FindSlot(const KeyType &Key) const;
+
+		/**
+		*  @brief
+		*    Returns the index of the first used slot at or after the given slot index
+		*
+		*  @param[in] nIndex
+		*    Slot index to start the search at
+		*
+		*  @return
+		*    Slot index, >= GetNumOfSlots() if there's no such slot
+		*/
+		uint32 GetNextUsedSlot(uint32 nIndex) const;
+
+		/**
+		*  @brief
+		*    Returns the index of the last used slot before the given slot index
+		*
+		*  @param[in] nIndex
+		*    Slot index to start the search at (this slot itself is not checked)
+		*
+		*  @return
+		*    Slot index, >= GetNumOfSlots() if there's no such slot
+		*/
+		uint32 GetPreviousUsedSlot(uint32 nIndex) const;
+
+		/**
+		*  @brief
+		*    Inserts an element without checking whether or not the key is already within the map
+		*
+		*  @param[in] Key
+		*    The key of the element which should be added
+		*  @param[in] Value
+		*    The value which should be added
+		*
+		*  @note
+		*    - Grows the map if required
+		*/
+		void Insert(const KeyType &Key, const ValueType &Value);
+
+		/**
+		*  @brief
+		*    Removes the element within the given slot by shifting the following elements back
+		*
+		*  @param[in] nIndex
+		*    Index of the used slot to remove the element from
+		*/
+		void RemoveSlot(uint32 nIndex);
+
+		/**
+		*  @brief
+		*    Rebuilds the map using the given number of slots
+		*
+		*  @param[in] nNumOfSlots
+		*    New number of slots, must be a power of two and large enough to hold all elements
+		*/
+		void Rehash(uint32 nNumOfSlots);
+
+
+	//[-------------------------------------------------------]
+	//[ Private data                                          ]
+	//[-------------------------------------------------------]
+	private:
+		uint32  m_nNumOfSlots;		/**< The current number of slots, always a power of two */
+		uint32  m_nSlotShift;		/**< Shift used to map a scrambled 32 bit hash into the slot range */
+		Slot   *m_pSlots;			/**< Slots, can be a null pointer (created when the first element is added) */
+		uint32 *m_pnProbeLength;	/**< Probe length per slot (0 = unused slot, 1 = element is within its home slot...), can be a null pointer */
+		uint32  m_nNumOfElements;	/**< Current number of elements within the map */
+
+
+	//[-------------------------------------------------------]
+	//[ Public virtual Iterable functions                     ]
+	//[-------------------------------------------------------]
+	public:
+		virtual Iterator<ValueType> GetIterator(uint32 nIndex = 0) const override;
+		virtual ConstIterator<ValueType> GetConstIterator(uint32 nIndex = 0) const override;
+		virtual Iterator<ValueType> GetEndIterator() const override;
+		virtual ConstIterator<ValueType> GetConstEndIterator() const override;
+
+
+	//[-------------------------------------------------------]
+	//[ Public virtual Map functions                          ]
+	//[-------------------------------------------------------]
+	public:
+		virtual void Clear() override;
+		virtual bool IsEmpty() const override;
+		virtual uint32 GetNumOfElements() const override;
+		virtual bool Add(const KeyType &Key, const ValueType &Value) override;
+		virtual bool Replace(const KeyType &Key, const ValueType &NewValue) override;
+		virtual bool Set(const KeyType &Key, const ValueType &Value) override;
+		virtual bool Remove(const KeyType &Key) override;
+		virtual uint32 RemoveValue(const ValueType &Value) override;
+		virtual const ValueType &Get(const KeyType &Key) const override;
+		virtual ValueType &Get(const KeyType &Key) override;
+		virtual Iterator<KeyType> GetKeyIterator(uint32 nIndex = 0) const override;
+		virtual ConstIterator<KeyType> GetConstKeyIterator(uint32 nIndex = 0) const override;
+		virtual Iterator<KeyType> GetEndKeyIterator() const override;
+		virtual ConstIterator<KeyType> GetConstEndKeyIterator() const override;
+
+
+	//[-------------------------------------------------------]
+	//[ Private virtual Map functions                         ]
+	//[-------------------------------------------------------]
+	private:
+		virtual Map<KeyType, ValueType> &operator =(const Map<KeyType, ValueType> &cMap) override;
+
+
+};
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+} // PLCore
+
+
+//[-------------------------------------------------------]
+//[ Implementation                                        ]
+//[-------------------------------------------------------]
+#include "PLCore/Container/FlatHashMap.inl"
+
+
+#endif // __PLCORE_CONTAINER_FLATHASHMAP_H__
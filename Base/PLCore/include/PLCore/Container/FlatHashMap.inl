@@ -0,0 +1,611 @@
+/*********************************************************\
+ *  File: FlatHashMap.inl                                *
+ *      Open addressing hash map template implementation
+ *
+ *  Copyright (C) 2002-2013 The PixelLight Team (http://www.pixellight.org/)
+ *
+ *  This file is part of PixelLight.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ *  and associated documentation files (the "Software"), to deal in the Software without
+ *  restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ *  Software is furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all copies or
+ *  substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ *  BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ *  DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ *  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include "PLCore/Core/MemoryManager.h"
+#include "PLCore/Container/FlatHashMapIterator.h"
+#include "PLCore/Container/FlatHashMapKeyIterator.h"
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace PLCore {
+
+
+//[-------------------------------------------------------]
+//[ Public static variables                               ]
+//[-------------------------------------------------------]
+template <class KeyType, class ValueType, class Hasher, class Comparer> ValueType FlatHashMap<KeyType, ValueType, Hasher, Comparer>::Null;
+
+
+//[-------------------------------------------------------]
+//[ Public functions                                      ]
+//[-------------------------------------------------------]
+/**
+*  @brief
+*    Constructor
+*/
+template <class KeyType, class ValueType, class Hasher, class Comparer>
+FlatHashMap<KeyType, ValueType, Hasher, Comparer>::FlatHashMap(uint32 nNumOfSlots) :
+	m_nNumOfSlots(MinNumOfSlots),
+	m_nSlotShift(29),
+	m_pSlots(nullptr),
+	m_pnProbeLength(nullptr),
+	m_nNumOfElements(0)
+{
+	// Round the number of slots up to the next power of two
+	while (m_nNumOfSlots < nNumOfSlots && m_nSlotShift > 1) {
+		m_nNumOfSlots <<= 1;
+		m_nSlotShift--;
+	}
+}
+
+/**
+*  @brief
+*    Copy constructor
+*/
+template <class KeyType, class ValueType, class Hasher, class Comparer>
+FlatHashMap<KeyType, ValueType, Hasher, Comparer>::FlatHashMap(const FlatHashMap<KeyType, ValueType, Hasher, Comparer> &cSource) :
+	m_nNumOfSlots(cSource.m_nNumOfSlots),
+	m_nSlotShift(cSource.m_nSlotShift),
+	m_pSlots(nullptr),
+	m_pnProbeLength(nullptr),
+	m_nNumOfElements(0)
+{
+	// Copy data
+	*this = cSource;
+}
+
+/**
+*  @brief
+*    Destructor
+*/
+template <class KeyType, class ValueType, class Hasher, class Comparer>
+FlatHashMap<KeyType, ValueType, Hasher, Comparer>::~FlatHashMap()
+{
+	// Destroy the slots
+	if (m_pSlots) {
+		delete [] m_pSlots;
+		delete [] m_pnProbeLength;
+	}
+}
+
+/**
+*  @brief
+*    Copy operator
+*/
+template <class KeyType, class ValueType, class Hasher, class Comparer>
+Map<KeyType, ValueType> &FlatHashMap<KeyType, ValueType, Hasher, Comparer>::operator =(const FlatHashMap<KeyType, ValueType, Hasher, Comparer> &cSource)
+{
+	// Destroy the old slots
+	if (m_pSlots) {
+		delete [] m_pSlots;
+		delete [] m_pnProbeLength;
+		m_pSlots        = nullptr;
+		m_pnProbeLength = nullptr;
+	}
+
+	// Copy data
+	m_nNumOfSlots    = cSource.m_nNumOfSlots;
+	m_nSlotShift     = cSource.m_nSlotShift;
+	m_nNumOfElements = cSource.m_nNumOfElements;
+	if (cSource.m_pSlots) {
+		// The slot layout only depends on the number of slots, so we can just copy it 1:1
+		m_pSlots        = new Slot[m_nNumOfSlots];
+		m_pnProbeLength = new uint32[m_nNumOfSlots];
+		MemoryManager::Copy(m_pnProbeLength, cSource.m_pnProbeLength, sizeof(uint32)*m_nNumOfSlots);
+		for (uint32 i=0; i<m_nNumOfSlots; i++) {
+			if (m_pnProbeLength[i])
+				m_pSlots[i] = cSource.m_pSlots[i];
+		}
+	}
+
+	// Return this instance
+	return *this;
+}
+
+/**
+*  @brief
+*    Returns the current number of slots
+*/
+template <class KeyType, class ValueType, class Hasher, class Comparer>
+uint32 FlatHashMap<KeyType, ValueType, Hasher, Comparer>::GetNumOfSlots() const
+{
+	return m_nNumOfSlots;
+}
+
+/**
+*  @brief
+*    Ensures that the given number of elements can be stored without growing
+*/
+template <class KeyType, class ValueType, class Hasher, class Comparer>
+void FlatHashMap<KeyType, ValueType, Hasher, Comparer>::Reserve(uint32 nNumOfElements)
+{
+	// Get the required number of slots (load factor of 7/8)
+	uint32 nNumOfSlots = m_nNumOfSlots;
+	while (nNumOfElements > nNumOfSlots - (nNumOfSlots >> 3) && nNumOfSlots < 0x80000000)
+		nNumOfSlots <<= 1;
+
+	// Grow now?
+	if (nNumOfSlots > m_nNumOfSlots) {
+		if (m_pSlots) {
+			Rehash(nNumOfSlots);
+		} else {
+			// The slots are created when the first element is added
+			while (m_nNumOfSlots < nNumOfSlots) {
+				m_nNumOfSlots <<= 1;
+				m_nSlotShift--;
+			}
+		}
+	}
+}
+
+/**
+*  @brief
+*    Returns some statistics
+*/
+template <class KeyType, class ValueType, class Hasher, class Comparer>
+void FlatHashMap<KeyType, ValueType, Hasher, Comparer>::GetStatistics(uint32 &nMaxProbeLength, float &fAverageProbeLength) const
+{
+	// Init statistics
+	nMaxProbeLength     = 0;
+	fAverageProbeLength = 0.0f;
+
+	// Slots already created?
+	if (m_pSlots && m_nNumOfElements) {
+		// Get statistics
+		uint32 nTotalProbeLength = 0;
+		for (uint32 i=0; i<m_nNumOfSlots; i++) {
+			const uint32 nProbeLength = m_pnProbeLength[i];
+			nTotalProbeLength += nProbeLength;
+			if (nMaxProbeLength < nProbeLength)
+				nMaxProbeLength = nProbeLength;
+		}
+		fAverageProbeLength = static_cast<float>(nTotalProbeLength)/m_nNumOfElements;
+	}
+}
+
+
+//[-------------------------------------------------------]
+//[ Private functions                                     ]
+//[-------------------------------------------------------]
+/**
+*  @brief
+*    Returns the home slot index of a key
+*/
+template <class KeyType, class ValueType, class Hasher, class Comparer>
+uint32 FlatHashMap<KeyType, ValueType, Hasher, Comparer>::GetHomeSlot(const KeyType &Key) const
+{
+	// Fibonacci hashing: Multiply by 2^32/golden ratio and use the upper bits
+	return (Hasher::Hash(Key)*2654435769U) >> m_nSlotShift;
+}
+
+/**
+*  @brief
+*    Returns the index of the slot with the given key
+*/
+template <class KeyType, class ValueType, class Hasher, class Comparer>
+uint32 FlatHashMap<KeyType, ValueType, Hasher, Comparer>::FindSlot(const KeyType &Key) const
+{
+	// Slots already created?
+	if (m_pSlots) {
+		const uint32 nMask = m_nNumOfSlots - 1;
+		uint32 nIndex = GetHomeSlot(Key);
+
+		// Elements are ordered by their probe length, so we can stop as soon as we find an element
+		// which is closer to its home slot than the key we're looking for would be
+		for (uint32 nProbeLength=1; m_pnProbeLength[nIndex]>=nProbeLength; nProbeLength++) {
+			// Compare keys
+			if (m_pnProbeLength[nIndex] == nProbeLength && Comparer::AreEqual(m_pSlots[nIndex].Key, Key))
+				return nIndex;
+
+			// Get next slot
+			nIndex = (nIndex + 1) & nMask;
+		}
+	}
+
+	// Error, key not found!
+	return m_nNumOfSlots;
+}
+
+/**
+*  @brief
+*    Returns the index of the first used slot at or after the given slot index
+*/
+template <class KeyType, class ValueType, class Hasher, class Comparer>
+uint32 FlatHashMap<KeyType, ValueType, Hasher, Comparer>::GetNextUsedSlot(uint32 nIndex) const
+{
+	// Slots already created?
+	if (m_pSlots) {
+		for (; nIndex<m_nNumOfSlots; nIndex++) {
+			if (m_pnProbeLength[nIndex])
+				return nIndex;
+		}
+	}
+
+	// There's no such slot
+	return m_nNumOfSlots;
+}
+
+/**
+*  @brief
+*    Returns the index of the last used slot before the given slot index
+*/
+template <class KeyType, class ValueType, class Hasher, class Comparer>
+uint32 FlatHashMap<KeyType, ValueType, Hasher, Comparer>::GetPreviousUsedSlot(uint32 nIndex) const
+{
+	// Slots already created?
+	if (m_pSlots) {
+		if (nIndex > m_nNumOfSlots)
+			nIndex = m_nNumOfSlots;
+		while (nIndex > 0) {
+			nIndex--;
+			if (m_pnProbeLength[nIndex])
+				return nIndex;
+		}
+	}
+
+	// There's no such slot
+	return m_nNumOfSlots;
+}
+
+/**
+*  @brief
+*    Inserts an element without checking whether or not the key is already within the map
+*/
+template <class KeyType, class ValueType, class Hasher, class Comparer>
+void FlatHashMap<KeyType, ValueType, Hasher, Comparer>::Insert(const KeyType &Key, const ValueType &Value)
+{
+	// Slots already created?
+	if (m_pSlots) {
+		// Do we have to grow the hash map now? (load factor of 7/8)
+		if (m_nNumOfElements >= m_nNumOfSlots - (m_nNumOfSlots >> 3))
+			Rehash(m_nNumOfSlots << 1);
+	} else {
+		m_pSlots        = new Slot[m_nNumOfSlots];
+		m_pnProbeLength = new uint32[m_nNumOfSlots];
+		MemoryManager::Set(m_pnProbeLength, 0, sizeof(uint32)*m_nNumOfSlots);
+	}
+
+	// The element we currently try to find a slot for
+	Slot  sSlot;
+	sSlot.Key   = Key;
+	sSlot.Value = Value;
+	uint32 nProbeLength = 1;
+
+	// Find a free slot
+	const uint32 nMask = m_nNumOfSlots - 1;
+	uint32 nIndex = GetHomeSlot(Key);
+	while (m_pnProbeLength[nIndex]) {
+		// Robin Hood: If the element within this slot is closer to its home slot, take the slot over
+		if (m_pnProbeLength[nIndex] < nProbeLength) {
+			const Slot sTemp = m_pSlots[nIndex];
+			m_pSlots[nIndex] = sSlot;
+			sSlot = sTemp;
+
+			const uint32 nTemp = m_pnProbeLength[nIndex];
+			m_pnProbeLength[nIndex] = nProbeLength;
+			nProbeLength = nTemp;
+		}
+
+		// Get next slot
+		nIndex = (nIndex + 1) & nMask;
+		nProbeLength++;
+	}
+
+	// Use the free slot
+	m_pSlots[nIndex]        = sSlot;
+	m_pnProbeLength[nIndex] = nProbeLength;
+
+	// Update the number of elements counter
+	m_nNumOfElements++;
+}
+
+/**
+*  @brief
+*    Removes the element within the given slot by shifting the following elements back
+*/
+template <class KeyType, class ValueType, class Hasher, class Comparer>
+void FlatHashMap<KeyType, ValueType, Hasher, Comparer>::RemoveSlot(uint32 nIndex)
+{
+	const uint32 nMask = m_nNumOfSlots - 1;
+
+	// Shift back all following elements which are not within their home slot
+	uint32 nNextIndex = (nIndex + 1) & nMask;
+	while (m_pnProbeLength[nNextIndex] > 1) {
+		m_pSlots[nIndex]        = m_pSlots[nNextIndex];
+		m_pnProbeLength[nIndex] = m_pnProbeLength[nNextIndex] - 1;
+		nIndex     = nNextIndex;
+		nNextIndex = (nNextIndex + 1) & nMask;
+	}
+
+	// Mark the last slot as unused and release the references the key and value may hold
+	m_pnProbeLength[nIndex] = 0;
+	m_pSlots[nIndex].Key    = Map<KeyType, ValueType>::NullKey;
+	m_pSlots[nIndex].Value  = Null;
+
+	// Update the number of elements counter
+	m_nNumOfElements--;
+}
+
+/**
+*  @brief
+*    Rebuilds the map using the given number of slots
+*/
+template <class KeyType, class ValueType, class Hasher, class Comparer>
+void FlatHashMap<KeyType, ValueType, Hasher, Comparer>::Rehash(uint32 nNumOfSlots)
+{
+	// Backup the old slots
+	Slot   *pOldSlots        = m_pSlots;
+	uint32 *pnOldProbeLength = m_pnProbeLength;
+	uint32  nOldNumOfSlots   = m_nNumOfSlots;
+
+	// Create the new slots
+	while (m_nNumOfSlots < nNumOfSlots) {
+		m_nNumOfSlots <<= 1;
+		m_nSlotShift--;
+	}
+	m_pSlots         = new Slot[m_nNumOfSlots];
+	m_pnProbeLength  = new uint32[m_nNumOfSlots];
+	m_nNumOfElements = 0;
+	MemoryManager::Set(m_pnProbeLength, 0, sizeof(uint32)*m_nNumOfSlots);
+
+	// Add the elements from the old slots into the new ones
+	if (pOldSlots) {
+		for (uint32 i=0; i<nOldNumOfSlots; i++) {
+			if (pnOldProbeLength[i])
+				Insert(pOldSlots[i].Key, pOldSlots[i].Value);
+		}
+
+		// Destroy the old slots
+		delete [] pOldSlots;
+		delete [] pnOldProbeLength;
+	}
+}
+
+
+//[-------------------------------------------------------]
+//[ Public virtual Iterable functions                     ]
+//[-------------------------------------------------------]
+template <class KeyType, class ValueType, class Hasher, class Comparer>
+Iterator<ValueType> FlatHashMap<KeyType, ValueType, Hasher, Comparer>::GetIterator(uint32 nIndex) const
+{
+	Iterator<ValueType> cIterator(*(new FlatHashMapIterator<KeyType, ValueType, Hasher, Comparer>(*this, nIndex)));
+	return cIterator;
+}
+
+template <class KeyType, class ValueType, class Hasher, class Comparer>
+ConstIterator<ValueType> FlatHashMap<KeyType, ValueType, Hasher, Comparer>::GetConstIterator(uint32 nIndex) const
+{
+	ConstIterator<ValueType> cIterator(*(new FlatHashMapIterator<KeyType, ValueType, Hasher, Comparer>(*this, nIndex)));
+	return cIterator;
+}
+
+template <class KeyType, class ValueType, class Hasher, class Comparer>
+Iterator<ValueType> FlatHashMap<KeyType, ValueType, Hasher, Comparer>::GetEndIterator() const
+{
+	Iterator<ValueType> cIterator(*(new FlatHashMapIterator<KeyType, ValueType, Hasher, Comparer>(*this)));
+	return cIterator;
+}
+
+template <class KeyType, class ValueType, class Hasher, class Comparer>
+ConstIterator<ValueType> FlatHashMap<KeyType, ValueType, Hasher, Comparer>::GetConstEndIterator() const
+{
+	ConstIterator<ValueType> cIterator(*(new FlatHashMapIterator<KeyType, ValueType, Hasher, Comparer>(*this)));
+	return cIterator;
+}
+
+
+//[-------------------------------------------------------]
+//[ Public virtual Map functions                          ]
+//[-------------------------------------------------------]
+template <class KeyType, class ValueType, class Hasher, class Comparer>
+void FlatHashMap<KeyType, ValueType, Hasher, Comparer>::Clear()
+{
+	// Slots already created?
+	if (m_pSlots) {
+		// Clear all used slots, but keep the memory
+		for (uint32 i=0; i<m_nNumOfSlots; i++) {
+			if (m_pnProbeLength[i]) {
+				m_pnProbeLength[i] = 0;
+				m_pSlots[i].Key    = Map<KeyType, ValueType>::NullKey;
+				m_pSlots[i].Value  = Null;
+			}
+		}
+
+		// Update the number of elements counter
+		m_nNumOfElements = 0;
+	}
+}
+
+template <class KeyType, class ValueType, class Hasher, class Comparer>
+bool FlatHashMap<KeyType, ValueType, Hasher, Comparer>::IsEmpty() const
+{
+	return (m_nNumOfElements == 0);
+}
+
+template <class KeyType, class ValueType, class Hasher, class Comparer>
+uint32 FlatHashMap<KeyType, ValueType, Hasher, Comparer>::GetNumOfElements() const
+{
+	return m_nNumOfElements;
+}
+
+template <class KeyType, class ValueType, class Hasher, class Comparer>
+bool FlatHashMap<KeyType, ValueType, Hasher, Comparer>::Add(const KeyType &Key, const ValueType &Value)
+{
+	// Add the element to the hash map
+	Insert(Key, Value);
+
+	// Done
+	return true;
+}
+
+template <class KeyType, class ValueType, class Hasher, class Comparer>
+bool FlatHashMap<KeyType, ValueType, Hasher, Comparer>::Replace(const KeyType &Key, const ValueType &NewValue)
+{
+	// Find the element
+	const uint32 nIndex = FindSlot(Key);
+	if (nIndex < m_nNumOfSlots) {
+		// Set the new value
+		m_pSlots[nIndex].Value = NewValue;
+
+		// Done
+		return true;
+	}
+
+	// Error, there's no element with this key!
+	return false;
+}
+
+template <class KeyType, class ValueType, class Hasher, class Comparer>
+bool FlatHashMap<KeyType, ValueType, Hasher, Comparer>::Set(const KeyType &Key, const ValueType &Value)
+{
+	// Find the element
+	const uint32 nIndex = FindSlot(Key);
+	if (nIndex < m_nNumOfSlots) {
+		// Set the new value
+		m_pSlots[nIndex].Value = Value;
+
+		// Value was replaced
+		return true;
+	} else {
+		// Add the element to the hash map
+		Insert(Key, Value);
+
+		// New element was added
+		return false;
+	}
+}
+
+template <class KeyType, class ValueType, class Hasher, class Comparer>
+bool FlatHashMap<KeyType, ValueType, Hasher, Comparer>::Remove(const KeyType &Key)
+{
+	// Find the element
+	const uint32 nIndex = FindSlot(Key);
+	if (nIndex < m_nNumOfSlots) {
+		// Remove the element from the hash map
+		RemoveSlot(nIndex);
+
+		// Done
+		return true;
+	}
+
+	// Error!
+	return false;
+}
+
+template <class KeyType, class ValueType, class Hasher, class Comparer>
+uint32 FlatHashMap<KeyType, ValueType, Hasher, Comparer>::RemoveValue(const ValueType &Value)
+{
+	uint32 nRemoved = 0;
+
+	// Slots already created?
+	if (m_pSlots) {
+		// Loop through all slots
+		uint32 nIndex = 0;
+		while (nIndex < m_nNumOfSlots) {
+			// Compare values
+			if (m_pnProbeLength[nIndex] && m_pSlots[nIndex].Value == Value) {
+				// Remove the element, don't go to the next slot because the following element was shifted into this one
+				RemoveSlot(nIndex);
+
+				// Update the number of removed elements and continue
+				nRemoved++;
+			} else {
+				// Get next slot
+				nIndex++;
+			}
+		}
+	}
+
+	// Return the number of removed elements
+	return nRemoved;
+}
+
+template <class KeyType, class ValueType, class Hasher, class Comparer>
+const ValueType &FlatHashMap<KeyType, ValueType, Hasher, Comparer>::Get(const KeyType &Key) const
+{
+	// Return the object (or at least try it ;-)
+	const uint32 nIndex = FindSlot(Key);
+	return (nIndex < m_nNumOfSlots) ? m_pSlots[nIndex].Value : FlatHashMap<KeyType, ValueType, Hasher, Comparer>::Null;
+}
+
+template <class KeyType, class ValueType, class Hasher, class Comparer>
+ValueType &FlatHashMap<KeyType, ValueType, Hasher, Comparer>::Get(const KeyType &Key)
+{
+	// Return the object (or at least try it ;-)
+	const uint32 nIndex = FindSlot(Key);
+	return (nIndex < m_nNumOfSlots) ? m_pSlots[nIndex].Value : FlatHashMap<KeyType, ValueType, Hasher, Comparer>::Null;
+}
+
+template <class KeyType, class ValueType, class Hasher, class Comparer>
+Iterator<KeyType> FlatHashMap<KeyType, ValueType, Hasher, Comparer>::GetKeyIterator(uint32 nIndex) const
+{
+	Iterator<KeyType> cIterator(*(new FlatHashMapKeyIterator<KeyType, ValueType, Hasher, Comparer>(*this, nIndex)));
+	return cIterator;
+}
+
+template <class KeyType, class ValueType, class Hasher, class Comparer>
+ConstIterator<KeyType> FlatHashMap<KeyType, ValueType, Hasher, Comparer>::GetConstKeyIterator(uint32 nIndex) const
+{
+	ConstIterator<KeyType> cIterator(*(new FlatHashMapKeyIterator<KeyType, ValueType, Hasher, Comparer>(*this, nIndex)));
+	return cIterator;
+}
+
+template <class KeyType, class ValueType, class Hasher, class Comparer>
+Iterator<KeyType> FlatHashMap<KeyType, ValueType, Hasher, Comparer>::GetEndKeyIterator() const
+{
+	Iterator<KeyType> cIterator(*(new FlatHashMapKeyIterator<KeyType, ValueType, Hasher, Comparer>(*this)));
+	return cIterator;
+}
+
+template <class KeyType, class ValueType, class Hasher, class Comparer>
+ConstIterator<KeyType> FlatHashMap<KeyType, ValueType, Hasher, Comparer>::GetConstEndKeyIterator() const
+{
+	ConstIterator<KeyType> cIterator(*(new FlatHashMapKeyIterator<KeyType, ValueType, Hasher, Comparer>(*this)));
+	return cIterator;
+}
+
+
+//[-------------------------------------------------------]
+//[ Private virtual Map functions                         ]
+//[-------------------------------------------------------]
+template <class KeyType, class ValueType, class Hasher, class Comparer>
+Map<KeyType, ValueType> &FlatHashMap<KeyType, ValueType, Hasher, Comparer>::operator =(const Map<KeyType, ValueType> &cMap)
+{
+	// Not implemented
+
+	// Return this instance
+	return *this;
+}
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+} // PLCore
@@ -0,0 +1,157 @@
+/*********************************************************\
+ *  File: FlatHashMapIterator.inl                        *
+ *      Open addressing hash map iterator template implementation
+ *
+ *  Copyright (C) 2002-2013 The PixelLight Team (http://www.pixellight.org/)
+ *
+ *  This file is part of PixelLight.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ *  and associated documentation files (the "Software"), to deal in the Software without
+ *  restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ *  Software is furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all copies or
+ *  substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ *  BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ *  DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ *  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include "PLCore/Container/FlatHashMap.h"
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace PLCore {
+
+
+//[-------------------------------------------------------]
+//[ Private functions                                     ]
+//[-------------------------------------------------------]
+/**
+*  @brief
+*    Constructor
+*/
+template <class KeyType, class ValueType, class Hasher, class Comparer>
+FlatHashMapIterator<KeyType, ValueType, Hasher, Comparer>::FlatHashMapIterator(const FlatHashMap<KeyType, ValueType, Hasher, Comparer> &mapOwner, uint32 nIndex) :
+	m_pmapOwner(&mapOwner),
+	m_nNextSlot(mapOwner.GetNumOfSlots()),
+	m_nPreviousSlot(mapOwner.GetNumOfSlots())
+{
+	// Is there at least one element within the hash map?
+	if (m_pmapOwner->GetNumOfElements()) {
+		// Find start slot
+		if (nIndex <= m_pmapOwner->GetNumOfElements()/2) {
+			// Start at the first used slot and walk forward
+			m_nNextSlot = m_pmapOwner->GetNextUsedSlot(0);
+			for (uint32 nCurrentIndex=0; nCurrentIndex<nIndex && HasNext(); nCurrentIndex++)
+				Next();
+		} else {
+			// Start at the last used slot and walk backward
+			m_nPreviousSlot = m_pmapOwner->GetPreviousUsedSlot(m_pmapOwner->GetNumOfSlots());
+			for (uint32 nCurrentIndex=m_pmapOwner->GetNumOfElements(); nCurrentIndex>nIndex && HasPrevious(); nCurrentIndex--)
+				Previous();
+		}
+	}
+}
+
+/**
+*  @brief
+*    Constructor
+*/
+template <class KeyType, class ValueType, class Hasher, class Comparer>
+FlatHashMapIterator<KeyType, ValueType, Hasher, Comparer>::FlatHashMapIterator(const FlatHashMap<KeyType, ValueType, Hasher, Comparer> &mapOwner) :
+	m_pmapOwner(&mapOwner),
+	m_nNextSlot(mapOwner.GetNumOfSlots()),
+	m_nPreviousSlot(mapOwner.GetPreviousUsedSlot(mapOwner.GetNumOfSlots()))
+{
+}
+
+/**
+*  @brief
+*    Copy constructor
+*/
+template <class KeyType, class ValueType, class Hasher, class Comparer>
+FlatHashMapIterator<KeyType, ValueType, Hasher, Comparer>::FlatHashMapIterator(const FlatHashMapIterator<KeyType, ValueType, Hasher, Comparer> &cSource) :
+	m_pmapOwner(cSource.m_pmapOwner),
+	m_nNextSlot(cSource.m_nNextSlot),
+	m_nPreviousSlot(cSource.m_nPreviousSlot)
+{
+}
+
+/**
+*  @brief
+*    Destructor
+*/
+template <class KeyType, class ValueType, class Hasher, class Comparer>
+FlatHashMapIterator<KeyType, ValueType, Hasher, Comparer>::~FlatHashMapIterator()
+{
+}
+
+
+//[-------------------------------------------------------]
+//[ Private virtual IteratorImpl functions                ]
+//[-------------------------------------------------------]
+template <class KeyType, class ValueType, class Hasher, class Comparer>
+IteratorImpl<ValueType> *FlatHashMapIterator<KeyType, ValueType, Hasher, Comparer>::Clone() const
+{
+	return new FlatHashMapIterator<KeyType, ValueType, Hasher, Comparer>(*this);
+}
+
+template <class KeyType, class ValueType, class Hasher, class Comparer>
+bool FlatHashMapIterator<KeyType, ValueType, Hasher, Comparer>::HasNext() const
+{
+	return (m_nNextSlot < m_pmapOwner->GetNumOfSlots());
+}
+
+template <class KeyType, class ValueType, class Hasher, class Comparer>
+ValueType &FlatHashMapIterator<KeyType, ValueType, Hasher, Comparer>::Next()
+{
+	// Is there's a next slot?
+	if (m_nNextSlot >= m_pmapOwner->GetNumOfSlots())
+		return FlatHashMap<KeyType, ValueType, Hasher, Comparer>::Null; // Error!
+
+	// Get the next slot
+	m_nPreviousSlot = m_nNextSlot;
+	m_nNextSlot     = m_pmapOwner->GetNextUsedSlot(m_nNextSlot + 1);
+
+	// Return the value of the 'current' slot
+	return m_pmapOwner->m_pSlots[m_nPreviousSlot].Value;
+}
+
+template <class KeyType, class ValueType, class Hasher, class Comparer>
+bool FlatHashMapIterator<KeyType, ValueType, Hasher, Comparer>::HasPrevious() const
+{
+	return (m_nPreviousSlot < m_pmapOwner->GetNumOfSlots());
+}
+
+template <class KeyType, class ValueType, class Hasher, class Comparer>
+ValueType &FlatHashMapIterator<KeyType, ValueType, Hasher, Comparer>::Previous()
+{
+	// Is there's a previous slot?
+	if (m_nPreviousSlot >= m_pmapOwner->GetNumOfSlots())
+		return FlatHashMap<KeyType, ValueType, Hasher, Comparer>::Null; // Error!
+
+	// Get the previous slot
+	m_nNextSlot     = m_nPreviousSlot;
+	m_nPreviousSlot = m_pmapOwner->GetPreviousUsedSlot(m_nPreviousSlot);
+
+	// Return the value of the 'current' slot
+	return m_pmapOwner->m_pSlots[m_nNextSlot].Value;
+}
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+} // PLCore
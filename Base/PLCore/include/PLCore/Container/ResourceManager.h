@@ -33,6 +33,8 @@
 #include "PLCore/String/String.h"
 #include "PLCore/Container/Array.h"
 #include "PLCore/Container/HashMap.h"
+#include "PLCore/Container/FlatHashMap.h"
+#include "PLCore/Tools/LoadRequest.h"
 #include "PLCore/Base/Event/Event.h"
 
 
@@ -71,6 +73,34 @@ template <class AType> class ResourceManager {
 		PLCore::Event<AType&> EventResourceRemoved;	/**< Resource removed event, removed resource as parameter */
 
 
+	//[-------------------------------------------------------]
+	//[ Protected definitions                                 ]
+	//[-------------------------------------------------------]
+	protected:
+		/**
+		*  @brief
+		*    Asynchronous load request of a resource
+		*
+		*  @remarks
+		*    This request loads the resource by using the read file data within "OnFinalize()". Derived managers can
+		*    return derived requests within "CreateLoadRequest()" which decode the read file data into an intermediate
+		*    representation within "OnDecode()" and only create the resource by using it within "OnFinalize()".
+		*
+		*  @note
+		*    - "OnDecode()" of derived requests must not access "m_pManager" or "m_pResource", they're reset by the owning thread when the request is canceled
+		*/
+		class ResourceLoadRequest : public LoadRequest {
+			public:
+				ResourceLoadRequest(ResourceManager<AType> &cManager, AType &cResource, const String &sFilename, float fPriority);
+				virtual ~ResourceLoadRequest();
+			protected:
+				virtual bool OnFinalize() override;
+			public:
+				ResourceManager<AType> *m_pManager;		/**< Owner resource manager, a null pointer if the request is canceled */
+				AType				   *m_pResource;	/**< Resource to load, a null pointer if the request is canceled */
+		};
+
+
 	//[-------------------------------------------------------]
 	//[ Public functions                                      ]
 	//[-------------------------------------------------------]
@@ -211,6 +241,91 @@ template <class AType> class ResourceManager {
 		*/
 		uint32 GetNumOfElements() const;
 
+		/**
+		*  @brief
+		*    Loads a resource asynchronously
+		*
+		*  @param[in] sFilename
+		*    Filename of the resource to load
+		*  @param[in] fPriority
+		*    Load priority, resources with a higher priority are loaded first (e.g. the negative distance to the camera)
+		*
+		*  @return
+		*    Pointer to the resource which is loaded asynchronously, a null pointer on error
+		*
+		*  @remarks
+		*    The resource is created at once and returned while it's still empty, the file is read and the resource is
+		*    loaded by using "LoadableManager::LoadAsync()". As long as the resource is loading, "GetUsableResource()"
+		*    returns the standard resource as placeholder. If there's already a resource with this (file)name, this
+		*    resource is returned instead creating a new one, if it's still loading its priority is raised if required.
+		*
+		*  @note
+		*    - The resource is created by the thread calling "LoadableManager::UpdateAsync()", the file data may be
+		*      decoded by a worker thread before (see "CreateLoadRequest()")
+		*    - If loading fails, the resource stays empty and an error is written into the log
+		*/
+		AType *LoadResourceAsync(const String &sFilename, float fPriority = 0.0f);
+
+		/**
+		*  @brief
+		*    Returns whether or not a resource is loading asynchronously
+		*
+		*  @param[in] cResource
+		*    Resource to check
+		*
+		*  @return
+		*    'true' if the resource is loading asynchronously, else 'false'
+		*/
+		bool IsResourceLoading(const AType &cResource) const;
+
+		/**
+		*  @brief
+		*    Sets the priority of a resource which is loading asynchronously
+		*
+		*  @param[in] cResource
+		*    Resource which is loading asynchronously
+		*  @param[in] fPriority
+		*    New load priority, resources with a higher priority are loaded first
+		*
+		*  @return
+		*    'true' if all went fine, else 'false' (maybe the resource isn't loading asynchronously)
+		*/
+		bool SetLoadPriority(const AType &cResource, float fPriority);
+
+		/**
+		*  @brief
+		*    Returns the resource to use instead of the given one
+		*
+		*  @param[in] cResource
+		*    Resource which should be used
+		*
+		*  @return
+		*    The standard resource if the given resource is loading asynchronously and there's a standard resource, else the given resource
+		*/
+		AType &GetUsableResource(AType &cResource) const;
+
+		/**
+		*  @brief
+		*    Returns whether or not resources are loaded asynchronously by default
+		*
+		*  @return
+		*    'true' if resources are loaded asynchronously by default, else 'false'
+		*
+		*  @remarks
+		*    It's up to the derived managers and the resource users to respect this setting, e.g. by
+		*    using "LoadResourceAsync()" instead of "LoadResource()".
+		*/
+		bool GetAsyncLoading() const;
+
+		/**
+		*  @brief
+		*    Sets whether or not resources are loaded asynchronously by default
+		*
+		*  @param[in] bAsyncLoading
+		*    Load resources asynchronously by default?
+		*/
+		void SetAsyncLoading(bool bAsyncLoading = false);
+
 
 	//[-------------------------------------------------------]
 	//[ Public virtual ResourceManager functions              ]
@@ -388,6 +503,27 @@ template <class AType> class ResourceManager {
 		*/
 		virtual AType *CreateResource(const String &sName = "") = 0;
 
+		/**
+		*  @brief
+		*    Creates an asynchronous load request of a resource
+		*
+		*  @param[in] cResource
+		*    Resource to load
+		*  @param[in] sFilename
+		*    Filename of the resource to load
+		*  @param[in] fPriority
+		*    Load priority
+		*
+		*  @return
+		*    The created load request, a null pointer if there was an error
+		*
+		*  @note
+		*    - This function is used inside the function LoadResourceAsync(). The default implementation creates a
+		*      "ResourceLoadRequest" which loads the resource on the owning thread by using "Loadable::LoadByFile()",
+		*      overwrite this function to decode the file data by a worker thread.
+		*/
+		virtual ResourceLoadRequest *CreateLoadRequest(AType &cResource, const String &sFilename, float fPriority);
+
 
 	//[-------------------------------------------------------]
 	//[ Protected data                                        ]
@@ -396,6 +532,7 @@ template <class AType> class ResourceManager {
 		String					 m_sManagerName;		/**< Manager name */
 		AType					*m_pStandardResource;	/**< Standard resource, can be a null pointer */
 		bool					 m_bUnloadUnused;		/**< Unload unused resources? */
+		bool					 m_bAsyncLoading;		/**< Load resources asynchronously by default? */
 		Array<AType*>			 m_lstResources;		/**< Resource list */
 		HashMap<String, AType*>	 m_mapResources;		/**< Resource map */
 
@@ -433,6 +570,43 @@ template <class AType> class ResourceManager {
 		*/
 		bool Remove(AType &cResource);
 
+		/**
+		*  @brief
+		*    Returns the asynchronous load request of a resource
+		*
+		*  @param[in] cResource
+		*    Resource to return the load request from
+		*
+		*  @return
+		*    The asynchronous load request of the resource, a null pointer if the resource isn't loading asynchronously
+		*/
+		ResourceLoadRequest *GetLoadRequest(const AType &cResource) const;
+
+		/**
+		*  @brief
+		*    Cancels the asynchronous loading of a resource
+		*
+		*  @param[in] cResource
+		*    Resource to stop loading, if it isn't loading asynchronously nothing happens
+		*/
+		void CancelLoadRequest(const AType &cResource);
+
+		/**
+		*  @brief
+		*    Cancels all asynchronous load requests of this manager
+		*
+		*  @note
+		*    - The requests are detached from this manager, they're destroyed by the loadable manager later on
+		*/
+		void CancelLoadRequests();
+
+
+	//[-------------------------------------------------------]
+	//[ Private data                                          ]
+	//[-------------------------------------------------------]
+	private:
+		FlatHashMap<uint_ptr, ResourceLoadRequest*> m_mapLoadRequests;	/**< Asynchronous load requests of the resources which are loading, the key is the address of the resource */
+
 
 };
 
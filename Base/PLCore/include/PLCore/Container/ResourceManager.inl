@@ -27,6 +27,7 @@
 //[ Includes                                              ]
 //[-------------------------------------------------------]
 #include "PLCore/Container/Resource.h"
+#include "PLCore/Tools/LoadableManager.h"
 
 
 //[-------------------------------------------------------]
@@ -111,6 +112,7 @@ bool ResourceManager<AType>::Unload(AType &cResource)
 			EventResourceRemoved(cResource);
 
 			// Remove the resource
+			CancelLoadRequest(cResource);
 			if (m_pStandardResource == &cResource)
 				m_pStandardResource = nullptr;
 			m_mapResources.Remove(cResource.GetName());
@@ -225,6 +227,97 @@ uint32 ResourceManager<AType>::GetNumOfElements() const
 	return m_lstResources.GetNumOfElements();
 }
 
+/**
+*  @brief
+*    Loads a resource asynchronously
+*/
+template <class AType>
+AType *ResourceManager<AType>::LoadResourceAsync(const String &sFilename, float fPriority)
+{
+	// Is there already a resource with this name?
+	AType *pResource = GetByName(sFilename);
+	if (pResource) {
+		// Raise the priority if the resource is still loading
+		ResourceLoadRequest *pRequest = GetLoadRequest(*pResource);
+		if (pRequest && pRequest->GetPriority() < fPriority)
+			LoadableManager::GetInstance()->SetAsyncPriority(*pRequest, fPriority);
+		return pResource;
+	}
+
+	// Create a new resource
+	pResource = Create(sFilename);
+	if (pResource) {
+		// Let the loadable manager load the resource, on error the request is already destroyed
+		ResourceLoadRequest *pRequest = CreateLoadRequest(*pResource, sFilename, fPriority);
+		if (pRequest && LoadableManager::GetInstance()->LoadAsync(pRequest))
+			return pResource; // Return the new resource
+		else
+			delete pResource;
+	}
+
+	// Error!
+	return nullptr;
+}
+
+/**
+*  @brief
+*    Returns whether or not a resource is loading asynchronously
+*/
+template <class AType>
+bool ResourceManager<AType>::IsResourceLoading(const AType &cResource) const
+{
+	return (GetLoadRequest(cResource) != nullptr);
+}
+
+/**
+*  @brief
+*    Sets the priority of a resource which is loading asynchronously
+*/
+template <class AType>
+bool ResourceManager<AType>::SetLoadPriority(const AType &cResource, float fPriority)
+{
+	ResourceLoadRequest *pRequest = GetLoadRequest(cResource);
+	if (pRequest) {
+		LoadableManager::GetInstance()->SetAsyncPriority(*pRequest, fPriority);
+
+		// Done
+		return true;
+	}
+
+	// Error!
+	return false;
+}
+
+/**
+*  @brief
+*    Returns the resource to use instead of the given one
+*/
+template <class AType>
+AType &ResourceManager<AType>::GetUsableResource(AType &cResource) const
+{
+	return (m_pStandardResource && IsResourceLoading(cResource)) ? *m_pStandardResource : cResource;
+}
+
+/**
+*  @brief
+*    Returns whether or not resources are loaded asynchronously by default
+*/
+template <class AType>
+bool ResourceManager<AType>::GetAsyncLoading() const
+{
+	return m_bAsyncLoading;
+}
+
+/**
+*  @brief
+*    Sets whether or not resources are loaded asynchronously by default
+*/
+template <class AType>
+void ResourceManager<AType>::SetAsyncLoading(bool bAsyncLoading)
+{
+	m_bAsyncLoading = bAsyncLoading;
+}
+
 
 //[-------------------------------------------------------]
 //[ Public virtual ResourceManager functions              ]
@@ -390,7 +483,8 @@ AType *ResourceManager<AType>::GetByName(const String &sName) const
 template <class AType>
 ResourceManager<AType>::ResourceManager() :
 	m_pStandardResource(nullptr),
-	m_bUnloadUnused(false)
+	m_bUnloadUnused(false),
+	m_bAsyncLoading(false)
 {
 }
 
@@ -403,6 +497,9 @@ ResourceManager<AType>::~ResourceManager()
 {
 	// Clear manager
 	Clear();
+
+	// The requests of resources which were not deleted by "Clear()" must not know this manager any longer
+	CancelLoadRequests();
 }
 
 /**
@@ -446,6 +543,20 @@ bool ResourceManager<AType>::SetResourceName(AType &cResource, const String &sNa
 }
 
 
+//[-------------------------------------------------------]
+//[ Protected virtual ResourceManager functions           ]
+//[-------------------------------------------------------]
+/**
+*  @brief
+*    Creates an asynchronous load request of a resource
+*/
+template <class AType>
+typename ResourceManager<AType>::ResourceLoadRequest *ResourceManager<AType>::CreateLoadRequest(AType &cResource, const String &sFilename, float fPriority)
+{
+	return new ResourceLoadRequest(*this, cResource, sFilename, fPriority);
+}
+
+
 //[-------------------------------------------------------]
 //[ Private functions                                     ]
 //[-------------------------------------------------------]
@@ -504,6 +615,7 @@ bool ResourceManager<AType>::Remove(AType &cResource)
 		EventResourceRemoved(cResource);
 
 		// Remove the resource
+		CancelLoadRequest(cResource);
 		if (m_pStandardResource == &cResource)
 			m_pStandardResource = nullptr;
 		m_mapResources.Remove(cResource.GetName());
@@ -518,6 +630,82 @@ bool ResourceManager<AType>::Remove(AType &cResource)
 	return false;
 }
 
+/**
+*  @brief
+*    Returns the asynchronous load request of a resource
+*/
+template <class AType>
+typename ResourceManager<AType>::ResourceLoadRequest *ResourceManager<AType>::GetLoadRequest(const AType &cResource) const
+{
+	// This is called e.g. each time a texture is bound, so don't even calculate a hash if nothing is loading
+	return m_mapLoadRequests.GetNumOfElements() ? m_mapLoadRequests.Get(reinterpret_cast<uint_ptr>(&cResource)) : nullptr;
+}
+
+/**
+*  @brief
+*    Cancels the asynchronous loading of a resource
+*/
+template <class AType>
+void ResourceManager<AType>::CancelLoadRequest(const AType &cResource)
+{
+	ResourceLoadRequest *pRequest = GetLoadRequest(cResource);
+	if (pRequest) {
+		// The request is destroyed by the loadable manager later on, so detach it from this manager and the resource
+		LoadableManager::GetInstance()->CancelAsync(*pRequest);
+		m_mapLoadRequests.Remove(reinterpret_cast<uint_ptr>(&cResource));
+		pRequest->m_pManager  = nullptr;
+		pRequest->m_pResource = nullptr;
+	}
+}
+
+/**
+*  @brief
+*    Cancels all asynchronous load requests of this manager
+*/
+template <class AType>
+void ResourceManager<AType>::CancelLoadRequests()
+{
+	// The loadable manager may already be destroyed, in this case it has already destroyed all requests
+	if (m_mapLoadRequests.GetNumOfElements() && LoadableManager::HasInstance()) {
+		LoadableManager *pLoadableManager = LoadableManager::GetInstance();
+		Iterator<ResourceLoadRequest*> cIterator = m_mapLoadRequests.GetIterator();
+		while (cIterator.HasNext()) {
+			ResourceLoadRequest *pRequest = cIterator.Next();
+			pLoadableManager->CancelAsync(*pRequest);
+			pRequest->m_pManager  = nullptr;
+			pRequest->m_pResource = nullptr;
+		}
+	}
+	m_mapLoadRequests.Clear();
+}
+
+
+//[-------------------------------------------------------]
+//[ ResourceManager::ResourceLoadRequest                  ]
+//[-------------------------------------------------------]
+template <class AType>
+ResourceManager<AType>::ResourceLoadRequest::ResourceLoadRequest(ResourceManager<AType> &cManager, AType &cResource, const String &sFilename, float fPriority) : LoadRequest(sFilename, fPriority),
+	m_pManager(&cManager),
+	m_pResource(&cResource)
+{
+	m_pManager->m_mapLoadRequests.Add(reinterpret_cast<uint_ptr>(m_pResource), this);
+}
+
+template <class AType>
+ResourceManager<AType>::ResourceLoadRequest::~ResourceLoadRequest()
+{
+	// The resource is no longer loading
+	if (m_pManager)
+		m_pManager->m_mapLoadRequests.Remove(reinterpret_cast<uint_ptr>(m_pResource));
+}
+
+template <class AType>
+bool ResourceManager<AType>::ResourceLoadRequest::OnFinalize()
+{
+	// Load the resource by using the read file data
+	return (m_pResource && m_pResource->LoadByFile(GetFile()));
+}
+
 
 //[-------------------------------------------------------]
 //[ Namespace                                             ]
@@ -63,7 +63,9 @@ class File : public FileObject {
 			FileAppend	=  4,	/**< File will be appended */
 			FileCreate	=  8,	/**< File will be created */
 			FileText	= 16,	/**< File will be opened in text mode (whenever possible, don't set this flag because not each platform may support it) */
-			FileMemBuf	= 32	/**< File will be opened memory buffered (only usable for reading!) */
+			FileMemBuf	= 32,	/**< File will be opened memory buffered (only usable for reading!) */
+			FileMemMap	= 64,	/**< File will be memory mapped if supported by the file implementation, else it's opened memory buffered (only usable for reading!) */
+			FileMemMapOnly	= 128	/**< File will be memory mapped, opening fails if this is not supported by the file implementation (only usable for reading!) */
 		};
 
 		/**
@@ -236,7 +238,7 @@ class File : public FileObject {
 
 		/**
 		*  @brief
-		*    Returns whether the file is memory buffered (opened with flag 'FileMemBuf')
+		*    Returns whether the file is memory buffered (opened with flag 'FileMemBuf', 'FileMemMap' or 'FileMemMapOnly')
 		*
 		*  @return
 		*    'true', if the file is memory buffered, else 'false'
@@ -246,6 +248,18 @@ class File : public FileObject {
 		*/
 		inline bool IsMemoryBuffered() const;
 
+		/**
+		*  @brief
+		*    Returns whether the file is memory mapped (opened with flag 'FileMemMap' and the mapping was successful, or with flag 'FileMemMapOnly')
+		*
+		*  @return
+		*    'true', if the file is memory mapped, else 'false' (if the file was opened with flag 'FileMemMap' it was read into a memory buffer instead)
+		*
+		*  @see
+		*    - GetMemoryBuffer()
+		*/
+		inline bool IsMemoryMapped() const;
+
 		/**
 		*  @brief
 		*    Returns whether the file is open
@@ -440,6 +454,10 @@ class File : public FileObject {
 		*  @return
 		*    Pointer to the buffer for memory buffered file, a null pointer if there's no such buffer
 		*
+		*  @note
+		*    - If the file was opened with the flag 'FileMemMap', the buffer may be a read-only memory mapping
+		*      of the file which stays valid until the file is closed (don't assign a new URL before closing the file)
+		*
 		*  @see
 		*    - IsMemoryBuffered()
 		*/
@@ -558,7 +576,8 @@ class File : public FileObject {
 		*    File internal access flags
 		*/
 		enum EInternalAccess {
-			FileMemBufShared = 64	/**< Opened memory buffered is shared and is NOT allowed to be destroyed by this file object! */
+			FileMemBufShared = 256,	/**< Opened memory buffered is shared and is NOT allowed to be destroyed by this file object! */
+			FileMemBufMapped = 512	/**< Opened memory buffered is a memory mapping of the file implementation and must be unmapped by it */
 		};
 
 
@@ -159,6 +159,15 @@ inline bool File::IsMemoryBuffered() const
 	return (m_pMemBuf != nullptr);
 }
 
+/**
+*  @brief
+*    Returns whether the file is memory mapped (opened with flag FileMemMap and the mapping was successful)
+*/
+inline bool File::IsMemoryMapped() const
+{
+	return (m_pMemBuf && (m_nMemBufAccess & FileMemBufMapped));
+}
+
 /**
 *  @brief
 *    Returns whether the file is open
@@ -387,6 +387,59 @@ class FileImpl {
 		*/
 		virtual FileSearchImpl *CreateSearch() = 0;
 
+		/**
+		*  @brief
+		*    Check if the object is a link (e.g. a symbolic link) to another file or directory
+		*
+		*  @return
+		*    'true', if the object is a link
+		*
+		*  @note
+		*    - "IsFile()" and "IsDirectory()" are following links, this function is not
+		*    - The default implementation returns 'false', this is correct for file systems without links
+		*/
+		PLCORE_API virtual bool IsLink() const;
+
+		/**
+		*  @brief
+		*    Maps the opened file read-only into memory
+		*
+		*  @param[out] nSize
+		*    Receives the size of the mapping in bytes, not touched on error
+		*
+		*  @return
+		*    Pointer to the memory mapping of the whole file, a null pointer on error or if memory mapping is not supported
+		*
+		*  @note
+		*    - The memory mapping stays valid after the file is closed, use "UnmapMemory()" to release it
+		*    - The memory is read-only, never write into it
+		*    - The default implementation doesn't support memory mapping
+		*/
+		PLCORE_API virtual uint8 *MapMemory(uint32 &nSize);
+
+		/**
+		*  @brief
+		*    Releases a memory mapping created by "MapMemory()"
+		*
+		*  @param[in] pData
+		*    Pointer to the memory mapping, must be valid
+		*  @param[in] nSize
+		*    Size of the mapping in bytes
+		*/
+		PLCORE_API virtual void UnmapMemory(uint8 *pData, uint32 nSize);
+
+		/**
+		*  @brief
+		*    Returns the time of the last modification
+		*
+		*  @return
+		*    Time of the last modification in milliseconds since midnight, January 1, 1970 (UTC), 0 on error or if not supported
+		*
+		*  @note
+		*    - The default implementation doesn't support modification times
+		*/
+		PLCORE_API virtual uint64 GetModificationTime() const;
+
 
 	//[-------------------------------------------------------]
 	//[ Protected data                                        ]
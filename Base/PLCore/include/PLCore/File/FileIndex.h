@@ -0,0 +1,321 @@
+/*********************************************************\
+ *  File: FileIndex.h                                    *
+ *
+ *  Copyright (C) 2002-2013 The PixelLight Team (http://www.pixellight.org/)
+ *
+ *  This file is part of PixelLight.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ *  and associated documentation files (the "Software"), to deal in the Software without
+ *  restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ *  Software is furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all copies or
+ *  substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ *  BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ *  DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ *  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+#ifndef __PLCORE_FILEINDEX_H__
+#define __PLCORE_FILEINDEX_H__
+#pragma once
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include "PLCore/String/String.h"
+#include "PLCore/Container/FlatHashMap.h"
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace PLCore {
+
+
+//[-------------------------------------------------------]
+//[ Classes                                               ]
+//[-------------------------------------------------------]
+/**
+*  @brief
+*    File index
+*
+*  @remarks
+*    A file index maps relative filenames to the directories (regular directories or directories within ZIP-files)
+*    the files are in. The directories are scanned once when they're added to the index, after this, finding out
+*    which directory a file is in costs a single hash map lookup instead of checking each directory through the
+*    file system. If the same relative filename is within multiple directories, the directory which was added first
+*    wins, so directories should be added in order of their priority.
+*
+*  @note
+*    - The index is a snapshot, files created or deleted after a directory was added are not automatically taken into account
+*    - Filenames are normalized (see Normalize()), on Windows they're not case sensitive
+*/
+class FileIndex {
+
+
+	//[-------------------------------------------------------]
+	//[ Public definitions                                    ]
+	//[-------------------------------------------------------]
+	public:
+		/**
+		*  @brief
+		*    File index entry
+		*/
+		class Entry {
+
+
+			//[-------------------------------------------------------]
+			//[ Public functions                                      ]
+			//[-------------------------------------------------------]
+			public:
+				/**
+				*  @brief
+				*    Default constructor
+				*/
+				inline Entry();
+
+				/**
+				*  @brief
+				*    Constructor
+				*
+				*  @param[in] nDirectory
+				*    Number of the directory the file is in
+				*/
+				inline explicit Entry(uint32 nDirectory);
+
+				/**
+				*  @brief
+				*    Compare operator
+				*
+				*  @param[in] cEntry
+				*    Entry to compare with
+				*
+				*  @return
+				*    'true' if both entries are equal, else 'false'
+				*/
+				inline bool operator ==(const Entry &cEntry) const;
+
+
+			//[-------------------------------------------------------]
+			//[ Public data                                           ]
+			//[-------------------------------------------------------]
+			public:
+				uint32 m_nDirectory;		/**< Number of the directory the file is in (given to AddDirectory()) */
+				bool   m_bZipEntry;			/**< Is the file an entry within a ZIP-file? */
+				uint32 m_nZipEntryIndex;	/**< Index of the entry within the ZIP-file (see ZipHandle::GetCurrentFileIndex()), only valid if 'm_bZipEntry' is 'true' */
+				uint32 m_nZipEntryPosition;	/**< Position of the entry within the central directory of the ZIP-file (see ZipHandle::GetCurrentFilePosition()), only valid if 'm_bZipEntry' is 'true' */
+				uint32 m_nSize;				/**< Uncompressed size of the file in bytes, only valid if 'm_bZipEntry' is 'true' */
+
+
+		};
+
+
+	//[-------------------------------------------------------]
+	//[ Public static functions                               ]
+	//[-------------------------------------------------------]
+	public:
+		/**
+		*  @brief
+		*    Returns the normalized version of a relative filename
+		*
+		*  @param[in] sFilename
+		*    Relative filename to normalize
+		*
+		*  @return
+		*    The normalized filename ('\' replaced by '/', '.' and '..' resolved, leading '/' removed, lower case on Windows)
+		*/
+		static PLCORE_API String Normalize(const String &sFilename);
+
+
+	//[-------------------------------------------------------]
+	//[ Public functions                                      ]
+	//[-------------------------------------------------------]
+	public:
+		/**
+		*  @brief
+		*    Constructor
+		*/
+		PLCORE_API FileIndex();
+
+		/**
+		*  @brief
+		*    Destructor
+		*/
+		PLCORE_API ~FileIndex();
+
+		/**
+		*  @brief
+		*    Removes all entries
+		*/
+		PLCORE_API void Clear();
+
+		/**
+		*  @brief
+		*    Returns the number of entries
+		*
+		*  @return
+		*    The number of entries
+		*/
+		inline uint32 GetNumOfEntries() const;
+
+		/**
+		*  @brief
+		*    Adds all files within a directory and its subdirectories
+		*
+		*  @param[in] sDirectory
+		*    URL of the directory to add, a directory within a ZIP-file is given like "Data.zip/" or "Data.zip/Textures/"
+		*  @param[in] nDirectory
+		*    Number of the directory, stored within the entries of the added files
+		*
+		*  @return
+		*    'true' if all went fine, else 'false' (directory not found?)
+		*
+		*  @note
+		*    - Files which are already within the index are not changed
+		*    - ZIP-files within the directory are not opened, they're added as regular files
+		*    - Links to directories (e.g. symbolic links) are not followed, they may form loops
+		*/
+		PLCORE_API bool AddDirectory(const String &sDirectory, uint32 nDirectory);
+
+		/**
+		*  @brief
+		*    Adds a single file
+		*
+		*  @param[in] sFilename
+		*    Relative filename
+		*  @param[in] nDirectory
+		*    Number of the directory the file is in
+		*
+		*  @return
+		*    'true' if all went fine, else 'false' (maybe the file is already within the index?)
+		*
+		*  @remarks
+		*    Use this to keep the index up-to-date when a file was created after the directory was added.
+		*/
+		PLCORE_API bool AddFile(const String &sFilename, uint32 nDirectory);
+
+		/**
+		*  @brief
+		*    Returns the entry of a file
+		*
+		*  @param[in] sFilename
+		*    Relative filename
+		*
+		*  @return
+		*    The entry of the file, a null pointer if the file is not within the index
+		*/
+		PLCORE_API const Entry *Get(const String &sFilename) const;
+
+		/**
+		*  @brief
+		*    Removes a single file
+		*
+		*  @param[in] sFilename
+		*    Relative filename
+		*
+		*  @return
+		*    'true' if all went fine, else 'false' (maybe the file is not within the index?)
+		*/
+		PLCORE_API bool RemoveFile(const String &sFilename);
+
+
+	//[-------------------------------------------------------]
+	//[ Private functions                                     ]
+	//[-------------------------------------------------------]
+	private:
+		/**
+		*  @brief
+		*    Copy constructor
+		*
+		*  @param[in] cSource
+		*    Source to copy from
+		*/
+		FileIndex(const FileIndex &cSource);
+
+		/**
+		*  @brief
+		*    Copy operator
+		*
+		*  @param[in] cSource
+		*    Source to copy from
+		*
+		*  @return
+		*    Reference to this instance
+		*/
+		FileIndex &operator =(const FileIndex &cSource);
+
+		/**
+		*  @brief
+		*    Adds an entry
+		*
+		*  @param[in] sNormalized
+		*    Normalized relative filename
+		*  @param[in] cEntry
+		*    Entry to add
+		*
+		*  @return
+		*    'true' if all went fine, else 'false' (empty filename or the file is already within the index)
+		*/
+		bool AddEntry(const String &sNormalized, const Entry &cEntry);
+
+		/**
+		*  @brief
+		*    Adds all files within a regular directory and its subdirectories
+		*
+		*  @param[in] sDirectory
+		*    URL of the directory to add, must end with '/'
+		*  @param[in] sRelativePath
+		*    Path of the directory relative to the added directory, empty or ending with '/'
+		*  @param[in] nDirectory
+		*    Number of the added directory
+		*/
+		void AddFileSystemDirectory(const String &sDirectory, const String &sRelativePath, uint32 nDirectory);
+
+		/**
+		*  @brief
+		*    Adds all files within a directory of a ZIP-file
+		*
+		*  @param[in] sZipFile
+		*    URL of the ZIP-file
+		*  @param[in] sPathInZip
+		*    Path of the directory within the ZIP-file, empty or ending with '/'
+		*  @param[in] nDirectory
+		*    Number of the added directory
+		*
+		*  @return
+		*    'true' if all went fine, else 'false'
+		*/
+		bool AddZipDirectory(const String &sZipFile, const String &sPathInZip, uint32 nDirectory);
+
+
+	//[-------------------------------------------------------]
+	//[ Private data                                          ]
+	//[-------------------------------------------------------]
+	private:
+		FlatHashMap<String, Entry> m_mapEntries;	/**< Entries, key = normalized relative filename */
+
+
+};
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+} // PLCore
+
+
+//[-------------------------------------------------------]
+//[ Implementation                                        ]
+//[-------------------------------------------------------]
+#include "PLCore/File/FileIndex.inl"
+
+
+#endif // __PLCORE_FILEINDEX_H__
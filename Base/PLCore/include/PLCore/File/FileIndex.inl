@@ -0,0 +1,82 @@
+/*********************************************************\
+ *  File: FileIndex.inl                                  *
+ *
+ *  Copyright (C) 2002-2013 The PixelLight Team (http://www.pixellight.org/)
+ *
+ *  This file is part of PixelLight.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ *  and associated documentation files (the "Software"), to deal in the Software without
+ *  restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ *  Software is furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all copies or
+ *  substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ *  BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ *  DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ *  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace PLCore {
+
+
+//[-------------------------------------------------------]
+//[ Public functions                                      ]
+//[-------------------------------------------------------]
+/**
+*  @brief
+*    Default constructor
+*/
+inline FileIndex::Entry::Entry() :
+	m_nDirectory(0),
+	m_bZipEntry(false),
+	m_nZipEntryIndex(0),
+	m_nZipEntryPosition(0),
+	m_nSize(0)
+{
+}
+
+/**
+*  @brief
+*    Constructor
+*/
+inline FileIndex::Entry::Entry(uint32 nDirectory) :
+	m_nDirectory(nDirectory),
+	m_bZipEntry(false),
+	m_nZipEntryIndex(0),
+	m_nZipEntryPosition(0),
+	m_nSize(0)
+{
+}
+
+/**
+*  @brief
+*    Compare operator
+*/
+inline bool FileIndex::Entry::operator ==(const Entry &cEntry) const
+{
+	return (m_nDirectory == cEntry.m_nDirectory && m_bZipEntry == cEntry.m_bZipEntry && m_nZipEntryIndex == cEntry.m_nZipEntryIndex && m_nZipEntryPosition == cEntry.m_nZipEntryPosition && m_nSize == cEntry.m_nSize);
+}
+
+/**
+*  @brief
+*    Returns the number of entries
+*/
+inline uint32 FileIndex::GetNumOfEntries() const
+{
+	return m_mapEntries.GetNumOfElements();
+}
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+} // PLCore
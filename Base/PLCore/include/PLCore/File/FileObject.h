@@ -131,6 +131,25 @@ class FileObject {
 		*/
 		PLCORE_API void Assign(const Url &cUrl, const FileAccess *pAccess = nullptr);
 
+		/**
+		*  @brief
+		*    Assign a new URL of a file within a ZIP-file whose entry was located before
+		*
+		*  @param[in] cUrl
+		*    URL of the file, e.g. "Data.zip/Textures/Stone.dds"
+		*  @param[in] nZipEntryIndex
+		*    Index of the entry within the ZIP-file (see ZipHandle::GetCurrentFileIndex())
+		*  @param[in] nZipEntryPosition
+		*    Position of the entry within the central directory of the ZIP-file (see ZipHandle::GetCurrentFilePosition())
+		*  @param[in] pAccess
+		*    Additional file access information (can be a null pointer)
+		*
+		*  @remarks
+		*    Same as Assign(), but the entry is not searched within the central directory of the ZIP-file. If the
+		*    URL is not within a ZIP-file or the entry doesn't match, this behaves exactly like Assign().
+		*/
+		PLCORE_API void Assign(const Url &cUrl, uint32 nZipEntryIndex, uint32 nZipEntryPosition, const FileAccess *pAccess = nullptr);
+
 		/**
 		*  @brief
 		*    Assign a new file
@@ -194,6 +213,28 @@ class FileObject {
 		*/
 		inline bool IsDirectory() const;
 
+		/**
+		*  @brief
+		*    Returns if the object is a link (e.g. a symbolic link) to another file or directory
+		*
+		*  @return
+		*    'true', if the object is a link, else 'false'
+		*
+		*  @note
+		*    - "IsFile()" and "IsDirectory()" are following links, a link to a directory is a directory and a link at the same time
+		*/
+		inline bool IsLink() const;
+
+		/**
+		*  @brief
+		*    Returns the time of the last modification
+		*
+		*  @return
+		*    Time of the last modification in milliseconds since midnight, January 1, 1970 (UTC), 0 on error or if not supported
+		*    by the file implementation
+		*/
+		inline uint64 GetModificationTime() const;
+
 		/**
 		*  @brief
 		*    Copy the file or directory to a new location
@@ -315,6 +356,23 @@ class FileObject {
 		*/
 		FileObject &operator =(const FileObject &cSource);
 
+		/**
+		*  @brief
+		*    Assign a new URL
+		*
+		*  @param[in] cUrl
+		*    URL of the file or directory
+		*  @param[in] pAccess
+		*    Additional file access information (can be a null pointer)
+		*  @param[in] bZipEntry
+		*    Are 'nZipEntryIndex' and 'nZipEntryPosition' valid?
+		*  @param[in] nZipEntryIndex
+		*    Index of the entry within the ZIP-file, only used if 'bZipEntry' is 'true'
+		*  @param[in] nZipEntryPosition
+		*    Position of the entry within the central directory of the ZIP-file, only used if 'bZipEntry' is 'true'
+		*/
+		void AssignUrl(const Url &cUrl, const FileAccess *pAccess, bool bZipEntry, uint32 nZipEntryIndex, uint32 nZipEntryPosition);
+
 
 	//[-------------------------------------------------------]
 	//[ Protected data                                        ]
@@ -142,6 +142,24 @@ inline bool FileObject::IsDirectory() const
 	return m_pFileImpl ? m_pFileImpl->IsDirectory() : false;
 }
 
+/**
+*  @brief
+*    Returns if the object is a link
+*/
+inline bool FileObject::IsLink() const
+{
+	return m_pFileImpl ? m_pFileImpl->IsLink() : false;
+}
+
+/**
+*  @brief
+*    Returns the time of the last modification
+*/
+inline uint64 FileObject::GetModificationTime() const
+{
+	return m_pFileImpl ? m_pFileImpl->GetModificationTime() : 0;
+}
+
 /**
 *  @brief
 *    Copy the file or directory to a new location
@@ -88,6 +88,7 @@ class FileWindows : public FileImpl {
 		virtual bool Exists() const override;
 		virtual bool IsFile() const override;
 		virtual bool IsDirectory() const override;
+		virtual bool IsLink() const override;
 		virtual bool CopyTo(const String &sDest, bool bOverwrite) const override;
 		virtual bool MoveTo(const String &sDest) override;
 		virtual bool Rename(const String &sName) override;
@@ -113,6 +114,9 @@ class FileWindows : public FileImpl {
 		virtual int32 Tell() const override;
 		virtual uint32 GetSize() const override;
 		virtual FileSearchImpl *CreateSearch() override;
+		virtual uint8 *MapMemory(uint32 &nSize) override;
+		virtual void UnmapMemory(uint8 *pData, uint32 nSize) override;
+		virtual uint64 GetModificationTime() const override;
 
 
 	//[-------------------------------------------------------]
@@ -78,6 +78,28 @@ class FileZip : public FileImpl {
 		*/
 		FileZip(const Url &cUrl, const String &sZipFile, const String &sPathInZip, const FileAccess *pAccess);
 
+		/**
+		*  @brief
+		*    Constructor for an entry which was located before
+		*
+		*  @param[in] cUrl
+		*    URL of the file or directory
+		*  @param[in] sZipFile
+		*    Path to the ZIP-file
+		*  @param[in] sPathInZip
+		*    Path inside the ZIP-file
+		*  @param[in] nEntryIndex
+		*    Index of the entry (see ZipHandle::GetCurrentFileIndex())
+		*  @param[in] nEntryPosition
+		*    Position of the entry within the central directory (see ZipHandle::GetCurrentFilePosition())
+		*  @param[in] pAccess
+		*    Additional file access information (can be a null pointer)
+		*
+		*  @note
+		*    - If the given entry doesn't match the path inside the ZIP-file (ZIP-file changed?), the entry is searched by name
+		*/
+		FileZip(const Url &cUrl, const String &sZipFile, const String &sPathInZip, uint32 nEntryIndex, uint32 nEntryPosition, const FileAccess *pAccess);
+
 		/**
 		*  @brief
 		*    Destructor
@@ -119,6 +141,17 @@ class FileZip : public FileImpl {
 		virtual FileSearchImpl *CreateSearch() override;
 
 
+	//[-------------------------------------------------------]
+	//[ Private functions                                     ]
+	//[-------------------------------------------------------]
+	private:
+		/**
+		*  @brief
+		*    Opens the ZIP-file
+		*/
+		void OpenZipFile();
+
+
 	//[-------------------------------------------------------]
 	//[ Private data                                          ]
 	//[-------------------------------------------------------]
@@ -254,6 +254,41 @@ class ZipHandle {
 		*/
 		PLCORE_API bool LocateFile(const String &sFilename);
 
+		/**
+		*  @brief
+		*    Sets the pointer to an entry in the ZIP-file which was located before
+		*
+		*  @param[in] nIndex
+		*    Index of the entry (see GetCurrentFileIndex())
+		*  @param[in] nPosition
+		*    Position of the entry within the central directory (see GetCurrentFilePosition())
+		*
+		*  @return
+		*    'true', if the file is valid, 'false' on error
+		*
+		*  @remarks
+		*    Unlike LocateFile() with a filename, this doesn't need to walk through the central directory.
+		*/
+		PLCORE_API bool LocateFile(uint32 nIndex, uint32 nPosition);
+
+		/**
+		*  @brief
+		*    Returns the index of the current entry in the ZIP-file
+		*
+		*  @return
+		*    Index of the current entry
+		*/
+		PLCORE_API uint32 GetCurrentFileIndex() const;
+
+		/**
+		*  @brief
+		*    Returns the position of the current entry within the central directory of the ZIP-file
+		*
+		*  @return
+		*    Position of the current entry within the central directory
+		*/
+		PLCORE_API uint32 GetCurrentFilePosition() const;
+
 		/**
 		*  @brief
 		*    Get information about the current entry in the ZIP-file
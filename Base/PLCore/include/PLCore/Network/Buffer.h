@@ -123,6 +123,15 @@ class Buffer {
 		*/
 		inline uint32 GetSize() const;
 
+		/**
+		*  @brief
+		*    Get the number of bytes currently stored within the buffer
+		*
+		*  @return
+		*    The number of used bytes
+		*/
+		inline uint32 GetUsedSize() const;
+
 		/**
 		*  @brief
 		*    Add data to the buffer
@@ -134,6 +143,15 @@ class Buffer {
 		*/
 		PLCORE_API void Add(const char *pData, uint32 nSize);
 
+		/**
+		*  @brief
+		*    Remove data from the front of the buffer
+		*
+		*  @param[in] nSize
+		*    Number of bytes to remove, if greater than the number of used bytes, all data is removed
+		*/
+		PLCORE_API void Remove(uint32 nSize);
+
 		/**
 		*  @brief
 		*    Get a line from the buffer
@@ -71,6 +71,16 @@ inline uint32 Buffer::GetSize() const
 	return m_nSize;
 }
 
+/**
+*  @brief
+*    Get the number of bytes currently stored within the buffer
+*/
+inline uint32 Buffer::GetUsedSize() const
+{
+	// Return used size
+	return m_nUsed;
+}
+
 /**
 *  @brief
 *    Get data
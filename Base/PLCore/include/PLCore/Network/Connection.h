@@ -30,8 +30,11 @@
 //[-------------------------------------------------------]
 //[ Includes                                              ]
 //[-------------------------------------------------------]
+#include "PLCore/System/Mutex.h"
 #include "PLCore/System/Thread.h"
+#include "PLCore/Container/Array.h"
 #include "PLCore/Network/Socket.h"
+#include "PLCore/Network/Buffer.h"
 
 
 //[-------------------------------------------------------]
@@ -43,7 +46,9 @@ namespace PLCore {
 //[-------------------------------------------------------]
 //[ Forward declarations                                  ]
 //[-------------------------------------------------------]
+class File;
 class Host;
+class Reactor;
 
 
 //[-------------------------------------------------------]
@@ -67,6 +72,11 @@ class Host;
 *    and to hide the rest so the application do not have to care about it. The application
 *    should 'only' use the methods of the concrete for instance game-connection class - NEVER
 *    creating somewhere data-packages and sending them by itself using Connection::Send()!
+*
+*  @note
+*    - By default, each connection is using an own thread to receive data, if the host is using I/O threads
+*      (see "Host::SetNumOfIOThreads()"), connections with automatic receive mode are using event driven
+*      network I/O instead (see "Reactor")
 */
 class Connection : protected Thread {
 
@@ -75,12 +85,15 @@ class Connection : protected Thread {
 	//[ Friends                                               ]
 	//[-------------------------------------------------------]
 	friend class Host;
+	friend class Reactor;
 
 
 	//[-------------------------------------------------------]
 	//[ Public definitions                                    ]
 	//[-------------------------------------------------------]
 	public:
+		static const uint32 MaxLineLength = 8192;	/**< Maximum length in bytes of a line read by "ReadLine()", including the line delimiter */
+
 		/**
 		*  @brief
 		*    Receive mode
@@ -173,6 +186,9 @@ class Connection : protected Thread {
 		*
 		*  @return
 		*    'true' if all went fine, else 'false' (maybe there's no connection established?)
+		*
+		*  @note
+		*    - When using event driven network I/O, the connection is closed as soon as all buffered data has been sent
 		*/
 		PLCORE_API bool Disconnect();
 
@@ -198,7 +214,7 @@ class Connection : protected Thread {
 		*    called. In both cases, OnReceive() will be called whenever new data has arrived. 
 		*    By default, mode is set to ReceiveAutomatic.
 		*/
-		inline void SetReceiveMode(EReceiveMode nReceiveMode);
+		PLCORE_API void SetReceiveMode(EReceiveMode nReceiveMode);
 
 		/**
 		*  @brief
@@ -212,8 +228,34 @@ class Connection : protected Thread {
 		*  @return
 		*    Total number of bytes sent. Can be less than the requested size
 		*    to be sent, negative value on error
+		*
+		*  @note
+		*    - When using event driven network I/O, data which can't be sent at once is buffered and
+		*      sent as soon as possible, the buffered data is taken into account within the returned size
+		*/
+		PLCORE_API int Send(const char *pBuffer, uint32 nSize) const;
+
+		/**
+		*  @brief
+		*    Send a range of a file
+		*
+		*  @param[in] pFile
+		*    File to send, must be opened for reading, the connection takes over the control and destroys the
+		*    file after it has been sent, if a null pointer nothing happens
+		*  @param[in] nOffset
+		*    Offset of the first byte to send
+		*  @param[in] nSize
+		*    Number of bytes to send, must be within the file
+		*
+		*  @return
+		*    'true' if all went fine (the data may still be waiting to be sent), else 'false'
+		*
+		*  @note
+		*    - Open the file with 'File::FileMemMap', the data is then sent directly out of the memory mapping in
+		*      large writes without copying it into a send buffer first, else the file is read in chunks
+		*    - When using event driven network I/O, the file is kept until the socket is able to take all of its data
 		*/
-		inline int Send(const char *pBuffer, uint32 nSize) const;
+		PLCORE_API bool SendFileRange(File *pFile, uint32 nOffset, uint32 nSize) const;
 
 		/**
 		*  @brief
@@ -244,6 +286,7 @@ class Connection : protected Thread {
 		*      as possible, meaning that less data can be read than requested
 		*    - If more data is waiting to be received as the given buffer is able to store,
 		*      you have to call this method multiple times in order to gather all waiting data
+		*    - Data which was already received by "ReadLine()" but not returned by it is returned first
 		*/
 		PLCORE_API int Receive(char *pBuffer, uint32 nSize);
 
@@ -252,7 +295,13 @@ class Connection : protected Thread {
 		*    Read line of text (blocking request)
 		*
 		*  @return
-		*    Line read
+		*    Line read, including the line delimiter, empty string on error
+		*
+		*  @note
+		*    - Data is received in chunks, data behind the line is kept and returned by the next
+		*      "ReadLine()" or "Receive()" call
+		*    - A line must not be longer than "MaxLineLength" bytes (including the line delimiter), else the
+		*      received data is dropped, the connection is closed and an empty string is returned
 		*/
 		PLCORE_API String ReadLine();
 
@@ -264,6 +313,10 @@ class Connection : protected Thread {
 		/**
 		*  @brief
 		*    Destructor
+		*
+		*  @note
+		*    - Waits until no I/O thread or connection thread is accessing the connection any longer, but because the callbacks of derived
+		*      classes may still be running at this point, the host shuts a connection down before destroying it
 		*/
 		PLCORE_API virtual ~Connection();
 
@@ -326,6 +379,22 @@ class Connection : protected Thread {
 		PLCORE_API virtual void OnReceive(const char *pBuffer, uint32 nSize);
 
 
+	//[-------------------------------------------------------]
+	//[ Private definitions                                   ]
+	//[-------------------------------------------------------]
+	private:
+		/**
+		*  @brief
+		*    File waiting to be sent
+		*/
+		struct QueuedFile {
+			File   *pFile;			/**< File to send, always valid */
+			uint32  nOffset;		/**< Offset of the next byte to send */
+			uint32  nSize;			/**< Number of bytes left to send */
+			uint64  nSendPosition;	/**< Position within the stream of buffered data ('m_nSendBufferRemoved' based) the file is sent at */
+		};
+
+
 	//[-------------------------------------------------------]
 	//[ Private functions                                     ]
 	//[-------------------------------------------------------]
@@ -360,6 +429,89 @@ class Connection : protected Thread {
 		*/
 		bool ReceiveData();
 
+		/**
+		*  @brief
+		*    Start receiving data after the connection has been established
+		*
+		*  @remarks
+		*    Registers the connection at the reactor of the host if possible, else the connection thread is started.
+		*/
+		void StartReceiving();
+
+		/**
+		*  @brief
+		*    Unregister the connection from the reactor
+		*
+		*  @note
+		*    - Data waiting to be sent is kept, the socket is blocking again afterwards
+		*/
+		void StopEventDrivenIO();
+
+		/**
+		*  @brief
+		*    Close the connection at once
+		*
+		*  @return
+		*    'true' if all went fine, else 'false' (maybe there's no connection established?)
+		*/
+		bool CloseConnection();
+
+		/**
+		*  @brief
+		*    Close the connection at once and wait until no I/O thread or connection thread is accessing the connection any longer
+		*
+		*  @note
+		*    - Must be called before the connection is destroyed, when called from within a callback of the
+		*      connection itself there's nothing to wait for
+		*/
+		void Shutdown();
+
+		/**
+		*  @brief
+		*    Check whether or not data is waiting to be sent
+		*
+		*  @return
+		*    'true' if neither buffered data nor files are waiting to be sent, else 'false'
+		*
+		*  @note
+		*    - The send mutex must be locked when calling this function
+		*/
+		inline bool IsSendQueueEmpty() const;
+
+		/**
+		*  @brief
+		*    Send as much of the data waiting to be sent as possible
+		*
+		*  @return
+		*    'true' if all went fine, else 'false'
+		*
+		*  @note
+		*    - The send mutex must be locked when calling this function
+		*    - While registered at the reactor, data is sent until the socket would block, else all data is sent
+		*/
+		bool SendQueuedData() const;
+
+		/**
+		*  @brief
+		*    Destroy all data waiting to be sent
+		*
+		*  @note
+		*    - The send mutex must be locked when calling this function
+		*/
+		void ClearSendQueue() const;
+
+		/**
+		*  @brief
+		*    Called by the reactor when the socket is readable
+		*/
+		void OnReadable();
+
+		/**
+		*  @brief
+		*    Called by the reactor when the socket is writable
+		*/
+		void OnWritable();
+
 
 	//[-------------------------------------------------------]
 	//[ Private data                                          ]
@@ -369,8 +521,19 @@ class Connection : protected Thread {
 		volatile bool	 m_bConnected;		/**< Connection status */
 		String			 m_sHostname;		/**< Name of host */
 		uint32			 m_nPort;			/**< Port number */
-		Socket			 m_cSocket;			/**< Connection socket */
-		EReceiveMode	 m_nReceiveMode;	/**< Receive mode */
+		Socket			 m_cSocket;				/**< Connection socket */
+		EReceiveMode	 m_nReceiveMode;		/**< Receive mode */
+		Buffer			 m_cReceiveBuffer;		/**< Data received by "ReadLine()" which was not returned yet */
+		// Event driven network I/O
+		Reactor			*m_pReactor;			/**< Reactor the connection is registered at, a null pointer if the connection is not registered */
+		Reactor			*m_pIOReactor;			/**< Reactor the connection was registered at last, kept after unregistering so "Shutdown()" can wait for the I/O thread */
+		uint32			 m_nIOThread;			/**< Index of the I/O thread of the reactor the connection is assigned to */
+		uint64			 m_nReactorHandle;		/**< Handle of the connection within the I/O thread (slot index and slot generation) */
+		mutable Buffer	 m_cSendBuffer;			/**< Data waiting to be sent */
+		mutable uint64	 m_nSendBufferRemoved;	/**< Total number of bytes removed from the front of the send buffer */
+		mutable Array<QueuedFile*> m_lstSendFiles;	/**< Files waiting to be sent, in order */
+		mutable Mutex	 m_cSendMutex;			/**< Mutex protecting the send buffer and the reactor pointer */
+		volatile bool	 m_bDisconnectPending;	/**< 'true' if the connection shall be closed as soon as the send buffer is empty */
 
 
 	//[-------------------------------------------------------]
@@ -111,26 +111,6 @@ inline Connection::EReceiveMode Connection::GetReceiveMode() const
 	return m_nReceiveMode;
 }
 
-/**
-*  @brief
-*    Set receive mode
-*/
-inline void Connection::SetReceiveMode(EReceiveMode nReceiveMode)
-{
-	// Set receive mode
-	m_nReceiveMode = nReceiveMode;
-}
-
-/**
-*  @brief
-*    Send data
-*/
-inline int Connection::Send(const char *pBuffer, uint32 nSize) const
-{
-	// Send data buffer
-	return (pBuffer && nSize > 0) ? m_cSocket.Send(pBuffer, nSize) : -1;
-}
-
 /**
 *  @brief
 *    Send string
@@ -149,6 +129,19 @@ inline int Connection::Send(const String &sString) const
 }
 
 
+//[-------------------------------------------------------]
+//[ Private functions                                     ]
+//[-------------------------------------------------------]
+/**
+*  @brief
+*    Check whether or not data is waiting to be sent
+*/
+inline bool Connection::IsSendQueueEmpty() const
+{
+	return (!m_cSendBuffer.GetUsedSize() && !m_lstSendFiles.GetNumOfElements());
+}
+
+
 //[-------------------------------------------------------]
 //[ Namespace                                             ]
 //[-------------------------------------------------------]
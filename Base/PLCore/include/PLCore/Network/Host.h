@@ -31,6 +31,7 @@
 //[ Includes                                              ]
 //[-------------------------------------------------------]
 #include "PLCore/Container/List.h"
+#include "PLCore/System/Mutex.h"
 #include "PLCore/System/Thread.h"
 #include "PLCore/Network/Socket.h"
 
@@ -44,6 +45,7 @@ namespace PLCore {
 //[-------------------------------------------------------]
 //[ Forward declarations                                  ]
 //[-------------------------------------------------------]
+class Reactor;
 class Connection;
 
 
@@ -177,6 +179,34 @@ class Host {
 		*/
 		inline void SetMaxConnections(uint32 nMaxConnections);
 
+		/**
+		*  @brief
+		*    Returns the number of I/O threads used for event driven network I/O
+		*
+		*  @return
+		*    Number of I/O threads, 0 if each connection is using an own thread
+		*/
+		inline uint32 GetNumOfIOThreads() const;
+
+		/**
+		*  @brief
+		*    Sets the number of I/O threads used for event driven network I/O
+		*
+		*  @param[in] nNumOfIOThreads
+		*    Number of I/O threads, 0 if each connection shall use an own thread (default)
+		*
+		*  @remarks
+		*    By default, each connection is using an own thread to receive data, which doesn't scale to
+		*    more than a few hundred concurrent connections. When using I/O threads, connections with automatic
+		*    receive mode are registered at a reactor instead, a small number of I/O threads is then dispatching
+		*    the events of all connections (see "Reactor" for details).
+		*
+		*  @note
+		*    - Has to be set before the first connection is established, later changes are ignored
+		*    - Has no effect if event driven network I/O is not supported on the current platform (see "Reactor::IsSupported()")
+		*/
+		PLCORE_API void SetNumOfIOThreads(uint32 nNumOfIOThreads);
+
 		/**
 		*  @brief
 		*    Get list of active connection
@@ -265,6 +295,18 @@ class Host {
 		*/
 		void CheckNewConnections();
 
+		/**
+		*  @brief
+		*    Returns the reactor used for event driven network I/O
+		*
+		*  @return
+		*    The reactor, created on the first request, a null pointer if no I/O threads are used
+		*
+		*  @note
+		*    - Thread safe, the server thread and the user may establish connections at the same time
+		*/
+		Reactor *GetReactor();
+
 		/**
 		*  @brief
 		*    Add connection
@@ -348,6 +390,9 @@ class Host {
 		uint32				m_nMaxConnections;	/**< Maximum number of allowed connections */
 		List<Connection*>	m_lstConnections;	/**< List of connections */
 		Socket				m_cSocket;			/**< Server socket */
+		uint32				m_nNumOfIOThreads;	/**< Number of I/O threads, 0 if each connection is using an own thread */
+		Reactor			   *m_pReactor;			/**< Reactor used for event driven network I/O, can be a null pointer */
+		Mutex				m_cReactorMutex;	/**< Locked while the reactor is created */
 
 
 };
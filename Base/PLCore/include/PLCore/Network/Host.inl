@@ -84,6 +84,16 @@ inline void Host::SetMaxConnections(uint32 nMaxConnections)
 	m_nMaxConnections = nMaxConnections;
 }
 
+/**
+*  @brief
+*    Returns the number of I/O threads used for event driven network I/O
+*/
+inline uint32 Host::GetNumOfIOThreads() const
+{
+	// Return number of I/O threads
+	return m_nNumOfIOThreads;
+}
+
 /**
 *  @brief
 *    Get list of active connection
@@ -0,0 +1,275 @@
+/*********************************************************\
+ *  File: HttpFileCache.h                                *
+ *
+ *  Copyright (C) 2002-2013 The PixelLight Team (http://www.pixellight.org/)
+ *
+ *  This file is part of PixelLight.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ *  and associated documentation files (the "Software"), to deal in the Software without
+ *  restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ *  Software is furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all copies or
+ *  substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ *  BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ *  DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ *  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+#ifndef __PLCORE_HTTPFILECACHE_H__
+#define __PLCORE_HTTPFILECACHE_H__
+#pragma once
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include "PLCore/System/Mutex.h"
+#include "PLCore/Container/HashMap.h"
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace PLCore {
+
+
+//[-------------------------------------------------------]
+//[ Forward declarations                                  ]
+//[-------------------------------------------------------]
+class File;
+
+
+//[-------------------------------------------------------]
+//[ Classes                                               ]
+//[-------------------------------------------------------]
+/**
+*  @brief
+*    Cache for the content of small files served by a HTTP server
+*
+*  @remarks
+*    The content of a file is cached by filename and time of the last modification, so a changed file is
+*    never served out of the cache. When the maximum cache size is reached, the least recently used files
+*    are removed from the cache.
+*
+*  @note
+*    - All functions are thread safe
+*    - Each entry returned by "Get()" or "Add()" must be released using "Release()", a released entry must no
+*      longer be used
+*/
+class HttpFileCache {
+
+
+	//[-------------------------------------------------------]
+	//[ Public definitions                                    ]
+	//[-------------------------------------------------------]
+	public:
+		/**
+		*  @brief
+		*    Cached file
+		*/
+		struct Entry {
+			String	 sFilename;			/**< Filename the content is cached for */
+			uint64	 nModificationTime;	/**< Time of the last modification of the file when the content was cached */
+			uint8	*pnData;			/**< File content, always valid */
+			uint32	 nSize;				/**< Size of the file content in bytes */
+			uint32	 nRefCount;			/**< Number of users of the entry, the cache itself is not counted */
+			bool	 bCached;			/**< 'false' if the entry was removed from the cache and is destroyed as soon as it's no longer used */
+			Entry	*pPrevious;			/**< More recently used entry, a null pointer for the most recently used entry */
+			Entry	*pNext;				/**< Less recently used entry, a null pointer for the least recently used entry */
+		};
+
+
+	//[-------------------------------------------------------]
+	//[ Public functions                                      ]
+	//[-------------------------------------------------------]
+	public:
+		/**
+		*  @brief
+		*    Constructor
+		*/
+		PLCORE_API HttpFileCache();
+
+		/**
+		*  @brief
+		*    Destructor
+		*/
+		PLCORE_API ~HttpFileCache();
+
+		/**
+		*  @brief
+		*    Get the maximum size of all cached files together
+		*
+		*  @return
+		*    Maximum size in bytes, 0 if the cache is disabled
+		*/
+		inline uint32 GetMaxSize() const;
+
+		/**
+		*  @brief
+		*    Set the maximum size of all cached files together
+		*
+		*  @param[in] nMaxSize
+		*    Maximum size in bytes, 0 to disable the cache (default: 16 MiB)
+		*/
+		PLCORE_API void SetMaxSize(uint32 nMaxSize);
+
+		/**
+		*  @brief
+		*    Get the maximum size of a single cached file
+		*
+		*  @return
+		*    Maximum size in bytes
+		*/
+		inline uint32 GetMaxFileSize() const;
+
+		/**
+		*  @brief
+		*    Set the maximum size of a single cached file
+		*
+		*  @param[in] nMaxFileSize
+		*    Maximum size in bytes, larger files are never cached (default: 64 KiB)
+		*/
+		inline void SetMaxFileSize(uint32 nMaxFileSize);
+
+		/**
+		*  @brief
+		*    Get the size of all cached files together
+		*
+		*  @return
+		*    Size in bytes
+		*/
+		inline uint32 GetSize() const;
+
+		/**
+		*  @brief
+		*    Remove all files from the cache
+		*/
+		PLCORE_API void Clear();
+
+		/**
+		*  @brief
+		*    Get a cached file
+		*
+		*  @param[in] sFilename
+		*    Filename
+		*  @param[in] nModificationTime
+		*    Current time of the last modification of the file, see "FileObject::GetModificationTime()"
+		*
+		*  @return
+		*    The cached file, a null pointer if the file is not cached or was modified since it was cached
+		*/
+		PLCORE_API const Entry *Get(const String &sFilename, uint64 nModificationTime);
+
+		/**
+		*  @brief
+		*    Add a file to the cache
+		*
+		*  @param[in] sFilename
+		*    Filename
+		*  @param[in] nModificationTime
+		*    Time of the last modification of the file, 0 if unknown
+		*  @param[in] cFile
+		*    File opened for reading, the content is read from the current file position on
+		*
+		*  @return
+		*    The cached file, a null pointer on error or if the file can't be cached (cache disabled,
+		*    file too large or modification time unknown)
+		*/
+		PLCORE_API const Entry *Add(const String &sFilename, uint64 nModificationTime, File &cFile);
+
+		/**
+		*  @brief
+		*    Release a file returned by "Get()" or "Add()"
+		*
+		*  @param[in] cEntry
+		*    Cached file to release, must no longer be used after this function returns
+		*/
+		PLCORE_API void Release(const Entry &cEntry);
+
+
+	//[-------------------------------------------------------]
+	//[ Private functions                                     ]
+	//[-------------------------------------------------------]
+	private:
+		/**
+		*  @brief
+		*    Copy constructor
+		*
+		*  @param[in] cSource
+		*    Source to copy from
+		*/
+		HttpFileCache(const HttpFileCache &cSource);
+
+		/**
+		*  @brief
+		*    Copy operator
+		*
+		*  @param[in] cSource
+		*    Source to copy from
+		*
+		*  @return
+		*    Reference to this instance
+		*/
+		HttpFileCache &operator =(const HttpFileCache &cSource);
+
+		/**
+		*  @brief
+		*    Remove an entry from the cache
+		*
+		*  @param[in] cEntry
+		*    Entry to remove, destroyed if it's not used
+		*
+		*  @note
+		*    - The mutex must be locked when calling this function
+		*/
+		void RemoveEntry(Entry &cEntry);
+
+		/**
+		*  @brief
+		*    Remove least recently used entries until the cache size is within the given limit
+		*
+		*  @param[in] nMaxSize
+		*    Maximum size in bytes
+		*
+		*  @note
+		*    - The mutex must be locked when calling this function
+		*/
+		void Shrink(uint32 nMaxSize);
+
+
+	//[-------------------------------------------------------]
+	//[ Private data                                          ]
+	//[-------------------------------------------------------]
+	private:
+		uint32					 m_nMaxSize;		/**< Maximum size of all cached files together in bytes */
+		uint32					 m_nMaxFileSize;	/**< Maximum size of a single cached file in bytes */
+		uint32					 m_nSize;			/**< Size of all cached files together in bytes */
+		HashMap<String, Entry*>	 m_mapEntries;		/**< Cached files, key = filename */
+		Entry					*m_pFirst;			/**< Most recently used entry, can be a null pointer */
+		Entry					*m_pLast;			/**< Least recently used entry, can be a null pointer */
+		Mutex					 m_cMutex;			/**< Mutex protecting the cache */
+
+
+};
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+} // PLCore
+
+
+//[-------------------------------------------------------]
+//[ Implementation                                        ]
+//[-------------------------------------------------------]
+#include "PLCore/Network/Http/HttpFileCache.inl"
+
+
+#endif // __PLCORE_HTTPFILECACHE_H__
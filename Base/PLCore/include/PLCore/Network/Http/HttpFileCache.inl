@@ -0,0 +1,74 @@
+/*********************************************************\
+ *  File: HttpFileCache.inl                              *
+ *
+ *  Copyright (C) 2002-2013 The PixelLight Team (http://www.pixellight.org/)
+ *
+ *  This file is part of PixelLight.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ *  and associated documentation files (the "Software"), to deal in the Software without
+ *  restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ *  Software is furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all copies or
+ *  substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ *  BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ *  DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ *  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace PLCore {
+
+
+//[-------------------------------------------------------]
+//[ Public functions                                      ]
+//[-------------------------------------------------------]
+/**
+*  @brief
+*    Get the maximum size of all cached files together
+*/
+inline uint32 HttpFileCache::GetMaxSize() const
+{
+	return m_nMaxSize;
+}
+
+/**
+*  @brief
+*    Get the maximum size of a single cached file
+*/
+inline uint32 HttpFileCache::GetMaxFileSize() const
+{
+	return m_nMaxFileSize;
+}
+
+/**
+*  @brief
+*    Set the maximum size of a single cached file
+*/
+inline void HttpFileCache::SetMaxFileSize(uint32 nMaxFileSize)
+{
+	m_nMaxFileSize = nMaxFileSize;
+}
+
+/**
+*  @brief
+*    Get the size of all cached files together
+*/
+inline uint32 HttpFileCache::GetSize() const
+{
+	return m_nSize;
+}
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+} // PLCore
@@ -208,7 +208,8 @@ class HttpHeader {
 		*    HTTP connection type
 		*
 		*  @remarks
-		*    To access this information, Parse() has to be called first
+		*    To access this information, Parse() has to be called first. HTTP 1.1 requests without
+		*    a connection type keep the connection open.
 		*/
 		inline EHttpConnection GetConnectionType() const;
 
@@ -400,7 +401,8 @@ class HttpHeader {
 		*    'true' if partial data is returned, else 'false'
 		*
 		*  @remarks
-		*    To access this information, Parse() has to be called first
+		*    To access this information, Parse() has to be called first. For a request, this
+		*    returns whether or not a single byte range ("Range: bytes=<first>-[<last>]") is requested.
 		*/
 		inline bool IsPartial() const;
 
@@ -421,7 +423,7 @@ class HttpHeader {
 		*    Get end of range
 		*
 		*  @return
-		*    Byte position
+		*    Byte position (inclusive), 0xFFFFFFFF if a request asks for all data up to the end
 		*
 		*  @remarks
 		*    To access this information, Parse() has to be called first
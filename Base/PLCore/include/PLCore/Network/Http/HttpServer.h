@@ -32,6 +32,7 @@
 //[-------------------------------------------------------]
 #include "PLCore/Network/Server.h"
 #include "PLCore/Network/Http/Http.h"
+#include "PLCore/Network/Http/HttpFileCache.h"
 
 
 //[-------------------------------------------------------]
@@ -79,6 +80,15 @@ class HttpServer : public Server {
 		*/
 		PLCORE_API virtual ~HttpServer();
 
+		/**
+		*  @brief
+		*    Get the cache for the content of small files sent by "HttpServerConnection::SendFile()"
+		*
+		*  @return
+		*    File cache
+		*/
+		PLCORE_API HttpFileCache &GetFileCache();
+
 
 	//[-------------------------------------------------------]
 	//[ Protected virtual HttpServer functions                ]
@@ -153,6 +163,13 @@ class HttpServer : public Server {
 		HttpServer &operator =(const HttpServer &cServer);
 
 
+	//[-------------------------------------------------------]
+	//[ Private data                                          ]
+	//[-------------------------------------------------------]
+	private:
+		HttpFileCache m_cFileCache;	/**< Cache for the content of small files */
+
+
 };
 
 
@@ -53,6 +53,10 @@ class HttpServer;
 /**
 *  @brief
 *    Http server connection
+*
+*  @remarks
+*    The connection is kept open after a response if the client asks for it (HTTP 1.1 default), requests sent
+*    by the client without waiting for the previous response (pipelining) are answered in order.
 */
 class HttpServerConnection : public Connection {
 
@@ -84,6 +88,11 @@ class HttpServerConnection : public Connection {
 		*    HTTP status code
 		*  @param[in] sFilename
 		*    Filename
+		*
+		*  @remarks
+		*    The content of small files is taken out of the file cache of the server, larger files are sent
+		*    directly out of a memory mapping. If the status code is 'Http_200_OK' and the client requested a
+		*    byte range, only this range is sent.
 		*/
 		PLCORE_API void SendFile(EHttpStatus nStatus, const String &sFilename);
 
@@ -127,7 +136,7 @@ class HttpServerConnection : public Connection {
 		*  @param[in] sMimeType
 		*    MIME type
 		*  @param[in] nLength
-		*    Content length (0 for not sending the content-length at all)
+		*    Content length (0 for not sending the content-length at all, the connection is closed after the response then)
 		*/
 		PLCORE_API void SendHeader(EHttpStatus nStatus, const String &sMimeType, uint32 nLength);
 
@@ -155,6 +164,38 @@ class HttpServerConnection : public Connection {
 		PLCORE_API virtual void OnReceive(const char *pBuffer, uint32 nSize) override;
 
 
+	//[-------------------------------------------------------]
+	//[ Private functions                                     ]
+	//[-------------------------------------------------------]
+	private:
+		/**
+		*  @brief
+		*    Create HTTP header
+		*
+		*  @param[in] nStatus
+		*    HTTP status code
+		*  @param[in] sMimeType
+		*    MIME type, can be empty
+		*  @param[in] nLength
+		*    Content length
+		*  @param[in] sFields
+		*    Additional header fields, each one terminated by "\r\n", can be empty
+		*
+		*  @return
+		*    The HTTP header including the terminating empty line
+		*/
+		String CreateHeader(EHttpStatus nStatus, const String &sMimeType, uint32 nLength, const String &sFields = "") const;
+
+		/**
+		*  @brief
+		*    Finish the response to the current request
+		*
+		*  @remarks
+		*    Closes the connection if it's not kept open.
+		*/
+		void FinishResponse();
+
+
 	//[-------------------------------------------------------]
 	//[ Protected data                                        ]
 	//[-------------------------------------------------------]
@@ -162,6 +203,7 @@ class HttpServerConnection : public Connection {
 		HttpServer	*m_pServer;		/**< HTTP server */
 		Buffer		 m_cBuffer;		/**< Receive buffer */
 		HttpHeader	 m_cHttpHeader;	/**< Received HTTP header */
+		bool		 m_bKeepAlive;	/**< Keep the connection open after the response to the current request? */
 
 
 };
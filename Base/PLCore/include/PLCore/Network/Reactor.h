@@ -0,0 +1,302 @@
+/*********************************************************\
+ *  File: Reactor.h                                      *
+ *
+ *  Copyright (C) 2002-2013 The PixelLight Team (http://www.pixellight.org/)
+ *
+ *  This file is part of PixelLight.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ *  and associated documentation files (the "Software"), to deal in the Software without
+ *  restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ *  Software is furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all copies or
+ *  substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ *  BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ *  DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ *  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+#ifndef __PLCORE_REACTOR_H__
+#define __PLCORE_REACTOR_H__
+#pragma once
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include "PLCore/Container/Array.h"
+#include "PLCore/System/Mutex.h"
+#include "PLCore/System/Thread.h"
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace PLCore {
+
+
+//[-------------------------------------------------------]
+//[ Forward declarations                                  ]
+//[-------------------------------------------------------]
+class Host;
+class Socket;
+class Connection;
+
+
+//[-------------------------------------------------------]
+//[ Classes                                               ]
+//[-------------------------------------------------------]
+/**
+*  @brief
+*    Event driven network I/O
+*
+*  @remarks
+*    By default, each connection owns a thread which is blocking while waiting for new data. This doesn't
+*    scale to more than a few hundred concurrent connections. If a host is using I/O threads (see
+*    "Host::SetNumOfIOThreads()"), the connections with automatic receive mode are instead registered at a
+*    reactor. The reactor distributes them across a small number of I/O threads, each waiting for events of
+*    all of its non-blocking sockets at once. Received data is passed to "Connection::OnReceive()", data
+*    which can't be sent at once is buffered within the connection and sent as soon as the socket is writable.
+*
+*  @note
+*    - Implemented using "epoll" on Linux, on other platforms "IsSupported()" returns 'false' and hosts
+*      fall back to one thread per connection
+*    - The "Connection::OnConnect()", "Connection::OnReceive()" and "Connection::OnDisconnect()" callbacks are
+*      called by the I/O thread the connection is assigned to
+*    - Disconnecting a connection from within the callback of a connection assigned to another I/O thread
+*      posts the removal to the I/O thread of the connection and waits until it was processed, the waiting
+*      I/O thread keeps processing the removals posted to itself meanwhile, so two I/O threads disconnecting
+*      each other's connections can't deadlock
+*/
+class Reactor {
+
+
+	//[-------------------------------------------------------]
+	//[ Friends                                               ]
+	//[-------------------------------------------------------]
+	friend class Host;
+	friend class Connection;
+
+
+	//[-------------------------------------------------------]
+	//[ Public static functions                               ]
+	//[-------------------------------------------------------]
+	public:
+		/**
+		*  @brief
+		*    Returns whether or not event driven network I/O is supported on this platform
+		*
+		*  @return
+		*    'true' if event driven network I/O is supported, else 'false'
+		*/
+		static PLCORE_API bool IsSupported();
+
+
+	//[-------------------------------------------------------]
+	//[ Private definitions                                   ]
+	//[-------------------------------------------------------]
+	private:
+		/**
+		*  @brief
+		*    I/O thread
+		*/
+		class IOThread : public Thread {
+			public:
+				IOThread(Reactor &cReactor);
+				virtual ~IOThread();
+				virtual int Run() override;
+				void FreeSlot(uint32 nSlot);
+				void ProcessQueue();
+			public:
+				Reactor				&m_cReactor;			/**< Owner reactor */
+				handle				 m_nPoll;				/**< System poll handle */
+				handle				 m_nWakeUp;				/**< System event handle waking up the I/O thread when something was posted to its queue */
+				handle				 m_nThreadID;			/**< System ID of the I/O thread, set by the reactor after the thread was started and before any connection is added */
+				Mutex				 m_cMutex;				/**< Locked while the I/O thread is dispatching events and while slots are changed */
+				Array<Connection*>	 m_lstSlots;			/**< Connection slots, a null pointer for a free slot */
+				Array<uint32>		 m_lstGenerations;		/**< Generation of each slot, incremented each time a slot is freed */
+				Array<uint32>		 m_lstFreeSlots;		/**< Indices of free slots */
+				Mutex				 m_cQueueMutex;			/**< Locked while the queue is accessed, no other mutex is locked while holding it */
+				Array<uint32>		 m_lstQueue;			/**< Slots to free posted by other I/O threads, "NoSlot" if another I/O thread just waits for this one */
+				uint32				 m_nNumOfProcessed;		/**< Total number of processed queue entries, wraps around */
+		};
+
+
+	//[-------------------------------------------------------]
+	//[ Private functions                                     ]
+	//[-------------------------------------------------------]
+	private:
+		/**
+		*  @brief
+		*    Constructor
+		*
+		*  @param[in] nNumOfThreads
+		*    Number of I/O threads, at least one I/O thread is used
+		*/
+		Reactor(uint32 nNumOfThreads);
+
+		/**
+		*  @brief
+		*    Destructor
+		*
+		*  @note
+		*    - All connections must be removed before the reactor is destroyed
+		*/
+		~Reactor();
+
+		/**
+		*  @brief
+		*    Copy constructor
+		*
+		*  @param[in] cSource
+		*    Source to copy from
+		*/
+		Reactor(const Reactor &cSource);
+
+		/**
+		*  @brief
+		*    Copy operator
+		*
+		*  @param[in] cSource
+		*    Source to copy from
+		*
+		*  @return
+		*    Reference to this instance
+		*/
+		Reactor &operator =(const Reactor &cSource);
+
+		/**
+		*  @brief
+		*    Returns the I/O thread of the reactor the caller is running in
+		*
+		*  @return
+		*    Index of the I/O thread the caller is running in, number of I/O threads if the caller is not running within an I/O thread of this reactor
+		*/
+		uint32 GetCurrentIOThread() const;
+
+		/**
+		*  @brief
+		*    Registers a connection
+		*
+		*  @param[in] cConnection
+		*    Connection to register, the socket is switched into non-blocking mode
+		*
+		*  @return
+		*    'true' if all went fine, else 'false'
+		*/
+		bool AddConnection(Connection &cConnection);
+
+		/**
+		*  @brief
+		*    Unregisters a connection
+		*
+		*  @param[in] cConnection
+		*    Connection to unregister, the socket is switched back into blocking mode
+		*
+		*  @note
+		*    - When this method returns, the I/O threads are no longer accessing the connection
+		*/
+		void RemoveConnection(Connection &cConnection);
+
+		/**
+		*  @brief
+		*    Updates the events a registered connection is waiting for
+		*
+		*  @param[in] cConnection
+		*    Registered connection
+		*  @param[in] bWrite
+		*    'true' if the connection has buffered data to send and waits until the socket is writable, else 'false'
+		*/
+		void UpdateConnection(const Connection &cConnection, bool bWrite);
+
+		/**
+		*  @brief
+		*    Waits until an I/O thread has finished dispatching its current events
+		*
+		*  @param[in] nIOThread
+		*    Index of the I/O thread
+		*
+		*  @note
+		*    - Returns at once if called from within the given I/O thread
+		*/
+		void WaitForIOThread(uint32 nIOThread);
+
+		/**
+		*  @brief
+		*    Posts a slot to free to the queue of an I/O thread and waits until it was processed
+		*
+		*  @param[in] nIOThread
+		*    Index of the I/O thread, must not be the I/O thread the caller is running in
+		*  @param[in] nSlot
+		*    Connection slot to free, "NoSlot" to just wait until the I/O thread has finished dispatching its current events
+		*
+		*  @note
+		*    - Must be called from within an I/O thread of this reactor, the queue of the calling I/O thread is
+		*      processed while waiting
+		*/
+		void PostToIOThread(uint32 nIOThread, uint32 nSlot);
+
+
+	//[-------------------------------------------------------]
+	//[ Private static functions                              ]
+	//[-------------------------------------------------------]
+	private:
+		/**
+		*  @brief
+		*    Sends data using a non-blocking socket
+		*
+		*  @param[in] cSocket
+		*    Non-blocking socket
+		*  @param[in] pBuffer
+		*    Data to send
+		*  @param[in] nSize
+		*    Size in bytes of the data to send
+		*
+		*  @return
+		*    Number of bytes sent, 0 if the socket would block, negative value on error
+		*/
+		static int Send(const Socket &cSocket, const char *pBuffer, uint32 nSize);
+
+		/**
+		*  @brief
+		*    Receives data using a non-blocking socket
+		*
+		*  @param[in] cSocket
+		*    Non-blocking socket
+		*  @param[out] pBuffer
+		*    Buffer that receives the data
+		*  @param[in] nSize
+		*    Size in bytes of the buffer
+		*
+		*  @return
+		*    Number of bytes received, 0 if there's no data waiting, negative value if the connection was closed or on error
+		*/
+		static int Receive(const Socket &cSocket, char *pBuffer, uint32 nSize);
+
+
+	//[-------------------------------------------------------]
+	//[ Private data                                          ]
+	//[-------------------------------------------------------]
+	private:
+		IOThread		**m_ppThreads;		/**< I/O threads, can be a null pointer */
+		uint32			  m_nNumOfThreads;	/**< Number of I/O threads */
+		uint32			  m_nNextThread;	/**< Index of the I/O thread the next connection is assigned to */
+		volatile bool	  m_bShutdown;		/**< 'true' if the I/O threads shall stop */
+
+
+};
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+} // PLCore
+
+
+#endif // __PLCORE_REACTOR_H__
@@ -51,6 +51,15 @@
 */
 #define PL_WARNING_DISABLE(WarningID)
 
+/**
+*  @brief
+*    Storage class of a variable with one instance per thread
+*
+*  @note
+*    - Only usable for variables with static storage duration and POD type
+*/
+#define PL_THREAD_LOCAL __thread
+
 
 //[-------------------------------------------------------]
 //[ Includes                                              ]
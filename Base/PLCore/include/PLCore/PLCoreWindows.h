@@ -63,6 +63,19 @@
 	#define PL_WARNING_DISABLE(WarningID) __pragma(warning(disable: WarningID))
 #endif
 
+/**
+*  @brief
+*    Storage class of a variable with one instance per thread
+*
+*  @note
+*    - Only usable for variables with static storage duration and POD type
+*/
+#ifdef __MINGW32__
+	#define PL_THREAD_LOCAL __thread
+#else
+	#define PL_THREAD_LOCAL __declspec(thread)
+#endif
+
 
 //[-------------------------------------------------------]
 //[ Definitions                                           ]
@@ -0,0 +1,170 @@
+/*********************************************************\
+ *  File: Atomic.h                                       *
+ *
+ *  Copyright (C) 2002-2013 The PixelLight Team (http://www.pixellight.org/)
+ *
+ *  This file is part of PixelLight.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ *  and associated documentation files (the "Software"), to deal in the Software without
+ *  restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ *  Software is furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all copies or
+ *  substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ *  BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ *  DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ *  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+#ifndef __PLCORE_ATOMIC_H__
+#define __PLCORE_ATOMIC_H__
+#pragma once
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include "PLCore/PLCore.h"
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace PLCore {
+
+
+//[-------------------------------------------------------]
+//[ Classes                                               ]
+//[-------------------------------------------------------]
+/**
+*  @brief
+*    Static class with atomic integer operations
+*
+*  @remarks
+*    Atomic operations are useful to share simple counters and flags between threads without
+*    locking a mutex. All operations act as full memory barrier, meaning that memory accesses
+*    are not reordered across them by the compiler or the CPU.
+*
+*  @note
+*    - The variables which are manipulated by this class must be properly aligned
+*    - Use "Mutex"/"CriticalSection" for everything which is more complex than a counter or flag
+*/
+class Atomic {
+
+
+	//[-------------------------------------------------------]
+	//[ Public static functions                               ]
+	//[-------------------------------------------------------]
+	public:
+		/**
+		*  @brief
+		*    Atomically increments a value
+		*
+		*  @param[in, out] nValue
+		*    Value to increment
+		*
+		*  @return
+		*    The new value
+		*/
+		static inline int32 Increment(volatile int32 &nValue);
+
+		/**
+		*  @brief
+		*    Atomically decrements a value
+		*
+		*  @param[in, out] nValue
+		*    Value to decrement
+		*
+		*  @return
+		*    The new value
+		*/
+		static inline int32 Decrement(volatile int32 &nValue);
+
+		/**
+		*  @brief
+		*    Atomically adds to a value
+		*
+		*  @param[in, out] nValue
+		*    Value to add to
+		*  @param[in]      nAdd
+		*    Value to add, can be negative
+		*
+		*  @return
+		*    The new value
+		*/
+		static inline int32 Add(volatile int32 &nValue, int32 nAdd);
+
+		/**
+		*  @brief
+		*    Atomically sets a value
+		*
+		*  @param[out] nValue
+		*    Value to set
+		*  @param[in]  nNewValue
+		*    New value
+		*
+		*  @return
+		*    The previous value
+		*/
+		static inline int32 Exchange(volatile int32 &nValue, int32 nNewValue);
+
+		/**
+		*  @brief
+		*    Atomically sets a value if it's equal to a given value
+		*
+		*  @param[in, out] nValue
+		*    Value to set
+		*  @param[in]      nComparand
+		*    Value "nValue" is compared with
+		*  @param[in]      nNewValue
+		*    New value which is set if "nValue" is equal to "nComparand"
+		*
+		*  @return
+		*    'true' if the value was set, else 'false'
+		*/
+		static inline bool CompareAndSwap(volatile int32 &nValue, int32 nComparand, int32 nNewValue);
+
+		/**
+		*  @brief
+		*    Reads a value which may be written by other threads
+		*
+		*  @param[in] nValue
+		*    Value to read
+		*
+		*  @return
+		*    The current value
+		*/
+		static inline int32 Get(const volatile int32 &nValue);
+
+		/**
+		*  @brief
+		*    Full memory barrier
+		*
+		*  @remarks
+		*    Memory accesses before the barrier are completed before memory accesses after the barrier are started.
+		*/
+		static inline void FullBarrier();
+
+
+};
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+} // PLCore
+
+
+//[-------------------------------------------------------]
+//[ Implementation                                        ]
+//[-------------------------------------------------------]
+#include "PLCore/System/Atomic.inl"
+
+
+#endif // __PLCORE_ATOMIC_H__
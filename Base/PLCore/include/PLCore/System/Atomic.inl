@@ -0,0 +1,141 @@
+/*********************************************************\
+ *  File: Atomic.inl                                     *
+ *      Atomic operations inline implementation
+ *
+ *  Copyright (C) 2002-2013 The PixelLight Team (http://www.pixellight.org/)
+ *
+ *  This file is part of PixelLight.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ *  and associated documentation files (the "Software"), to deal in the Software without
+ *  restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ *  Software is furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all copies or
+ *  substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ *  BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ *  DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ *  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#ifdef WIN32
+	#include <intrin.h>
+#endif
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace PLCore {
+
+
+//[-------------------------------------------------------]
+//[ Public static functions                               ]
+//[-------------------------------------------------------]
+/**
+*  @brief
+*    Atomically increments a value
+*/
+inline int32 Atomic::Increment(volatile int32 &nValue)
+{
+	#ifdef WIN32
+		return _InterlockedIncrement(reinterpret_cast<volatile long*>(&nValue));
+	#else
+		return __sync_add_and_fetch(&nValue, 1);
+	#endif
+}
+
+/**
+*  @brief
+*    Atomically decrements a value
+*/
+inline int32 Atomic::Decrement(volatile int32 &nValue)
+{
+	#ifdef WIN32
+		return _InterlockedDecrement(reinterpret_cast<volatile long*>(&nValue));
+	#else
+		return __sync_sub_and_fetch(&nValue, 1);
+	#endif
+}
+
+/**
+*  @brief
+*    Atomically adds to a value
+*/
+inline int32 Atomic::Add(volatile int32 &nValue, int32 nAdd)
+{
+	#ifdef WIN32
+		return _InterlockedExchangeAdd(reinterpret_cast<volatile long*>(&nValue), nAdd) + nAdd;
+	#else
+		return __sync_add_and_fetch(&nValue, nAdd);
+	#endif
+}
+
+/**
+*  @brief
+*    Atomically sets a value
+*/
+inline int32 Atomic::Exchange(volatile int32 &nValue, int32 nNewValue)
+{
+	#ifdef WIN32
+		return _InterlockedExchange(reinterpret_cast<volatile long*>(&nValue), nNewValue);
+	#else
+		// "__sync_lock_test_and_set()" is only an acquire barrier, so add a full barrier
+		__sync_synchronize();
+		return __sync_lock_test_and_set(&nValue, nNewValue);
+	#endif
+}
+
+/**
+*  @brief
+*    Atomically sets a value if it's equal to a given value
+*/
+inline bool Atomic::CompareAndSwap(volatile int32 &nValue, int32 nComparand, int32 nNewValue)
+{
+	#ifdef WIN32
+		return (_InterlockedCompareExchange(reinterpret_cast<volatile long*>(&nValue), nNewValue, nComparand) == nComparand);
+	#else
+		return __sync_bool_compare_and_swap(&nValue, nComparand, nNewValue);
+	#endif
+}
+
+/**
+*  @brief
+*    Reads a value which may be written by other threads
+*/
+inline int32 Atomic::Get(const volatile int32 &nValue)
+{
+	FullBarrier();
+	const int32 nResult = nValue;
+	FullBarrier();
+	return nResult;
+}
+
+/**
+*  @brief
+*    Full memory barrier
+*/
+inline void Atomic::FullBarrier()
+{
+	#ifdef WIN32
+		// Please note that we can't call this method "MemoryBarrier()" because that's a macro within the MS Windows headers
+		_ReadWriteBarrier();
+		_mm_mfence();
+	#else
+		__sync_synchronize();
+	#endif
+}
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+} // PLCore
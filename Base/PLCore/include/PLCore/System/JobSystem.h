@@ -0,0 +1,490 @@
+/*********************************************************\
+ *  File: JobSystem.h                                    *
+ *
+ *  Copyright (C) 2002-2013 The PixelLight Team (http://www.pixellight.org/)
+ *
+ *  This file is part of PixelLight.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ *  and associated documentation files (the "Software"), to deal in the Software without
+ *  restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ *  Software is furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all copies or
+ *  substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ *  BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ *  DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ *  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+#ifndef __PLCORE_JOBSYSTEM_H__
+#define __PLCORE_JOBSYSTEM_H__
+#pragma once
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include "PLCore/Core/Singleton.h"
+#include "PLCore/Container/Array.h"
+#include "PLCore/System/Thread.h"
+#include "PLCore/System/CriticalSection.h"
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace PLCore {
+
+
+//[-------------------------------------------------------]
+//[ Forward declarations                                  ]
+//[-------------------------------------------------------]
+class Semaphore;
+class JobSystem;
+
+
+//[-------------------------------------------------------]
+//[ Data types                                            ]
+//[-------------------------------------------------------]
+typedef void (*JOBFUNCTION)(void*);								/**< Job function, receives the job data */
+typedef void (*PARALLELFORFUNCTION)(uint32, uint32, void*);		/**< Parallel for function, receives the first index, the index behind the last index and the user data */
+
+
+//[-------------------------------------------------------]
+//[ Classes                                               ]
+//[-------------------------------------------------------]
+/**
+*  @brief
+*    Job counter
+*
+*  @remarks
+*    A job counter is incremented for each job submitted with it and decremented as soon as such a job
+*    is finished. It's used to wait for a group of jobs ("JobSystem::Wait()") and to let jobs depend on
+*    the completion of other jobs.
+*
+*  @note
+*    - A job counter must stay valid until all jobs submitted with it are finished
+*/
+class JobCounter {
+
+
+	//[-------------------------------------------------------]
+	//[ Friends                                               ]
+	//[-------------------------------------------------------]
+	friend class JobSystem;
+
+
+	//[-------------------------------------------------------]
+	//[ Public functions                                      ]
+	//[-------------------------------------------------------]
+	public:
+		/**
+		*  @brief
+		*    Constructor
+		*/
+		inline JobCounter();
+
+		/**
+		*  @brief
+		*    Destructor
+		*/
+		inline ~JobCounter();
+
+		/**
+		*  @brief
+		*    Returns the number of jobs which are not finished yet
+		*
+		*  @return
+		*    Number of jobs which are not finished yet
+		*/
+		inline uint32 GetValue() const;
+
+		/**
+		*  @brief
+		*    Returns whether or not all jobs are finished
+		*
+		*  @return
+		*    'true' if all jobs are finished, else 'false'
+		*/
+		inline bool IsDone() const;
+
+
+	//[-------------------------------------------------------]
+	//[ Private functions                                     ]
+	//[-------------------------------------------------------]
+	private:
+		/**
+		*  @brief
+		*    Copy constructor
+		*
+		*  @param[in] cSource
+		*    Source to copy from
+		*/
+		JobCounter(const JobCounter &cSource);
+
+		/**
+		*  @brief
+		*    Copy operator
+		*
+		*  @param[in] cSource
+		*    Source to copy from
+		*
+		*  @return
+		*    Reference to this instance
+		*/
+		JobCounter &operator =(const JobCounter &cSource);
+
+
+	//[-------------------------------------------------------]
+	//[ Private data                                          ]
+	//[-------------------------------------------------------]
+	private:
+		volatile int32 m_nValue;	/**< Number of jobs which are not finished yet, only manipulated by using "Atomic" */
+
+
+};
+
+/**
+*  @brief
+*    Job system
+*
+*  @remarks
+*    The job system distributes small units of work ("jobs") across a number of worker threads, by default
+*    one per logical CPU core except one, because the thread waiting for the jobs is helping to execute
+*    them. Each worker has its own job queue: Jobs submitted from within a job are added to the queue of
+*    the worker executing it, jobs submitted by any other thread are added to a shared queue. A worker
+*    takes the most recently added job from its own queue (cache friendly) and if its queue is empty,
+*    it steals the oldest job from the queue of another worker or from the shared queue. Workers which
+*    don't find any work sleep until new jobs are submitted.
+*
+*    Usage example:
+*    @code
+*    JobSystem *pJobSystem = JobSystem::GetInstance();
+*    JobCounter cCounter;
+*    pJobSystem->Submit(&UpdateSomething, pSomething, &cCounter);
+*    pJobSystem->Submit(&UpdateSomethingElse, pSomethingElse, &cCounter);
+*    pJobSystem->Wait(cCounter);	// Helps executing jobs until both jobs are finished
+*    @endcode
+*
+*  @note
+*    - Jobs should be short (microseconds up to a few milliseconds) and must not block
+*    - The order in which jobs are executed is undefined, use job counters to express dependencies
+*/
+class JobSystem : public Singleton<JobSystem> {
+
+
+	//[-------------------------------------------------------]
+	//[ Friends                                               ]
+	//[-------------------------------------------------------]
+	friend class Singleton<JobSystem>;
+
+
+	//[-------------------------------------------------------]
+	//[ Public static PLCore::Singleton functions             ]
+	//[-------------------------------------------------------]
+	// This solution enhances the compatibility with legacy compilers like GCC 4.2.1 used on Mac OS X 10.6
+	// -> The C++11 feature "extern template" (C++11, see e.g. http://www2.research.att.com/~bs/C++0xFAQ.html#extern-templates) can only be used on modern compilers like GCC 4.6
+	// -> We can't break legacy compiler support, especially when only the singletons are responsible for the break
+	// -> See PLCore::Singleton for more details about singletons
+	public:
+		static PLCORE_API JobSystem *GetInstance();
+		static PLCORE_API bool HasInstance();
+
+
+	//[-------------------------------------------------------]
+	//[ Public functions                                      ]
+	//[-------------------------------------------------------]
+	public:
+		/**
+		*  @brief
+		*    Returns the number of worker threads
+		*
+		*  @return
+		*    Number of worker threads, can be 0 (in this case, jobs are executed within "Wait()")
+		*/
+		inline uint32 GetNumOfWorkers() const;
+
+		/**
+		*  @brief
+		*    Sets the number of worker threads
+		*
+		*  @param[in] nNumOfWorkers
+		*    Number of worker threads, can be 0 (in this case, jobs are executed within "Wait()")
+		*
+		*  @note
+		*    - By default, the number of logical CPU cores minus one is used
+		*    - Stops and restarts all worker threads, so don't call this method while jobs are running
+		*/
+		PLCORE_API void SetNumOfWorkers(uint32 nNumOfWorkers);
+
+		/**
+		*  @brief
+		*    Submits a job
+		*
+		*  @param[in] pFunction
+		*    Job function, must be valid
+		*  @param[in] pData
+		*    Data to pass to the job function, can be a null pointer
+		*  @param[in] pCounter
+		*    Job counter which is incremented now and decremented when the job is finished, can be a null pointer
+		*  @param[in] pDependency
+		*    Job counter which must be done before the job is started, can be a null pointer
+		*
+		*  @remarks
+		*    If the dependency is not done yet, the job is put aside and submitted as soon as the last job
+		*    of the dependency counter is finished. The dependency counter must stay valid until the job
+		*    was started.
+		*/
+		PLCORE_API void Submit(JOBFUNCTION pFunction, void *pData, JobCounter *pCounter = nullptr, JobCounter *pDependency = nullptr);
+
+		/**
+		*  @brief
+		*    Waits until all jobs of the given job counter are finished
+		*
+		*  @param[in] cCounter
+		*    Job counter to wait for
+		*
+		*  @remarks
+		*    The calling thread is executing jobs while waiting, so it's safe to wait within a job.
+		*/
+		PLCORE_API void Wait(JobCounter &cCounter);
+
+		/**
+		*  @brief
+		*    Splits an index range into jobs and waits until all of them are finished
+		*
+		*  @param[in] nNumOfElements
+		*    Number of elements to process, the function is called for sub ranges of [0, nNumOfElements)
+		*  @param[in] nGranularity
+		*    Number of elements per job, 0 to choose automatically
+		*  @param[in] pFunction
+		*    Function to call for each sub range, must be valid
+		*  @param[in] pData
+		*    Data to pass to the function, can be a null pointer
+		*
+		*  @note
+		*    - If there's only one job, the function is called directly on the calling thread
+		*/
+		PLCORE_API void ParallelFor(uint32 nNumOfElements, uint32 nGranularity, PARALLELFORFUNCTION pFunction, void *pData);
+
+
+	//[-------------------------------------------------------]
+	//[ Private definitions                                   ]
+	//[-------------------------------------------------------]
+	private:
+		/**
+		*  @brief
+		*    Job
+		*/
+		struct Job {
+			JOBFUNCTION  pFunction;	/**< Job function, always valid */
+			void		*pData;		/**< Data to pass to the job function, can be a null pointer */
+			JobCounter	*pCounter;	/**< Job counter to decrement after the job is finished, can be a null pointer */
+		};
+
+		/**
+		*  @brief
+		*    Job which is waiting for a dependency
+		*/
+		struct WaitingJob {
+			Job		    sJob;			/**< The job */
+			JobCounter *pDependency;	/**< Job counter which must be done before the job is submitted, always valid */
+			bool operator ==(const WaitingJob &sOther) const { return (sJob.pData == sOther.sJob.pData && pDependency == sOther.pDependency); }
+		};
+
+		/**
+		*  @brief
+		*    Parallel for sub range
+		*/
+		struct ParallelForRange {
+			PARALLELFORFUNCTION  pFunction;	/**< Function to call, always valid */
+			void				*pData;		/**< Data to pass to the function, can be a null pointer */
+			uint32				 nFirst;	/**< First index */
+			uint32				 nEnd;		/**< Index behind the last index */
+		};
+
+		/**
+		*  @brief
+		*    Job queue (double ended queue protected by a critical section)
+		*/
+		class JobQueue {
+			public:
+				JobQueue();
+				~JobQueue();
+				void PushBack(const Job &sJob);
+				bool PopBack(Job &sJob);
+				bool PopFront(Job &sJob);
+			private:
+				CriticalSection  m_cCriticalSection;	/**< Critical section protecting the queue */
+				Job				*m_pJobs;				/**< Ring buffer of jobs, can be a null pointer */
+				uint32			 m_nCapacity;			/**< Ring buffer capacity, always a power of two or 0 */
+				uint32			 m_nFront;				/**< Index of the first job within the ring buffer */
+				volatile uint32	 m_nNumOfJobs;			/**< Number of jobs within the queue */
+		};
+
+		/**
+		*  @brief
+		*    Worker thread
+		*/
+		class Worker : public Thread {
+			public:
+				Worker(JobSystem &cJobSystem, uint32 nQueue);
+				virtual ~Worker();
+				virtual int Run() override;
+			public:
+				JobSystem	   &m_cJobSystem;	/**< Owner job system */
+				uint32			m_nQueue;		/**< Index of the own job queue */
+				volatile handle	m_nThreadID;	/**< System ID of the worker thread, set by the worker thread itself */
+		};
+
+
+	//[-------------------------------------------------------]
+	//[ Private functions                                     ]
+	//[-------------------------------------------------------]
+	private:
+		/**
+		*  @brief
+		*    Constructor
+		*/
+		JobSystem();
+
+		/**
+		*  @brief
+		*    Copy constructor
+		*
+		*  @param[in] cSource
+		*    Source to copy from
+		*/
+		JobSystem(const JobSystem &cSource);
+
+		/**
+		*  @brief
+		*    Destructor
+		*/
+		virtual ~JobSystem();
+
+		/**
+		*  @brief
+		*    Copy operator
+		*
+		*  @param[in] cSource
+		*    Source to copy from
+		*
+		*  @return
+		*    Reference to this instance
+		*/
+		JobSystem &operator =(const JobSystem &cSource);
+
+		/**
+		*  @brief
+		*    Starts the worker threads
+		*
+		*  @param[in] nNumOfWorkers
+		*    Number of worker threads
+		*/
+		void StartWorkers(uint32 nNumOfWorkers);
+
+		/**
+		*  @brief
+		*    Stops the worker threads
+		*
+		*  @note
+		*    - Jobs which are still within the queues of the workers are moved into the shared queue
+		*/
+		void StopWorkers();
+
+		/**
+		*  @brief
+		*    Returns the index of the job queue of the calling thread
+		*
+		*  @return
+		*    Job queue index, 0 (shared queue) if the calling thread is no worker thread
+		*/
+		uint32 GetQueueOfCurrentThread() const;
+
+		/**
+		*  @brief
+		*    Adds a job to a queue and wakes up a sleeping worker
+		*
+		*  @param[in] sJob
+		*    Job to add
+		*  @param[in] nQueue
+		*    Index of the job queue to add the job to
+		*/
+		void PushJob(const Job &sJob, uint32 nQueue);
+
+		/**
+		*  @brief
+		*    Finds a job to execute
+		*
+		*  @param[in]  nQueue
+		*    Index of the own job queue, the other queues are used to steal jobs from
+		*  @param[out] sJob
+		*    Receives the found job
+		*
+		*  @return
+		*    'true' if a job was found, else 'false'
+		*/
+		bool FindJob(uint32 nQueue, Job &sJob);
+
+		/**
+		*  @brief
+		*    Executes a job
+		*
+		*  @param[in] sJob
+		*    Job to execute
+		*/
+		void ExecuteJob(const Job &sJob);
+
+		/**
+		*  @brief
+		*    Submits all waiting jobs whose dependency is done
+		*/
+		void SubmitWaitingJobs();
+
+		/**
+		*  @brief
+		*    Job function executing a parallel for sub range
+		*
+		*  @param[in] pData
+		*    Parallel for sub range, always valid
+		*/
+		static void ParallelForJob(void *pData);
+
+
+	//[-------------------------------------------------------]
+	//[ Private data                                          ]
+	//[-------------------------------------------------------]
+	private:
+		Array<JobQueue*>   m_lstQueues;					/**< Job queues, index 0 is the shared queue, index 1 + n belongs to worker n */
+		Array<Worker*>	   m_lstWorkers;				/**< Worker threads */
+		Semaphore		  *m_pWakeUpSemaphore;			/**< Semaphore sleeping workers are waiting for, can be a null pointer */
+		volatile int32	   m_nNumOfSleepingWorkers;		/**< Number of sleeping workers, only manipulated by using "Atomic" */
+		volatile int32	   m_nShutdown;					/**< Not 0 if the workers should stop, only manipulated by using "Atomic" */
+		CriticalSection	   m_cWaitingJobsCriticalSection;	/**< Critical section protecting the waiting jobs */
+		Array<WaitingJob>  m_lstWaitingJobs;			/**< Jobs waiting for a dependency */
+		volatile int32	   m_nNumOfWaitingJobs;			/**< Number of jobs waiting for a dependency, only manipulated by using "Atomic" */
+
+
+};
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+} // PLCore
+
+
+//[-------------------------------------------------------]
+//[ Implementation                                        ]
+//[-------------------------------------------------------]
+#include "PLCore/System/JobSystem.inl"
+
+
+#endif // __PLCORE_JOBSYSTEM_H__
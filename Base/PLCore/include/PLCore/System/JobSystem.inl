@@ -0,0 +1,116 @@
+/*********************************************************\
+ *  File: JobSystem.inl                                  *
+ *
+ *  Copyright (C) 2002-2013 The PixelLight Team (http://www.pixellight.org/)
+ *
+ *  This file is part of PixelLight.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ *  and associated documentation files (the "Software"), to deal in the Software without
+ *  restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ *  Software is furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all copies or
+ *  substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ *  BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ *  DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ *  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include "PLCore/System/Atomic.h"
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace PLCore {
+
+
+//[-------------------------------------------------------]
+//[ Public functions                                      ]
+//[-------------------------------------------------------]
+/**
+*  @brief
+*    Constructor
+*/
+inline JobCounter::JobCounter() :
+	m_nValue(0)
+{
+}
+
+/**
+*  @brief
+*    Destructor
+*/
+inline JobCounter::~JobCounter()
+{
+}
+
+/**
+*  @brief
+*    Returns the number of jobs which are not finished yet
+*/
+inline uint32 JobCounter::GetValue() const
+{
+	return static_cast<uint32>(Atomic::Get(m_nValue));
+}
+
+/**
+*  @brief
+*    Returns whether or not all jobs are finished
+*/
+inline bool JobCounter::IsDone() const
+{
+	return (Atomic::Get(m_nValue) == 0);
+}
+
+
+//[-------------------------------------------------------]
+//[ Private functions                                     ]
+//[-------------------------------------------------------]
+/**
+*  @brief
+*    Copy constructor
+*/
+inline JobCounter::JobCounter(const JobCounter &cSource) :
+	m_nValue(0)
+{
+	// No implementation because the copy constructor is never used
+}
+
+/**
+*  @brief
+*    Copy operator
+*/
+inline JobCounter &JobCounter::operator =(const JobCounter &cSource)
+{
+	// No implementation because the copy operator is never used
+	return *this;
+}
+
+
+//[-------------------------------------------------------]
+//[ Public functions                                      ]
+//[-------------------------------------------------------]
+/**
+*  @brief
+*    Returns the number of worker threads
+*/
+inline uint32 JobSystem::GetNumOfWorkers() const
+{
+	return m_lstWorkers.GetNumOfElements();
+}
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+} // PLCore
@@ -185,6 +185,15 @@ class System : public Singleton<System> {
 		*/
 		inline uint32 GetCPUMhz() const;
 
+		/**
+		*  @brief
+		*    Returns the number of logical CPU cores
+		*
+		*  @return
+		*    Number of logical CPU cores which are currently online, at least 1
+		*/
+		inline uint32 GetNumOfCPUs() const;
+
 		/**
 		*  @brief
 		*    Returns the name of the computer
@@ -393,6 +402,19 @@ class System : public Singleton<System> {
 		*/
 		inline Thread *GetCurrentThread() const;
 
+		/**
+		*  @brief
+		*    Returns the unique system ID of the current thread
+		*
+		*  @return
+		*    Current thread ID, same value as returned by "Thread::GetID()" of the running thread
+		*
+		*  @remarks
+		*    Unlike "GetCurrentThread()", this method is cheap and works on every platform, so it can be
+		*    used to e.g. find out on which of several known threads the caller is running.
+		*/
+		inline handle GetCurrentThreadID() const;
+
 		/**
 		*  @brief
 		*    Exit the application immediately
@@ -461,6 +483,18 @@ class System : public Singleton<System> {
 		*/
 		inline uint64 GetMicroseconds() const;
 
+		/**
+		*  @brief
+		*    Retrieves the number of nanoseconds since the system was started
+		*
+		*  @return
+		*    Number of nanoseconds elapsed since the system was started
+		*
+		*  @note
+		*    - The real resolution depends on the platform, it's usually much better than one microsecond
+		*/
+		inline uint64 GetNanoseconds() const;
+
 		/**
 		*  @brief
 		*    Suspend the current thread for a specified time period
@@ -97,6 +97,16 @@ inline uint32 System::GetCPUMhz() const
 	return m_pSystemImpl->GetCPUMhz();
 }
 
+/**
+*  @brief
+*    Returns the number of logical CPU cores
+*/
+inline uint32 System::GetNumOfCPUs() const
+{
+	// Call system function
+	return m_pSystemImpl->GetNumOfCPUs();
+}
+
 /**
 *  @brief
 *    Returns the name of the computer
@@ -265,6 +275,16 @@ inline Thread *System::GetCurrentThread() const
 	return pThread ? pThread : m_pMainThread;
 }
 
+/**
+*  @brief
+*    Returns the unique system ID of the current thread
+*/
+inline handle System::GetCurrentThreadID() const
+{
+	// Call system function
+	return m_pSystemImpl->GetCurrentThreadID();
+}
+
 /**
 *  @brief
 *    Exit the application immediately
@@ -325,6 +345,16 @@ inline uint64 System::GetMicroseconds() const
 	return m_pSystemImpl->GetMicroseconds();
 }
 
+/**
+*  @brief
+*    Retrieves the number of nanoseconds since the system was started
+*/
+inline uint64 System::GetNanoseconds() const
+{
+	// Call system function
+	return m_pSystemImpl->GetNanoseconds();
+}
+
 /**
 *  @brief
 *    Suspend the current thread for a specified time period
@@ -140,6 +140,15 @@ class SystemImpl {
 		*/
 		virtual uint32 GetCPUMhz() const = 0;
 
+		/**
+		*  @brief
+		*    Returns the number of logical CPU cores
+		*
+		*  @return
+		*    Number of logical CPU cores which are currently online, at least 1
+		*/
+		virtual uint32 GetNumOfCPUs() const = 0;
+
 		/**
 		*  @brief
 		*    Returns the name of the computer
@@ -307,6 +316,15 @@ class SystemImpl {
 		*/
 		virtual Thread *GetCurrentThread() const = 0;
 
+		/**
+		*  @brief
+		*    Returns the unique system ID of the current thread
+		*
+		*  @return
+		*    Current thread ID, same value as returned by "Thread::GetID()" of the running thread
+		*/
+		virtual handle GetCurrentThreadID() const = 0;
+
 		/**
 		*  @brief
 		*    Exit the application immediately
@@ -375,6 +393,18 @@ class SystemImpl {
 		*/
 		virtual uint64 GetMicroseconds() const = 0;
 
+		/**
+		*  @brief
+		*    Retrieves the number of nanoseconds since the system was started
+		*
+		*  @return
+		*    Number of nanoseconds elapsed since the system was started
+		*
+		*  @note
+		*    - The real resolution depends on the platform, it's usually much better than one microsecond
+		*/
+		virtual uint64 GetNanoseconds() const = 0;
+
 		/**
 		*  @brief
 		*    Suspend the current thread for a specified time period
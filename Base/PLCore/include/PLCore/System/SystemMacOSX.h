@@ -79,6 +79,7 @@ class SystemMacOSX : public SystemLinux {
 		virtual String GetPlatform() const override;
 		virtual String GetSharedLibraryExtension() const override;
 		virtual String GetExecutableFilename() const override;
+		virtual uint64 GetNanoseconds() const override;
 
 
 };
@@ -101,6 +101,7 @@ class SystemWindows : public SystemImpl {
 		virtual String GetSharedLibraryPrefix() const override;
 		virtual String GetSharedLibraryExtension() const override;
 		virtual uint32 GetCPUMhz() const override;
+		virtual uint32 GetNumOfCPUs() const override;
 		virtual String GetComputerName() const override;
 		virtual String GetUserName() const override;
 		virtual String GetUserHomeDir() const override;
@@ -116,12 +117,14 @@ class SystemWindows : public SystemImpl {
 		virtual String GetCurrentDir() const override;
 		virtual bool SetCurrentDir(const String &sPath) override;
 		virtual Thread *GetCurrentThread() const override;
+		virtual handle GetCurrentThreadID() const override;
 		virtual void Exit(int nReturn) override;
 		virtual const Console &GetConsole() const override;
 		virtual void UrgentMessage(const String &sMessage) const override;
 		virtual Time GetTime() const override;
 		virtual uint64 GetMilliseconds() const override;
 		virtual uint64 GetMicroseconds() const override;
+		virtual uint64 GetNanoseconds() const override;
 		virtual void Sleep(uint64 nMilliseconds) const override;
 		virtual void Yield() const override;
 		virtual float GetPercentageOfUsedPhysicalMemory() const override;
@@ -0,0 +1,244 @@
+/*********************************************************\
+ *  File: LoadRequest.h                                  *
+ *
+ *  Copyright (C) 2002-2013 The PixelLight Team (http://www.pixellight.org/)
+ *
+ *  This file is part of PixelLight.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ *  and associated documentation files (the "Software"), to deal in the Software without
+ *  restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ *  Software is furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all copies or
+ *  substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ *  BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ *  DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ *  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+#ifndef __PLCORE_LOADREQUEST_H__
+#define __PLCORE_LOADREQUEST_H__
+#pragma once
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include "PLCore/File/File.h"
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace PLCore {
+
+
+//[-------------------------------------------------------]
+//[ Classes                                               ]
+//[-------------------------------------------------------]
+/**
+*  @brief
+*    Abstract asynchronous load request
+*
+*  @remarks
+*    A load request is given to "LoadableManager::LoadAsync()" and is processed in three steps:
+*    - The file is opened by using the base directories and read completely into memory by the
+*      background I/O thread of the loadable manager
+*    - "OnDecode()" is called by a worker thread of the job system (or by the I/O thread if there
+*      are no workers) and can be used to decode the read data without blocking the owning thread
+*    - "OnFinalize()" is called by the owning thread within "LoadableManager::UpdateAsync()", this is
+*      the place to e.g. create renderer resources which can't be created by other threads
+*    Queued requests with a higher priority are read first, and loaded requests with a higher priority
+*    are finalized first.
+*
+*  @note
+*    - The request is destroyed by the loadable manager within "LoadableManager::UpdateAsync()" after
+*      it has been finalized, has failed or has been canceled
+*/
+class LoadRequest {
+
+
+	//[-------------------------------------------------------]
+	//[ Friends                                               ]
+	//[-------------------------------------------------------]
+	friend class LoadableManager;
+
+
+	//[-------------------------------------------------------]
+	//[ Public definitions                                    ]
+	//[-------------------------------------------------------]
+	public:
+		/**
+		*  @brief
+		*    Load request state
+		*/
+		enum EState {
+			Queued   = 0,	/**< Waiting to be read by the I/O thread */
+			Loading  = 1,	/**< The file is read or the read data is decoded */
+			Loaded   = 2,	/**< Waiting to be finalized by the owning thread */
+			Finished = 3,	/**< Finalized successfully */
+			Failed   = 4,	/**< Reading, decoding or finalizing failed */
+			Canceled = 5	/**< Canceled */
+		};
+
+
+	//[-------------------------------------------------------]
+	//[ Public functions                                      ]
+	//[-------------------------------------------------------]
+	public:
+		/**
+		*  @brief
+		*    Constructor
+		*
+		*  @param[in] sFilename
+		*    Name of the file to load, relative filenames are resolved by using the base directories of the loadable manager
+		*  @param[in] fPriority
+		*    Load priority, requests with a higher priority are processed first (e.g. the negative distance to the camera)
+		*/
+		PLCORE_API LoadRequest(const String &sFilename, float fPriority = 0.0f);
+
+		/**
+		*  @brief
+		*    Destructor
+		*/
+		PLCORE_API virtual ~LoadRequest();
+
+		/**
+		*  @brief
+		*    Returns the name of the file to load
+		*
+		*  @return
+		*    Name of the file to load
+		*/
+		inline String GetFilename() const;
+
+		/**
+		*  @brief
+		*    Returns the load priority
+		*
+		*  @return
+		*    Load priority, requests with a higher priority are processed first
+		*
+		*  @see
+		*    - "LoadableManager::SetAsyncPriority()"
+		*/
+		inline float GetPriority() const;
+
+		/**
+		*  @brief
+		*    Returns the current state of the request
+		*
+		*  @return
+		*    The current state of the request
+		*/
+		inline EState GetState() const;
+
+		/**
+		*  @brief
+		*    Returns the memory buffered file containing the read data
+		*
+		*  @return
+		*    The memory buffered file, only opened within "OnDecode()" and "OnFinalize()"
+		*/
+		inline File &GetFile();
+
+
+	//[-------------------------------------------------------]
+	//[ Protected virtual LoadRequest functions               ]
+	//[-------------------------------------------------------]
+	protected:
+		/**
+		*  @brief
+		*    Decodes the read data
+		*
+		*  @return
+		*    'true' if all went fine, else 'false'
+		*
+		*  @note
+		*    - Called by a worker thread, don't access objects owned by other threads in here
+		*    - The default implementation does nothing and returns 'true'
+		*/
+		PLCORE_API virtual bool OnDecode();
+
+		/**
+		*  @brief
+		*    Finalizes the request
+		*
+		*  @return
+		*    'true' if all went fine, else 'false'
+		*
+		*  @note
+		*    - Called by the owning thread within "LoadableManager::UpdateAsync()"
+		*/
+		virtual bool OnFinalize() = 0;
+
+		/**
+		*  @brief
+		*    Called when the file can't be read or decoding or finalizing failed
+		*
+		*  @note
+		*    - Called by the owning thread within "LoadableManager::UpdateAsync()"
+		*    - The default implementation writes an error into the log
+		*/
+		PLCORE_API virtual void OnFailure();
+
+
+	//[-------------------------------------------------------]
+	//[ Private functions                                     ]
+	//[-------------------------------------------------------]
+	private:
+		/**
+		*  @brief
+		*    Copy constructor
+		*
+		*  @param[in] cSource
+		*    Source to copy from
+		*/
+		LoadRequest(const LoadRequest &cSource);
+
+		/**
+		*  @brief
+		*    Copy operator
+		*
+		*  @param[in] cSource
+		*    Source to copy from
+		*
+		*  @return
+		*    Reference to this instance
+		*/
+		LoadRequest &operator =(const LoadRequest &cSource);
+
+
+	//[-------------------------------------------------------]
+	//[ Private data                                          ]
+	//[-------------------------------------------------------]
+	private:
+		String			 m_sFilename;	/**< Name of the file to load */
+		float			 m_fPriority;	/**< Load priority */
+		volatile EState	 m_nState;		/**< Current state, only changed by the loadable manager while holding its async critical section */
+		bool			 m_bCanceled;	/**< Was the request canceled while it was loading? */
+		File			 m_cFile;		/**< Memory buffered file containing the read data */
+
+
+};
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+} // PLCore
+
+
+//[-------------------------------------------------------]
+//[ Implementation                                        ]
+//[-------------------------------------------------------]
+#include "PLCore/Tools/LoadRequest.inl"
+
+
+#endif // __PLCORE_LOADREQUEST_H__
@@ -34,6 +34,10 @@
 #include "PLCore/Core/Singleton.h"
 #include "PLCore/Container/Array.h"
 #include "PLCore/Container/HashMap.h"
+#include "PLCore/File/FileIndex.h"
+#include "PLCore/Tools/LoadRequest.h"
+#include "PLCore/System/JobSystem.h"
+#include "PLCore/System/CriticalSection.h"
 #include "PLCore/Base/Event/EventHandler.h"
 
 
@@ -48,6 +52,7 @@ namespace PLCore {
 //[-------------------------------------------------------]
 class Class;
 class Loader;
+class Semaphore;
 class Directory;
 class LoadableType;
 class LoadableManager;
@@ -75,9 +80,19 @@ class LoadableManager;
 *    -> By asking the loadable manager which 'file formats/extensions' are supported for the 'Mesh' type,
 *       it will return in this example 'mesh, 3ds. obj'. One loader can also support multiple formats.
 *
+*    Relative filenames are resolved by using the base directories. In order to avoid searching each ZIP-file base
+*    directory, the loadable manager builds a file index (see "FileIndex") of all files within the ZIP-file base
+*    directories as soon as it's required. If the file index knows a file, only the base directory the file is in and
+*    regular base directories with a higher priority have to be checked, files within ZIP-files are opened without
+*    searching the ZIP-file. If the file index doesn't know a file, only regular base directories are checked. Files
+*    found within regular base directories are remembered as well. The file index is rebuilt after the base directories
+*    were changed, if ZIP-files were changed by other means than the loadable manager, call "InvalidateFileIndex()".
+*
 *  @note
 *    - An empty string is also a valid base directory and represents the current system directory
 *      (see System::GetCurrentDir())
+*    - Regular base directories are not indexed, they're always checked through the file system so files created
+*      later on can be found
 */
 class LoadableManager : public Singleton<LoadableManager> {
 
@@ -360,7 +375,7 @@ class LoadableManager : public Singleton<LoadableManager> {
 		*  @return
 		*    'true', if all went fine, else 'false'
 		*/
-		inline bool ClearBaseDirs();
+		PLCORE_API bool ClearBaseDirs();
 
 		/**
 		*  @brief
@@ -381,6 +396,35 @@ class LoadableManager : public Singleton<LoadableManager> {
 		*/
 		PLCORE_API String GetRelativeFilename(const String &sFilename);
 
+		/**
+		*  @brief
+		*    Returns whether or not the file index is used to resolve relative filenames
+		*
+		*  @return
+		*    'true' if the file index is used, else 'false'
+		*/
+		PLCORE_API bool GetUseFileIndex() const;
+
+		/**
+		*  @brief
+		*    Sets whether or not the file index is used to resolve relative filenames
+		*
+		*  @param[in] bUseFileIndex
+		*    'true' if the file index should be used (default), else 'false' (each base directory is checked through the file system)
+		*/
+		PLCORE_API void SetUseFileIndex(bool bUseFileIndex = true);
+
+		/**
+		*  @brief
+		*    Invalidates the file index
+		*
+		*  @remarks
+		*    The file index is rebuilt as soon as it's required the next time. This is done automatically when the base
+		*    directories are changed, call this function when ZIP-files within the base directories were created, changed or
+		*    deleted by other means than the loadable manager.
+		*/
+		PLCORE_API void InvalidateFileIndex();
+
 		/**
 		*  @brief
 		*    Scan a directory for data packages and add them as base paths to the loadable manager
@@ -452,6 +496,76 @@ class LoadableManager : public Singleton<LoadableManager> {
 		*/
 		PLCORE_API String LoadStringFromFile(const String &sFilename, String::EFormat nStringFormat = String::ASCII) const;
 
+		/**
+		*  @brief
+		*    Adds an asynchronous load request
+		*
+		*  @param[in] pRequest
+		*    Request to add, if a null pointer nothing happens, the loadable manager takes over the control and destroys the request within "UpdateAsync()"
+		*
+		*  @return
+		*    'true' if all went fine, else 'false' (the request is destroyed at once)
+		*
+		*  @remarks
+		*    The file of the request is read by a background I/O thread which is started as soon as the first request
+		*    is added. The read data is decoded by a worker thread of the job system and the request is finalized by
+		*    the thread calling "UpdateAsync()", usually once per frame.
+		*
+		*  @note
+		*    - The base directories should not be changed while there are requests which are not loaded yet
+		*    - Thread safe, the background I/O thread is started only once
+		*/
+		PLCORE_API bool LoadAsync(LoadRequest *pRequest);
+
+		/**
+		*  @brief
+		*    Cancels an asynchronous load request
+		*
+		*  @param[in] cRequest
+		*    Request to cancel, must have been added by using "LoadAsync()" and must not be destroyed yet
+		*
+		*  @note
+		*    - "OnFinalize()" and "OnFailure()" of a canceled request are never called, the request is destroyed within the next "UpdateAsync()"
+		*    - A request which is currently loading is canceled as soon as the I/O or worker thread is done with it
+		*/
+		PLCORE_API void CancelAsync(LoadRequest &cRequest);
+
+		/**
+		*  @brief
+		*    Sets the priority of an asynchronous load request
+		*
+		*  @param[in] cRequest
+		*    Request to change, must have been added by using "LoadAsync()" and must not be destroyed yet
+		*  @param[in] fPriority
+		*    New load priority, requests with a higher priority are processed first
+		*/
+		PLCORE_API void SetAsyncPriority(LoadRequest &cRequest, float fPriority);
+
+		/**
+		*  @brief
+		*    Returns the number of asynchronous load requests which are not destroyed yet
+		*
+		*  @return
+		*    Number of asynchronous load requests which are not destroyed yet
+		*/
+		PLCORE_API uint32 GetNumOfAsyncRequests() const;
+
+		/**
+		*  @brief
+		*    Finalizes loaded asynchronous load requests and destroys finished, failed and canceled ones
+		*
+		*  @param[in] nTimeBudget
+		*    Maximum time in milliseconds to spend within this function, 0 for no limit (at least one request is always finalized)
+		*
+		*  @return
+		*    Number of destroyed requests
+		*
+		*  @note
+		*    - Must be called by the thread owning the objects the requests are loaded into, usually once per frame
+		*    - Loaded requests with a higher priority are finalized first
+		*/
+		PLCORE_API uint32 UpdateAsync(uint64 nTimeBudget = 0);
+
 
 	//[-------------------------------------------------------]
 	//[ Protected functions                                   ]
@@ -515,6 +629,154 @@ class LoadableManager : public Singleton<LoadableManager> {
 		*/
 		PLCORE_API void RegisterClasses();
 
+		/**
+		*  @brief
+		*    Must be called after the base directories were changed
+		*
+		*  @note
+		*    - "m_cBaseDirMutex" must be locked
+		*/
+		void OnBaseDirsChanged();
+
+		/**
+		*  @brief
+		*    Returns a snapshot of the base directories and uses the file index to find out which of them have to be checked for a relative filename
+		*
+		*  @param[in]  sFilename
+		*    Relative filename
+		*  @param[in]  bFileIndex
+		*    Use the file index (if it's enabled)?
+		*  @param[out] lstBaseDirs
+		*    Receives the base directories
+		*  @param[out] lstCheckBaseDirs
+		*    Receives for each base directory whether or not it has to be checked through the file system, only valid if 'true' is returned
+		*  @param[out] cEntry
+		*    Receives the file index entry of the file, 'm_nDirectory' is the number of base directories if the file is not within the file index,
+		*    only valid if 'true' is returned
+		*  @param[out] nRevision
+		*    Receives the revision of the base directories
+		*
+		*  @return
+		*    'true' if the file index was used, else 'false' (all base directories have to be checked)
+		*
+		*  @note
+		*    - Rebuilds the file index if required
+		*    - Thread safe, the base directories may be changed while the snapshot is used
+		*/
+		bool GetBaseDirs(const String &sFilename, bool bFileIndex, Array<String> &lstBaseDirs, Array<bool> &lstCheckBaseDirs, FileIndex::Entry &cEntry, uint32 &nRevision) const;
+
+		/**
+		*  @brief
+		*    Tries to find or create a file within a base directory
+		*
+		*  @param[out] cFile
+		*    Receives the file
+		*  @param[in]  sBaseDir
+		*    Base directory to check
+		*  @param[in]  nBaseDir
+		*    Number of the base directory
+		*  @param[in]  nRevision
+		*    Revision of the base directories the number belongs to
+		*  @param[in]  sFilename
+		*    Relative filename
+		*  @param[in]  pEntry
+		*    File index entry of the file within this base directory, can be a null pointer
+		*  @param[in]  bCreate
+		*    Create the file if it doesn't exist?
+		*
+		*  @return
+		*    'true' if the file was found or created, else 'false'
+		*/
+		bool OpenBaseDirFile(File &cFile, const String &sBaseDir, uint32 nBaseDir, uint32 nRevision, const String &sFilename, const FileIndex::Entry *pEntry, bool bCreate) const;
+
+		/**
+		*  @brief
+		*    Adds a file which was found or created within a base directory to the file index
+		*
+		*  @param[in] sFilename
+		*    Relative filename
+		*  @param[in] nBaseDir
+		*    Number of the base directory the file is in
+		*  @param[in] nRevision
+		*    Revision of the base directories the number belongs to, if the base directories were changed in the meantime nothing happens
+		*
+		*  @note
+		*    - An existing entry of the file is only replaced if the given base directory has a higher priority
+		*/
+		void AddToFileIndex(const String &sFilename, uint32 nBaseDir, uint32 nRevision) const;
+
+		/**
+		*  @brief
+		*    Removes an out-of-date file from the file index
+		*
+		*  @param[in] sFilename
+		*    Relative filename
+		*  @param[in] nBaseDir
+		*    Number of the base directory the file index told us the file is in
+		*  @param[in] nRevision
+		*    Revision of the base directories the number belongs to, if the base directories were changed in the meantime nothing happens
+		*/
+		void RemoveFromFileIndex(const String &sFilename, uint32 nBaseDir, uint32 nRevision) const;
+
+		/**
+		*  @brief
+		*    Returns whether or not an asynchronous load request was canceled while it's loading
+		*
+		*  @param[in] cRequest
+		*    Request in the loading state
+		*
+		*  @return
+		*    'true' if the request was canceled, else 'false'
+		*/
+		bool IsAsyncCanceled(const LoadRequest &cRequest) const;
+
+		/**
+		*  @brief
+		*    Background I/O thread function
+		*
+		*  @param[in] pData
+		*    Loadable manager instance, always valid
+		*
+		*  @return
+		*    Thread exit code
+		*/
+		static int AsyncThreadFunction(void *pData);
+
+		/**
+		*  @brief
+		*    Decode job function
+		*
+		*  @param[in] pData
+		*    Load request to decode, always valid
+		*/
+		static void AsyncDecodeJob(void *pData);
+
+		/**
+		*  @brief
+		*    Reads the file of an asynchronous load request and decodes the read data
+		*
+		*  @param[in] cRequest
+		*    Request to read, must be in the loading state
+		*
+		*  @note
+		*    - Called by the background I/O thread
+		*/
+		void ReadAsync(LoadRequest &cRequest);
+
+		/**
+		*  @brief
+		*    Ends the loading state of an asynchronous load request
+		*
+		*  @param[in] cRequest
+		*    Request in the loading state
+		*  @param[in] bSuccess
+		*    Was the request loaded successfully?
+		*
+		*  @note
+		*    - Called by the background I/O thread or by a worker thread
+		*/
+		void EndAsyncLoading(LoadRequest &cRequest, bool bSuccess);
+
 
 	//[-------------------------------------------------------]
 	//[ Private slots                                         ]
@@ -531,13 +793,27 @@ class LoadableManager : public Singleton<LoadableManager> {
 		// General
 		Array<LoadableType*>			m_lstTypes;				/**< List of loadable types */
 		HashMap<String, LoadableType*>	m_mapTypes;				/**< Map of loadable types */
-		Array<String>					m_lstBaseDirs;			/**< List of base directories */
 		Array<const Class*>				m_lstNewClasses;		/**< New classes to register as soon as required */
 		// Filled by LoadableType
 		Array<Loader*>					m_lstLoaders;			/**< List of loaders */
 		HashMap<String, Loader*>		m_mapLoaders;			/**< Map of loaders (key = extension) */
 		Array<String>					m_lstFormats;			/**< List of loadable formats */
 		HashMap<String, LoadableType*>	m_mapTypesByExtension;	/**< Map of loadable types (key = extension) */
+		// Base directories and file index, the file index is build on demand by the const functions resolving relative filenames
+		Array<String>					m_lstBaseDirs;			/**< List of base directories */
+		uint32							m_nBaseDirRevision;		/**< Revision of the base directories, increased each time they're changed */
+		bool							m_bUseFileIndex;		/**< Use the file index? */
+		mutable bool					m_bFileIndexValid;		/**< Is the file index up-to-date? */
+		mutable FileIndex				m_cFileIndex;			/**< File index of all indexed base directories */
+		mutable Array<bool>				m_lstIndexedBaseDirs;	/**< Is the base directory with the same number within the file index? */
+		mutable CriticalSection			m_cBaseDirMutex;		/**< Critical section protecting the base directories and the file index, the base directories are only changed by the owning thread */
+		// Asynchronous loading
+		Array<LoadRequest*>				m_lstAsyncRequests;		/**< List of all asynchronous load requests which are not destroyed yet */
+		mutable CriticalSection			m_cAsyncMutex;			/**< Critical section protecting the asynchronous load requests */
+		Thread						   *m_pAsyncThread;			/**< Background I/O thread, can be a null pointer */
+		Semaphore					   *m_pAsyncSemaphore;		/**< Semaphore waking up the background I/O thread, can be a null pointer */
+		volatile int32					m_nAsyncShutdown;		/**< Not 0 if the background I/O thread should stop, only manipulated by using "Atomic" */
+		JobCounter						m_cAsyncJobCounter;		/**< Counter of the submitted decode jobs */
 
 
 };
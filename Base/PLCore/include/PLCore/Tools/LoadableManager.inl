@@ -140,19 +140,6 @@ inline String LoadableManager::GetBaseDir(uint32 nNum) const
 	return m_lstBaseDirs[nNum];
 }
 
-/**
-*  @brief
-*    Removes all base directories
-*/
-inline bool LoadableManager::ClearBaseDirs()
-{
-	// Delete all base dirs
-	m_lstBaseDirs.Clear();
-
-	// Done
-	return true;
-}
-
 
 //[-------------------------------------------------------]
 //[ Namespace                                             ]
@@ -0,0 +1,584 @@
+/*********************************************************\
+ *  File: Profiler.h                                     *
+ *
+ *  Copyright (C) 2002-2013 The PixelLight Team (http://www.pixellight.org/)
+ *
+ *  This file is part of PixelLight.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ *  and associated documentation files (the "Software"), to deal in the Software without
+ *  restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ *  Software is furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all copies or
+ *  substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ *  BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ *  DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ *  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+#ifndef __PLCORE_PROFILER_H__
+#define __PLCORE_PROFILER_H__
+#pragma once
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include "PLCore/Core/Singleton.h"
+#include "PLCore/Container/Array.h"
+#include "PLCore/System/CriticalSection.h"
+
+
+//[-------------------------------------------------------]
+//[ Macros                                                ]
+//[-------------------------------------------------------]
+// Define "PLCORE_NO_PROFILER" to remove all instrumentation from the code (the profiler itself is still available)
+#ifdef PLCORE_NO_PROFILER
+	#define PL_PROFILE_ZONE(Name)
+	#define PL_PROFILE_FRAME()
+	#define PL_PROFILE_COUNTER(Name, Value)
+#else
+	#define PL_PROFILE_CONCATENATE_INTERNAL(A, B) A##B
+	#define PL_PROFILE_CONCATENATE(A, B) PL_PROFILE_CONCATENATE_INTERNAL(A, B)
+
+	/**
+	*  @brief
+	*    Records a zone reaching from this line to the end of the current scope
+	*
+	*  @param[in] Name
+	*    Zone name, must be a string literal (the profiler only stores the pointer)
+	*/
+	#define PL_PROFILE_ZONE(Name) const PLCore::ProfilerZone PL_PROFILE_CONCATENATE(cProfilerZone, __LINE__)(Name)
+
+	/**
+	*  @brief
+	*    Records a frame marker, usually done once per frame by the main thread
+	*/
+	#define PL_PROFILE_FRAME() do { PLCore::Profiler *pProfiler_ = PLCore::Profiler::GetRecordingInstance(); if (pProfiler_) pProfiler_->MarkFrame(); } while (0)
+
+	/**
+	*  @brief
+	*    Records the current value of a counter
+	*
+	*  @param[in] Name
+	*    Counter name, must be a string literal (the profiler only stores the pointer)
+	*  @param[in] Value
+	*    Current counter value
+	*/
+	#define PL_PROFILE_COUNTER(Name, Value) do { PLCore::Profiler *pProfiler_ = PLCore::Profiler::GetRecordingInstance(); if (pProfiler_) pProfiler_->SetCounter(Name, static_cast<double>(Value)); } while (0)
+#endif
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace PLCore {
+
+
+//[-------------------------------------------------------]
+//[ Classes                                               ]
+//[-------------------------------------------------------]
+/**
+*  @brief
+*    Hierarchical, thread aware instrumentation profiler
+*
+*  @remarks
+*    The code is instrumented with the macros "PL_PROFILE_ZONE()" (nested, scoped zones),
+*    "PL_PROFILE_COUNTER()" and "PL_PROFILE_FRAME()". Each event is recorded together with a nanosecond
+*    timestamp into a ring buffer owned by the recording thread, so recording threads never have to lock a
+*    mutex or to wait for each other. The ring buffers are drained by "Collect()" which is automatically
+*    called when a frame marker is recorded.
+*
+*    The collected data is used in two ways:
+*    - The zone times and counter values of the last frame are written into the "Profiler zones"
+*      and "Profiler counters" groups of "Profiling", so they show up within the usual profiling text view
+*    - While capturing is enabled, all events are kept so they can be exported into the Chrome trace
+*      JSON format ("ExportChromeTrace()"), which can be inspected offline using "chrome://tracing"
+*
+*    Usage example:
+*    @code
+*    void MyClass::Update()
+*    {
+*        PL_PROFILE_ZONE("MyClass::Update");
+*        ...
+*        PL_PROFILE_COUNTER("Number of updated objects", nNumOfObjects);
+*    }
+*    @endcode
+*
+*  @note
+*    - The profiler is disabled by default, in this case an instrumentation macro only costs one check
+*    - Zone and counter names must be string literals (or at least be valid until the data was collected and exported)
+*    - When a ring buffer is full, new events are dropped ("GetNumOfDroppedEvents()"), zones are never left half recorded
+*/
+class Profiler : public Singleton<Profiler> {
+
+
+	//[-------------------------------------------------------]
+	//[ Friends                                               ]
+	//[-------------------------------------------------------]
+	friend class Singleton<Profiler>;
+
+
+	//[-------------------------------------------------------]
+	//[ Public definitions                                    ]
+	//[-------------------------------------------------------]
+	public:
+		static const uint32 MaxZoneDepth = 64;	/**< Maximum zone nesting depth per thread, deeper zones are dropped */
+
+		/**
+		*  @brief
+		*    Event type
+		*/
+		enum EEventType {
+			ZoneBegin = 0,	/**< Begin of a zone */
+			ZoneEnd   = 1,	/**< End of a zone */
+			Frame     = 2,	/**< Frame marker */
+			Counter   = 3	/**< Counter value */
+		};
+
+		/**
+		*  @brief
+		*    Recorded event
+		*/
+		struct Event {
+			uint64		nTimestamp;	/**< Timestamp in nanoseconds */
+			double		dValue;		/**< Counter value, only used by counter events */
+			const char *pszName;	/**< Zone or counter name, a null pointer for zone ends and frame markers */
+			uint32		nType;		/**< Event type (see "EEventType") */
+			uint32		nThread;	/**< Index of the recording thread */
+
+			bool operator ==(const Event &sEvent) const
+			{
+				return (nTimestamp == sEvent.nTimestamp && nType == sEvent.nType && nThread == sEvent.nThread);
+			}
+		};
+
+
+	//[-------------------------------------------------------]
+	//[ Public static PLCore::Singleton functions             ]
+	//[-------------------------------------------------------]
+	// This solution enhances the compatibility with legacy compilers like GCC 4.2.1 used on Mac OS X 10.6
+	// -> The C++11 feature "extern template" (C++11, see e.g. http://www2.research.att.com/~bs/C++0xFAQ.html#extern-templates) can only be used on modern compilers like GCC 4.6
+	// -> We can't break legacy compiler support, especially when only the singletons are responsible for the break
+	// -> See PLCore::Singleton for more details about singletons
+	public:
+		static PLCORE_API Profiler *GetInstance();
+		static PLCORE_API bool HasInstance();
+
+
+	//[-------------------------------------------------------]
+	//[ Public static functions                               ]
+	//[-------------------------------------------------------]
+	public:
+		/**
+		*  @brief
+		*    Returns the profiler instance if it's currently recording
+		*
+		*  @return
+		*    The profiler instance, a null pointer if there's no instance or if it's disabled
+		*
+		*  @note
+		*    - Unlike "GetInstance()", this function never creates the profiler instance, so it's safe to be
+		*      used by instrumentation within any thread
+		*/
+		static inline Profiler *GetRecordingInstance();
+
+
+	//[-------------------------------------------------------]
+	//[ Public functions                                      ]
+	//[-------------------------------------------------------]
+	public:
+		/**
+		*  @brief
+		*    Returns whether or not the profiler is recording
+		*
+		*  @return
+		*    'true' if the profiler is recording, else 'false'
+		*/
+		inline bool IsEnabled() const;
+
+		/**
+		*  @brief
+		*    Sets whether or not the profiler is recording
+		*
+		*  @param[in] bEnabled
+		*    'true' if the profiler should record, else 'false'
+		*/
+		PLCORE_API void SetEnabled(bool bEnabled = true);
+
+		/**
+		*  @brief
+		*    Returns the size of the ring buffer of a thread
+		*
+		*  @return
+		*    The number of events a ring buffer of a thread can hold
+		*/
+		inline uint32 GetThreadBufferSize() const;
+
+		/**
+		*  @brief
+		*    Sets the size of the ring buffer of a thread
+		*
+		*  @param[in] nNumOfEvents
+		*    The number of events a ring buffer of a thread can hold, is rounded up to a power of two
+		*
+		*  @note
+		*    - Only threads which record their first event after this call are using the new size
+		*/
+		PLCORE_API void SetThreadBufferSize(uint32 nNumOfEvents = 16384);
+
+		/**
+		*  @brief
+		*    Sets the name of the calling thread
+		*
+		*  @param[in] sName
+		*    Name of the calling thread, used by the exported trace
+		*/
+		PLCORE_API void SetThreadName(const String &sName);
+
+		/**
+		*  @brief
+		*    Records the begin of a zone within the calling thread
+		*
+		*  @param[in] pszName
+		*    Zone name, must stay valid (see class remarks)
+		*
+		*  @note
+		*    - Each call must be followed by a call of "EndZone()" within the same thread, use "PL_PROFILE_ZONE()" or "ProfilerZone"
+		*/
+		PLCORE_API void BeginZone(const char *pszName);
+
+		/**
+		*  @brief
+		*    Records the end of the current zone of the calling thread
+		*/
+		PLCORE_API void EndZone();
+
+		/**
+		*  @brief
+		*    Records the current value of a counter within the calling thread
+		*
+		*  @param[in] pszName
+		*    Counter name, must stay valid (see class remarks)
+		*  @param[in] dValue
+		*    Current counter value
+		*/
+		PLCORE_API void SetCounter(const char *pszName, double dValue);
+
+		/**
+		*  @brief
+		*    Records a frame marker and collects the recorded data
+		*
+		*  @remarks
+		*    If "Profiling" is active, the zone and counter statistics of the last frame are written into
+		*    its "Profiler zones" and "Profiler counters" groups.
+		*
+		*  @note
+		*    - Frame markers should be recorded by one thread only (usually the main thread, see "Timing::Update()")
+		*/
+		PLCORE_API void MarkFrame();
+
+		/**
+		*  @brief
+		*    Collects the recorded data of all threads
+		*
+		*  @remarks
+		*    Drains the ring buffers of all threads, updates the zone and counter statistics and adds the
+		*    events to the capture if capturing is enabled. Call this function from time to time if no
+		*    frame markers are recorded, else the ring buffers run full.
+		*/
+		PLCORE_API void Collect();
+
+		/**
+		*  @brief
+		*    Returns the number of events which were dropped because a ring buffer was full
+		*
+		*  @return
+		*    The number of dropped events
+		*/
+		PLCORE_API uint32 GetNumOfDroppedEvents() const;
+
+		/**
+		*  @brief
+		*    Returns whether or not collected events are captured
+		*
+		*  @return
+		*    'true' if collected events are captured, else 'false'
+		*/
+		inline bool IsCapturing() const;
+
+		/**
+		*  @brief
+		*    Sets whether or not collected events are captured
+		*
+		*  @param[in] bCapturing
+		*    'true' if collected events should be captured, else 'false'
+		*/
+		inline void SetCapturing(bool bCapturing = true);
+
+		/**
+		*  @brief
+		*    Returns the captured events
+		*
+		*  @return
+		*    The captured events, ordered by thread and time within a thread
+		*/
+		inline const Array<Event> &GetCapture() const;
+
+		/**
+		*  @brief
+		*    Removes all captured events
+		*/
+		PLCORE_API void ClearCapture();
+
+		/**
+		*  @brief
+		*    Exports the captured events in the Chrome trace JSON format
+		*
+		*  @param[in] sFilename
+		*    Name of the file to write
+		*
+		*  @return
+		*    'true' if all went fine, else 'false'
+		*/
+		PLCORE_API bool ExportChromeTrace(const String &sFilename) const;
+
+
+	//[-------------------------------------------------------]
+	//[ Private definitions                                   ]
+	//[-------------------------------------------------------]
+	private:
+		/**
+		*  @brief
+		*    Ring buffer of a thread
+		*
+		*  @remarks
+		*    The ring buffer is written by the owning thread only and read by the thread calling "Collect()"
+		*    only, so the read and write positions are the only shared data and atomic operations are sufficient.
+		*/
+		struct ThreadBuffer {
+			// Shared data
+			Event		   *pEvents;			/**< Ring buffer, always valid */
+			uint32			nMask;				/**< Size of the ring buffer minus one, the size is a power of two */
+			volatile int32	nWrite;				/**< Number of written events, updated by the owning thread */
+			volatile int32	nRead;				/**< Number of read events, updated by the collecting thread */
+			volatile int32	nNumOfDropped;		/**< Number of dropped events */
+			uint32			nThread;			/**< Index of the thread */
+			String			sName;				/**< Name of the thread */
+			// Data of the owning thread
+			uint32			nDepth;				/**< Current zone depth */
+			uint32			nNumOfOpenZones;	/**< Number of recorded zones without a recorded end */
+			uint64			nDroppedZones;		/**< Bit 'n' is set if the zone at depth 'n' was dropped */
+			// Data of the collecting thread
+			uint32			nCollectDepth;					/**< Current zone depth */
+			uint64			nZoneStart[MaxZoneDepth];		/**< Timestamps of the current zones */
+			const char	   *pszZoneName[MaxZoneDepth];		/**< Names of the current zones */
+		};
+
+		/**
+		*  @brief
+		*    Zone or counter statistics
+		*/
+		struct Statistics {
+			const char *pszName;	/**< Zone or counter name */
+			uint32		nType;		/**< "ZoneBegin" for zones, "Counter" for counters */
+			uint32		nCalls;		/**< Number of zone calls since the last frame */
+			uint64		nTime;		/**< Total zone time since the last frame in nanoseconds */
+			uint64		nMaxTime;	/**< Maximum zone time since the last frame in nanoseconds */
+			double		dValue;		/**< Last counter value */
+
+			bool operator ==(const Statistics &sStatistics) const
+			{
+				return (pszName == sStatistics.pszName && nType == sStatistics.nType);
+			}
+		};
+
+
+	//[-------------------------------------------------------]
+	//[ Private functions                                     ]
+	//[-------------------------------------------------------]
+	private:
+		/**
+		*  @brief
+		*    Constructor
+		*/
+		Profiler();
+
+		/**
+		*  @brief
+		*    Copy constructor
+		*
+		*  @param[in] cSource
+		*    Source to copy from
+		*/
+		Profiler(const Profiler &cSource);
+
+		/**
+		*  @brief
+		*    Destructor
+		*/
+		virtual ~Profiler();
+
+		/**
+		*  @brief
+		*    Copy operator
+		*
+		*  @param[in] cSource
+		*    Source to copy from
+		*
+		*  @return
+		*    Reference to this instance
+		*/
+		Profiler &operator =(const Profiler &cSource);
+
+		/**
+		*  @brief
+		*    Returns the ring buffer of the calling thread
+		*
+		*  @return
+		*    The ring buffer of the calling thread, created on the first call within a thread
+		*/
+		ThreadBuffer &GetThreadBuffer();
+
+		/**
+		*  @brief
+		*    Writes an event into the ring buffer of the calling thread
+		*
+		*  @param[in] cThreadBuffer
+		*    Ring buffer of the calling thread
+		*  @param[in] nType
+		*    Event type
+		*  @param[in] pszName
+		*    Zone or counter name, can be a null pointer
+		*  @param[in] dValue
+		*    Counter value
+		*  @param[in] nReserve
+		*    Number of ring buffer entries which must stay free after writing this event
+		*
+		*  @return
+		*    'true' if the event was written, 'false' if the ring buffer is full
+		*/
+		bool Write(ThreadBuffer &cThreadBuffer, EEventType nType, const char *pszName, double dValue, uint32 nReserve);
+
+		/**
+		*  @brief
+		*    Returns the statistics of a zone or counter
+		*
+		*  @param[in] pszName
+		*    Zone or counter name
+		*  @param[in] nType
+		*    "ZoneBegin" for zones, "Counter" for counters
+		*
+		*  @return
+		*    The statistics, created if required
+		*/
+		Statistics &GetStatistics(const char *pszName, EEventType nType);
+
+		/**
+		*  @brief
+		*    Writes the statistics of the last frame into "Profiling" and resets them
+		*/
+		void PublishStatistics();
+
+
+	//[-------------------------------------------------------]
+	//[ Private data                                          ]
+	//[-------------------------------------------------------]
+	private:
+		bool					m_bEnabled;				/**< Is the profiler recording? */
+		bool					m_bCapturing;			/**< Are collected events captured? */
+		uint32					m_nThreadBufferSize;	/**< Size of new thread ring buffers, power of two */
+		mutable CriticalSection m_cCriticalSection;	/**< Protects the list of ring buffers and the collected data */
+		Array<ThreadBuffer*>	m_lstThreadBuffers;		/**< Ring buffers of all threads which recorded events */
+		Array<Statistics>		m_lstStatistics;		/**< Zone and counter statistics */
+		Array<Event>			m_lstCapture;			/**< Captured events */
+
+
+};
+
+/**
+*  @brief
+*    Scoped profiler zone
+*
+*  @remarks
+*    Records the begin of a zone when constructed and the end of the zone when destroyed,
+*    use the "PL_PROFILE_ZONE()" macro instead of this class.
+*/
+class ProfilerZone {
+
+
+	//[-------------------------------------------------------]
+	//[ Public functions                                      ]
+	//[-------------------------------------------------------]
+	public:
+		/**
+		*  @brief
+		*    Constructor
+		*
+		*  @param[in] pszName
+		*    Zone name, must stay valid (see "Profiler" remarks)
+		*/
+		inline ProfilerZone(const char *pszName);
+
+		/**
+		*  @brief
+		*    Destructor
+		*/
+		inline ~ProfilerZone();
+
+
+	//[-------------------------------------------------------]
+	//[ Private functions                                     ]
+	//[-------------------------------------------------------]
+	private:
+		/**
+		*  @brief
+		*    Copy constructor
+		*
+		*  @param[in] cSource
+		*    Source to copy from
+		*/
+		ProfilerZone(const ProfilerZone &cSource);
+
+		/**
+		*  @brief
+		*    Copy operator
+		*
+		*  @param[in] cSource
+		*    Source to copy from
+		*
+		*  @return
+		*    Reference to this instance
+		*/
+		ProfilerZone &operator =(const ProfilerZone &cSource);
+
+
+	//[-------------------------------------------------------]
+	//[ Private data                                          ]
+	//[-------------------------------------------------------]
+	private:
+		Profiler *m_pProfiler;	/**< Profiler which recorded the begin of the zone, can be a null pointer */
+
+
+};
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+} // PLCore
+
+
+//[-------------------------------------------------------]
+//[ Implementation                                        ]
+//[-------------------------------------------------------]
+#include "PLCore/Tools/Profiler.inl"
+
+
+#endif // __PLCORE_PROFILER_H__
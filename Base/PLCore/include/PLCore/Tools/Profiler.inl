@@ -0,0 +1,131 @@
+/*********************************************************\
+ *  File: Profiler.inl                                   *
+ *
+ *  Copyright (C) 2002-2013 The PixelLight Team (http://www.pixellight.org/)
+ *
+ *  This file is part of PixelLight.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ *  and associated documentation files (the "Software"), to deal in the Software without
+ *  restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ *  Software is furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all copies or
+ *  substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ *  BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ *  DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ *  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace PLCore {
+
+
+//[-------------------------------------------------------]
+//[ Public static functions                               ]
+//[-------------------------------------------------------]
+/**
+*  @brief
+*    Returns the profiler instance if it's currently recording
+*/
+inline Profiler *Profiler::GetRecordingInstance()
+{
+	if (HasInstance()) {
+		Profiler *pProfiler = GetInstance();
+		if (pProfiler && pProfiler->m_bEnabled)
+			return pProfiler;
+	}
+
+	// The profiler is not recording
+	return nullptr;
+}
+
+
+//[-------------------------------------------------------]
+//[ Public functions                                      ]
+//[-------------------------------------------------------]
+/**
+*  @brief
+*    Returns whether or not the profiler is recording
+*/
+inline bool Profiler::IsEnabled() const
+{
+	return m_bEnabled;
+}
+
+/**
+*  @brief
+*    Returns the size of the ring buffer of a thread
+*/
+inline uint32 Profiler::GetThreadBufferSize() const
+{
+	return m_nThreadBufferSize;
+}
+
+/**
+*  @brief
+*    Returns whether or not collected events are captured
+*/
+inline bool Profiler::IsCapturing() const
+{
+	return m_bCapturing;
+}
+
+/**
+*  @brief
+*    Sets whether or not collected events are captured
+*/
+inline void Profiler::SetCapturing(bool bCapturing)
+{
+	m_bCapturing = bCapturing;
+}
+
+/**
+*  @brief
+*    Returns the captured events
+*/
+inline const Array<Profiler::Event> &Profiler::GetCapture() const
+{
+	return m_lstCapture;
+}
+
+
+
+
+//[-------------------------------------------------------]
+//[ Public functions                                      ]
+//[-------------------------------------------------------]
+/**
+*  @brief
+*    Constructor
+*/
+inline ProfilerZone::ProfilerZone(const char *pszName) :
+	m_pProfiler(Profiler::GetRecordingInstance())
+{
+	if (m_pProfiler)
+		m_pProfiler->BeginZone(pszName);
+}
+
+/**
+*  @brief
+*    Destructor
+*/
+inline ProfilerZone::~ProfilerZone()
+{
+	// Always end a begun zone, even if the profiler was disabled in the meantime
+	if (m_pProfiler)
+		m_pProfiler->EndZone();
+}
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+} // PLCore
@@ -25,6 +25,11 @@
 //[-------------------------------------------------------]
 //[ Includes                                              ]
 //[-------------------------------------------------------]
+#include "PLCore/Core/MemoryManager.h"
+#ifdef _DEBUG
+	#include "PLCore/Log/Log.h"
+	#include "PLCore/System/System.h"
+#endif
 #include "PLCore/Base/Func/DynParams.h"
 #include "PLCore/Base/Event/DynEventHandler.h"
 #include "PLCore/Base/Event/DynEvent.h"
@@ -43,7 +48,15 @@ namespace PLCore {
 *  @brief
 *    Constructor
 */
-DynEvent::DynEvent()
+DynEvent::DynEvent() :
+	m_pHandlers(nullptr),
+	m_nNumOfHandlers(0),
+	m_nMaxNumOfHandlers(0),
+	m_nNumOfConnects(0),
+	m_nEmitDepth(0)
+	#ifdef _DEBUG
+		, m_nEmitThreadID(0)
+	#endif
 {
 }
 
@@ -54,11 +67,15 @@ DynEvent::DynEvent()
 DynEvent::~DynEvent()
 {
 	// Force disconnection of event handlers
-	const SimpleList<DynEventHandler*>::ListElement *pElement = m_lstHandlers.pFirstElement;
-	while (pElement) {
-		pElement->Data->m_lstEvents.Remove(this);
-		pElement = pElement->pNextElement;
+	for (uint32 i=0; i<m_nNumOfHandlers; i++) {
+		DynEventHandler *pHandler = m_pHandlers[i].pHandler;
+		if (pHandler)
+			pHandler->RemoveEventSlot(m_pHandlers[i].nEventSlot);
 	}
+
+	// Destroy the event handler slots
+	if (m_pHandlers)
+		delete [] m_pHandlers;
 }
 
 /**
@@ -68,13 +85,39 @@ DynEvent::~DynEvent()
 void DynEvent::Connect(DynEventHandler &cHandler)
 {
 	// The handler must not be connected already
-	if (!cHandler.m_lstEvents.IsElement(this)) {
-		// Signatures must match!
-		if (cHandler.GetSignature() == GetSignature()) {
-			// Connect handler
-			m_lstHandlers.Add(&cHandler);
-			cHandler.m_lstEvents.Add(this);
+	for (uint32 i=0; i<cHandler.m_nNumOfEvents; i++) {
+		if (cHandler.m_pEvents[i].pEvent == this)
+			return; // Already connected
+	}
+
+	// Signatures must match!
+	if (cHandler.GetSignature() == GetSignature()) {
+		#ifdef _DEBUG
+			CheckEmitThread();
+		#endif
+
+		// Reuse the slots of disconnected event handlers before enlarging the event handler slots
+		if (m_nNumOfHandlers >= m_nMaxNumOfHandlers && m_nNumOfConnects != m_nNumOfHandlers && !m_nEmitDepth)
+			Compact();
+
+		// Enlarge the event handler slots if required, grow geometrically so connecting has a constant amortized runtime
+		if (m_nNumOfHandlers >= m_nMaxNumOfHandlers) {
+			const uint32 nMaxNumOfHandlers = m_nMaxNumOfHandlers ? m_nMaxNumOfHandlers*2 : 4;
+			HandlerSlot *pHandlers = new HandlerSlot[nMaxNumOfHandlers];
+			if (m_pHandlers) {
+				MemoryManager::Copy(pHandlers, m_pHandlers, sizeof(HandlerSlot)*m_nNumOfHandlers);
+				delete [] m_pHandlers;
+			}
+			m_pHandlers			= pHandlers;
+			m_nMaxNumOfHandlers = nMaxNumOfHandlers;
 		}
+
+		// Connect handler
+		const uint32 nIndex = m_nNumOfHandlers;
+		m_pHandlers[nIndex].pHandler   = &cHandler;
+		m_pHandlers[nIndex].nEventSlot = cHandler.AddEventSlot(*this, nIndex);
+		m_nNumOfHandlers++;
+		m_nNumOfConnects++;
 	}
 }
 
@@ -84,10 +127,16 @@ void DynEvent::Connect(DynEventHandler &cHandler)
 */
 void DynEvent::Disconnect(DynEventHandler &cHandler)
 {
-	// Disconnect handler
-	if (m_lstHandlers.IsElement(&cHandler)) {
-		m_lstHandlers.Remove(&cHandler);
-		cHandler.m_lstEvents.Remove(this);
+	// Find the event slot of this event within the handler
+	for (uint32 i=0; i<cHandler.m_nNumOfEvents; i++) {
+		if (cHandler.m_pEvents[i].pEvent == this) {
+			// Disconnect handler
+			RemoveHandlerSlot(cHandler.m_pEvents[i].nHandlerSlot);
+			cHandler.RemoveEventSlot(i);
+
+			// Done
+			return;
+		}
 	}
 }
 
@@ -152,6 +201,70 @@ void DynEvent::Emit(const XmlElement &cElement) const
 }
 
 
+//[-------------------------------------------------------]
+//[ Private functions                                     ]
+//[-------------------------------------------------------]
+/**
+*  @brief
+*    Remove an event handler slot
+*/
+void DynEvent::RemoveHandlerSlot(uint32 nIndex)
+{
+	#ifdef _DEBUG
+		CheckEmitThread();
+	#endif
+
+	// Just mark the slot as disconnected, so the slot indices stay valid during an emission and the order of the event handlers is kept
+	m_pHandlers[nIndex].pHandler = nullptr;
+	m_nNumOfConnects--;
+
+	// Remove the disconnected slots as soon as they are the majority, this way disconnecting has a constant amortized runtime
+	// -> While the event is emitted, "EndEmit()" removes them after the outermost emission
+	if (!m_nEmitDepth) {
+		if (!m_nNumOfConnects)
+			m_nNumOfHandlers = 0;
+		else if (m_nNumOfConnects*2 < m_nNumOfHandlers)
+			Compact();
+	}
+}
+
+/**
+*  @brief
+*    Remove the disconnected event handler slots
+*/
+void DynEvent::Compact()
+{
+	// Keep the order of the remaining slots and update the back references of moved event handlers
+	uint32 nNumOfHandlers = 0;
+	for (uint32 i=0; i<m_nNumOfHandlers; i++) {
+		const HandlerSlot &sSlot = m_pHandlers[i];
+		if (sSlot.pHandler) {
+			if (i != nNumOfHandlers) {
+				m_pHandlers[nNumOfHandlers] = sSlot;
+				sSlot.pHandler->m_pEvents[sSlot.nEventSlot].nHandlerSlot = nNumOfHandlers;
+			}
+			nNumOfHandlers++;
+		}
+	}
+	m_nNumOfHandlers = nNumOfHandlers;
+}
+
+#ifdef _DEBUG
+	/**
+	*  @brief
+	*    Checks that the event is not used by multiple threads at the same time
+	*/
+	void DynEvent::CheckEmitThread() const
+	{
+		const handle nThreadID = System::GetInstance()->GetCurrentThreadID();
+		if (!m_nEmitDepth)
+			m_nEmitThreadID = nThreadID;
+		else if (m_nEmitThreadID != nThreadID)
+			PL_LOG(Error, "An event is used by multiple threads at the same time, events are not thread-safe")
+	}
+#endif
+
+
 //[-------------------------------------------------------]
 //[ Namespace                                             ]
 //[-------------------------------------------------------]
@@ -25,6 +25,7 @@
 //[-------------------------------------------------------]
 //[ Includes                                              ]
 //[-------------------------------------------------------]
+#include "PLCore/Core/MemoryManager.h"
 #include "PLCore/Base/Func/DynParams.h"
 #include "PLCore/Base/Event/DynEvent.h"
 #include "PLCore/Base/Event/DynEventHandler.h"
@@ -43,7 +44,10 @@ namespace PLCore {
 *  @brief
 *    Constructor
 */
-DynEventHandler::DynEventHandler()
+DynEventHandler::DynEventHandler() :
+	m_pEvents(nullptr),
+	m_nNumOfEvents(0),
+	m_nMaxNumOfEvents(0)
 {
 }
 
@@ -53,9 +57,16 @@ DynEventHandler::DynEventHandler()
 */
 DynEventHandler::~DynEventHandler()
 {
-	// Disconnect all events
-	while (!m_lstEvents.IsEmpty())
-		m_lstEvents[0]->Disconnect(*this);
+	// Disconnect all events, beginning with the last one so no event slot has to be moved
+	while (m_nNumOfEvents) {
+		const EventSlot &sSlot = m_pEvents[m_nNumOfEvents-1];
+		sSlot.pEvent->RemoveHandlerSlot(sSlot.nHandlerSlot);
+		m_nNumOfEvents--;
+	}
+
+	// Destroy the event slots
+	if (m_pEvents)
+		delete [] m_pEvents;
 }
 
 
@@ -73,6 +84,52 @@ const EventHandlerDesc *DynEventHandler::GetDesc() const
 }
 
 
+//[-------------------------------------------------------]
+//[ Private functions                                     ]
+//[-------------------------------------------------------]
+/**
+*  @brief
+*    Add an event slot
+*/
+uint32 DynEventHandler::AddEventSlot(DynEvent &cEvent, uint32 nHandlerSlot)
+{
+	// Enlarge the event slots if required, usually an event handler is only connected to a few events
+	if (m_nNumOfEvents >= m_nMaxNumOfEvents) {
+		const uint32 nMaxNumOfEvents = m_nMaxNumOfEvents ? m_nMaxNumOfEvents*2 : 1;
+		EventSlot *pEvents = new EventSlot[nMaxNumOfEvents];
+		if (m_pEvents) {
+			MemoryManager::Copy(pEvents, m_pEvents, sizeof(EventSlot)*m_nNumOfEvents);
+			delete [] m_pEvents;
+		}
+		m_pEvents		  = pEvents;
+		m_nMaxNumOfEvents = nMaxNumOfEvents;
+	}
+
+	// Add the event slot
+	m_pEvents[m_nNumOfEvents].pEvent	   = &cEvent;
+	m_pEvents[m_nNumOfEvents].nHandlerSlot = nHandlerSlot;
+	m_nNumOfEvents++;
+
+	// Done
+	return m_nNumOfEvents - 1;
+}
+
+/**
+*  @brief
+*    Remove an event slot
+*/
+void DynEventHandler::RemoveEventSlot(uint32 nIndex)
+{
+	// Move the last slot into the freed one and update the back reference of the moved event
+	m_nNumOfEvents--;
+	if (nIndex != m_nNumOfEvents) {
+		const EventSlot &sSlot = m_pEvents[m_nNumOfEvents];
+		m_pEvents[nIndex] = sSlot;
+		sSlot.pEvent->m_pHandlers[sSlot.nHandlerSlot].nEventSlot = nIndex;
+	}
+}
+
+
 //[-------------------------------------------------------]
 //[ Namespace                                             ]
 //[-------------------------------------------------------]
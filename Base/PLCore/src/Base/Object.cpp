@@ -176,6 +176,15 @@ Object::Object()
 {
 }
 
+/**
+*  @brief
+*    Copy constructor
+*/
+Object::Object(const Object &cSource) : ObjectBase()
+{
+	// Signals and the reference count belong to this instance, so there's nothing to copy
+}
+
 /**
 *  @brief
 *    Destructor
@@ -186,6 +195,16 @@ Object::~Object()
 	SignalDestroyed();
 }
 
+/**
+*  @brief
+*    Copy operator
+*/
+Object &Object::operator =(const Object &cSource)
+{
+	// Signals and the reference count belong to this instance, so there's nothing to copy
+	return *this;
+}
+
 /**
 *  @brief
 *    Check if object is instance of a given class by using a given class reference
@@ -139,7 +139,7 @@ bool File::Open(uint32 nAccess, String::EFormat nStringFormat)
 		MemBufClose();
 
 	// Open file
-	if (nAccess & File::FileMemBuf)
+	if (nAccess & (File::FileMemBuf | File::FileMemMap | File::FileMemMapOnly))
 		return MemBufOpen(nAccess, nStringFormat);
 	else if (m_pFileImpl)
 		return m_pFileImpl->Open(nAccess, nStringFormat);
@@ -244,14 +244,26 @@ bool File::MemBufOpen(uint32 nAccess, String::EFormat nStringFormat)
 			MemBufClose();
 
 		// Open file
-		if (m_pFileImpl->Open(nAccess & ~static_cast<uint32>(FileMemBuf))) {
-			// Get file size
+		if (m_pFileImpl->Open(nAccess & ~static_cast<uint32>(FileMemBuf | FileMemMap | FileMemMapOnly))) {
+			// Map the file into memory? (the mapping stays valid after the file is closed)
 			bool bSuccess = false;
-			m_nMemBufSize = m_pFileImpl->GetSize();
-			if (m_nMemBufSize > 0) {
-				// Read file into memory buffer
-				m_pMemBuf = new uint8[m_nMemBufSize];
-				bSuccess = (m_pFileImpl->Read(m_pMemBuf, 1, m_nMemBufSize) == m_nMemBufSize);
+			if (nAccess & (FileMemMap | FileMemMapOnly)) {
+				m_pMemBuf = m_pFileImpl->MapMemory(m_nMemBufSize);
+				if (m_pMemBuf) {
+					nAccess |= FileMemBufMapped;
+					bSuccess = true;
+				}
+			}
+
+			// Read file into memory buffer if it's not mapped and this fallback is allowed
+			if (!m_pMemBuf && !(nAccess & FileMemMapOnly)) {
+				// Get file size
+				m_nMemBufSize = m_pFileImpl->GetSize();
+				if (m_nMemBufSize > 0) {
+					// Read file into memory buffer
+					m_pMemBuf = new uint8[m_nMemBufSize];
+					bSuccess = (m_pFileImpl->Read(m_pMemBuf, 1, m_nMemBufSize) == m_nMemBufSize);
+				}
 			}
 
 			// Close file
@@ -282,8 +294,12 @@ void File::MemBufClose()
 {
 	// Destroy memory buffer
 	if (m_pMemBuf) {
-		if (!(m_nMemBufAccess & FileMemBufShared))
+		if (m_nMemBufAccess & FileMemBufMapped) {
+			if (m_pFileImpl)
+				m_pFileImpl->UnmapMemory(m_pMemBuf, m_nMemBufSize);
+		} else if (!(m_nMemBufAccess & FileMemBufShared)) {
 			delete [] m_pMemBuf;
+		}
 		m_pMemBuf		= nullptr;
 		m_nMemBufSize	= 0;
 		m_nMemBufPos	= 0;
@@ -56,6 +56,49 @@ FileImpl::~FileImpl()
 }
 
 
+//[-------------------------------------------------------]
+//[ Protected virtual FileImpl functions                  ]
+//[-------------------------------------------------------]
+/**
+*  @brief
+*    Check if the object is a link (e.g. a symbolic link) to another file or directory
+*/
+bool FileImpl::IsLink() const
+{
+	// No links by default
+	return false;
+}
+
+/**
+*  @brief
+*    Maps the opened file read-only into memory
+*/
+uint8 *FileImpl::MapMemory(uint32 &nSize)
+{
+	// Not supported by default
+	return nullptr;
+}
+
+/**
+*  @brief
+*    Releases a memory mapping created by "MapMemory()"
+*/
+void FileImpl::UnmapMemory(uint8 *pData, uint32 nSize)
+{
+	// Not supported by default
+}
+
+/**
+*  @brief
+*    Returns the time of the last modification
+*/
+uint64 FileImpl::GetModificationTime() const
+{
+	// Not supported by default
+	return 0;
+}
+
+
 //[-------------------------------------------------------]
 //[ Namespace                                             ]
 //[-------------------------------------------------------]
@@ -0,0 +1,289 @@
+/*********************************************************\
+ *  File: FileIndex.cpp                                  *
+ *
+ *  Copyright (C) 2002-2013 The PixelLight Team (http://www.pixellight.org/)
+ *
+ *  This file is part of PixelLight.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ *  and associated documentation files (the "Software"), to deal in the Software without
+ *  restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ *  Software is furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all copies or
+ *  substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ *  BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ *  DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ *  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include "PLCore/File/Directory.h"
+#include "PLCore/File/FileSearch.h"
+#include "PLCore/File/ZipHandle.h"
+#include "PLCore/Container/Stack.h"
+#include "PLCore/File/FileIndex.h"
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace PLCore {
+
+
+//[-------------------------------------------------------]
+//[ Public static functions                               ]
+//[-------------------------------------------------------]
+/**
+*  @brief
+*    Returns the normalized version of a relative filename
+*/
+String FileIndex::Normalize(const String &sFilename)
+{
+	// Replace '\' by '/'
+	String sTemp = sFilename;
+	sTemp.Replace('\\', '/');
+
+	// Loop through all names, resolve '.' and '..' and ignore empty names
+	Stack<String> cNameStack;
+	uint32 nPos = 0;
+	while (nPos <= sTemp.GetLength()) {
+		// Get the next name
+		int nSlash = sTemp.IndexOf("/", nPos);
+		if (nSlash < 0)
+			nSlash = sTemp.GetLength();
+		const String sName = sTemp.GetSubstring(nPos, nSlash - nPos);
+		nPos = nSlash + 1;
+
+		// Check the name
+		if (sName == "..") {
+			// Remove the last name, keep '..' at the beginning (the file is outside of the directory)
+			if (cNameStack.GetNumOfElements() && cNameStack.Top() != "..")
+				cNameStack.Pop();
+			else
+				cNameStack.Push(sName);
+		} else if (sName.GetLength() && sName != '.') {
+			cNameStack.Push(sName);
+		}
+	}
+
+	// Put the filename together
+	String sNormalized;
+	while (cNameStack.GetNumOfElements()) {
+		sNormalized = sNormalized.GetLength() ? cNameStack.Top() + '/' + sNormalized : cNameStack.Top();
+		cNameStack.Pop();
+	}
+
+	// The file systems on Windows are not case sensitive
+	#ifdef WIN32
+		sNormalized.ToLower();
+	#endif
+
+	// Done
+	return sNormalized;
+}
+
+
+//[-------------------------------------------------------]
+//[ Public functions                                      ]
+//[-------------------------------------------------------]
+/**
+*  @brief
+*    Constructor
+*/
+FileIndex::FileIndex() :
+	m_mapEntries(1024)
+{
+}
+
+/**
+*  @brief
+*    Destructor
+*/
+FileIndex::~FileIndex()
+{
+}
+
+/**
+*  @brief
+*    Removes all entries
+*/
+void FileIndex::Clear()
+{
+	m_mapEntries.Clear();
+}
+
+/**
+*  @brief
+*    Adds all files within a directory and its subdirectories
+*/
+bool FileIndex::AddDirectory(const String &sDirectory, uint32 nDirectory)
+{
+	// Make sure the directory ends with '/'
+	String sValidDirectory = sDirectory;
+	sValidDirectory.Replace('\\', '/');
+	if (sValidDirectory.GetLength() && sValidDirectory[sValidDirectory.GetLength() - 1] != '/')
+		sValidDirectory += '/';
+
+	// ZIP-file? (see FileObject::Assign())
+	const int nPos = String(sValidDirectory).ToLower().LastIndexOf(".zip/");
+	if (nPos > -1) {
+		// Although not recommended, it's possible to life without ZIP support for minimal builds
+		#ifndef DISABLE_ZIP_SUPPORT
+			return AddZipDirectory(sValidDirectory.GetSubstring(0, nPos + 4), sValidDirectory.GetSubstring(nPos + 5), nDirectory);
+		#else
+			return false;
+		#endif
+	}
+
+	// Regular directory
+	if (Directory(sValidDirectory).IsDirectory()) {
+		AddFileSystemDirectory(sValidDirectory, "", nDirectory);
+
+		// Done
+		return true;
+	}
+
+	// Error!
+	return false;
+}
+
+/**
+*  @brief
+*    Adds a single file
+*/
+bool FileIndex::AddFile(const String &sFilename, uint32 nDirectory)
+{
+	return AddEntry(Normalize(sFilename), Entry(nDirectory));
+}
+
+/**
+*  @brief
+*    Returns the entry of a file
+*/
+const FileIndex::Entry *FileIndex::Get(const String &sFilename) const
+{
+	const Entry &cEntry = m_mapEntries.Get(Normalize(sFilename));
+	return (&cEntry != &FlatHashMap<String, Entry>::Null) ? &cEntry : nullptr;
+}
+
+/**
+*  @brief
+*    Removes a single file
+*/
+bool FileIndex::RemoveFile(const String &sFilename)
+{
+	return m_mapEntries.Remove(Normalize(sFilename));
+}
+
+
+//[-------------------------------------------------------]
+//[ Private functions                                     ]
+//[-------------------------------------------------------]
+/**
+*  @brief
+*    Copy constructor
+*/
+FileIndex::FileIndex(const FileIndex &cSource)
+{
+	// No implementation because the copy constructor is never used
+}
+
+/**
+*  @brief
+*    Copy operator
+*/
+FileIndex &FileIndex::operator =(const FileIndex &cSource)
+{
+	// No implementation because the copy operator is never used
+	return *this;
+}
+
+/**
+*  @brief
+*    Adds an entry
+*/
+bool FileIndex::AddEntry(const String &sNormalized, const Entry &cEntry)
+{
+	// The hash map doesn't check for duplicates, the first added entry wins
+	if (sNormalized.GetLength() && &m_mapEntries.Get(sNormalized) == &FlatHashMap<String, Entry>::Null)
+		return m_mapEntries.Add(sNormalized, cEntry);
+
+	// Error!
+	return false;
+}
+
+/**
+*  @brief
+*    Adds all files within a regular directory and its subdirectories
+*/
+void FileIndex::AddFileSystemDirectory(const String &sDirectory, const String &sRelativePath, uint32 nDirectory)
+{
+	FileSearch cSearch(Directory(sDirectory + sRelativePath));
+	while (cSearch.HasNextFile()) {
+		// Get the next file, ignore '.' and '..'
+		const String sFilename = cSearch.GetNextFile();
+		if (sFilename != '.' && sFilename != "..") {
+			// Add files, walk into subdirectories but don't follow directory links (they may form loops)
+			const String sRelativeFilename = sRelativePath + sFilename;
+			const Directory cDirectory(sDirectory + sRelativeFilename);
+			if (cDirectory.IsDirectory()) {
+				if (!cDirectory.IsLink())
+					AddFileSystemDirectory(sDirectory, sRelativeFilename + '/', nDirectory);
+			} else {
+				AddFile(sRelativeFilename, nDirectory);
+			}
+		}
+	}
+}
+
+/**
+*  @brief
+*    Adds all files within a directory of a ZIP-file
+*/
+bool FileIndex::AddZipDirectory(const String &sZipFile, const String &sPathInZip, uint32 nDirectory)
+{
+	// Open the ZIP-file
+	ZipHandle cZipFile;
+	if (cZipFile.Open(sZipFile, "")) {
+		// Walk once through the central directory of the ZIP-file
+		const uint32 nPathLength = sPathInZip.GetLength();
+		bool bValid = cZipFile.LocateFirstFile();
+		while (bValid) {
+			// Add files within the directory, entries ending with '/' are directories
+			const ZipHandle::ZipEntry &cZipEntry = cZipFile.GetCurrentFile();
+			const String &sFilename = cZipEntry.m_sFilename;
+			if (sFilename.GetLength() > nPathLength && sFilename[sFilename.GetLength() - 1] != '/' &&
+				(!nPathLength || sFilename.Compare(sPathInZip, 0, nPathLength))) {
+				Entry cEntry(nDirectory);
+				cEntry.m_bZipEntry			= true;
+				cEntry.m_nZipEntryIndex		= cZipFile.GetCurrentFileIndex();
+				cEntry.m_nZipEntryPosition	= cZipFile.GetCurrentFilePosition();
+				cEntry.m_nSize				= cZipEntry.m_nUncompressedSize;
+				AddEntry(Normalize(sFilename.GetSubstring(nPathLength)), cEntry);
+			}
+
+			// Next entry
+			bValid = cZipFile.LocateNextFile();
+		}
+
+		// Done
+		return true;
+	}
+
+	// Error!
+	return false;
+}
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+} // PLCore
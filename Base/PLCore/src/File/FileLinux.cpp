@@ -31,6 +31,7 @@
 #include <unistd.h>
 #include <fcntl.h>
 #include <sys/stat.h>
+#include <sys/mman.h>
 #include "PLCore/PLCoreLinuxIncludes.h"
 #include "PLCore/File/File.h"
 #include "PLCore/File/FileSearchLinux.h"
@@ -100,6 +101,17 @@ bool FileLinux::IsDirectory() const
 	return false;
 }
 
+bool FileLinux::IsLink() const
+{
+	// Get file status, without following a symbolic link
+	struct stat sStat;
+	if (lstat((m_sFilename.GetFormat() == String::ASCII) ? m_sFilename.GetASCII() : m_sFilename.GetUTF8(), &sStat) == 0)
+		return S_ISLNK(sStat.st_mode);
+
+	// Error!
+	return false;
+}
+
 bool FileLinux::CopyTo(const String &sDest, bool bOverwrite) const
 {
 	// Get destination as a unix path
@@ -442,6 +454,41 @@ FileSearchImpl *FileLinux::CreateSearch()
 	return new FileSearchLinux(m_cUrl.GetUnixPath(), m_pAccess);
 }
 
+uint8 *FileLinux::MapMemory(uint32 &nSize)
+{
+	// Check file pointer, the file must be readable and not empty (mmap() fails for a size of 0)
+	if (m_pFile && (m_nAccess & File::FileRead)) {
+		const uint32 nFileSize = GetSize();
+		if (nFileSize) {
+			void *pData = mmap(nullptr, nFileSize, PROT_READ, MAP_PRIVATE, fileno(m_pFile), 0);
+			if (pData != MAP_FAILED) {
+				// Done
+				nSize = nFileSize;
+				return static_cast<uint8*>(pData);
+			}
+		}
+	}
+
+	// Error!
+	return nullptr;
+}
+
+void FileLinux::UnmapMemory(uint8 *pData, uint32 nSize)
+{
+	munmap(pData, nSize);
+}
+
+uint64 FileLinux::GetModificationTime() const
+{
+	// Get file status
+	struct stat sStat;
+	if (stat((m_sFilename.GetFormat() == String::ASCII) ? m_sFilename.GetASCII() : m_sFilename.GetUTF8(), &sStat) == 0)
+		return static_cast<uint64>(sStat.st_mtim.tv_sec)*1000 + sStat.st_mtim.tv_nsec/1000000;
+
+	// Error!
+	return 0;
+}
+
 
 //[-------------------------------------------------------]
 //[ Namespace                                             ]
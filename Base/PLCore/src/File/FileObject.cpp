@@ -55,51 +55,16 @@ namespace PLCore {
 */
 void FileObject::Assign(const Url &cUrl, const FileAccess *pAccess)
 {
-	// Get cleaned up URL (when trying to simplify this, ensure that it's still running on all supported platforms, including Android)
-	Url cFinalUrl;
-	if (cUrl.IsDirectory() && cUrl.GetPath().GetLength()) {
-		const String sUrl = cUrl.GetUrl();
-		cFinalUrl = sUrl.GetSubstring(0, sUrl.GetLength() - 1);
-	} else {
-		cFinalUrl = cUrl;
-	}
-	cFinalUrl.Collapse();
-
-	// Delete existing file implementation
-	if (m_pFileImpl) {
-		delete m_pFileImpl;
-		m_pFileImpl = nullptr;
-	}
-
-	// Create file implementation
-
-	// ZIP
-	const String sUrlLower = cFinalUrl.GetUrl().ToLower();
-	const int nPos = sUrlLower.LastIndexOf(".zip/");
-	if (nPos > -1) {
-		// Although not recommended, it's possible to life without ZIP support for minimal builds
-		#ifndef DISABLE_ZIP_SUPPORT
-			const String sZipFile   = cFinalUrl.GetUrl().GetSubstring(0, nPos+4);
-			const String sPathInZip = cFinalUrl.GetUrl().GetSubstring(nPos+5);
-			m_pFileImpl = new FileZip(cFinalUrl, sZipFile, sPathInZip, pAccess);
-		#endif
-
-	// HTTP
-	} else if (cFinalUrl.GetProtocol() == "http://") {
-		m_pFileImpl = new FileHttp(cUrl, pAccess);
+	AssignUrl(cUrl, pAccess, false, 0, 0);
+}
 
-	// System file
-	} else {
-		#if defined(WIN32)
-			m_pFileImpl = new FileWindows(cFinalUrl, pAccess);
-		#elif defined(ANDROID)
-			m_pFileImpl = new FileAndroid(cFinalUrl, pAccess);
-		#elif defined(LINUX)
-			m_pFileImpl = new FileLinux(cFinalUrl, pAccess);
-		#else
-			#error "Unsupported platform"
-		#endif
-	}
+/**
+*  @brief
+*    Assign a new URL of a file within a ZIP-file whose entry was located before
+*/
+void FileObject::Assign(const Url &cUrl, uint32 nZipEntryIndex, uint32 nZipEntryPosition, const FileAccess *pAccess)
+{
+	AssignUrl(cUrl, pAccess, true, nZipEntryIndex, nZipEntryPosition);
 }
 
 /**
@@ -256,6 +221,60 @@ FileObject &FileObject::operator =(const FileObject &cSource)
 	return *this;
 }
 
+/**
+*  @brief
+*    Assign a new URL
+*/
+void FileObject::AssignUrl(const Url &cUrl, const FileAccess *pAccess, bool bZipEntry, uint32 nZipEntryIndex, uint32 nZipEntryPosition)
+{
+	// Get cleaned up URL (when trying to simplify this, ensure that it's still running on all supported platforms, including Android)
+	Url cFinalUrl;
+	if (cUrl.IsDirectory() && cUrl.GetPath().GetLength()) {
+		const String sUrl = cUrl.GetUrl();
+		cFinalUrl = sUrl.GetSubstring(0, sUrl.GetLength() - 1);
+	} else {
+		cFinalUrl = cUrl;
+	}
+	cFinalUrl.Collapse();
+
+	// Delete existing file implementation
+	if (m_pFileImpl) {
+		delete m_pFileImpl;
+		m_pFileImpl = nullptr;
+	}
+
+	// Create file implementation
+
+	// ZIP
+	const String sUrlLower = cFinalUrl.GetUrl().ToLower();
+	const int nPos = sUrlLower.LastIndexOf(".zip/");
+	if (nPos > -1) {
+		// Although not recommended, it's possible to life without ZIP support for minimal builds
+		#ifndef DISABLE_ZIP_SUPPORT
+			const String sZipFile   = cFinalUrl.GetUrl().GetSubstring(0, nPos+4);
+			const String sPathInZip = cFinalUrl.GetUrl().GetSubstring(nPos+5);
+			m_pFileImpl = bZipEntry ? new FileZip(cFinalUrl, sZipFile, sPathInZip, nZipEntryIndex, nZipEntryPosition, pAccess)
+									: new FileZip(cFinalUrl, sZipFile, sPathInZip, pAccess);
+		#endif
+
+	// HTTP
+	} else if (cFinalUrl.GetProtocol() == "http://") {
+		m_pFileImpl = new FileHttp(cUrl, pAccess);
+
+	// System file
+	} else {
+		#if defined(WIN32)
+			m_pFileImpl = new FileWindows(cFinalUrl, pAccess);
+		#elif defined(ANDROID)
+			m_pFileImpl = new FileAndroid(cFinalUrl, pAccess);
+		#elif defined(LINUX)
+			m_pFileImpl = new FileLinux(cFinalUrl, pAccess);
+		#else
+			#error "Unsupported platform"
+		#endif
+	}
+}
+
 
 //[-------------------------------------------------------]
 //[ Namespace                                             ]
@@ -103,6 +103,19 @@ bool FileWindows::IsDirectory() const
 	return (nAttributes != INVALID_FILE_ATTRIBUTES && (nAttributes & FILE_ATTRIBUTE_DIRECTORY));
 }
 
+bool FileWindows::IsLink() const
+{
+	// Check file attributes
+	DWORD nAttributes;
+	if (m_sFilename.GetFormat() == String::ASCII)
+		nAttributes = GetFileAttributesA(m_sFilename.GetASCII());
+	else
+		nAttributes = GetFileAttributesW(m_sFilename.GetUnicode());
+
+	// Is it a symbolic link or a junction?
+	return (nAttributes != INVALID_FILE_ATTRIBUTES && (nAttributes & FILE_ATTRIBUTE_REPARSE_POINT));
+}
+
 bool FileWindows::CopyTo(const String &sDest, bool bOverwrite) const
 {
 	// Get destination as a windows path
@@ -502,6 +515,51 @@ FileSearchImpl *FileWindows::CreateSearch()
 	return new FileSearchWindows(m_cUrl.GetWindowsPath(), m_pAccess);
 }
 
+uint8 *FileWindows::MapMemory(uint32 &nSize)
+{
+	// Check file pointer, the file must be readable and not empty (CreateFileMapping() fails for a size of 0)
+	if (m_pFile && (m_nAccess & File::FileRead)) {
+		const uint32 nFileSize = GetSize();
+		if (nFileSize) {
+			// Create a file mapping object, the view keeps a reference to it so it can be closed right after mapping the view
+			HANDLE hMapping = CreateFileMapping(reinterpret_cast<HANDLE>(_get_osfhandle(_fileno(m_pFile))), nullptr, PAGE_READONLY, 0, 0, nullptr);
+			if (hMapping) {
+				void *pData = MapViewOfFile(hMapping, FILE_MAP_READ, 0, 0, 0);
+				CloseHandle(hMapping);
+				if (pData) {
+					// Done
+					nSize = nFileSize;
+					return static_cast<uint8*>(pData);
+				}
+			}
+		}
+	}
+
+	// Error!
+	return nullptr;
+}
+
+void FileWindows::UnmapMemory(uint8 *pData, uint32 nSize)
+{
+	UnmapViewOfFile(pData);
+}
+
+uint64 FileWindows::GetModificationTime() const
+{
+	// Get file attributes
+	WIN32_FILE_ATTRIBUTE_DATA sAttributes;
+	const BOOL bResult = (m_sFilename.GetFormat() == String::ASCII) ? GetFileAttributesExA(m_sFilename.GetASCII(), GetFileExInfoStandard, &sAttributes)
+																	: GetFileAttributesExW(m_sFilename.GetUnicode(), GetFileExInfoStandard, &sAttributes);
+	if (bResult) {
+		// The file time is in 100-nanosecond intervals since January 1, 1601 (UTC)
+		const uint64 nFileTime = (static_cast<uint64>(sAttributes.ftLastWriteTime.dwHighDateTime) << 32) | sAttributes.ftLastWriteTime.dwLowDateTime;
+		return (nFileTime > 116444736000000000ULL) ? (nFileTime - 116444736000000000ULL)/10000 : 0;
+	}
+
+	// Error!
+	return 0;
+}
+
 
 //[-------------------------------------------------------]
 //[ Namespace                                             ]
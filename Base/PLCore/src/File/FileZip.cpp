@@ -48,26 +48,35 @@ FileZip::FileZip(const Url &cUrl, const String &sZipFile, const String &sPathInZ
 	m_sPathInZip(sPathInZip),
 	m_nAccess(0)
 {
-	// Get options from access-information
-	String sPassword;
-	bool bCaseSensitive = true;
-	bool bMemBuf = true;
-	if (m_pAccess && m_pAccess->HasEntry(sZipFile)) {
-		const FileAccess::Entry &cZipAccess = m_pAccess->GetEntry(sZipFile);
-		sPassword = cZipAccess.GetPassword();
-		bCaseSensitive = cZipAccess.GetCaseSensitive();
-		if (cZipAccess.GetFlagsMask() & File::FileMemBuf)
-			bMemBuf = ((cZipAccess.GetFlagsValue() & File::FileMemBuf) != 0);
-	}
-
 	// Open ZIP-file
-	m_cZipFile.Open(sZipFile, sPassword, bCaseSensitive, bMemBuf, pAccess);
+	OpenZipFile();
 
 	// Locate entry
 	if (sPathInZip.GetLength())
 		m_cZipFile.LocateFile(sPathInZip);
 }
 
+/**
+*  @brief
+*    Constructor for an entry which was located before
+*/
+FileZip::FileZip(const Url &cUrl, const String &sZipFile, const String &sPathInZip, uint32 nEntryIndex, uint32 nEntryPosition, const FileAccess *pAccess) : FileImpl(cUrl, pAccess),
+	m_sZipFile(sZipFile),
+	m_sPathInZip(sPathInZip),
+	m_nAccess(0)
+{
+	// Open ZIP-file
+	OpenZipFile();
+
+	// Locate entry, fall back to the search by name if the given entry is not the one we're looking for
+	if (sPathInZip.GetLength()) {
+		const String &sFilename = m_cZipFile.GetCurrentFile().m_sFilename;
+		if (!m_cZipFile.LocateFile(nEntryIndex, nEntryPosition) ||
+			!(m_cZipFile.IsCaseSensitive() ? sFilename == sPathInZip : sFilename.CompareNoCase(sPathInZip)))
+			m_cZipFile.LocateFile(sPathInZip);
+	}
+}
+
 /**
 *  @brief
 *    Destructor
@@ -331,6 +340,32 @@ FileSearchImpl *FileZip::CreateSearch()
 }
 
 
+//[-------------------------------------------------------]
+//[ Private functions                                     ]
+//[-------------------------------------------------------]
+/**
+*  @brief
+*    Opens the ZIP-file
+*/
+void FileZip::OpenZipFile()
+{
+	// Get options from access-information
+	String sPassword;
+	bool bCaseSensitive = true;
+	bool bMemBuf = true;
+	if (m_pAccess && m_pAccess->HasEntry(m_sZipFile)) {
+		const FileAccess::Entry &cZipAccess = m_pAccess->GetEntry(m_sZipFile);
+		sPassword = cZipAccess.GetPassword();
+		bCaseSensitive = cZipAccess.GetCaseSensitive();
+		if (cZipAccess.GetFlagsMask() & File::FileMemBuf)
+			bMemBuf = ((cZipAccess.GetFlagsValue() & File::FileMemBuf) != 0);
+	}
+
+	// Open ZIP-file
+	m_cZipFile.Open(m_sZipFile, sPassword, bCaseSensitive, bMemBuf, m_pAccess);
+}
+
+
 //[-------------------------------------------------------]
 //[ Namespace                                             ]
 //[-------------------------------------------------------]
@@ -453,6 +453,45 @@ bool ZipHandle::LocateFile(const String &sFilename)
 	return false;
 }
 
+/**
+*  @brief
+*    Sets the pointer to an entry in the ZIP-file which was located before
+*/
+bool ZipHandle::LocateFile(uint32 nIndex, uint32 nPosition)
+{
+	// This must stop any read operation
+	CloseFile();
+
+	// The entry must be within the central directory
+	if (nIndex < m_nNumEntries && nPosition >= m_nCentralDirOffset && nPosition < m_nCentralDirOffset + m_nCentralDirSize) {
+		m_nCurCentralDirPos	= nPosition;
+		m_nCurFile			= nIndex;
+		return ReadCurrentFileInfo();
+	}
+
+	// Error!
+	m_cCurFile.Clear();
+	return false;
+}
+
+/**
+*  @brief
+*    Returns the index of the current entry in the ZIP-file
+*/
+uint32 ZipHandle::GetCurrentFileIndex() const
+{
+	return m_nCurFile;
+}
+
+/**
+*  @brief
+*    Returns the position of the current entry within the central directory of the ZIP-file
+*/
+uint32 ZipHandle::GetCurrentFilePosition() const
+{
+	return m_nCurCentralDirPos;
+}
+
 /**
 *  @brief
 *    Get information about the current entry in the ZIP-file
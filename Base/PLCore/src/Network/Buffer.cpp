@@ -98,8 +98,9 @@ void Buffer::Allocate(uint32 nSize)
 
 	// Allocate new buffer
 	if (nSize) {
-		m_pBuffer = new char[nSize];
-		m_nSize   = nSize;
+		m_pBuffer    = new char[nSize];
+		m_pBuffer[0] = 0;
+		m_nSize      = nSize;
 	}
 }
 
@@ -113,9 +114,18 @@ void Buffer::Add(const char *pData, uint32 nSize)
 	if (pData && nSize) {
 		// Enlarge the buffer if necessary
 		if (m_nUsed+nSize+1 > m_nSize) {
-			// +32 = give some more memory to reduce too frequently allocation
-			m_nSize   = m_nUsed + nSize + 32;
-			m_pBuffer = static_cast<char*>(MemoryManager::Reallocator(m_pBuffer, m_nSize));
+			// +32 = give some more memory to reduce too frequently allocation, grow at least by the
+			// current size so filling the buffer piece by piece (e.g. buffered sending) has a linear runtime
+			m_nSize = (m_nUsed + nSize + 32 > m_nSize*2) ? m_nUsed + nSize + 32 : m_nSize*2;
+
+			// The buffer is allocated with new[] everywhere else, so don't use a C-style reallocation in here
+			char *pBuffer = new char[m_nSize];
+			if (m_pBuffer) {
+				if (m_nUsed)
+					MemoryManager::Copy(pBuffer, m_pBuffer, m_nUsed);
+				delete [] m_pBuffer;
+			}
+			m_pBuffer = pBuffer;
 		}
 
 		// Add data to buffer
@@ -125,6 +135,27 @@ void Buffer::Add(const char *pData, uint32 nSize)
 	}
 }
 
+/**
+*  @brief
+*    Remove data from the front of the buffer
+*/
+void Buffer::Remove(uint32 nSize)
+{
+	// Is there anything to remove?
+	if (m_nUsed && nSize) {
+		if (nSize < m_nUsed) {
+			// Move the remaining data to the front and terminate it
+			m_nUsed -= nSize;
+			MemoryManager::Move(m_pBuffer, m_pBuffer + nSize, m_nUsed);
+			m_pBuffer[m_nUsed] = 0;
+		} else {
+			// Remove all data
+			m_nUsed = 0;
+			m_pBuffer[0] = 0;
+		}
+	}
+}
+
 /**
 *  @brief
 *    Get a line from the buffer
@@ -25,8 +25,13 @@
 //[-------------------------------------------------------]
 //[ Includes                                              ]
 //[-------------------------------------------------------]
+#include <string.h>
+#include "PLCore/Core/MemoryManager.h"
+#include "PLCore/File/File.h"
 #include "PLCore/System/System.h"
+#include "PLCore/System/MutexGuard.h"
 #include "PLCore/Network/Host.h"
+#include "PLCore/Network/Reactor.h"
 #include "PLCore/Network/Connection.h"
 
 
@@ -47,7 +52,13 @@ Connection::Connection(Host &cHost) :
 	m_pHost(&cHost),
 	m_bConnected(false),
 	m_nPort(0),
-	m_nReceiveMode(ReceiveAutomatic)
+	m_nReceiveMode(ReceiveAutomatic),
+	m_pReactor(nullptr),
+	m_pIOReactor(nullptr),
+	m_nIOThread(0),
+	m_nReactorHandle(0),
+	m_nSendBufferRemoved(0),
+	m_bDisconnectPending(false)
 {
 }
 
@@ -57,24 +68,157 @@ Connection::Connection(Host &cHost) :
 */
 bool Connection::Disconnect()
 {
-	// Are we still connected?
-	if (m_bConnected) {
-		// Disconnect
-		m_bConnected = false;
+	// When using event driven network I/O, close the connection as soon as all buffered data has been sent
+	if (m_pReactor) {
+		MutexGuard cMutexGuard(m_cSendMutex);
+		if (m_pReactor && m_bConnected && !IsSendQueueEmpty()) {
+			m_bDisconnectPending = true;
+
+			// Done
+			return true;
+		}
+	}
 
-		// Close connection
-		m_cSocket.Close();
+	// Close the connection at once
+	return CloseConnection();
+}
 
-		// Emit disconnect event
-		OnDisconnect();
-		m_pHost->OnDisconnect(*this);
+/**
+*  @brief
+*    Set receive mode
+*/
+void Connection::SetReceiveMode(EReceiveMode nReceiveMode)
+{
+	// Set receive mode
+	if (m_nReceiveMode != nReceiveMode) {
+		m_nReceiveMode = nReceiveMode;
+
+		// Event driven network I/O is only used for automatic receive mode, the connection thread handles both modes
+		if (m_bConnected && m_pReactor && nReceiveMode == ReceiveManual) {
+			// The socket is blocking again after the connection was unregistered, send the data waiting to be sent at once
+			StopEventDrivenIO();
+			{
+				MutexGuard cMutexGuard(m_cSendMutex);
+				SendQueuedData();
+				ClearSendQueue();
+			}
 
-		// Done
+			// Start connection thread
+			Start();
+		}
+	}
+}
+
+/**
+*  @brief
+*    Send data
+*/
+int Connection::Send(const char *pBuffer, uint32 nSize) const
+{
+	// Check parameters
+	if (!pBuffer || !nSize)
+		return -1; // Error!
+
+	// Event driven network I/O?
+	if (m_pReactor) {
+		MutexGuard cMutexGuard(m_cSendMutex);
+		if (m_pReactor) {
+			// Send directly if no data is waiting to be sent, else keep the order
+			int nSent = 0;
+			if (IsSendQueueEmpty()) {
+				nSent = Reactor::Send(m_cSocket, pBuffer, nSize);
+				if (nSent < 0)
+					return nSent; // Error!
+			}
+
+			// Buffer the rest and wait until the socket is writable
+			if (static_cast<uint32>(nSent) < nSize) {
+				m_cSendBuffer.Add(pBuffer + nSent, nSize - nSent);
+				m_pReactor->UpdateConnection(*this, true);
+			}
+
+			// Done
+			return static_cast<int>(nSize);
+		}
+	}
+
+	// Send data buffer
+	return m_cSocket.Send(pBuffer, nSize);
+}
+
+/**
+*  @brief
+*    Send a range of a file
+*/
+bool Connection::SendFileRange(File *pFile, uint32 nOffset, uint32 nSize) const
+{
+	// Check parameters
+	if (!pFile)
+		return false; // Error!
+	if (!nSize) {
+		// Nothing to send
+		delete pFile;
 		return true;
 	}
 
-	// Error!
-	return false;
+	// Send the file data directly out of the memory buffer if possible
+	const uint8 *pnData = pFile->GetMemoryBuffer();
+	if (pnData) {
+		if (static_cast<uint64>(nOffset) + nSize > pFile->GetSize()) {
+			// Error, the range is not within the file!
+			delete pFile;
+			return false;
+		}
+
+		// Event driven network I/O?
+		if (m_pReactor) {
+			MutexGuard cMutexGuard(m_cSendMutex);
+			if (m_pReactor) {
+				// Send directly if no data is waiting to be sent, else keep the order
+				int nSent = 0;
+				if (IsSendQueueEmpty()) {
+					nSent = Reactor::Send(m_cSocket, reinterpret_cast<const char*>(pnData + nOffset), nSize);
+					if (nSent < 0) {
+						// Error!
+						delete pFile;
+						return false;
+					}
+				}
+
+				// Keep the file until the rest has been sent and wait until the socket is writable
+				if (static_cast<uint32>(nSent) < nSize) {
+					QueuedFile *pQueuedFile = new QueuedFile;
+					pQueuedFile->pFile		   = pFile;
+					pQueuedFile->nOffset	   = nOffset + nSent;
+					pQueuedFile->nSize		   = nSize - nSent;
+					pQueuedFile->nSendPosition = m_nSendBufferRemoved + m_cSendBuffer.GetUsedSize();
+					m_lstSendFiles.Add(pQueuedFile);
+					m_pReactor->UpdateConnection(*this, true);
+				} else {
+					delete pFile;
+				}
+
+				// Done
+				return true;
+			}
+		}
+
+		// Send the whole range at once
+		const int nSent = m_cSocket.Send(reinterpret_cast<const char*>(pnData + nOffset), nSize);
+		delete pFile;
+		return (nSent == static_cast<int>(nSize));
+	}
+
+	// The file isn't memory buffered, read and send it in chunks
+	bool bResult = pFile->Seek(nOffset);
+	char szBuffer[65536];
+	while (bResult && nSize) {
+		const uint32 nRead = pFile->Read(szBuffer, 1, (nSize < 65536) ? nSize : 65536);
+		bResult = (nRead && Send(szBuffer, nRead) == static_cast<int>(nRead));
+		nSize -= nRead;
+	}
+	delete pFile;
+	return bResult;
 }
 
 /**
@@ -83,6 +227,15 @@ bool Connection::Disconnect()
 */
 int Connection::Receive(char *pBuffer, uint32 nSize)
 {
+	// Return data which was already received by "ReadLine()" first, "OnReceive()" was already called for it
+	const uint32 nBuffered = m_cReceiveBuffer.GetUsedSize();
+	if (nBuffered && pBuffer && nSize) {
+		const uint32 nBytes = (nSize < nBuffered) ? nSize : nBuffered;
+		MemoryManager::Copy(pBuffer, m_cReceiveBuffer.GetData(), nBytes);
+		m_cReceiveBuffer.Remove(nBytes);
+		return static_cast<int>(nBytes);
+	}
+
 	// Read data from socket
 	const int nBytes = m_cSocket.Receive(pBuffer, nSize);
 	if (nBytes > 0)
@@ -96,18 +249,34 @@ int Connection::Receive(char *pBuffer, uint32 nSize)
 */
 String Connection::ReadLine()
 {
-	// Read a line
-	char szBuffer[256], *pszBuffer = szBuffer;
-	while (Receive(pszBuffer, 1) == 1) {
-		if (*pszBuffer == 10) {
-			// End of line '\n'
-			pszBuffer[1] = 0;
-			return szBuffer;
-		} else {
-			// Next char
-			if (pszBuffer < szBuffer + 254)	// Avoid buffer overflow
-				pszBuffer++;
+	// Read until there's a complete line within the receive buffer
+	for (;;) {
+		// -> Only search within the maximum line length, a delimiter behind it belongs to a line which is too long
+		const char  *pszData = m_cReceiveBuffer.GetData();
+		const uint32 nUsed   = m_cReceiveBuffer.GetUsedSize();
+		const char  *pszEOL  = nUsed ? static_cast<const char*>(memchr(pszData, '\n', (nUsed < MaxLineLength) ? nUsed : MaxLineLength)) : nullptr;
+		if (pszEOL) {
+			// Return the line including the line delimiter and remove it from the receive buffer
+			const uint32 nLength = static_cast<uint32>(pszEOL - pszData) + 1;
+			const String sLine(pszData, true, nLength);
+			m_cReceiveBuffer.Remove(nLength);
+			return sLine;
+		}
+
+		// Drop the data and close the connection if the line is too long, the other side is misbehaving
+		if (nUsed >= MaxLineLength) {
+			m_cReceiveBuffer.Clear();
+			Disconnect();
+			break; // Error!
 		}
+
+		// Receive the next chunk of data instead of a single character, data behind the line is kept for the next request
+		char szBuffer[4096];
+		const int nBytes = m_cSocket.Receive(szBuffer, 4096);
+		if (nBytes <= 0)
+			break; // Error!
+		OnReceive(szBuffer, nBytes);
+		m_cReceiveBuffer.Add(szBuffer, nBytes);
 	}
 
 	// Error!
@@ -124,8 +293,10 @@ String Connection::ReadLine()
 */
 Connection::~Connection()
 {
-	// Stop connection
-	Disconnect();
+	// Stop connection, buffered data which wasn't sent yet is lost
+	Shutdown();
+	MutexGuard cMutexGuard(m_cSendMutex);
+	ClearSendQueue();
 }
 
 /**
@@ -154,8 +325,8 @@ bool Connection::Connect(const String &sHost, uint32 nPort)
 				OnConnect();
 				m_pHost->OnConnect(*this);
 
-				// Start connection thread
-				Start();
+				// Start receiving data
+				StartReceiving();
 
 				// Done
 				return true;
@@ -193,8 +364,8 @@ bool Connection::Connect(Socket &cSocket)
 	OnConnect();
 	m_pHost->OnConnect(*this);
 
-	// Start connection thread
-	Start();
+	// Start receiving data
+	StartReceiving();
 
 	// Done
 	return true;
@@ -284,6 +455,212 @@ bool Connection::ReceiveData()
 }
 
 
+/**
+*  @brief
+*    Start receiving data after the connection has been established
+*/
+void Connection::StartReceiving()
+{
+	// Use event driven network I/O if the host is using I/O threads
+	if (m_nReceiveMode == ReceiveAutomatic) {
+		Reactor *pReactor = m_pHost->GetReactor();
+		if (pReactor && pReactor->AddConnection(*this))
+			return; // Done
+	}
+
+	// Start connection thread
+	Start();
+}
+
+/**
+*  @brief
+*    Unregister the connection from the reactor
+*/
+void Connection::StopEventDrivenIO()
+{
+	// Forget the reactor, then unregister the connection, which waits until the I/O thread is no longer
+	// accessing the connection (the send mutex must not be locked while waiting, the I/O thread may need it)
+	Reactor *pReactor;
+	{
+		MutexGuard cMutexGuard(m_cSendMutex);
+		pReactor   = m_pReactor;
+		m_pReactor = nullptr;
+		m_bDisconnectPending = false;
+	}
+	if (pReactor)
+		pReactor->RemoveConnection(*this);
+}
+
+/**
+*  @brief
+*    Close the connection at once
+*/
+bool Connection::CloseConnection()
+{
+	// Are we still connected? (the I/O thread and the user may close the connection at the same time)
+	bool bConnected;
+	{
+		MutexGuard cMutexGuard(m_cSendMutex);
+		bConnected   = m_bConnected;
+		m_bConnected = false;
+	}
+	if (bConnected) {
+		// Unregister the connection from the reactor, data which wasn't sent yet is lost
+		StopEventDrivenIO();
+		{
+			MutexGuard cMutexGuard(m_cSendMutex);
+			ClearSendQueue();
+		}
+
+		// Close connection
+		m_cSocket.Close();
+
+		// Emit disconnect event
+		OnDisconnect();
+		m_pHost->OnDisconnect(*this);
+
+		// Done
+		return true;
+	}
+
+	// Error!
+	return false;
+}
+
+/**
+*  @brief
+*    Close the connection at once and wait until no I/O thread or connection thread is accessing the connection any longer
+*/
+void Connection::Shutdown()
+{
+	// Close the connection if it's still connected
+	CloseConnection();
+
+	// The I/O thread may have closed the connection by itself and may still be within a callback of the connection
+	// (the connection is no longer registered at this point, so this is independent of the connection status)
+	if (m_pIOReactor)
+		m_pIOReactor->WaitForIOThread(m_nIOThread);
+
+	// The same is true for the connection thread, it leaves as soon as it notices that the connection was closed
+	if (IsActive() && GetID() != System::GetInstance()->GetCurrentThreadID())
+		Join();
+}
+
+/**
+*  @brief
+*    Send as much of the data waiting to be sent as possible
+*/
+bool Connection::SendQueuedData() const
+{
+	for (;;) {
+		// Buffered data in front of the next file is sent first
+		QueuedFile *pQueuedFile = m_lstSendFiles.GetNumOfElements() ? m_lstSendFiles[0] : nullptr;
+		const uint32 nBuffered = pQueuedFile ? static_cast<uint32>(pQueuedFile->nSendPosition - m_nSendBufferRemoved) : m_cSendBuffer.GetUsedSize();
+		const char *pData;
+		uint32 nSize;
+		if (nBuffered) {
+			pData = m_cSendBuffer.GetData();
+			nSize = nBuffered;
+		} else if (pQueuedFile) {
+			pData = reinterpret_cast<const char*>(pQueuedFile->pFile->GetMemoryBuffer()) + pQueuedFile->nOffset;
+			nSize = pQueuedFile->nSize;
+		} else {
+			// Done, everything was sent
+			return true;
+		}
+
+		// Send
+		const int nSent = m_pReactor ? Reactor::Send(m_cSocket, pData, nSize) : m_cSocket.Send(pData, nSize);
+		if (nSent < 0 || (!nSent && !m_pReactor))
+			return false; // Error!
+		if (nBuffered) {
+			m_cSendBuffer.Remove(nSent);
+			m_nSendBufferRemoved += nSent;
+		} else {
+			pQueuedFile->nOffset += nSent;
+			pQueuedFile->nSize   -= nSent;
+			if (!pQueuedFile->nSize) {
+				delete pQueuedFile->pFile;
+				delete pQueuedFile;
+				m_lstSendFiles.RemoveAtIndex(0);
+			}
+		}
+
+		// Socket would block?
+		if (static_cast<uint32>(nSent) < nSize)
+			return true; // Done
+	}
+}
+
+/**
+*  @brief
+*    Destroy all data waiting to be sent
+*/
+void Connection::ClearSendQueue() const
+{
+	m_cSendBuffer.Clear();
+	m_nSendBufferRemoved = 0;
+	for (uint32 i=0; i<m_lstSendFiles.GetNumOfElements(); i++) {
+		delete m_lstSendFiles[i]->pFile;
+		delete m_lstSendFiles[i];
+	}
+	m_lstSendFiles.Clear();
+}
+
+/**
+*  @brief
+*    Called by the reactor when the socket is readable
+*/
+void Connection::OnReadable()
+{
+	// Receive all waiting data
+	char szBuffer[4096];
+	while (m_bConnected) {
+		const int nBytes = Reactor::Receive(m_cSocket, szBuffer, 4096);
+		if (nBytes > 0) {
+			OnReceive(szBuffer, nBytes);
+
+			// If the buffer wasn't filled completely, there's no more data waiting
+			if (nBytes < 4096)
+				break;
+		} else {
+			// Close the connection if it was closed by the other side or on error
+			if (nBytes < 0)
+				CloseConnection();
+			break;
+		}
+	}
+}
+
+/**
+*  @brief
+*    Called by the reactor when the socket is writable
+*/
+void Connection::OnWritable()
+{
+	bool bClose = false;
+	{
+		MutexGuard cMutexGuard(m_cSendMutex);
+		if (m_pReactor) {
+			// Send as much data as possible
+			if (!SendQueuedData())
+				bClose = true;	// Error!
+
+			// Everything sent? Then stop waiting until the socket is writable and perform a pending disconnect.
+			else if (IsSendQueueEmpty()) {
+				m_pReactor->UpdateConnection(*this, false);
+				if (m_bDisconnectPending)
+					bClose = true;
+			}
+		}
+	}
+
+	// Close the connection, the send mutex must not be locked while doing so
+	if (bClose)
+		CloseConnection();
+}
+
+
 //[-------------------------------------------------------]
 //[ Private virtual ThreadFunction functions              ]
 //[-------------------------------------------------------]
@@ -25,7 +25,9 @@
 //[-------------------------------------------------------]
 //[ Includes                                              ]
 //[-------------------------------------------------------]
+#include "PLCore/System/MutexGuard.h"
 #include "PLCore/Network/Connection.h"
+#include "PLCore/Network/Reactor.h"
 #include "PLCore/Network/Host.h"
 
 
@@ -53,7 +55,9 @@ Host::Host() :
 	m_cServerThread(*this),
 	m_bListening(false),
 	m_nPort(0),
-	m_nMaxConnections(0)
+	m_nMaxConnections(0),
+	m_nNumOfIOThreads(0),
+	m_pReactor(nullptr)
 {
 }
 
@@ -65,6 +69,10 @@ Host::~Host()
 {
 	// Close host
 	Close();
+
+	// Stop the I/O threads, all connections are closed at this point
+	if (m_pReactor)
+		delete m_pReactor;
 }
 
 /**
@@ -148,10 +156,11 @@ void Host::CloseConnections()
 		lstToRemove.Add(pConnection);
 	}
 
-	// Remove connections
+	// Remove connections, shut them down first so no I/O thread is within a callback of a partly destroyed connection
 	cIterator = lstToRemove.GetIterator();
 	while (cIterator.HasNext()) {
 		Connection *pConnection = cIterator.Next();
+		pConnection->Shutdown();
 		delete pConnection;
 	}
 	m_lstConnections.Clear();
@@ -172,16 +181,30 @@ void Host::RemoveInactiveConnections()
 			lstToRemove.Add(pConnection);
 	}
 
-	// Remove inactive connections
+	// Remove inactive connections, the I/O thread which has closed a connection may still be within a callback of it
 	cIterator = lstToRemove.GetIterator();
 	while (cIterator.HasNext()) {
 		Connection *pConnection = cIterator.Next();
 		m_lstConnections.Remove(pConnection);
+		pConnection->Shutdown();
 		delete pConnection;
 	}
 }
 
 
+/**
+*  @brief
+*    Sets the number of I/O threads used for event driven network I/O
+*/
+void Host::SetNumOfIOThreads(uint32 nNumOfIOThreads)
+{
+	// Changes after the reactor was created are ignored
+	MutexGuard cMutexGuard(m_cReactorMutex);
+	if (!m_pReactor)
+		m_nNumOfIOThreads = nNumOfIOThreads;
+}
+
+
 //[-------------------------------------------------------]
 //[ Protected virtual Host functions                      ]
 //[-------------------------------------------------------]
@@ -235,7 +258,9 @@ Host::Host(const Host &cSource) :
 	m_cServerThread(*this),
 	m_bListening(false),
 	m_nPort(0),
-	m_nMaxConnections(0)
+	m_nMaxConnections(0),
+	m_nNumOfIOThreads(0),
+	m_pReactor(nullptr)
 {
 	// No implementation because the copy constructor is never used
 }
@@ -285,6 +310,22 @@ void Host::CheckNewConnections()
 }
 
 
+/**
+*  @brief
+*    Returns the reactor used for event driven network I/O
+*/
+Reactor *Host::GetReactor()
+{
+	// Create the reactor on the first request
+	MutexGuard cMutexGuard(m_cReactorMutex);
+	if (!m_pReactor && m_nNumOfIOThreads && Reactor::IsSupported())
+		m_pReactor = new Reactor(m_nNumOfIOThreads);
+
+	// Return the reactor
+	return m_pReactor;
+}
+
+
 //[-------------------------------------------------------]
 //[ Server thread class                                   ]
 //[-------------------------------------------------------]
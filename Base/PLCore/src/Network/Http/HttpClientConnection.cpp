@@ -101,9 +101,9 @@ void HttpClientConnection::OnReceive(const char *pBuffer, uint32 nSize)
 		// Add data to buffer
 		m_cBuffer.Add(pBuffer, nSize);
 
-		// Read lines from buffer
+		// Read lines from buffer, the received data may contain more than the header
 		String sLine = m_cBuffer.GetLine();
-		while (sLine.GetLength()) {
+		while (sLine.GetLength() && !m_cHttpHeader.IsComplete()) {
 			// Add line to HTTP message
 			m_cHttpHeader.AddEntry(sLine);
 			if (m_cHttpHeader.IsComplete()) {
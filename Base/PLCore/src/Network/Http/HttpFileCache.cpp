@@ -0,0 +1,254 @@
+/*********************************************************\
+ *  File: HttpFileCache.cpp                              *
+ *
+ *  Copyright (C) 2002-2013 The PixelLight Team (http://www.pixellight.org/)
+ *
+ *  This file is part of PixelLight.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ *  and associated documentation files (the "Software"), to deal in the Software without
+ *  restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ *  Software is furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all copies or
+ *  substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ *  BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ *  DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ *  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include "PLCore/File/File.h"
+#include "PLCore/System/MutexGuard.h"
+#include "PLCore/Network/Http/HttpFileCache.h"
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace PLCore {
+
+
+//[-------------------------------------------------------]
+//[ Public functions                                      ]
+//[-------------------------------------------------------]
+/**
+*  @brief
+*    Constructor
+*/
+HttpFileCache::HttpFileCache() :
+	m_nMaxSize(16*1024*1024),
+	m_nMaxFileSize(64*1024),
+	m_nSize(0),
+	m_pFirst(nullptr),
+	m_pLast(nullptr)
+{
+}
+
+/**
+*  @brief
+*    Destructor
+*/
+HttpFileCache::~HttpFileCache()
+{
+	// Remove all files from the cache
+	Clear();
+}
+
+/**
+*  @brief
+*    Set the maximum size of all cached files together
+*/
+void HttpFileCache::SetMaxSize(uint32 nMaxSize)
+{
+	MutexGuard cMutexGuard(m_cMutex);
+	m_nMaxSize = nMaxSize;
+	Shrink(m_nMaxSize);
+}
+
+/**
+*  @brief
+*    Remove all files from the cache
+*/
+void HttpFileCache::Clear()
+{
+	MutexGuard cMutexGuard(m_cMutex);
+	Shrink(0);
+}
+
+/**
+*  @brief
+*    Get a cached file
+*/
+const HttpFileCache::Entry *HttpFileCache::Get(const String &sFilename, uint64 nModificationTime)
+{
+	MutexGuard cMutexGuard(m_cMutex);
+
+	// Is the file cached?
+	Entry *pEntry = m_mapEntries.Get(sFilename);
+	if (pEntry) {
+		// Was the file modified since it was cached?
+		if (pEntry->nModificationTime != nModificationTime || !nModificationTime) {
+			// Remove the outdated content
+			RemoveEntry(*pEntry);
+		} else {
+			// Make the entry the most recently used one
+			if (pEntry->pPrevious) {
+				pEntry->pPrevious->pNext = pEntry->pNext;
+				if (pEntry->pNext)
+					pEntry->pNext->pPrevious = pEntry->pPrevious;
+				else
+					m_pLast = pEntry->pPrevious;
+				pEntry->pPrevious = nullptr;
+				pEntry->pNext	  = m_pFirst;
+				m_pFirst->pPrevious = pEntry;
+				m_pFirst = pEntry;
+			}
+
+			// Done
+			pEntry->nRefCount++;
+			return pEntry;
+		}
+	}
+
+	// Error, the file is not cached!
+	return nullptr;
+}
+
+/**
+*  @brief
+*    Add a file to the cache
+*/
+const HttpFileCache::Entry *HttpFileCache::Add(const String &sFilename, uint64 nModificationTime, File &cFile)
+{
+	// Can the file be cached? Without a modification time, it's impossible to know whether or not the cached content is outdated.
+	const int32 nPosition = cFile.Tell();
+	const uint32 nSize = (nPosition >= 0 && static_cast<uint32>(nPosition) <= cFile.GetSize()) ? cFile.GetSize() - nPosition : 0;
+	if (!m_nMaxSize || !nModificationTime || nSize > m_nMaxFileSize || nSize > m_nMaxSize || !cFile.IsReadable())
+		return nullptr; // Error!
+
+	// Read the file content, the mutex isn't locked while doing so
+	uint8 *pnData = new uint8[nSize ? nSize : 1];
+	if (nSize && cFile.Read(pnData, 1, nSize) != nSize) {
+		// Error!
+		delete [] pnData;
+		return nullptr;
+	}
+
+	// Create the entry
+	Entry *pEntry = new Entry;
+	pEntry->sFilename		  = sFilename;
+	pEntry->nModificationTime = nModificationTime;
+	pEntry->pnData			  = pnData;
+	pEntry->nSize			  = nSize;
+	pEntry->nRefCount		  = 1;
+	pEntry->bCached			  = true;
+	pEntry->pPrevious		  = nullptr;
+
+	// Replace a previously cached content of the file and add the entry as the most recently used one
+	MutexGuard cMutexGuard(m_cMutex);
+	Entry *pOldEntry = m_mapEntries.Get(sFilename);
+	if (pOldEntry)
+		RemoveEntry(*pOldEntry);
+	Shrink((nSize < m_nMaxSize) ? m_nMaxSize - nSize : 0);
+	m_mapEntries.Add(sFilename, pEntry);
+	pEntry->pNext = m_pFirst;
+	if (m_pFirst)
+		m_pFirst->pPrevious = pEntry;
+	else
+		m_pLast = pEntry;
+	m_pFirst = pEntry;
+	m_nSize += nSize;
+
+	// Done
+	return pEntry;
+}
+
+/**
+*  @brief
+*    Release a file returned by "Get()" or "Add()"
+*/
+void HttpFileCache::Release(const Entry &cEntry)
+{
+	MutexGuard cMutexGuard(m_cMutex);
+	Entry &cUsedEntry = const_cast<Entry&>(cEntry);
+	cUsedEntry.nRefCount--;
+
+	// Destroy the entry if it was removed from the cache while it was used
+	if (!cUsedEntry.bCached && !cUsedEntry.nRefCount) {
+		delete [] cUsedEntry.pnData;
+		delete &cUsedEntry;
+	}
+}
+
+
+//[-------------------------------------------------------]
+//[ Private functions                                     ]
+//[-------------------------------------------------------]
+/**
+*  @brief
+*    Copy constructor
+*/
+HttpFileCache::HttpFileCache(const HttpFileCache &cSource)
+{
+	// No implementation because the copy constructor is never used
+}
+
+/**
+*  @brief
+*    Copy operator
+*/
+HttpFileCache &HttpFileCache::operator =(const HttpFileCache &cSource)
+{
+	// No implementation because the copy operator is never used
+	return *this;
+}
+
+/**
+*  @brief
+*    Remove an entry from the cache
+*/
+void HttpFileCache::RemoveEntry(Entry &cEntry)
+{
+	// Unlink the entry
+	if (cEntry.pPrevious)
+		cEntry.pPrevious->pNext = cEntry.pNext;
+	else
+		m_pFirst = cEntry.pNext;
+	if (cEntry.pNext)
+		cEntry.pNext->pPrevious = cEntry.pPrevious;
+	else
+		m_pLast = cEntry.pPrevious;
+	m_mapEntries.Remove(cEntry.sFilename);
+	m_nSize -= cEntry.nSize;
+	cEntry.bCached = false;
+
+	// Destroy the entry right now if it's not used, else this is done by "Release()"
+	if (!cEntry.nRefCount) {
+		delete [] cEntry.pnData;
+		delete &cEntry;
+	}
+}
+
+/**
+*  @brief
+*    Remove least recently used entries until the cache size is within the given limit
+*/
+void HttpFileCache::Shrink(uint32 nMaxSize)
+{
+	while (m_pLast && m_nSize > nMaxSize)
+		RemoveEntry(*m_pLast);
+}
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+} // PLCore
@@ -188,6 +188,7 @@ bool HttpHeader::IsComplete() const
 void HttpHeader::Parse()
 {
 	// Loop through header entries
+	bool bConnection = false;
 	for (uint32 i=0; i<m_lstEntries.GetNumOfElements(); i++) {
 		// Get line
 		const String sLine = m_lstEntries.Get(i);
@@ -248,6 +249,7 @@ void HttpHeader::Parse()
 		// Connection type
 		if (sLine.GetSubstring(0, 11) == "Connection:") {
 			const String sConnection = sLine.GetSubstring(12);
+			bConnection = true;
 			if (sConnection == "close")
 				m_nConnection = ConnectionClose;
 			else
@@ -342,12 +344,30 @@ void HttpHeader::Parse()
 			}
 		}
 
+		// Requested range (only a single byte range is supported, e.g. "21010-" or "21010-47021")
+		if (sLine.GetSubstring(0, 12) == "Range: bytes") {
+			const String sRange = sLine.GetSubstring(13);
+			const int nPosMinus = sRange.IndexOf('-');
+			if (nPosMinus > 0 && sRange.IndexOf(',') < 0) {
+				const String sRangeMax = sRange.GetSubstring(nPosMinus+1);
+				m_bPartial	= true;
+				m_nRangeMin = sRange.GetSubstring(0, nPosMinus).GetUInt32();
+				m_nRangeMax = sRangeMax.GetLength() ? sRangeMax.GetUInt32() : 0xFFFFFFFF;
+				if (m_nRangeMax < m_nRangeMin)
+					m_bPartial = false;
+			}
+		}
+
 		// ETag
 		if (sLine.GetSubstring(0, 5) == "ETag:") {
 			const String sETag = sLine.GetSubstring(6);
 			m_sETag = sETag.GetSubstring(1, sETag.GetLength()-2);
 		}
 	}
+
+	// HTTP 1.1 requests keep the connection open by default
+	if (!bConnection && m_nMessageType == HttpRequest && m_nProtocol == Http11)
+		m_nConnection = ConnectionKeepAlive;
 }
 
 /**
@@ -55,6 +55,15 @@ HttpServer::~HttpServer()
 {
 }
 
+/**
+*  @brief
+*    Get the cache for the content of small files sent by "HttpServerConnection::SendFile()"
+*/
+HttpFileCache &HttpServer::GetFileCache()
+{
+	return m_cFileCache;
+}
+
 
 //[-------------------------------------------------------]
 //[ Protected virtual HttpServer functions                ]
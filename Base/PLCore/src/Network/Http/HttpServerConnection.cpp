@@ -25,6 +25,7 @@
 //[-------------------------------------------------------]
 //[ Includes                                              ]
 //[-------------------------------------------------------]
+#include "PLCore/Core/MemoryManager.h"
 #include "PLCore/File/File.h"
 #include "PLCore/System/System.h"
 #include "PLCore/Network/Http/HttpServer.h"
@@ -46,7 +47,8 @@ namespace PLCore {
 *    Constructor
 */
 HttpServerConnection::HttpServerConnection(HttpServer &cServer) : Connection(static_cast<Host&>(cServer)),
-	m_pServer(&cServer)
+	m_pServer(&cServer),
+	m_bKeepAlive(false)
 {
 }
 
@@ -64,32 +66,66 @@ HttpServerConnection::~HttpServerConnection()
 */
 void HttpServerConnection::SendFile(EHttpStatus nStatus, const String &sFilename)
 {
-	// Open file
-	File cFile(sFilename);
-	if (cFile.Open(File::FileRead)) {
-		// Send header
-		SendHeader(nStatus, MimeTypeManager::GetMimeType(sFilename), cFile.GetSize());
-
-		// Read in chunks of 256 bytes
-		char szBuffer[256];
-		while (!cFile.IsEof()) {
-			// Read from file
-			const uint32 nSize = cFile.Read(szBuffer, 1, 255);
-
-			// Send
-			if (nSize > 0)
-				Send(szBuffer, nSize);
+	// Is the content of the file cached? A cached content is only used if the file wasn't modified since it was cached.
+	File *pFile = new File(sFilename);
+	HttpFileCache &cFileCache = m_pServer->GetFileCache();
+	const uint64 nModificationTime = pFile->GetModificationTime();
+	const HttpFileCache::Entry *pEntry = cFileCache.Get(sFilename, nModificationTime);
+	if (!pEntry) {
+		// Open the file memory mapped so that large files can be sent without copying them
+		if (!pFile->Open(File::FileRead | File::FileMemMap)) {
+			// Error: File not found
+			delete pFile;
+			SendError(Http_404_NotFound);
+			return;
 		}
 
-		// Close file
-		cFile.Close();
+		// Add the content of small files to the cache
+		pEntry = cFileCache.Add(sFilename, nModificationTime, *pFile);
+	}
+	const uint32 nFileSize = pEntry ? pEntry->nSize : pFile->GetSize();
+
+	// Send only the requested range?
+	uint32 nOffset = 0;
+	uint32 nSize   = nFileSize;
+	String sFields = "Accept-Ranges: bytes\r\n";
+	if (nStatus == Http_200_OK && m_cHttpHeader.IsPartial()) {
+		if (m_cHttpHeader.GetRangeMin() < nFileSize) {
+			nOffset = m_cHttpHeader.GetRangeMin();
+			nSize   = ((m_cHttpHeader.GetRangeMax() < nFileSize) ? m_cHttpHeader.GetRangeMax() + 1 : nFileSize) - nOffset;
+			nStatus = Http_206_PartialContent;
+			sFields += "Content-Range: bytes " + String() + nOffset + '-' + (nOffset + nSize - 1) + '/' + nFileSize + "\r\n";
+		} else {
+			// Error: The range is not within the file
+			if (pEntry)
+				cFileCache.Release(*pEntry);
+			delete pFile;
+			Send(CreateHeader(Http_416_RequestedRangeNotSatisfiable, "", 0, "Content-Range: bytes */" + String() + nFileSize + "\r\n"));
+			FinishResponse();
+			return;
+		}
+	}
 
-		// Close connection
-		Disconnect();
+	// Send header
+	const String sHeader = CreateHeader(nStatus, MimeTypeManager::GetMimeType(sFilename), nSize, sFields);
+	if (pEntry) {
+		// Send the header and the cached content at once
+		const uint32 nHeaderSize = sHeader.GetLength();
+		char *pBuffer = new char[nHeaderSize + nSize];
+		MemoryManager::Copy(pBuffer, sHeader.GetASCII(), nHeaderSize);
+		MemoryManager::Copy(pBuffer + nHeaderSize, pEntry->pnData + nOffset, nSize);
+		Send(pBuffer, nHeaderSize + nSize);
+		delete [] pBuffer;
+		cFileCache.Release(*pEntry);
+		delete pFile;
 	} else {
-		// Error: File not found
-		SendError(Http_404_NotFound);
+		// Send the header and the file out of the memory mapping, the connection destroys the file after it has been sent
+		Send(sHeader);
+		SendFileRange(pFile, nOffset, nSize);
 	}
+
+	// Done
+	FinishResponse();
 }
 
 /**
@@ -98,14 +134,13 @@ void HttpServerConnection::SendFile(EHttpStatus nStatus, const String &sFilename
 */
 void HttpServerConnection::SendData(EHttpStatus nStatus, const String &sMimeType, const String &sContent)
 {
-	// Send header
-	SendHeader(nStatus, sMimeType, sContent.GetLength());
+	// Send header and page at once, without content the connection is closed afterwards
+	if (!sContent.GetLength())
+		m_bKeepAlive = false;
+	Send(CreateHeader(nStatus, sMimeType, sContent.GetLength()) + sContent);
 
-	// Send page
-	Send(sContent);
-
-	// Close connection
-	Disconnect();
+	// Done
+	FinishResponse();
 }
 
 /**
@@ -114,26 +149,11 @@ void HttpServerConnection::SendData(EHttpStatus nStatus, const String &sMimeType
 */
 void HttpServerConnection::SendRedirect(const String &sLocation)
 {
-	// HTTP protocol version and status
-	Send("HTTP/1.1 " + Http::GetStatusString(Http_301_MovedPermanently) + "\r\n");
+	// Send header with the redirect location
+	Send(CreateHeader(Http_301_MovedPermanently, "", 0, "Location: " + sLocation + "\r\n"));
 
-	// Date
-	Send("Date: " + System::GetInstance()->GetTime().ToString() + "\r\n");
-
-	// Redirect location
-	Send("Location: " + sLocation + "\r\n");
-
-	// Server identification
-	Send("Server: PixelLight HTTP Server\r\n");
-
-	// Connection type
-	Send("Connection: close\r\n");
-
-	// End header
-	Send("\r\n");
-
-	// Close
-	Disconnect();
+	// Done
+	FinishResponse();
 }
 
 /**
@@ -158,28 +178,10 @@ void HttpServerConnection::SendError(EHttpStatus nStatus)
 */
 void HttpServerConnection::SendHeader(EHttpStatus nStatus, const String &sMimeType, uint32 nLength)
 {
-	// HTTP protocol version and status
-	Send("HTTP/1.1 " + Http::GetStatusString(nStatus) + "\r\n");
-
-	// Date
-	Send("Date: " + System::GetInstance()->GetTime().ToString() + "\r\n");
-
-	// Content type
-	if (sMimeType.GetLength())
-		Send("Content-Type: " + sMimeType + "; charset=ISO-8859-1\r\n");
-
-	// Content length
-	if (nLength > 0)
-		Send("Content-Length: " + String() + nLength + "\r\n");
-
-	// Server identification
-	Send("Server: PixelLight HTTP Server\r\n");
-
-	// Connection type
-	Send("Connection: close\r\n");
-
-	// End header
-	Send("\r\n");
+	// Without content length, the end of the content is marked by closing the connection
+	if (!nLength)
+		m_bKeepAlive = false;
+	Send(CreateHeader(nStatus, sMimeType, nLength));
 }
 
 
@@ -212,6 +214,7 @@ void HttpServerConnection::OnConnect()
 
 	// Initialize HTTP header
 	m_cHttpHeader.Clear();
+	m_bKeepAlive = false;
 }
 
 void HttpServerConnection::OnDisconnect()
@@ -228,7 +231,7 @@ void HttpServerConnection::OnReceive(const char *pBuffer, uint32 nSize)
 		// Add data to buffer
 		m_cBuffer.Add(pBuffer, nSize);
 
-		// Read lines from buffer
+		// Read lines from buffer, there may be multiple requests (pipelining)
 		String sLine = m_cBuffer.GetLine();
 		while (sLine.GetLength()) {
 			// Add line to HTTP header
@@ -237,8 +240,18 @@ void HttpServerConnection::OnReceive(const char *pBuffer, uint32 nSize)
 				// Parse header information
 				m_cHttpHeader.Parse();
 
+				// Keep the connection open? Request content isn't supported, so the connection is closed after such a request.
+				m_bKeepAlive = (m_cHttpHeader.GetConnectionType() == ConnectionKeepAlive && !m_cHttpHeader.GetContentLength());
+
 				// Process HTTP request
 				OnHttpRequest(m_cHttpHeader);
+
+				// Stop if the connection is closed, the header stays complete so no further requests are processed
+				if (!m_bKeepAlive || !IsConnected())
+					break;
+
+				// Prepare for the next request
+				m_cHttpHeader.Clear();
 			}
 
 			// Next line
@@ -248,6 +261,57 @@ void HttpServerConnection::OnReceive(const char *pBuffer, uint32 nSize)
 }
 
 
+//[-------------------------------------------------------]
+//[ Private functions                                     ]
+//[-------------------------------------------------------]
+/**
+*  @brief
+*    Create HTTP header
+*/
+String HttpServerConnection::CreateHeader(EHttpStatus nStatus, const String &sMimeType, uint32 nLength, const String &sFields) const
+{
+	// HTTP protocol version and status
+	String sHeader = "HTTP/1.1 " + Http::GetStatusString(nStatus) + "\r\n";
+
+	// Date
+	sHeader += "Date: " + System::GetInstance()->GetTime().ToString() + "\r\n";
+
+	// Content type
+	if (sMimeType.GetLength())
+		sHeader += "Content-Type: " + sMimeType + "; charset=ISO-8859-1\r\n";
+
+	// Content length, required to keep the connection open
+	if (nLength > 0 || m_bKeepAlive)
+		sHeader += "Content-Length: " + String() + nLength + "\r\n";
+
+	// Additional header fields
+	sHeader += sFields;
+
+	// Server identification
+	sHeader += "Server: PixelLight HTTP Server\r\n";
+
+	// Connection type
+	sHeader += m_bKeepAlive ? "Connection: keep-alive\r\n" : "Connection: close\r\n";
+
+	// End header
+	sHeader += "\r\n";
+
+	// Done
+	return sHeader;
+}
+
+/**
+*  @brief
+*    Finish the response to the current request
+*/
+void HttpServerConnection::FinishResponse()
+{
+	// Close connection if it's not kept open
+	if (!m_bKeepAlive)
+		Disconnect();
+}
+
+
 //[-------------------------------------------------------]
 //[ Namespace                                             ]
 //[-------------------------------------------------------]
@@ -0,0 +1,475 @@
+/*********************************************************\
+ *  File: Reactor.cpp                                    *
+ *
+ *  Copyright (C) 2002-2013 The PixelLight Team (http://www.pixellight.org/)
+ *
+ *  This file is part of PixelLight.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ *  and associated documentation files (the "Software"), to deal in the Software without
+ *  restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ *  Software is furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all copies or
+ *  substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ *  BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ *  DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ *  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#if defined(LINUX) && !defined(APPLE)
+	#include <errno.h>
+	#include <fcntl.h>
+	#include <unistd.h>
+	#include <sys/epoll.h>
+	#include <sys/eventfd.h>
+	#include <sys/socket.h>
+	#define PLCORE_REACTOR_EPOLL
+#endif
+#include "PLCore/System/System.h"
+#include "PLCore/System/MutexGuard.h"
+#include "PLCore/Network/Connection.h"
+#include "PLCore/Network/Reactor.h"
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace PLCore {
+
+
+//[-------------------------------------------------------]
+//[ Local definitions                                     ]
+//[-------------------------------------------------------]
+static const uint32 MaxNumOfEvents = 64;	/**< Maximum number of events an I/O thread is dispatching at once */
+static const int	PollTimeout    = 100;	/**< Poll timeout in milliseconds, the I/O threads check for shutdown after this time */
+static const uint32 NoSlot		   = 0xFFFFFFFF;	/**< Queue entry of an I/O thread just waiting for another one */
+static const uint64 WakeUpHandle   = 0xFFFFFFFFFFFFFFFFULL;	/**< Poll event data of the wake up event, never a valid connection handle */
+
+
+//[-------------------------------------------------------]
+//[ Public static functions                               ]
+//[-------------------------------------------------------]
+/**
+*  @brief
+*    Returns whether or not event driven network I/O is supported on this platform
+*/
+bool Reactor::IsSupported()
+{
+	#ifdef PLCORE_REACTOR_EPOLL
+		return true;
+	#else
+		return false;
+	#endif
+}
+
+
+//[-------------------------------------------------------]
+//[ Private functions                                     ]
+//[-------------------------------------------------------]
+/**
+*  @brief
+*    Constructor
+*/
+Reactor::Reactor(uint32 nNumOfThreads) :
+	m_ppThreads(nullptr),
+	m_nNumOfThreads(0),
+	m_nNextThread(0),
+	m_bShutdown(false)
+{
+	// Start the I/O threads
+	if (IsSupported()) {
+		m_nNumOfThreads = nNumOfThreads ? nNumOfThreads : 1;
+		m_ppThreads = new IOThread*[m_nNumOfThreads];
+		for (uint32 i=0; i<m_nNumOfThreads; i++) {
+			IOThread *pThread = new IOThread(*this);
+			m_ppThreads[i] = pThread;
+			pThread->Start();
+
+			// Remember the ID of the I/O thread so calls from within the callbacks of the connections can be detected, the
+			// I/O thread only reads it while dispatching events, which it does while the mutex is locked
+			MutexGuard cMutexGuard(pThread->m_cMutex);
+			pThread->m_nThreadID = pThread->GetID();
+		}
+	}
+}
+
+/**
+*  @brief
+*    Destructor
+*/
+Reactor::~Reactor()
+{
+	// Stop the I/O threads
+	if (m_ppThreads) {
+		m_bShutdown = true;
+		for (uint32 i=0; i<m_nNumOfThreads; i++) {
+			m_ppThreads[i]->Join();
+			delete m_ppThreads[i];
+		}
+		delete [] m_ppThreads;
+	}
+}
+
+/**
+*  @brief
+*    Copy constructor
+*/
+Reactor::Reactor(const Reactor &cSource) :
+	m_ppThreads(nullptr),
+	m_nNumOfThreads(0),
+	m_nNextThread(0),
+	m_bShutdown(false)
+{
+	// No implementation because the copy constructor is never used
+}
+
+/**
+*  @brief
+*    Copy operator
+*/
+Reactor &Reactor::operator =(const Reactor &cSource)
+{
+	// No implementation because the copy operator is never used
+	return *this;
+}
+
+/**
+*  @brief
+*    Returns the I/O thread of the reactor the caller is running in
+*/
+uint32 Reactor::GetCurrentIOThread() const
+{
+	const handle nThreadID = System::GetInstance()->GetCurrentThreadID();
+	for (uint32 i=0; i<m_nNumOfThreads; i++) {
+		if (m_ppThreads[i]->m_nThreadID == nThreadID)
+			return i;
+	}
+
+	// The caller is not running within an I/O thread of this reactor
+	return m_nNumOfThreads;
+}
+
+/**
+*  @brief
+*    Registers a connection
+*/
+bool Reactor::AddConnection(Connection &cConnection)
+{
+	#ifdef PLCORE_REACTOR_EPOLL
+		// Switch the socket into non-blocking mode
+		const int nSocket = static_cast<int>(cConnection.m_cSocket.m_nSocket);
+		const int nFlags = fcntl(nSocket, F_GETFL, 0);
+		if (nFlags >= 0 && fcntl(nSocket, F_SETFL, nFlags | O_NONBLOCK) >= 0) {
+			// Connections created within an I/O thread stay within this I/O thread, else distribute them round-robin
+			const uint32 nCurrentThread = GetCurrentIOThread();
+			uint32 nThread = nCurrentThread;
+			if (nThread >= m_nNumOfThreads) {
+				nThread = m_nNextThread%m_nNumOfThreads;
+				m_nNextThread = nThread + 1;
+			}
+			IOThread &cThread = *m_ppThreads[nThread];
+
+			// Get a free connection slot
+			if (nThread != nCurrentThread)
+				cThread.m_cMutex.Lock();
+			uint32 nSlot;
+			if (cThread.m_lstFreeSlots.GetNumOfElements()) {
+				nSlot = cThread.m_lstFreeSlots[cThread.m_lstFreeSlots.GetNumOfElements() - 1];
+				cThread.m_lstFreeSlots.RemoveAtIndex(cThread.m_lstFreeSlots.GetNumOfElements() - 1);
+				cThread.m_lstSlots[nSlot] = &cConnection;
+			} else {
+				nSlot = cThread.m_lstSlots.GetNumOfElements();
+				cThread.m_lstSlots.Add(&cConnection);
+				cThread.m_lstGenerations.Add(0);
+			}
+
+			// The handle of the connection consists of the slot index and the generation of the slot, so events
+			// which were already received for a connection removed in the meantime can be detected
+			cConnection.m_pReactor		 = this;
+			cConnection.m_pIOReactor	 = this;
+			cConnection.m_nIOThread		 = nThread;
+			cConnection.m_nReactorHandle = (static_cast<uint64>(cThread.m_lstGenerations[nSlot]) << 32) | nSlot;
+
+			// Wait for incoming data
+			epoll_event sEvent;
+			sEvent.events   = EPOLLIN | EPOLLRDHUP;
+			sEvent.data.u64 = cConnection.m_nReactorHandle;
+			const bool bResult = (epoll_ctl(static_cast<int>(cThread.m_nPoll), EPOLL_CTL_ADD, nSocket, &sEvent) == 0);
+			if (!bResult) {
+				// Error! Free the connection slot again.
+				cThread.FreeSlot(nSlot);
+				cConnection.m_pReactor = nullptr;
+				fcntl(nSocket, F_SETFL, nFlags);
+			}
+			if (nThread != nCurrentThread)
+				cThread.m_cMutex.Unlock();
+
+			// Done
+			return bResult;
+		}
+	#endif
+
+	// Error!
+	return false;
+}
+
+/**
+*  @brief
+*    Unregisters a connection
+*/
+void Reactor::RemoveConnection(Connection &cConnection)
+{
+	#ifdef PLCORE_REACTOR_EPOLL
+		IOThread &cThread = *m_ppThreads[cConnection.m_nIOThread];
+		const int nSocket = static_cast<int>(cConnection.m_cSocket.m_nSocket);
+		const uint32 nSlot = static_cast<uint32>(cConnection.m_nReactorHandle);
+
+		// Stop waiting for events, the system poll can be used by any thread
+		epoll_event sEvent;
+		epoll_ctl(static_cast<int>(cThread.m_nPoll), EPOLL_CTL_DEL, nSocket, &sEvent);
+
+		// Free the connection slot, events of the connection which were already received are skipped
+		const uint32 nCurrentThread = GetCurrentIOThread();
+		if (nCurrentThread == cConnection.m_nIOThread) {
+			// Called from within the I/O thread itself, its mutex is already locked
+			cThread.FreeSlot(nSlot);
+		} else if (nCurrentThread < m_nNumOfThreads) {
+			// Called from within another I/O thread which has its own mutex locked, locking the mutex of the I/O thread
+			// of the connection could deadlock if that I/O thread does the same the other way round
+			PostToIOThread(cConnection.m_nIOThread, nSlot);
+		} else {
+			// Wait until the I/O thread has finished dispatching its current events
+			MutexGuard cMutexGuard(cThread.m_cMutex);
+			cThread.FreeSlot(nSlot);
+		}
+
+		// Switch the socket back into blocking mode
+		const int nFlags = fcntl(nSocket, F_GETFL, 0);
+		if (nFlags >= 0)
+			fcntl(nSocket, F_SETFL, nFlags & ~O_NONBLOCK);
+	#endif
+}
+
+/**
+*  @brief
+*    Updates the events a registered connection is waiting for
+*/
+void Reactor::UpdateConnection(const Connection &cConnection, bool bWrite)
+{
+	#ifdef PLCORE_REACTOR_EPOLL
+		epoll_event sEvent;
+		sEvent.events   = bWrite ? (EPOLLIN | EPOLLRDHUP | EPOLLOUT) : (EPOLLIN | EPOLLRDHUP);
+		sEvent.data.u64 = cConnection.m_nReactorHandle;
+		epoll_ctl(static_cast<int>(m_ppThreads[cConnection.m_nIOThread]->m_nPoll), EPOLL_CTL_MOD, static_cast<int>(cConnection.m_cSocket.m_nSocket), &sEvent);
+	#endif
+}
+
+/**
+*  @brief
+*    Waits until an I/O thread has finished dispatching its current events
+*/
+void Reactor::WaitForIOThread(uint32 nIOThread)
+{
+	if (nIOThread < m_nNumOfThreads) {
+		const uint32 nCurrentThread = GetCurrentIOThread();
+		if (nCurrentThread == m_nNumOfThreads) {
+			// The I/O thread has the mutex locked while dispatching events
+			m_ppThreads[nIOThread]->m_cMutex.Lock();
+			m_ppThreads[nIOThread]->m_cMutex.Unlock();
+		} else if (nCurrentThread != nIOThread) {
+			// Called from within another I/O thread, don't lock the mutex of the I/O thread (see "RemoveConnection()")
+			PostToIOThread(nIOThread, NoSlot);
+		}
+	}
+}
+
+/**
+*  @brief
+*    Posts a slot to free to the queue of an I/O thread and waits until it was processed
+*/
+void Reactor::PostToIOThread(uint32 nIOThread, uint32 nSlot)
+{
+	#ifdef PLCORE_REACTOR_EPOLL
+		// Post, the queue entries are processed in order
+		IOThread &cThread = *m_ppThreads[nIOThread];
+		uint32 nTicket;
+		{
+			MutexGuard cQueueMutexGuard(cThread.m_cQueueMutex);
+			cThread.m_lstQueue.Add(nSlot);
+			nTicket = cThread.m_nNumOfProcessed + cThread.m_lstQueue.GetNumOfElements();
+		}
+
+		// Wake up the I/O thread in case it's waiting for events
+		eventfd_write(static_cast<int>(cThread.m_nWakeUp), 1);
+
+		// Wait, the I/O thread may be waiting for the current I/O thread as well, so process the own queue meanwhile
+		IOThread &cCurrentThread = *m_ppThreads[GetCurrentIOThread()];
+		for (;;) {
+			cCurrentThread.ProcessQueue();
+			{
+				MutexGuard cQueueMutexGuard(cThread.m_cQueueMutex);
+				if (static_cast<int>(cThread.m_nNumOfProcessed - nTicket) >= 0)
+					return; // Done
+			}
+			System::GetInstance()->Yield();
+		}
+	#endif
+}
+
+
+//[-------------------------------------------------------]
+//[ Private static functions                              ]
+//[-------------------------------------------------------]
+/**
+*  @brief
+*    Sends data using a non-blocking socket
+*/
+int Reactor::Send(const Socket &cSocket, const char *pBuffer, uint32 nSize)
+{
+	#ifdef PLCORE_REACTOR_EPOLL
+		// Don't raise "SIGPIPE" if the other side has closed the connection, just return an error
+		const int nResult = send(static_cast<int>(cSocket.m_nSocket), pBuffer, nSize, MSG_NOSIGNAL);
+		return (nResult < 0 && (errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR)) ? 0 : nResult;
+	#else
+		// Error!
+		return -1;
+	#endif
+}
+
+/**
+*  @brief
+*    Receives data using a non-blocking socket
+*/
+int Reactor::Receive(const Socket &cSocket, char *pBuffer, uint32 nSize)
+{
+	#ifdef PLCORE_REACTOR_EPOLL
+		const int nResult = recv(static_cast<int>(cSocket.m_nSocket), pBuffer, nSize, 0);
+		if (nResult > 0)
+			return nResult;
+		else if (!nResult)
+			return -1;	// The connection was closed by the other side
+		else
+			return (errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR) ? 0 : -1;
+	#else
+		// Error!
+		return -1;
+	#endif
+}
+
+
+//[-------------------------------------------------------]
+//[ Reactor::IOThread                                     ]
+//[-------------------------------------------------------]
+Reactor::IOThread::IOThread(Reactor &cReactor) :
+	m_cReactor(cReactor),
+	#ifdef PLCORE_REACTOR_EPOLL
+		m_nPoll(static_cast<handle>(epoll_create1(0))),
+		m_nWakeUp(static_cast<handle>(eventfd(0, EFD_NONBLOCK))),
+	#else
+		m_nPoll(NULL_HANDLE),
+		m_nWakeUp(NULL_HANDLE),
+	#endif
+	m_nThreadID(NULL_HANDLE),
+	m_nNumOfProcessed(0)
+{
+	// There may be a lot of connections, don't enlarge the slots by just a few elements
+	m_lstSlots.SetResizeCount(256);
+	m_lstGenerations.SetResizeCount(256);
+	m_lstFreeSlots.SetResizeCount(256);
+
+	#ifdef PLCORE_REACTOR_EPOLL
+		// Wait for the wake up event as well
+		if (static_cast<int>(m_nPoll) >= 0 && static_cast<int>(m_nWakeUp) >= 0) {
+			epoll_event sEvent;
+			sEvent.events   = EPOLLIN;
+			sEvent.data.u64 = WakeUpHandle;
+			epoll_ctl(static_cast<int>(m_nPoll), EPOLL_CTL_ADD, static_cast<int>(m_nWakeUp), &sEvent);
+		}
+	#endif
+}
+
+Reactor::IOThread::~IOThread()
+{
+	#ifdef PLCORE_REACTOR_EPOLL
+		if (static_cast<int>(m_nWakeUp) >= 0)
+			close(static_cast<int>(m_nWakeUp));
+		if (static_cast<int>(m_nPoll) >= 0)
+			close(static_cast<int>(m_nPoll));
+	#endif
+}
+
+void Reactor::IOThread::FreeSlot(uint32 nSlot)
+{
+	m_lstSlots[nSlot] = nullptr;
+	m_lstGenerations[nSlot]++;
+	m_lstFreeSlots.Add(nSlot);
+}
+
+void Reactor::IOThread::ProcessQueue()
+{
+	// Called by the I/O thread itself while its mutex is locked, so the slots can be freed
+	MutexGuard cQueueMutexGuard(m_cQueueMutex);
+	const uint32 nNumOfEntries = m_lstQueue.GetNumOfElements();
+	if (nNumOfEntries) {
+		for (uint32 i=0; i<nNumOfEntries; i++) {
+			if (m_lstQueue[i] != NoSlot)
+				FreeSlot(m_lstQueue[i]);
+		}
+		m_lstQueue.Reset();
+		m_nNumOfProcessed += nNumOfEntries;
+	}
+}
+
+int Reactor::IOThread::Run()
+{
+	#ifdef PLCORE_REACTOR_EPOLL
+		// Dispatch the events of the connections until the reactor is shut down
+		epoll_event sEvents[MaxNumOfEvents];
+		while (!m_cReactor.m_bShutdown && static_cast<int>(m_nPoll) >= 0) {
+			const int nNumOfEvents = epoll_wait(static_cast<int>(m_nPoll), sEvents, MaxNumOfEvents, PollTimeout);
+			MutexGuard cMutexGuard(m_cMutex);
+
+			// Free the slots of the connections removed by other I/O threads first, their events are skipped
+			ProcessQueue();
+
+			// Dispatch the events
+			for (int i=0; i<nNumOfEvents; i++) {
+				const epoll_event &sEvent = sEvents[i];
+				if (sEvent.data.u64 == WakeUpHandle) {
+					// Reset the wake up event, the queue was already processed
+					eventfd_t nValue;
+					eventfd_read(static_cast<int>(m_nWakeUp), &nValue);
+				} else {
+					const uint32 nSlot		 = static_cast<uint32>(sEvent.data.u64);
+					const uint32 nGeneration = static_cast<uint32>(sEvent.data.u64 >> 32);
+
+					// Send buffered data
+					if ((sEvent.events & EPOLLOUT) && m_lstSlots[nSlot] && m_lstGenerations[nSlot] == nGeneration)
+						m_lstSlots[nSlot]->OnWritable();
+
+					// Receive data, closed connections and errors are detected while receiving
+					if ((sEvent.events & (EPOLLIN | EPOLLRDHUP | EPOLLHUP | EPOLLERR)) && m_lstSlots[nSlot] && m_lstGenerations[nSlot] == nGeneration)
+						m_lstSlots[nSlot]->OnReadable();
+				}
+			}
+		}
+	#endif
+
+	// Done
+	return 0;
+}
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+} // PLCore
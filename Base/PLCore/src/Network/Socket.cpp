@@ -88,6 +88,8 @@ bool Socket::Close()
 		#ifdef WIN32
 			const int nResult = closesocket(m_nSocket);
 		#else
+			// Wake up threads which are blocked within the socket, "close()" alone doesn't do this on Linux
+			shutdown(m_nSocket, SHUT_RDWR);
 			const int nResult = close(m_nSocket);
 		#endif
 
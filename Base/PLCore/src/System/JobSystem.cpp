@@ -0,0 +1,533 @@
+/*********************************************************\
+ *  File: JobSystem.cpp                                  *
+ *
+ *  Copyright (C) 2002-2013 The PixelLight Team (http://www.pixellight.org/)
+ *
+ *  This file is part of PixelLight.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ *  and associated documentation files (the "Software"), to deal in the Software without
+ *  restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ *  Software is furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all copies or
+ *  substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ *  BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ *  DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ *  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include "PLCore/System/System.h"
+#include "PLCore/System/Semaphore.h"
+#include "PLCore/System/MutexGuard.h"
+#include "PLCore/System/JobSystem.h"
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace PLCore {
+
+
+//[-------------------------------------------------------]
+//[ Template instance                                     ]
+//[-------------------------------------------------------]
+template class Singleton<JobSystem>;
+
+
+//[-------------------------------------------------------]
+//[ Public static PLCore::Singleton functions             ]
+//[-------------------------------------------------------]
+JobSystem *JobSystem::GetInstance()
+{
+	// The compiler should be able to optimize this extra call, at least inside this project (inlining)
+	return Singleton<JobSystem>::GetInstance();
+}
+
+bool JobSystem::HasInstance()
+{
+	// The compiler should be able to optimize this extra call, at least inside this project (inlining)
+	return Singleton<JobSystem>::HasInstance();
+}
+
+
+//[-------------------------------------------------------]
+//[ Public functions                                      ]
+//[-------------------------------------------------------]
+/**
+*  @brief
+*    Sets the number of worker threads
+*/
+void JobSystem::SetNumOfWorkers(uint32 nNumOfWorkers)
+{
+	if (m_lstWorkers.GetNumOfElements() != nNumOfWorkers) {
+		StopWorkers();
+		StartWorkers(nNumOfWorkers);
+	}
+}
+
+/**
+*  @brief
+*    Submits a job
+*/
+void JobSystem::Submit(JOBFUNCTION pFunction, void *pData, JobCounter *pCounter, JobCounter *pDependency)
+{
+	// Setup the job
+	Job sJob;
+	sJob.pFunction = pFunction;
+	sJob.pData     = pData;
+	sJob.pCounter  = pCounter;
+	if (pCounter)
+		Atomic::Increment(pCounter->m_nValue);
+
+	// Has the job to wait for a dependency?
+	if (pDependency && !pDependency->IsDone()) {
+		const MutexGuard cMutexGuard(m_cWaitingJobsCriticalSection);
+
+		// Announce the waiting job before checking the dependency again, a job finishing the dependency
+		// right now either sees the announcement or we see the done dependency (the atomic operations are full barriers)
+		Atomic::Increment(m_nNumOfWaitingJobs);
+		if (!pDependency->IsDone()) {
+			WaitingJob &sWaitingJob = m_lstWaitingJobs.Add();
+			sWaitingJob.sJob        = sJob;
+			sWaitingJob.pDependency = pDependency;
+
+			// Done, the job is submitted as soon as the dependency is done
+			return;
+		}
+		Atomic::Decrement(m_nNumOfWaitingJobs);
+	}
+
+	// Add the job to the queue of the calling thread
+	PushJob(sJob, GetQueueOfCurrentThread());
+}
+
+/**
+*  @brief
+*    Waits until all jobs of the given job counter are finished
+*/
+void JobSystem::Wait(JobCounter &cCounter)
+{
+	// Help executing jobs while waiting
+	// -> The system singleton may already be destroyed if we're called while the application is shutting down,
+	//    in this case we just keep on looking for jobs instead of yielding the time slice
+	const uint32 nQueue = GetQueueOfCurrentThread();
+	while (!cCounter.IsDone()) {
+		Job sJob;
+		if (FindJob(nQueue, sJob)) {
+			ExecuteJob(sJob);
+		} else {
+			const System *pSystem = System::GetInstance();
+			if (pSystem)
+				pSystem->Yield();
+		}
+	}
+}
+
+/**
+*  @brief
+*    Splits an index range into jobs and waits until all of them are finished
+*/
+void JobSystem::ParallelFor(uint32 nNumOfElements, uint32 nGranularity, PARALLELFORFUNCTION pFunction, void *pData)
+{
+	if (nNumOfElements) {
+		// Choose the granularity automatically? (a few jobs per thread for load balancing)
+		if (!nGranularity) {
+			const uint32 nNumOfJobs = (m_lstWorkers.GetNumOfElements() + 1)*4;
+			nGranularity = (nNumOfElements + nNumOfJobs - 1)/nNumOfJobs;
+		}
+
+		// Get the number of jobs
+		const uint32 nNumOfJobs = (nNumOfElements + nGranularity - 1)/nGranularity;
+		if (nNumOfJobs == 1 || m_lstWorkers.IsEmpty()) {
+			// Not worth the effort, call the function directly
+			pFunction(0, nNumOfElements, pData);
+		} else {
+			// Setup and submit the jobs
+			ParallelForRange *pRanges = new ParallelForRange[nNumOfJobs];
+			JobCounter cCounter;
+			for (uint32 i=0, nFirst=0; i<nNumOfJobs; i++, nFirst+=nGranularity) {
+				ParallelForRange &sRange = pRanges[i];
+				sRange.pFunction = pFunction;
+				sRange.pData     = pData;
+				sRange.nFirst    = nFirst;
+				sRange.nEnd      = (nFirst + nGranularity < nNumOfElements) ? nFirst + nGranularity : nNumOfElements;
+				Submit(&ParallelForJob, &sRange, &cCounter);
+			}
+
+			// Wait until all jobs are finished
+			Wait(cCounter);
+			delete [] pRanges;
+		}
+	}
+}
+
+
+//[-------------------------------------------------------]
+//[ Private functions                                     ]
+//[-------------------------------------------------------]
+/**
+*  @brief
+*    Constructor
+*/
+JobSystem::JobSystem() :
+	m_pWakeUpSemaphore(nullptr),
+	m_nNumOfSleepingWorkers(0),
+	m_nShutdown(0),
+	m_nNumOfWaitingJobs(0)
+{
+	// Create the shared job queue
+	m_lstQueues.Add(new JobQueue());
+
+	// Start one worker per logical CPU core, except the one of the thread waiting for the jobs
+	// -> Don't start any worker if the system singleton is already destroyed, the application is shutting down
+	const System *pSystem = System::GetInstance();
+	const uint32 nNumOfCPUs = pSystem ? pSystem->GetNumOfCPUs() : 0;
+	StartWorkers(nNumOfCPUs ? nNumOfCPUs - 1 : 0);
+}
+
+/**
+*  @brief
+*    Copy constructor
+*/
+JobSystem::JobSystem(const JobSystem &cSource) :
+	m_pWakeUpSemaphore(nullptr),
+	m_nNumOfSleepingWorkers(0),
+	m_nShutdown(0),
+	m_nNumOfWaitingJobs(0)
+{
+	// No implementation because the copy constructor is never used
+}
+
+/**
+*  @brief
+*    Destructor
+*/
+JobSystem::~JobSystem()
+{
+	// Stop the worker threads
+	StopWorkers();
+
+	// Destroy the job queues
+	for (uint32 i=0; i<m_lstQueues.GetNumOfElements(); i++)
+		delete m_lstQueues[i];
+}
+
+/**
+*  @brief
+*    Copy operator
+*/
+JobSystem &JobSystem::operator =(const JobSystem &cSource)
+{
+	// No implementation because the copy operator is never used
+	return *this;
+}
+
+/**
+*  @brief
+*    Starts the worker threads
+*/
+void JobSystem::StartWorkers(uint32 nNumOfWorkers)
+{
+	if (nNumOfWorkers) {
+		// Create the semaphore sleeping workers are waiting for
+		m_pWakeUpSemaphore = new Semaphore(0, nNumOfWorkers);
+
+		// Create the job queues of the workers
+		for (uint32 i=0; i<nNumOfWorkers; i++)
+			m_lstQueues.Add(new JobQueue());
+
+		// Create and start the workers
+		for (uint32 i=0; i<nNumOfWorkers; i++) {
+			Worker *pWorker = new Worker(*this, i + 1);
+			pWorker->SetName(String("JobSystem worker ") + (i + 1));
+			m_lstWorkers.Add(pWorker);
+			pWorker->Start();
+		}
+	}
+}
+
+/**
+*  @brief
+*    Stops the worker threads
+*/
+void JobSystem::StopWorkers()
+{
+	if (m_lstWorkers.GetNumOfElements()) {
+		// Tell the workers to stop and wake up all sleeping workers
+		Atomic::Exchange(m_nShutdown, 1);
+		for (uint32 i=0; i<m_lstWorkers.GetNumOfElements(); i++)
+			m_pWakeUpSemaphore->Unlock();
+
+		// Wait until the workers are stopped and destroy them
+		for (uint32 i=0; i<m_lstWorkers.GetNumOfElements(); i++) {
+			m_lstWorkers[i]->Join();
+			delete m_lstWorkers[i];
+		}
+		m_lstWorkers.Clear();
+
+		// Move the remaining jobs into the shared queue and destroy the job queues of the workers
+		JobQueue *pSharedQueue = m_lstQueues[0];
+		for (uint32 i=1; i<m_lstQueues.GetNumOfElements(); i++) {
+			JobQueue *pQueue = m_lstQueues[i];
+			Job sJob;
+			while (pQueue->PopFront(sJob))
+				pSharedQueue->PushBack(sJob);
+			delete pQueue;
+		}
+		m_lstQueues.Resize(1);
+
+		// Destroy the semaphore
+		delete m_pWakeUpSemaphore;
+		m_pWakeUpSemaphore = nullptr;
+
+		// Reset the states
+		Atomic::Exchange(m_nNumOfSleepingWorkers, 0);
+		Atomic::Exchange(m_nShutdown, 0);
+	}
+}
+
+/**
+*  @brief
+*    Returns the index of the job queue of the calling thread
+*/
+uint32 JobSystem::GetQueueOfCurrentThread() const
+{
+	// The system singleton may already be destroyed if we're called while the application is shutting down
+	const System *pSystem = m_lstWorkers.GetNumOfElements() ? System::GetInstance() : nullptr;
+	if (pSystem) {
+		const handle nThreadID = pSystem->GetCurrentThreadID();
+		for (uint32 i=0; i<m_lstWorkers.GetNumOfElements(); i++) {
+			const Worker *pWorker = m_lstWorkers[i];
+			if (pWorker->m_nThreadID == nThreadID)
+				return pWorker->m_nQueue;
+		}
+	}
+
+	// The calling thread is no worker thread, use the shared queue
+	return 0;
+}
+
+/**
+*  @brief
+*    Adds a job to a queue and wakes up a sleeping worker
+*/
+void JobSystem::PushJob(const Job &sJob, uint32 nQueue)
+{
+	// Add the job
+	m_lstQueues[nQueue]->PushBack(sJob);
+
+	// Wake up a sleeping worker, a worker going to sleep right now either sees the new job or we see
+	// the sleeping worker (see "Worker::Run()")
+	Atomic::FullBarrier();
+	if (Atomic::Get(m_nNumOfSleepingWorkers) > 0)
+		m_pWakeUpSemaphore->Unlock();
+}
+
+/**
+*  @brief
+*    Finds a job to execute
+*/
+bool JobSystem::FindJob(uint32 nQueue, Job &sJob)
+{
+	// Take the most recently added job of the own queue, it's data is most likely still within the cache
+	if (m_lstQueues[nQueue]->PopBack(sJob))
+		return true; // Done
+
+	// Steal the oldest job of another queue
+	const uint32 nNumOfQueues = m_lstQueues.GetNumOfElements();
+	for (uint32 i=1; i<nNumOfQueues; i++) {
+		if (m_lstQueues[(nQueue + i) % nNumOfQueues]->PopFront(sJob))
+			return true; // Done
+	}
+
+	// There's no job
+	return false;
+}
+
+/**
+*  @brief
+*    Executes a job
+*/
+void JobSystem::ExecuteJob(const Job &sJob)
+{
+	// Execute the job
+	sJob.pFunction(sJob.pData);
+
+	// Job finished, are there jobs waiting for a dependency? (don't touch the counter after the decrement,
+	// the thread waiting for it may already have destroyed it)
+	if (sJob.pCounter && !Atomic::Decrement(sJob.pCounter->m_nValue) && Atomic::Get(m_nNumOfWaitingJobs) > 0)
+		SubmitWaitingJobs();
+}
+
+/**
+*  @brief
+*    Submits all waiting jobs whose dependency is done
+*/
+void JobSystem::SubmitWaitingJobs()
+{
+	const MutexGuard cMutexGuard(m_cWaitingJobsCriticalSection);
+
+	// Submit the jobs and compact the remaining waiting jobs within one pass, the order of the remaining jobs is kept
+	const uint32 nQueue			   = GetQueueOfCurrentThread();
+	const uint32 nNumOfWaitingJobs = m_lstWaitingJobs.GetNumOfElements();
+	uint32 nNumOfRemainingJobs = 0;
+	for (uint32 i=0; i<nNumOfWaitingJobs; i++) {
+		const WaitingJob &sWaitingJob = m_lstWaitingJobs[i];
+		if (sWaitingJob.pDependency->IsDone()) {
+			PushJob(sWaitingJob.sJob, nQueue);
+			Atomic::Decrement(m_nNumOfWaitingJobs);
+		} else {
+			if (nNumOfRemainingJobs != i)
+				m_lstWaitingJobs[nNumOfRemainingJobs] = sWaitingJob;
+			nNumOfRemainingJobs++;
+		}
+	}
+	if (nNumOfRemainingJobs != nNumOfWaitingJobs)
+		m_lstWaitingJobs.Resize(nNumOfRemainingJobs);
+}
+
+
+//[-------------------------------------------------------]
+//[ Private static functions                              ]
+//[-------------------------------------------------------]
+/**
+*  @brief
+*    Job function executing a parallel for sub range
+*/
+void JobSystem::ParallelForJob(void *pData)
+{
+	const ParallelForRange *pRange = static_cast<const ParallelForRange*>(pData);
+	pRange->pFunction(pRange->nFirst, pRange->nEnd, pRange->pData);
+}
+
+
+//[-------------------------------------------------------]
+//[ JobSystem::JobQueue                                   ]
+//[-------------------------------------------------------]
+JobSystem::JobQueue::JobQueue() :
+	m_pJobs(nullptr),
+	m_nCapacity(0),
+	m_nFront(0),
+	m_nNumOfJobs(0)
+{
+}
+
+JobSystem::JobQueue::~JobQueue()
+{
+	if (m_pJobs)
+		delete [] m_pJobs;
+}
+
+void JobSystem::JobQueue::PushBack(const Job &sJob)
+{
+	const MutexGuard cMutexGuard(m_cCriticalSection);
+
+	// Grow the ring buffer if required
+	if (m_nNumOfJobs == m_nCapacity) {
+		const uint32 nNewCapacity = m_nCapacity ? m_nCapacity*2 : 64;
+		Job *pNewJobs = new Job[nNewCapacity];
+		for (uint32 i=0; i<m_nNumOfJobs; i++)
+			pNewJobs[i] = m_pJobs[(m_nFront + i) & (m_nCapacity - 1)];
+		if (m_pJobs)
+			delete [] m_pJobs;
+		m_pJobs     = pNewJobs;
+		m_nCapacity = nNewCapacity;
+		m_nFront    = 0;
+	}
+
+	// Add the job
+	m_pJobs[(m_nFront + m_nNumOfJobs) & (m_nCapacity - 1)] = sJob;
+	m_nNumOfJobs = m_nNumOfJobs + 1;
+}
+
+bool JobSystem::JobQueue::PopBack(Job &sJob)
+{
+	// Early escape without locking
+	if (!m_nNumOfJobs)
+		return false;
+
+	const MutexGuard cMutexGuard(m_cCriticalSection);
+	if (m_nNumOfJobs) {
+		m_nNumOfJobs = m_nNumOfJobs - 1;
+		sJob = m_pJobs[(m_nFront + m_nNumOfJobs) & (m_nCapacity - 1)];
+		return true;
+	}
+	return false;
+}
+
+bool JobSystem::JobQueue::PopFront(Job &sJob)
+{
+	// Early escape without locking
+	if (!m_nNumOfJobs)
+		return false;
+
+	const MutexGuard cMutexGuard(m_cCriticalSection);
+	if (m_nNumOfJobs) {
+		sJob = m_pJobs[m_nFront];
+		m_nFront     = (m_nFront + 1) & (m_nCapacity - 1);
+		m_nNumOfJobs = m_nNumOfJobs - 1;
+		return true;
+	}
+	return false;
+}
+
+
+//[-------------------------------------------------------]
+//[ JobSystem::Worker                                     ]
+//[-------------------------------------------------------]
+JobSystem::Worker::Worker(JobSystem &cJobSystem, uint32 nQueue) :
+	m_cJobSystem(cJobSystem),
+	m_nQueue(nQueue),
+	m_nThreadID(NULL_HANDLE)
+{
+}
+
+JobSystem::Worker::~Worker()
+{
+}
+
+int JobSystem::Worker::Run()
+{
+	// Remember the ID of this thread so jobs submitted by this worker are added to its own queue
+	// -> Don't use the system singleton later on, it may be destroyed before the job system
+	// -> The system singleton may even be destroyed already if the worker is started while the application is shutting down
+	const System *pSystem = System::GetInstance();
+	if (pSystem)
+		m_nThreadID = pSystem->GetCurrentThreadID();
+
+	// Execute jobs until the job system is shut down
+	while (!Atomic::Get(m_cJobSystem.m_nShutdown)) {
+		Job sJob;
+		if (m_cJobSystem.FindJob(m_nQueue, sJob)) {
+			m_cJobSystem.ExecuteJob(sJob);
+		} else {
+			// Announce that we're going to sleep and look for jobs once again, a thread submitting a
+			// job right now either sees the sleeping worker or we see the new job
+			Atomic::Increment(m_cJobSystem.m_nNumOfSleepingWorkers);
+			const bool bJobFound = m_cJobSystem.FindJob(m_nQueue, sJob);
+			if (!bJobFound && !Atomic::Get(m_cJobSystem.m_nShutdown))
+				m_cJobSystem.m_pWakeUpSemaphore->Lock();
+			Atomic::Decrement(m_cJobSystem.m_nNumOfSleepingWorkers);
+			if (bJobFound)
+				m_cJobSystem.ExecuteJob(sJob);
+		}
+	}
+
+	// Done
+	return 0;
+}
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+} // PLCore
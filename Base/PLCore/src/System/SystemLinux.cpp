@@ -31,6 +31,7 @@
 #include <stdlib.h>
 #include <unistd.h>
 #include <sched.h>
+#include <pthread.h>
 #include <locale.h>
 #include <sys/time.h>
 #include <dlfcn.h>
@@ -171,6 +172,13 @@ uint32 SystemLinux::GetCPUMhz() const
 	return nMhz;
 }
 
+uint32 SystemLinux::GetNumOfCPUs() const
+{
+	// Get the number of logical CPU cores which are currently online
+	const long nNumOfCPUs = sysconf(_SC_NPROCESSORS_ONLN);
+	return (nNumOfCPUs > 0) ? static_cast<uint32>(nNumOfCPUs) : 1;
+}
+
 String SystemLinux::GetComputerName() const
 {
 	// Get computer name
@@ -345,6 +353,12 @@ Thread *SystemLinux::GetCurrentThread() const
 	return nullptr;
 }
 
+handle SystemLinux::GetCurrentThreadID() const
+{
+	// Please note that we can't use C++ style casts in here across all supported platforms (see "ThreadLinux::GetID()")
+	return (handle)pthread_self();
+}
+
 void SystemLinux::Exit(int nReturn)
 {
 	// Exit
@@ -402,6 +416,14 @@ uint64 SystemLinux::GetMicroseconds() const
 	return static_cast<uint64>(now.tv_sec*1000000 + now.tv_usec);
 }
 
+uint64 SystemLinux::GetNanoseconds() const
+{
+	// Use the monotonic clock, it's not affected by changes of the system time
+	struct timespec now;
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return static_cast<uint64>(now.tv_sec)*1000000000 + static_cast<uint64>(now.tv_nsec);
+}
+
 void SystemLinux::Sleep(uint64 nMilliseconds) const
 {
 	// We have to split up the given number of milliseconds to sleep into seconds and milliseconds
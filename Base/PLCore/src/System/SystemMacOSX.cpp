@@ -26,6 +26,7 @@
 //[ Includes                                              ]
 //[-------------------------------------------------------]
 #include <mach-o/dyld.h>	// For _NSGetExecutablePath
+#include <mach/mach_time.h>	// For mach_absolute_time
 #include "PLCore/System/SystemMacOSX.h"
 
 
@@ -97,6 +98,15 @@ String SystemMacOSX::GetSharedLibraryExtension() const
 	return sString;
 }
 
+uint64 SystemMacOSX::GetNanoseconds() const
+{
+	// "clock_gettime()" is not available on older Mac OS X versions, use the Mach absolute time instead
+	static mach_timebase_info_data_t sTimebaseInfo = { 0, 0 };
+	if (!sTimebaseInfo.denom)
+		mach_timebase_info(&sTimebaseInfo);
+	return mach_absolute_time()*sTimebaseInfo.numer/sTimebaseInfo.denom;
+}
+
 
 //[-------------------------------------------------------]
 //[ Namespace                                             ]
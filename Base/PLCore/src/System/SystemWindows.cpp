@@ -414,6 +414,14 @@ uint32 SystemWindows::GetCPUMhz() const
 #endif
 }
 
+uint32 SystemWindows::GetNumOfCPUs() const
+{
+	// Get the number of logical CPU cores
+	SYSTEM_INFO sSystemInfo;
+	GetSystemInfo(&sSystemInfo);
+	return sSystemInfo.dwNumberOfProcessors ? static_cast<uint32>(sSystemInfo.dwNumberOfProcessors) : 1;
+}
+
 String SystemWindows::GetComputerName() const
 {
 	// First of all, get the length of the computer name (including the terminating zero)
@@ -664,6 +672,11 @@ Thread *SystemWindows::GetCurrentThread() const
 	}
 }
 
+handle SystemWindows::GetCurrentThreadID() const
+{
+	return static_cast<handle>(::GetCurrentThreadId());
+}
+
 void SystemWindows::Exit(int nReturn)
 {
 	// Exit
@@ -724,6 +737,20 @@ uint64 SystemWindows::GetMicroseconds() const
 	return static_cast<uint64>(dNewTicks);
 }
 
+uint64 SystemWindows::GetNanoseconds() const
+{
+	// Get past time
+	LARGE_INTEGER nCurTime;
+	QueryPerformanceCounter(&nCurTime);
+	const uint64 nTicks     = static_cast<uint64>(nCurTime.QuadPart);
+	const uint64 nFrequency = static_cast<uint64>(m_nPerformanceFrequency.QuadPart);
+	if (!nFrequency)
+		return 0; // Error!
+
+	// Scale the seconds and the remaining ticks separately to avoid an overflow
+	return (nTicks/nFrequency)*1000000000 + ((nTicks%nFrequency)*1000000000)/nFrequency;
+}
+
 void SystemWindows::Sleep(uint64 nMilliseconds) const
 {
 	SleepEx(static_cast<DWORD>(nMilliseconds), false);
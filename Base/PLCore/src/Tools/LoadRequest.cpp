@@ -0,0 +1,114 @@
+/*********************************************************\
+ *  File: LoadRequest.cpp                                *
+ *
+ *  Copyright (C) 2002-2013 The PixelLight Team (http://www.pixellight.org/)
+ *
+ *  This file is part of PixelLight.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ *  and associated documentation files (the "Software"), to deal in the Software without
+ *  restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ *  Software is furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all copies or
+ *  substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ *  BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ *  DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ *  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include "PLCore/Log/Log.h"
+#include "PLCore/Tools/LoadRequest.h"
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace PLCore {
+
+
+//[-------------------------------------------------------]
+//[ Public functions                                      ]
+//[-------------------------------------------------------]
+/**
+*  @brief
+*    Constructor
+*/
+LoadRequest::LoadRequest(const String &sFilename, float fPriority) :
+	m_sFilename(sFilename),
+	m_fPriority(fPriority),
+	m_nState(Queued),
+	m_bCanceled(false)
+{
+}
+
+/**
+*  @brief
+*    Destructor
+*/
+LoadRequest::~LoadRequest()
+{
+}
+
+
+//[-------------------------------------------------------]
+//[ Protected virtual LoadRequest functions               ]
+//[-------------------------------------------------------]
+/**
+*  @brief
+*    Decodes the read data
+*/
+bool LoadRequest::OnDecode()
+{
+	// No default implementation
+	return true;
+}
+
+/**
+*  @brief
+*    Called when the file can't be read or decoding or finalizing failed
+*/
+void LoadRequest::OnFailure()
+{
+	PL_LOG(Error, "Failed to load '" + m_sFilename + "' asynchronously")
+}
+
+
+//[-------------------------------------------------------]
+//[ Private functions                                     ]
+//[-------------------------------------------------------]
+/**
+*  @brief
+*    Copy constructor
+*/
+LoadRequest::LoadRequest(const LoadRequest &cSource) :
+	m_fPriority(0.0f),
+	m_nState(Queued),
+	m_bCanceled(false)
+{
+	// No implementation because the copy constructor is never used
+}
+
+/**
+*  @brief
+*    Copy operator
+*/
+LoadRequest &LoadRequest::operator =(const LoadRequest &cSource)
+{
+	// No implementation because the copy operator is never used
+	return *this;
+}
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+} // PLCore
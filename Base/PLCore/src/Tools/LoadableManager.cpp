@@ -30,6 +30,9 @@
 #include "PLCore/File/Directory.h"
 #include "PLCore/File/FileSearch.h"
 #include "PLCore/System/System.h"
+#include "PLCore/System/Atomic.h"
+#include "PLCore/System/Semaphore.h"
+#include "PLCore/System/MutexGuard.h"
 #include "PLCore/Base/Class.h"
 #include "PLCore/Base/ClassManager.h"
 #include "PLCore/Tools/Loader.h"
@@ -166,6 +169,7 @@ bool LoadableManager::IsBaseDir(const String &sPath) const
 		sValidUrl += '/';
 
 	// Loop through all base directories
+	MutexGuard cMutexGuard(m_cBaseDirMutex);
 	for (uint32 i=0; i<m_lstBaseDirs.GetNumOfElements(); i++) {
 		if (m_lstBaseDirs[i] == sValidUrl)
 			return true; // This is a base directory
@@ -187,6 +191,7 @@ bool LoadableManager::AddBaseDir(const String &sPath)
 		sValidUrl += '/';
 
 	// Check whether the given base directory is already registered
+	MutexGuard cMutexGuard(m_cBaseDirMutex);
 	for (uint32 i=0; i<m_lstBaseDirs.GetNumOfElements(); i++) {
 		if (m_lstBaseDirs[i] == sValidUrl)
 			return true; // Done
@@ -194,6 +199,7 @@ bool LoadableManager::AddBaseDir(const String &sPath)
 
 	// Add directory
 	m_lstBaseDirs.Add(sValidUrl);
+	OnBaseDirsChanged();
 	return true; // Done
 }
 
@@ -216,6 +222,7 @@ bool LoadableManager::SetBaseDirPriority(const String &sFirstPath, const String
 		sValidSecond += '/';
 
 	// Get the first path
+	MutexGuard cMutexGuard(m_cBaseDirMutex);
 	for (uint32 nFirst=0; nFirst<m_lstBaseDirs.GetNumOfElements(); nFirst++) {
 		const String &sFirstDirectory = m_lstBaseDirs[nFirst];
 		if (sFirstDirectory == sValidFirst) {
@@ -233,6 +240,9 @@ bool LoadableManager::SetBaseDirPriority(const String &sFirstPath, const String
 
 						// Add the second one directly after the first one
 						m_lstBaseDirs.AddAtIndex(sValidSecond, nSecond + 1);
+
+						// The file index knows the base directories by their numbers
+						OnBaseDirsChanged();
 					}
 
 					// Done
@@ -258,6 +268,7 @@ bool LoadableManager::RemoveBaseDir(const String &sPath)
 		sValidUrl += '/';
 
 	// Search for base directory
+	MutexGuard cMutexGuard(m_cBaseDirMutex);
 	ConstIterator<String> cIterator = m_lstBaseDirs.GetConstIterator();
 	while (cIterator.HasNext()) {
 		// Check directory name
@@ -265,6 +276,7 @@ bool LoadableManager::RemoveBaseDir(const String &sPath)
 		if (sValidUrl == sDir) {
 			// Remove directory
 			m_lstBaseDirs.Remove(sDir);
+			OnBaseDirsChanged();
 
 			// Done
 			return true;
@@ -282,10 +294,12 @@ bool LoadableManager::RemoveBaseDir(const String &sPath)
 bool LoadableManager::RemoveBaseDir(uint32 nNum)
 {
 	// Get directory
+	MutexGuard cMutexGuard(m_cBaseDirMutex);
 	String &sDir = m_lstBaseDirs[nNum];
 	if (&sDir != &Array<String>::Null) {
 		// Remove directory
 		m_lstBaseDirs.Remove(sDir);
+		OnBaseDirsChanged();
 
 		// Done
 		return true;
@@ -295,6 +309,21 @@ bool LoadableManager::RemoveBaseDir(uint32 nNum)
 	return false;
 }
 
+/**
+*  @brief
+*    Removes all base directories
+*/
+bool LoadableManager::ClearBaseDirs()
+{
+	// Delete all base dirs
+	MutexGuard cMutexGuard(m_cBaseDirMutex);
+	m_lstBaseDirs.Clear();
+	OnBaseDirsChanged();
+
+	// Done
+	return true;
+}
+
 /**
 *  @brief
 *    Gets the relative version of an absolute filename
@@ -315,6 +344,36 @@ String LoadableManager::GetRelativeFilename(const String &sFilename)
 	return "";
 }
 
+/**
+*  @brief
+*    Returns whether or not the file index is used to resolve relative filenames
+*/
+bool LoadableManager::GetUseFileIndex() const
+{
+	return m_bUseFileIndex;
+}
+
+/**
+*  @brief
+*    Sets whether or not the file index is used to resolve relative filenames
+*/
+void LoadableManager::SetUseFileIndex(bool bUseFileIndex)
+{
+	MutexGuard cMutexGuard(m_cBaseDirMutex);
+	m_bUseFileIndex   = bUseFileIndex;
+	m_bFileIndexValid = false;
+}
+
+/**
+*  @brief
+*    Invalidates the file index
+*/
+void LoadableManager::InvalidateFileIndex()
+{
+	MutexGuard cMutexGuard(m_cBaseDirMutex);
+	m_bFileIndexValid = false;
+}
+
 /**
 *  @brief
 *    Scan a directory for data packages and add them as base paths to the loadable manager
@@ -360,33 +419,33 @@ bool LoadableManager::OpenFile(File &cFile, const String &sFilename, bool bCreat
 		// The given filename is already absolute! :)
 		cFile.Assign(cUrl);
 	} else {
+		// Get the base directories, the file index tells us which of them have to be checked (when creating a file we don't know yet where it will be)
+		Array<String> lstBaseDirs;
+		Array<bool> lstCheckBaseDirs;
+		FileIndex::Entry cEntry;
+		uint32 nRevision = 0;
+		const bool bUseFileIndex = GetBaseDirs(sFilename, !bCreate, lstBaseDirs, lstCheckBaseDirs, cEntry, nRevision);
+
 		// Are there any base directories?
-		const uint32 nNumOfBaseDirs = m_lstBaseDirs.GetNumOfElements();
+		const uint32 nNumOfBaseDirs = lstBaseDirs.GetNumOfElements();
 		if (nNumOfBaseDirs) {
 			// Reset file
 			cFile.Assign("");
 
-			// Loop through all base directories
+			// Loop through all base directories which have to be checked
 			bool bFileFound = false;
 			for (uint32 nBaseDir=0; nBaseDir<nNumOfBaseDirs && !bFileFound; nBaseDir++) {
-				// Get the base directory
-				const String sBaseDir = m_lstBaseDirs[nBaseDir];
+				if (!bUseFileIndex || lstCheckBaseDirs[nBaseDir])
+					bFileFound = OpenBaseDirFile(cFile, lstBaseDirs[nBaseDir], nBaseDir, nRevision, sFilename, (bUseFileIndex && nBaseDir == cEntry.m_nDirectory) ? &cEntry : nullptr, bCreate);
+			}
 
-				// Try to open the file directly (resolve "./" because we always want to work with absolute paths so the user can figure out the absolute path later on)
-				if (sBaseDir == "./") {
-					// Use current directory
-					cFile.Assign(System::GetInstance()->GetCurrentDir() + '/' + sFilename);
-				} else {
-					// Use given base directory
-					cFile.Assign(sBaseDir + sFilename);
+			// The file was not where the file index told us, remove the out-of-date entry and check the remaining base directories
+			if (!bFileFound && bUseFileIndex && cEntry.m_nDirectory < nNumOfBaseDirs) {
+				RemoveFromFileIndex(sFilename, cEntry.m_nDirectory, nRevision);
+				for (uint32 nBaseDir=0; nBaseDir<nNumOfBaseDirs && !bFileFound; nBaseDir++) {
+					if (!lstCheckBaseDirs[nBaseDir])
+						bFileFound = OpenBaseDirFile(cFile, lstBaseDirs[nBaseDir], nBaseDir, nRevision, sFilename, nullptr, bCreate);
 				}
-
-				// File found?
-				bFileFound = cFile.IsFile();
-
-				// Create the file?
-				if (bCreate && !bFileFound)
-					bFileFound = cFile.Create();
 			}
 		} else {
 			// Try to open the file directly
@@ -412,8 +471,15 @@ bool LoadableManager::OpenDirectory(Directory &cDirectory, const String &sFilena
 		// The given filename is already absolute! :)
 		cDirectory.Assign(cUrl);
 	} else {
+		// Get a snapshot of the base directories
+		Array<String> lstBaseDirs;
+		{
+			MutexGuard cMutexGuard(m_cBaseDirMutex);
+			lstBaseDirs = m_lstBaseDirs;
+		}
+
 		// Are there any base directories?
-		const uint32 nNumOfBaseDirs = m_lstBaseDirs.GetNumOfElements();
+		const uint32 nNumOfBaseDirs = lstBaseDirs.GetNumOfElements();
 		if (nNumOfBaseDirs) {
 			// Reset directory
 			cDirectory.Assign("");
@@ -422,7 +488,7 @@ bool LoadableManager::OpenDirectory(Directory &cDirectory, const String &sFilena
 			bool bDirectoryFound = false;
 			for (uint32 nBaseDir=0; nBaseDir<nNumOfBaseDirs && !bDirectoryFound; nBaseDir++) {
 				// Get the base directory
-				const String sBaseDir = m_lstBaseDirs[nBaseDir];
+				const String &sBaseDir = lstBaseDirs[nBaseDir];
 
 				// Try to open the directory directly (resolve "./" because we always want to work with absolute paths so the user can figure out the absolute path later on)
 				if (sBaseDir == "./") {
@@ -471,6 +537,139 @@ String LoadableManager::LoadStringFromFile(const String &sFilename, String::EFor
 	return "";
 }
 
+/**
+*  @brief
+*    Adds an asynchronous load request
+*/
+bool LoadableManager::LoadAsync(LoadRequest *pRequest)
+{
+	// Check parameter
+	if (pRequest) {
+		// Register new loader classes right now, decoding by worker threads should only read the loadable types
+		RegisterClasses();
+
+		{
+			MutexGuard cMutexGuard(m_cAsyncMutex);
+
+			// Start the background I/O thread right now if this is the first request (LoadAsync() may be called by multiple threads)
+			if (!m_pAsyncThread) {
+				m_pAsyncSemaphore = new Semaphore(0, 1);
+				m_pAsyncThread = new Thread(&LoadableManager::AsyncThreadFunction, this);
+				if (!m_pAsyncThread->Start()) {
+					// Error!
+					PL_LOG(Error, "Failed to start the asynchronous loading thread")
+					delete m_pAsyncThread;
+					m_pAsyncThread = nullptr;
+					delete m_pAsyncSemaphore;
+					m_pAsyncSemaphore = nullptr;
+					delete pRequest;
+					return false;
+				}
+			}
+
+			// Add the request
+			pRequest->m_nState    = LoadRequest::Queued;
+			pRequest->m_bCanceled = false;
+			m_lstAsyncRequests.Add(pRequest);
+		}
+
+		// Wake up the background I/O thread (if the semaphore is already signaled, the thread is going to see the new request anyway)
+		m_pAsyncSemaphore->Unlock();
+
+		// Done
+		return true;
+	}
+
+	// Error!
+	return false;
+}
+
+/**
+*  @brief
+*    Cancels an asynchronous load request
+*/
+void LoadableManager::CancelAsync(LoadRequest &cRequest)
+{
+	MutexGuard cMutexGuard(m_cAsyncMutex);
+
+	// A loading request is still used by the I/O or worker thread, it's canceled as soon as it's done, see EndAsyncLoading()
+	if (cRequest.m_nState == LoadRequest::Loading)
+		cRequest.m_bCanceled = true;
+	else
+		cRequest.m_nState = LoadRequest::Canceled;
+}
+
+/**
+*  @brief
+*    Sets the priority of an asynchronous load request
+*/
+void LoadableManager::SetAsyncPriority(LoadRequest &cRequest, float fPriority)
+{
+	MutexGuard cMutexGuard(m_cAsyncMutex);
+	cRequest.m_fPriority = fPriority;
+}
+
+/**
+*  @brief
+*    Returns the number of asynchronous load requests which are not destroyed yet
+*/
+uint32 LoadableManager::GetNumOfAsyncRequests() const
+{
+	MutexGuard cMutexGuard(m_cAsyncMutex);
+	return m_lstAsyncRequests.GetNumOfElements();
+}
+
+/**
+*  @brief
+*    Finalizes loaded asynchronous load requests and destroys finished, failed and canceled ones
+*/
+uint32 LoadableManager::UpdateAsync(uint64 nTimeBudget)
+{
+	uint32 nNumOfDestroyedRequests = 0;
+	const uint64 nStartTime = nTimeBudget ? System::GetInstance()->GetMilliseconds() : 0;
+	for (;;) {
+		// Take the request with the highest priority which is no longer used by the I/O or worker threads out of the list
+		LoadRequest *pRequest = nullptr;
+		{
+			MutexGuard cMutexGuard(m_cAsyncMutex);
+			int nRequest = -1;
+			for (uint32 i=0; i<m_lstAsyncRequests.GetNumOfElements(); i++) {
+				const LoadRequest *pCurrentRequest = m_lstAsyncRequests[i];
+				if (pCurrentRequest->m_nState >= LoadRequest::Loaded && (nRequest < 0 || pCurrentRequest->m_fPriority > m_lstAsyncRequests[nRequest]->m_fPriority))
+					nRequest = i;
+			}
+			if (nRequest >= 0) {
+				pRequest = m_lstAsyncRequests[nRequest];
+				m_lstAsyncRequests.RemoveAtIndex(nRequest);
+			}
+		}
+		if (!pRequest)
+			break; // Done
+
+		// Finalize the request, no other thread knows about it any longer
+		if (pRequest->m_nState == LoadRequest::Loaded) {
+			const bool bSuccess = pRequest->OnFinalize();
+			pRequest->m_cFile.Close();
+			pRequest->m_nState = bSuccess ? LoadRequest::Finished : LoadRequest::Failed;
+			if (!bSuccess)
+				pRequest->OnFailure();
+		} else if (pRequest->m_nState == LoadRequest::Failed) {
+			pRequest->OnFailure();
+		}
+
+		// Destroy the request
+		delete pRequest;
+		nNumOfDestroyedRequests++;
+
+		// Time is up?
+		if (nTimeBudget && System::GetInstance()->GetMilliseconds() - nStartTime >= nTimeBudget)
+			break;
+	}
+
+	// Done
+	return nNumOfDestroyedRequests;
+}
+
 
 //[-------------------------------------------------------]
 //[ Protected functions                                   ]
@@ -481,7 +680,13 @@ String LoadableManager::LoadStringFromFile(const String &sFilename, String::EFor
 */
 LoadableManager::LoadableManager() :
 	SlotClassLoaded(&LoadableManager::OnClassLoaded, this),
-	SlotClassUnloaded(&LoadableManager::OnClassUnloaded, this)
+	SlotClassUnloaded(&LoadableManager::OnClassUnloaded, this),
+	m_nBaseDirRevision(0),
+	m_bUseFileIndex(true),
+	m_bFileIndexValid(false),
+	m_pAsyncThread(nullptr),
+	m_pAsyncSemaphore(nullptr),
+	m_nAsyncShutdown(0)
 {
 	// The loadable manager MUST be informed if new classes are registered in order to register new loadable types!
 	ClassManager::GetInstance()->EventClassLoaded.Connect(SlotClassLoaded);
@@ -501,6 +706,26 @@ LoadableManager::LoadableManager() :
 */
 LoadableManager::~LoadableManager()
 {
+	// Stop the background I/O thread
+	if (m_pAsyncThread) {
+		Atomic::Exchange(m_nAsyncShutdown, 1);
+		m_pAsyncSemaphore->Unlock();
+		m_pAsyncThread->Join();
+		delete m_pAsyncThread;
+		m_pAsyncThread = nullptr;
+		delete m_pAsyncSemaphore;
+		m_pAsyncSemaphore = nullptr;
+	}
+
+	// Wait until all submitted decode jobs are finished
+	if (!m_cAsyncJobCounter.IsDone() && JobSystem::HasInstance())
+		JobSystem::GetInstance()->Wait(m_cAsyncJobCounter);
+
+	// Destroy all asynchronous load requests which are not destroyed yet, they are neither finalized nor is a failure reported
+	for (uint32 i=0; i<m_lstAsyncRequests.GetNumOfElements(); i++)
+		delete m_lstAsyncRequests[i];
+	m_lstAsyncRequests.Clear();
+
 	// Destroy all types, usually when we're in here there should only be types and loaders left which are defined within PLCore itself
 	const uint32 nNumOfElements = m_lstTypes.GetNumOfElements();
 	for (uint32 i=0; m_lstTypes.GetNumOfElements() && i<nNumOfElements; i++) {
@@ -648,6 +873,223 @@ void LoadableManager::RegisterClasses()
 	}
 }
 
+/**
+*  @brief
+*    Must be called after the base directories were changed
+*/
+void LoadableManager::OnBaseDirsChanged()
+{
+	// The file index knows the base directories by their numbers
+	m_nBaseDirRevision++;
+	m_bFileIndexValid = false;
+}
+
+/**
+*  @brief
+*    Returns a snapshot of the base directories and uses the file index to find out which of them have to be checked for a relative filename
+*/
+bool LoadableManager::GetBaseDirs(const String &sFilename, bool bFileIndex, Array<String> &lstBaseDirs, Array<bool> &lstCheckBaseDirs, FileIndex::Entry &cEntry, uint32 &nRevision) const
+{
+	MutexGuard cMutexGuard(m_cBaseDirMutex);
+
+	// Get a snapshot of the base directories, they may be changed while the snapshot is used by another thread
+	lstBaseDirs = m_lstBaseDirs;
+	nRevision   = m_nBaseDirRevision;
+
+	// Is the file index used?
+	if (!bFileIndex || !m_bUseFileIndex)
+		return false;
+
+	// Rebuild the file index?
+	const uint32 nNumOfBaseDirs = m_lstBaseDirs.GetNumOfElements();
+	if (!m_bFileIndexValid) {
+		m_cFileIndex.Clear();
+		m_lstIndexedBaseDirs.Resize(nNumOfBaseDirs, true, true);
+		for (uint32 nBaseDir=0; nBaseDir<nNumOfBaseDirs; nBaseDir++) {
+			// Only directories within ZIP-files are indexed (see FileIndex::AddDirectory()), regular directories may be huge
+			// (e.g. the current directory) and may change at any time, so they're always checked through the file system
+			const String &sBaseDir = m_lstBaseDirs[nBaseDir];
+			m_lstIndexedBaseDirs[nBaseDir] = (String(sBaseDir).ToLower().IndexOf(".zip/") > -1) && m_cFileIndex.AddDirectory(sBaseDir, nBaseDir);
+		}
+		m_bFileIndexValid = true;
+	}
+
+	// Is the file known? If not, only base directories which are not indexed may contain the file.
+	const FileIndex::Entry *pEntry = m_cFileIndex.Get(sFilename);
+	if (pEntry) {
+		cEntry = *pEntry;
+	} else {
+		cEntry = FileIndex::Entry(nNumOfBaseDirs);
+	}
+
+	// Base directories which are not indexed have to be checked anyway, all other base directories with a higher priority
+	// are known to not contain the file
+	lstCheckBaseDirs.Resize(nNumOfBaseDirs, true, true);
+	for (uint32 nBaseDir=0; nBaseDir<nNumOfBaseDirs; nBaseDir++)
+		lstCheckBaseDirs[nBaseDir] = (nBaseDir < cEntry.m_nDirectory) ? !m_lstIndexedBaseDirs[nBaseDir] : (nBaseDir == cEntry.m_nDirectory);
+
+	// Done
+	return true;
+}
+
+/**
+*  @brief
+*    Tries to find or create a file within a base directory
+*/
+bool LoadableManager::OpenBaseDirFile(File &cFile, const String &sBaseDir, uint32 nBaseDir, uint32 nRevision, const String &sFilename, const FileIndex::Entry *pEntry, bool bCreate) const
+{
+	// Try to open the file directly (resolve "./" because we always want to work with absolute paths so the user can figure out the absolute path later on)
+	const Url cUrl((sBaseDir == "./") ? System::GetInstance()->GetCurrentDir() + '/' + sFilename : sBaseDir + sFilename);
+
+	// The file index already knows where the entry is within a ZIP-file
+	if (pEntry && pEntry->m_bZipEntry)
+		cFile.Assign(cUrl, pEntry->m_nZipEntryIndex, pEntry->m_nZipEntryPosition);
+	else
+		cFile.Assign(cUrl);
+
+	// File found?
+	bool bFileFound = cFile.IsFile();
+
+	// Create the file?
+	if (bCreate && !bFileFound)
+		bFileFound = cFile.Create();
+
+	// Let the file index know about the file
+	if (bFileFound)
+		AddToFileIndex(sFilename, nBaseDir, nRevision);
+
+	// Done
+	return bFileFound;
+}
+
+/**
+*  @brief
+*    Adds a file which was found or created within a base directory to the file index
+*/
+void LoadableManager::AddToFileIndex(const String &sFilename, uint32 nBaseDir, uint32 nRevision) const
+{
+	MutexGuard cMutexGuard(m_cBaseDirMutex);
+	if (m_bUseFileIndex && m_bFileIndexValid && m_nBaseDirRevision == nRevision) {
+		// A base directory with a higher priority wins
+		const FileIndex::Entry *pEntry = m_cFileIndex.Get(sFilename);
+		if (pEntry && pEntry->m_nDirectory > nBaseDir)
+			m_cFileIndex.RemoveFile(sFilename);
+		m_cFileIndex.AddFile(sFilename, nBaseDir);
+	}
+}
+
+/**
+*  @brief
+*    Removes an out-of-date file from the file index
+*/
+void LoadableManager::RemoveFromFileIndex(const String &sFilename, uint32 nBaseDir, uint32 nRevision) const
+{
+	MutexGuard cMutexGuard(m_cBaseDirMutex);
+	if (m_bUseFileIndex && m_bFileIndexValid && m_nBaseDirRevision == nRevision) {
+		// Another thread may have updated the entry in the meantime
+		const FileIndex::Entry *pEntry = m_cFileIndex.Get(sFilename);
+		if (pEntry && pEntry->m_nDirectory == nBaseDir)
+			m_cFileIndex.RemoveFile(sFilename);
+	}
+}
+
+/**
+*  @brief
+*    Returns whether or not an asynchronous load request was canceled while it's loading
+*/
+bool LoadableManager::IsAsyncCanceled(const LoadRequest &cRequest) const
+{
+	MutexGuard cMutexGuard(m_cAsyncMutex);
+	return cRequest.m_bCanceled;
+}
+
+
+/**
+*  @brief
+*    Background I/O thread function
+*/
+int LoadableManager::AsyncThreadFunction(void *pData)
+{
+	LoadableManager &cLoadableManager = *static_cast<LoadableManager*>(pData);
+
+	// Process requests until the loadable manager is destroyed
+	while (!Atomic::Get(cLoadableManager.m_nAsyncShutdown)) {
+		// Get the queued request with the highest priority
+		LoadRequest *pRequest = nullptr;
+		{
+			MutexGuard cMutexGuard(cLoadableManager.m_cAsyncMutex);
+			for (uint32 i=0; i<cLoadableManager.m_lstAsyncRequests.GetNumOfElements(); i++) {
+				LoadRequest *pCurrentRequest = cLoadableManager.m_lstAsyncRequests[i];
+				if (pCurrentRequest->m_nState == LoadRequest::Queued && (!pRequest || pCurrentRequest->m_fPriority > pRequest->m_fPriority))
+					pRequest = pCurrentRequest;
+			}
+			if (pRequest)
+				pRequest->m_nState = LoadRequest::Loading;
+		}
+
+		// Read the request or wait for new requests
+		if (pRequest)
+			cLoadableManager.ReadAsync(*pRequest);
+		else
+			cLoadableManager.m_pAsyncSemaphore->Lock();
+	}
+
+	// Done
+	return 0;
+}
+
+/**
+*  @brief
+*    Decode job function
+*/
+void LoadableManager::AsyncDecodeJob(void *pData)
+{
+	LoadRequest &cRequest = *static_cast<LoadRequest*>(pData);
+	LoadableManager *pLoadableManager = LoadableManager::GetInstance();
+	pLoadableManager->EndAsyncLoading(cRequest, pLoadableManager->IsAsyncCanceled(cRequest) || cRequest.OnDecode());
+}
+
+/**
+*  @brief
+*    Reads the file of an asynchronous load request and decodes the read data
+*/
+void LoadableManager::ReadAsync(LoadRequest &cRequest)
+{
+	// Open the file by using the base directories and read it completely into memory
+	File &cFile = cRequest.m_cFile;
+	bool bSuccess = false;
+	if (!IsAsyncCanceled(cRequest) && OpenFile(cFile, cRequest.m_sFilename)) {
+		cFile.Close();
+		bSuccess = cFile.Open(File::FileRead | File::FileMemBuf);
+	}
+
+	// Decode the read data by using a worker thread, the I/O thread can read the next file in the meantime
+	if (bSuccess && !IsAsyncCanceled(cRequest)) {
+		JobSystem *pJobSystem = JobSystem::GetInstance();
+		if (pJobSystem->GetNumOfWorkers())
+			pJobSystem->Submit(&LoadableManager::AsyncDecodeJob, &cRequest, &m_cAsyncJobCounter);
+		else
+			EndAsyncLoading(cRequest, cRequest.OnDecode());
+	} else {
+		EndAsyncLoading(cRequest, bSuccess);
+	}
+}
+
+/**
+*  @brief
+*    Ends the loading state of an asynchronous load request
+*/
+void LoadableManager::EndAsyncLoading(LoadRequest &cRequest, bool bSuccess)
+{
+	MutexGuard cMutexGuard(m_cAsyncMutex);
+	if (cRequest.m_bCanceled) {
+		cRequest.m_cFile.Close();
+		cRequest.m_nState = LoadRequest::Canceled;
+	} else {
+		cRequest.m_nState = bSuccess ? LoadRequest::Loaded : LoadRequest::Failed;
+	}
+}
+
 
 //[-------------------------------------------------------]
 //[ Namespace                                             ]
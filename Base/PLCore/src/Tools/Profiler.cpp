@@ -0,0 +1,502 @@
+/*********************************************************\
+ *  File: Profiler.cpp                                   *
+ *
+ *  Copyright (C) 2002-2013 The PixelLight Team (http://www.pixellight.org/)
+ *
+ *  This file is part of PixelLight.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ *  and associated documentation files (the "Software"), to deal in the Software without
+ *  restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ *  Software is furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all copies or
+ *  substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ *  BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ *  DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ *  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include <string.h>
+#include "PLCore/File/File.h"
+#include "PLCore/System/Atomic.h"
+#include "PLCore/System/System.h"
+#include "PLCore/System/MutexGuard.h"
+#include "PLCore/Tools/Profiling.h"
+#include "PLCore/Tools/Profiler.h"
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace PLCore {
+
+
+//[-------------------------------------------------------]
+//[ Template instance                                     ]
+//[-------------------------------------------------------]
+template class Singleton<Profiler>;
+
+
+//[-------------------------------------------------------]
+//[ Global variables                                      ]
+//[-------------------------------------------------------]
+static PL_THREAD_LOCAL void *g_pThreadBuffer = nullptr;	// Ring buffer of the current thread ("Profiler::ThreadBuffer"), a null pointer if the thread has not recorded an event, yet
+
+
+//[-------------------------------------------------------]
+//[ Local functions                                       ]
+//[-------------------------------------------------------]
+/**
+*  @brief
+*    Returns a string as quoted and escaped JSON string
+*/
+static String ToJsonString(const String &sString)
+{
+	String sJson = '\"';
+	const uint32 nLength = sString.GetLength();
+	for (uint32 i=0; i<nLength; i++) {
+		const char nCharacter = sString[i];
+		if (nCharacter == '\"' || nCharacter == '\\')
+			sJson += '\\';
+		if (static_cast<unsigned char>(nCharacter) >= ' ')
+			sJson += nCharacter;
+	}
+	sJson += '\"';
+	return sJson;
+}
+
+
+//[-------------------------------------------------------]
+//[ Public static PLCore::Singleton functions             ]
+//[-------------------------------------------------------]
+Profiler *Profiler::GetInstance()
+{
+	// The compiler should be able to optimize this extra call, at least inside this project (inlining)
+	return Singleton<Profiler>::GetInstance();
+}
+
+bool Profiler::HasInstance()
+{
+	// The compiler should be able to optimize this extra call, at least inside this project (inlining)
+	return Singleton<Profiler>::HasInstance();
+}
+
+
+//[-------------------------------------------------------]
+//[ Public functions                                      ]
+//[-------------------------------------------------------]
+/**
+*  @brief
+*    Sets whether or not the profiler is recording
+*/
+void Profiler::SetEnabled(bool bEnabled)
+{
+	m_bEnabled = bEnabled;
+}
+
+/**
+*  @brief
+*    Sets the size of the ring buffer of a thread
+*/
+void Profiler::SetThreadBufferSize(uint32 nNumOfEvents)
+{
+	const MutexGuard cMutexGuard(m_cCriticalSection);
+
+	// Round up to a power of two, a zone needs at least two events
+	m_nThreadBufferSize = 2;
+	while (m_nThreadBufferSize < nNumOfEvents && m_nThreadBufferSize < 0x40000000)
+		m_nThreadBufferSize <<= 1;
+}
+
+/**
+*  @brief
+*    Sets the name of the calling thread
+*/
+void Profiler::SetThreadName(const String &sName)
+{
+	ThreadBuffer &cThreadBuffer = GetThreadBuffer();
+	const MutexGuard cMutexGuard(m_cCriticalSection);
+	cThreadBuffer.sName = sName;
+}
+
+/**
+*  @brief
+*    Records the begin of a zone within the calling thread
+*/
+void Profiler::BeginZone(const char *pszName)
+{
+	ThreadBuffer &cThreadBuffer = GetThreadBuffer();
+	if (cThreadBuffer.nDepth < MaxZoneDepth) {
+		// Keep space for the end of this zone and for the ends of all other open zones, so a recorded zone is always complete
+		const uint64 nBit = static_cast<uint64>(1) << cThreadBuffer.nDepth;
+		if (m_bEnabled && Write(cThreadBuffer, ZoneBegin, pszName, 0.0, cThreadBuffer.nNumOfOpenZones + 1)) {
+			cThreadBuffer.nNumOfOpenZones++;
+			cThreadBuffer.nDroppedZones &= ~nBit;
+		} else {
+			cThreadBuffer.nDroppedZones |= nBit;
+		}
+	} else {
+		// Zone depth is too high
+		Atomic::Increment(cThreadBuffer.nNumOfDropped);
+	}
+	cThreadBuffer.nDepth++;
+}
+
+/**
+*  @brief
+*    Records the end of the current zone of the calling thread
+*/
+void Profiler::EndZone()
+{
+	ThreadBuffer &cThreadBuffer = GetThreadBuffer();
+	if (cThreadBuffer.nDepth) {
+		cThreadBuffer.nDepth--;
+
+		// Was the begin of the zone recorded? If so, there's always space left for the end of the zone.
+		if (cThreadBuffer.nDepth < MaxZoneDepth && !(cThreadBuffer.nDroppedZones & (static_cast<uint64>(1) << cThreadBuffer.nDepth))) {
+			cThreadBuffer.nNumOfOpenZones--;
+			Write(cThreadBuffer, ZoneEnd, nullptr, 0.0, cThreadBuffer.nNumOfOpenZones);
+		}
+	}
+}
+
+/**
+*  @brief
+*    Records the current value of a counter within the calling thread
+*/
+void Profiler::SetCounter(const char *pszName, double dValue)
+{
+	if (m_bEnabled) {
+		ThreadBuffer &cThreadBuffer = GetThreadBuffer();
+		Write(cThreadBuffer, Counter, pszName, dValue, cThreadBuffer.nNumOfOpenZones);
+	}
+}
+
+/**
+*  @brief
+*    Records a frame marker and collects the recorded data
+*/
+void Profiler::MarkFrame()
+{
+	if (m_bEnabled) {
+		// Record the frame marker
+		ThreadBuffer &cThreadBuffer = GetThreadBuffer();
+		Write(cThreadBuffer, Frame, nullptr, 0.0, cThreadBuffer.nNumOfOpenZones);
+
+		// Collect the data of the last frame and show it
+		Collect();
+		PublishStatistics();
+	}
+}
+
+/**
+*  @brief
+*    Collects the recorded data of all threads
+*/
+void Profiler::Collect()
+{
+	const MutexGuard cMutexGuard(m_cCriticalSection);
+
+	for (uint32 nThread=0; nThread<m_lstThreadBuffers.GetNumOfElements(); nThread++) {
+		ThreadBuffer &cThreadBuffer = *m_lstThreadBuffers[nThread];
+
+		// Process all events written so far, the atomic operation ensures that we see the data of the events
+		const uint32 nWrite = static_cast<uint32>(Atomic::Get(cThreadBuffer.nWrite));
+		for (uint32 nRead=static_cast<uint32>(cThreadBuffer.nRead); nRead!=nWrite; nRead++) {
+			const Event &sEvent = cThreadBuffer.pEvents[nRead & cThreadBuffer.nMask];
+			switch (sEvent.nType) {
+				case ZoneBegin:
+					if (cThreadBuffer.nCollectDepth < MaxZoneDepth) {
+						cThreadBuffer.nZoneStart [cThreadBuffer.nCollectDepth] = sEvent.nTimestamp;
+						cThreadBuffer.pszZoneName[cThreadBuffer.nCollectDepth] = sEvent.pszName;
+					}
+					cThreadBuffer.nCollectDepth++;
+					break;
+
+				case ZoneEnd:
+					if (cThreadBuffer.nCollectDepth) {
+						cThreadBuffer.nCollectDepth--;
+						if (cThreadBuffer.nCollectDepth < MaxZoneDepth) {
+							Statistics &sStatistics = GetStatistics(cThreadBuffer.pszZoneName[cThreadBuffer.nCollectDepth], ZoneBegin);
+							const uint64 nTime = sEvent.nTimestamp - cThreadBuffer.nZoneStart[cThreadBuffer.nCollectDepth];
+							sStatistics.nCalls++;
+							sStatistics.nTime += nTime;
+							if (sStatistics.nMaxTime < nTime)
+								sStatistics.nMaxTime = nTime;
+						}
+					}
+					break;
+
+				case Counter:
+					GetStatistics(sEvent.pszName, Counter).dValue = sEvent.dValue;
+					break;
+			}
+
+			// Capture the event
+			if (m_bCapturing)
+				m_lstCapture.Add(sEvent);
+		}
+
+		// Give the read events free
+		Atomic::Exchange(cThreadBuffer.nRead, static_cast<int32>(nWrite));
+	}
+}
+
+/**
+*  @brief
+*    Returns the number of events which were dropped because a ring buffer was full
+*/
+uint32 Profiler::GetNumOfDroppedEvents() const
+{
+	const MutexGuard cMutexGuard(m_cCriticalSection);
+
+	uint32 nNumOfDropped = 0;
+	for (uint32 i=0; i<m_lstThreadBuffers.GetNumOfElements(); i++)
+		nNumOfDropped += Atomic::Get(m_lstThreadBuffers[i]->nNumOfDropped);
+	return nNumOfDropped;
+}
+
+/**
+*  @brief
+*    Removes all captured events
+*/
+void Profiler::ClearCapture()
+{
+	const MutexGuard cMutexGuard(m_cCriticalSection);
+	m_lstCapture.Clear();
+}
+
+/**
+*  @brief
+*    Exports the captured events in the Chrome trace JSON format
+*/
+bool Profiler::ExportChromeTrace(const String &sFilename) const
+{
+	const MutexGuard cMutexGuard(m_cCriticalSection);
+
+	// Open the file
+	File cFile(sFilename);
+	if (!cFile.Open(File::FileWrite | File::FileCreate))
+		return false; // Error!
+
+	// The timestamps are written relative to the first event in microseconds
+	uint64 nStartTime = 0;
+	for (uint32 i=0; i<m_lstCapture.GetNumOfElements(); i++) {
+		if (!i || nStartTime > m_lstCapture[i].nTimestamp)
+			nStartTime = m_lstCapture[i].nTimestamp;
+	}
+
+	// Thread names
+	cFile.PutS("{\"traceEvents\":[\n");
+	for (uint32 i=0; i<m_lstThreadBuffers.GetNumOfElements(); i++) {
+		const ThreadBuffer &cThreadBuffer = *m_lstThreadBuffers[i];
+		cFile.PutS(String::Format("{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%d,\"args\":{\"name\":", cThreadBuffer.nThread) + ToJsonString(cThreadBuffer.sName) + "}},\n");
+	}
+
+	// Events
+	for (uint32 i=0; i<m_lstCapture.GetNumOfElements(); i++) {
+		const Event &sEvent = m_lstCapture[i];
+		const String sCommon = String::Format("\"pid\":1,\"tid\":%d,\"ts\":%.3f", sEvent.nThread, (sEvent.nTimestamp - nStartTime)/1000.0);
+		switch (sEvent.nType) {
+			case ZoneBegin:
+				cFile.PutS("{\"name\":" + ToJsonString(sEvent.pszName) + ",\"ph\":\"B\"," + sCommon + "},\n");
+				break;
+
+			case ZoneEnd:
+				cFile.PutS("{\"ph\":\"E\"," + sCommon + "},\n");
+				break;
+
+			case Frame:
+				cFile.PutS("{\"name\":\"Frame\",\"ph\":\"i\",\"s\":\"g\"," + sCommon + "},\n");
+				break;
+
+			case Counter:
+				cFile.PutS("{\"name\":" + ToJsonString(sEvent.pszName) + ",\"ph\":\"C\"," + sCommon + String::Format(",\"args\":{\"value\":%g}},\n", sEvent.dValue));
+				break;
+		}
+	}
+
+	// The trace format allows no comma behind the last event, so close with an empty metadata event
+	cFile.PutS("{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":1,\"args\":{\"name\":\"PixelLight\"}}\n]}\n");
+
+	// Done
+	cFile.Close();
+	return true;
+}
+
+
+//[-------------------------------------------------------]
+//[ Private functions                                     ]
+//[-------------------------------------------------------]
+/**
+*  @brief
+*    Constructor
+*/
+Profiler::Profiler() :
+	m_bEnabled(false),
+	m_bCapturing(false),
+	m_nThreadBufferSize(16384)
+{
+}
+
+/**
+*  @brief
+*    Copy constructor
+*/
+Profiler::Profiler(const Profiler &cSource) :
+	m_bEnabled(false),
+	m_bCapturing(false),
+	m_nThreadBufferSize(16384)
+{
+	// No implementation because the copy constructor is never used
+}
+
+/**
+*  @brief
+*    Destructor
+*/
+Profiler::~Profiler()
+{
+	// Destroy the ring buffers
+	for (uint32 i=0; i<m_lstThreadBuffers.GetNumOfElements(); i++) {
+		ThreadBuffer *pThreadBuffer = m_lstThreadBuffers[i];
+		delete [] pThreadBuffer->pEvents;
+		delete pThreadBuffer;
+	}
+	g_pThreadBuffer = nullptr;
+}
+
+/**
+*  @brief
+*    Copy operator
+*/
+Profiler &Profiler::operator =(const Profiler &cSource)
+{
+	// No implementation because the copy operator is never used
+	return *this;
+}
+
+/**
+*  @brief
+*    Returns the ring buffer of the calling thread
+*/
+Profiler::ThreadBuffer &Profiler::GetThreadBuffer()
+{
+	ThreadBuffer *pThreadBuffer = static_cast<ThreadBuffer*>(g_pThreadBuffer);
+	if (!pThreadBuffer) {
+		// This is the first event of this thread, create it's ring buffer
+		const MutexGuard cMutexGuard(m_cCriticalSection);
+		pThreadBuffer = new ThreadBuffer;
+		pThreadBuffer->pEvents			= new Event[m_nThreadBufferSize];
+		pThreadBuffer->nMask			= m_nThreadBufferSize - 1;
+		pThreadBuffer->nWrite			= 0;
+		pThreadBuffer->nRead			= 0;
+		pThreadBuffer->nNumOfDropped	= 0;
+		pThreadBuffer->nThread			= m_lstThreadBuffers.GetNumOfElements();
+		pThreadBuffer->sName			= String("Thread ") + pThreadBuffer->nThread;
+		pThreadBuffer->nDepth			= 0;
+		pThreadBuffer->nNumOfOpenZones	= 0;
+		pThreadBuffer->nDroppedZones	= 0;
+		pThreadBuffer->nCollectDepth	= 0;
+		m_lstThreadBuffers.Add(pThreadBuffer);
+		g_pThreadBuffer = pThreadBuffer;
+	}
+	return *pThreadBuffer;
+}
+
+/**
+*  @brief
+*    Writes an event into the ring buffer of the calling thread
+*/
+bool Profiler::Write(ThreadBuffer &cThreadBuffer, EEventType nType, const char *pszName, double dValue, uint32 nReserve)
+{
+	// Is there enough space left? (only this thread writes, so the write position can be used directly)
+	const uint32 nWrite = static_cast<uint32>(cThreadBuffer.nWrite);
+	if (nWrite - static_cast<uint32>(Atomic::Get(cThreadBuffer.nRead)) + 1 + nReserve > cThreadBuffer.nMask + 1) {
+		// Error, the ring buffer is full!
+		Atomic::Increment(cThreadBuffer.nNumOfDropped);
+		return false;
+	}
+
+	// Write the event
+	Event &sEvent = cThreadBuffer.pEvents[nWrite & cThreadBuffer.nMask];
+	sEvent.nTimestamp = System::GetInstance()->GetNanoseconds();
+	sEvent.dValue	  = dValue;
+	sEvent.pszName	  = pszName;
+	sEvent.nType	  = nType;
+	sEvent.nThread	  = cThreadBuffer.nThread;
+
+	// Publish the event, the atomic operation ensures that the collecting thread sees the data of the event
+	Atomic::Exchange(cThreadBuffer.nWrite, static_cast<int32>(nWrite + 1));
+
+	// Done
+	return true;
+}
+
+/**
+*  @brief
+*    Returns the statistics of a zone or counter
+*/
+Profiler::Statistics &Profiler::GetStatistics(const char *pszName, EEventType nType)
+{
+	// There are usually only a few different zones and counters, so a linear search is fine
+	// (the same name may be stored at different addresses within different modules)
+	for (uint32 i=0; i<m_lstStatistics.GetNumOfElements(); i++) {
+		Statistics &sStatistics = m_lstStatistics[i];
+		if (sStatistics.nType == static_cast<uint32>(nType) && (sStatistics.pszName == pszName || !strcmp(sStatistics.pszName, pszName)))
+			return sStatistics;
+	}
+
+	// Add new statistics
+	Statistics &sStatistics = m_lstStatistics.Add();
+	sStatistics.pszName  = pszName;
+	sStatistics.nType	 = nType;
+	sStatistics.nCalls	 = 0;
+	sStatistics.nTime	 = 0;
+	sStatistics.nMaxTime = 0;
+	sStatistics.dValue	 = 0.0;
+	return sStatistics;
+}
+
+/**
+*  @brief
+*    Writes the statistics of the last frame into "Profiling" and resets them
+*/
+void Profiler::PublishStatistics()
+{
+	const MutexGuard cMutexGuard(m_cCriticalSection);
+
+	// Only format the texts if they are shown
+	Profiling *pProfiling = Profiling::GetInstance();
+	const bool bProfiling = (pProfiling && pProfiling->IsActive());
+
+	for (uint32 i=0; i<m_lstStatistics.GetNumOfElements(); i++) {
+		Statistics &sStatistics = m_lstStatistics[i];
+		if (sStatistics.nType == ZoneBegin) {
+			if (bProfiling)
+				pProfiling->Set("Profiler zones", sStatistics.pszName, String::Format("%.3f ms (%d calls, maximum %.3f ms)", sStatistics.nTime/1000000.0, sStatistics.nCalls, sStatistics.nMaxTime/1000000.0));
+
+			// Reset the zone statistics for the next frame
+			sStatistics.nCalls	 = 0;
+			sStatistics.nTime	 = 0;
+			sStatistics.nMaxTime = 0;
+		} else if (bProfiling) {
+			pProfiling->Set("Profiler counters", sStatistics.pszName, String::Format("%g", sStatistics.dValue));
+		}
+	}
+}
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+} // PLCore
@@ -27,6 +27,7 @@
 //[-------------------------------------------------------]
 #include "PLCore/System/System.h"
 #include "PLCore/Tools/Timing.h"
+#include "PLCore/Tools/Profiler.h"
 
 
 //[-------------------------------------------------------]
@@ -121,6 +122,9 @@ bool Timing::Update(uint64 *pnTimeToWait)
 			pnTimeToWait = 0;
 	}
 
+	// A new frame starts
+	PL_PROFILE_FRAME();
+
 	// Is the timing currently freezed?
 	if (!m_bFreezed) {
 		// Get time difference
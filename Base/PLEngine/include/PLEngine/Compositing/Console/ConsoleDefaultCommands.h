@@ -55,6 +55,7 @@ extern void PLConsoleCommandFPSLimit(ConsoleCommand &cCommand);			/**< Sets the
 extern void PLConsoleCommandProfiling(ConsoleCommand &cCommand);		/**< Activates/deactivates the profiling system */
 extern void PLConsoleCommandNextProfile(ConsoleCommand &cCommand);		/**< Selects the next profile group */
 extern void PLConsoleCommandPreviousProfile(ConsoleCommand &cCommand);	/**< Selects the previous profile group */
+extern void PLConsoleCommandProfilerTrace(ConsoleCommand &cCommand);	/**< Starts/stops capturing a profiler trace */
 // Debug commands
 extern void PLConsoleCommandWireframes(ConsoleCommand &cCommand);		/**< Toggle render wireframe mode */
 extern void PLConsoleCommandPoints(ConsoleCommand &cCommand);			/**< Toggle render point mode */
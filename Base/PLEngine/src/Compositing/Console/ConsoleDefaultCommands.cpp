@@ -28,6 +28,7 @@
 #include <PLCore/Runtime.h>
 #include <PLCore/Log/Log.h>
 #include <PLCore/Tools/Timing.h>
+#include <PLCore/Tools/Profiler.h>
 #include <PLCore/Tools/Profiling.h>
 #include <PLCore/Application/CoreApplication.h>
 #include <PLScene/Scene/SceneContainer.h>
@@ -146,7 +147,11 @@ void PLConsoleCommandFPSLimit(ConsoleCommand &cCommand)
 */
 void PLConsoleCommandProfiling(ConsoleCommand &cCommand)
 {
-	Profiling::GetInstance()->SetActive(!Profiling::GetInstance()->IsActive());
+	// The profiler provides the zone and counter information shown by the profiling system
+	const bool bActive = !Profiling::GetInstance()->IsActive();
+	Profiling::GetInstance()->SetActive(bActive);
+	if (bActive || !Profiler::GetInstance()->IsCapturing())
+		Profiler::GetInstance()->SetEnabled(bActive);
 }
 
 /**
@@ -167,6 +172,34 @@ void PLConsoleCommandPreviousProfile(ConsoleCommand &cCommand)
 	Profiling::GetInstance()->SelectPreviousGroup();
 }
 
+/**
+*  @brief
+*    Starts/stops capturing a profiler trace
+*/
+void PLConsoleCommandProfilerTrace(ConsoleCommand &cCommand)
+{
+	Profiler *pProfiler = Profiler::GetInstance();
+	if (pProfiler->IsCapturing()) {
+		// Stop capturing and export the trace
+		pProfiler->Collect();
+		pProfiler->SetCapturing(false);
+		if (!Profiling::GetInstance()->IsActive())
+			pProfiler->SetEnabled(false);
+		const String sFilename = cCommand.GetVar(0).s;
+		if (pProfiler->ExportChromeTrace(sFilename))
+			PL_LOG(Info, String::Format("Profiler trace with %d events written to '", pProfiler->GetCapture().GetNumOfElements()) + sFilename + '\'')
+		else
+			PL_LOG(Error, "Failed to write the profiler trace to '" + sFilename + '\'')
+		pProfiler->ClearCapture();
+	} else {
+		// Start capturing
+		pProfiler->ClearCapture();
+		pProfiler->SetEnabled(true);
+		pProfiler->SetCapturing(true);
+		PL_LOG(Info, "Capturing a profiler trace, use 'profilertrace <filename>' again to stop and to write the trace")
+	}
+}
+
 /**
 *  @brief
 *    Toggle coordinate axis visualization
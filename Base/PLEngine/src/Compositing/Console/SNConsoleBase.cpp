@@ -722,6 +722,7 @@ SNConsoleBase::SNConsoleBase() :
 	RegisterCommand(0,		"profiling",		"",			"",				Functor<void, ConsoleCommand &>(PLConsoleCommandProfiling));
 	RegisterCommand(0,		"nextprofile",		"",			"",				Functor<void, ConsoleCommand &>(PLConsoleCommandNextProfile));
 	RegisterCommand(0,		"preprofile",		"",			"",				Functor<void, ConsoleCommand &>(PLConsoleCommandPreviousProfile));
+	RegisterCommand(0,		"profilertrace",	"S",		"<filename>",	Functor<void, ConsoleCommand &>(PLConsoleCommandProfilerTrace));
 
 	// Debug commands
 	RegisterCommand(1,		"coordinateaxis",	"",			"",				Functor<void, ConsoleCommand &>(PLConsoleCommandCoordinateAxis));
@@ -87,6 +87,7 @@ class IEConvert : public ImageEffect {
 	//[ Public virtual ImageEffect functions                  ]
 	//[-------------------------------------------------------]
 	public:
+		PLGRAPHICS_API virtual bool Apply(ImagePart &cPart) const override;
 		PLGRAPHICS_API virtual bool Apply(ImageBuffer &cBuffer) const override;
 
 
@@ -49,10 +49,26 @@ namespace PLGraphics {
 *
 *  @note
 *    - The color format "ColorPalette" is not supported
+*    - Currently only scaling down is supported
 */
 class IEScale : public ImageEffect {
 
 
+	//[-------------------------------------------------------]
+	//[ Public definitions                                    ]
+	//[-------------------------------------------------------]
+	public:
+		/**
+		*  @brief
+		*    Scale filter
+		*/
+		enum EFilter {
+			Weighted3x3 = 0,	/**< Weighted 3x3 filter around the nearest old pixel */
+			Box         = 1,	/**< Average of all old pixels covered by a new pixel, best choice for scaling down by integer factors (e.g. mipmaps) */
+			Bilinear    = 2		/**< Bilinear interpolation at the center of a new pixel */
+		};
+
+
 	//[-------------------------------------------------------]
 	//[ RTTI interface                                        ]
 	//[-------------------------------------------------------]
@@ -75,8 +91,10 @@ class IEScale : public ImageEffect {
 		*    just make this mipmap to the new base image and destroy the now unused other mipmaps?
 		*    (extremely fast 'scale', but no set filters are applied and may cause problems on 'none standard'
 		*    images)
+		*  @param[in] nFilter
+		*    Scale filter (the color format "DataHalf" is always scaled without filter)
 		*/
-		PLGRAPHICS_API IEScale(const PLMath::Vector3i &vNewSize, bool bUseMipmaps);
+		PLGRAPHICS_API IEScale(const PLMath::Vector3i &vNewSize, bool bUseMipmaps, EFilter nFilter = Weighted3x3);
 
 		/**
 		*  @brief
@@ -102,6 +120,15 @@ class IEScale : public ImageEffect {
 		*/
 		PLGRAPHICS_API bool GetUseMipmaps() const;
 
+		/**
+		*  @brief
+		*    Get scale filter
+		*
+		*  @return
+		*    Scale filter
+		*/
+		PLGRAPHICS_API EFilter GetFilter() const;
+
 
 	//[-------------------------------------------------------]
 	//[ Public virtual ImageEffect functions                  ]
@@ -117,6 +144,7 @@ class IEScale : public ImageEffect {
 	private:
 		PLMath::Vector3i m_vNewSize;	/**< New size */
 		bool			 m_bUseMipmaps;	/**< Is it allowed to use existing mipmaps to scale down? */
+		EFilter			 m_nFilter;		/**< Scale filter */
 
 
 };
@@ -92,6 +92,33 @@ class ImageEffect : public PLCore::Object {
 		*/
 		PLGRAPHICS_API PLCore::String GetDescription() const;
 
+		/**
+		*  @brief
+		*    Returns whether or not the parallel execution mode is used
+		*
+		*  @return
+		*    'true' if the parallel execution mode is used, else 'false'
+		*
+		*  @see
+		*    - SetParallel()
+		*/
+		PLGRAPHICS_API bool IsParallel() const;
+
+		/**
+		*  @brief
+		*    Sets whether or not the parallel execution mode is used
+		*
+		*  @param[in] bParallel
+		*    'true' if the parallel execution mode should be used, else 'false'
+		*
+		*  @remarks
+		*    Within the parallel execution mode (default), effects supporting it split the image rows into ranges which
+		*    are processed by the worker threads of "PLCore::JobSystem", and use SIMD kernels for common formats. The
+		*    result is the same as the result of the serial execution mode, which processes all image data on the calling
+		*    thread using the generic code (useful for debugging and as reference for benchmarks).
+		*/
+		PLGRAPHICS_API void SetParallel(bool bParallel = true);
+
 
 	//[-------------------------------------------------------]
 	//[ Public virtual ImageEffect functions                  ]
@@ -134,6 +161,46 @@ class ImageEffect : public PLCore::Object {
 		virtual bool Apply(ImageBuffer &cBuffer) const;
 
 
+	//[-------------------------------------------------------]
+	//[ Protected definitions                                 ]
+	//[-------------------------------------------------------]
+	protected:
+		typedef void (*ROWFUNCTION)(PLCore::uint32, PLCore::uint32, void*);	/**< Row function, receives the first row, the row behind the last row and the user data */
+
+
+	//[-------------------------------------------------------]
+	//[ Protected functions                                   ]
+	//[-------------------------------------------------------]
+	protected:
+		/**
+		*  @brief
+		*    Processes the rows of an image, in parallel if possible
+		*
+		*  @param[in] nNumOfRows
+		*    Number of rows to process (for example height*depth of the image)
+		*  @param[in] nRowSize
+		*    Number of bytes written per row, used to decide how many rows are processed at once
+		*  @param[in] pFunction
+		*    Function processing a range of rows, must be valid and must be safe to be called by multiple threads at the same time
+		*  @param[in] pData
+		*    Data to pass to the function, can be a null pointer
+		*
+		*  @note
+		*    - The function is called directly on the calling thread for all rows if the parallel execution mode is not
+		*      used, if there are no worker threads or if there's not enough work to split
+		*    - Make sure that the data of all used image buffers was requested before, so the image buffers don't have to
+		*      create their data within the row function
+		*/
+		PLGRAPHICS_API void ProcessRows(PLCore::uint32 nNumOfRows, PLCore::uint32 nRowSize, ROWFUNCTION pFunction, void *pData) const;
+
+
+	//[-------------------------------------------------------]
+	//[ Private data                                          ]
+	//[-------------------------------------------------------]
+	private:
+		bool m_bParallel;	/**< Use the parallel execution mode? */
+
+
 };
 
 
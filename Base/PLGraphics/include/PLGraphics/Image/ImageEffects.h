@@ -101,11 +101,13 @@ class ImageEffects {
 		*    just make this mipmap to the new base image and destroy the now unused other mipmaps?
 		*    (extremely fast 'scale', but no set filters are applied and may cause problems on 'none standard'
 		*    images)
+		*  @param[in] nFilter
+		*    Scale filter
 		*
 		*  @return
 		*    Scale image effect
 		*/
-		static inline IEScale Scale(const PLMath::Vector3i &vNewSize, bool bUseMipmaps);
+		static inline IEScale Scale(const PLMath::Vector3i &vNewSize, bool bUseMipmaps, IEScale::EFilter nFilter = IEScale::Weighted3x3);
 
 		/**
 		*  @brief
@@ -53,9 +53,9 @@ inline IEFilter ImageEffects::Filter()
 *  @brief
 *    Create scale image effect
 */
-inline IEScale ImageEffects::Scale(const PLMath::Vector3i &vNewSize, bool bUseMipmaps)
+inline IEScale ImageEffects::Scale(const PLMath::Vector3i &vNewSize, bool bUseMipmaps, IEScale::EFilter nFilter)
 {
-	return IEScale(vNewSize, bUseMipmaps);
+	return IEScale(vNewSize, bUseMipmaps, nFilter);
 }
 
 /**
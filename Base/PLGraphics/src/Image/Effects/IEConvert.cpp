@@ -25,9 +25,16 @@
 //[-------------------------------------------------------]
 //[ Includes                                              ]
 //[-------------------------------------------------------]
+#include <PLMath/PLMath.h>
+#include "PLGraphics/Image/ImagePart.h"
 #include "PLGraphics/Image/ImageBuffer.h"
 #include "PLGraphics/Image/ImageEffects.h"
 #include "PLGraphics/Image/Effects/IEConvert.h"
+// SSE2 kernels are used when the SSE code path of PLMath is enabled and SSE2 is available at compile time
+#if defined(PLMATH_SSE) && (defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2))
+	#define PLGRAPHICS_SSE2
+	#include <emmintrin.h>
+#endif
 
 
 //[-------------------------------------------------------]
@@ -37,6 +44,48 @@ using namespace PLCore;
 namespace PLGraphics {
 
 
+//[-------------------------------------------------------]
+//[ Global functions                                      ]
+//[-------------------------------------------------------]
+/**
+*  @brief
+*    Converts a component value into the destination data type
+*
+*  @remarks
+*    Floating point values outside of the range of an integer destination data type are saturated, the
+*    SIMD kernels are doing the same (a plain cast of such values is undefined).
+*/
+template <typename DestinationType, typename ValueType>
+inline DestinationType ConvertComponent(ValueType Value)
+{
+	return static_cast<DestinationType>(Value);
+}
+
+template <>
+inline uint8 ConvertComponent<uint8, float>(float fValue)
+{
+	return (fValue <= 0.0f) ? 0 : ((fValue >= 255.0f) ? 255 : static_cast<uint8>(fValue));
+}
+
+template <>
+inline uint8 ConvertComponent<uint8, double>(double fValue)
+{
+	return (fValue <= 0.0) ? 0 : ((fValue >= 255.0) ? 255 : static_cast<uint8>(fValue));
+}
+
+template <>
+inline uint16 ConvertComponent<uint16, float>(float fValue)
+{
+	return (fValue <= 0.0f) ? 0 : ((fValue >= 65535.0f) ? 65535 : static_cast<uint16>(fValue));
+}
+
+template <>
+inline uint16 ConvertComponent<uint16, double>(double fValue)
+{
+	return (fValue <= 0.0) ? 0 : ((fValue >= 65535.0) ? 65535 : static_cast<uint16>(fValue));
+}
+
+
 //[-------------------------------------------------------]
 //[ Classes                                               ]
 //[-------------------------------------------------------]
@@ -62,19 +111,23 @@ class ConvertData {
 		*    Destination image buffer (MUST have valid data!)
 		*  @param[out] AlphaValue
 		*    If an alpha channel is added, this is the set alpha value for every pixel
+		*  @param[in]  nFirstPixel
+		*    Index of the first pixel to convert
+		*  @param[in]  nEndPixel
+		*    Index of the pixel behind the last pixel to convert
 		*/
-		ConvertData(const ImageBuffer &cSourceImageBuffer, ImageBuffer &cDestinationImageBuffer, DestinationType AlphaValue)
+		ConvertData(const ImageBuffer &cSourceImageBuffer, ImageBuffer &cDestinationImageBuffer, DestinationType AlphaValue, uint32 nFirstPixel, uint32 nEndPixel)
 		{
-			// Get the data pointers
-			const SourceType      *pSourceData      = reinterpret_cast<const SourceType*>(cSourceImageBuffer.GetData());
-				  DestinationType *pDestinationData = reinterpret_cast<DestinationType*>(cDestinationImageBuffer.GetData());
-
 			// Get the number of source and destination color components
 			const uint32 nNumOfSourceColorComponents      = cSourceImageBuffer.GetComponentsPerPixel();
 			const uint32 nNumOfDestinationColorComponents = cDestinationImageBuffer.GetComponentsPerPixel();
 
-			// Get the total number of source elements (e.g. the total number of floats the image is made up of)
-			const uint32 nNumOfSourceElements = cSourceImageBuffer.GetNumOfPixels()*cSourceImageBuffer.GetComponentsPerPixel();
+			// Get the data pointers of the first pixel to convert
+			const SourceType      *pSourceData      = reinterpret_cast<const SourceType*>(cSourceImageBuffer.GetData()) + nFirstPixel*nNumOfSourceColorComponents;
+				  DestinationType *pDestinationData = reinterpret_cast<DestinationType*>(cDestinationImageBuffer.GetData()) + nFirstPixel*nNumOfDestinationColorComponents;
+
+			// Get the number of source elements to convert (e.g. the number of floats the pixels are made up of)
+			const uint32 nNumOfSourceElements = (nEndPixel - nFirstPixel)*nNumOfSourceColorComponents;
 
 			// Convert source color format dependent
 			switch (cSourceImageBuffer.GetColorFormat()) {
@@ -87,9 +140,9 @@ class ConvertData {
 							// Loop through all pixels
 							for (const SourceType *pSourceDataEnd=pSourceData+nNumOfSourceElements; pSourceData<pSourceDataEnd; pSourceData+=nNumOfSourceColorComponents, pDestinationData+=nNumOfDestinationColorComponents) {
 								// Copy over RGB
-								pDestinationData[0] = static_cast<DestinationType>(pSourceData[0]);
-								pDestinationData[1] = static_cast<DestinationType>(pSourceData[1]);
-								pDestinationData[2] = static_cast<DestinationType>(pSourceData[2]);
+								pDestinationData[0] = ConvertComponent<DestinationType>(pSourceData[0]);
+								pDestinationData[1] = ConvertComponent<DestinationType>(pSourceData[1]);
+								pDestinationData[2] = ConvertComponent<DestinationType>(pSourceData[2]);
 							}
 							break;
 
@@ -98,9 +151,9 @@ class ConvertData {
 							// Loop through all pixels
 							for (const SourceType *pSourceDataEnd=pSourceData+nNumOfSourceElements; pSourceData<pSourceDataEnd; pSourceData+=nNumOfSourceColorComponents, pDestinationData+=nNumOfDestinationColorComponents) {
 								// Copy over RGB
-								pDestinationData[0] = static_cast<DestinationType>(pSourceData[0]);
-								pDestinationData[1] = static_cast<DestinationType>(pSourceData[1]);
-								pDestinationData[2] = static_cast<DestinationType>(pSourceData[2]);
+								pDestinationData[0] = ConvertComponent<DestinationType>(pSourceData[0]);
+								pDestinationData[1] = ConvertComponent<DestinationType>(pSourceData[1]);
+								pDestinationData[2] = ConvertComponent<DestinationType>(pSourceData[2]);
 
 								// Set alpha to AlphaValue
 								pDestinationData[3] = AlphaValue;
@@ -112,9 +165,9 @@ class ConvertData {
 							// Loop through all pixels
 							for (const SourceType *pSourceDataEnd=pSourceData+nNumOfSourceElements; pSourceData<pSourceDataEnd; pSourceData+=nNumOfSourceColorComponents, pDestinationData+=nNumOfDestinationColorComponents) {
 								// Copy over RGB with R and B flipped
-								pDestinationData[0] = static_cast<DestinationType>(pSourceData[2]);
-								pDestinationData[1] = static_cast<DestinationType>(pSourceData[1]);
-								pDestinationData[2] = static_cast<DestinationType>(pSourceData[0]);
+								pDestinationData[0] = ConvertComponent<DestinationType>(pSourceData[2]);
+								pDestinationData[1] = ConvertComponent<DestinationType>(pSourceData[1]);
+								pDestinationData[2] = ConvertComponent<DestinationType>(pSourceData[0]);
 							}
 							break;
 
@@ -123,9 +176,9 @@ class ConvertData {
 							// Loop through all pixels
 							for (const SourceType *pSourceDataEnd=pSourceData+nNumOfSourceElements; pSourceData<pSourceDataEnd; pSourceData+=nNumOfSourceColorComponents, pDestinationData+=nNumOfDestinationColorComponents) {
 								// Copy over RGB with R and B flipped
-								pDestinationData[0] = static_cast<DestinationType>(pSourceData[2]);
-								pDestinationData[1] = static_cast<DestinationType>(pSourceData[1]);
-								pDestinationData[2] = static_cast<DestinationType>(pSourceData[0]);
+								pDestinationData[0] = ConvertComponent<DestinationType>(pSourceData[2]);
+								pDestinationData[1] = ConvertComponent<DestinationType>(pSourceData[1]);
+								pDestinationData[2] = ConvertComponent<DestinationType>(pSourceData[0]);
 
 								// Set alpha to AlphaValue
 								pDestinationData[3] = AlphaValue;
@@ -137,7 +190,7 @@ class ConvertData {
 							// Loop through all pixels
 							for (const SourceType *pSourceDataEnd=pSourceData+nNumOfSourceElements; pSourceData<pSourceDataEnd; pSourceData+=nNumOfSourceColorComponents, pDestinationData+=nNumOfDestinationColorComponents) {
 								// Convert RGB to grayscale using "Human formula"... our eyes recognize color components not uniformly
-								pDestinationData[0] = static_cast<DestinationType>(pSourceData[0]*0.299 + pSourceData[1]*0.587 + pSourceData[2]*0.114);
+								pDestinationData[0] = ConvertComponent<DestinationType>(pSourceData[0]*0.299 + pSourceData[1]*0.587 + pSourceData[2]*0.114);
 							}
 							break;
 
@@ -146,7 +199,7 @@ class ConvertData {
 							// Loop through all pixels
 							for (const SourceType *pSourceDataEnd=pSourceData+nNumOfSourceElements; pSourceData<pSourceDataEnd; pSourceData+=nNumOfSourceColorComponents, pDestinationData+=nNumOfDestinationColorComponents) {
 								// Convert RGB to grayscale using "Human formula"... our eyes recognize color components not uniformly
-								pDestinationData[0] = static_cast<DestinationType>(pSourceData[0]*0.299 + pSourceData[1]*0.587 + pSourceData[2]*0.114);
+								pDestinationData[0] = ConvertComponent<DestinationType>(pSourceData[0]*0.299 + pSourceData[1]*0.587 + pSourceData[2]*0.114);
 
 								// Set alpha to AlphaValue
 								pDestinationData[1] = AlphaValue;
@@ -168,9 +221,9 @@ class ConvertData {
 							// Loop through all pixels
 							for (const SourceType *pSourceDataEnd=pSourceData+nNumOfSourceElements; pSourceData<pSourceDataEnd; pSourceData+=nNumOfSourceColorComponents, pDestinationData+=nNumOfDestinationColorComponents) {
 								// Copy over RGB
-								pDestinationData[0] = static_cast<DestinationType>(pSourceData[0]);
-								pDestinationData[1] = static_cast<DestinationType>(pSourceData[1]);
-								pDestinationData[2] = static_cast<DestinationType>(pSourceData[2]);
+								pDestinationData[0] = ConvertComponent<DestinationType>(pSourceData[0]);
+								pDestinationData[1] = ConvertComponent<DestinationType>(pSourceData[1]);
+								pDestinationData[2] = ConvertComponent<DestinationType>(pSourceData[2]);
 
 								// ... the alpha value of the source data get's lost...
 							}
@@ -181,10 +234,10 @@ class ConvertData {
 							// Loop through all pixels
 							for (const SourceType *pSourceDataEnd=pSourceData+nNumOfSourceElements; pSourceData<pSourceDataEnd; pSourceData+=nNumOfSourceColorComponents, pDestinationData+=nNumOfDestinationColorComponents) {
 								// Copy over RGBA
-								pDestinationData[0] = static_cast<DestinationType>(pSourceData[0]);
-								pDestinationData[1] = static_cast<DestinationType>(pSourceData[1]);
-								pDestinationData[2] = static_cast<DestinationType>(pSourceData[2]);
-								pDestinationData[3] = static_cast<DestinationType>(pSourceData[3]);
+								pDestinationData[0] = ConvertComponent<DestinationType>(pSourceData[0]);
+								pDestinationData[1] = ConvertComponent<DestinationType>(pSourceData[1]);
+								pDestinationData[2] = ConvertComponent<DestinationType>(pSourceData[2]);
+								pDestinationData[3] = ConvertComponent<DestinationType>(pSourceData[3]);
 							}
 							break;
 
@@ -193,9 +246,9 @@ class ConvertData {
 							// Loop through all pixels
 							for (const SourceType *pSourceDataEnd=pSourceData+nNumOfSourceElements; pSourceData<pSourceDataEnd; pSourceData+=nNumOfSourceColorComponents, pDestinationData+=nNumOfDestinationColorComponents) {
 								// Copy over RGB with R and B flipped
-								pDestinationData[0] = static_cast<DestinationType>(pSourceData[2]);
-								pDestinationData[1] = static_cast<DestinationType>(pSourceData[1]);
-								pDestinationData[2] = static_cast<DestinationType>(pSourceData[0]);
+								pDestinationData[0] = ConvertComponent<DestinationType>(pSourceData[2]);
+								pDestinationData[1] = ConvertComponent<DestinationType>(pSourceData[1]);
+								pDestinationData[2] = ConvertComponent<DestinationType>(pSourceData[0]);
 
 								// ... the alpha value of the source data get's lost...
 							}
@@ -206,10 +259,10 @@ class ConvertData {
 							// Loop through all pixels
 							for (const SourceType *pSourceDataEnd=pSourceData+nNumOfSourceElements; pSourceData<pSourceDataEnd; pSourceData+=nNumOfSourceColorComponents, pDestinationData+=nNumOfDestinationColorComponents) {
 								// Copy over RGBA with R and B flipped
-								pDestinationData[0] = static_cast<DestinationType>(pSourceData[2]);
-								pDestinationData[1] = static_cast<DestinationType>(pSourceData[1]);
-								pDestinationData[2] = static_cast<DestinationType>(pSourceData[0]);
-								pDestinationData[3] = static_cast<DestinationType>(pSourceData[3]);
+								pDestinationData[0] = ConvertComponent<DestinationType>(pSourceData[2]);
+								pDestinationData[1] = ConvertComponent<DestinationType>(pSourceData[1]);
+								pDestinationData[2] = ConvertComponent<DestinationType>(pSourceData[0]);
+								pDestinationData[3] = ConvertComponent<DestinationType>(pSourceData[3]);
 							}
 							break;
 
@@ -218,7 +271,7 @@ class ConvertData {
 							// Loop through all pixels
 							for (const SourceType *pSourceDataEnd=pSourceData+nNumOfSourceElements; pSourceData<pSourceDataEnd; pSourceData+=nNumOfSourceColorComponents, pDestinationData+=nNumOfDestinationColorComponents) {
 								// Convert RGB to grayscale using "Human formula"... our eyes recognize color components not uniformly
-								pDestinationData[0] = static_cast<DestinationType>(pSourceData[0]*0.299 + pSourceData[1]*0.587 + pSourceData[2]*0.114);
+								pDestinationData[0] = ConvertComponent<DestinationType>(pSourceData[0]*0.299 + pSourceData[1]*0.587 + pSourceData[2]*0.114);
 
 								// ... the alpha value of the source data get's lost...
 							}
@@ -229,10 +282,10 @@ class ConvertData {
 							// Loop through all pixels
 							for (const SourceType *pSourceDataEnd=pSourceData+nNumOfSourceElements; pSourceData<pSourceDataEnd; pSourceData+=nNumOfSourceColorComponents, pDestinationData+=nNumOfDestinationColorComponents) {
 								// Convert RGB to grayscale using "Human formula"... our eyes recognize color components not uniformly
-								pDestinationData[0] = static_cast<DestinationType>(pSourceData[0]*0.299 + pSourceData[1]*0.587 + pSourceData[2]*0.114);
+								pDestinationData[0] = ConvertComponent<DestinationType>(pSourceData[0]*0.299 + pSourceData[1]*0.587 + pSourceData[2]*0.114);
 
 								// Copy over alpha
-								pDestinationData[1] = static_cast<DestinationType>(pSourceData[3]);
+								pDestinationData[1] = ConvertComponent<DestinationType>(pSourceData[3]);
 							}
 							break;
 
@@ -251,9 +304,9 @@ class ConvertData {
 							// Loop through all pixels
 							for (const SourceType *pSourceDataEnd=pSourceData+nNumOfSourceElements; pSourceData<pSourceDataEnd; pSourceData+=nNumOfSourceColorComponents, pDestinationData+=nNumOfDestinationColorComponents) {
 								// Copy over RGB with R and B flipped
-								pDestinationData[0] = static_cast<DestinationType>(pSourceData[2]);
-								pDestinationData[1] = static_cast<DestinationType>(pSourceData[1]);
-								pDestinationData[2] = static_cast<DestinationType>(pSourceData[0]);
+								pDestinationData[0] = ConvertComponent<DestinationType>(pSourceData[2]);
+								pDestinationData[1] = ConvertComponent<DestinationType>(pSourceData[1]);
+								pDestinationData[2] = ConvertComponent<DestinationType>(pSourceData[0]);
 							}
 							break;
 
@@ -262,9 +315,9 @@ class ConvertData {
 							// Loop through all pixels
 							for (const SourceType *pSourceDataEnd=pSourceData+nNumOfSourceElements; pSourceData<pSourceDataEnd; pSourceData+=nNumOfSourceColorComponents, pDestinationData+=nNumOfDestinationColorComponents) {
 								// Copy over RGB with R and B flipped
-								pDestinationData[0] = static_cast<DestinationType>(pSourceData[2]);
-								pDestinationData[1] = static_cast<DestinationType>(pSourceData[1]);
-								pDestinationData[2] = static_cast<DestinationType>(pSourceData[0]);
+								pDestinationData[0] = ConvertComponent<DestinationType>(pSourceData[2]);
+								pDestinationData[1] = ConvertComponent<DestinationType>(pSourceData[1]);
+								pDestinationData[2] = ConvertComponent<DestinationType>(pSourceData[0]);
 
 								// Set alpha to AlphaValue
 								pDestinationData[3] = AlphaValue;
@@ -276,9 +329,9 @@ class ConvertData {
 							// Loop through all pixels
 							for (const SourceType *pSourceDataEnd=pSourceData+nNumOfSourceElements; pSourceData<pSourceDataEnd; pSourceData+=nNumOfSourceColorComponents, pDestinationData+=nNumOfDestinationColorComponents) {
 								// Copy over RGB
-								pDestinationData[0] = static_cast<DestinationType>(pSourceData[0]);
-								pDestinationData[1] = static_cast<DestinationType>(pSourceData[1]);
-								pDestinationData[2] = static_cast<DestinationType>(pSourceData[2]);
+								pDestinationData[0] = ConvertComponent<DestinationType>(pSourceData[0]);
+								pDestinationData[1] = ConvertComponent<DestinationType>(pSourceData[1]);
+								pDestinationData[2] = ConvertComponent<DestinationType>(pSourceData[2]);
 							}
 							break;
 
@@ -287,9 +340,9 @@ class ConvertData {
 							// Loop through all pixels
 							for (const SourceType *pSourceDataEnd=pSourceData+nNumOfSourceElements; pSourceData<pSourceDataEnd; pSourceData+=nNumOfSourceColorComponents, pDestinationData+=nNumOfDestinationColorComponents) {
 								// Copy over RGB
-								pDestinationData[0] = static_cast<DestinationType>(pSourceData[0]);
-								pDestinationData[1] = static_cast<DestinationType>(pSourceData[1]);
-								pDestinationData[2] = static_cast<DestinationType>(pSourceData[2]);
+								pDestinationData[0] = ConvertComponent<DestinationType>(pSourceData[0]);
+								pDestinationData[1] = ConvertComponent<DestinationType>(pSourceData[1]);
+								pDestinationData[2] = ConvertComponent<DestinationType>(pSourceData[2]);
 
 								// Set alpha to AlphaValue
 								pDestinationData[3] = AlphaValue;
@@ -301,7 +354,7 @@ class ConvertData {
 							// Loop through all pixels
 							for (const SourceType *pSourceDataEnd=pSourceData+nNumOfSourceElements; pSourceData<pSourceDataEnd; pSourceData+=nNumOfSourceColorComponents, pDestinationData+=nNumOfDestinationColorComponents) {
 								// Convert BGR to grayscale using "Human formula"... our eyes recognize color components not uniformly
-								pDestinationData[0] = static_cast<DestinationType>(pSourceData[2]*0.299 + pSourceData[1]*0.587 + pSourceData[0]*0.114);
+								pDestinationData[0] = ConvertComponent<DestinationType>(pSourceData[2]*0.299 + pSourceData[1]*0.587 + pSourceData[0]*0.114);
 							}
 							break;
 
@@ -310,7 +363,7 @@ class ConvertData {
 							// Loop through all pixels
 							for (const SourceType *pSourceDataEnd=pSourceData+nNumOfSourceElements; pSourceData<pSourceDataEnd; pSourceData+=nNumOfSourceColorComponents, pDestinationData+=nNumOfDestinationColorComponents) {
 								// Convert BGR to grayscale using "Human formula"... our eyes recognize color components not uniformly
-								pDestinationData[0] = static_cast<DestinationType>(pSourceData[2]*0.299 + pSourceData[1]*0.587 + pSourceData[0]*0.114);
+								pDestinationData[0] = ConvertComponent<DestinationType>(pSourceData[2]*0.299 + pSourceData[1]*0.587 + pSourceData[0]*0.114);
 
 								// Set alpha to AlphaValue
 								pDestinationData[1] = AlphaValue;
@@ -332,9 +385,9 @@ class ConvertData {
 							// Loop through all pixels
 							for (const SourceType *pSourceDataEnd=pSourceData+nNumOfSourceElements; pSourceData<pSourceDataEnd; pSourceData+=nNumOfSourceColorComponents, pDestinationData+=nNumOfDestinationColorComponents) {
 								// Copy over RGB with R and B flipped
-								pDestinationData[0] = static_cast<DestinationType>(pSourceData[2]);
-								pDestinationData[1] = static_cast<DestinationType>(pSourceData[1]);
-								pDestinationData[2] = static_cast<DestinationType>(pSourceData[0]);
+								pDestinationData[0] = ConvertComponent<DestinationType>(pSourceData[2]);
+								pDestinationData[1] = ConvertComponent<DestinationType>(pSourceData[1]);
+								pDestinationData[2] = ConvertComponent<DestinationType>(pSourceData[0]);
 
 								// ... the alpha value of the source data get's lost...
 							}
@@ -345,10 +398,10 @@ class ConvertData {
 							// Loop through all pixels
 							for (const SourceType *pSourceDataEnd=pSourceData+nNumOfSourceElements; pSourceData<pSourceDataEnd; pSourceData+=nNumOfSourceColorComponents, pDestinationData+=nNumOfDestinationColorComponents) {
 								// Copy over RGBA with R and B flipped
-								pDestinationData[0] = static_cast<DestinationType>(pSourceData[2]);
-								pDestinationData[1] = static_cast<DestinationType>(pSourceData[1]);
-								pDestinationData[2] = static_cast<DestinationType>(pSourceData[0]);
-								pDestinationData[3] = static_cast<DestinationType>(pSourceData[3]);
+								pDestinationData[0] = ConvertComponent<DestinationType>(pSourceData[2]);
+								pDestinationData[1] = ConvertComponent<DestinationType>(pSourceData[1]);
+								pDestinationData[2] = ConvertComponent<DestinationType>(pSourceData[0]);
+								pDestinationData[3] = ConvertComponent<DestinationType>(pSourceData[3]);
 							}
 							break;
 
@@ -357,9 +410,9 @@ class ConvertData {
 							// Loop through all pixels
 							for (const SourceType *pSourceDataEnd=pSourceData+nNumOfSourceElements; pSourceData<pSourceDataEnd; pSourceData+=nNumOfSourceColorComponents, pDestinationData+=nNumOfDestinationColorComponents) {
 								// Copy over RGB
-								pDestinationData[0] = static_cast<DestinationType>(pSourceData[0]);
-								pDestinationData[1] = static_cast<DestinationType>(pSourceData[1]);
-								pDestinationData[2] = static_cast<DestinationType>(pSourceData[2]);
+								pDestinationData[0] = ConvertComponent<DestinationType>(pSourceData[0]);
+								pDestinationData[1] = ConvertComponent<DestinationType>(pSourceData[1]);
+								pDestinationData[2] = ConvertComponent<DestinationType>(pSourceData[2]);
 
 								// ... the alpha value of the source data get's lost...
 							}
@@ -370,10 +423,10 @@ class ConvertData {
 							// Loop through all pixels
 							for (const SourceType *pSourceDataEnd=pSourceData+nNumOfSourceElements; pSourceData<pSourceDataEnd; pSourceData+=nNumOfSourceColorComponents, pDestinationData+=nNumOfDestinationColorComponents) {
 								// Copy over RGBA
-								pDestinationData[0] = static_cast<DestinationType>(pSourceData[0]);
-								pDestinationData[1] = static_cast<DestinationType>(pSourceData[1]);
-								pDestinationData[2] = static_cast<DestinationType>(pSourceData[2]);
-								pDestinationData[3] = static_cast<DestinationType>(pSourceData[3]);
+								pDestinationData[0] = ConvertComponent<DestinationType>(pSourceData[0]);
+								pDestinationData[1] = ConvertComponent<DestinationType>(pSourceData[1]);
+								pDestinationData[2] = ConvertComponent<DestinationType>(pSourceData[2]);
+								pDestinationData[3] = ConvertComponent<DestinationType>(pSourceData[3]);
 							}
 							break;
 
@@ -382,7 +435,7 @@ class ConvertData {
 							// Loop through all pixels
 							for (const SourceType *pSourceDataEnd=pSourceData+nNumOfSourceElements; pSourceData<pSourceDataEnd; pSourceData+=nNumOfSourceColorComponents, pDestinationData+=nNumOfDestinationColorComponents) {
 								// Convert BGR to grayscale using "Human formula"... our eyes recognize color components not uniformly
-								pDestinationData[0] = static_cast<DestinationType>(pSourceData[2]*0.299 + pSourceData[1]*0.587 + pSourceData[0]*0.114);
+								pDestinationData[0] = ConvertComponent<DestinationType>(pSourceData[2]*0.299 + pSourceData[1]*0.587 + pSourceData[0]*0.114);
 
 								// ... the alpha value of the source data get's lost...
 							}
@@ -393,10 +446,10 @@ class ConvertData {
 							// Loop through all pixels
 							for (const SourceType *pSourceDataEnd=pSourceData+nNumOfSourceElements; pSourceData<pSourceDataEnd; pSourceData+=nNumOfSourceColorComponents, pDestinationData+=nNumOfDestinationColorComponents) {
 								// Convert BGR to grayscale using "Human formula"... our eyes recognize color components not uniformly
-								pDestinationData[0] = static_cast<DestinationType>(pSourceData[2]*0.299 + pSourceData[1]*0.587 + pSourceData[0]*0.114);
+								pDestinationData[0] = ConvertComponent<DestinationType>(pSourceData[2]*0.299 + pSourceData[1]*0.587 + pSourceData[0]*0.114);
 
 								// Copy over alpha
-								pDestinationData[1] = static_cast<DestinationType>(pSourceData[3]);
+								pDestinationData[1] = ConvertComponent<DestinationType>(pSourceData[3]);
 							}
 							break;
 
@@ -415,9 +468,9 @@ class ConvertData {
 							// Loop through all pixels
 							for (const SourceType *pSourceDataEnd=pSourceData+nNumOfSourceElements; pSourceData<pSourceDataEnd; pSourceData+=nNumOfSourceColorComponents, pDestinationData+=nNumOfDestinationColorComponents) {
 								// Set all RGB components to the same grayscale value
-								pDestinationData[0] = static_cast<DestinationType>(pSourceData[0]);
-								pDestinationData[1] = static_cast<DestinationType>(pSourceData[0]);
-								pDestinationData[2] = static_cast<DestinationType>(pSourceData[0]);
+								pDestinationData[0] = ConvertComponent<DestinationType>(pSourceData[0]);
+								pDestinationData[1] = ConvertComponent<DestinationType>(pSourceData[0]);
+								pDestinationData[2] = ConvertComponent<DestinationType>(pSourceData[0]);
 							}
 							break;
 
@@ -426,9 +479,9 @@ class ConvertData {
 							// Loop through all pixels
 							for (const SourceType *pSourceDataEnd=pSourceData+nNumOfSourceElements; pSourceData<pSourceDataEnd; pSourceData+=nNumOfSourceColorComponents, pDestinationData+=nNumOfDestinationColorComponents) {
 								// Set all RGB components to the same grayscale value
-								pDestinationData[0] = static_cast<DestinationType>(pSourceData[0]);
-								pDestinationData[1] = static_cast<DestinationType>(pSourceData[0]);
-								pDestinationData[2] = static_cast<DestinationType>(pSourceData[0]);
+								pDestinationData[0] = ConvertComponent<DestinationType>(pSourceData[0]);
+								pDestinationData[1] = ConvertComponent<DestinationType>(pSourceData[0]);
+								pDestinationData[2] = ConvertComponent<DestinationType>(pSourceData[0]);
 
 								// Set alpha to AlphaValue
 								pDestinationData[3] = AlphaValue;
@@ -440,9 +493,9 @@ class ConvertData {
 							// Loop through all pixels
 							for (const SourceType *pSourceDataEnd=pSourceData+nNumOfSourceElements; pSourceData<pSourceDataEnd; pSourceData+=nNumOfSourceColorComponents, pDestinationData+=nNumOfDestinationColorComponents) {
 								// Set all BGR components to the same grayscale value
-								pDestinationData[0] = static_cast<DestinationType>(pSourceData[0]);
-								pDestinationData[1] = static_cast<DestinationType>(pSourceData[0]);
-								pDestinationData[2] = static_cast<DestinationType>(pSourceData[0]);
+								pDestinationData[0] = ConvertComponent<DestinationType>(pSourceData[0]);
+								pDestinationData[1] = ConvertComponent<DestinationType>(pSourceData[0]);
+								pDestinationData[2] = ConvertComponent<DestinationType>(pSourceData[0]);
 							}
 							break;
 
@@ -451,9 +504,9 @@ class ConvertData {
 							// Loop through all pixels
 							for (const SourceType *pSourceDataEnd=pSourceData+nNumOfSourceElements; pSourceData<pSourceDataEnd; pSourceData+=nNumOfSourceColorComponents, pDestinationData+=nNumOfDestinationColorComponents) {
 								// Set all BGR components to the same grayscale value
-								pDestinationData[0] = static_cast<DestinationType>(pSourceData[0]);
-								pDestinationData[1] = static_cast<DestinationType>(pSourceData[0]);
-								pDestinationData[2] = static_cast<DestinationType>(pSourceData[0]);
+								pDestinationData[0] = ConvertComponent<DestinationType>(pSourceData[0]);
+								pDestinationData[1] = ConvertComponent<DestinationType>(pSourceData[0]);
+								pDestinationData[2] = ConvertComponent<DestinationType>(pSourceData[0]);
 
 								// Set alpha to AlphaValue
 								pDestinationData[3] = AlphaValue;
@@ -465,7 +518,7 @@ class ConvertData {
 							// Loop through all pixels
 							for (const SourceType *pSourceDataEnd=pSourceData+nNumOfSourceElements; pSourceData<pSourceDataEnd; pSourceData+=nNumOfSourceColorComponents, pDestinationData+=nNumOfDestinationColorComponents) {
 								// Copy over grayscale
-								pDestinationData[0] = static_cast<DestinationType>(pSourceData[0]);
+								pDestinationData[0] = ConvertComponent<DestinationType>(pSourceData[0]);
 							}
 							break;
 
@@ -474,7 +527,7 @@ class ConvertData {
 							// Loop through all pixels
 							for (const SourceType *pSourceDataEnd=pSourceData+nNumOfSourceElements; pSourceData<pSourceDataEnd; pSourceData+=nNumOfSourceColorComponents, pDestinationData+=nNumOfDestinationColorComponents) {
 								// Copy over grayscale
-								pDestinationData[0] = static_cast<DestinationType>(pSourceData[0]);
+								pDestinationData[0] = ConvertComponent<DestinationType>(pSourceData[0]);
 
 								// Set alpha to AlphaValue
 								pDestinationData[1] = AlphaValue;
@@ -496,9 +549,9 @@ class ConvertData {
 							// Loop through all pixels
 							for (const SourceType *pSourceDataEnd=pSourceData+nNumOfSourceElements; pSourceData<pSourceDataEnd; pSourceData+=nNumOfSourceColorComponents, pDestinationData+=nNumOfDestinationColorComponents) {
 								// Set all RGB components to the same grayscale value
-								pDestinationData[0] = static_cast<DestinationType>(pSourceData[0]);
-								pDestinationData[1] = static_cast<DestinationType>(pSourceData[0]);
-								pDestinationData[2] = static_cast<DestinationType>(pSourceData[0]);
+								pDestinationData[0] = ConvertComponent<DestinationType>(pSourceData[0]);
+								pDestinationData[1] = ConvertComponent<DestinationType>(pSourceData[0]);
+								pDestinationData[2] = ConvertComponent<DestinationType>(pSourceData[0]);
 
 								// ... the alpha value of the source data get's lost...
 							}
@@ -509,12 +562,12 @@ class ConvertData {
 							// Loop through all pixels
 							for (const SourceType *pSourceDataEnd=pSourceData+nNumOfSourceElements; pSourceData<pSourceDataEnd; pSourceData+=nNumOfSourceColorComponents, pDestinationData+=nNumOfDestinationColorComponents) {
 								// Set all RGB components to the same grayscale value
-								pDestinationData[0] = static_cast<DestinationType>(pSourceData[0]);
-								pDestinationData[1] = static_cast<DestinationType>(pSourceData[0]);
-								pDestinationData[2] = static_cast<DestinationType>(pSourceData[0]);
+								pDestinationData[0] = ConvertComponent<DestinationType>(pSourceData[0]);
+								pDestinationData[1] = ConvertComponent<DestinationType>(pSourceData[0]);
+								pDestinationData[2] = ConvertComponent<DestinationType>(pSourceData[0]);
 
 								// Copy over grayscale
-								pDestinationData[3] = static_cast<DestinationType>(pSourceData[1]);
+								pDestinationData[3] = ConvertComponent<DestinationType>(pSourceData[1]);
 							}
 							break;
 
@@ -523,9 +576,9 @@ class ConvertData {
 							// Loop through all pixels
 							for (const SourceType *pSourceDataEnd=pSourceData+nNumOfSourceElements; pSourceData<pSourceDataEnd; pSourceData+=nNumOfSourceColorComponents, pDestinationData+=nNumOfDestinationColorComponents) {
 								// Set all BGR components to the same grayscale value
-								pDestinationData[0] = static_cast<DestinationType>(pSourceData[0]);
-								pDestinationData[1] = static_cast<DestinationType>(pSourceData[0]);
-								pDestinationData[2] = static_cast<DestinationType>(pSourceData[0]);
+								pDestinationData[0] = ConvertComponent<DestinationType>(pSourceData[0]);
+								pDestinationData[1] = ConvertComponent<DestinationType>(pSourceData[0]);
+								pDestinationData[2] = ConvertComponent<DestinationType>(pSourceData[0]);
 
 								// ... the alpha value of the source data get's lost...
 							}
@@ -536,12 +589,12 @@ class ConvertData {
 							// Loop through all pixels
 							for (const SourceType *pSourceDataEnd=pSourceData+nNumOfSourceElements; pSourceData<pSourceDataEnd; pSourceData+=nNumOfSourceColorComponents, pDestinationData+=nNumOfDestinationColorComponents) {
 								// Set all BGR components to the same grayscale value
-								pDestinationData[0] = static_cast<DestinationType>(pSourceData[0]);
-								pDestinationData[1] = static_cast<DestinationType>(pSourceData[0]);
-								pDestinationData[2] = static_cast<DestinationType>(pSourceData[0]);
+								pDestinationData[0] = ConvertComponent<DestinationType>(pSourceData[0]);
+								pDestinationData[1] = ConvertComponent<DestinationType>(pSourceData[0]);
+								pDestinationData[2] = ConvertComponent<DestinationType>(pSourceData[0]);
 
 								// Copy over grayscale
-								pDestinationData[3] = static_cast<DestinationType>(pSourceData[1]);
+								pDestinationData[3] = ConvertComponent<DestinationType>(pSourceData[1]);
 							}
 							break;
 
@@ -550,7 +603,7 @@ class ConvertData {
 							// Loop through all pixels
 							for (const SourceType *pSourceDataEnd=pSourceData+nNumOfSourceElements; pSourceData<pSourceDataEnd; pSourceData+=nNumOfSourceColorComponents, pDestinationData+=nNumOfDestinationColorComponents) {
 								// Copy over grayscale
-								pDestinationData[0] = static_cast<DestinationType>(pSourceData[0]);
+								pDestinationData[0] = ConvertComponent<DestinationType>(pSourceData[0]);
 
 								// ... the alpha value of the source data get's lost...
 							}
@@ -561,8 +614,8 @@ class ConvertData {
 							// Loop through all pixels
 							for (const SourceType *pSourceDataEnd=pSourceData+nNumOfSourceElements; pSourceData<pSourceDataEnd; pSourceData+=nNumOfSourceColorComponents, pDestinationData+=nNumOfDestinationColorComponents) {
 								// Copy over grayscale and alpha
-								pDestinationData[0] = static_cast<DestinationType>(pSourceData[0]);
-								pDestinationData[1] = static_cast<DestinationType>(pSourceData[1]);
+								pDestinationData[0] = ConvertComponent<DestinationType>(pSourceData[0]);
+								pDestinationData[1] = ConvertComponent<DestinationType>(pSourceData[1]);
 							}
 							break;
 
@@ -582,6 +635,326 @@ class ConvertData {
 };
 
 
+//[-------------------------------------------------------]
+//[ Global functions                                      ]
+//[-------------------------------------------------------]
+#ifdef PLGRAPHICS_SSE2
+	/**
+	*  @brief
+	*    Converts as many of the given pixels as possible using SSE2
+	*
+	*  @param[in]  cSourceImageBuffer
+	*    Source image buffer (MUST have valid data!)
+	*  @param[out] cDestinationImageBuffer
+	*    Destination image buffer (MUST have valid data!)
+	*  @param[in]  nFirstPixel
+	*    Index of the first pixel to convert
+	*  @param[in]  nEndPixel
+	*    Index of the pixel behind the last pixel to convert
+	*
+	*  @return
+	*    Number of converted pixels starting with the first pixel, the remaining pixels have to be converted by "ConvertData"
+	*
+	*  @note
+	*    - Supports the byte RGBA <-> BGRA swizzle and byte <-> float without color format change, all other conversions are left to "ConvertData"
+	*    - Float values outside of [0, 255] are saturated when converting to byte
+	*/
+	static uint32 ConvertPixelsSSE2(const ImageBuffer &cSourceImageBuffer, ImageBuffer &cDestinationImageBuffer, uint32 nFirstPixel, uint32 nEndPixel)
+	{
+		const EColorFormat nSourceColorFormat      = cSourceImageBuffer.GetColorFormat();
+		const EColorFormat nDestinationColorFormat = cDestinationImageBuffer.GetColorFormat();
+		const uint32	   nNumOfComponents		   = cSourceImageBuffer.GetComponentsPerPixel();
+		const uint32	   nNumOfPixels			   = nEndPixel - nFirstPixel;
+
+		// Source data format
+		switch (cSourceImageBuffer.GetDataFormat()) {
+			case DataByte:
+				// Byte RGBA <-> BGRA: Swap the first and the third component of four pixels at once
+				if (cDestinationImageBuffer.GetDataFormat() == DataByte &&
+					((nSourceColorFormat == ColorRGBA && nDestinationColorFormat == ColorBGRA) || (nSourceColorFormat == ColorBGRA && nDestinationColorFormat == ColorRGBA))) {
+					const __m128i *pSourceData		= reinterpret_cast<const __m128i*>(cSourceImageBuffer.GetData() + nFirstPixel*4);
+						  __m128i *pDestinationData = reinterpret_cast<__m128i*>(cDestinationImageBuffer.GetData() + nFirstPixel*4);
+					const __m128i vKeepMask = _mm_set1_epi32(static_cast<int>(0xFF00FF00));
+					const __m128i vByteMask = _mm_set1_epi32(0x000000FF);
+					const uint32 nNumOfBlocks = nNumOfPixels/4;
+					for (uint32 i=0; i<nNumOfBlocks; i++) {
+						const __m128i vPixels = _mm_loadu_si128(pSourceData + i);
+						const __m128i vFirst  = _mm_slli_epi32(_mm_and_si128(vPixels, vByteMask), 16);
+						const __m128i vThird  = _mm_and_si128(_mm_srli_epi32(vPixels, 16), vByteMask);
+						_mm_storeu_si128(pDestinationData + i, _mm_or_si128(_mm_and_si128(vPixels, vKeepMask), _mm_or_si128(vFirst, vThird)));
+					}
+					return nNumOfBlocks*4;
+				}
+
+				// Byte -> float without color format change: Sixteen components at once (sixteen pixels are always a multiple of sixteen components)
+				if (cDestinationImageBuffer.GetDataFormat() == DataFloat && nSourceColorFormat == nDestinationColorFormat) {
+					const uint8 *pSourceData	  = cSourceImageBuffer.GetData() + nFirstPixel*nNumOfComponents;
+						  float *pDestinationData = reinterpret_cast<float*>(cDestinationImageBuffer.GetData()) + nFirstPixel*nNumOfComponents;
+					const __m128i vZero = _mm_setzero_si128();
+					const uint32 nNumOfBlocks	= nNumOfPixels/16;
+					const uint32 nNumOfElements = nNumOfBlocks*16*nNumOfComponents;
+					for (uint32 i=0; i<nNumOfElements; i+=16) {
+						const __m128i vBytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pSourceData + i));
+						const __m128i vLow   = _mm_unpacklo_epi8(vBytes, vZero);
+						const __m128i vHigh  = _mm_unpackhi_epi8(vBytes, vZero);
+						_mm_storeu_ps(pDestinationData + i,      _mm_cvtepi32_ps(_mm_unpacklo_epi16(vLow,  vZero)));
+						_mm_storeu_ps(pDestinationData + i + 4,  _mm_cvtepi32_ps(_mm_unpackhi_epi16(vLow,  vZero)));
+						_mm_storeu_ps(pDestinationData + i + 8,  _mm_cvtepi32_ps(_mm_unpacklo_epi16(vHigh, vZero)));
+						_mm_storeu_ps(pDestinationData + i + 12, _mm_cvtepi32_ps(_mm_unpackhi_epi16(vHigh, vZero)));
+					}
+					return nNumOfBlocks*16;
+				}
+				break;
+
+			case DataFloat:
+				// Float -> byte without color format change: Sixteen components at once (sixteen pixels are always a multiple of sixteen components)
+				if (cDestinationImageBuffer.GetDataFormat() == DataByte && nSourceColorFormat == nDestinationColorFormat) {
+					const float *pSourceData	  = reinterpret_cast<const float*>(cSourceImageBuffer.GetData()) + nFirstPixel*nNumOfComponents;
+						  uint8 *pDestinationData = cDestinationImageBuffer.GetData() + nFirstPixel*nNumOfComponents;
+					const uint32 nNumOfBlocks	= nNumOfPixels/16;
+					const uint32 nNumOfElements = nNumOfBlocks*16*nNumOfComponents;
+					for (uint32 i=0; i<nNumOfElements; i+=16) {
+						const __m128i v0 = _mm_cvttps_epi32(_mm_loadu_ps(pSourceData + i));
+						const __m128i v1 = _mm_cvttps_epi32(_mm_loadu_ps(pSourceData + i + 4));
+						const __m128i v2 = _mm_cvttps_epi32(_mm_loadu_ps(pSourceData + i + 8));
+						const __m128i v3 = _mm_cvttps_epi32(_mm_loadu_ps(pSourceData + i + 12));
+						_mm_storeu_si128(reinterpret_cast<__m128i*>(pDestinationData + i), _mm_packus_epi16(_mm_packs_epi32(v0, v1), _mm_packs_epi32(v2, v3)));
+					}
+					return nNumOfBlocks*16;
+				}
+				break;
+
+			default:
+				// Not supported
+				break;
+		}
+
+		// Nothing converted
+		return 0;
+	}
+#endif
+
+/**
+*  @brief
+*    Converts a range of pixels
+*
+*  @param[in]  cOldImageBuffer
+*    Source image buffer (MUST have valid data!)
+*  @param[out] cImageBuffer
+*    Destination image buffer (MUST have valid data!)
+*  @param[in]  nFirstPixel
+*    Index of the first pixel to convert
+*  @param[in]  nEndPixel
+*    Index of the pixel behind the last pixel to convert
+*  @param[in]  bSIMD
+*    Use SIMD kernels if possible?
+*/
+static void ConvertPixels(const ImageBuffer &cOldImageBuffer, ImageBuffer &cImageBuffer, uint32 nFirstPixel, uint32 nEndPixel, bool bSIMD)
+{
+	#ifdef PLGRAPHICS_SSE2
+		// Convert as many pixels as possible using SSE2, the generic code is converting the remaining pixels
+		if (bSIMD) {
+			nFirstPixel += ConvertPixelsSSE2(cOldImageBuffer, cImageBuffer, nFirstPixel, nEndPixel);
+			if (nFirstPixel >= nEndPixel)
+				return;
+		}
+	#endif
+
+	// Convert old data format dependent
+	switch (cOldImageBuffer.GetDataFormat()) {
+		// Source
+		case DataByte:
+			// Convert new data format dependent
+			switch (cImageBuffer.GetDataFormat()) {
+				//   DataByte     Source (old data format)
+				case DataByte: // Destination (new data format)
+				{
+					ConvertData<uint8, uint8> cConvertData(cOldImageBuffer, cImageBuffer, 255, nFirstPixel, nEndPixel);
+					break;
+				}
+
+				//   DataByte     Source (old data format)
+				case DataWord: // Destination (new data format)
+				{
+					ConvertData<uint8, uint16> cConvertData(cOldImageBuffer, cImageBuffer, 255, nFirstPixel, nEndPixel);
+					break;
+				}
+
+				//   DataByte      Source (old data format)
+				case DataHalf: // Destination (new data format)
+				{
+					// [TODO] DataHalf - Implement me
+					break;
+				}
+
+				//   DataByte      Source (old data format)
+				case DataFloat: // Destination (new data format)
+				{
+					ConvertData<uint8, float> cConvertData(cOldImageBuffer, cImageBuffer, 1.0f, nFirstPixel, nEndPixel);
+					break;
+				}
+
+				//   DataByte       Source (old data format)
+				case DataDouble: // Destination (new data format)
+				{
+					ConvertData<uint8, double> cConvertData(cOldImageBuffer, cImageBuffer, 1.0, nFirstPixel, nEndPixel);
+					break;
+				}
+			}
+			break;
+
+		// Source
+		case DataWord:
+			// Convert new data format dependent
+			switch (cImageBuffer.GetDataFormat()) {
+				//   DataWord     Source (old data format)
+				case DataByte: // Destination (new data format)
+				{
+					ConvertData<uint16, uint8> cConvertData(cOldImageBuffer, cImageBuffer, 255, nFirstPixel, nEndPixel);
+					break;
+				}
+
+				//   DataWord     Source (old data format)
+				case DataWord: // Destination (new data format)
+				{
+					ConvertData<uint16, uint16> cConvertData(cOldImageBuffer, cImageBuffer, 255, nFirstPixel, nEndPixel);
+					break;
+				}
+
+				//   DataWord      Source (old data format)
+				case DataHalf: // Destination (new data format)
+				{
+					// [TODO] DataHalf - Implement me
+					break;
+				}
+
+				//   DataWord      Source (old data format)
+				case DataFloat: // Destination (new data format)
+				{
+					ConvertData<uint16, float> cConvertData(cOldImageBuffer, cImageBuffer, 1.0f, nFirstPixel, nEndPixel);
+					break;
+				}
+
+				//   DataWord       Source (old data format)
+				case DataDouble: // Destination (new data format)
+				{
+					ConvertData<uint16, double> cConvertData(cOldImageBuffer, cImageBuffer, 1.0, nFirstPixel, nEndPixel);
+					break;
+				}
+			}
+			break;
+
+		// Source
+		case DataHalf:
+			// [TODO] DataHalf - Implement me
+			break;
+
+		// Source
+		case DataFloat:
+			// Convert new data format dependent
+			switch (cImageBuffer.GetDataFormat()) {
+				//   DataFloat    Source (old data format)
+				case DataByte: // Destination (new data format)
+				{
+					ConvertData<float, uint8> cConvertData(cOldImageBuffer, cImageBuffer, 255, nFirstPixel, nEndPixel);
+					break;
+				}
+
+				//   DataFloat    Source (old data format)
+				case DataWord: // Destination (new data format)
+				{
+					ConvertData<float, uint16> cConvertData(cOldImageBuffer, cImageBuffer, 255, nFirstPixel, nEndPixel);
+					break;
+				}
+
+				//   DataFloat     Source (old data format)
+				case DataHalf: // Destination (new data format)
+				{
+					// [TODO] DataHalf - Implement me
+					break;
+				}
+
+				//   DataFloat     Source (old data format)
+				case DataFloat: // Destination (new data format)
+				{
+					ConvertData<float, float> cConvertData(cOldImageBuffer, cImageBuffer, 1.0f, nFirstPixel, nEndPixel);
+					break;
+				}
+
+				//   DataFloat      Source (old data format)
+				case DataDouble: // Destination (new data format)
+				{
+					ConvertData<float, double> cConvertData(cOldImageBuffer, cImageBuffer, 1.0, nFirstPixel, nEndPixel);
+					break;
+				}
+			}
+			break;
+
+		// Source
+		case DataDouble:
+			// Convert new data format dependent
+			switch (cImageBuffer.GetDataFormat()) {
+				//   DataDouble   Source (old data format)
+				case DataByte: // Destination (new data format)
+				{
+					ConvertData<double, uint8> cConvertData(cOldImageBuffer, cImageBuffer, 255, nFirstPixel, nEndPixel);
+					break;
+				}
+
+				//   DataDouble   Source (old data format)
+				case DataWord: // Destination (new data format)
+				{
+					ConvertData<double, uint16> cConvertData(cOldImageBuffer, cImageBuffer, 255, nFirstPixel, nEndPixel);
+					break;
+				}
+
+				//   DataDouble    Source (old data format)
+				case DataHalf: // Destination (new data format)
+				{
+					// [TODO] DataHalf - Implement me
+					break;
+				}
+
+				//   DataDouble    Source (old data format)
+				case DataFloat: // Destination (new data format)
+				{
+					ConvertData<double, float> cConvertData(cOldImageBuffer, cImageBuffer, 1.0f, nFirstPixel, nEndPixel);
+					break;
+				}
+
+				//   DataDouble     Source (old data format)
+				case DataDouble: // Destination (new data format)
+				{
+					ConvertData<double, double> cConvertData(cOldImageBuffer, cImageBuffer, 1.0, nFirstPixel, nEndPixel);
+					break;
+				}
+			}
+			break;
+	}
+}
+
+/**
+*  @brief
+*    Conversion job data
+*/
+struct ConvertJob {
+	const ImageBuffer *pOldImageBuffer;	/**< Source image buffer, always valid */
+	ImageBuffer		  *pImageBuffer;	/**< Destination image buffer, always valid */
+	uint32			   nPixelsPerRow;	/**< Number of pixels per row */
+	bool			   bSIMD;			/**< Use SIMD kernels if possible? */
+};
+
+/**
+*  @brief
+*    Converts a range of rows, row function called by "ImageEffect::ProcessRows()"
+*/
+static void ConvertRows(uint32 nFirstRow, uint32 nEndRow, void *pData)
+{
+	const ConvertJob &sJob = *static_cast<const ConvertJob*>(pData);
+	ConvertPixels(*sJob.pOldImageBuffer, *sJob.pImageBuffer, nFirstRow*sJob.nPixelsPerRow, nEndRow*sJob.nPixelsPerRow, sJob.bSIMD);
+}
+
+
 //[-------------------------------------------------------]
 //[ RTTI interface                                        ]
 //[-------------------------------------------------------]
@@ -613,6 +986,20 @@ IEConvert::~IEConvert()
 //[-------------------------------------------------------]
 //[ Public virtual ImageEffect functions                  ]
 //[-------------------------------------------------------]
+bool IEConvert::Apply(ImagePart &cImagePart) const
+{
+	// Convert all mipmaps, unlike the default implementation there's no need to rebuild them
+	bool bResult = (cImagePart.GetNumOfMipmaps() > 0);
+	for (uint32 i=0; i<cImagePart.GetNumOfMipmaps(); i++) {
+		ImageBuffer *pImageBuffer = cImagePart.GetMipmap(i);
+		if (pImageBuffer && !Apply(*pImageBuffer))
+			bResult = false;
+	}
+
+	// Done
+	return bResult;
+}
+
 bool IEConvert::Apply(ImageBuffer &cImageBuffer) const
 {
 	// Anything to do in here? (the color format "ColorPalette" is not supported)
@@ -627,177 +1014,18 @@ bool IEConvert::Apply(ImageBuffer &cImageBuffer) const
 		const ImageBuffer cOldImageBuffer = cImageBuffer;
 		cImageBuffer.CreateImage(m_nDataFormat, m_nColorFormat, cOldImageBuffer.GetSize());
 
-		// Convert old data format dependent
-		switch (cOldImageBuffer.GetDataFormat()) {
-			// Source
-			case DataByte:
-				// Convert new data format dependent
-				switch (cImageBuffer.GetDataFormat()) {
-					//   DataByte     Source (old data format)
-					case DataByte: // Destination (new data format)
-					{
-						ConvertData<uint8, uint8> cConvertData(cOldImageBuffer, cImageBuffer, 255);
-						break;
-					}
-
-					//   DataByte     Source (old data format)
-					case DataWord: // Destination (new data format)
-					{
-						ConvertData<uint8, uint16> cConvertData(cOldImageBuffer, cImageBuffer, 255);
-						break;
-					}
-
-					//   DataByte      Source (old data format)
-					case DataHalf: // Destination (new data format)
-					{
-						// [TODO] DataHalf - Implement me
-						break;
-					}
-
-					//   DataByte      Source (old data format)
-					case DataFloat: // Destination (new data format)
-					{
-						ConvertData<uint8, float> cConvertData(cOldImageBuffer, cImageBuffer, 1.0f);
-						break;
-					}
-
-					//   DataByte       Source (old data format)
-					case DataDouble: // Destination (new data format)
-					{
-						ConvertData<uint8, double> cConvertData(cOldImageBuffer, cImageBuffer, 1.0);
-						break;
-					}
-				}
-				break;
-
-			// Source
-			case DataWord:
-				// Convert new data format dependent
-				switch (cImageBuffer.GetDataFormat()) {
-					//   DataWord     Source (old data format)
-					case DataByte: // Destination (new data format)
-					{
-						ConvertData<uint16, uint8> cConvertData(cOldImageBuffer, cImageBuffer, 255);
-						break;
-					}
-
-					//   DataWord     Source (old data format)
-					case DataWord: // Destination (new data format)
-					{
-						ConvertData<uint16, uint16> cConvertData(cOldImageBuffer, cImageBuffer, 255);
-						break;
-					}
-
-					//   DataWord      Source (old data format)
-					case DataHalf: // Destination (new data format)
-					{
-						// [TODO] DataHalf - Implement me
-						break;
-					}
-
-					//   DataWord      Source (old data format)
-					case DataFloat: // Destination (new data format)
-					{
-						ConvertData<uint16, float> cConvertData(cOldImageBuffer, cImageBuffer, 1.0f);
-						break;
-					}
-
-					//   DataWord       Source (old data format)
-					case DataDouble: // Destination (new data format)
-					{
-						ConvertData<uint16, double> cConvertData(cOldImageBuffer, cImageBuffer, 1.0);
-						break;
-					}
-				}
-				break;
-
-			// Source
-			case DataHalf:
-				// [TODO] DataHalf - Implement me
-				break;
-
-			// Source
-			case DataFloat:
-				// Convert new data format dependent
-				switch (cImageBuffer.GetDataFormat()) {
-					//   DataFloat    Source (old data format)
-					case DataByte: // Destination (new data format)
-					{
-						ConvertData<float, uint8> cConvertData(cOldImageBuffer, cImageBuffer, 255);
-						break;
-					}
-
-					//   DataFloat    Source (old data format)
-					case DataWord: // Destination (new data format)
-					{
-						ConvertData<float, uint16> cConvertData(cOldImageBuffer, cImageBuffer, 255);
-						break;
-					}
-
-					//   DataFloat     Source (old data format)
-					case DataHalf: // Destination (new data format)
-					{
-						// [TODO] DataHalf - Implement me
-						break;
-					}
-
-					//   DataFloat     Source (old data format)
-					case DataFloat: // Destination (new data format)
-					{
-						ConvertData<float, float> cConvertData(cOldImageBuffer, cImageBuffer, 1.0f);
-						break;
-					}
-
-					//   DataFloat      Source (old data format)
-					case DataDouble: // Destination (new data format)
-					{
-						ConvertData<float, double> cConvertData(cOldImageBuffer, cImageBuffer, 1.0);
-						break;
-					}
-				}
-				break;
-
-			// Source
-			case DataDouble:
-				// Convert new data format dependent
-				switch (cImageBuffer.GetDataFormat()) {
-					//   DataDouble   Source (old data format)
-					case DataByte: // Destination (new data format)
-					{
-						ConvertData<double, uint8> cConvertData(cOldImageBuffer, cImageBuffer, 255);
-						break;
-					}
-
-					//   DataDouble   Source (old data format)
-					case DataWord: // Destination (new data format)
-					{
-						ConvertData<double, uint16> cConvertData(cOldImageBuffer, cImageBuffer, 255);
-						break;
-					}
-
-					//   DataDouble    Source (old data format)
-					case DataHalf: // Destination (new data format)
-					{
-						// [TODO] DataHalf - Implement me
-						break;
-					}
-
-					//   DataDouble    Source (old data format)
-					case DataFloat: // Destination (new data format)
-					{
-						ConvertData<double, float> cConvertData(cOldImageBuffer, cImageBuffer, 1.0f);
-						break;
-					}
-
-					//   DataDouble     Source (old data format)
-					case DataDouble: // Destination (new data format)
-					{
-						ConvertData<double, double> cConvertData(cOldImageBuffer, cImageBuffer, 1.0);
-						break;
-					}
-				}
-				break;
-		}
+		// Make sure that the data of both image buffers is created before it's accessed by multiple threads
+		cOldImageBuffer.GetData();
+		cImageBuffer.GetData();
+
+		// Convert the rows of all slices (depth layers)
+		const PLMath::Vector3i vSize = cImageBuffer.GetSize();
+		ConvertJob sJob;
+		sJob.pOldImageBuffer = &cOldImageBuffer;
+		sJob.pImageBuffer	 = &cImageBuffer;
+		sJob.nPixelsPerRow	 = vSize.x;
+		sJob.bSIMD			 = IsParallel();
+		ProcessRows(vSize.y*vSize.z, cImageBuffer.GetBytesPerRow(), &ConvertRows, &sJob);
 	}
 
 	// Done
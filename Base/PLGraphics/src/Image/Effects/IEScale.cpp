@@ -30,6 +30,11 @@
 #include "PLGraphics/Image/ImagePart.h"
 #include "PLGraphics/Image/ImageBuffer.h"
 #include "PLGraphics/Image/Effects/IEScale.h"
+// SSE2 kernels are used when the SSE code path of PLMath is enabled and SSE2 is available at compile time
+#if defined(PLMATH_SSE) && (defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2))
+	#define PLGRAPHICS_SSE2
+	#include <emmintrin.h>
+#endif
 
 
 //[-------------------------------------------------------]
@@ -50,7 +55,7 @@ pl_implement_class(IEScale)
 //[ Global functions                                      ]
 //[-------------------------------------------------------]
 // [TODO] This is just an experimental half image scale function without any filter - better as nothing for now!
-void ScaleDownHalfData(const ImageBuffer &cOldImageBuffer, ImageBuffer &cImageBuffer, uint32 nNewWidth, uint32 nNewHeight, uint32 nOldWidth, uint32 nOldHeight, const Matrix3x3 &mFilter)
+void ScaleDownHalfData(const ImageBuffer &cOldImageBuffer, ImageBuffer &cImageBuffer, uint32 nNewWidth, uint32 nNewHeight, uint32 nOldWidth, uint32 nOldHeight, uint32 nFirstRow, uint32 nEndRow)
 {
 	// Scale factors
 	const float fToOriginalWidthFactor  = static_cast<float>(nOldWidth) /nNewWidth;
@@ -59,18 +64,20 @@ void ScaleDownHalfData(const ImageBuffer &cOldImageBuffer, ImageBuffer &cImageBu
 	// Get the number of components
 	const uint32 nNumOfComponents = cOldImageBuffer.GetComponentsPerPixel();
 
-	// Loop through all components
+	// Loop through the given rows
 		  short *pNewData = reinterpret_cast<short*>(cImageBuffer.GetData());
 	const short *pOldData = reinterpret_cast<const short*>(cOldImageBuffer.GetData());
-	for (uint32 nComponent=0; nComponent<nNumOfComponents; nComponent++) {
+	for (uint32 nY=nFirstRow; nY<nEndRow; nY++) {
+		// Get the original row
+		const uint32 nOriginalY = static_cast<uint32>(nY*fToOriginalHeightFactor);
+
 		// Loop through x
 		for (uint32 nX=0; nX<nNewWidth; nX++) {
-			// Loop through y
-			for (uint32 nY=0; nY<nNewHeight; nY++) {
-				// Get the original byte
-				const uint32 nOriginalX = static_cast<uint32>(nX*fToOriginalWidthFactor);
-				const uint32 nOriginalY = static_cast<uint32>(nY*fToOriginalHeightFactor);
+			// Get the original column
+			const uint32 nOriginalX = static_cast<uint32>(nX*fToOriginalWidthFactor);
 
+			// Loop through all components
+			for (uint32 nComponent=0; nComponent<nNumOfComponents; nComponent++) {
 				// Get data
 				short nOriginalByte = 0;
 				{
@@ -93,6 +100,55 @@ void ScaleDownHalfData(const ImageBuffer &cOldImageBuffer, ImageBuffer &cImageBu
 	}
 }
 
+#ifdef PLGRAPHICS_SSE2
+	/**
+	*  @brief
+	*    Scales down byte data with four components to the exact half size using a 2x2 box filter, SSE2 kernel
+	*
+	*  @remarks
+	*    The result is the same as the one of "ScaleDownBoxData<uint8>" and "ScaleDownBilinearData<uint8>", the sum of the
+	*    four original components is divided by four and rounded down.
+	*/
+	static void ScaleDownHalfBoxByte4SSE2(const uint8 *pOldData, uint8 *pNewData, uint32 nNewWidth, uint32 nFirstRow, uint32 nEndRow)
+	{
+		const __m128i mZero = _mm_setzero_si128();
+		const uint32 nOldBytesPerRow = nNewWidth*2*4;
+		const uint32 nNewBytesPerRow = nNewWidth*4;
+
+		// Loop through the given rows
+		for (uint32 nY=nFirstRow; nY<nEndRow; nY++) {
+			const uint8 *pOldRow0 = pOldData + nY*2*nOldBytesPerRow;
+			const uint8 *pOldRow1 = pOldRow0 + nOldBytesPerRow;
+				  uint8 *pNewRow  = pNewData + nY*nNewBytesPerRow;
+
+			// Two new pixels at once
+			uint32 nX = 0;
+			for (; nX+2<=nNewWidth; nX+=2) {
+				// Load four original pixels of both rows and add the rows
+				const __m128i mRow0 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pOldRow0 + nX*8));
+				const __m128i mRow1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pOldRow1 + nX*8));
+				const __m128i mSumLow  = _mm_add_epi16(_mm_unpacklo_epi8(mRow0, mZero), _mm_unpacklo_epi8(mRow1, mZero));
+				const __m128i mSumHigh = _mm_add_epi16(_mm_unpackhi_epi8(mRow0, mZero), _mm_unpackhi_epi8(mRow1, mZero));
+
+				// Add the neighbour pixels, the sums of both new pixels are within the lower halves
+				const __m128i mSum = _mm_unpacklo_epi64(_mm_add_epi16(mSumLow,  _mm_srli_si128(mSumLow,  8)),
+														_mm_add_epi16(mSumHigh, _mm_srli_si128(mSumHigh, 8)));
+
+				// Divide by four and write the two new pixels
+				_mm_storel_epi64(reinterpret_cast<__m128i*>(pNewRow + nX*4), _mm_packus_epi16(_mm_srli_epi16(mSum, 2), mZero));
+			}
+
+			// Remaining pixel
+			for (; nX<nNewWidth; nX++) {
+				const uint8 *pOld0 = pOldRow0 + nX*8;
+				const uint8 *pOld1 = pOldRow1 + nX*8;
+				for (uint32 nComponent=0; nComponent<4; nComponent++)
+					pNewRow[nX*4 + nComponent] = static_cast<uint8>((pOld0[nComponent] + pOld0[4 + nComponent] + pOld1[nComponent] + pOld1[4 + nComponent]) >> 2);
+			}
+		}
+	}
+#endif
+
 
 //[-------------------------------------------------------]
 //[ Classes                                               ]
@@ -127,8 +183,12 @@ class ScaleDownData {
 		*    Old height
 		*  @param[in]  mFilter
 		*    Filter matrix
+		*  @param[in]  nFirstRow
+		*    First new row to write
+		*  @param[in]  nEndRow
+		*    New row behind the last new row to write
 		*/
-		ScaleDownData(const ImageBuffer &cOldImageBuffer, ImageBuffer &cImageBuffer, uint32 nNewWidth, uint32 nNewHeight, uint32 nOldWidth, uint32 nOldHeight, const Matrix3x3 &mFilter)
+		ScaleDownData(const ImageBuffer &cOldImageBuffer, ImageBuffer &cImageBuffer, uint32 nNewWidth, uint32 nNewHeight, uint32 nOldWidth, uint32 nOldHeight, const Matrix3x3 &mFilter, uint32 nFirstRow, uint32 nEndRow)
 		{
 			// [TODO] Resize images in linear space instead of gamma space! Maybe we should add image space information to a image so we now in which space the image data is stored? (linear, gamma...)
 
@@ -139,18 +199,20 @@ class ScaleDownData {
 			// Get the number of components
 			const uint32 nNumOfComponents = cOldImageBuffer.GetComponentsPerPixel();
 
-			// Loop through all components
+			// Loop through the given rows
 				  DataType *pNewData = reinterpret_cast<DataType*>(cImageBuffer.GetData());
 			const DataType *pOldData = reinterpret_cast<const DataType*>(cOldImageBuffer.GetData());
-			for (uint32 nComponent=0; nComponent<nNumOfComponents; nComponent++) {
+			for (uint32 nY=nFirstRow; nY<nEndRow; nY++) {
+				// Get the original row
+				const uint32 nOriginalY = static_cast<uint32>(nY*fToOriginalHeightFactor);
+
 				// Loop through x
 				for (uint32 nX=0; nX<nNewWidth; nX++) {
-					// Loop through y
-					for (uint32 nY=0; nY<nNewHeight; nY++) {
-						// Get the original byte
-						const uint32 nOriginalX = static_cast<uint32>(nX*fToOriginalWidthFactor);
-						const uint32 nOriginalY = static_cast<uint32>(nY*fToOriginalHeightFactor);
+					// Get the original column
+					const uint32 nOriginalX = static_cast<uint32>(nX*fToOriginalWidthFactor);
 
+					// Loop through all components
+					for (uint32 nComponent=0; nComponent<nNumOfComponents; nComponent++) {
 						// Sum up
 						double fSum      = 0.0f;
 						double fTotalSum = 0.0f;
@@ -188,6 +250,274 @@ class ScaleDownData {
 
 };
 
+/**
+*  @brief
+*    Scale down data template using a box filter
+*/
+template <typename DataType>
+class ScaleDownBoxData {
+
+
+	//[-------------------------------------------------------]
+	//[ Public functions                                      ]
+	//[-------------------------------------------------------]
+	public:
+		/**
+		*  @brief
+		*    Constructor
+		*
+		*  @param[in]  cOldImageBuffer
+		*    Old image buffer (MUST have valid data)
+		*  @param[out] cImageBuffer
+		*    Image buffer (MUST have valid data)
+		*  @param[in]  nNewWidth
+		*    New width
+		*  @param[in]  nNewHeight
+		*    New height
+		*  @param[in]  nOldWidth
+		*    Old height
+		*  @param[in]  nOldHeight
+		*    Old height
+		*  @param[in]  nFirstRow
+		*    First new row to write
+		*  @param[in]  nEndRow
+		*    New row behind the last new row to write
+		*/
+		ScaleDownBoxData(const ImageBuffer &cOldImageBuffer, ImageBuffer &cImageBuffer, uint32 nNewWidth, uint32 nNewHeight, uint32 nOldWidth, uint32 nOldHeight, uint32 nFirstRow, uint32 nEndRow)
+		{
+			// Get the number of components
+			const uint32 nNumOfComponents = cOldImageBuffer.GetComponentsPerPixel();
+
+			// Loop through the given rows
+				  DataType *pNewData = reinterpret_cast<DataType*>(cImageBuffer.GetData());
+			const DataType *pOldData = reinterpret_cast<const DataType*>(cOldImageBuffer.GetData());
+			for (uint32 nY=nFirstRow; nY<nEndRow; nY++) {
+				// Get the original rows covered by the new row (because we only scale down, there's at least one)
+				const uint32 nOriginalFirstY = nY*nOldHeight/nNewHeight;
+				const uint32 nOriginalEndY   = (nY + 1)*nOldHeight/nNewHeight;
+
+				// Loop through x
+				for (uint32 nX=0; nX<nNewWidth; nX++) {
+					// Get the original columns covered by the new column
+					const uint32 nOriginalFirstX = nX*nOldWidth/nNewWidth;
+					const uint32 nOriginalEndX   = (nX + 1)*nOldWidth/nNewWidth;
+					const double fNumOfPixels    = (nOriginalEndX - nOriginalFirstX)*(nOriginalEndY - nOriginalFirstY);
+
+					// Loop through all components
+					for (uint32 nComponent=0; nComponent<nNumOfComponents; nComponent++) {
+						// Sum up all covered original components
+						double fSum = 0.0;
+						for (uint32 nOriginalY=nOriginalFirstY; nOriginalY<nOriginalEndY; nOriginalY++) {
+							const DataType *pOldComponent = &pOldData[(nOriginalY*nOldWidth + nOriginalFirstX)*nNumOfComponents + nComponent];
+							for (uint32 nOriginalX=nOriginalFirstX; nOriginalX<nOriginalEndX; nOriginalX++, pOldComponent+=nNumOfComponents)
+								fSum += *pOldComponent;
+						}
+
+						// Set new component
+						pNewData[(nY*nNewWidth + nX)*nNumOfComponents + nComponent] = DataType(fSum/fNumOfPixels);
+					}
+				}
+			}
+		}
+
+
+};
+
+/**
+*  @brief
+*    Scale down data template using a bilinear filter
+*/
+template <typename DataType>
+class ScaleDownBilinearData {
+
+
+	//[-------------------------------------------------------]
+	//[ Public functions                                      ]
+	//[-------------------------------------------------------]
+	public:
+		/**
+		*  @brief
+		*    Constructor
+		*
+		*  @param[in]  cOldImageBuffer
+		*    Old image buffer (MUST have valid data)
+		*  @param[out] cImageBuffer
+		*    Image buffer (MUST have valid data)
+		*  @param[in]  nNewWidth
+		*    New width
+		*  @param[in]  nNewHeight
+		*    New height
+		*  @param[in]  nOldWidth
+		*    Old height
+		*  @param[in]  nOldHeight
+		*    Old height
+		*  @param[in]  nFirstRow
+		*    First new row to write
+		*  @param[in]  nEndRow
+		*    New row behind the last new row to write
+		*/
+		ScaleDownBilinearData(const ImageBuffer &cOldImageBuffer, ImageBuffer &cImageBuffer, uint32 nNewWidth, uint32 nNewHeight, uint32 nOldWidth, uint32 nOldHeight, uint32 nFirstRow, uint32 nEndRow)
+		{
+			// Scale factors
+			const double fToOriginalWidthFactor  = static_cast<double>(nOldWidth) /nNewWidth;
+			const double fToOriginalHeightFactor = static_cast<double>(nOldHeight)/nNewHeight;
+
+			// Get the number of components
+			const uint32 nNumOfComponents = cOldImageBuffer.GetComponentsPerPixel();
+
+			// Loop through the given rows
+				  DataType *pNewData = reinterpret_cast<DataType*>(cImageBuffer.GetData());
+			const DataType *pOldData = reinterpret_cast<const DataType*>(cOldImageBuffer.GetData());
+			for (uint32 nY=nFirstRow; nY<nEndRow; nY++) {
+				// Get the original position of the center of the new row and the two original rows to interpolate between
+				uint32 nOriginalY0, nOriginalY1;
+				const double fFactorY = GetSamplePosition(nY, fToOriginalHeightFactor, nOldHeight, nOriginalY0, nOriginalY1);
+				const DataType *pOldRow0 = &pOldData[nOriginalY0*nOldWidth*nNumOfComponents];
+				const DataType *pOldRow1 = &pOldData[nOriginalY1*nOldWidth*nNumOfComponents];
+
+				// Loop through x
+				for (uint32 nX=0; nX<nNewWidth; nX++) {
+					// Get the original position of the center of the new column and the two original columns to interpolate between
+					uint32 nOriginalX0, nOriginalX1;
+					const double fFactorX = GetSamplePosition(nX, fToOriginalWidthFactor, nOldWidth, nOriginalX0, nOriginalX1);
+					nOriginalX0 *= nNumOfComponents;
+					nOriginalX1 *= nNumOfComponents;
+
+					// Loop through all components
+					for (uint32 nComponent=0; nComponent<nNumOfComponents; nComponent++) {
+						// Interpolate horizontally within both original rows, then vertically
+						const double fTop    = pOldRow0[nOriginalX0 + nComponent] + (static_cast<double>(pOldRow0[nOriginalX1 + nComponent]) - pOldRow0[nOriginalX0 + nComponent])*fFactorX;
+						const double fBottom = pOldRow1[nOriginalX0 + nComponent] + (static_cast<double>(pOldRow1[nOriginalX1 + nComponent]) - pOldRow1[nOriginalX0 + nComponent])*fFactorX;
+
+						// Set new component
+						pNewData[(nY*nNewWidth + nX)*nNumOfComponents + nComponent] = DataType(fTop + (fBottom - fTop)*fFactorY);
+					}
+				}
+			}
+		}
+
+
+	//[-------------------------------------------------------]
+	//[ Private functions                                     ]
+	//[-------------------------------------------------------]
+	private:
+		/**
+		*  @brief
+		*    Returns the two original positions to interpolate between
+		*
+		*  @param[in]  nNew
+		*    New position
+		*  @param[in]  fToOriginalFactor
+		*    Scale factor from new to original position
+		*  @param[in]  nOldSize
+		*    Old size
+		*  @param[out] nOriginal0
+		*    Receives the first original position
+		*  @param[out] nOriginal1
+		*    Receives the second original position
+		*
+		*  @return
+		*    Interpolation factor between the two original positions
+		*/
+		static double GetSamplePosition(uint32 nNew, double fToOriginalFactor, uint32 nOldSize, uint32 &nOriginal0, uint32 &nOriginal1)
+		{
+			double fOriginal = (nNew + 0.5)*fToOriginalFactor - 0.5;
+			if (fOriginal < 0.0)
+				fOriginal = 0.0;
+			else if (fOriginal > nOldSize - 1)
+				fOriginal = nOldSize - 1;
+			nOriginal0 = static_cast<uint32>(fOriginal);
+			nOriginal1 = (nOriginal0 + 1 < nOldSize) ? nOriginal0 + 1 : nOriginal0;
+			return fOriginal - nOriginal0;
+		}
+
+
+};
+
+/**
+*  @brief
+*    Scale job data
+*/
+struct ScaleJob {
+	const ImageBuffer *pOldImageBuffer;	/**< Old image buffer, always valid */
+	ImageBuffer		  *pImageBuffer;	/**< New image buffer, always valid */
+	uint32			   nNewWidth;		/**< New width */
+	uint32			   nNewHeight;		/**< New height */
+	uint32			   nOldWidth;		/**< Old width */
+	uint32			   nOldHeight;		/**< Old height */
+	const Matrix3x3   *pmFilter;		/**< Filter matrix of the weighted 3x3 filter, always valid */
+	IEScale::EFilter   nFilter;			/**< Scale filter */
+	bool			   bSIMD;			/**< Use SIMD kernels if possible? */
+};
+
+/**
+*  @brief
+*    Scales down a range of rows using the filter of the given job
+*/
+template <typename DataType>
+void ScaleDownRows(const ScaleJob &sJob, uint32 nFirstRow, uint32 nEndRow)
+{
+	switch (sJob.nFilter) {
+		case IEScale::Weighted3x3:
+		{
+			ScaleDownData<DataType> cScaleDownData(*sJob.pOldImageBuffer, *sJob.pImageBuffer, sJob.nNewWidth, sJob.nNewHeight, sJob.nOldWidth, sJob.nOldHeight, *sJob.pmFilter, nFirstRow, nEndRow);
+			break;
+		}
+
+		case IEScale::Box:
+		{
+			ScaleDownBoxData<DataType> cScaleDownData(*sJob.pOldImageBuffer, *sJob.pImageBuffer, sJob.nNewWidth, sJob.nNewHeight, sJob.nOldWidth, sJob.nOldHeight, nFirstRow, nEndRow);
+			break;
+		}
+
+		case IEScale::Bilinear:
+		{
+			ScaleDownBilinearData<DataType> cScaleDownData(*sJob.pOldImageBuffer, *sJob.pImageBuffer, sJob.nNewWidth, sJob.nNewHeight, sJob.nOldWidth, sJob.nOldHeight, nFirstRow, nEndRow);
+			break;
+		}
+	}
+}
+
+/**
+*  @brief
+*    Scales down a range of rows, row function called by "ImageEffect::ProcessRows()"
+*/
+static void ScaleRows(uint32 nFirstRow, uint32 nEndRow, void *pData)
+{
+	const ScaleJob &sJob = *static_cast<const ScaleJob*>(pData);
+
+	// Process data format dependent
+	switch (sJob.pImageBuffer->GetDataFormat()) {
+		case DataByte:
+			#ifdef PLGRAPHICS_SSE2
+				// Scaling down byte data with four components to the exact half size is that common (e.g. mipmaps) that there's a SIMD kernel for it
+				if (sJob.bSIMD && sJob.nFilter != IEScale::Weighted3x3 && sJob.pImageBuffer->GetComponentsPerPixel() == 4 &&
+					sJob.nOldWidth == sJob.nNewWidth*2 && sJob.nOldHeight == sJob.nNewHeight*2) {
+					ScaleDownHalfBoxByte4SSE2(sJob.pOldImageBuffer->GetData(), sJob.pImageBuffer->GetData(), sJob.nNewWidth, nFirstRow, nEndRow);
+					break;
+				}
+			#endif
+			ScaleDownRows<uint8>(sJob, nFirstRow, nEndRow);
+			break;
+
+		case DataWord:
+			ScaleDownRows<uint16>(sJob, nFirstRow, nEndRow);
+			break;
+
+		case DataHalf:
+			ScaleDownHalfData(*sJob.pOldImageBuffer, *sJob.pImageBuffer, sJob.nNewWidth, sJob.nNewHeight, sJob.nOldWidth, sJob.nOldHeight, nFirstRow, nEndRow);
+			break;
+
+		case DataFloat:
+			ScaleDownRows<float>(sJob, nFirstRow, nEndRow);
+			break;
+
+		case DataDouble:
+			ScaleDownRows<double>(sJob, nFirstRow, nEndRow);
+			break;
+	}
+}
+
 
 //[-------------------------------------------------------]
 //[ Public functions                                      ]
@@ -196,9 +526,10 @@ class ScaleDownData {
 *  @brief
 *    Constructor
 */
-IEScale::IEScale(const Vector3i &vNewSize, bool bUseMipmaps) :
+IEScale::IEScale(const Vector3i &vNewSize, bool bUseMipmaps, EFilter nFilter) :
 	m_vNewSize(vNewSize),
-	m_bUseMipmaps(bUseMipmaps)
+	m_bUseMipmaps(bUseMipmaps),
+	m_nFilter(nFilter)
 {
 }
 
@@ -228,6 +559,15 @@ bool IEScale::GetUseMipmaps() const
 	return m_bUseMipmaps;
 }
 
+/**
+*  @brief
+*    Get scale filter
+*/
+IEScale::EFilter IEScale::GetFilter() const
+{
+	return m_nFilter;
+}
+
 
 //[-------------------------------------------------------]
 //[ Public virtual ImageEffect functions                  ]
@@ -311,38 +651,22 @@ bool IEScale::Apply(ImageBuffer &cImageBuffer) const
 		cImageBuffer.CreateImage(cOldImageBuffer.GetDataFormat(), cOldImageBuffer.GetColorFormat(), Vector3i(nNewWidth, nNewHeight, 1));
 //		cImageBuffer.CreateImage(cOldImageBuffer.GetDataFormat(), cOldImageBuffer.GetColorFormat(), Vector3i(nNewWidth, nNewHeight, 1), cOldImageBuffer.GetCompression());
 
-		// Process data format dependent
-		switch (cImageBuffer.GetDataFormat()) {
-			case DataByte:
-			{
-				ScaleDownData<uint8> cScaleDownData(cOldImageBuffer, cImageBuffer, nNewWidth, nNewHeight, nOldWidth, nOldHeight, mFilter);
-				break;
-			}
-
-			case DataWord:
-			{
-				ScaleDownData<uint16> cScaleDownData(cOldImageBuffer, cImageBuffer, nNewWidth, nNewHeight, nOldWidth, nOldHeight, mFilter);
-				break;
-			}
-
-			case DataHalf:
-			{
-				ScaleDownHalfData(cOldImageBuffer, cImageBuffer, nNewWidth, nNewHeight, nOldWidth, nOldHeight, mFilter);
-				break;
-			}
-
-			case DataFloat:
-			{
-				ScaleDownData<float> cScaleDownData(cOldImageBuffer, cImageBuffer, nNewWidth, nNewHeight, nOldWidth, nOldHeight, mFilter);
-				break;
-			}
-
-			case DataDouble:
-			{
-				ScaleDownData<double> cScaleDownData(cOldImageBuffer, cImageBuffer, nNewWidth, nNewHeight, nOldWidth, nOldHeight, mFilter);
-				break;
-			}
-		}
+		// Make sure that the data of both image buffers is created before it's accessed by multiple threads
+		cOldImageBuffer.GetData();
+		cImageBuffer.GetData();
+
+		// Scale down all rows
+		ScaleJob sJob;
+		sJob.pOldImageBuffer = &cOldImageBuffer;
+		sJob.pImageBuffer	 = &cImageBuffer;
+		sJob.nNewWidth		 = nNewWidth;
+		sJob.nNewHeight		 = nNewHeight;
+		sJob.nOldWidth		 = nOldWidth;
+		sJob.nOldHeight		 = nOldHeight;
+		sJob.pmFilter		 = &mFilter;
+		sJob.nFilter		 = m_nFilter;
+		sJob.bSIMD			 = IsParallel();
+		ProcessRows(nNewHeight, cImageBuffer.GetBytesPerRow(), &ScaleRows, &sJob);
 
 		// Done
 		return true;
@@ -26,6 +26,7 @@
 //[ Includes                                              ]
 //[-------------------------------------------------------]
 #include <PLCore/Base/Class.h>
+#include <PLCore/System/JobSystem.h>
 #include "PLGraphics/Image/Image.h"
 #include "PLGraphics/Image/ImagePart.h"
 #include "PLGraphics/Image/ImageBuffer.h"
@@ -52,7 +53,8 @@ pl_implement_class(ImageEffect)
 *  @brief
 *    Default constructor
 */
-ImageEffect::ImageEffect()
+ImageEffect::ImageEffect() :
+	m_bParallel(true)
 {
 }
 
@@ -75,6 +77,24 @@ String ImageEffect::GetDescription() const
 	return (pClass != nullptr) ? pClass->GetDescription() : "";
 }
 
+/**
+*  @brief
+*    Returns whether or not the parallel execution mode is used
+*/
+bool ImageEffect::IsParallel() const
+{
+	return m_bParallel;
+}
+
+/**
+*  @brief
+*    Sets whether or not the parallel execution mode is used
+*/
+void ImageEffect::SetParallel(bool bParallel)
+{
+	m_bParallel = bParallel;
+}
+
 
 //[-------------------------------------------------------]
 //[ Public virtual ImageEffect functions                  ]
@@ -142,6 +162,37 @@ bool ImageEffect::Apply(ImageBuffer &cImageBuffer) const
 }
 
 
+//[-------------------------------------------------------]
+//[ Protected functions                                   ]
+//[-------------------------------------------------------]
+/**
+*  @brief
+*    Processes the rows of an image, in parallel if possible
+*/
+void ImageEffect::ProcessRows(uint32 nNumOfRows, uint32 nRowSize, ROWFUNCTION pFunction, void *pData) const
+{
+	// Minimum number of bytes written by a job, below this the job overhead is not worth it
+	static const uint32 MinJobSize = 64*1024;
+
+	// Split the rows into jobs?
+	if (m_bParallel) {
+		const uint32 nRowsPerJob = nRowSize ? (MinJobSize + nRowSize - 1)/nRowSize : nNumOfRows;
+		if (nRowsPerJob < nNumOfRows) {
+			JobSystem *pJobSystem = JobSystem::GetInstance();
+			if (pJobSystem && pJobSystem->GetNumOfWorkers()) {
+				pJobSystem->ParallelFor(nNumOfRows, nRowsPerJob, pFunction, pData);
+
+				// Done
+				return;
+			}
+		}
+	}
+
+	// Process all rows on the calling thread
+	pFunction(0, nNumOfRows, pData);
+}
+
+
 //[-------------------------------------------------------]
 //[ Namespace                                             ]
 //[-------------------------------------------------------]
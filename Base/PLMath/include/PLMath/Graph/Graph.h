@@ -30,9 +30,10 @@
 //[-------------------------------------------------------]
 //[ Includes                                              ]
 //[-------------------------------------------------------]
-#include <PLCore/Container/Bitset.h>
+#include <PLCore/System/Mutex.h>
 #include <PLCore/Container/Resource.h>
 #include <PLCore/Container/BinaryHeap.h>
+#include <PLCore/Container/FlatHashMap.h>
 #include <PLCore/Container/ElementManager.h>
 #include "PLMath/Graph/GraphNode.h"
 
@@ -55,10 +56,27 @@ class GraphPath;
 /**
 *  @brief
 *    Graph class (directed)
+*
+*  @remarks
+*    For path finding, a compact copy of the graph (neighbour indices, distances and node positions
+*    within flat arrays) is created on demand and rebuilt as soon as the graph was changed. The search
+*    state is kept within search contexts which are taken from a pool, so any number of path queries
+*    can run at the same time, for example on the worker threads of the job system by using
+*    "FindShortestPaths()". Recently found paths are kept within a small LRU cache which is
+*    cleared when the graph is changed.
+*
+*  @note
+*    - Path queries can run concurrently, but the graph must not be changed while there are running queries
 */
 class Graph : public PLCore::Resource<Graph>, public PLCore::ElementManager<GraphNode> {
 
 
+	//[-------------------------------------------------------]
+	//[ Friends                                               ]
+	//[-------------------------------------------------------]
+	friend class GraphNode;
+
+
 	//[-------------------------------------------------------]
 	//[ Public functions                                      ]
 	//[-------------------------------------------------------]
@@ -90,26 +108,272 @@ class Graph : public PLCore::Resource<Graph>, public PLCore::ElementManager<Grap
 		*    End node
 		*
 		*  @return
-		*    The shortest path from the start node to the end node,
+		*    The shortest path from the start node to the end node (both nodes included),
 		*    a null pointer if no such path exist. (you have do delete this path by yourself!)
 		*
 		*  @note
-		*    - Dijkstra's single source shortest path algorithm is used
+		*    - The A* algorithm is used, the heuristic is the euclidean distance between the node positions
+		*      scaled down so that it never overestimates the neighbour distances (if the distances were
+		*      set without using the node positions, it falls back to Dijkstra's algorithm)
+		*    - Thread safe as long as the graph is not changed at the same time
+		*/
+		PLMATH_API GraphPath *FindShortestPath(PLCore::uint32 nStartNode, PLCore::uint32 nEndNode) const;
+
+		/**
+		*  @brief
+		*    Returns the shortest paths for a number of node pairs
+		*
+		*  @param[in]  nNumOfQueries
+		*    Number of paths to find
+		*  @param[in]  pnStartNodes
+		*    Start node of each path, must have at least nNumOfQueries elements
+		*  @param[in]  pnEndNodes
+		*    End node of each path, must have at least nNumOfQueries elements
+		*  @param[out] ppPaths
+		*    Receives the found paths, a null pointer for each path which doesn't exist, must have at least
+		*    nNumOfQueries elements (you have do delete the paths by yourself!)
+		*
+		*  @return
+		*    Number of found paths
+		*
+		*  @remarks
+		*    Same as calling "FindShortestPath()" for each node pair, but the queries are distributed across
+		*    the worker threads of the job system.
+		*/
+		PLMATH_API PLCore::uint32 FindShortestPaths(PLCore::uint32 nNumOfQueries, const PLCore::uint32 *pnStartNodes, const PLCore::uint32 *pnEndNodes, GraphPath **ppPaths) const;
+
+		/**
+		*  @brief
+		*    Returns the maximum number of paths within the path cache
+		*
+		*  @return
+		*    The maximum number of paths within the path cache, 0 if the cache is disabled
+		*/
+		PLMATH_API PLCore::uint32 GetPathCacheSize() const;
+
+		/**
+		*  @brief
+		*    Sets the maximum number of paths within the path cache
+		*
+		*  @param[in] nSize
+		*    The maximum number of paths within the path cache, 0 to disable the cache
+		*
+		*  @note
+		*    - The cache is cleared, must not be called while there are running queries
+		*/
+		PLMATH_API void SetPathCacheSize(PLCore::uint32 nSize = 256);
+
+
+	//[-------------------------------------------------------]
+	//[ Private static functions                              ]
+	//[-------------------------------------------------------]
+	private:
+		/**
+		*  @brief
+		*    Finds the shortest paths of a range of queries
+		*
+		*  @param[in] nFirst
+		*    Index of the first query
+		*  @param[in] nEnd
+		*    Index behind the last query
+		*  @param[in] pData
+		*    The queries (BatchData), always valid
+		*
+		*  @note
+		*    - Job system parallel for function, the ranges are processed concurrently
+		*/
+		static void FindShortestPathsRange(PLCore::uint32 nFirst, PLCore::uint32 nEnd, void *pData);
+
+
+	//[-------------------------------------------------------]
+	//[ Private definitions                                   ]
+	//[-------------------------------------------------------]
+	private:
+		/**
+		*  @brief
+		*    Search context, holds the state of one path query
+		*
+		*  @remarks
+		*    The per node data is only valid if the stamp of the node belongs to the current query, this way
+		*    nothing has to be cleared between queries.
+		*/
+		struct SearchContext {
+			PLCore::Array<float>					  lstCost;			/**< Shortest known distance of each node to the start node */
+			PLCore::Array<PLCore::uint32>			  lstPreviousNode;	/**< Previous node on the shortest known path of each node */
+			PLCore::Array<PLCore::uint32>			  lstStamp;			/**< Stamp of each node, "nStamp" = open, "nStamp+1" = closed, else not touched yet */
+			PLCore::uint32							  nStamp;			/**< Stamp of the current query */
+			PLCore::BinaryHeap<float, PLCore::uint32> cOpenList;		/**< Open nodes sorted by their estimated total distance, may contain outdated entries */
+			PLCore::Array<PLCore::uint32>			  lstPath;			/**< Nodes of the path found by the last query, start node first */
+		};
+
+		/**
+		*  @brief
+		*    Path within the path cache
+		*/
+		struct CachedPath {
+			PLCore::uint64				  nKey;			/**< Start node within the upper and end node within the lower 32 bit */
+			PLCore::uint32				  nPrevious;	/**< Previous more recently used path, "InvalidIndex" if this is the most recently used one */
+			PLCore::uint32				  nNext;		/**< Next less recently used path, "InvalidIndex" if this is the least recently used one */
+			bool						  bFound;		/**< 'true' if there's a path, else 'false' */
+			PLCore::Array<PLCore::uint32> lstNodes;		/**< Nodes of the path, start node first */
+
+			bool operator ==(const CachedPath &sOther) const
+			{
+				return (nKey == sOther.nKey);
+			}
+		};
+
+		/**
+		*  @brief
+		*    Batch of path queries, see "FindShortestPaths()"
+		*/
+		struct BatchData {
+			const Graph			  *pGraph;			/**< The graph, always valid */
+			const PLCore::uint32  *pnStartNodes;	/**< Start node of each query, always valid */
+			const PLCore::uint32  *pnEndNodes;		/**< End node of each query, always valid */
+			GraphPath			 **ppPaths;			/**< Receives the found paths, always valid */
+		};
+
+		static const PLCore::uint32 InvalidIndex = 0xFFFFFFFF;	/**< Invalid node or cached path index */
+
+
+	//[-------------------------------------------------------]
+	//[ Private functions                                     ]
+	//[-------------------------------------------------------]
+	private:
+		/**
+		*  @brief
+		*    Marks the compact copy of the graph as out of date, called as soon as the graph was changed
+		*/
+		void InvalidateSearchData();
+
+		/**
+		*  @brief
+		*    Creates the compact copy of the graph used by the path finding if it's out of date
+		*
+		*  @note
+		*    - The mutex must be locked
+		*/
+		void UpdateSearchData() const;
+
+		/**
+		*  @brief
+		*    Finds the shortest path from a node to another by using the A* algorithm
+		*
+		*  @param[in] nStartNode
+		*    Start node, must be valid
+		*  @param[in] nEndNode
+		*    End node, must be valid
+		*  @param[in] cContext
+		*    Search context to use, receives the found path
+		*
+		*  @return
+		*    'true' if a path was found, else 'false'
+		*/
+		bool Search(PLCore::uint32 nStartNode, PLCore::uint32 nEndNode, SearchContext &cContext) const;
+
+		/**
+		*  @brief
+		*    Returns the shortest path from a node to another by using the path cache
+		*
+		*  @param[in] nStartNode
+		*    Start node
+		*  @param[in] nEndNode
+		*    End node
+		*  @param[in] pContext
+		*    Search context to use, if a null pointer a search context is taken from the pool when required
+		*
+		*  @return
+		*    The shortest path from the start node to the end node, a null pointer if no such path exist
+		*/
+		GraphPath *FindPath(PLCore::uint32 nStartNode, PLCore::uint32 nEndNode, SearchContext *pContext) const;
+
+		/**
+		*  @brief
+		*    Creates a path instance
+		*
+		*  @param[in] lstNodes
+		*    Nodes of the path, start node first
+		*
+		*  @return
+		*    The created path instance, always valid
+		*/
+		GraphPath *CreatePath(const PLCore::Array<PLCore::uint32> &lstNodes) const;
+
+		/**
+		*  @brief
+		*    Returns a search context from the pool
+		*
+		*  @return
+		*    The search context, always valid, give it back by using "ReleaseSearchContext()"
+		*/
+		SearchContext *GetSearchContext() const;
+
+		/**
+		*  @brief
+		*    Gives a search context back to the pool
+		*
+		*  @param[in] cContext
+		*    Search context returned by "GetSearchContext()"
+		*/
+		void ReleaseSearchContext(SearchContext &cContext) const;
+
+		/**
+		*  @brief
+		*    Clears the path cache
+		*
+		*  @note
+		*    - The mutex must be locked
 		*/
-		PLMATH_API GraphPath *FindShortestPath(PLCore::uint32 nStartNode, PLCore::uint32 nEndNode);
+		void ClearPathCache() const;
+
+		/**
+		*  @brief
+		*    Moves a cached path to the front of the LRU list
+		*
+		*  @param[in] nCachedPath
+		*    Index of the cached path
+		*
+		*  @note
+		*    - The mutex must be locked
+		*/
+		void TouchCachedPath(PLCore::uint32 nCachedPath) const;
+
+		/**
+		*  @brief
+		*    Adds a path to the path cache, the least recently used path is replaced if the cache is full
+		*
+		*  @param[in] nKey
+		*    Key of the path, see "CachedPath::nKey"
+		*  @param[in] pNodes
+		*    Nodes of the path, start node first, a null pointer if there's no path
+		*
+		*  @note
+		*    - The mutex must be locked
+		*/
+		void AddCachedPath(PLCore::uint64 nKey, const PLCore::Array<PLCore::uint32> *pNodes) const;
 
 
 	//[-------------------------------------------------------]
 	//[ Private data                                          ]
 	//[-------------------------------------------------------]
 	private:
-		// Temp data used during path finding (so we do not reallocate it each time...)
-		PLCore::Array<float>				  m_lstNodeDistance;	/**< Shortest distance of each node to start node */
-		PLCore::Array<GraphNode*>			  m_lstPreviousNode;	/**< Previous node, if a null pointer, not processed yet */
-		PLCore::Bitset						  m_lstTouched;			/**< Holds whether nodes are already touched or not */
-		PLCore::Bitset						  m_lstProcessed;		/**< Holds whether nodes are already processed or not */
-		PLCore::Array<GraphNode*>			  m_lstNodes;			/**< Temp nodes array */
-		PLCore::BinaryHeap<float, GraphNode*> m_mapToProcess;		/**< Current processed nodes */
+		mutable PLCore::Mutex					  m_cMutex;					/**< Protects the search data creation, the search context pool and the path cache */
+		// Compact copy of the graph used by the path finding (so we do not have to walk through the nodes each time...)
+		mutable bool							  m_bSearchDataDirty;		/**< Is the search data out of date? */
+		mutable PLCore::uint32					  m_nSearchDataNodes;		/**< Number of nodes the search data was created for */
+		mutable PLCore::Array<PLCore::uint32>	  m_lstFirstNeighbour;		/**< Index of the first neighbour of each node within the neighbour lists, one additional element holds the total number of neighbours */
+		mutable PLCore::Array<PLCore::uint32>	  m_lstNeighbourNode;		/**< Neighbour node indices */
+		mutable PLCore::Array<float>			  m_lstNeighbourDistance;	/**< Neighbour distances */
+		mutable PLCore::Array<Vector3>			  m_lstNodePos;				/**< Node positions */
+		mutable float							  m_fHeuristicScale;		/**< Scale of the euclidean distance used as A* heuristic, within [0, 1] */
+		mutable PLCore::Array<SearchContext*>	  m_lstSearchContexts;		/**< Pool of currently unused search contexts */
+		// Path cache
+		PLCore::uint32							  m_nPathCacheSize;			/**< Maximum number of paths within the path cache, 0 if the cache is disabled */
+		mutable PLCore::Array<CachedPath>		  m_lstCachedPaths;			/**< Cached paths */
+		mutable PLCore::FlatHashMap<PLCore::uint64, PLCore::uint32> m_mapCachedPaths;	/**< Key -> cached path index */
+		mutable PLCore::uint32					  m_nMostRecentlyUsed;		/**< Most recently used cached path, "InvalidIndex" if there's none */
+		mutable PLCore::uint32					  m_nLeastRecentlyUsed;		/**< Least recently used cached path, "InvalidIndex" if there's none */
 
 
 	//[-------------------------------------------------------]
@@ -119,6 +383,13 @@ class Graph : public PLCore::Resource<Graph>, public PLCore::ElementManager<Grap
 		virtual GraphNode *CreateElement(const PLCore::String &sName) override;
 
 
+	//[-------------------------------------------------------]
+	//[ Public virtual PLCore::ElementManager functions       ]
+	//[-------------------------------------------------------]
+	public:
+		PLMATH_API virtual void MoveElement(PLCore::uint32 nFromIndex, PLCore::uint32 nToIndex) override;
+
+
 	//[-------------------------------------------------------]
 	//[ Public virtual PLCore::Resource functions             ]
 	//[-------------------------------------------------------]
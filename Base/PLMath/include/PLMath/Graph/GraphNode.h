@@ -50,6 +50,12 @@ namespace PLMath {
 class GraphNode : public PLCore::Element<GraphNode> {
 
 
+	//[-------------------------------------------------------]
+	//[ Friends                                               ]
+	//[-------------------------------------------------------]
+	friend class Graph;
+
+
 	//[-------------------------------------------------------]
 	//[ Public functions                                      ]
 	//[-------------------------------------------------------]
@@ -253,6 +259,17 @@ class GraphNode : public PLCore::Element<GraphNode> {
 		};
 
 
+	//[-------------------------------------------------------]
+	//[ Private functions                                     ]
+	//[-------------------------------------------------------]
+	private:
+		/**
+		*  @brief
+		*    Informs the graph the node is within that the node was changed
+		*/
+		void InvalidateGraph();
+
+
 	//[-------------------------------------------------------]
 	//[ Private data                                          ]
 	//[-------------------------------------------------------]
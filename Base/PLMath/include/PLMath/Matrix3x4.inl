@@ -422,6 +422,15 @@ inline Matrix3x4 Matrix3x4::GetTransposed() const
 					 xz, yz, zz, zw);
 }
 
+/**
+*  @brief
+*    Transforms an array of points
+*/
+inline void Matrix3x4::TransformPoints(const Vector3 *pvSource, Vector3 *pvDestination, PLCore::uint32 nNumOfPoints) const
+{
+	TransformPoints(pvSource->fV, pvDestination->fV, nNumOfPoints, sizeof(Vector3), sizeof(Vector3));
+}
+
 
 //[-------------------------------------------------------]
 //[ Scale                                                 ]
@@ -565,6 +565,46 @@ class Matrix4x4 {
 		*/
 		PLMATH_API Vector3 RotateVector(const Vector3 &vV, bool bUniformScale = false) const;
 
+		/**
+		*  @brief
+		*    Transforms an array of points
+		*
+		*  @param[in]  pfSource
+		*    First component of the first source point (x, y, z), must be valid
+		*  @param[out] pfDestination
+		*    First component of the first destination point (x, y, z), must be valid, may be "pfSource"
+		*  @param[in]  nNumOfPoints
+		*    Number of points to transform
+		*  @param[in]  nSourceStride
+		*    Number of bytes from one source point to the next one
+		*  @param[in]  nDestinationStride
+		*    Number of bytes from one destination point to the next one
+		*
+		*  @remarks
+		*    This is the batch version of "Vector3 *= Matrix4x4" and the preferred way to transform many points
+		*    at once, for instance the vertex positions inside a vertex buffer. The strides make it possible to
+		*    work directly on interleaved vertex data.
+		*    Each point is handled as (x, y, z, 1) and the result is divided by the resulting w component.
+		*/
+		PLMATH_API void TransformPoints(const float *pfSource, float *pfDestination, PLCore::uint32 nNumOfPoints,
+										PLCore::uint32 nSourceStride = sizeof(float)*3, PLCore::uint32 nDestinationStride = sizeof(float)*3) const;
+
+		/**
+		*  @brief
+		*    Transforms an array of points
+		*
+		*  @param[in]  pvSource
+		*    Source points, must be valid
+		*  @param[out] pvDestination
+		*    Destination points, must be valid, may be "pvSource"
+		*  @param[in]  nNumOfPoints
+		*    Number of points to transform
+		*
+		*  @see
+		*    - TransformPoints(const float *, float *, PLCore::uint32, PLCore::uint32, PLCore::uint32) above
+		*/
+		inline void TransformPoints(const Vector3 *pvSource, Vector3 *pvDestination, PLCore::uint32 nNumOfPoints) const;
+
 		//[-------------------------------------------------------]
 		//[ Scale                                                 ]
 		//[-------------------------------------------------------]
@@ -393,6 +393,15 @@ inline float Matrix4x4::GetTrace() const
 	return xx+yy+zz+ww;
 }
 
+/**
+*  @brief
+*    Transforms an array of points
+*/
+inline void Matrix4x4::TransformPoints(const Vector3 *pvSource, Vector3 *pvDestination, PLCore::uint32 nNumOfPoints) const
+{
+	TransformPoints(pvSource->fV, pvDestination->fV, nNumOfPoints, sizeof(Vector3), sizeof(Vector3));
+}
+
 
 //[-------------------------------------------------------]
 //[ Scale                                                 ]
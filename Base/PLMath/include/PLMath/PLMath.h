@@ -63,4 +63,15 @@
 #endif
 
 
+//[-------------------------------------------------------]
+//[ SIMD                                                  ]
+//[-------------------------------------------------------]
+// Hot operations like matrix multiplication, batch point transformation, matrix inversion and quaternion slerp have
+// an SSE code path which is selected at compile time, all other platforms are using the C++ code path. Define
+// "PLMATH_NO_SIMD" to enforce the C++ code path (e.g. for debugging or comparison).
+#if !defined(PLMATH_NO_SIMD) && (defined(__SSE__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 1))
+	#define PLMATH_SSE
+#endif
+
+
 #endif // __PLMATH_PLMATH_H__
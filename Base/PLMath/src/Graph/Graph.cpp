@@ -25,6 +25,9 @@
 //[-------------------------------------------------------]
 //[ Includes                                              ]
 //[-------------------------------------------------------]
+#include <PLCore/Core/MemoryManager.h>
+#include <PLCore/System/JobSystem.h>
+#include <PLCore/System/MutexGuard.h>
 #include "PLMath/Graph/GraphPath.h"
 #include "PLMath/Graph/Graph.h"
 
@@ -44,8 +47,16 @@ namespace PLMath {
 *    Constructor
 */
 Graph::Graph(const String &sName, ResourceManager<Graph> *pManager) :
-	Resource<Graph>(sName, pManager)
+	Resource<Graph>(sName, pManager),
+	m_bSearchDataDirty(true),
+	m_nSearchDataNodes(0),
+	m_fHeuristicScale(0.0f),
+	m_nPathCacheSize(0),
+	m_nMostRecentlyUsed(InvalidIndex),
+	m_nLeastRecentlyUsed(InvalidIndex)
 {
+	// Setup the path cache
+	SetPathCacheSize();
 }
 
 /**
@@ -54,102 +65,428 @@ Graph::Graph(const String &sName, ResourceManager<Graph> *pManager) :
 */
 Graph::~Graph()
 {
+	// Destroy the nodes right now, they inform the graph about their destruction
+	Clear();
+
+	// Destroy the search contexts
+	for (uint32 i=0; i<m_lstSearchContexts.GetNumOfElements(); i++)
+		delete m_lstSearchContexts[i];
 }
 
 /**
 *  @brief
 *    Returns the shortest path from a node to another
 */
-GraphPath *Graph::FindShortestPath(uint32 nStartNode, uint32 nEndNode)
-{
-	// Get the start node
-	GraphNode *pStartNode = GetByIndex(nStartNode);
-	if (pStartNode) {
-		// Get the end node
-		GraphNode *pEndNode = GetByIndex(nEndNode);
-		if (pEndNode) {
-			// Total number of graph nodes and the priority queue
-			uint32 nNumOfNodes = m_lstElements.GetNumOfElements();
-
-			// Initialize temp data
-			m_lstNodeDistance.Resize(nNumOfNodes);
-			m_lstPreviousNode.Resize(nNumOfNodes);
-			m_lstProcessed.Resize(nNumOfNodes);
-			m_lstTouched.ClearAll();
-			m_lstProcessed.ClearAll();
-
-			// Reset add the start node to the priority queue
-			m_mapToProcess.Reset();
-			m_mapToProcess.Add(0.0, pStartNode);
-			m_lstNodeDistance[nStartNode] = 0.0f;
-			m_lstPreviousNode[nStartNode] = nullptr;
-			m_lstTouched.Set(nStartNode);
-
-			// Loop until the priority queue is empty
-			while (!m_mapToProcess.IsEmpty()) {
-				// Get the node with the shortest distance and mark it as processed
-				float fDistance;
-				GraphNode *pNode;
-				m_mapToProcess.ExtractTop(&pNode, &fDistance);
-				m_lstProcessed.Set(pNode->GetID());
-
-				// Loop through the neighbours of this node
-				for (uint32 nNeighbour=0; nNeighbour<pNode->GetNumOfNeighbours(); nNeighbour++) {
-					GraphNode *pNeighbour   = pNode->GetNeighbour(nNeighbour);
-					uint32     nNeighbourID = pNeighbour->GetID();
-
-					// Is this node already processed?
-					if (!m_lstProcessed.IsSet(nNeighbourID)) {
-						// Calculate the new distance
-						float fNewDistance = pNode->GetNeighbourDistance(nNeighbourID)+fDistance;
-
-						// Was this node already touched?
-						if (m_lstTouched.IsSet(nNeighbourID)) {
-							// Maybe we are in luck and the old distance is shorter as the current...
-							if (fNewDistance < m_lstNodeDistance[nNeighbourID]) {
-								// D'OH!, we have to update this node information :(
-								m_lstNodeDistance[nNeighbourID] = fNewDistance;
-								m_lstPreviousNode[nNeighbourID] = pNode;
-
-								// [TODO] Change key
-								// Update the priority queue
-								m_mapToProcess.Add(fNewDistance, pNeighbour);
-							}
-						} else {
-							// Nope, this is the first touch :)
-							m_lstNodeDistance[nNeighbourID] = fNewDistance;
-							m_lstPreviousNode[nNeighbourID] = pNode;
-							m_mapToProcess.Add(fNewDistance, pNeighbour);
-							m_lstTouched.Set(nNeighbourID);
-						}
-					}
+GraphPath *Graph::FindShortestPath(uint32 nStartNode, uint32 nEndNode) const
+{
+	return FindPath(nStartNode, nEndNode, nullptr);
+}
+
+/**
+*  @brief
+*    Returns the shortest paths for a number of node pairs
+*/
+uint32 Graph::FindShortestPaths(uint32 nNumOfQueries, const uint32 *pnStartNodes, const uint32 *pnEndNodes, GraphPath **ppPaths) const
+{
+	// Number of queries per job, below this number it's not worth the effort to use the worker threads
+	static const uint32 QueriesPerJob = 8;
+
+	// Find the paths, use the worker threads of the job system if there are any
+	BatchData sBatchData;
+	sBatchData.pGraph		= this;
+	sBatchData.pnStartNodes	= pnStartNodes;
+	sBatchData.pnEndNodes	= pnEndNodes;
+	sBatchData.ppPaths		= ppPaths;
+	JobSystem *pJobSystem = (nNumOfQueries > QueriesPerJob) ? JobSystem::GetInstance() : nullptr;
+	if (pJobSystem && pJobSystem->GetNumOfWorkers())
+		pJobSystem->ParallelFor(nNumOfQueries, QueriesPerJob, &Graph::FindShortestPathsRange, &sBatchData);
+	else
+		FindShortestPathsRange(0, nNumOfQueries, &sBatchData);
+
+	// Count the found paths
+	uint32 nNumOfFoundPaths = 0;
+	for (uint32 i=0; i<nNumOfQueries; i++) {
+		if (ppPaths[i])
+			nNumOfFoundPaths++;
+	}
+
+	// Done
+	return nNumOfFoundPaths;
+}
+
+/**
+*  @brief
+*    Returns the maximum number of paths within the path cache
+*/
+uint32 Graph::GetPathCacheSize() const
+{
+	return m_nPathCacheSize;
+}
+
+/**
+*  @brief
+*    Sets the maximum number of paths within the path cache
+*/
+void Graph::SetPathCacheSize(uint32 nSize)
+{
+	MutexGuard cMutexGuard(m_cMutex);
+
+	// Clear the cache and reserve the memory for the cached paths, so they never have to be moved
+	ClearPathCache();
+	m_nPathCacheSize = nSize;
+	m_lstCachedPaths.Resize(nSize, false);
+	m_mapCachedPaths.Reserve(nSize);
+}
+
+
+//[-------------------------------------------------------]
+//[ Private static functions                              ]
+//[-------------------------------------------------------]
+/**
+*  @brief
+*    Finds the shortest paths of a range of queries
+*/
+void Graph::FindShortestPathsRange(uint32 nFirst, uint32 nEnd, void *pData)
+{
+	const BatchData &sBatchData = *static_cast<const BatchData*>(pData);
+	const Graph	    &cGraph     = *sBatchData.pGraph;
+
+	// Use one search context for the whole range
+	SearchContext *pContext = cGraph.GetSearchContext();
+	for (uint32 i=nFirst; i<nEnd; i++)
+		sBatchData.ppPaths[i] = cGraph.FindPath(sBatchData.pnStartNodes[i], sBatchData.pnEndNodes[i], pContext);
+	cGraph.ReleaseSearchContext(*pContext);
+}
+
+
+//[-------------------------------------------------------]
+//[ Private functions                                     ]
+//[-------------------------------------------------------]
+/**
+*  @brief
+*    Marks the compact copy of the graph as out of date, called as soon as the graph was changed
+*/
+void Graph::InvalidateSearchData()
+{
+	m_bSearchDataDirty = true;
+}
+
+/**
+*  @brief
+*    Creates the compact copy of the graph used by the path finding if it's out of date
+*/
+void Graph::UpdateSearchData() const
+{
+	// Nodes which were added or removed without the graph noticing it are detected by the number of nodes
+	const uint32 nNumOfNodes = m_lstElements.GetNumOfElements();
+	if (m_bSearchDataDirty || m_nSearchDataNodes != nNumOfNodes) {
+		// Get the index of each node ("GraphNode::GetID()" is walking through all nodes) and the total number of neighbours
+		FlatHashMap<uint64, uint32> mapNodeIndices;
+		mapNodeIndices.Reserve(nNumOfNodes);
+		uint32 nNumOfNeighbours = 0;
+		for (uint32 i=0; i<nNumOfNodes; i++) {
+			const GraphNode *pNode = m_lstElements[i];
+			mapNodeIndices.Add(reinterpret_cast<uint_ptr>(pNode), i);
+			nNumOfNeighbours += pNode->m_lstNeighbours.GetNumOfElements();
+		}
+
+		// Copy the positions and neighbours of the nodes
+		m_lstFirstNeighbour.Resize(nNumOfNodes + 1);
+		m_lstNeighbourNode.Resize(nNumOfNeighbours);
+		m_lstNeighbourDistance.Resize(nNumOfNeighbours);
+		m_lstNodePos.Resize(nNumOfNodes);
+		uint32 nNeighbour = 0;
+		for (uint32 i=0; i<nNumOfNodes; i++) {
+			const GraphNode &cNode = *m_lstElements[i];
+			m_lstFirstNeighbour[i] = nNeighbour;
+			m_lstNodePos[i]		   = cNode.GetPos();
+			ConstIterator<GraphNode::Neighbour*> cIterator = cNode.m_lstNeighbours.GetConstIterator();
+			while (cIterator.HasNext()) {
+				// Ignore neighbours within other graphs
+				const GraphNode::Neighbour *pNeighbour = cIterator.Next();
+				const uint32 &nNeighbourIndex = mapNodeIndices.Get(reinterpret_cast<uint_ptr>(pNeighbour->pNode));
+				if (&nNeighbourIndex != &FlatHashMap<uint64, uint32>::Null) {
+					m_lstNeighbourNode[nNeighbour]	   = nNeighbourIndex;
+					m_lstNeighbourDistance[nNeighbour] = pNeighbour->fDistance;
+					nNeighbour++;
 				}
 			}
+		}
+		m_lstFirstNeighbour[nNumOfNodes] = nNeighbour;
+
+		// The euclidean distance between two nodes must never be greater than the length of the shortest path
+		// between them, else A* may return a path which is not the shortest one. Because neighbour distances
+		// can be set by hand, scale the euclidean distance by the smallest "neighbour distance/euclidean distance" ratio.
+		m_fHeuristicScale = 1.0f;
+		for (uint32 i=0; i<nNumOfNodes; i++) {
+			for (uint32 j=m_lstFirstNeighbour[i]; j<m_lstFirstNeighbour[i+1]; j++) {
+				const float fEuclideanDistance = (m_lstNodePos[m_lstNeighbourNode[j]] - m_lstNodePos[i]).GetLength();
+				if (fEuclideanDistance > 0.0f && m_lstNeighbourDistance[j] < fEuclideanDistance*m_fHeuristicScale)
+					m_fHeuristicScale = m_lstNeighbourDistance[j]/fEuclideanDistance;
+			}
+		}
+
+		// The search data is up to date, but the cached paths may not be valid any longer
+		m_nSearchDataNodes = nNumOfNodes;
+		m_bSearchDataDirty = false;
+		ClearPathCache();
+	}
+}
 
-			// Now build the path with the collected information
-			GraphNode *pNode = m_lstPreviousNode[nEndNode];
-			if (pNode) {
-				m_lstNodes.Resize(nNumOfNodes);
-				GraphPath *pPath = new GraphPath();
-				uint32 nNumOfPathNodes = 0;
-				while (pNode) {
-					m_lstNodes[nNumOfPathNodes] = pNode;
-					pNode = m_lstPreviousNode[pNode->GetID()];
-					nNumOfPathNodes++;
+/**
+*  @brief
+*    Finds the shortest path from a node to another by using the A* algorithm
+*/
+bool Graph::Search(uint32 nStartNode, uint32 nEndNode, SearchContext &cContext) const
+{
+	// Prepare the search context, there's no need to initialize the per node data because of the stamps
+	const uint32 nNumOfNodes = m_nSearchDataNodes;
+	if (cContext.lstStamp.GetNumOfElements() != nNumOfNodes || cContext.nStamp >= 0xFFFFFFFD) {
+		cContext.lstCost.Resize(nNumOfNodes);
+		cContext.lstPreviousNode.Resize(nNumOfNodes);
+		cContext.lstStamp.Resize(nNumOfNodes);
+		MemoryManager::Set(cContext.lstStamp.GetData(), 0, nNumOfNodes*sizeof(uint32));
+		cContext.nStamp = 0;
+	}
+	cContext.nStamp += 2;
+	const uint32 nOpen   = cContext.nStamp;
+	const uint32 nClosed = cContext.nStamp + 1;
+
+	// Get the data to work with
+	const uint32  *pnFirstNeighbour	   = m_lstFirstNeighbour.GetData();
+	const uint32  *pnNeighbourNode	   = m_lstNeighbourNode.GetData();
+	const float   *pfNeighbourDistance = m_lstNeighbourDistance.GetData();
+	const Vector3 *pvNodePos		   = m_lstNodePos.GetData();
+	const Vector3 &vEndPos			   = pvNodePos[nEndNode];
+	const float    fHeuristicScale	   = m_fHeuristicScale;
+	float		  *pfCost			   = cContext.lstCost.GetData();
+	uint32		  *pnPreviousNode	   = cContext.lstPreviousNode.GetData();
+	uint32		  *pnStamp			   = cContext.lstStamp.GetData();
+	BinaryHeap<float, uint32> &cOpenList = cContext.cOpenList;
+
+	// Add the start node to the open list
+	cOpenList.Reset();
+	pfCost[nStartNode]		   = 0.0f;
+	pnPreviousNode[nStartNode] = InvalidIndex;
+	pnStamp[nStartNode]		   = nOpen;
+	cOpenList.Add((pvNodePos[nStartNode] - vEndPos).GetLength()*fHeuristicScale, nStartNode);
+
+	// Loop until the open list is empty
+	uint32 nNode;
+	while (cOpenList.ExtractTop(&nNode)) {
+		// Nodes are not removed from the open list if their distance gets shorter, they are just added again, so skip the outdated entries
+		if (pnStamp[nNode] != nClosed) {
+			pnStamp[nNode] = nClosed;
+
+			// Found the end node? The heuristic never overestimates, so this is the shortest path.
+			if (nNode == nEndNode) {
+				// Collect the nodes from the end node back to the start node...
+				Array<uint32> &lstPath = cContext.lstPath;
+				lstPath.Reset();
+				for (; nNode!=InvalidIndex; nNode=pnPreviousNode[nNode])
+					lstPath.Add(nNode);
+
+				// ... and bring them into the correct order
+				const uint32 nNumOfPathNodes = lstPath.GetNumOfElements();
+				for (uint32 i=0; i<nNumOfPathNodes/2; i++) {
+					const uint32 nTemp = lstPath[i];
+					lstPath[i] = lstPath[nNumOfPathNodes - 1 - i];
+					lstPath[nNumOfPathNodes - 1 - i] = nTemp;
 				}
 
-				// And add the nodes to the path in correct order
-				for (int i=nNumOfPathNodes-1; i>=0; i--)
-					pPath->AddNode(*m_lstNodes[i]);
+				// Done
+				return true;
+			}
 
-				// Return the created path
-				return pPath;
+			// Loop through the neighbours of this node
+			const float fCost = pfCost[nNode];
+			for (uint32 i=pnFirstNeighbour[nNode]; i<pnFirstNeighbour[nNode + 1]; i++) {
+				const uint32 nNeighbour = pnNeighbourNode[i];
+				const uint32 nStamp     = pnStamp[nNeighbour];
+
+				// Is this node already processed? If not, is this the first touch or is the new distance shorter?
+				if (nStamp != nClosed) {
+					const float fNewCost = fCost + pfNeighbourDistance[i];
+					if (nStamp != nOpen || fNewCost < pfCost[nNeighbour]) {
+						pfCost[nNeighbour]		   = fNewCost;
+						pnPreviousNode[nNeighbour] = nNode;
+						pnStamp[nNeighbour]		   = nOpen;
+						cOpenList.Add(fNewCost + (pvNodePos[nNeighbour] - vEndPos).GetLength()*fHeuristicScale, nNeighbour);
+					}
+				}
 			}
 		}
 	}
 
 	// Error, there's no path from 'start' to 'end'!
-	return nullptr;
+	return false;
+}
+
+/**
+*  @brief
+*    Returns the shortest path from a node to another by using the path cache
+*/
+GraphPath *Graph::FindPath(uint32 nStartNode, uint32 nEndNode, SearchContext *pContext) const
+{
+	const uint64 nKey = (static_cast<uint64>(nStartNode) << 32) | nEndNode;
+
+	{ // Update the search data if required and have a look into the path cache
+		MutexGuard cMutexGuard(m_cMutex);
+		UpdateSearchData();
+		if (nStartNode >= m_nSearchDataNodes || nEndNode >= m_nSearchDataNodes)
+			return nullptr; // Error, invalid node!
+		const uint32 &nCachedPath = m_mapCachedPaths.Get(nKey);
+		if (&nCachedPath != &FlatHashMap<uint64, uint32>::Null) {
+			const uint32 nCachedPathIndex = nCachedPath;
+			TouchCachedPath(nCachedPathIndex);
+			const CachedPath &sCachedPath = m_lstCachedPaths[nCachedPathIndex];
+			return sCachedPath.bFound ? CreatePath(sCachedPath.lstNodes) : nullptr;
+		}
+	}
+
+	// Find the path, the search data is not changed while there are running queries so there's no need to lock the mutex
+	SearchContext *pSearchContext = pContext ? pContext : GetSearchContext();
+	GraphPath *pPath = nullptr;
+	const bool bFound = Search(nStartNode, nEndNode, *pSearchContext);
+	if (bFound)
+		pPath = CreatePath(pSearchContext->lstPath);
+
+	// Add the result to the path cache
+	if (m_nPathCacheSize) {
+		MutexGuard cMutexGuard(m_cMutex);
+		AddCachedPath(nKey, bFound ? &pSearchContext->lstPath : nullptr);
+	}
+	if (!pContext)
+		ReleaseSearchContext(*pSearchContext);
+
+	// Done
+	return pPath;
+}
+
+/**
+*  @brief
+*    Creates a path instance
+*/
+GraphPath *Graph::CreatePath(const Array<uint32> &lstNodes) const
+{
+	// The path is linking to the nodes of this graph
+	GraphPath *pPath = new GraphPath(const_cast<Graph*>(this));
+	for (uint32 i=0; i<lstNodes.GetNumOfElements(); i++)
+		pPath->AddNode(*m_lstElements[lstNodes[i]]);
+	return pPath;
+}
+
+/**
+*  @brief
+*    Returns a search context from the pool
+*/
+Graph::SearchContext *Graph::GetSearchContext() const
+{
+	MutexGuard cMutexGuard(m_cMutex);
+
+	// Is there an unused search context?
+	const uint32 nNumOfSearchContexts = m_lstSearchContexts.GetNumOfElements();
+	if (nNumOfSearchContexts) {
+		SearchContext *pContext = m_lstSearchContexts[nNumOfSearchContexts - 1];
+		m_lstSearchContexts.RemoveAtIndex(nNumOfSearchContexts - 1);
+		return pContext;
+	}
+
+	// Create a new search context, the per node data is created by "Search()"
+	SearchContext *pContext = new SearchContext();
+	pContext->nStamp = 0;
+	pContext->cOpenList.SetResizeCount(1024);
+	pContext->lstPath.SetResizeCount(256);
+	return pContext;
+}
+
+/**
+*  @brief
+*    Gives a search context back to the pool
+*/
+void Graph::ReleaseSearchContext(SearchContext &cContext) const
+{
+	MutexGuard cMutexGuard(m_cMutex);
+	m_lstSearchContexts.Add(&cContext);
+}
+
+/**
+*  @brief
+*    Clears the path cache
+*/
+void Graph::ClearPathCache() const
+{
+	// Keep the memory of the cached paths, it's reused by "AddCachedPath()"
+	m_lstCachedPaths.Reset();
+	m_mapCachedPaths.Clear();
+	m_nMostRecentlyUsed  = InvalidIndex;
+	m_nLeastRecentlyUsed = InvalidIndex;
+}
+
+/**
+*  @brief
+*    Moves a cached path to the front of the LRU list
+*/
+void Graph::TouchCachedPath(uint32 nCachedPath) const
+{
+	if (m_nMostRecentlyUsed != nCachedPath) {
+		CachedPath &sCachedPath = m_lstCachedPaths[nCachedPath];
+
+		// Unlink the cached path, it's not the most recently used one so there's a previous one
+		m_lstCachedPaths[sCachedPath.nPrevious].nNext = sCachedPath.nNext;
+		if (sCachedPath.nNext != InvalidIndex)
+			m_lstCachedPaths[sCachedPath.nNext].nPrevious = sCachedPath.nPrevious;
+		else
+			m_nLeastRecentlyUsed = sCachedPath.nPrevious;
+
+		// Link the cached path as the most recently used one
+		sCachedPath.nPrevious = InvalidIndex;
+		sCachedPath.nNext	  = m_nMostRecentlyUsed;
+		m_lstCachedPaths[m_nMostRecentlyUsed].nPrevious = nCachedPath;
+		m_nMostRecentlyUsed = nCachedPath;
+	}
+}
+
+/**
+*  @brief
+*    Adds a path to the path cache, the least recently used path is replaced if the cache is full
+*/
+void Graph::AddCachedPath(uint64 nKey, const Array<uint32> *pNodes) const
+{
+	// Was the path added in the meantime by another query?
+	const uint32 &nExistingCachedPath = m_mapCachedPaths.Get(nKey);
+	if (&nExistingCachedPath != &FlatHashMap<uint64, uint32>::Null) {
+		TouchCachedPath(nExistingCachedPath);
+	} else if (m_nPathCacheSize) {
+		uint32 nCachedPath;
+		if (m_lstCachedPaths.GetNumOfElements() < m_nPathCacheSize) {
+			// Add a new cached path, the memory was reserved by "SetPathCacheSize()"
+			nCachedPath = m_lstCachedPaths.GetNumOfElements();
+			CachedPath &sCachedPath = m_lstCachedPaths.Add();
+			sCachedPath.nPrevious = InvalidIndex;
+			sCachedPath.nNext	  = m_nMostRecentlyUsed;
+			if (m_nMostRecentlyUsed != InvalidIndex)
+				m_lstCachedPaths[m_nMostRecentlyUsed].nPrevious = nCachedPath;
+			else
+				m_nLeastRecentlyUsed = nCachedPath;
+			m_nMostRecentlyUsed = nCachedPath;
+		} else {
+			// Replace the least recently used path
+			nCachedPath = m_nLeastRecentlyUsed;
+			m_mapCachedPaths.Remove(m_lstCachedPaths[nCachedPath].nKey);
+			TouchCachedPath(nCachedPath);
+		}
+
+		// Setup the cached path
+		CachedPath &sCachedPath = m_lstCachedPaths[nCachedPath];
+		sCachedPath.nKey   = nKey;
+		sCachedPath.bFound = (pNodes != nullptr);
+		if (pNodes)
+			sCachedPath.lstNodes = *pNodes;
+		else
+			sCachedPath.lstNodes.Reset();
+		m_mapCachedPaths.Add(nKey, nCachedPath);
+	}
 }
 
 
@@ -158,10 +495,22 @@ GraphPath *Graph::FindShortestPath(uint32 nStartNode, uint32 nEndNode)
 //[-------------------------------------------------------]
 GraphNode *Graph::CreateElement(const String &sName)
 {
+	InvalidateSearchData();
 	return new GraphNode(sName, this);
 }
 
 
+//[-------------------------------------------------------]
+//[ Public virtual PLCore::ElementManager functions       ]
+//[-------------------------------------------------------]
+void Graph::MoveElement(uint32 nFromIndex, uint32 nToIndex)
+{
+	// Call base implementation, the node indices are changed
+	ElementManager<GraphNode>::MoveElement(nFromIndex, nToIndex);
+	InvalidateSearchData();
+}
+
+
 //[-------------------------------------------------------]
 //[ Public virtual PLCore::Resource functions             ]
 //[-------------------------------------------------------]
@@ -173,6 +522,7 @@ Graph &Graph::operator =(const Graph &cSource)
 	// Call base function
 	*static_cast<Resource<Graph>*>(this)           = cSource;
 	*static_cast<ElementManager<GraphNode>*>(this) = cSource;
+	InvalidateSearchData();
 
 	// Done
 	return *this;
@@ -186,10 +536,7 @@ bool Graph::Unload()
 {
 	// Clear the graph
 	Clear();
-
-	// [TODO]
-	// Clear temp data
-	// m_lstPreviousNode.Clear();
+	InvalidateSearchData();
 
 	// Call base implementation
 	return Resource<Graph>::Unload();
@@ -25,7 +25,7 @@
 //[-------------------------------------------------------]
 //[ Includes                                              ]
 //[-------------------------------------------------------]
-#include "PLMath/Graph/GraphNode.h"
+#include "PLMath/Graph/Graph.h"
 
 
 //[-------------------------------------------------------]
@@ -62,6 +62,7 @@ GraphNode::GraphNode(GraphNode &cSource)
 */
 GraphNode::~GraphNode()
 {
+	// The node indices of the graph are changed
 	ClearNeighbours();
 }
 
@@ -102,6 +103,9 @@ void GraphNode::ClearNeighbours()
 		}
 	}
 	m_lstNeighbours.Clear();
+
+	// Inform the graph
+	InvalidateGraph();
 }
 
 /**
@@ -168,6 +172,9 @@ bool GraphNode::AddNeighbour(GraphNode &cNode, float fDistance)
 		pNeighbour->fDistance = (fDistance < 0.0f) ? GetDistance(cNode) : fDistance;
 		cNode.m_lstIsNeighbourFrom.Add(this);
 
+		// Inform the graph
+		InvalidateGraph();
+
 		// Done
 		return true;
 	}
@@ -201,6 +208,9 @@ bool GraphNode::RemoveNeighbour(GraphNode &cNode)
 		delete pNeighbour;
 		m_lstNeighbours.Remove(pNeighbour);
 
+		// Inform the graph
+		InvalidateGraph();
+
 		// Done
 		return true;
 	} else return false; // Error!
@@ -218,6 +228,9 @@ bool GraphNode::RemoveNeighbourAtIndex(uint32 nNeighbour)
 		delete pNeighbour;
 		m_lstNeighbours.RemoveAtIndex(nNeighbour);
 
+		// Inform the graph
+		InvalidateGraph();
+
 		// Done
 		return true;
 	} else return false; // Error!
@@ -266,16 +279,20 @@ void GraphNode::SetPos(float fX, float fY, float fZ)
 		Iterator<GraphNode*> cIterator = m_lstIsNeighbourFrom.GetIterator();
 		while (cIterator.HasNext()) {
 			// Find this node within the neighbour
-			Iterator<Neighbour*> cNeighbourIterator = cIterator.Next()->m_lstNeighbours.GetIterator();
+			const GraphNode *pNode = cIterator.Next();
+			Iterator<Neighbour*> cNeighbourIterator = pNode->m_lstNeighbours.GetIterator();
 			while (cNeighbourIterator.HasNext()) {
 				Neighbour *pNeighbour = cNeighbourIterator.Next();
 				if (pNeighbour->pNode == this) {
-					pNeighbour->fDistance = GetDistance(*pNeighbour->pNode);
+					pNeighbour->fDistance = GetDistance(*pNode);
 					break;
 				}
 			}
 		}
 	}
+
+	// Inform the graph
+	InvalidateGraph();
 }
 
 /**
@@ -288,6 +305,21 @@ float GraphNode::GetDistance(const GraphNode &cNode) const
 }
 
 
+//[-------------------------------------------------------]
+//[ Private functions                                     ]
+//[-------------------------------------------------------]
+/**
+*  @brief
+*    Informs the graph the node is within that the node was changed
+*/
+void GraphNode::InvalidateGraph()
+{
+	// Only the graph is managing graph nodes
+	if (GetManager())
+		static_cast<Graph*>(GetManager())->InvalidateSearchData();
+}
+
+
 //[-------------------------------------------------------]
 //[ Public virtual PLCore::Element functions              ]
 //[-------------------------------------------------------]
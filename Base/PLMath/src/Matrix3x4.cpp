@@ -30,11 +30,15 @@
 #include "PLMath/Matrix3x3.h"
 #include "PLMath/Matrix4x4.h"
 #include "PLMath/Matrix3x4.h"
+#ifdef PLMATH_SSE
+	#include <xmmintrin.h>
+#endif
 
 
 //[-------------------------------------------------------]
 //[ Namespace                                             ]
 //[-------------------------------------------------------]
+using namespace PLCore;
 namespace PLMath {
 
 
@@ -287,6 +291,104 @@ Vector3 Matrix3x4::RotateVector(const Vector3 &vV, bool bUniformScale) const
 	}
 }
 
+/**
+*  @brief
+*    Transforms an array of points
+*/
+void Matrix3x4::TransformPoints(const float *pfSource, float *pfDestination, uint32 nNumOfPoints, uint32 nSourceStride, uint32 nDestinationStride) const
+{
+	const uint8 *pnSource      = reinterpret_cast<const uint8*>(pfSource);
+		  uint8 *pnDestination = reinterpret_cast<uint8*>(pfDestination);
+	uint32 i = 0;
+
+#ifdef PLMATH_SSE
+	if (nSourceStride == sizeof(float)*3 && nDestinationStride == sizeof(float)*3) {
+		// SSE method for tightly packed points: Four points are stored within three SSE registers (x0 y0 z0 x1) (y1 z1 x2 y2)
+		// (z2 x3 y3 z3), each of this registers is transformed directly by using rotated matrix columns
+		const __m128 vColumnX0 = _mm_setr_ps(xx, yx, zx, xx), vColumnY0 = _mm_setr_ps(xy, yy, zy, xy), vColumnZ0 = _mm_setr_ps(xz, yz, zz, xz), vColumnW0 = _mm_setr_ps(xw, yw, zw, xw);
+		const __m128 vColumnX1 = _mm_setr_ps(yx, zx, xx, yx), vColumnY1 = _mm_setr_ps(yy, zy, xy, yy), vColumnZ1 = _mm_setr_ps(yz, zz, xz, yz), vColumnW1 = _mm_setr_ps(yw, zw, xw, yw);
+		const __m128 vColumnX2 = _mm_setr_ps(zx, xx, yx, zx), vColumnY2 = _mm_setr_ps(zy, xy, yy, zy), vColumnZ2 = _mm_setr_ps(zz, xz, yz, zz), vColumnW2 = _mm_setr_ps(zw, xw, yw, zw);
+		for (; i+4<=nNumOfPoints; i+=4, pnSource+=sizeof(float)*12, pnDestination+=sizeof(float)*12) {
+			const float *pfS = reinterpret_cast<const float*>(pnSource);
+			const __m128 vA = _mm_loadu_ps(&pfS[0]);
+			const __m128 vB = _mm_loadu_ps(&pfS[4]);
+			const __m128 vC = _mm_loadu_ps(&pfS[8]);
+
+			// (x0 x0 x0 x1) (y0 y0 y0 y1) (z0 z0 z0 z1)
+			const __m128 vX0 = _mm_shuffle_ps(vA, vA, _MM_SHUFFLE(3, 0, 0, 0));
+			__m128 vTemp = _mm_shuffle_ps(vA, vB, _MM_SHUFFLE(0, 0, 1, 1));
+			const __m128 vY0 = _mm_shuffle_ps(vTemp, vTemp, _MM_SHUFFLE(2, 0, 0, 0));
+			vTemp = _mm_shuffle_ps(vA, vB, _MM_SHUFFLE(1, 1, 2, 2));
+			const __m128 vZ0 = _mm_shuffle_ps(vTemp, vTemp, _MM_SHUFFLE(2, 0, 0, 0));
+
+			// (x1 x1 x2 x2) (y1 y1 y2 y2) (z1 z1 z2 z2)
+			const __m128 vX1 = _mm_shuffle_ps(vA, vB, _MM_SHUFFLE(2, 2, 3, 3));
+			const __m128 vY1 = _mm_shuffle_ps(vB, vB, _MM_SHUFFLE(3, 3, 0, 0));
+			const __m128 vZ1 = _mm_shuffle_ps(vB, vC, _MM_SHUFFLE(0, 0, 1, 1));
+
+			// (x2 x3 x3 x3) (y2 y3 y3 y3) (z2 z3 z3 z3)
+			vTemp = _mm_shuffle_ps(vB, vC, _MM_SHUFFLE(1, 1, 2, 2));
+			const __m128 vX2 = _mm_shuffle_ps(vTemp, vTemp, _MM_SHUFFLE(3, 3, 3, 0));
+			vTemp = _mm_shuffle_ps(vB, vC, _MM_SHUFFLE(2, 2, 3, 3));
+			const __m128 vY2 = _mm_shuffle_ps(vTemp, vTemp, _MM_SHUFFLE(3, 3, 3, 0));
+			const __m128 vZ2 = _mm_shuffle_ps(vC, vC, _MM_SHUFFLE(3, 3, 3, 0));
+
+			// Transform and write back
+			float *pfD = reinterpret_cast<float*>(pnDestination);
+			_mm_storeu_ps(&pfD[0], _mm_add_ps(_mm_add_ps(_mm_mul_ps(vColumnX0, vX0), _mm_mul_ps(vColumnY0, vY0)), _mm_add_ps(_mm_mul_ps(vColumnZ0, vZ0), vColumnW0)));
+			_mm_storeu_ps(&pfD[4], _mm_add_ps(_mm_add_ps(_mm_mul_ps(vColumnX1, vX1), _mm_mul_ps(vColumnY1, vY1)), _mm_add_ps(_mm_mul_ps(vColumnZ1, vZ1), vColumnW1)));
+			_mm_storeu_ps(&pfD[8], _mm_add_ps(_mm_add_ps(_mm_mul_ps(vColumnX2, vX2), _mm_mul_ps(vColumnY2, vY2)), _mm_add_ps(_mm_mul_ps(vColumnZ2, vZ2), vColumnW2)));
+		}
+	} else {
+		// SSE method for strided points: Process four points at once, each SSE register holds one component of the four points
+		const __m128 vXX = _mm_set1_ps(xx), vXY = _mm_set1_ps(xy), vXZ = _mm_set1_ps(xz), vXW = _mm_set1_ps(xw);
+		const __m128 vYX = _mm_set1_ps(yx), vYY = _mm_set1_ps(yy), vYZ = _mm_set1_ps(yz), vYW = _mm_set1_ps(yw);
+		const __m128 vZX = _mm_set1_ps(zx), vZY = _mm_set1_ps(zy), vZZ = _mm_set1_ps(zz), vZW = _mm_set1_ps(zw);
+		for (; i+4<=nNumOfPoints; i+=4, pnSource+=nSourceStride*4, pnDestination+=nDestinationStride*4) {
+			// Gather the components of the four points
+			const float *pfS0 = reinterpret_cast<const float*>(pnSource);
+			const float *pfS1 = reinterpret_cast<const float*>(pnSource + nSourceStride);
+			const float *pfS2 = reinterpret_cast<const float*>(pnSource + nSourceStride*2);
+			const float *pfS3 = reinterpret_cast<const float*>(pnSource + nSourceStride*3);
+			const __m128 vX = _mm_setr_ps(pfS0[0], pfS1[0], pfS2[0], pfS3[0]);
+			const __m128 vY = _mm_setr_ps(pfS0[1], pfS1[1], pfS2[1], pfS3[1]);
+			const __m128 vZ = _mm_setr_ps(pfS0[2], pfS1[2], pfS2[2], pfS3[2]);
+
+			// Transform
+			__m128 vResultX = _mm_add_ps(_mm_add_ps(_mm_mul_ps(vXX, vX), _mm_mul_ps(vXY, vY)), _mm_add_ps(_mm_mul_ps(vXZ, vZ), vXW));
+			__m128 vResultY = _mm_add_ps(_mm_add_ps(_mm_mul_ps(vYX, vX), _mm_mul_ps(vYY, vY)), _mm_add_ps(_mm_mul_ps(vYZ, vZ), vYW));
+			__m128 vResultZ = _mm_add_ps(_mm_add_ps(_mm_mul_ps(vZX, vX), _mm_mul_ps(vZY, vY)), _mm_add_ps(_mm_mul_ps(vZZ, vZ), vZW));
+
+			// Scatter the four transformed points, after the transpose each SSE register holds one point
+			__m128 vResultW = _mm_setzero_ps();
+			_MM_TRANSPOSE4_PS(vResultX, vResultY, vResultZ, vResultW);
+			float *pfD = reinterpret_cast<float*>(pnDestination);
+			_mm_storel_pi(reinterpret_cast<__m64*>(pfD), vResultX);
+			_mm_store_ss(&pfD[2], _mm_movehl_ps(vResultX, vResultX));
+			pfD = reinterpret_cast<float*>(pnDestination + nDestinationStride);
+			_mm_storel_pi(reinterpret_cast<__m64*>(pfD), vResultY);
+			_mm_store_ss(&pfD[2], _mm_movehl_ps(vResultY, vResultY));
+			pfD = reinterpret_cast<float*>(pnDestination + nDestinationStride*2);
+			_mm_storel_pi(reinterpret_cast<__m64*>(pfD), vResultZ);
+			_mm_store_ss(&pfD[2], _mm_movehl_ps(vResultZ, vResultZ));
+			pfD = reinterpret_cast<float*>(pnDestination + nDestinationStride*3);
+			_mm_storel_pi(reinterpret_cast<__m64*>(pfD), vResultW);
+			_mm_store_ss(&pfD[2], _mm_movehl_ps(vResultW, vResultW));
+		}
+	}
+#endif
+
+	// C++ method (also used for the remaining points of the SSE method)
+	for (; i<nNumOfPoints; i++, pnSource+=nSourceStride, pnDestination+=nDestinationStride) {
+		const float *pfS = reinterpret_cast<const float*>(pnSource);
+		const float x = pfS[0], y = pfS[1], z = pfS[2];
+		float *pfD = reinterpret_cast<float*>(pnDestination);
+		pfD[0] = xx*x + xy*y + xz*z + xw;
+		pfD[1] = yx*x + yy*y + yz*z + yw;
+		pfD[2] = zx*x + zy*y + zz*z + zw;
+	}
+}
+
 
 //[-------------------------------------------------------]
 //[ Scale                                                 ]
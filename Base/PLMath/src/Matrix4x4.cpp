@@ -30,11 +30,15 @@
 #include "PLMath/Matrix3x3.h"
 #include "PLMath/Matrix3x4.h"
 #include "PLMath/Matrix4x4.h"
+#ifdef PLMATH_SSE
+	#include <xmmintrin.h>
+#endif
 
 
 //[-------------------------------------------------------]
 //[ Namespace                                             ]
 //[-------------------------------------------------------]
+using namespace PLCore;
 namespace PLMath {
 
 
@@ -165,19 +169,49 @@ Matrix4x4 Matrix4x4::operator *(const Matrix3x4 &mM) const
 					 zx*mM.xx + zy*mM.yx + zz*mM.zx + zw*0.0f, zx*mM.xy + zy*mM.yy + zz*mM.zy + zw*0.0f, zx*mM.xz + zy*mM.yz + zz*mM.zz + zw*0.0f, zx*mM.xw + zy*mM.yw + zz*mM.zw + zw*1.0f,
 					 wx*mM.xx + wy*mM.yx + wz*mM.zx + ww*0.0f, wx*mM.xy + wy*mM.yy + wz*mM.zy + ww*0.0f, wx*mM.xz + wy*mM.yz + wz*mM.zz + ww*0.0f, wx*mM.xw + wy*mM.yw + wz*mM.zw + ww*1.0f);
 */
+#ifdef PLMATH_SSE
+	// SSE method: Each column of the result is a linear combination of the columns of this matrix
+	const __m128 vColumnX = _mm_loadu_ps(&fM[0]);
+	const __m128 vColumnY = _mm_loadu_ps(&fM[4]);
+	const __m128 vColumnZ = _mm_loadu_ps(&fM[8]);
+	Matrix4x4 mResult;
+	for (int i=0; i<4; i++) {
+		const float *pfColumn = &mM.fM[i*3];
+		_mm_storeu_ps(&mResult.fM[i*4], _mm_add_ps(_mm_add_ps(_mm_mul_ps(vColumnX, _mm_set1_ps(pfColumn[0])), _mm_mul_ps(vColumnY, _mm_set1_ps(pfColumn[1]))),
+												   _mm_mul_ps(vColumnZ, _mm_set1_ps(pfColumn[2]))));
+	}
+	// The last row of the 3x4 matrix is (0, 0, 0, 1), so just add the w column of this matrix to the translation column
+	_mm_storeu_ps(&mResult.fM[12], _mm_add_ps(_mm_loadu_ps(&mResult.fM[12]), _mm_loadu_ps(&fM[12])));
+	return mResult;
+#else
 	// Optimized
 	return Matrix4x4(xx*mM.xx + xy*mM.yx + xz*mM.zx, xx*mM.xy + xy*mM.yy + xz*mM.zy, xx*mM.xz + xy*mM.yz + xz*mM.zz, xx*mM.xw + xy*mM.yw + xz*mM.zw + xw,
 					 yx*mM.xx + yy*mM.yx + yz*mM.zx, yx*mM.xy + yy*mM.yy + yz*mM.zy, yx*mM.xz + yy*mM.yz + yz*mM.zz, yx*mM.xw + yy*mM.yw + yz*mM.zw + yw,
 					 zx*mM.xx + zy*mM.yx + zz*mM.zx, zx*mM.xy + zy*mM.yy + zz*mM.zy, zx*mM.xz + zy*mM.yz + zz*mM.zz, zx*mM.xw + zy*mM.yw + zz*mM.zw + zw,
 					 wx*mM.xx + wy*mM.yx + wz*mM.zx, wx*mM.xy + wy*mM.yy + wz*mM.zy, wx*mM.xz + wy*mM.yz + wz*mM.zz, wx*mM.xw + wy*mM.yw + wz*mM.zw + ww);
+#endif
 }
 
 Matrix4x4 Matrix4x4::operator *(const Matrix4x4 &mM) const
 {
+#ifdef PLMATH_SSE
+	// SSE method: Each column of the result is a linear combination of the columns of this matrix
+	const __m128 vColumnX = _mm_loadu_ps(&fM[0]);
+	const __m128 vColumnY = _mm_loadu_ps(&fM[4]);
+	const __m128 vColumnZ = _mm_loadu_ps(&fM[8]);
+	const __m128 vColumnW = _mm_loadu_ps(&fM[12]);
+	Matrix4x4 mResult;
+	for (int i=0; i<16; i+=4) {
+		_mm_storeu_ps(&mResult.fM[i], _mm_add_ps(_mm_add_ps(_mm_mul_ps(vColumnX, _mm_set1_ps(mM.fM[i])),   _mm_mul_ps(vColumnY, _mm_set1_ps(mM.fM[i+1]))),
+												 _mm_add_ps(_mm_mul_ps(vColumnZ, _mm_set1_ps(mM.fM[i+2])), _mm_mul_ps(vColumnW, _mm_set1_ps(mM.fM[i+3])))));
+	}
+	return mResult;
+#else
 	return Matrix4x4(xx*mM.xx + xy*mM.yx + xz*mM.zx + xw*mM.wx, xx*mM.xy + xy*mM.yy + xz*mM.zy + xw*mM.wy, xx*mM.xz + xy*mM.yz + xz*mM.zz + xw*mM.wz, xx*mM.xw + xy*mM.yw + xz*mM.zw + xw*mM.ww,
 					 yx*mM.xx + yy*mM.yx + yz*mM.zx + yw*mM.wx, yx*mM.xy + yy*mM.yy + yz*mM.zy + yw*mM.wy, yx*mM.xz + yy*mM.yz + yz*mM.zz + yw*mM.wz, yx*mM.xw + yy*mM.yw + yz*mM.zw + yw*mM.ww,
 					 zx*mM.xx + zy*mM.yx + zz*mM.zx + zw*mM.wx, zx*mM.xy + zy*mM.yy + zz*mM.zy + zw*mM.wy, zx*mM.xz + zy*mM.yz + zz*mM.zz + zw*mM.wz, zx*mM.xw + zy*mM.yw + zz*mM.zw + zw*mM.ww,
 					 wx*mM.xx + wy*mM.yx + wz*mM.zx + ww*mM.wx, wx*mM.xy + wy*mM.yy + wz*mM.zy + ww*mM.wy, wx*mM.xz + wy*mM.yz + wz*mM.zz + ww*mM.wz, wx*mM.xw + wy*mM.yw + wz*mM.zw + ww*mM.ww);
+#endif
 }
 
 
@@ -265,6 +299,96 @@ Matrix4x4 Matrix4x4::GetTransposed() const
 */
 bool Matrix4x4::Invert()
 {
+#ifdef PLMATH_SSE
+	// SSE method: Cramers rule as described within Intel's "Streaming SIMD Extensions - Inverse of 4x4 Matrix"
+	// (the inverse of the transposed matrix is the transposed inverse, so the storage order doesn't matter in here)
+	__m128 vTemp = _mm_setzero_ps(), vRow0, vRow1 = _mm_setzero_ps(), vRow2, vRow3 = _mm_setzero_ps();
+	__m128 vMinor0, vMinor1, vMinor2, vMinor3;
+
+	// Load and transpose the matrix
+	vTemp = _mm_loadh_pi(_mm_loadl_pi(vTemp, reinterpret_cast<const __m64*>(&fM[0])),  reinterpret_cast<const __m64*>(&fM[4]));
+	vRow1 = _mm_loadh_pi(_mm_loadl_pi(vRow1, reinterpret_cast<const __m64*>(&fM[8])),  reinterpret_cast<const __m64*>(&fM[12]));
+	vRow0 = _mm_shuffle_ps(vTemp, vRow1, 0x88);
+	vRow1 = _mm_shuffle_ps(vRow1, vTemp, 0xDD);
+	vTemp = _mm_loadh_pi(_mm_loadl_pi(vTemp, reinterpret_cast<const __m64*>(&fM[2])),  reinterpret_cast<const __m64*>(&fM[6]));
+	vRow3 = _mm_loadh_pi(_mm_loadl_pi(vRow3, reinterpret_cast<const __m64*>(&fM[10])), reinterpret_cast<const __m64*>(&fM[14]));
+	vRow2 = _mm_shuffle_ps(vTemp, vRow3, 0x88);
+	vRow3 = _mm_shuffle_ps(vRow3, vTemp, 0xDD);
+
+	// Calculate the cofactors
+	vTemp   = _mm_mul_ps(vRow2, vRow3);
+	vTemp   = _mm_shuffle_ps(vTemp, vTemp, 0xB1);
+	vMinor0 = _mm_mul_ps(vRow1, vTemp);
+	vMinor1 = _mm_mul_ps(vRow0, vTemp);
+	vTemp   = _mm_shuffle_ps(vTemp, vTemp, 0x4E);
+	vMinor0 = _mm_sub_ps(_mm_mul_ps(vRow1, vTemp), vMinor0);
+	vMinor1 = _mm_sub_ps(_mm_mul_ps(vRow0, vTemp), vMinor1);
+	vMinor1 = _mm_shuffle_ps(vMinor1, vMinor1, 0x4E);
+
+	vTemp   = _mm_mul_ps(vRow1, vRow2);
+	vTemp   = _mm_shuffle_ps(vTemp, vTemp, 0xB1);
+	vMinor0 = _mm_add_ps(_mm_mul_ps(vRow3, vTemp), vMinor0);
+	vMinor3 = _mm_mul_ps(vRow0, vTemp);
+	vTemp   = _mm_shuffle_ps(vTemp, vTemp, 0x4E);
+	vMinor0 = _mm_sub_ps(vMinor0, _mm_mul_ps(vRow3, vTemp));
+	vMinor3 = _mm_sub_ps(_mm_mul_ps(vRow0, vTemp), vMinor3);
+	vMinor3 = _mm_shuffle_ps(vMinor3, vMinor3, 0x4E);
+
+	vTemp   = _mm_mul_ps(_mm_shuffle_ps(vRow1, vRow1, 0x4E), vRow3);
+	vTemp   = _mm_shuffle_ps(vTemp, vTemp, 0xB1);
+	vRow2   = _mm_shuffle_ps(vRow2, vRow2, 0x4E);
+	vMinor0 = _mm_add_ps(_mm_mul_ps(vRow2, vTemp), vMinor0);
+	vMinor2 = _mm_mul_ps(vRow0, vTemp);
+	vTemp   = _mm_shuffle_ps(vTemp, vTemp, 0x4E);
+	vMinor0 = _mm_sub_ps(vMinor0, _mm_mul_ps(vRow2, vTemp));
+	vMinor2 = _mm_sub_ps(_mm_mul_ps(vRow0, vTemp), vMinor2);
+	vMinor2 = _mm_shuffle_ps(vMinor2, vMinor2, 0x4E);
+
+	vTemp   = _mm_mul_ps(vRow0, vRow1);
+	vTemp   = _mm_shuffle_ps(vTemp, vTemp, 0xB1);
+	vMinor2 = _mm_add_ps(_mm_mul_ps(vRow3, vTemp), vMinor2);
+	vMinor3 = _mm_sub_ps(_mm_mul_ps(vRow2, vTemp), vMinor3);
+	vTemp   = _mm_shuffle_ps(vTemp, vTemp, 0x4E);
+	vMinor2 = _mm_sub_ps(_mm_mul_ps(vRow3, vTemp), vMinor2);
+	vMinor3 = _mm_sub_ps(vMinor3, _mm_mul_ps(vRow2, vTemp));
+
+	vTemp   = _mm_mul_ps(vRow0, vRow3);
+	vTemp   = _mm_shuffle_ps(vTemp, vTemp, 0xB1);
+	vMinor1 = _mm_sub_ps(vMinor1, _mm_mul_ps(vRow2, vTemp));
+	vMinor2 = _mm_add_ps(_mm_mul_ps(vRow1, vTemp), vMinor2);
+	vTemp   = _mm_shuffle_ps(vTemp, vTemp, 0x4E);
+	vMinor1 = _mm_add_ps(_mm_mul_ps(vRow2, vTemp), vMinor1);
+	vMinor2 = _mm_sub_ps(vMinor2, _mm_mul_ps(vRow1, vTemp));
+
+	vTemp   = _mm_mul_ps(vRow0, vRow2);
+	vTemp   = _mm_shuffle_ps(vTemp, vTemp, 0xB1);
+	vMinor1 = _mm_add_ps(_mm_mul_ps(vRow3, vTemp), vMinor1);
+	vMinor3 = _mm_sub_ps(vMinor3, _mm_mul_ps(vRow1, vTemp));
+	vTemp   = _mm_shuffle_ps(vTemp, vTemp, 0x4E);
+	vMinor1 = _mm_sub_ps(vMinor1, _mm_mul_ps(vRow3, vTemp));
+	vMinor3 = _mm_add_ps(_mm_mul_ps(vRow1, vTemp), vMinor3);
+
+	// Calculate the determinant of the matrix
+	__m128 vDet = _mm_mul_ps(vRow0, vMinor0);
+	vDet = _mm_add_ps(_mm_shuffle_ps(vDet, vDet, 0x4E), vDet);
+	vDet = _mm_add_ss(_mm_shuffle_ps(vDet, vDet, 0xB1), vDet);
+	const float fDet = _mm_cvtss_f32(vDet);
+
+	// Check for null to avoid division by null
+	if (fDet) {
+		const __m128 vInvDet = _mm_set1_ps(1.0f/fDet);
+		_mm_storeu_ps(&fM[0],  _mm_mul_ps(vInvDet, vMinor0));
+		_mm_storeu_ps(&fM[4],  _mm_mul_ps(vInvDet, vMinor1));
+		_mm_storeu_ps(&fM[8],  _mm_mul_ps(vInvDet, vMinor2));
+		_mm_storeu_ps(&fM[12], _mm_mul_ps(vInvDet, vMinor3));
+	} else {
+		// For sure, set identity matrix
+		SetIdentity();
+
+		// Error!
+		return false;
+	}
+#else
 	// First, calculate the determinant of the matrix
 	float fDet = GetDeterminant();
 
@@ -312,6 +436,7 @@ bool Matrix4x4::Invert()
 			return false;
 		}
 //	}
+#endif
 
 	// Done
 	return true;
@@ -323,6 +448,12 @@ bool Matrix4x4::Invert()
 */
 Matrix4x4 Matrix4x4::GetInverted() const
 {
+#ifdef PLMATH_SSE
+	// SSE method: Use the SSE version of "Invert()", on error the result is an identity matrix, too
+	Matrix4x4 mInverted = *this;
+	mInverted.Invert();
+	return mInverted;
+#else
 	// First, calculate the determinant of the matrix
 	float fDet = GetDeterminant();
 
@@ -346,6 +477,7 @@ Matrix4x4 Matrix4x4::GetInverted() const
 							 fDet*(yx*(wy*zz - zy*wz) + zx*(yy*wz - wy*yz) + wx*(zy*yz - yy*zz)), fDet*(zx*(wy*xz - xy*wz) + wx*(xy*zz - zy*xz) + xx*(zy*wz - wy*zz)), fDet*(wx*(yy*xz - xy*yz) + xx*(wy*yz - yy*wz) + yx*(xy*wz - wy*xz)), fDet*(xx*(yy*zz - zy*yz) + yx*(zy*xz - xy*zz) + zx*(xy*yz - yy*xz)));
 		} else return Matrix4x4::Identity; // Error!
 //	}
+#endif
 }
 
 /**
@@ -389,6 +521,92 @@ Vector3 Matrix4x4::RotateVector(const Vector3 &vV, bool bUniformScale) const
 	}
 }
 
+/**
+*  @brief
+*    Transforms an array of points
+*/
+void Matrix4x4::TransformPoints(const float *pfSource, float *pfDestination, uint32 nNumOfPoints, uint32 nSourceStride, uint32 nDestinationStride) const
+{
+	const uint8 *pnSource      = reinterpret_cast<const uint8*>(pfSource);
+		  uint8 *pnDestination = reinterpret_cast<uint8*>(pfDestination);
+	uint32 i = 0;
+
+#ifdef PLMATH_SSE
+	// SSE method: Process four points at once, each SSE register holds one component of the four points
+	const bool bTightlyPacked = (nSourceStride == sizeof(float)*3 && nDestinationStride == sizeof(float)*3);
+	const __m128 vXX = _mm_set1_ps(xx), vXY = _mm_set1_ps(xy), vXZ = _mm_set1_ps(xz), vXW = _mm_set1_ps(xw);
+	const __m128 vYX = _mm_set1_ps(yx), vYY = _mm_set1_ps(yy), vYZ = _mm_set1_ps(yz), vYW = _mm_set1_ps(yw);
+	const __m128 vZX = _mm_set1_ps(zx), vZY = _mm_set1_ps(zy), vZZ = _mm_set1_ps(zz), vZW = _mm_set1_ps(zw);
+	const __m128 vWX = _mm_set1_ps(wx), vWY = _mm_set1_ps(wy), vWZ = _mm_set1_ps(wz), vWW = _mm_set1_ps(ww);
+	for (; i+4<=nNumOfPoints; i+=4) {
+		// Gather the components of the four points
+		__m128 vX, vY, vZ;
+		if (bTightlyPacked) {
+			// Load (x0 y0 z0 x1) (y1 z1 x2 y2) (z2 x3 y3 z3) and shuffle them into (x0 x1 x2 x3) (y0 y1 y2 y3) (z0 z1 z2 z3)
+			const float *pfS = reinterpret_cast<const float*>(pnSource);
+			const __m128 vA = _mm_loadu_ps(&pfS[0]);
+			const __m128 vB = _mm_loadu_ps(&pfS[4]);
+			const __m128 vC = _mm_loadu_ps(&pfS[8]);
+			vX = _mm_shuffle_ps(_mm_shuffle_ps(vA, vA, _MM_SHUFFLE(3, 3, 0, 0)), _mm_shuffle_ps(vB, vC, _MM_SHUFFLE(1, 1, 2, 2)), _MM_SHUFFLE(2, 0, 2, 0));
+			vY = _mm_shuffle_ps(_mm_shuffle_ps(vA, vB, _MM_SHUFFLE(0, 0, 1, 1)), _mm_shuffle_ps(vB, vC, _MM_SHUFFLE(2, 2, 3, 3)), _MM_SHUFFLE(2, 0, 2, 0));
+			vZ = _mm_shuffle_ps(_mm_shuffle_ps(vA, vB, _MM_SHUFFLE(1, 1, 2, 2)), _mm_shuffle_ps(vC, vC, _MM_SHUFFLE(3, 3, 0, 0)), _MM_SHUFFLE(2, 0, 2, 0));
+		} else {
+			const float *pfS0 = reinterpret_cast<const float*>(pnSource);
+			const float *pfS1 = reinterpret_cast<const float*>(pnSource + nSourceStride);
+			const float *pfS2 = reinterpret_cast<const float*>(pnSource + nSourceStride*2);
+			const float *pfS3 = reinterpret_cast<const float*>(pnSource + nSourceStride*3);
+			vX = _mm_setr_ps(pfS0[0], pfS1[0], pfS2[0], pfS3[0]);
+			vY = _mm_setr_ps(pfS0[1], pfS1[1], pfS2[1], pfS3[1]);
+			vZ = _mm_setr_ps(pfS0[2], pfS1[2], pfS2[2], pfS3[2]);
+		}
+		pnSource += nSourceStride*4;
+
+		// Transform and divide by the resulting w component
+		const __m128 vInvW = _mm_div_ps(_mm_set1_ps(1.0f), _mm_add_ps(_mm_add_ps(_mm_mul_ps(vWX, vX), _mm_mul_ps(vWY, vY)), _mm_add_ps(_mm_mul_ps(vWZ, vZ), vWW)));
+		__m128 vResultX = _mm_mul_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(vXX, vX), _mm_mul_ps(vXY, vY)), _mm_add_ps(_mm_mul_ps(vXZ, vZ), vXW)), vInvW);
+		__m128 vResultY = _mm_mul_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(vYX, vX), _mm_mul_ps(vYY, vY)), _mm_add_ps(_mm_mul_ps(vYZ, vZ), vYW)), vInvW);
+		__m128 vResultZ = _mm_mul_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(vZX, vX), _mm_mul_ps(vZY, vY)), _mm_add_ps(_mm_mul_ps(vZZ, vZ), vZW)), vInvW);
+
+		// Scatter the four transformed points
+		if (bTightlyPacked) {
+			// Shuffle back into (x0 y0 z0 x1) (y1 z1 x2 y2) (z2 x3 y3 z3)
+			float *pfD = reinterpret_cast<float*>(pnDestination);
+			_mm_storeu_ps(&pfD[0], _mm_shuffle_ps(_mm_shuffle_ps(vResultX, vResultY, _MM_SHUFFLE(0, 0, 0, 0)), _mm_shuffle_ps(vResultZ, vResultX, _MM_SHUFFLE(1, 1, 0, 0)), _MM_SHUFFLE(2, 0, 2, 0)));
+			_mm_storeu_ps(&pfD[4], _mm_shuffle_ps(_mm_shuffle_ps(vResultY, vResultZ, _MM_SHUFFLE(1, 1, 1, 1)), _mm_shuffle_ps(vResultX, vResultY, _MM_SHUFFLE(2, 2, 2, 2)), _MM_SHUFFLE(2, 0, 2, 0)));
+			_mm_storeu_ps(&pfD[8], _mm_shuffle_ps(_mm_shuffle_ps(vResultZ, vResultX, _MM_SHUFFLE(3, 3, 2, 2)), _mm_shuffle_ps(vResultY, vResultZ, _MM_SHUFFLE(3, 3, 3, 3)), _MM_SHUFFLE(2, 0, 2, 0)));
+		} else {
+			// After the transpose each SSE register holds one point
+			__m128 vResultW = _mm_setzero_ps();
+			_MM_TRANSPOSE4_PS(vResultX, vResultY, vResultZ, vResultW);
+			float *pfD = reinterpret_cast<float*>(pnDestination);
+			_mm_storel_pi(reinterpret_cast<__m64*>(pfD), vResultX);
+			_mm_store_ss(&pfD[2], _mm_movehl_ps(vResultX, vResultX));
+			pfD = reinterpret_cast<float*>(pnDestination + nDestinationStride);
+			_mm_storel_pi(reinterpret_cast<__m64*>(pfD), vResultY);
+			_mm_store_ss(&pfD[2], _mm_movehl_ps(vResultY, vResultY));
+			pfD = reinterpret_cast<float*>(pnDestination + nDestinationStride*2);
+			_mm_storel_pi(reinterpret_cast<__m64*>(pfD), vResultZ);
+			_mm_store_ss(&pfD[2], _mm_movehl_ps(vResultZ, vResultZ));
+			pfD = reinterpret_cast<float*>(pnDestination + nDestinationStride*3);
+			_mm_storel_pi(reinterpret_cast<__m64*>(pfD), vResultW);
+			_mm_store_ss(&pfD[2], _mm_movehl_ps(vResultW, vResultW));
+		}
+		pnDestination += nDestinationStride*4;
+	}
+#endif
+
+	// C++ method (also used for the remaining points of the SSE method)
+	for (; i<nNumOfPoints; i++, pnSource+=nSourceStride, pnDestination+=nDestinationStride) {
+		const float *pfS = reinterpret_cast<const float*>(pnSource);
+		const float x = pfS[0], y = pfS[1], z = pfS[2];
+		const float fInvW = 1.0f/(wx*x + wy*y + wz*z + ww);
+		float *pfD = reinterpret_cast<float*>(pnDestination);
+		pfD[0] = (xx*x + xy*y + xz*z + xw)*fInvW;
+		pfD[1] = (yx*x + yy*y + yz*z + yw)*fInvW;
+		pfD[2] = (zx*x + zy*y + zz*z + zw)*fInvW;
+	}
+}
+
 
 //[-------------------------------------------------------]
 //[ Scale                                                 ]
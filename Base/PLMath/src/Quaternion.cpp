@@ -30,6 +30,9 @@
 #include "PLMath/Matrix3x4.h"
 #include "PLMath/Matrix4x4.h"
 #include "PLMath/Quaternion.h"
+#ifdef PLMATH_SSE
+	#include <xmmintrin.h>
+#endif
 
 
 //[-------------------------------------------------------]
@@ -376,6 +379,23 @@ Quaternion &Quaternion::FromRotationMatrix(const Matrix4x4 &mRot)
 */
 void Quaternion::Slerp(const Quaternion &qQ1, const Quaternion &qQ2, float fTime)
 {
+#ifdef PLMATH_SSE
+	// SSE method: Both quaternions are stored as (w, x, y, z), so we can work on the four components at once
+	const __m128 vFrom = _mm_loadu_ps(qQ1.fQ);
+		  __m128 vTo   = _mm_loadu_ps(qQ2.fQ);
+
+	// Calc cosine
+	__m128 vCosom = _mm_mul_ps(vFrom, vTo);
+	vCosom = _mm_add_ps(vCosom, _mm_movehl_ps(vCosom, vCosom));
+	vCosom = _mm_add_ss(vCosom, _mm_shuffle_ps(vCosom, vCosom, _MM_SHUFFLE(1, 1, 1, 1)));
+	float fCosom = _mm_cvtss_f32(vCosom);
+
+	// Adjust signs (if necessary)
+	if (fCosom < 0.0f) {
+		fCosom = -fCosom;
+		vTo    = _mm_sub_ps(_mm_setzero_ps(), vTo);
+	}
+#else
 	// From
 	float fFrom[4] = { qQ1.fQ[W], qQ1.fQ[X], qQ1.fQ[Y], qQ1.fQ[Z] };
 
@@ -399,15 +419,16 @@ void Quaternion::Slerp(const Quaternion &qQ1, const Quaternion &qQ2, float fTime
 		fTo1[Y] = fTo[Y];
 		fTo1[Z] = fTo[Z];
 	}
+#endif
 
 	// Calculate coefficients
 	float fScale0, fScale1;
 	if ((1.0f-fCosom) > Math::Epsilon) {
-		// Standard case (slerp)
-		float fOmega = Math::ACos(fCosom);
-		float fSinom = Math::Sin(fOmega);
-		fScale0 = Math::Sin((1.0f - fTime)*fOmega)/fSinom;
-		fScale1 = Math::Sin(fTime*fOmega)/fSinom;
+		// Standard case (slerp), sin(acos(fCosom)) is the same as sqrt(1-fCosom^2)
+		const float fOmega    = Math::ACos(fCosom);
+		const float fInvSinom = 1.0f/Math::Sqrt(1.0f - fCosom*fCosom);
+		fScale0 = Math::Sin((1.0f - fTime)*fOmega)*fInvSinom;
+		fScale1 = Math::Sin(fTime*fOmega)*fInvSinom;
 	} else {
 		// "fFrom" and "fTo" quaternions are very close
 		//  ... so we can do a linear interpolation:
@@ -416,10 +437,14 @@ void Quaternion::Slerp(const Quaternion &qQ1, const Quaternion &qQ2, float fTime
 	}
 
 	// Calculate final values
+#ifdef PLMATH_SSE
+	_mm_storeu_ps(fQ, _mm_add_ps(_mm_mul_ps(_mm_set1_ps(fScale0), vFrom), _mm_mul_ps(_mm_set1_ps(fScale1), vTo)));
+#else
 	w = fScale0*fFrom[W] + fScale1*fTo1[W];
 	x = fScale0*fFrom[X] + fScale1*fTo1[X];
 	y = fScale0*fFrom[Y] + fScale1*fTo1[Y];
 	z = fScale0*fFrom[Z] + fScale1*fTo1[Z];
+#endif
 }
 
 /**
@@ -0,0 +1,224 @@
+/*********************************************************\
+ *  File: MeshFileMapped.h                               *
+ *
+ *  Copyright (C) 2002-2013 The PixelLight Team (http://www.pixellight.org/)
+ *
+ *  This file is part of PixelLight.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ *  and associated documentation files (the "Software"), to deal in the Software without
+ *  restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ *  Software is furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all copies or
+ *  substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ *  BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ *  DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ *  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+#ifndef __PLMESH_MESHFILEMAPPED_H__
+#define __PLMESH_MESHFILEMAPPED_H__
+#pragma once
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include "PLMesh/Loader/MeshFile.h"
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace PLMesh {
+
+
+//[-------------------------------------------------------]
+//[ Classes                                               ]
+//[-------------------------------------------------------]
+/**
+*  @brief
+*    PL memory mappable mesh file format (binary, Little-Endian)
+*
+*  @remarks
+*    Unlike the chunk based PL mesh file format (see 'MeshFile'), this format is designed to be
+*    used directly from a memory mapping of the file: The file starts with a fixed size header,
+*    all other data is referenced by byte offsets relative to the beginning of the file and
+*    every data block starts at an 'ALIGNMENT' byte boundary. Index and vertex data is stored
+*    exactly as the renderer expects it, so a loader can hand each data block over with a
+*    single copy instead of issuing many small reads. An offset of 0 means "no data".
+*
+*  @verbatim
+  PixelLight memory mappable mesh format description:
+
+	Header
+	|
+	+--Material names     char szName[256][nMaterials]
+	|
+	+--LOD levels         LODLevel[nLODLevels]
+	|  |
+	|  +--Geometries      MeshFile::Geometry[nGeometries]
+	|  |
+	|  +--Index data      'nIndices' indices of type 'nIndexElementType'
+	|
+	+--Morph targets      MorphTarget[nMorphTargets]
+	|  |
+	|  +--Vertex ID's     PLCore::uint32[nVertexIDs]
+	|  |
+	|  +--Attributes      MeshFile::VertexAttribute[nVertexAttributes]
+	|  |
+	|  +--Vertex data     'nVertices' vertices, 'nVertexSize' bytes
+	|
+	+--Weights            MeshFile::Weight[nWeights]
+	|
+	+--Vertex weights     VertexWeights[nVertexWeights]
+	|  |
+	|  +--Weight indices  PLCore::uint32[nWeights]
+	|
+	+--Skeletons          Skeleton[nSkeletons]
+	|  |
+	|  +--Joints          MeshFile::Joint[nJoints]
+	|  |
+	|  +--Base frame      MeshFile::JointState[nJoints]
+	|  |
+	|  +--Frame keys      float[nFrames*nAnimatedComponents]
+	|
+	+--Anchor points      MeshFile::AnchorPoint[nAnchorPoints]
+	|
+	+--Morph target animations MorphTargetAnimation[nMorphTargetAnimations]
+	   |
+	   +--Morph targets   char szName[64][nMorphTargets]
+	   |
+	   +--Frame keys      float[nFrames*nMorphTargets]
+   @endverbatim
+*/
+class MeshFileMapped {
+
+
+	//[-------------------------------------------------------]
+	//[ Constants                                             ]
+	//[-------------------------------------------------------]
+	public:
+		// Format definition
+		static const PLCore::uint32 MAGIC		= 0x57754D31;
+		static const PLCore::uint32 VERSION		= 1;
+		static const PLCore::uint32 ALIGNMENT	= 16;	/**< Alignment of every data block in bytes */
+
+
+	//[-------------------------------------------------------]
+	//[ File format structures                                ]
+	//[-------------------------------------------------------]
+	public:
+		/**
+		*  @brief
+		*    Main file header, always at offset 0
+		*/
+		struct Header {
+			PLCore::uint32 nMagic;							/**< File ID (see MAGIC above) */
+			PLCore::uint32 nVersion;						/**< File version (see VERSION above) */
+			PLCore::uint32 nFileSize;						/**< Total file size in bytes */
+			PLCore::uint32 nReserved;						/**< Reserved, must be 0 */
+			float		   fMin[3];							/**< Minimum mesh bounding box position */
+			float		   fMax[3];							/**< Maximum mesh bounding box position */
+			PLCore::uint32 nMaterials;						/**< Number of materials */
+			PLCore::uint32 nMaterialsOffset;				/**< Offset of the material names */
+			PLCore::uint32 nLODLevels;						/**< Number of LOD levels */
+			PLCore::uint32 nLODLevelsOffset;				/**< Offset of the LOD levels */
+			PLCore::uint32 nMorphTargets;					/**< Number of morph targets */
+			PLCore::uint32 nMorphTargetsOffset;				/**< Offset of the morph targets */
+			PLCore::uint32 nWeights;						/**< Total number of weights */
+			PLCore::uint32 nWeightsOffset;					/**< Offset of the weights */
+			PLCore::uint32 nVertexWeights;					/**< Number of vertices with weights */
+			PLCore::uint32 nVertexWeightsOffset;			/**< Offset of the vertex weights */
+			PLCore::uint32 nSkeletons;						/**< Number of skeletons */
+			PLCore::uint32 nSkeletonsOffset;				/**< Offset of the skeletons */
+			PLCore::uint32 nAnchorPoints;					/**< Number of anchor points */
+			PLCore::uint32 nAnchorPointsOffset;				/**< Offset of the anchor points */
+			PLCore::uint32 nMorphTargetAnimations;			/**< Number of morph target animations */
+			PLCore::uint32 nMorphTargetAnimationsOffset;	/**< Offset of the morph target animations */
+		};
+
+		/**
+		*  @brief
+		*    LOD level
+		*/
+		struct LODLevel {
+			float		   fDistance;				/**< Distance this LOD level is used */
+			PLCore::uint32 nOctreeSubdivide;		/**< Octree subdivide */
+			PLCore::uint32 nOctreeMinGeometries;	/**< Minimum number of geometries per octree */
+			PLCore::uint32 nGeometries;				/**< Number of geometries */
+			PLCore::uint32 nGeometriesOffset;		/**< Offset of the geometries */
+			PLCore::uint32 nIndexElementType;		/**< Index element type (see IndexBuffer::EType) */
+			PLCore::uint32 nIndices;				/**< Number of indices */
+			PLCore::uint32 nIndexSize;				/**< Total index data size in bytes */
+			PLCore::uint32 nIndexOffset;			/**< Offset of the index data, 0 if there's no index buffer */
+		};
+
+		/**
+		*  @brief
+		*    Morph target, including its vertex buffer
+		*/
+		struct MorphTarget {
+			char		   szName[64];					/**< Name of the morph target */
+			PLCore::uint32 nRelative;					/**< Is this morph target relative to the basis morph target? (0 or 1) */
+			PLCore::uint32 nVertexIDs;					/**< Number of vertex ID's, if 0 ALL vertices are influenced */
+			PLCore::uint32 nVertexIDsOffset;			/**< Offset of the vertex ID's */
+			PLCore::uint32 nVertexAttributes;			/**< Number of vertex attributes */
+			PLCore::uint32 nVertexAttributesOffset;		/**< Offset of the vertex attributes */
+			PLCore::uint32 nVertices;					/**< Number of vertices */
+			PLCore::uint32 nVertexSize;					/**< Total vertex data size in bytes */
+			PLCore::uint32 nVertexOffset;				/**< Offset of the vertex data */
+		};
+
+		/**
+		*  @brief
+		*    Vertex weights
+		*/
+		struct VertexWeights {
+			PLCore::uint32 nWeights;	/**< Number of weights for the vertex */
+			PLCore::uint32 nOffset;		/**< Offset of the weight indices */
+		};
+
+		/**
+		*  @brief
+		*    Skeleton
+		*/
+		struct Skeleton {
+			char		   szName[64];				/**< Name of the skeleton (animation) */
+			PLCore::uint32 nJoints;					/**< Number of joints the skeleton consists of */
+			PLCore::uint32 nJointsOffset;			/**< Offset of the joints */
+			PLCore::uint32 nBaseFrameOffset;		/**< Offset of the base frame joint states */
+			PLCore::uint32 nFrames;					/**< Number of skeleton animation frames */
+			PLCore::uint32 nAnimatedComponents;		/**< Total number of animated components per frame */
+			PLCore::uint32 nFrameKeysOffset;		/**< Offset of the frame keys */
+		};
+
+		/**
+		*  @brief
+		*    Morph target animation
+		*/
+		struct MorphTargetAnimation {
+			char		   szName[64];			/**< Name of the morph target animation */
+			PLCore::uint32 nMorphTargets;		/**< Number of morph targets */
+			PLCore::uint32 nMorphTargetsOffset;	/**< Offset of the morph target names */
+			PLCore::uint32 nFrames;				/**< Number of morph target animation frames */
+			PLCore::uint32 nFrameKeysOffset;	/**< Offset of the frame keys */
+		};
+
+
+};
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+} // PLMesh
+
+
+#endif // __PLMESH_MESHFILEMAPPED_H__
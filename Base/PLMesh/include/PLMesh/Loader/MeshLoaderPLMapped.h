@@ -0,0 +1,170 @@
+/*********************************************************\
+ *  File: MeshLoaderPLMapped.h                           *
+ *
+ *  Copyright (C) 2002-2013 The PixelLight Team (http://www.pixellight.org/)
+ *
+ *  This file is part of PixelLight.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ *  and associated documentation files (the "Software"), to deal in the Software without
+ *  restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ *  Software is furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all copies or
+ *  substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ *  BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ *  DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ *  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+#ifndef __PLMESH_MESHLOADER_PLMAPPED_H__
+#define __PLMESH_MESHLOADER_PLMAPPED_H__
+#pragma once
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include "PLMesh/Loader/MeshFileMapped.h"
+#include "PLMesh/Loader/MeshLoader.h"
+
+
+//[-------------------------------------------------------]
+//[ Forward declarations                                  ]
+//[-------------------------------------------------------]
+namespace PLCore {
+	class String;
+}
+namespace PLMesh {
+	class Mesh;
+	class Skeleton;
+}
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace PLMesh {
+
+
+//[-------------------------------------------------------]
+//[ Classes                                               ]
+//[-------------------------------------------------------]
+/**
+*  @brief
+*    Mesh loader implementation for the PixelLight memory mappable mesh binary (Little-Endian) file format
+*
+*  @remarks
+*    If the given file is not memory buffered, the loader opens it once more using 'PLCore::File::FileMemMap'
+*    and works directly on the memory mapping. Each index and vertex data block is copied into the
+*    locked renderer buffer at once, the structures are never read in small pieces. If memory mapping
+*    is not supported (e.g. files within a ZIP-file), the file is read into memory at once instead.
+*
+*  @see
+*    - MeshFileMapped
+*/
+class MeshLoaderPLMapped : public MeshLoader {
+
+
+	//[-------------------------------------------------------]
+	//[ RTTI interface                                        ]
+	//[-------------------------------------------------------]
+	pl_class(PLMESH_RTTI_EXPORT, MeshLoaderPLMapped, "PLMesh", PLMesh::MeshLoader, "Mesh loader implementation for the PixelLight memory mappable mesh binary (Little-Endian) file format")
+		// Properties
+		pl_properties
+			pl_property("Formats",	"mmesh,MMESH")
+			pl_property("Load",		"1")
+			pl_property("Save",		"1")
+		pl_properties_end
+		// Constructors
+		pl_constructor_0(DefaultConstructor,	"Default constructor",	"")
+		// Methods
+		pl_method_2(Load,		pl_ret_type(bool),	Mesh&,	PLCore::File&,			"Load method. The loaded mesh is static.",															"")
+		pl_method_3(LoadParams,	pl_ret_type(bool),	Mesh&,	PLCore::File&,	bool,	"Load method. Parameters: First 'bool' parameter determines whether or not the mesh is static.",	"")
+		pl_method_2(Save,		pl_ret_type(bool),	Mesh&,	PLCore::File&,			"Save method",																						"")
+	pl_class_end
+
+
+	//[-------------------------------------------------------]
+	//[ Public RTTI methods                                   ]
+	//[-------------------------------------------------------]
+	public:
+		PLMESH_API bool Load(Mesh &cMesh, PLCore::File &cFile);
+		PLMESH_API bool LoadParams(Mesh &cMesh, PLCore::File &cFile, bool bStatic);
+		PLMESH_API bool Save(Mesh &cMesh, PLCore::File &cFile);
+
+
+	//[-------------------------------------------------------]
+	//[ Public functions                                      ]
+	//[-------------------------------------------------------]
+	public:
+		/**
+		*  @brief
+		*    Default constructor
+		*/
+		PLMESH_API MeshLoaderPLMapped();
+
+		/**
+		*  @brief
+		*    Destructor
+		*/
+		PLMESH_API virtual ~MeshLoaderPLMapped();
+
+
+	//[-------------------------------------------------------]
+	//[ File loading                                          ]
+	//[-------------------------------------------------------]
+	private:
+		// File loading
+		bool ReadMeshFile(Mesh &cMesh, const PLCore::uint8 *pData, PLCore::uint32 nSize, bool bStatic) const;
+		bool ReadMaterials(Mesh &cMesh, const PLCore::uint8 *pData, PLCore::uint32 nSize, const MeshFileMapped::Header &sHeader) const;
+		bool ReadLODLevels(Mesh &cMesh, const PLCore::uint8 *pData, PLCore::uint32 nSize, const MeshFileMapped::Header &sHeader, bool bStatic) const;
+		bool ReadMorphTargets(Mesh &cMesh, const PLCore::uint8 *pData, PLCore::uint32 nSize, const MeshFileMapped::Header &sHeader, bool bStatic) const;
+		bool ReadWeights(Mesh &cMesh, const PLCore::uint8 *pData, PLCore::uint32 nSize, const MeshFileMapped::Header &sHeader) const;
+		bool ReadSkeletons(Mesh &cMesh, const PLCore::uint8 *pData, PLCore::uint32 nSize, const MeshFileMapped::Header &sHeader) const;
+		bool ReadAnchorPoints(Mesh &cMesh, const PLCore::uint8 *pData, PLCore::uint32 nSize, const MeshFileMapped::Header &sHeader) const;
+		bool ReadMorphTargetAnimations(Mesh &cMesh, const PLCore::uint8 *pData, PLCore::uint32 nSize, const MeshFileMapped::Header &sHeader) const;
+
+		// Tools
+		const void *GetBlock(const PLCore::uint8 *pData, PLCore::uint32 nSize, PLCore::uint32 nOffset, PLCore::uint32 nNumOfElements, PLCore::uint32 nElementSize) const;
+		PLCore::String GetName(const char *pszName, PLCore::uint32 nMaxLength) const;
+
+
+	//[-------------------------------------------------------]
+	//[ File saving                                           ]
+	//[-------------------------------------------------------]
+	private:
+		// File saving
+		bool WriteMeshFile(Mesh &cMesh, PLCore::File &cFile) const;
+		bool WriteMaterials(const Mesh &cMesh, PLCore::File &cFile, MeshFileMapped::Header &sHeader) const;
+		bool WriteLODLevels(Mesh &cMesh, PLCore::File &cFile, MeshFileMapped::Header &sHeader) const;
+		bool WriteMorphTargets(Mesh &cMesh, PLCore::File &cFile, MeshFileMapped::Header &sHeader) const;
+		bool WriteWeights(Mesh &cMesh, PLCore::File &cFile, MeshFileMapped::Header &sHeader) const;
+		bool WriteSkeletons(Mesh &cMesh, PLCore::File &cFile, MeshFileMapped::Header &sHeader) const;
+		bool WriteSkeleton(PLCore::File &cFile, Skeleton &cSkeleton, MeshFileMapped::Skeleton &sSkeleton) const;
+		bool WriteAnchorPoints(Mesh &cMesh, PLCore::File &cFile, MeshFileMapped::Header &sHeader) const;
+		bool WriteMorphTargetAnimations(Mesh &cMesh, PLCore::File &cFile, MeshFileMapped::Header &sHeader) const;
+
+		// Tools
+		bool Align(PLCore::File &cFile, PLCore::uint32 &nOffset) const;
+		bool Reserve(PLCore::File &cFile, PLCore::uint32 nSize, PLCore::uint32 &nOffset) const;
+		bool WriteBlock(PLCore::File &cFile, const void *pData, PLCore::uint32 nSize, PLCore::uint32 &nOffset) const;
+		bool WriteAt(PLCore::File &cFile, PLCore::uint32 nOffset, const void *pData, PLCore::uint32 nSize) const;
+		void SetName(char *pszName, PLCore::uint32 nMaxLength, const PLCore::String &sName) const;
+
+
+};
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+} // PLMesh
+
+
+#endif // __PLMESH_MESHLOADER_PLMAPPED_H__
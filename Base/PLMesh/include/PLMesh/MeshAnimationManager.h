@@ -188,6 +188,16 @@ class MeshAnimationManager : public PLRenderer::AnimationManager, public PLCore:
 		*/
 		PLMESH_API virtual bool Apply(MeshHandler &cMeshHandler) const;
 
+		/**
+		*  @brief
+		*    Called when the mesh of the owning mesh handler has been changed
+		*
+		*  @remarks
+		*    Derived mesh animation managers caching data of the mesh must drop this data within
+		*    this function. The default implementation does nothing.
+		*/
+		PLMESH_API virtual void OnMeshChange();
+
 
 	//[-------------------------------------------------------]
 	//[ Private data                                          ]
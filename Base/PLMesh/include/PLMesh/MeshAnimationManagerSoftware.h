@@ -30,21 +30,43 @@
 //[-------------------------------------------------------]
 //[ Includes                                              ]
 //[-------------------------------------------------------]
+#include <PLCore/Container/Array.h>
 #include "PLMesh/MeshAnimationManager.h"
 
 
+//[-------------------------------------------------------]
+//[ Forward declarations                                  ]
+//[-------------------------------------------------------]
+namespace PLRenderer {
+	class VertexBuffer;
+}
+
+
 //[-------------------------------------------------------]
 //[ Namespace                                             ]
 //[-------------------------------------------------------]
 namespace PLMesh {
 
 
+//[-------------------------------------------------------]
+//[ Forward declarations                                  ]
+//[-------------------------------------------------------]
+class Mesh;
+
+
 //[-------------------------------------------------------]
 //[ Classes                                               ]
 //[-------------------------------------------------------]
 /**
 *  @brief
 *    This is a software manager for the mesh animation element
+*
+*  @remarks
+*    The joint weights of the mesh are packed once into "structure of arrays" streams (one joint index and
+*    one bias stream per influence) so that the skinning loop doesn't have to walk through the weight objects.
+*    Per update the current joint transforms are written into a compact joint palette, the skinning itself
+*    is processing four vertices at once using SSE (if available) and large meshes are split into vertex
+*    ranges which are processed by the worker threads of the PLCore job system.
 */
 class MeshAnimationManagerSoftware : public MeshAnimationManager {
 
@@ -75,11 +97,189 @@ class MeshAnimationManagerSoftware : public MeshAnimationManager {
 		PLMESH_API virtual ~MeshAnimationManagerSoftware();
 
 
+	//[-------------------------------------------------------]
+	//[ Public static functions                               ]
+	//[-------------------------------------------------------]
+	public:
+		/**
+		*  @brief
+		*    Applies the current animation states of multiple mesh handlers at once
+		*
+		*  @param[in] lstMeshHandlers
+		*    Mesh handlers to apply the animation states to, null pointers are ignored, each mesh handler
+		*    must be within the list only once
+		*
+		*  @return
+		*    Number of mesh handlers the animation state was applied successfully to
+		*
+		*  @remarks
+		*    The skinning work of all given mesh handlers using a software mesh animation manager is collected
+		*    and split into vertex ranges which are processed in parallel by the worker threads of the PLCore job
+		*    system, this is more efficient than calling "Apply()" for many small meshes one after another.
+		*    Mesh handlers using another mesh animation manager are updated by calling their "Apply()".
+		*
+		*  @note
+		*    - Locking the vertex buffers and applying the morph targets is still done by the calling thread
+		*    - The mesh handlers must already own a vertex buffer (see "MeshHandler::GetVertexBuffer()"), this
+		*      is the case after the first "MeshHandler::Update()" of an animated mesh
+		*/
+		static PLMESH_API PLCore::uint32 ApplyMultiple(const PLCore::Array<MeshHandler*> &lstMeshHandlers);
+
+
 	//[-------------------------------------------------------]
 	//[ Public virtual MeshAnimationManager functions         ]
 	//[-------------------------------------------------------]
 	public:
 		PLMESH_API virtual bool Apply(MeshHandler &cMeshHandler) const override;
+		PLMESH_API virtual void OnMeshChange() override;
+
+
+	//[-------------------------------------------------------]
+	//[ Private definitions                                   ]
+	//[-------------------------------------------------------]
+	private:
+		/**
+		*  @brief
+		*    Skinning data of one mesh handler, only valid between "BeginApply()" and "EndApply()"
+		*
+		*  @remarks
+		*    The data is owned by the caller of "BeginApply()" and not by the mesh animation manager, so the
+		*    constant mesh animation manager doesn't carry any state from one apply to the next one besides
+		*    the joint weight stream cache.
+		*/
+		struct SkinningData {
+			const MeshAnimationManagerSoftware *pManager;			/**< Mesh animation manager owning the joint weight streams, always valid */
+			PLRenderer::VertexBuffer		   *pVertexBuffer;		/**< Locked original vertex buffer, can be a null pointer */
+			PLRenderer::VertexBuffer		   *pVertexBufferT;		/**< Locked mesh handler vertex buffer, can be a null pointer */
+			PLCore::uint32						nNumOfVertices;		/**< Number of vertices to skin */
+			PLCore::Array<float>				lstJointPalette;	/**< Row major 3x4 transform matrix per joint handler (12 floats), followed by an identity matrix */
+			bool								bSkinningRequired;	/**< Has the prepared mesh to be skinned? */
+		};
+
+		/**
+		*  @brief
+		*    Vertex range to skin, used to split the skinning work into jobs
+		*/
+		struct SkinningRange {
+			const SkinningData *pData;			/**< Skinning data the vertices belong to, always valid */
+			PLCore::uint32		nFirstVertex;	/**< Index of the first vertex to skin */
+			PLCore::uint32		nEndVertex;		/**< Index behind the last vertex to skin */
+		};
+
+
+	//[-------------------------------------------------------]
+	//[ Private static functions                              ]
+	//[-------------------------------------------------------]
+	private:
+		/**
+		*  @brief
+		*    Skins the vertices of the given prepared mesh handlers, in parallel if possible
+		*
+		*  @param[in] lstData
+		*    Skinning data prepared by "BeginApply()", all entries must require skinning
+		*/
+		static void Skin(const PLCore::Array<const SkinningData*> &lstData);
+
+		/**
+		*  @brief
+		*    Job system parallel for function skinning a range of skinning ranges
+		*
+		*  @param[in] nFirst
+		*    Index of the first skinning range
+		*  @param[in] nEnd
+		*    Index behind the last skinning range
+		*  @param[in] pData
+		*    Pointer to the first skinning range, always valid
+		*/
+		static void SkinRanges(PLCore::uint32 nFirst, PLCore::uint32 nEnd, void *pData);
+
+		/**
+		*  @brief
+		*    Skins a range of vertices of a prepared mesh handler
+		*
+		*  @param[in] sData
+		*    Skinning data prepared by "BeginApply()"
+		*  @param[in] nFirstVertex
+		*    Index of the first vertex to skin
+		*  @param[in] nEndVertex
+		*    Index behind the last vertex to skin
+		*
+		*  @note
+		*    - Only reads the skinning data and writes into the given vertex range, so different vertex
+		*      ranges can be skinned in parallel
+		*/
+		static void SkinVertices(const SkinningData &sData, PLCore::uint32 nFirstVertex, PLCore::uint32 nEndVertex);
+
+		/**
+		*  @brief
+		*    Unlocks the vertex buffers locked by "BeginApply()"
+		*
+		*  @param[in, out] sData
+		*    Skinning data prepared by "BeginApply()"
+		*/
+		static void EndApply(SkinningData &sData);
+
+
+	//[-------------------------------------------------------]
+	//[ Private functions                                     ]
+	//[-------------------------------------------------------]
+	private:
+		/**
+		*  @brief
+		*    Locks the vertex buffers, applies the morph targets and prepares the skinning data
+		*
+		*  @param[in]  cMeshHandler
+		*    Mesh handler to prepare
+		*  @param[out] sData
+		*    Receives the skinning data
+		*
+		*  @return
+		*    'true' if all went fine, else 'false' (the vertex buffers are not locked in this case)
+		*
+		*  @note
+		*    - On success, "SkinningData::bSkinningRequired" tells whether or not "SkinVertices()" has to be called
+		*    - On success, "EndApply()" must be called when the vertices are skinned
+		*/
+		bool BeginApply(MeshHandler &cMeshHandler, SkinningData &sData) const;
+
+		/**
+		*  @brief
+		*    Updates the joint index and bias streams
+		*
+		*  @param[in] cMesh
+		*    Mesh to build the streams for
+		*  @param[in] cVertexBuffer
+		*    Original vertex buffer of the mesh the streams are built for
+		*  @param[in] nNumOfVertices
+		*    Number of vertices to skin
+		*  @param[in] nNumOfJoints
+		*    Number of joint handlers, the joint palette entry behind the last joint is an identity transform
+		*
+		*  @note
+		*    - Only rebuilds the streams if the vertex buffer, the number of vertices, weights or joints has been changed
+		*/
+		void UpdateStreams(Mesh &cMesh, const PLRenderer::VertexBuffer &cVertexBuffer, PLCore::uint32 nNumOfVertices, PLCore::uint32 nNumOfJoints) const;
+
+		/**
+		*  @brief
+		*    Invalidates the joint index and bias streams
+		*/
+		void InvalidateStreams();
+
+
+	//[-------------------------------------------------------]
+	//[ Private data                                          ]
+	//[-------------------------------------------------------]
+	private:
+		// Joint weight stream cache, rebuilt only if the vertex buffer of the mesh has been changed and invalidated by "OnMeshChange()"
+		mutable const PLRenderer::VertexBuffer	   *m_pStreamVertexBuffer;		/**< Original vertex buffer the streams were built for, can be a null pointer, do not dereference */
+		mutable PLCore::uint32						m_nStreamNumOfVertices;		/**< Number of vertices the streams were built for */
+		mutable PLCore::uint32						m_nStreamNumOfWeights;		/**< Number of weights the streams were built for */
+		mutable PLCore::uint32						m_nStreamNumOfJoints;		/**< Number of joints the streams were built for */
+		mutable PLCore::uint32						m_nNumOfInfluences;			/**< Number of joint index and bias streams (= maximum number of weights per vertex) */
+		mutable PLCore::uint32						m_nStreamSize;				/**< Number of elements per stream (number of vertices rounded up to a multiple of four) */
+		mutable PLCore::Array<PLCore::uint32>		m_lstJointStream;			/**< Joint palette index streams, one stream per influence */
+		mutable PLCore::Array<float>				m_lstBiasStream;			/**< Bias streams, one stream per influence */
 
 
 };
@@ -0,0 +1,352 @@
+/*********************************************************\
+ *  File: MeshBVH.h                                      *
+ *
+ *  Copyright (C) 2002-2013 The PixelLight Team (http://www.pixellight.org/)
+ *
+ *  This file is part of PixelLight.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ *  and associated documentation files (the "Software"), to deal in the Software without
+ *  restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ *  Software is furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all copies or
+ *  substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ *  BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ *  DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ *  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+#ifndef __PLMESH_MESHBVH_H__
+#define __PLMESH_MESHBVH_H__
+#pragma once
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include <PLCore/Container/Array.h>
+#include <PLRenderer/Renderer/Types.h>
+#include "PLMesh/PLMesh.h"
+
+
+//[-------------------------------------------------------]
+//[ Forward declarations                                  ]
+//[-------------------------------------------------------]
+namespace PLCore {
+	class Bitset;
+}
+namespace PLMath {
+	class Vector3;
+}
+namespace PLRenderer {
+	class VertexBuffer;
+}
+namespace PLMesh {
+	class Geometry;
+	class MeshLODLevel;
+}
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace PLMesh {
+
+
+//[-------------------------------------------------------]
+//[ Classes                                               ]
+//[-------------------------------------------------------]
+/**
+*  @brief
+*    Mesh triangle bounding volume hierarchy
+*
+*  @remarks
+*    Bounding volume hierarchy over all triangles of a mesh LOD level, used to find the triangle intersecting a
+*    line without testing each and every triangle. The hierarchy is built by using the surface area heuristic
+*    and is stored within a flat node array, the leaves hold packs of four triangles which are tested at once.
+*    When only the vertex positions change (for example because of a mesh animation) but not the indices and
+*    geometries, the hierarchy can be refitted which is a lot cheaper than building it again.
+*/
+class MeshBVH {
+
+
+	//[-------------------------------------------------------]
+	//[ Public functions                                      ]
+	//[-------------------------------------------------------]
+	public:
+		/**
+		*  @brief
+		*    Constructor
+		*/
+		PLMESH_API MeshBVH();
+
+		/**
+		*  @brief
+		*    Destructor
+		*/
+		PLMESH_API ~MeshBVH();
+
+		/**
+		*  @brief
+		*    Builds the bounding volume hierarchy
+		*
+		*  @param[in] cMeshLODLevel
+		*    Mesh LOD level providing the index buffer and the geometries
+		*  @param[in] cVertexBuffer
+		*    Vertex buffer providing the vertex positions (three floats per position)
+		*
+		*  @return
+		*    'true' if all went fine, else 'false'
+		*/
+		PLMESH_API bool Build(const MeshLODLevel &cMeshLODLevel, PLRenderer::VertexBuffer &cVertexBuffer);
+
+		/**
+		*  @brief
+		*    Refits the bounding volume hierarchy to changed vertex positions
+		*
+		*  @param[in] cVertexBuffer
+		*    Vertex buffer providing the vertex positions, must have the same number of vertices as the one used for building
+		*
+		*  @return
+		*    'true' if all went fine, else 'false'
+		*
+		*  @note
+		*    - The hierarchy itself is not changed, so the quality of the hierarchy decreases when the vertex positions
+		*      differ a lot from the ones the hierarchy was built with
+		*/
+		PLMESH_API bool Refit(PLRenderer::VertexBuffer &cVertexBuffer);
+
+		/**
+		*  @brief
+		*    Clears the bounding volume hierarchy
+		*/
+		PLMESH_API void Clear();
+
+		/**
+		*  @brief
+		*    Returns the mesh LOD level the bounding volume hierarchy was built for
+		*
+		*  @return
+		*    The mesh LOD level the bounding volume hierarchy was built for, can be a null pointer, do not dereference
+		*/
+		PLMESH_API const MeshLODLevel *GetMeshLODLevel() const;
+
+		/**
+		*  @brief
+		*    Returns the vertex buffer the bounding volume hierarchy was built or refitted with
+		*
+		*  @return
+		*    The vertex buffer the bounding volume hierarchy was built or refitted with, can be a null pointer, do not dereference
+		*/
+		PLMESH_API const PLRenderer::VertexBuffer *GetVertexBuffer() const;
+
+		/**
+		*  @brief
+		*    Returns the number of nodes
+		*
+		*  @return
+		*    The number of nodes
+		*/
+		PLMESH_API PLCore::uint32 GetNumOfNodes() const;
+
+		/**
+		*  @brief
+		*    Returns the number of triangles
+		*
+		*  @return
+		*    The number of triangles
+		*/
+		PLMESH_API PLCore::uint32 GetNumOfTriangles() const;
+
+		/**
+		*  @brief
+		*    Returns the triangle intersecting the line which is nearest to the line start position
+		*
+		*  @param[in]  vLineStartPos
+		*    Line start position
+		*  @param[in]  vLineEndPos
+		*    Line end position
+		*  @param[in]  lstGeometries
+		*    Geometries of the mesh LOD level, inactive geometries are ignored
+		*  @param[in]  pGeometries
+		*    Bit set of the geometry indices to use, if a null pointer all geometries are used
+		*  @param[in]  nCull
+		*    Cull mode (see "PLRenderer::Cull")
+		*  @param[out] nTriangle
+		*    Will receive the ID of the found triangle within its geometry
+		*  @param[out] nGeometry
+		*    Will receive the owner geometry ID of the found triangle
+		*  @param[out] vCollisionPoint
+		*    Will receive the collision point
+		*
+		*  @return
+		*    'true' if a triangle was found, else 'false'
+		*
+		*  @note
+		*    - Just like "PLMath::Intersect::TriangleRay()" the line is handled as infinite line, the returned triangle
+		*      is the one with the intersection point nearest to the line start position in either direction
+		*/
+		PLMESH_API bool FindTriangle(const PLMath::Vector3 &vLineStartPos, const PLMath::Vector3 &vLineEndPos,
+									 const PLCore::Array<Geometry> &lstGeometries, const PLCore::Bitset *pGeometries,
+									 PLRenderer::Cull::Enum nCull, PLCore::uint32 &nTriangle, PLCore::uint32 &nGeometry,
+									 PLMath::Vector3 &vCollisionPoint) const;
+
+
+	//[-------------------------------------------------------]
+	//[ Private definitions                                   ]
+	//[-------------------------------------------------------]
+	private:
+		/**
+		*  @brief
+		*    Triangle
+		*/
+		struct Triangle {
+			PLCore::uint32 nGeometry;	/**< Owner geometry ID */
+			PLCore::uint32 nTriangle;	/**< Triangle ID within the owner geometry */
+			PLCore::uint32 nVertex[3];	/**< Vertex indices */
+
+			bool operator ==(const Triangle &sTriangle) const
+			{
+				return (nGeometry == sTriangle.nGeometry && nTriangle == sTriangle.nTriangle);
+			}
+		};
+
+		/**
+		*  @brief
+		*    Pack of four triangles, stored as structure of arrays so that all four triangles can be tested at once
+		*
+		*  @note
+		*    - Unused slots have zero edges and can never be hit
+		*/
+		struct TrianglePack {
+			float		   fV0[3][4];		/**< First vertex, x, y and z of the four triangles */
+			float		   fE1[3][4];		/**< Edge from the first to the second vertex */
+			float		   fE2[3][4];		/**< Edge from the first to the third vertex */
+			PLCore::uint32 nTriangle[4];	/**< Triangle indices */
+
+			bool operator ==(const TrianglePack &sTrianglePack) const
+			{
+				return (nTriangle[0] == sTrianglePack.nTriangle[0] && nTriangle[1] == sTrianglePack.nTriangle[1] &&
+						nTriangle[2] == sTrianglePack.nTriangle[2] && nTriangle[3] == sTrianglePack.nTriangle[3]);
+			}
+		};
+
+		/**
+		*  @brief
+		*    Node, the children of an inner node are stored next to each other and always behind their parent
+		*/
+		struct Node {
+			float		   fMin[3];			/**< Minimum bounding box position */
+			PLCore::uint32 nIndex;			/**< Index of the first child node (inner node) or the first triangle pack (leaf) */
+			float		   fMax[3];			/**< Maximum bounding box position */
+			PLCore::uint32 nNumOfTriangles;	/**< Number of triangles, 0 for inner nodes */
+
+			bool operator ==(const Node &sNode) const
+			{
+				return (nIndex == sNode.nIndex && nNumOfTriangles == sNode.nNumOfTriangles);
+			}
+		};
+
+		/**
+		*  @brief
+		*    Triangle build information
+		*/
+		struct BuildTriangle {
+			float		   fMin[3];		/**< Minimum bounding box position */
+			float		   fMax[3];		/**< Maximum bounding box position */
+			float		   fCenter[3];	/**< Bounding box center */
+			PLCore::uint32 nTriangle;	/**< Triangle index */
+
+			bool operator ==(const BuildTriangle &sBuildTriangle) const
+			{
+				return (nTriangle == sBuildTriangle.nTriangle);
+			}
+		};
+
+		static const PLCore::uint32 MaxDepth		 = 48;	/**< Maximum depth of the hierarchy */
+		static const PLCore::uint32 MaxLeafTriangles = 4;	/**< Maximum number of triangles within a leaf, unless the maximum depth was reached */
+		static const PLCore::uint32 NumOfBins		 = 16;	/**< Number of bins used to find the best split */
+
+
+	//[-------------------------------------------------------]
+	//[ Private functions                                     ]
+	//[-------------------------------------------------------]
+	private:
+		/**
+		*  @brief
+		*    Copy constructor
+		*
+		*  @param[in] cSource
+		*    Source to copy from
+		*/
+		MeshBVH(const MeshBVH &cSource);
+
+		/**
+		*  @brief
+		*    Copy operator
+		*
+		*  @param[in] cSource
+		*    Source to copy from
+		*
+		*  @return
+		*    Reference to this instance
+		*/
+		MeshBVH &operator =(const MeshBVH &cSource);
+
+		/**
+		*  @brief
+		*    Builds a node recursively
+		*
+		*  @param[in] nNode
+		*    Index of the node to build
+		*  @param[in] lstBuildTriangles
+		*    Triangle build information, the given range gets reordered
+		*  @param[in] nFirst
+		*    Index of the first triangle within the build information
+		*  @param[in] nNumOfTriangles
+		*    Number of triangles, must be greater than 0
+		*  @param[in] nDepth
+		*    Depth of the node
+		*/
+		void BuildNode(PLCore::uint32 nNode, PLCore::Array<BuildTriangle> &lstBuildTriangles, PLCore::uint32 nFirst, PLCore::uint32 nNumOfTriangles, PLCore::uint32 nDepth);
+
+		/**
+		*  @brief
+		*    Writes the vertex positions of the triangles into the triangle packs of all leaves and updates the node bounding boxes
+		*
+		*  @param[in] pFirstVertex
+		*    Pointer to the position of the first vertex
+		*  @param[in] nVertexSize
+		*    Size of a vertex in bytes
+		*/
+		void UpdatePositions(const char *pFirstVertex, PLCore::uint32 nVertexSize);
+
+
+	//[-------------------------------------------------------]
+	//[ Private data                                          ]
+	//[-------------------------------------------------------]
+	private:
+		const MeshLODLevel				*m_pMeshLODLevel;	/**< Mesh LOD level the hierarchy was built for, can be a null pointer, do not dereference */
+		const PLRenderer::VertexBuffer	*m_pVertexBuffer;	/**< Vertex buffer the hierarchy was built or refitted with, can be a null pointer, do not dereference */
+		PLCore::uint32					 m_nNumOfVertices;	/**< Number of vertices the hierarchy was built for */
+		PLCore::Array<Triangle>			 m_lstTriangles;	/**< Triangles */
+		PLCore::Array<TrianglePack>		 m_lstPacks;		/**< Triangle packs, referenced by the leaves */
+		PLCore::Array<Node>				 m_lstNodes;		/**< Nodes, the first node is the root */
+
+
+};
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+} // PLMesh
+
+
+#endif // __PLMESH_MESHBVH_H__
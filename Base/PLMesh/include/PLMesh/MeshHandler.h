@@ -62,6 +62,7 @@ namespace PLRenderer {
 }
 namespace PLMesh {
 	class Mesh;
+	class MeshBVH;
 	class MeshEdge;
 	class JointHandler;
 	class MeshTriangle;
@@ -161,6 +162,7 @@ class MeshHandler : public PLCore::ResourceHandler<Mesh> {
 		*      first load/setup a mesh and then use this function!
 		*    - After a mesh itself was manipulated, for instance the material list was
 		*      changed you should reset the mesh in your mesh handler!
+		*    - If the mesh is loading asynchronously, it's set again by "Update()" as soon as it's loaded
 		*/
 		PLMESH_API bool SetMesh(Mesh *pMesh = nullptr);
 
@@ -623,6 +625,9 @@ class MeshHandler : public PLCore::ResourceHandler<Mesh> {
 		*
 		*  @note
 		*    - The line is assumed to be in the object space of the mesh handlers mesh
+		*    - The triangles are found by using the triangle bounding volume hierarchy of the LOD level (see
+		*      "MeshLODLevel::GetBVH()"), if the mesh handler is animated an own hierarchy is built and refitted
+		*      whenever the animated vertex data has changed
 		*/
 		PLMESH_API bool FindTriangle(const PLMath::Vector3 &vLineStartPos,
 									 const PLMath::Vector3 &vLineEndPos,
@@ -754,6 +759,7 @@ class MeshHandler : public PLCore::ResourceHandler<Mesh> {
 
 		// Current stuff
 		bool					  m_bMeshUpdateRequired;		/**< Mesh update required */
+		bool					  m_bMeshLoading;				/**< Was the mesh loading asynchronously as it was set? */
 		PLCore::uint32			  m_nLOD;						/**< Current LOD level */
 		PLRenderer::VertexBuffer *m_pCurrentVertexBuffer;		/**< Current vertex buffer to use, can be a null pointer */
 		PLCore::Bitset			  m_cGeometryVisibility;		/**< Holds which geometry is visible and which not */
@@ -765,6 +771,8 @@ class MeshHandler : public PLCore::ResourceHandler<Mesh> {
 		// Precalculated data
 		bool						 m_bRecalculateTrianglePlanes;	/**< Do we need to recalculate the triangle planes? */
 		PLCore::Array<PLMath::Plane> m_lstTrianglePlanes;			/**< List of triangle planes */
+		mutable MeshBVH				*m_pBVH;						/**< Triangle bounding volume hierarchy for the mesh handler own vertex buffer, can be a null pointer */
+		mutable bool				 m_bRefitBVH;					/**< Do we need to refit the triangle bounding volume hierarchy? */
 
 
 };
@@ -43,6 +43,7 @@ namespace PLRenderer {
 	class VertexBuffer;
 }
 namespace PLMesh {
+	class MeshBVH;
 	class MeshOctree;
 }
 
@@ -252,6 +253,31 @@ class MeshLODLevel {
 		*/
 		PLMESH_API MeshOctree *GetOctree() const;
 
+		/**
+		*  @brief
+		*    Returns the LOD level triangle bounding volume hierarchy
+		*
+		*  @return
+		*    LOD level triangle bounding volume hierarchy, a null pointer if there are no triangles
+		*
+		*  @remarks
+		*    The bounding volume hierarchy is built on the first call by using the vertex buffer of the
+		*    base morph target of the owner mesh, it's used for fast triangle intersection tests like
+		*    within "MeshHandler::FindTriangle()". Changing the index buffer or the geometries through
+		*    this class destroys the hierarchy automatically.
+		*
+		*  @note
+		*    - If the vertex or index data is manipulated directly, call "DestroyBVH()" so that the
+		*      bounding volume hierarchy is built again the next time it's required
+		*/
+		PLMESH_API MeshBVH *GetBVH() const;
+
+		/**
+		*  @brief
+		*    Destroys the LOD level triangle bounding volume hierarchy
+		*/
+		PLMESH_API void DestroyBVH();
+
 		//[-------------------------------------------------------]
 		//[ Tool functions                                        ]
 		//[-------------------------------------------------------]
@@ -471,7 +497,8 @@ class MeshLODLevel {
 		PLCore::Array<Geometry> *m_plstGeometries;	/**< Geometries, can be a null pointer */
 
 		// Visibility
-		MeshOctree *m_pOctree;	/**< Octree for geometry visibility determination, can be a null pointer */
+		MeshOctree		*m_pOctree;	/**< Octree for geometry visibility determination, can be a null pointer */
+		mutable MeshBVH *m_pBVH;	/**< Triangle bounding volume hierarchy, built on demand, can be a null pointer */
 
 		// Precalculated data
 		PLCore::Array<MeshTriangle> m_lstTriangles;	/**< List of triangles */
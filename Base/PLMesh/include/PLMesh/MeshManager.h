@@ -148,6 +148,10 @@ class MeshManager : public PLCore::ResourceManager<Mesh> {
 		*
 		*  @return
 		*    The loaded mesh, a null pointer on error
+		*
+		*  @note
+		*    - If asynchronous loading is enabled (see "GetAsyncLoading()"), static meshes without load parameters
+		*      are loaded asynchronously by using "LoadResourceAsync()"
 		*/
 		PLMESH_API Mesh *LoadMesh(const PLCore::String &sFilename, const PLCore::String &sParams = "", const PLCore::String &sMethod = "", bool bReloadMesh = false, bool bStatic = true);
 
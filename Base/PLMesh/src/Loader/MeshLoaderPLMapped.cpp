@@ -0,0 +1,931 @@
+/*********************************************************\
+ *  File: MeshLoaderPLMapped.cpp                         *
+ *
+ *  Copyright (C) 2002-2013 The PixelLight Team (http://www.pixellight.org/)
+ *
+ *  This file is part of PixelLight.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ *  and associated documentation files (the "Software"), to deal in the Software without
+ *  restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ *  Software is furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all copies or
+ *  substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ *  BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ *  DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ *  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include <PLCore/File/File.h>
+#include <PLRenderer/RendererContext.h>
+#include <PLRenderer/Renderer/IndexBuffer.h>
+#include <PLRenderer/Renderer/VertexBuffer.h>
+#include <PLRenderer/Material/MaterialManager.h>
+#include "PLMesh/Mesh.h"
+#include "PLMesh/MeshOctree.h"
+#include "PLMesh/AnchorPoint.h"
+#include "PLMesh/MeshLODLevel.h"
+#include "PLMesh/MorphTargetAni.h"
+#include "PLMesh/SkeletonManager.h"
+#include "PLMesh/MeshMorphTarget.h"
+#include "PLMesh/Loader/MeshLoaderPLMapped.h"
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+using namespace PLCore;
+using namespace PLMath;
+using namespace PLRenderer;
+namespace PLMesh {
+
+
+//[-------------------------------------------------------]
+//[ RTTI interface                                        ]
+//[-------------------------------------------------------]
+pl_implement_class(MeshLoaderPLMapped)
+
+
+//[-------------------------------------------------------]
+//[ Public RTTI methods                                   ]
+//[-------------------------------------------------------]
+bool MeshLoaderPLMapped::Load(Mesh &cMesh, File &cFile)
+{
+	return LoadParams(cMesh, cFile, true);
+}
+
+bool MeshLoaderPLMapped::LoadParams(Mesh &cMesh, File &cFile, bool bStatic)
+{
+	// Is the given file already memory buffered?
+	const uint8 *pData = cFile.GetMemoryBuffer();
+	if (pData)
+		return ReadMeshFile(cMesh, pData, cFile.GetSize(), bStatic);
+
+	// Open the file once again, this time memory mapped (falls back to memory buffered if mapping is not supported)
+	File cMappedFile(cFile.GetUrl());
+	if (cMappedFile.Open(File::FileRead | File::FileMemMap)) {
+		const bool bResult = ReadMeshFile(cMesh, cMappedFile.GetMemoryBuffer(), cMappedFile.GetSize(), bStatic);
+
+		// Close the file, this also removes the memory mapping
+		cMappedFile.Close();
+
+		// Done
+		return bResult;
+	}
+
+	// Error!
+	return false;
+}
+
+bool MeshLoaderPLMapped::Save(Mesh &cMesh, File &cFile)
+{
+	// Write file
+	return WriteMeshFile(cMesh, cFile);
+}
+
+
+//[-------------------------------------------------------]
+//[ Public functions                                      ]
+//[-------------------------------------------------------]
+/**
+*  @brief
+*    Default constructor
+*/
+MeshLoaderPLMapped::MeshLoaderPLMapped()
+{
+}
+
+/**
+*  @brief
+*    Destructor
+*/
+MeshLoaderPLMapped::~MeshLoaderPLMapped()
+{
+}
+
+
+//[-------------------------------------------------------]
+//[ File loading                                          ]
+//[-------------------------------------------------------]
+bool MeshLoaderPLMapped::ReadMeshFile(Mesh &cMesh, const uint8 *pData, uint32 nSize, bool bStatic) const
+{
+	// Check the header
+	if (!pData || nSize < sizeof(MeshFileMapped::Header))
+		return false; // Error!
+	const MeshFileMapped::Header &sHeader = *reinterpret_cast<const MeshFileMapped::Header*>(pData);
+	if (sHeader.nMagic != MeshFileMapped::MAGIC || sHeader.nVersion != MeshFileMapped::VERSION || sHeader.nFileSize > nSize)
+		return false; // Error!
+
+	// Read the mesh data, all offsets are validated against the given size
+	if (ReadMaterials(cMesh, pData, nSize, sHeader) &&
+		ReadLODLevels(cMesh, pData, nSize, sHeader, bStatic) &&
+		ReadMorphTargets(cMesh, pData, nSize, sHeader, bStatic) &&
+		ReadWeights(cMesh, pData, nSize, sHeader) &&
+		ReadSkeletons(cMesh, pData, nSize, sHeader) &&
+		ReadAnchorPoints(cMesh, pData, nSize, sHeader) &&
+		ReadMorphTargetAnimations(cMesh, pData, nSize, sHeader)) {
+		// Set the mesh bounding box
+		cMesh.SetBoundingBox(Vector3(sHeader.fMin), Vector3(sHeader.fMax));
+
+		// Done
+		return true;
+	}
+
+	// Error!
+	return false;
+}
+
+bool MeshLoaderPLMapped::ReadMaterials(Mesh &cMesh, const uint8 *pData, uint32 nSize, const MeshFileMapped::Header &sHeader) const
+{
+	if (sHeader.nMaterials) {
+		const char *pszMaterials = static_cast<const char*>(GetBlock(pData, nSize, sHeader.nMaterialsOffset, sHeader.nMaterials, 256));
+		if (!pszMaterials)
+			return false; // Error!
+
+		// Get the material manager
+		MaterialManager &cMaterialManager = cMesh.GetRenderer()->GetRendererContext().GetMaterialManager();
+
+		// Load materials
+		for (uint32 i=0; i<sHeader.nMaterials; i++) {
+			const String sMaterial = GetName(&pszMaterials[i*256], 256);
+			Material *pMaterial = cMaterialManager.LoadResource(sMaterial);
+			cMesh.AddMaterial(pMaterial ? pMaterial : cMaterialManager.Create(sMaterial));
+		}
+	}
+
+	// Done
+	return true;
+}
+
+bool MeshLoaderPLMapped::ReadLODLevels(Mesh &cMesh, const uint8 *pData, uint32 nSize, const MeshFileMapped::Header &sHeader, bool bStatic) const
+{
+	if (sHeader.nLODLevels) {
+		const MeshFileMapped::LODLevel *pLODLevels = static_cast<const MeshFileMapped::LODLevel*>(GetBlock(pData, nSize, sHeader.nLODLevelsOffset, sHeader.nLODLevels, sizeof(MeshFileMapped::LODLevel)));
+		if (!pLODLevels)
+			return false; // Error!
+		for (uint32 i=0; i<sHeader.nLODLevels; i++) {
+			const MeshFileMapped::LODLevel &sLODLevel = pLODLevels[i];
+			MeshLODLevel *pLODLevel = cMesh.AddLODLevel();
+			if (!pLODLevel)
+				return false; // Error!
+			pLODLevel->SetLODDistance(sLODLevel.fDistance);
+
+			// The octree settings are only stored to be able to convert files without losing data,
+			// they are ignored by 'MeshLoaderPL' as well
+
+			// Index buffer
+			if (sLODLevel.nIndexOffset) {
+				const void *pIndexData = GetBlock(pData, nSize, sLODLevel.nIndexOffset, 1, sLODLevel.nIndexSize);
+				if (!pIndexData)
+					return false; // Error!
+				pLODLevel->CreateIndexBuffer();
+				IndexBuffer *pIndexBuffer = pLODLevel->GetIndexBuffer();
+				if (!pIndexBuffer)
+					return false; // Error!
+				pIndexBuffer->SetElementType(static_cast<IndexBuffer::EType>(sLODLevel.nIndexElementType));
+				pIndexBuffer->Allocate(sLODLevel.nIndices, bStatic ? Usage::Static : Usage::Dynamic);
+
+				// Copy the whole index data at once
+				if (pIndexBuffer->GetSize() != sLODLevel.nIndexSize)
+					return false; // Error!
+				void *pBufferData = pIndexBuffer->Lock(Lock::WriteOnly);
+				if (!pBufferData)
+					return false; // Error!
+				MemoryManager::Copy(pBufferData, pIndexData, sLODLevel.nIndexSize);
+				pIndexBuffer->Unlock();
+			}
+
+			// Geometries
+			if (sLODLevel.nGeometries) {
+				const MeshFile::Geometry *pGeometries = static_cast<const MeshFile::Geometry*>(GetBlock(pData, nSize, sLODLevel.nGeometriesOffset, sLODLevel.nGeometries, sizeof(MeshFile::Geometry)));
+				if (!pGeometries)
+					return false; // Error!
+				pLODLevel->CreateGeometries();
+				Array<Geometry> &lstGeometries = *pLODLevel->GetGeometries();
+				lstGeometries.Resize(sLODLevel.nGeometries);
+				for (uint32 nGeometry=0; nGeometry<sLODLevel.nGeometries; nGeometry++) {
+					const MeshFile::Geometry &sGeometry = pGeometries[nGeometry];
+					Geometry &cGeometry = lstGeometries[nGeometry];
+					cGeometry.SetName		  (GetName(sGeometry.szName, 64));
+					cGeometry.SetFlags		  (sGeometry.nFlags);
+					cGeometry.SetActive		  (sGeometry.bActive);
+					cGeometry.SetPrimitiveType(static_cast<Primitive::Enum>(sGeometry.nPrimitiveType));
+					cGeometry.SetMaterial	  (sGeometry.nMaterial);
+					cGeometry.SetStartIndex   (sGeometry.nStartIndex);
+					cGeometry.SetIndexSize	  (sGeometry.nIndexSize);
+				}
+			}
+		}
+	}
+
+	// Done
+	return true;
+}
+
+bool MeshLoaderPLMapped::ReadMorphTargets(Mesh &cMesh, const uint8 *pData, uint32 nSize, const MeshFileMapped::Header &sHeader, bool bStatic) const
+{
+	if (sHeader.nMorphTargets) {
+		const MeshFileMapped::MorphTarget *pMorphTargets = static_cast<const MeshFileMapped::MorphTarget*>(GetBlock(pData, nSize, sHeader.nMorphTargetsOffset, sHeader.nMorphTargets, sizeof(MeshFileMapped::MorphTarget)));
+		if (!pMorphTargets)
+			return false; // Error!
+		for (uint32 i=0; i<sHeader.nMorphTargets; i++) {
+			const MeshFileMapped::MorphTarget &sMorphTarget = pMorphTargets[i];
+			MeshMorphTarget *pMorphTarget = cMesh.AddMorphTarget();
+			if (!pMorphTarget)
+				return false; // Error!
+			pMorphTarget->SetName(GetName(sMorphTarget.szName, 64));
+			pMorphTarget->SetRelative(sMorphTarget.nRelative != 0);
+
+			// Vertex ID's
+			Array<uint32> &lstVertexIDs = pMorphTarget->GetVertexIDs();
+			if (sMorphTarget.nVertexIDs) {
+				const void *pVertexIDs = GetBlock(pData, nSize, sMorphTarget.nVertexIDsOffset, sMorphTarget.nVertexIDs, sizeof(uint32));
+				if (!pVertexIDs)
+					return false; // Error!
+				lstVertexIDs.Resize(sMorphTarget.nVertexIDs);
+				MemoryManager::Copy(lstVertexIDs.GetData(), pVertexIDs, sizeof(uint32)*sMorphTarget.nVertexIDs);
+			}
+
+			// Vertex attributes
+			VertexBuffer &cVertexBuffer = *pMorphTarget->GetVertexBuffer();
+			if (sMorphTarget.nVertexAttributes) {
+				const MeshFile::VertexAttribute *pVertexAttributes = static_cast<const MeshFile::VertexAttribute*>(GetBlock(pData, nSize, sMorphTarget.nVertexAttributesOffset, sMorphTarget.nVertexAttributes, sizeof(MeshFile::VertexAttribute)));
+				if (!pVertexAttributes)
+					return false; // Error!
+				for (uint32 nAttribute=0; nAttribute<sMorphTarget.nVertexAttributes; nAttribute++) {
+					const MeshFile::VertexAttribute &sVertexAttribute = pVertexAttributes[nAttribute];
+					cVertexBuffer.AddVertexAttribute(
+						static_cast<VertexBuffer::ESemantic>(sVertexAttribute.nSemantic),
+						sVertexAttribute.nChannel,
+						static_cast<VertexBuffer::EType>(sVertexAttribute.nType)
+					);
+				}
+			}
+
+			// Vertex data
+			if (sMorphTarget.nVertices) {
+				const void *pVertexData = GetBlock(pData, nSize, sMorphTarget.nVertexOffset, 1, sMorphTarget.nVertexSize);
+				if (!pVertexData)
+					return false; // Error!
+
+				// Allocate the vertex buffer, only the basis morph target is a renderer vertex buffer
+				cVertexBuffer.Allocate(sMorphTarget.nVertices, i ? Usage::Software : (bStatic ? Usage::Static : Usage::Dynamic));
+
+				// Copy the whole vertex data at once
+				if (cVertexBuffer.GetSize() != sMorphTarget.nVertexSize)
+					return false; // Error!
+				void *pBufferData = cVertexBuffer.Lock(Lock::WriteOnly);
+				if (!pBufferData)
+					return false; // Error!
+				MemoryManager::Copy(pBufferData, pVertexData, sMorphTarget.nVertexSize);
+				cVertexBuffer.Unlock();
+			}
+		}
+	}
+
+	// Done
+	return true;
+}
+
+bool MeshLoaderPLMapped::ReadWeights(Mesh &cMesh, const uint8 *pData, uint32 nSize, const MeshFileMapped::Header &sHeader) const
+{
+	// Weights
+	if (sHeader.nWeights) {
+		const MeshFile::Weight *pWeights = static_cast<const MeshFile::Weight*>(GetBlock(pData, nSize, sHeader.nWeightsOffset, sHeader.nWeights, sizeof(MeshFile::Weight)));
+		if (!pWeights)
+			return false; // Error!
+		Array<Weight> &lstWeights = cMesh.GetWeights();
+		lstWeights.Resize(sHeader.nWeights);
+		for (uint32 i=0; i<sHeader.nWeights; i++) {
+			lstWeights[i].SetJoint(pWeights[i].nJoint);
+			lstWeights[i].SetBias (pWeights[i].fBias);
+		}
+	}
+
+	// Vertex weights
+	if (sHeader.nVertexWeights) {
+		const MeshFileMapped::VertexWeights *pVertexWeights = static_cast<const MeshFileMapped::VertexWeights*>(GetBlock(pData, nSize, sHeader.nVertexWeightsOffset, sHeader.nVertexWeights, sizeof(MeshFileMapped::VertexWeights)));
+		if (!pVertexWeights)
+			return false; // Error!
+		Array<VertexWeights> &lstVertexWeights = cMesh.GetVertexWeights();
+		lstVertexWeights.Resize(sHeader.nVertexWeights);
+		for (uint32 i=0; i<sHeader.nVertexWeights; i++) {
+			const MeshFileMapped::VertexWeights &sVertexWeights = pVertexWeights[i];
+			if (sVertexWeights.nWeights) {
+				const void *pIndices = GetBlock(pData, nSize, sVertexWeights.nOffset, sVertexWeights.nWeights, sizeof(uint32));
+				if (!pIndices)
+					return false; // Error!
+				Array<uint32> &lstIndices = lstVertexWeights[i].GetWeights();
+				lstIndices.Resize(sVertexWeights.nWeights);
+				MemoryManager::Copy(lstIndices.GetData(), pIndices, sizeof(uint32)*sVertexWeights.nWeights);
+			}
+		}
+	}
+
+	// Done
+	return true;
+}
+
+bool MeshLoaderPLMapped::ReadSkeletons(Mesh &cMesh, const uint8 *pData, uint32 nSize, const MeshFileMapped::Header &sHeader) const
+{
+	if (sHeader.nSkeletons) {
+		const MeshFileMapped::Skeleton *pSkeletons = static_cast<const MeshFileMapped::Skeleton*>(GetBlock(pData, nSize, sHeader.nSkeletonsOffset, sHeader.nSkeletons, sizeof(MeshFileMapped::Skeleton)));
+		if (!pSkeletons)
+			return false; // Error!
+		for (uint32 i=0; i<sHeader.nSkeletons; i++) {
+			const MeshFileMapped::Skeleton &sSkeleton = pSkeletons[i];
+
+			// Get and check the data blocks of the skeleton
+			const MeshFile::Joint      *pJoints     = static_cast<const MeshFile::Joint*>     (GetBlock(pData, nSize, sSkeleton.nJointsOffset,    sSkeleton.nJoints, sizeof(MeshFile::Joint)));
+			const MeshFile::JointState *pBaseFrame  = static_cast<const MeshFile::JointState*>(GetBlock(pData, nSize, sSkeleton.nBaseFrameOffset, sSkeleton.nJoints, sizeof(MeshFile::JointState)));
+			const float			   *pfFrameKeys = static_cast<const float*>				  (GetBlock(pData, nSize, sSkeleton.nFrameKeysOffset, sSkeleton.nFrames, sizeof(float)*sSkeleton.nAnimatedComponents));
+			if (sSkeleton.nAnimatedComponents > nSize/sizeof(float) ||
+				(sSkeleton.nJoints && (!pJoints || !pBaseFrame)) || (sSkeleton.nFrames && sSkeleton.nAnimatedComponents && !pfFrameKeys))
+				return false; // Error!
+
+			// Create skeleton
+			Skeleton *pSkeleton = cMesh.GetSkeletonManager().Create(GetName(sSkeleton.szName, 64));
+			if (!pSkeleton)
+				return false; // Error!
+
+			// Add this skeleton to the skeleton list of the mesh
+			SkeletonHandler *pSkeletonHandler = new SkeletonHandler();
+			pSkeletonHandler->SetResource(pSkeleton);
+			cMesh.GetSkeletonHandlers().Add(pSkeletonHandler);
+
+			// Joints and base frame
+			Array<Skeleton::AniJoint> &lstJoints = pSkeleton->GetJoints();
+			lstJoints.Resize(sSkeleton.nJoints);
+			for (uint32 nJoint=0; nJoint<sSkeleton.nJoints; nJoint++) {
+				const MeshFile::Joint	   &sJoint		= pJoints[nJoint];
+				const MeshFile::JointState &cJointState = pBaseFrame[nJoint];
+				Joint *pJoint = pSkeleton->Create(GetName(sJoint.szName, 64));
+				pJoint->SetID(nJoint);
+				pJoint->SetParent(sJoint.nParent);
+				lstJoints[nJoint].nAnimatedComponents = sJoint.nAnimatedComponents;
+				pJoint->SetTranslation(Vector3(cJointState.fTranslation[0],
+					cJointState.fTranslation[1], cJointState.fTranslation[2]));
+				pJoint->SetRotation(Quaternion(cJointState.fRotation[0],
+					cJointState.fRotation[1], cJointState.fRotation[2], cJointState.fRotation[3]));
+				pJoint->SetTranslationJointSpace(Vector3(cJointState.fTranslationJointSpace[0],
+					cJointState.fTranslationJointSpace[1], cJointState.fTranslationJointSpace[2]));
+				pJoint->SetRotationJointSpace(Quaternion(cJointState.fRotationJointSpace[0],
+					cJointState.fRotationJointSpace[1], cJointState.fRotationJointSpace[2], cJointState.fRotationJointSpace[3]));
+			}
+
+			// Frame keys
+			Array<Skeleton::FrameKeys> &lstFrameKeys = pSkeleton->GetFrameKeys();
+			lstFrameKeys.Resize(sSkeleton.nFrames);
+			for (uint32 nFrame=0; nFrame<sSkeleton.nFrames; nFrame++) {
+				Array<float> &lstFrameKeysT = lstFrameKeys[nFrame].lstFrameKeys;
+				lstFrameKeysT.Resize(sSkeleton.nAnimatedComponents);
+				if (sSkeleton.nAnimatedComponents)
+					MemoryManager::Copy(lstFrameKeysT.GetData(), &pfFrameKeys[nFrame*sSkeleton.nAnimatedComponents], sizeof(float)*sSkeleton.nAnimatedComponents);
+			}
+			pSkeleton->SetEndFrame(sSkeleton.nFrames ? sSkeleton.nFrames-1 : 0);
+			pSkeleton->SetFlags(AnimationInfo::Loop);
+
+			// Update skeleton
+			pSkeleton->UpdateJointInformation();
+		}
+	}
+
+	// Done
+	return true;
+}
+
+bool MeshLoaderPLMapped::ReadAnchorPoints(Mesh &cMesh, const uint8 *pData, uint32 nSize, const MeshFileMapped::Header &sHeader) const
+{
+	if (sHeader.nAnchorPoints) {
+		const MeshFile::AnchorPoint *pAnchorPoints = static_cast<const MeshFile::AnchorPoint*>(GetBlock(pData, nSize, sHeader.nAnchorPointsOffset, sHeader.nAnchorPoints, sizeof(MeshFile::AnchorPoint)));
+		if (!pAnchorPoints)
+			return false; // Error!
+		for (uint32 i=0; i<sHeader.nAnchorPoints; i++) {
+			// Added into a manager automatically...
+			new AnchorPoint(GetName(pAnchorPoints[i].szName, 64), pAnchorPoints[i].bType, pAnchorPoints[i].nID, &cMesh.GetAnchorPointManager());
+		}
+	}
+
+	// Done
+	return true;
+}
+
+bool MeshLoaderPLMapped::ReadMorphTargetAnimations(Mesh &cMesh, const uint8 *pData, uint32 nSize, const MeshFileMapped::Header &sHeader) const
+{
+	if (sHeader.nMorphTargetAnimations) {
+		const MeshFileMapped::MorphTargetAnimation *pAnimations = static_cast<const MeshFileMapped::MorphTargetAnimation*>(GetBlock(pData, nSize, sHeader.nMorphTargetAnimationsOffset, sHeader.nMorphTargetAnimations, sizeof(MeshFileMapped::MorphTargetAnimation)));
+		if (!pAnimations)
+			return false; // Error!
+		for (uint32 i=0; i<sHeader.nMorphTargetAnimations; i++) {
+			const MeshFileMapped::MorphTargetAnimation &sAnimation = pAnimations[i];
+
+			// Get and check the data blocks of the morph target animation
+			const char  *pszNames	 = static_cast<const char*> (GetBlock(pData, nSize, sAnimation.nMorphTargetsOffset, sAnimation.nMorphTargets, 64));
+			const float *pfFrameKeys = static_cast<const float*>(GetBlock(pData, nSize, sAnimation.nFrameKeysOffset,	sAnimation.nFrames, sizeof(float)*sAnimation.nMorphTargets));
+			if (sAnimation.nMorphTargets > nSize/sizeof(float) ||
+				(sAnimation.nMorphTargets && (!pszNames || (sAnimation.nFrames && !pfFrameKeys))))
+				return false; // Error!
+
+			// Add morph target animation
+			MorphTargetAni *pAni = new MorphTargetAni(GetName(sAnimation.szName, 64), &cMesh.GetMorphTargetAnimationManager());
+
+			// Morph targets
+			pAni->GetMorphTargets().Resize(sAnimation.nMorphTargets);
+			for (uint32 nMorphTarget=0; nMorphTarget<sAnimation.nMorphTargets; nMorphTarget++)
+				pAni->GetMorphTargets()[nMorphTarget].sName = GetName(&pszNames[nMorphTarget*64], 64);
+
+			// Frame keys
+			Array<MorphTargetAni::FrameKeys> &lstFrameKeys = pAni->GetFrameKeys();
+			lstFrameKeys.Resize(sAnimation.nFrames);
+			for (uint32 nFrame=0; nFrame<sAnimation.nFrames; nFrame++) {
+				Array<float> &lstFrameKeysT = lstFrameKeys[nFrame].lstFrameKeys;
+				lstFrameKeysT.Resize(sAnimation.nMorphTargets);
+				if (sAnimation.nMorphTargets)
+					MemoryManager::Copy(lstFrameKeysT.GetData(), &pfFrameKeys[nFrame*sAnimation.nMorphTargets], sizeof(float)*sAnimation.nMorphTargets);
+			}
+			pAni->SetEndFrame(sAnimation.nFrames ? sAnimation.nFrames-1 : 0);
+			pAni->SetFlags(AnimationInfo::Loop);
+			pAni->SetType(1);
+		}
+	}
+
+	// Done
+	return true;
+}
+
+const void *MeshLoaderPLMapped::GetBlock(const uint8 *pData, uint32 nSize, uint32 nOffset, uint32 nNumOfElements, uint32 nElementSize) const
+{
+	// An offset of 0 means "no data" because the header is always at offset 0, use 64 bit to avoid overflows
+	const uint64 nEnd = static_cast<uint64>(nOffset) + static_cast<uint64>(nNumOfElements)*nElementSize;
+	return (nOffset && nEnd <= nSize) ? (pData + nOffset) : nullptr;
+}
+
+String MeshLoaderPLMapped::GetName(const char *pszName, uint32 nMaxLength) const
+{
+	// The name is not required to be terminated if it's using the complete available space
+	uint32 nLength = 0;
+	while (nLength < nMaxLength && pszName[nLength] != '\0')
+		nLength++;
+	return String(pszName, true, nLength);
+}
+
+
+//[-------------------------------------------------------]
+//[ File saving                                           ]
+//[-------------------------------------------------------]
+bool MeshLoaderPLMapped::WriteMeshFile(Mesh &cMesh, File &cFile) const
+{
+	// Write an empty header, it's written once again as soon as all offsets are known
+	MeshFileMapped::Header sHeader;
+	MemoryManager::Set(&sHeader, 0, sizeof(sHeader));
+	if (cFile.Write(&sHeader, 1, sizeof(sHeader))) {
+		// Write mesh data
+		if (WriteMaterials(cMesh, cFile, sHeader) &&
+			WriteLODLevels(cMesh, cFile, sHeader) &&
+			WriteMorphTargets(cMesh, cFile, sHeader) &&
+			WriteWeights(cMesh, cFile, sHeader) &&
+			WriteSkeletons(cMesh, cFile, sHeader) &&
+			WriteAnchorPoints(cMesh, cFile, sHeader) &&
+			WriteMorphTargetAnimations(cMesh, cFile, sHeader)) {
+			// Setup the header
+			Vector3 vMin, vMax;
+			cMesh.GetBoundingBox(vMin, vMax);
+			sHeader.nMagic    = MeshFileMapped::MAGIC;
+			sHeader.nVersion  = MeshFileMapped::VERSION;
+			sHeader.nFileSize = cFile.Tell();
+			sHeader.fMin[0]   = vMin.x;
+			sHeader.fMin[1]   = vMin.y;
+			sHeader.fMin[2]   = vMin.z;
+			sHeader.fMax[0]   = vMax.x;
+			sHeader.fMax[1]   = vMax.y;
+			sHeader.fMax[2]   = vMax.z;
+
+			// Write the final header
+			return WriteAt(cFile, 0, &sHeader, sizeof(sHeader));
+		}
+	}
+
+	// Error!
+	return false;
+}
+
+bool MeshLoaderPLMapped::WriteMaterials(const Mesh &cMesh, File &cFile, MeshFileMapped::Header &sHeader) const
+{
+	sHeader.nMaterials = cMesh.GetNumOfMaterials();
+	if (sHeader.nMaterials) {
+		if (!Align(cFile, sHeader.nMaterialsOffset))
+			return false; // Error!
+		char szMaterial[256];
+		for (uint32 i=0; i<sHeader.nMaterials; i++) {
+			SetName(szMaterial, 256, cMesh.GetMaterial(i)->GetName());
+			if (!cFile.Write(szMaterial, 1, 256))
+				return false; // Error!
+		}
+	}
+
+	// Done
+	return true;
+}
+
+bool MeshLoaderPLMapped::WriteLODLevels(Mesh &cMesh, File &cFile, MeshFileMapped::Header &sHeader) const
+{
+	sHeader.nLODLevels = cMesh.GetNumOfLODLevels();
+	if (sHeader.nLODLevels) {
+		// Reserve the LOD levels, they are written as soon as the offsets of their data are known
+		if (!Reserve(cFile, sizeof(MeshFileMapped::LODLevel)*sHeader.nLODLevels, sHeader.nLODLevelsOffset))
+			return false; // Error!
+		for (uint32 i=0; i<sHeader.nLODLevels; i++) {
+			MeshLODLevel &cLODLevel = *cMesh.GetLODLevel(i);
+			MeshFileMapped::LODLevel sLODLevel;
+			MemoryManager::Set(&sLODLevel, 0, sizeof(sLODLevel));
+			sLODLevel.fDistance = cLODLevel.GetLODDistance();
+			if (cLODLevel.GetOctree()) {
+				sLODLevel.nOctreeSubdivide     = cLODLevel.GetOctree()->GetSubdivide();
+				sLODLevel.nOctreeMinGeometries = cLODLevel.GetOctree()->GetMinGeometries();
+			}
+
+			// Write index data
+			IndexBuffer *pIndexBuffer = cLODLevel.GetIndexBuffer();
+			if (pIndexBuffer) {
+				sLODLevel.nIndexElementType = pIndexBuffer->GetElementType();
+				sLODLevel.nIndices			= pIndexBuffer->GetNumOfElements();
+				sLODLevel.nIndexSize		= pIndexBuffer->GetSize();
+				const void *pIndexData = pIndexBuffer->Lock(Lock::ReadOnly);
+				if (!pIndexData)
+					return false; // Error!
+				const bool bResult = WriteBlock(cFile, pIndexData, sLODLevel.nIndexSize, sLODLevel.nIndexOffset);
+				pIndexBuffer->Unlock();
+				if (!bResult)
+					return false; // Error!
+			}
+
+			// Write geometries
+			Array<Geometry> *plstGeometries = cLODLevel.GetGeometries();
+			sLODLevel.nGeometries = plstGeometries ? plstGeometries->GetNumOfElements() : 0;
+			if (sLODLevel.nGeometries) {
+				if (!Align(cFile, sLODLevel.nGeometriesOffset))
+					return false; // Error!
+				for (uint32 nGeometry=0; nGeometry<sLODLevel.nGeometries; nGeometry++) {
+					const Geometry &cGeometry = plstGeometries->Get(nGeometry);
+					MeshFile::Geometry sGeometry;
+					MemoryManager::Set(&sGeometry, 0, sizeof(sGeometry));
+					SetName(sGeometry.szName, 64, cGeometry.GetName());
+					sGeometry.nFlags		 = cGeometry.GetFlags();
+					sGeometry.bActive		 = cGeometry.IsActive();
+					sGeometry.nPrimitiveType = cGeometry.GetPrimitiveType();
+					sGeometry.nMaterial		 = cGeometry.GetMaterial();
+					sGeometry.nStartIndex	 = cGeometry.GetStartIndex();
+					sGeometry.nIndexSize	 = cGeometry.GetIndexSize();
+					if (!cFile.Write(&sGeometry, 1, sizeof(sGeometry)))
+						return false; // Error!
+				}
+			}
+
+			// Write LOD level
+			if (!WriteAt(cFile, sHeader.nLODLevelsOffset + i*sizeof(MeshFileMapped::LODLevel), &sLODLevel, sizeof(sLODLevel)))
+				return false; // Error!
+		}
+	}
+
+	// Done
+	return true;
+}
+
+bool MeshLoaderPLMapped::WriteMorphTargets(Mesh &cMesh, File &cFile, MeshFileMapped::Header &sHeader) const
+{
+	sHeader.nMorphTargets = cMesh.GetNumOfMorphTargets();
+	if (sHeader.nMorphTargets) {
+		// Reserve the morph targets, they are written as soon as the offsets of their data are known
+		if (!Reserve(cFile, sizeof(MeshFileMapped::MorphTarget)*sHeader.nMorphTargets, sHeader.nMorphTargetsOffset))
+			return false; // Error!
+		for (uint32 i=0; i<sHeader.nMorphTargets; i++) {
+			MeshMorphTarget &cMorphTarget = *cMesh.GetMorphTarget(i);
+			MeshFileMapped::MorphTarget sMorphTarget;
+			MemoryManager::Set(&sMorphTarget, 0, sizeof(sMorphTarget));
+			SetName(sMorphTarget.szName, 64, cMorphTarget.GetName());
+			sMorphTarget.nRelative = cMorphTarget.IsRelative();
+
+			// Write vertex ID's
+			Array<uint32> &lstVertexIDs = cMorphTarget.GetVertexIDs();
+			sMorphTarget.nVertexIDs = lstVertexIDs.GetNumOfElements();
+			if (!WriteBlock(cFile, lstVertexIDs.GetData(), sizeof(uint32)*sMorphTarget.nVertexIDs, sMorphTarget.nVertexIDsOffset))
+				return false; // Error!
+
+			// Write vertex attributes
+			VertexBuffer &cVertexBuffer = *cMorphTarget.GetVertexBuffer();
+			sMorphTarget.nVertexAttributes = cVertexBuffer.GetNumOfVertexAttributes();
+			if (sMorphTarget.nVertexAttributes) {
+				if (!Align(cFile, sMorphTarget.nVertexAttributesOffset))
+					return false; // Error!
+				for (uint32 nAttribute=0; nAttribute<sMorphTarget.nVertexAttributes; nAttribute++) {
+					const VertexBuffer::Attribute &cVertexAttribute = *cVertexBuffer.GetVertexAttribute(nAttribute);
+					MeshFile::VertexAttribute sVertexAttribute;
+					sVertexAttribute.nSemantic = cVertexAttribute.nSemantic;
+					sVertexAttribute.nChannel  = cVertexAttribute.nChannel;
+					sVertexAttribute.nType     = cVertexAttribute.nType;
+					if (!cFile.Write(&sVertexAttribute, 1, sizeof(sVertexAttribute)))
+						return false; // Error!
+				}
+			}
+
+			// Write vertex data
+			sMorphTarget.nVertices   = cVertexBuffer.GetNumOfElements();
+			sMorphTarget.nVertexSize = cVertexBuffer.GetSize();
+			if (sMorphTarget.nVertices) {
+				const void *pVertexData = cVertexBuffer.Lock(Lock::ReadOnly);
+				if (!pVertexData)
+					return false; // Error!
+				const bool bResult = WriteBlock(cFile, pVertexData, sMorphTarget.nVertexSize, sMorphTarget.nVertexOffset);
+				cVertexBuffer.Unlock();
+				if (!bResult)
+					return false; // Error!
+			}
+
+			// Write morph target
+			if (!WriteAt(cFile, sHeader.nMorphTargetsOffset + i*sizeof(MeshFileMapped::MorphTarget), &sMorphTarget, sizeof(sMorphTarget)))
+				return false; // Error!
+		}
+	}
+
+	// Done
+	return true;
+}
+
+bool MeshLoaderPLMapped::WriteWeights(Mesh &cMesh, File &cFile, MeshFileMapped::Header &sHeader) const
+{
+	// Write weights
+	const Array<Weight> &lstWeights = cMesh.GetWeights();
+	sHeader.nWeights = lstWeights.GetNumOfElements();
+	if (sHeader.nWeights) {
+		if (!Align(cFile, sHeader.nWeightsOffset))
+			return false; // Error!
+		for (uint32 i=0; i<sHeader.nWeights; i++) {
+			MeshFile::Weight sWeight;
+			sWeight.nJoint = lstWeights[i].GetJoint();
+			sWeight.fBias  = lstWeights[i].GetBias();
+			if (!cFile.Write(&sWeight, 1, sizeof(sWeight)))
+				return false; // Error!
+		}
+	}
+
+	// Write vertex weights
+	Array<VertexWeights> &lstVertexWeights = cMesh.GetVertexWeights();
+	sHeader.nVertexWeights = lstVertexWeights.GetNumOfElements();
+	if (sHeader.nVertexWeights) {
+		// Reserve the vertex weights, they are written as soon as the offsets of their data are known
+		if (!Reserve(cFile, sizeof(MeshFileMapped::VertexWeights)*sHeader.nVertexWeights, sHeader.nVertexWeightsOffset))
+			return false; // Error!
+		for (uint32 i=0; i<sHeader.nVertexWeights; i++) {
+			Array<uint32> &lstIndices = lstVertexWeights[i].GetWeights();
+			MeshFileMapped::VertexWeights sVertexWeights;
+			sVertexWeights.nWeights = lstIndices.GetNumOfElements();
+			if (!WriteBlock(cFile, lstIndices.GetData(), sizeof(uint32)*sVertexWeights.nWeights, sVertexWeights.nOffset) ||
+				!WriteAt(cFile, sHeader.nVertexWeightsOffset + i*sizeof(MeshFileMapped::VertexWeights), &sVertexWeights, sizeof(sVertexWeights)))
+				return false; // Error!
+		}
+	}
+
+	// Done
+	return true;
+}
+
+bool MeshLoaderPLMapped::WriteSkeletons(Mesh &cMesh, File &cFile, MeshFileMapped::Header &sHeader) const
+{
+	Array<SkeletonHandler*> &lstSkeletonHandlers = cMesh.GetSkeletonHandlers();
+	sHeader.nSkeletons = lstSkeletonHandlers.GetNumOfElements();
+	if (sHeader.nSkeletons) {
+		// Reserve the skeletons, they are written as soon as the offsets of their data are known
+		if (!Reserve(cFile, sizeof(MeshFileMapped::Skeleton)*sHeader.nSkeletons, sHeader.nSkeletonsOffset))
+			return false; // Error!
+		for (uint32 i=0; i<sHeader.nSkeletons; i++) {
+			Skeleton *pSkeleton = lstSkeletonHandlers[i]->GetResource();
+			MeshFileMapped::Skeleton sSkeleton;
+			MemoryManager::Set(&sSkeleton, 0, sizeof(sSkeleton));
+			if (!pSkeleton || !WriteSkeleton(cFile, *pSkeleton, sSkeleton) ||
+				!WriteAt(cFile, sHeader.nSkeletonsOffset + i*sizeof(MeshFileMapped::Skeleton), &sSkeleton, sizeof(sSkeleton)))
+				return false; // Error!
+		}
+	}
+
+	// Done
+	return true;
+}
+
+bool MeshLoaderPLMapped::WriteSkeleton(File &cFile, Skeleton &cSkeleton, MeshFileMapped::Skeleton &sSkeleton) const
+{
+	SetName(sSkeleton.szName, 64, cSkeleton.GetName());
+	sSkeleton.nJoints = cSkeleton.GetNumOfElements();
+	if (sSkeleton.nJoints) {
+		// Write joints
+		if (!Align(cFile, sSkeleton.nJointsOffset))
+			return false; // Error!
+		for (uint32 i=0; i<sSkeleton.nJoints; i++) {
+			const Joint *pJoint = cSkeleton.GetByIndex(i);
+			MeshFile::Joint sJoint;
+			MemoryManager::Set(&sJoint, 0, sizeof(sJoint));
+			SetName(sJoint.szName, 64, pJoint->GetName());
+			sJoint.nParent             = pJoint->GetParent();
+			sJoint.nAnimatedComponents = cSkeleton.GetJoints()[i].nAnimatedComponents;
+			if (!cFile.Write(&sJoint, 1, sizeof(sJoint)))
+				return false; // Error!
+		}
+
+		// Write base frame
+		if (!Align(cFile, sSkeleton.nBaseFrameOffset))
+			return false; // Error!
+		for (uint32 i=0; i<sSkeleton.nJoints; i++) {
+			const Joint *pJoint = cSkeleton.GetByIndex(i);
+			MeshFile::JointState cJointState;
+			{ // Current
+				const Vector3 &vV = pJoint->GetTranslation();
+				cJointState.fTranslation[0] = vV.x;
+				cJointState.fTranslation[1] = vV.y;
+				cJointState.fTranslation[2] = vV.z;
+				const Quaternion &qQ = pJoint->GetRotation();
+				cJointState.fRotation[0] = qQ.w;
+				cJointState.fRotation[1] = qQ.x;
+				cJointState.fRotation[2] = qQ.y;
+				cJointState.fRotation[3] = qQ.z;
+			}
+			{ // Joint space
+				const Vector3 &vV = pJoint->GetTranslationJointSpace();
+				cJointState.fTranslationJointSpace[0] = vV.x;
+				cJointState.fTranslationJointSpace[1] = vV.y;
+				cJointState.fTranslationJointSpace[2] = vV.z;
+				const Quaternion &qQ = pJoint->GetRotationJointSpace();
+				cJointState.fRotationJointSpace[0] = qQ.w;
+				cJointState.fRotationJointSpace[1] = qQ.x;
+				cJointState.fRotationJointSpace[2] = qQ.y;
+				cJointState.fRotationJointSpace[3] = qQ.z;
+			}
+			if (!cFile.Write(&cJointState, 1, sizeof(cJointState)))
+				return false; // Error!
+		}
+	}
+
+	// Write frame keys, all frames have the same number of animated components
+	const Array<AnimationBase::FrameKeys> &lstFrameKeys = cSkeleton.GetFrameKeys();
+	sSkeleton.nFrames = lstFrameKeys.GetNumOfElements();
+	if (sSkeleton.nFrames) {
+		sSkeleton.nAnimatedComponents = lstFrameKeys[0].lstFrameKeys.GetNumOfElements();
+		if (sSkeleton.nAnimatedComponents) {
+			if (!Align(cFile, sSkeleton.nFrameKeysOffset))
+				return false; // Error!
+			for (uint32 i=0; i<sSkeleton.nFrames; i++) {
+				const Array<float> &lstFrameKeysT = lstFrameKeys[i].lstFrameKeys;
+				if (lstFrameKeysT.GetNumOfElements() != sSkeleton.nAnimatedComponents || !cFile.Write(lstFrameKeysT.GetData(), 1, sizeof(float)*sSkeleton.nAnimatedComponents))
+					return false; // Error!
+			}
+		}
+	}
+
+	// Done
+	return true;
+}
+
+bool MeshLoaderPLMapped::WriteAnchorPoints(Mesh &cMesh, File &cFile, MeshFileMapped::Header &sHeader) const
+{
+	sHeader.nAnchorPoints = cMesh.GetAnchorPointManager().GetNumOfElements();
+	if (sHeader.nAnchorPoints) {
+		if (!Align(cFile, sHeader.nAnchorPointsOffset))
+			return false; // Error!
+		for (uint32 i=0; i<sHeader.nAnchorPoints; i++) {
+			const AnchorPoint *pAnchorPoint = cMesh.GetAnchorPointManager().GetByIndex(i);
+			MeshFile::AnchorPoint sAnchorPoint;
+			MemoryManager::Set(&sAnchorPoint, 0, sizeof(sAnchorPoint));
+			SetName(sAnchorPoint.szName, 64, pAnchorPoint->GetName());
+			sAnchorPoint.bType = pAnchorPoint->GetType();
+			sAnchorPoint.nID   = pAnchorPoint->GetID();
+			if (!cFile.Write(&sAnchorPoint, 1, sizeof(sAnchorPoint)))
+				return false; // Error!
+		}
+	}
+
+	// Done
+	return true;
+}
+
+bool MeshLoaderPLMapped::WriteMorphTargetAnimations(Mesh &cMesh, File &cFile, MeshFileMapped::Header &sHeader) const
+{
+	MorphTargetAniManager &cManager = cMesh.GetMorphTargetAnimationManager();
+	sHeader.nMorphTargetAnimations = cManager.GetNumOfElements();
+	if (sHeader.nMorphTargetAnimations) {
+		// Reserve the morph target animations, they are written as soon as the offsets of their data are known
+		if (!Reserve(cFile, sizeof(MeshFileMapped::MorphTargetAnimation)*sHeader.nMorphTargetAnimations, sHeader.nMorphTargetAnimationsOffset))
+			return false; // Error!
+		for (uint32 i=0; i<sHeader.nMorphTargetAnimations; i++) {
+			MorphTargetAni *pAni = cManager.GetByIndex(i);
+			MeshFileMapped::MorphTargetAnimation sAnimation;
+			MemoryManager::Set(&sAnimation, 0, sizeof(sAnimation));
+			SetName(sAnimation.szName, 64, pAni->GetName());
+
+			// Write morph target names
+			sAnimation.nMorphTargets = pAni->GetMorphTargets().GetNumOfElements();
+			if (sAnimation.nMorphTargets) {
+				if (!Align(cFile, sAnimation.nMorphTargetsOffset))
+					return false; // Error!
+				char szName[64];
+				for (uint32 nMorphTarget=0; nMorphTarget<sAnimation.nMorphTargets; nMorphTarget++) {
+					SetName(szName, 64, pAni->GetMorphTargets()[nMorphTarget].sName);
+					if (!cFile.Write(szName, 1, 64))
+						return false; // Error!
+				}
+			}
+
+			// Write frame keys, there's one key per morph target
+			const Array<MorphTargetAni::FrameKeys> &lstFrameKeys = pAni->GetFrameKeys();
+			sAnimation.nFrames = lstFrameKeys.GetNumOfElements();
+			if (sAnimation.nFrames && sAnimation.nMorphTargets) {
+				if (!Align(cFile, sAnimation.nFrameKeysOffset))
+					return false; // Error!
+				for (uint32 nFrame=0; nFrame<sAnimation.nFrames; nFrame++) {
+					const Array<float> &lstFrameKeysT = lstFrameKeys[nFrame].lstFrameKeys;
+					if (lstFrameKeysT.GetNumOfElements() != sAnimation.nMorphTargets || !cFile.Write(lstFrameKeysT.GetData(), 1, sizeof(float)*sAnimation.nMorphTargets))
+						return false; // Error!
+				}
+			}
+
+			// Write morph target animation
+			if (!WriteAt(cFile, sHeader.nMorphTargetAnimationsOffset + i*sizeof(MeshFileMapped::MorphTargetAnimation), &sAnimation, sizeof(sAnimation)))
+				return false; // Error!
+		}
+	}
+
+	// Done
+	return true;
+}
+
+bool MeshLoaderPLMapped::Align(File &cFile, uint32 &nOffset) const
+{
+	// Pad the file with zeros up to the next aligned position
+	static const uint8 nPadding[MeshFileMapped::ALIGNMENT] = { 0 };
+	const uint32 nPosition = cFile.Tell();
+	const uint32 nPaddingSize = (MeshFileMapped::ALIGNMENT - nPosition%MeshFileMapped::ALIGNMENT)%MeshFileMapped::ALIGNMENT;
+	if (nPaddingSize && cFile.Write(nPadding, 1, nPaddingSize) != nPaddingSize)
+		return false; // Error!
+
+	// Done
+	nOffset = nPosition + nPaddingSize;
+	return true;
+}
+
+bool MeshLoaderPLMapped::Reserve(File &cFile, uint32 nSize, uint32 &nOffset) const
+{
+	// Write aligned zeros
+	static const uint8 nZeros[MeshFileMapped::ALIGNMENT] = { 0 };
+	if (!Align(cFile, nOffset))
+		return false; // Error!
+	while (nSize) {
+		const uint32 nBytes = (nSize < MeshFileMapped::ALIGNMENT) ? nSize : MeshFileMapped::ALIGNMENT;
+		if (cFile.Write(nZeros, 1, nBytes) != nBytes)
+			return false; // Error!
+		nSize -= nBytes;
+	}
+
+	// Done
+	return true;
+}
+
+bool MeshLoaderPLMapped::WriteBlock(File &cFile, const void *pData, uint32 nSize, uint32 &nOffset) const
+{
+	// An empty block has the offset 0
+	if (!nSize) {
+		nOffset = 0;
+		return true;
+	}
+
+	// Write aligned block
+	return (Align(cFile, nOffset) && cFile.Write(pData, 1, nSize) == nSize);
+}
+
+bool MeshLoaderPLMapped::WriteAt(File &cFile, uint32 nOffset, const void *pData, uint32 nSize) const
+{
+	// Write the data at the given offset and go back to the current end of the file
+	const int32 nPosition = cFile.Tell();
+	return (cFile.Seek(nOffset) && cFile.Write(pData, 1, nSize) == nSize && cFile.Seek(nPosition));
+}
+
+void MeshLoaderPLMapped::SetName(char *pszName, uint32 nMaxLength, const String &sName) const
+{
+	// Copy the name and ensure it's terminated, unused characters are set to zero
+	uint32 nLength = sName.GetLength();
+	if (nLength > nMaxLength-1)
+		nLength = nMaxLength-1;
+	MemoryManager::Set(pszName, 0, nMaxLength);
+	MemoryManager::Copy(pszName, sName.GetASCII(), nLength);
+}
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+} // PLMesh
@@ -235,6 +235,11 @@ bool MeshAnimationManager::Apply(MeshHandler &cMeshHandler) const
 	return false;
 }
 
+void MeshAnimationManager::OnMeshChange()
+{
+	// Nothing to do by default
+}
+
 
 //[-------------------------------------------------------]
 //[ Namespace                                             ]
@@ -25,6 +25,7 @@
 //[-------------------------------------------------------]
 //[ Includes                                              ]
 //[-------------------------------------------------------]
+#include <PLCore/System/JobSystem.h>
 #include <PLRenderer/Renderer/VertexBuffer.h>
 #include <PLRenderer/Animation/Animation.h>
 #include "PLMesh/Skeleton.h"
@@ -33,6 +34,9 @@
 #include "PLMesh/MeshMorphTarget.h"
 #include "PLMesh/SkeletonHandler.h"
 #include "PLMesh/MeshAnimationManagerSoftware.h"
+#ifdef PLMATH_SSE
+	#include <xmmintrin.h>
+#endif
 
 
 //[-------------------------------------------------------]
@@ -57,7 +61,13 @@ pl_implement_class(MeshAnimationManagerSoftware)
 *  @brief
 *    Default constructor
 */
-MeshAnimationManagerSoftware::MeshAnimationManagerSoftware()
+MeshAnimationManagerSoftware::MeshAnimationManagerSoftware() :
+	m_pStreamVertexBuffer(nullptr),
+	m_nStreamNumOfVertices(0),
+	m_nStreamNumOfWeights(0),
+	m_nStreamNumOfJoints(0),
+	m_nNumOfInfluences(0),
+	m_nStreamSize(0)
 {
 }
 
@@ -70,11 +80,404 @@ MeshAnimationManagerSoftware::~MeshAnimationManagerSoftware()
 }
 
 
+//[-------------------------------------------------------]
+//[ Public static functions                               ]
+//[-------------------------------------------------------]
+/**
+*  @brief
+*    Applies the current animation states of multiple mesh handlers at once
+*/
+uint32 MeshAnimationManagerSoftware::ApplyMultiple(const Array<MeshHandler*> &lstMeshHandlers)
+{
+	uint32 nApplied = 0;
+
+	// Prepare all mesh handlers, the skinning data of software mesh animation managers which require skinning is collected
+	SkinningData *pSkinningData = new SkinningData[lstMeshHandlers.GetNumOfElements()];
+	Array<const SkinningData*> lstData;
+	for (uint32 i=0; i<lstMeshHandlers.GetNumOfElements(); i++) {
+		MeshHandler *pMeshHandler = lstMeshHandlers[i];
+		if (pMeshHandler) {
+			const MeshAnimationManager *pManager = pMeshHandler->GetMeshAnimationManager();
+			if (pManager) {
+				if (pManager->IsInstanceOf("PLMesh::MeshAnimationManagerSoftware")) {
+					SkinningData &sData = pSkinningData[i];
+					if (static_cast<const MeshAnimationManagerSoftware*>(pManager)->BeginApply(*pMeshHandler, sData)) {
+						if (sData.bSkinningRequired)
+							lstData.Add(&sData);
+						else
+							EndApply(sData);
+						nApplied++;
+					}
+				} else {
+					// Not a software mesh animation manager, just apply it
+					if (pManager->Apply(*pMeshHandler))
+						nApplied++;
+				}
+			}
+		}
+	}
+
+	// Skin all vertices at once
+	if (lstData.GetNumOfElements()) {
+		Skin(lstData);
+
+		// Unlock the vertex buffers
+		for (uint32 i=0; i<lstData.GetNumOfElements(); i++)
+			EndApply(*const_cast<SkinningData*>(lstData[i]));
+	}
+
+	// Cleanup
+	delete [] pSkinningData;
+
+	// Done
+	return nApplied;
+}
+
+
 //[-------------------------------------------------------]
 //[ Public virtual MeshAnimationManager functions         ]
 //[-------------------------------------------------------]
 bool MeshAnimationManagerSoftware::Apply(MeshHandler &cMeshHandler) const
 {
+	// Lock the vertex buffers and apply the morph targets
+	SkinningData sData;
+	if (!BeginApply(cMeshHandler, sData))
+		return false; // Error!
+
+	// Skin the vertices
+	if (sData.bSkinningRequired) {
+		Array<const SkinningData*> lstData;
+		lstData.Add(&sData);
+		Skin(lstData);
+	}
+
+	// Unlock the vertex buffers
+	EndApply(sData);
+
+	// Done
+	return true;
+}
+
+void MeshAnimationManagerSoftware::OnMeshChange()
+{
+	// The vertex buffer the streams were built for may be destroyed and its address reused
+	InvalidateStreams();
+}
+
+
+//[-------------------------------------------------------]
+//[ Private static functions                              ]
+//[-------------------------------------------------------]
+/**
+*  @brief
+*    Skins the vertices of the given prepared mesh handlers, in parallel if possible
+*/
+void MeshAnimationManagerSoftware::Skin(const Array<const SkinningData*> &lstData)
+{
+	// Number of vertices per skinning range, must be a multiple of four so that only the last range of a mesh
+	// has to deal with vertices not filling all SIMD lanes
+	static const uint32 RangeSize = 2048;
+
+	// Get the number of skinning ranges
+	const uint32 nNumOfData = lstData.GetNumOfElements();
+	uint32 nNumOfRanges = 0;
+	for (uint32 i=0; i<nNumOfData; i++)
+		nNumOfRanges += (lstData[i]->nNumOfVertices + RangeSize - 1)/RangeSize;
+
+	// Just a single range? (no job system required)
+	if (nNumOfRanges == 1) {
+		const SkinningData *pData = lstData[0];
+		for (uint32 i=1; !pData->nNumOfVertices && i<nNumOfData; i++)
+			pData = lstData[i];
+		SkinVertices(*pData, 0, pData->nNumOfVertices);
+	} else if (nNumOfRanges) {
+		// Split the vertices of all meshes into ranges
+		SkinningRange *pRanges = new SkinningRange[nNumOfRanges];
+		SkinningRange *pRange  = pRanges;
+		for (uint32 i=0; i<nNumOfData; i++) {
+			const SkinningData *pData = lstData[i];
+			for (uint32 nFirstVertex=0; nFirstVertex<pData->nNumOfVertices; nFirstVertex+=RangeSize, pRange++) {
+				pRange->pData		 = pData;
+				pRange->nFirstVertex = nFirstVertex;
+				pRange->nEndVertex	 = Math::Min(nFirstVertex + RangeSize, pData->nNumOfVertices);
+			}
+		}
+
+		// Skin the ranges, use the worker threads of the job system if there are any
+		JobSystem *pJobSystem = JobSystem::GetInstance();
+		if (pJobSystem && pJobSystem->GetNumOfWorkers())
+			pJobSystem->ParallelFor(nNumOfRanges, 1, &MeshAnimationManagerSoftware::SkinRanges, pRanges);
+		else
+			SkinRanges(0, nNumOfRanges, pRanges);
+
+		// Cleanup
+		delete [] pRanges;
+	}
+}
+
+/**
+*  @brief
+*    Job system parallel for function skinning a range of skinning ranges
+*/
+void MeshAnimationManagerSoftware::SkinRanges(uint32 nFirst, uint32 nEnd, void *pData)
+{
+	const SkinningRange *pRanges = static_cast<const SkinningRange*>(pData);
+	for (uint32 i=nFirst; i<nEnd; i++) {
+		const SkinningRange &sRange = pRanges[i];
+		SkinVertices(*sRange.pData, sRange.nFirstVertex, sRange.nEndVertex);
+	}
+}
+
+
+/**
+*  @brief
+*    Skins a range of vertices of a prepared mesh handler
+*/
+void MeshAnimationManagerSoftware::SkinVertices(const SkinningData &sData, uint32 nFirstVertex, uint32 nEndVertex)
+{
+/* Here's the unoptimized version, the joint index and bias streams are replacing the per vertex weight
+   lists and the joint palette is replacing the joint handlers
+    Vector3 vPos, vV;
+	for (uint32 nVertex=0; nVertex<nNumOfVertices; nVertex++) {
+		const Array<uint32> &lstVWeights = pVertexWeights->GetWeights();
+
+	// Position
+		// Get current vertex position
+		vV.x = pfPosition[0];
+		vV.y = pfPosition[1];
+		vV.z = pfPosition[2];
+
+		// Add weights
+		vPos = 0.0f;
+		const uint32 nWeights = lstVWeights.GetNumOfElements();
+		for (uint32 nWeight=0; nWeight<nWeights; nWeight++) {
+			const Weight       &cWeight = *lstWeights[*lstVWeights[nWeight]];
+			const JointHandler &cJH     = *lstJointHandlers[cWeight.GetJoint()];
+			const Matrix3x3    &mTrans  = cJH.GetMatrixTransform();
+			vPos += ((mTrans*vV)+cJH.GetTranslationJointSpace())*cWeight.GetBias();
+		}
+
+		// Set new vertex position
+		pfPosition[Vector3::X] = vPos.x;
+		pfPosition[Vector3::Y] = vPos.y;
+		pfPosition[Vector3::Z] = vPos.z;
+		// Next position, please
+		pfPosition = reinterpret_cast<float*>(reinterpret_cast<char*>(pfPosition)+nVertexSize);
+
+	// Normal, tangent and binormal
+		// The same as the position, but without the joint translation
+		...
+
+		// Next vertex weights
+		pVertexWeights++;
+	}
+
+   Because the weighted sum of the joint transforms is the same for all vertex attributes, we first blend the
+   joint transforms of a vertex and then transform the position, normal, tangent and binormal only once.
+*/
+
+	// Get the vertex data, the position is already morphed and therefore taken from the mesh handler vertex buffer
+	const uint32 nVertexSize  = sData.pVertexBuffer ->GetVertexSize();
+	const uint32 nVertexTSize = sData.pVertexBufferT->GetVertexSize();
+	char *pPosition = static_cast<char*>(sData.pVertexBufferT->GetData(nFirstVertex, VertexBuffer::Position));
+	const char *pSource[3];
+		  char *pDestination[3];
+	uint32 nNumOfDirections = 0;
+	static const uint32 nSemantics[3] = { VertexBuffer::Normal, VertexBuffer::Tangent, VertexBuffer::Binormal };
+	for (uint32 i=0; i<3; i++) {
+		const char *pSourceData		 = static_cast<const char*>(sData.pVertexBuffer ->GetData(nFirstVertex, nSemantics[i]));
+			  char *pDestinationData = static_cast<char*>	   (sData.pVertexBufferT->GetData(nFirstVertex, nSemantics[i]));
+		if (pSourceData && pDestinationData) {
+			pSource[nNumOfDirections]	   = pSourceData;
+			pDestination[nNumOfDirections] = pDestinationData;
+			nNumOfDirections++;
+		}
+	}
+
+	// Get the skinning data
+	const MeshAnimationManagerSoftware &cManager = *sData.pManager;
+	const uint32  nNumOfInfluences = cManager.m_nNumOfInfluences;
+	const uint32  nStreamSize	   = cManager.m_nStreamSize;
+	const float  *pfPalette		   = sData.lstJointPalette.GetData();
+	const uint32 *pnJoints		   = cManager.m_lstJointStream.GetData();
+	const float  *pfBiases		   = cManager.m_lstBiasStream.GetData();
+	uint32 nVertex = nFirstVertex;
+
+#ifdef PLMATH_SSE
+	// SSE method, four vertices at once, each SIMD lane is one vertex
+	for (; nVertex+4<=nEndVertex; nVertex+=4) {
+		// Blend the joint transforms, "vM[i]" holds the element "i" of the row major 3x4 transform matrix of the four vertices
+		__m128 vM[12];
+		for (uint32 i=0; i<12; i++)
+			vM[i] = _mm_setzero_ps();
+		for (uint32 nInfluence=0; nInfluence<nNumOfInfluences; nInfluence++) {
+			const uint32 nStream = nInfluence*nStreamSize + nVertex;
+			const __m128 vBias   = _mm_loadu_ps(&pfBiases[nStream]);
+
+			// Skip this influence if it has no effect on any of the four vertices (very common for the last influences)
+			if (_mm_movemask_ps(_mm_cmpneq_ps(vBias, _mm_setzero_ps()))) {
+				const float *pfJoint0 = &pfPalette[pnJoints[nStream  ]*12];
+				const float *pfJoint1 = &pfPalette[pnJoints[nStream+1]*12];
+				const float *pfJoint2 = &pfPalette[pnJoints[nStream+2]*12];
+				const float *pfJoint3 = &pfPalette[pnJoints[nStream+3]*12];
+				for (uint32 nRow=0; nRow<12; nRow+=4) {
+					// Transpose the matrix rows of the four vertices so that we get one matrix element per register
+					__m128 vElement0 = _mm_loadu_ps(&pfJoint0[nRow]);
+					__m128 vElement1 = _mm_loadu_ps(&pfJoint1[nRow]);
+					__m128 vElement2 = _mm_loadu_ps(&pfJoint2[nRow]);
+					__m128 vElement3 = _mm_loadu_ps(&pfJoint3[nRow]);
+					_MM_TRANSPOSE4_PS(vElement0, vElement1, vElement2, vElement3);
+
+					// Add the weighted joint transform
+					vM[nRow  ] = _mm_add_ps(vM[nRow  ], _mm_mul_ps(vElement0, vBias));
+					vM[nRow+1] = _mm_add_ps(vM[nRow+1], _mm_mul_ps(vElement1, vBias));
+					vM[nRow+2] = _mm_add_ps(vM[nRow+2], _mm_mul_ps(vElement2, vBias));
+					vM[nRow+3] = _mm_add_ps(vM[nRow+3], _mm_mul_ps(vElement3, vBias));
+				}
+			}
+		}
+
+		{ // Position
+			float *pfPosition0 = reinterpret_cast<float*>(pPosition);
+			float *pfPosition1 = reinterpret_cast<float*>(pPosition + nVertexTSize);
+			float *pfPosition2 = reinterpret_cast<float*>(pPosition + nVertexTSize*2);
+			float *pfPosition3 = reinterpret_cast<float*>(pPosition + nVertexTSize*3);
+			const __m128 vX = _mm_setr_ps(pfPosition0[0], pfPosition1[0], pfPosition2[0], pfPosition3[0]);
+			const __m128 vY = _mm_setr_ps(pfPosition0[1], pfPosition1[1], pfPosition2[1], pfPosition3[1]);
+			const __m128 vZ = _mm_setr_ps(pfPosition0[2], pfPosition1[2], pfPosition2[2], pfPosition3[2]);
+
+			// vPositionT = (mTrans*vPosition)+vTranslation
+			float fResult[12];
+			_mm_storeu_ps(&fResult[0], _mm_add_ps(_mm_add_ps(_mm_mul_ps(vM[0], vX), _mm_mul_ps(vM[1], vY)), _mm_add_ps(_mm_mul_ps(vM[ 2], vZ), vM[ 3])));
+			_mm_storeu_ps(&fResult[4], _mm_add_ps(_mm_add_ps(_mm_mul_ps(vM[4], vX), _mm_mul_ps(vM[5], vY)), _mm_add_ps(_mm_mul_ps(vM[ 6], vZ), vM[ 7])));
+			_mm_storeu_ps(&fResult[8], _mm_add_ps(_mm_add_ps(_mm_mul_ps(vM[8], vX), _mm_mul_ps(vM[9], vY)), _mm_add_ps(_mm_mul_ps(vM[10], vZ), vM[11])));
+
+			// Set new vertex positions
+			pfPosition0[Vector3::X] = fResult[0]; pfPosition0[Vector3::Y] = fResult[4]; pfPosition0[Vector3::Z] = fResult[ 8];
+			pfPosition1[Vector3::X] = fResult[1]; pfPosition1[Vector3::Y] = fResult[5]; pfPosition1[Vector3::Z] = fResult[ 9];
+			pfPosition2[Vector3::X] = fResult[2]; pfPosition2[Vector3::Y] = fResult[6]; pfPosition2[Vector3::Z] = fResult[10];
+			pfPosition3[Vector3::X] = fResult[3]; pfPosition3[Vector3::Y] = fResult[7]; pfPosition3[Vector3::Z] = fResult[11];
+
+			// Next position, please
+			pPosition += nVertexTSize*4;
+		}
+
+		// Normal, tangent and binormal
+		for (uint32 nDirection=0; nDirection<nNumOfDirections; nDirection++) {
+			const float *pfSource0 = reinterpret_cast<const float*>(pSource[nDirection]);
+			const float *pfSource1 = reinterpret_cast<const float*>(pSource[nDirection] + nVertexSize);
+			const float *pfSource2 = reinterpret_cast<const float*>(pSource[nDirection] + nVertexSize*2);
+			const float *pfSource3 = reinterpret_cast<const float*>(pSource[nDirection] + nVertexSize*3);
+			const __m128 vX = _mm_setr_ps(pfSource0[0], pfSource1[0], pfSource2[0], pfSource3[0]);
+			const __m128 vY = _mm_setr_ps(pfSource0[1], pfSource1[1], pfSource2[1], pfSource3[1]);
+			const __m128 vZ = _mm_setr_ps(pfSource0[2], pfSource1[2], pfSource2[2], pfSource3[2]);
+
+			// vDirectionT = mTrans*vDirection
+			float fResult[12];
+			_mm_storeu_ps(&fResult[0], _mm_add_ps(_mm_add_ps(_mm_mul_ps(vM[0], vX), _mm_mul_ps(vM[1], vY)), _mm_mul_ps(vM[ 2], vZ)));
+			_mm_storeu_ps(&fResult[4], _mm_add_ps(_mm_add_ps(_mm_mul_ps(vM[4], vX), _mm_mul_ps(vM[5], vY)), _mm_mul_ps(vM[ 6], vZ)));
+			_mm_storeu_ps(&fResult[8], _mm_add_ps(_mm_add_ps(_mm_mul_ps(vM[8], vX), _mm_mul_ps(vM[9], vY)), _mm_mul_ps(vM[10], vZ)));
+
+			// Set new vertex directions
+			float *pfDestination0 = reinterpret_cast<float*>(pDestination[nDirection]);
+			float *pfDestination1 = reinterpret_cast<float*>(pDestination[nDirection] + nVertexTSize);
+			float *pfDestination2 = reinterpret_cast<float*>(pDestination[nDirection] + nVertexTSize*2);
+			float *pfDestination3 = reinterpret_cast<float*>(pDestination[nDirection] + nVertexTSize*3);
+			pfDestination0[Vector3::X] = fResult[0]; pfDestination0[Vector3::Y] = fResult[4]; pfDestination0[Vector3::Z] = fResult[ 8];
+			pfDestination1[Vector3::X] = fResult[1]; pfDestination1[Vector3::Y] = fResult[5]; pfDestination1[Vector3::Z] = fResult[ 9];
+			pfDestination2[Vector3::X] = fResult[2]; pfDestination2[Vector3::Y] = fResult[6]; pfDestination2[Vector3::Z] = fResult[10];
+			pfDestination3[Vector3::X] = fResult[3]; pfDestination3[Vector3::Y] = fResult[7]; pfDestination3[Vector3::Z] = fResult[11];
+
+			// Next direction, please
+			pSource[nDirection]		 += nVertexSize*4;
+			pDestination[nDirection] += nVertexTSize*4;
+		}
+	}
+#endif
+
+	// C++ method (also used for the remaining vertices of the SSE method)
+	for (; nVertex<nEndVertex; nVertex++) {
+		// Blend the joint transforms, row major 3x4 transform matrix
+		float fM[12] = { 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f };
+		for (uint32 nInfluence=0; nInfluence<nNumOfInfluences; nInfluence++) {
+			const uint32 nStream = nInfluence*nStreamSize + nVertex;
+			const float  fBias   = pfBiases[nStream];
+			if (fBias) {
+				const float *pfJoint = &pfPalette[pnJoints[nStream]*12];
+				for (uint32 i=0; i<12; i++)
+					fM[i] += pfJoint[i]*fBias;
+			}
+		}
+
+		{ // Position
+			float *pfPosition = reinterpret_cast<float*>(pPosition);
+			const float fX = pfPosition[0];
+			const float fY = pfPosition[1];
+			const float fZ = pfPosition[2];
+
+			// vPositionT = (mTrans*vPosition)+vTranslation
+			pfPosition[Vector3::X] = fM[0]*fX + fM[1]*fY + fM[ 2]*fZ + fM[ 3];
+			pfPosition[Vector3::Y] = fM[4]*fX + fM[5]*fY + fM[ 6]*fZ + fM[ 7];
+			pfPosition[Vector3::Z] = fM[8]*fX + fM[9]*fY + fM[10]*fZ + fM[11];
+
+			// Next position, please
+			pPosition += nVertexTSize;
+		}
+
+		// Normal, tangent and binormal
+		for (uint32 nDirection=0; nDirection<nNumOfDirections; nDirection++) {
+			const float *pfSource = reinterpret_cast<const float*>(pSource[nDirection]);
+			const float fX = pfSource[0];
+			const float fY = pfSource[1];
+			const float fZ = pfSource[2];
+
+			// vDirectionT = mTrans*vDirection
+			float *pfDestination = reinterpret_cast<float*>(pDestination[nDirection]);
+			pfDestination[Vector3::X] = fM[0]*fX + fM[1]*fY + fM[ 2]*fZ;
+			pfDestination[Vector3::Y] = fM[4]*fX + fM[5]*fY + fM[ 6]*fZ;
+			pfDestination[Vector3::Z] = fM[8]*fX + fM[9]*fY + fM[10]*fZ;
+
+			// Next direction, please
+			pSource[nDirection]		 += nVertexSize;
+			pDestination[nDirection] += nVertexTSize;
+		}
+	}
+}
+
+/**
+*  @brief
+*    Unlocks the vertex buffers locked by "BeginApply()"
+*/
+void MeshAnimationManagerSoftware::EndApply(SkinningData &sData)
+{
+	if (sData.pVertexBuffer) {
+		sData.pVertexBuffer->Unlock();
+		sData.pVertexBuffer = nullptr;
+	}
+	if (sData.pVertexBufferT) {
+		sData.pVertexBufferT->Unlock();
+		sData.pVertexBufferT = nullptr;
+	}
+	sData.bSkinningRequired = false;
+}
+
+
+//[-------------------------------------------------------]
+//[ Private functions                                     ]
+//[-------------------------------------------------------]
+/**
+*  @brief
+*    Locks the vertex buffers, applies the morph targets and prepares the skinning data
+*/
+bool MeshAnimationManagerSoftware::BeginApply(MeshHandler &cMeshHandler, SkinningData &sData) const
+{
+	// Nothing to skin by default
+	sData.pManager			= this;
+	sData.pVertexBuffer		= nullptr;
+	sData.pVertexBufferT	= nullptr;
+	sData.nNumOfVertices	= 0;
+	sData.bSkinningRequired	= false;
+
 	// Call base implementation which calculates the current skeleton handler joint states
 	if (!MeshAnimationManager::Apply(cMeshHandler))
 		return false; // Error!
@@ -105,13 +508,18 @@ bool MeshAnimationManagerSoftware::Apply(MeshHandler &cMeshHandler) const
 		// Error!
 		return false;
 	}
+	sData.pVertexBuffer  = pVB;
+	sData.pVertexBufferT = pVBT;
+
+	// Get data
+	const uint32 nVertexTSize = pVBT->GetVertexSize();
+	char        *pVerticesT   = static_cast<char*>(pVBT->GetData(0, VertexBuffer::Position));
 
 	{ // Set base morph target
 		// Get data
 		float *pfVertices   = static_cast<float*>(pVB->GetData(0, VertexBuffer::Position));
 		uint32 nVertexSize  = pVB->GetVertexSize();
-		float *pfVerticesT  = static_cast<float*>(pVBT->GetData(0, VertexBuffer::Position));
-		uint32 nVertexTSize = pVBT->GetVertexSize();
+		float *pfVerticesT  = reinterpret_cast<float*>(pVerticesT);
 
 		// Loop through all vertices
 		for (uint32 nVertex=0; nVertex<pVB->GetNumOfElements(); nVertex++) {
@@ -138,18 +546,22 @@ bool MeshAnimationManagerSoftware::Apply(MeshHandler &cMeshHandler) const
 				uint32         nVertexIDs   = lstVertexIDs.GetNumOfElements();
 				if (nVertexIDs) {
 					// Get data
-					float *pfVertices  = static_cast<float*>(pVBMT->GetData(0, VertexBuffer::Position));
-					uint32 nVertexSize = pVBMT->GetVertexSize();
+					float		 *pfVertices	= static_cast<float*>(pVBMT->GetData(0, VertexBuffer::Position));
+					uint32		  nVertexSize	= pVBMT->GetVertexSize();
+					const uint32  nNumOfVertices = pVBT->GetNumOfElements();
+					const uint32 *pnVertexID	= lstVertexIDs.GetData();
 
 					// Use vertex ID's to add certain deltas
-					for (uint32 nVertex=0; nVertex<nVertexIDs; nVertex++) {
-						// Get vertex to set
-						float *pfVerticesT = static_cast<float*>(pVBT->GetData(lstVertexIDs[nVertex], VertexBuffer::Position));
+					for (uint32 nVertex=0; nVertex<nVertexIDs; nVertex++, pnVertexID++) {
+						// Get vertex to set (the same as "pVBT->GetData(*pnVertexID, VertexBuffer::Position)", but without the virtual function call per vertex)
+						if (*pnVertexID < nNumOfVertices) {
+							float *pfVerticesT = reinterpret_cast<float*>(pVerticesT + *pnVertexID*nVertexTSize);
 
-						// Set data
-						pfVerticesT[Vector3::X] += pfVertices[Vector3::X]*fWeight;
-						pfVerticesT[Vector3::Y] += pfVertices[Vector3::Y]*fWeight;
-						pfVerticesT[Vector3::Z] += pfVertices[Vector3::Z]*fWeight;
+							// Set data
+							pfVerticesT[Vector3::X] += pfVertices[Vector3::X]*fWeight;
+							pfVerticesT[Vector3::Y] += pfVertices[Vector3::Y]*fWeight;
+							pfVerticesT[Vector3::Z] += pfVertices[Vector3::Z]*fWeight;
+						}
 
 						// Next data, please
 						pfVertices = reinterpret_cast<float*>(reinterpret_cast<char*>(pfVertices)+nVertexSize);
@@ -158,8 +570,7 @@ bool MeshAnimationManagerSoftware::Apply(MeshHandler &cMeshHandler) const
 					// Get data
 					float *pfVertices  = static_cast<float*>(pVBMT->GetData(0, VertexBuffer::Position));
 					uint32 nVertexSize = pVBMT->GetVertexSize();
-					float *pfVerticesT = static_cast<float*>(pVBT->GetData(0, VertexBuffer::Position));
-					uint32 nVertexTSize = pVBT->GetVertexSize();
+					float *pfVerticesT = reinterpret_cast<float*>(pVerticesT);
 
 					// Go through ALL vertices and add deltas
 					for (uint32 nVertex=0; nVertex<pVB->GetNumOfElements(); nVertex++) {
@@ -181,637 +592,120 @@ bool MeshAnimationManagerSoftware::Apply(MeshHandler &cMeshHandler) const
 	// Get skeleton handler
 	const SkeletonHandler *pSH = cMeshHandler.GetSkeletonHandler();
 	if (!pSH) {
-		// Unlock the vertex buffers
-		pVB->Unlock();
-		pVBT->Unlock();
-
 		// Done - no skeleton handler, no skinning :(
 		return true;
 	}
 
 	// Apply skeleton to vertex buffer
-	const Array<VertexWeights> &lstVertexWeights = pMesh->GetVertexWeights();
-	if (!lstVertexWeights.GetNumOfElements()) {
+	if (!pMesh->GetVertexWeights().GetNumOfElements()) {
 		// Unlock the vertex buffers
-		pVB->Unlock();
-		pVBT->Unlock();
+		EndApply(sData);
 
 		// Error!
 		return false;
 	}
-	const Array<Weight>		  &lstWeights		= pMesh->GetWeights();
-	const Array<JointHandler> &lstJointHandlers = pSH->GetJointHandlers();
-
-	// Get data
-	float       *pfPosition   = static_cast<float*>      (pVBT->GetData(0, VertexBuffer::Position));
-	const float *pfNormal     = static_cast<const float*>(pVB-> GetData(0, VertexBuffer::Normal));
-	float       *pfNormalT    = static_cast<float*>      (pVBT->GetData(0, VertexBuffer::Normal));
-	const float *pfTangent    = static_cast<const float*>(pVB-> GetData(0, VertexBuffer::Tangent));
-	float       *pfTangentT   = static_cast<float*>      (pVBT->GetData(0, VertexBuffer::Tangent));
-	const float *pfBinormal   = static_cast<const float*>(pVB-> GetData(0, VertexBuffer::Binormal));
-	float       *pfBinormalT  = static_cast<float*>      (pVBT->GetData(0, VertexBuffer::Binormal));
-	const uint32 nVertexSize  = pVB->GetVertexSize();
-	const uint32 nVertexTSize = pVBT->GetVertexSize();
-
-	// Loop through all vertices
-	const VertexWeights *pVertexWeights = &lstVertexWeights[0];
-	const uint32 nNumOfVertices = pVBT->GetNumOfElements();
-
-/* Here's the unoptimized version, but because this can become quite fast to the 
-   bottleneck, we have to optimize it!
-    Vector3 vPos, vV;
-	for (uint32 nVertex=0; nVertex<nNumOfVertices; nVertex++) {
-		const Array<uint32> &lstVWeights = pVertexWeights->GetWeights();
-
-	// Position
-		// Get current vertex position
-		vV.x = pfPosition[0];
-		vV.y = pfPosition[1];
-		vV.z = pfPosition[2];
-
-		// Add weights
-		vPos = 0.0f;
-		const uint32 nWeights = lstVWeights.GetNumOfElements();
-		for (uint32 nWeight=0; nWeight<nWeights; nWeight++) {
-			const Weight       &cWeight = *lstWeights[*lstVWeights[nWeight]];
-			const JointHandler &cJH     = *lstJointHandlers[cWeight.GetJoint()];
-			const Matrix3x3    &mTrans  = cJH.GetMatrixTransform();
-			vPos += ((mTrans*vV)+cJH.GetTranslationJointSpace())*cWeight.GetBias();
-		}
 
-		// Set new vertex position
-		pfPosition[Vector3::X] = vPos.x;
-		pfPosition[Vector3::Y] = vPos.y;
-		pfPosition[Vector3::Z] = vPos.z;
-		// Next position, please
-		pfPosition = reinterpret_cast<float*>(reinterpret_cast<char*>(pfPosition)+nVertexSize);
-
-	// Normal
-		if (pfNormal) {
-			// Get current vertex normal
-			vV.x = pfNormal[0];
-			vV.y = pfNormal[1];
-			vV.z = pfNormal[2];
-
-			// Add weights
-			vPos = 0.0f;
-			for (uint32 nWeight=0; nWeight<nWeights; nWeight++) {
-				const Weight       &cWeight = *lstWeights[*lstVWeights[nWeight]];
-				const JointHandler &cJH     = *lstJointHandlers[cWeight.GetJoint()];
-				const Matrix3x3 &mTrans     = cJH.GetMatrixTransform();
-				vPos += (mTrans*vV)*cWeight.GetBias();
-			}
-
-			// Set new vertex normal
-			pfNormalT[Vector3::X] = vPos.x;
-			pfNormalT[Vector3::Y] = vPos.y;
-			pfNormalT[Vector3::Z] = vPos.z;
-			// Next normal, please
-			pfNormal = reinterpret_cast<const float*>(reinterpret_cast<const char*>(pfNormal)+nVertexSize);
-			pfNormalT = reinterpret_cast<float*>(reinterpret_cast<char*>(pfNormalT)+nVertexTSize);
-		}
-
-	// Tangent
-		if (pfTangent) {
-			// Get current vertex tangent
-			vV.x = pfTangent[0];
-			vV.y = pfTangent[1];
-			vV.z = pfTangent[2];
-
-			// Add weights
-			vPos = 0.0f;
-			for (uint32 nWeight=0; nWeight<nWeights; nWeight++) {
-				const Weight       &cWeight = *lstWeights[*lstVWeights[nWeight]];
-				const JointHandler &cJH     = *lstJointHandlers[cWeight.GetJoint()];
-				const Matrix3x3    &mTrans  = cJH.GetMatrixTransform();
-				vPos += (mTrans*vV)*cWeight.GetBias();
-			}
-
-			// Set new vertex tangent
-			pfTangentT[Vector3::X] = vPos.x;
-			pfTangentT[Vector3::Y] = vPos.y;
-			pfTangentT[Vector3::Z] = vPos.z;
-			// Next tangent, please
-			pfTangent = reinterpret_cast<const float*>(reinterpret_cast<const char*>(pfTangent)+nVertexSize);
-			pfTangentT = reinterpret_cast<float*>(reinterpret_cast<char*>(pfTangentT)+nVertexTSize);
-		}
-
-	// Binormal
-		if (pfBinormal) {
-			// Get current vertex binormal
-			vV.x = pfBinormal[0];
-			vV.y = pfBinormal[1];
-			vV.z = pfBinormal[2];
-
-			// Add weights
-			vPos = 0.0f;
-			for (uint32 nWeight=0; nWeight<nWeights; nWeight++) {
-				const Weight       &cWeight = *lstWeights[*lstVWeights[nWeight]];
-				const JointHandler &cJH     = *lstJointHandlers[cWeight.GetJoint()];
-				const Matrix3x3    &mTrans  = cJH.GetMatrixTransform();
-				vPos += (mTrans*vV)*cWeight.GetBias();
-			}
-
-			// Set new vertex binormal
-			pfBinormalT[Vector3::X] = vPos.x;
-			pfBinormalT[Vector3::Y] = vPos.y;
-			pfBinormalT[Vector3::Z] = vPos.z;
-			// Next binormal, please
-			pfBinormal = reinterpret_cast<const float*>(reinterpret_cast<const char*>(pfBinormal)+nVertexSize);
-			pfBinormalT = reinterpret_cast<float*>(reinterpret_cast<char*>(pfBinormalT)+nVertexTSize);
-		}
-
-		// Next vertex weights
-		pVertexWeights++;
+	// Update the joint weight streams
+	const Array<JointHandler> &lstJointHandlers = pSH->GetJointHandlers();
+	const uint32 nNumOfJoints = lstJointHandlers.GetNumOfElements();
+	UpdateStreams(*pMesh, *pVB, pVBT->GetNumOfElements(), nNumOfJoints);
+	sData.nNumOfVertices = m_nStreamNumOfVertices;
+
+	// Fill the joint palette, the transform of a weight is "(mTrans*vPosition)+cJH.GetTranslationJointSpace()"
+	sData.lstJointPalette.Resize((nNumOfJoints + 1)*12);
+	float *pfJoint = sData.lstJointPalette.GetData();
+	for (uint32 nJoint=0; nJoint<nNumOfJoints; nJoint++, pfJoint+=12) {
+		const JointHandler &cJH  = lstJointHandlers[nJoint];
+		const Matrix3x3    &mMat = cJH.GetMatrixTransform();
+		const Vector3      &vJH  = cJH.GetTranslationJointSpace();
+		pfJoint[0] = mMat.xx; pfJoint[1] = mMat.xy; pfJoint[ 2] = mMat.xz; pfJoint[ 3] = vJH.x;
+		pfJoint[4] = mMat.yx; pfJoint[5] = mMat.yy; pfJoint[ 6] = mMat.yz; pfJoint[ 7] = vJH.y;
+		pfJoint[8] = mMat.zx; pfJoint[9] = mMat.zy; pfJoint[10] = mMat.zz; pfJoint[11] = vJH.z;
 	}
-*/
-
-	// Optimized version for different combinations
-	if (!pfNormal && !pfTangent && !pfBinormal) {
-		for (uint32 nVertex=0; nVertex<nNumOfVertices; nVertex++) {
-			const Array<uint32> &lstVWeights = pVertexWeights->GetWeights();
-			const uint32         nWeights    = lstVWeights.GetNumOfElements();
-			if (nWeights) {
-				// Get current vertex position
-				const float fPositionX = pfPosition[0];
-				const float fPositionY = pfPosition[1];
-				const float fPositionZ = pfPosition[2];
-
-			// First weight
-				{
-					const Weight       &cWeight = lstWeights[lstVWeights[0]];
-					const JointHandler &cJH     = lstJointHandlers[cWeight.GetJoint()];
-					const Vector3      &vJH     = cJH.GetTranslationJointSpace();
-					const Matrix3x3    &mMat    = cJH.GetMatrixTransform();
-					const float         fBias   = cWeight.GetBias();
-					// Position
-					// vPositionT = ((mTrans*vPosition)+cJH.GetTranslationJointSpace())*fBias;
-					pfPosition[Vector3::X] = ((mMat.xx*fPositionX + mMat.xy*fPositionY + mMat.xz*fPositionZ) + vJH.x) * fBias;
-					pfPosition[Vector3::Y] = ((mMat.yx*fPositionX + mMat.yy*fPositionY + mMat.yz*fPositionZ) + vJH.y) * fBias;
-					pfPosition[Vector3::Z] = ((mMat.zx*fPositionX + mMat.zy*fPositionY + mMat.zz*fPositionZ) + vJH.z) * fBias;
-				}
-
-			// Add other weights
-				for (uint32 nWeight=1; nWeight<nWeights; nWeight++) {
-					const Weight       &cWeight = lstWeights[lstVWeights[nWeight]];
-					const JointHandler &cJH     = lstJointHandlers[cWeight.GetJoint()];
-					const Vector3      &vJH     = cJH.GetTranslationJointSpace();
-					const Matrix3x3    &mMat    = cJH.GetMatrixTransform();
-					const float         fBias   = cWeight.GetBias();
-
-					// Position
-					{ // vPositionT += ((mTrans*vPosition)+cJH.GetTranslationJointSpace())*fBias;
-						pfPosition[Vector3::X] += ((mMat.xx*fPositionX + mMat.xy*fPositionY + mMat.xz*fPositionZ) + vJH.x) * fBias;
-						pfPosition[Vector3::Y] += ((mMat.yx*fPositionX + mMat.yy*fPositionY + mMat.yz*fPositionZ) + vJH.y) * fBias;
-						pfPosition[Vector3::Z] += ((mMat.zx*fPositionX + mMat.zy*fPositionY + mMat.zz*fPositionZ) + vJH.z) * fBias;
-					}
-				}
-			}
-
-			// Next position, please
-			pfPosition = reinterpret_cast<float*>(reinterpret_cast<char*>(pfPosition)+nVertexSize);
-
-			// Next vertex weights
-			pVertexWeights++;
-		}
-	} else if (pfNormal && !pfTangent && !pfBinormal) {
-		for (uint32 nVertex=0; nVertex<nNumOfVertices; nVertex++) {
-			const Array<uint32> &lstVWeights = pVertexWeights->GetWeights();
-			const uint32         nWeights    = lstVWeights.GetNumOfElements();
-			if (nWeights) {
-				// Get current vertex position
-				const float fPositionX = pfPosition[0];
-				const float fPositionY = pfPosition[1];
-				const float fPositionZ = pfPosition[2];
-				// Get current vertex normal
-				const float fNormalX = pfNormal[0];
-				const float fNormalY = pfNormal[1];
-				const float fNormalZ = pfNormal[2];
-
-			// First weight
-				{
-					const Weight       &cWeight = lstWeights[lstVWeights[0]];
-					const JointHandler &cJH     = lstJointHandlers[cWeight.GetJoint()];
-					const Vector3      &vJH     = cJH.GetTranslationJointSpace();
-					const Matrix3x3    &mMat    = cJH.GetMatrixTransform();
-					const float         fBias   = cWeight.GetBias();
-					// vPositionT = ((mTrans*vPosition)+cJH.GetTranslationJointSpace())*fBias;
-					pfPosition[Vector3::X] = ((mMat.xx*fPositionX + mMat.xy*fPositionY + mMat.xz*fPositionZ) + vJH.x) * fBias;
-					pfPosition[Vector3::Y] = ((mMat.yx*fPositionX + mMat.yy*fPositionY + mMat.yz*fPositionZ) + vJH.y) * fBias;
-					pfPosition[Vector3::Z] = ((mMat.zx*fPositionX + mMat.zy*fPositionY + mMat.zz*fPositionZ) + vJH.z) * fBias;
-					// vNormalT = (mMat*vNormal)*fBias;
-					pfNormalT[Vector3::X] = (mMat.xx*fNormalX + mMat.xy*fNormalY + mMat.xz*fNormalZ) * fBias;
-					pfNormalT[Vector3::Y] = (mMat.yx*fNormalX + mMat.yy*fNormalY + mMat.yz*fNormalZ) * fBias;
-					pfNormalT[Vector3::Z] = (mMat.zx*fNormalX + mMat.zy*fNormalY + mMat.zz*fNormalZ) * fBias;
-				}
-
-			// Add other weights
-				for (uint32 nWeight=1; nWeight<nWeights; nWeight++) {
-					const Weight       &cWeight = lstWeights[lstVWeights[nWeight]];
-					const JointHandler &cJH     = lstJointHandlers[cWeight.GetJoint()];
-					const Vector3      &vJH     = cJH.GetTranslationJointSpace();
-					const Matrix3x3    &mMat    = cJH.GetMatrixTransform();
-					const float         fBias   = cWeight.GetBias();
-
-					// Position
-					{ // vPositionT += ((mTrans*vPosition)+cJH.GetTranslationJointSpace())*fBias;
-						pfPosition[Vector3::X] += ((mMat.xx*fPositionX + mMat.xy*fPositionY + mMat.xz*fPositionZ) + vJH.x) * fBias;
-						pfPosition[Vector3::Y] += ((mMat.yx*fPositionX + mMat.yy*fPositionY + mMat.yz*fPositionZ) + vJH.y) * fBias;
-						pfPosition[Vector3::Z] += ((mMat.zx*fPositionX + mMat.zy*fPositionY + mMat.zz*fPositionZ) + vJH.z) * fBias;
-					}
-					// Normal
-					{ // vNormalT += (mMat*vNormal)*fBias;
-						pfNormalT[Vector3::X] += (mMat.xx*fNormalX + mMat.xy*fNormalY + mMat.xz*fNormalZ) * fBias;
-						pfNormalT[Vector3::Y] += (mMat.yx*fNormalX + mMat.yy*fNormalY + mMat.yz*fNormalZ) * fBias;
-						pfNormalT[Vector3::Z] += (mMat.zx*fNormalX + mMat.zy*fNormalY + mMat.zz*fNormalZ) * fBias;
-					}
-				}
-			}
-
-			// Next position, please
-			pfPosition = reinterpret_cast<float*>(reinterpret_cast<char*>(pfPosition)+nVertexSize);
-
-			// Next normal, please
-			pfNormal = reinterpret_cast<const float*>(reinterpret_cast<const char*>(pfNormal)+nVertexSize);
-			pfNormalT = reinterpret_cast<float*>(reinterpret_cast<char*>(pfNormalT)+nVertexTSize);
-
-			// Next vertex weights
-			pVertexWeights++;
-		}
-	} else if (pfNormal && pfTangent && pfBinormal) {
-		for (uint32 nVertex=0; nVertex<nNumOfVertices; nVertex++) {
-			const Array<uint32> &lstVWeights = pVertexWeights->GetWeights();
-			const uint32         nWeights    = lstVWeights.GetNumOfElements();
-			if (nWeights) {
-				// Get current vertex position
-				const float fPositionX = pfPosition[0];
-				const float fPositionY = pfPosition[1];
-				const float fPositionZ = pfPosition[2];
-				// Get current vertex normal
-				const float fNormalX = pfNormal[0];
-				const float fNormalY = pfNormal[1];
-				const float fNormalZ = pfNormal[2];
-				// Get current vertex tangent
-				const float fTangentX = pfTangent[0];
-				const float fTangentY = pfTangent[1];
-				const float fTangentZ = pfTangent[2];
-				// Get current vertex binormal
-				const float fBinormalX = pfBinormal[0];
-				const float fBinormalY = pfBinormal[1];
-				const float fBinormalZ = pfBinormal[2];
-
-			// First weight
-				{
-					const Weight       &cWeight = lstWeights[lstVWeights[0]];
-					const JointHandler &cJH     = lstJointHandlers[cWeight.GetJoint()];
-					const Vector3      &vJH     = cJH.GetTranslationJointSpace();
-					const Matrix3x3    &mMat    = cJH.GetMatrixTransform();
-					const float         fBias   = cWeight.GetBias();
-					// vPositionT = ((mTrans*vPosition)+cJH.GetTranslationJointSpace())*fBias;
-					pfPosition[Vector3::X] = ((mMat.xx*fPositionX + mMat.xy*fPositionY + mMat.xz*fPositionZ) + vJH.x) * fBias;
-					pfPosition[Vector3::Y] = ((mMat.yx*fPositionX + mMat.yy*fPositionY + mMat.yz*fPositionZ) + vJH.y) * fBias;
-					pfPosition[Vector3::Z] = ((mMat.zx*fPositionX + mMat.zy*fPositionY + mMat.zz*fPositionZ) + vJH.z) * fBias;
-					// vNormalT = (mMat*vNormal)*fBias;
-					pfNormalT[Vector3::X] = (mMat.xx*fNormalX + mMat.xy*fNormalY + mMat.xz*fNormalZ) * fBias;
-					pfNormalT[Vector3::Y] = (mMat.yx*fNormalX + mMat.yy*fNormalY + mMat.yz*fNormalZ) * fBias;
-					pfNormalT[Vector3::Z] = (mMat.zx*fNormalX + mMat.zy*fNormalY + mMat.zz*fNormalZ) * fBias;
-					// vTangentT = (mMat*vTangent)*fBias;
-					pfTangentT[Vector3::X] = (mMat.xx*fTangentX + mMat.xy*fTangentY + mMat.xz*fTangentZ) * fBias;
-					pfTangentT[Vector3::Y] = (mMat.yx*fTangentX + mMat.yy*fTangentY + mMat.yz*fTangentZ) * fBias;
-					pfTangentT[Vector3::Z] = (mMat.zx*fTangentX + mMat.zy*fTangentY + mMat.zz*fTangentZ) * fBias;
-					// vBinormalT = (mMat*vBinormal)*fBias;
-					pfBinormalT[Vector3::X] = (mMat.xx*fBinormalX + mMat.xy*fBinormalY + mMat.xz*fBinormalZ) * fBias;
-					pfBinormalT[Vector3::Y] = (mMat.yx*fBinormalX + mMat.yy*fBinormalY + mMat.yz*fBinormalZ) * fBias;
-					pfBinormalT[Vector3::Z] = (mMat.zx*fBinormalX + mMat.zy*fBinormalY + mMat.zz*fBinormalZ) * fBias;
-				}
-
-			// Add other weights
-				for (uint32 nWeight=1; nWeight<nWeights; nWeight++) {
-					const Weight       &cWeight = lstWeights[lstVWeights[nWeight]];
-					const JointHandler &cJH     = lstJointHandlers[cWeight.GetJoint()];
-					const Vector3      &vJH     = cJH.GetTranslationJointSpace();
-					const Matrix3x3    &mMat    = cJH.GetMatrixTransform();
-					const float        fBias    = cWeight.GetBias();
-
-					// Position
-					{ // vPositionT += ((mTrans*vPosition)+cJH.GetTranslationJointSpace())*fBias;
-						pfPosition[Vector3::X] += ((mMat.xx*fPositionX + mMat.xy*fPositionY + mMat.xz*fPositionZ) + vJH.x) * fBias;
-						pfPosition[Vector3::Y] += ((mMat.yx*fPositionX + mMat.yy*fPositionY + mMat.yz*fPositionZ) + vJH.y) * fBias;
-						pfPosition[Vector3::Z] += ((mMat.zx*fPositionX + mMat.zy*fPositionY + mMat.zz*fPositionZ) + vJH.z) * fBias;
-					}
-					// Normal
-					{ // vNormalT += (mMat*vNormal)*fBias;
-						pfNormalT[Vector3::X] += (mMat.xx*fNormalX + mMat.xy*fNormalY + mMat.xz*fNormalZ) * fBias;
-						pfNormalT[Vector3::Y] += (mMat.yx*fNormalX + mMat.yy*fNormalY + mMat.yz*fNormalZ) * fBias;
-						pfNormalT[Vector3::Z] += (mMat.zx*fNormalX + mMat.zy*fNormalY + mMat.zz*fNormalZ) * fBias;
-					}
-					{ // vTangentT += (mMat*vTangent)*fBias;
-						pfTangentT[Vector3::X] += (mMat.xx*fTangentX + mMat.xy*fTangentY + mMat.xz*fTangentZ) * fBias;
-						pfTangentT[Vector3::Y] += (mMat.yx*fTangentX + mMat.yy*fTangentY + mMat.yz*fTangentZ) * fBias;
-						pfTangentT[Vector3::Z] += (mMat.zx*fTangentX + mMat.zy*fTangentY + mMat.zz*fTangentZ) * fBias;
-					}
-					{ // vBinormalT += (mMat*vBinormal)*fBias;
-						pfBinormalT[Vector3::X] += (mMat.xx*fBinormalX + mMat.xy*fBinormalY + mMat.xz*fBinormalZ) * fBias;
-						pfBinormalT[Vector3::Y] += (mMat.yx*fBinormalX + mMat.yy*fBinormalY + mMat.yz*fBinormalZ) * fBias;
-						pfBinormalT[Vector3::Z] += (mMat.zx*fBinormalX + mMat.zy*fBinormalY + mMat.zz*fBinormalZ) * fBias;
-					}
-				}
-			}
-
-			// Next position, please
-			pfPosition = reinterpret_cast<float*>(reinterpret_cast<char*>(pfPosition)+nVertexSize);
-
-			// Next normal, please
-			pfNormal = reinterpret_cast<const float*>(reinterpret_cast<const char*>(pfNormal)+nVertexSize);
-			pfNormalT = reinterpret_cast<float*>(reinterpret_cast<char*>(pfNormalT)+nVertexTSize);
-
-			// Next tangent, please
-			pfTangent = reinterpret_cast<const float*>(reinterpret_cast<const char*>(pfTangent)+nVertexSize);
-			pfTangentT = reinterpret_cast<float*>(reinterpret_cast<char*>(pfTangentT)+nVertexTSize);
-
-			// Next binormal, please
-			pfBinormal = reinterpret_cast<const float*>(reinterpret_cast<const char*>(pfBinormal)+nVertexSize);
-			pfBinormalT = reinterpret_cast<float*>(reinterpret_cast<char*>(pfBinormalT)+nVertexTSize);
-
-			// Next vertex weights
-			pVertexWeights++;
-		}
-	} else if (pfNormal && pfTangent && !pfBinormal) {
-		for (uint32 nVertex=0; nVertex<nNumOfVertices; nVertex++) {
-			const Array<uint32> &lstVWeights = pVertexWeights->GetWeights();
-			const uint32         nWeights    = lstVWeights.GetNumOfElements();
-			if (nWeights) {
-				// Get current vertex position
-				const float fPositionX = pfPosition[0];
-				const float fPositionY = pfPosition[1];
-				const float fPositionZ = pfPosition[2];
-				// Get current vertex normal
-				const float fNormalX = pfNormal[0];
-				const float fNormalY = pfNormal[1];
-				const float fNormalZ = pfNormal[2];
-				// Get current vertex tangent
-				const float fTangentX = pfTangent[0];
-				const float fTangentY = pfTangent[1];
-				const float fTangentZ = pfTangent[2];
-
-			// First weight
-				{
-					const Weight       &cWeight = lstWeights[lstVWeights[0]];
-					const JointHandler &cJH     = lstJointHandlers[cWeight.GetJoint()];
-					const Vector3      &vJH     = cJH.GetTranslationJointSpace();
-					const Matrix3x3    &mMat    = cJH.GetMatrixTransform();
-					const float         fBias   = cWeight.GetBias();
-					// vPositionT = ((mTrans*vPosition)+cJH.GetTranslationJointSpace())*fBias;
-					pfPosition[Vector3::X] = ((mMat.xx*fPositionX + mMat.xy*fPositionY + mMat.xz*fPositionZ) + vJH.x) * fBias;
-					pfPosition[Vector3::Y] = ((mMat.yx*fPositionX + mMat.yy*fPositionY + mMat.yz*fPositionZ) + vJH.y) * fBias;
-					pfPosition[Vector3::Z] = ((mMat.zx*fPositionX + mMat.zy*fPositionY + mMat.zz*fPositionZ) + vJH.z) * fBias;
-					// vNormalT = (mMat*vNormal)*fBias;
-					pfNormalT[Vector3::X] = (mMat.xx*fNormalX + mMat.xy*fNormalY + mMat.xz*fNormalZ) * fBias;
-					pfNormalT[Vector3::Y] = (mMat.yx*fNormalX + mMat.yy*fNormalY + mMat.yz*fNormalZ) * fBias;
-					pfNormalT[Vector3::Z] = (mMat.zx*fNormalX + mMat.zy*fNormalY + mMat.zz*fNormalZ) * fBias;
-					// vTangentT = (mMat*vTangent)*fBias;
-					pfTangentT[Vector3::X] = (mMat.xx*fTangentX + mMat.xy*fTangentY + mMat.xz*fTangentZ) * fBias;
-					pfTangentT[Vector3::Y] = (mMat.yx*fTangentX + mMat.yy*fTangentY + mMat.yz*fTangentZ) * fBias;
-					pfTangentT[Vector3::Z] = (mMat.zx*fTangentX + mMat.zy*fTangentY + mMat.zz*fTangentZ) * fBias;
-				}
-
-			// Add other weights
-				for (uint32 nWeight=1; nWeight<nWeights; nWeight++) {
-					const Weight       &cWeight = lstWeights[lstVWeights[nWeight]];
-					const JointHandler &cJH     = lstJointHandlers[cWeight.GetJoint()];
-					const Vector3      &vJH     = cJH.GetTranslationJointSpace();
-					const Matrix3x3    &mMat    = cJH.GetMatrixTransform();
-					const float         fBias   = cWeight.GetBias();
-
-					// Position
-					{ // vPositionT += ((mTrans*vPosition)+cJH.GetTranslationJointSpace())*fBias;
-						pfPosition[Vector3::X] += ((mMat.xx*fPositionX + mMat.xy*fPositionY + mMat.xz*fPositionZ) + vJH.x) * fBias;
-						pfPosition[Vector3::Y] += ((mMat.yx*fPositionX + mMat.yy*fPositionY + mMat.yz*fPositionZ) + vJH.y) * fBias;
-						pfPosition[Vector3::Z] += ((mMat.zx*fPositionX + mMat.zy*fPositionY + mMat.zz*fPositionZ) + vJH.z) * fBias;
-					}
-					// Normal
-					{ // vNormalT += (mMat*vNormal)*fBias;
-						pfNormalT[Vector3::X] += (mMat.xx*fNormalX + mMat.xy*fNormalY + mMat.xz*fNormalZ) * fBias;
-						pfNormalT[Vector3::Y] += (mMat.yx*fNormalX + mMat.yy*fNormalY + mMat.yz*fNormalZ) * fBias;
-						pfNormalT[Vector3::Z] += (mMat.zx*fNormalX + mMat.zy*fNormalY + mMat.zz*fNormalZ) * fBias;
-					}
-					{ // vTangentT += (mMat*vTangent)*fBias;
-						pfTangentT[Vector3::X] += (mMat.xx*fTangentX + mMat.xy*fTangentY + mMat.xz*fTangentZ) * fBias;
-						pfTangentT[Vector3::Y] += (mMat.yx*fTangentX + mMat.yy*fTangentY + mMat.yz*fTangentZ) * fBias;
-						pfTangentT[Vector3::Z] += (mMat.zx*fTangentX + mMat.zy*fTangentY + mMat.zz*fTangentZ) * fBias;
-					}
-				}
-			}
-
-			// Next position, please
-			pfPosition = reinterpret_cast<float*>(reinterpret_cast<char*>(pfPosition)+nVertexSize);
-
-			// Next normal, please
-			pfNormal = reinterpret_cast<const float*>(reinterpret_cast<const char*>(pfNormal)+nVertexSize);
-			pfNormalT = reinterpret_cast<float*>(reinterpret_cast<char*>(pfNormalT)+nVertexTSize);
-
-			// Next tangent, please
-			pfTangent = reinterpret_cast<const float*>(reinterpret_cast<const char*>(pfTangent)+nVertexSize);
-			pfTangentT = reinterpret_cast<float*>(reinterpret_cast<char*>(pfTangentT)+nVertexTSize);
 
-			// Next vertex weights
-			pVertexWeights++;
-		}
-	} else if (pfNormal && !pfTangent && pfBinormal) {
-		for (uint32 nVertex=0; nVertex<nNumOfVertices; nVertex++) {
-			const Array<uint32> &lstVWeights = pVertexWeights->GetWeights();
-			const uint32         nWeights    = lstVWeights.GetNumOfElements();
-			if (nWeights) {
-				// Get current vertex position
-				const float fPositionX = pfPosition[0];
-				const float fPositionY = pfPosition[1];
-				const float fPositionZ = pfPosition[2];
-				// Get current vertex normal
-				const float fNormalX = pfNormal[0];
-				const float fNormalY = pfNormal[1];
-				const float fNormalZ = pfNormal[2];
-				// Get current vertex binormal
-				const float fBinormalX = pfBinormal[0];
-				const float fBinormalY = pfBinormal[1];
-				const float fBinormalZ = pfBinormal[2];
-
-			// First weight
-				{
-					const Weight       &cWeight = lstWeights[lstVWeights[0]];
-					const JointHandler &cJH     = lstJointHandlers[cWeight.GetJoint()];
-					const Vector3      &vJH     = cJH.GetTranslationJointSpace();
-					const Matrix3x3    &mMat    = cJH.GetMatrixTransform();
-					const float         fBias   = cWeight.GetBias();
-					// vPositionT = ((mTrans*vPosition)+cJH.GetTranslationJointSpace())*fBias;
-					pfPosition[Vector3::X] = ((mMat.xx*fPositionX + mMat.xy*fPositionY + mMat.xz*fPositionZ) + vJH.x) * fBias;
-					pfPosition[Vector3::Y] = ((mMat.yx*fPositionX + mMat.yy*fPositionY + mMat.yz*fPositionZ) + vJH.y) * fBias;
-					pfPosition[Vector3::Z] = ((mMat.zx*fPositionX + mMat.zy*fPositionY + mMat.zz*fPositionZ) + vJH.z) * fBias;
-					// vNormalT = (mMat*vNormal)*fBias;
-					pfNormalT[Vector3::X] = (mMat.xx*fNormalX + mMat.xy*fNormalY + mMat.xz*fNormalZ) * fBias;
-					pfNormalT[Vector3::Y] = (mMat.yx*fNormalX + mMat.yy*fNormalY + mMat.yz*fNormalZ) * fBias;
-					pfNormalT[Vector3::Z] = (mMat.zx*fNormalX + mMat.zy*fNormalY + mMat.zz*fNormalZ) * fBias;
-					// vBinormalT = (mMat*vBinormal)*fBias;
-					pfBinormalT[Vector3::X] = (mMat.xx*fBinormalX + mMat.xy*fBinormalY + mMat.xz*fBinormalZ) * fBias;
-					pfBinormalT[Vector3::Y] = (mMat.yx*fBinormalX + mMat.yy*fBinormalY + mMat.yz*fBinormalZ) * fBias;
-					pfBinormalT[Vector3::Z] = (mMat.zx*fBinormalX + mMat.zy*fBinormalY + mMat.zz*fBinormalZ) * fBias;
-				}
+	// The last palette entry is an identity transform, used for vertices without weights and invalid joints
+	pfJoint[0] = 1.0f; pfJoint[1] = 0.0f; pfJoint[ 2] = 0.0f; pfJoint[ 3] = 0.0f;
+	pfJoint[4] = 0.0f; pfJoint[5] = 1.0f; pfJoint[ 6] = 0.0f; pfJoint[ 7] = 0.0f;
+	pfJoint[8] = 0.0f; pfJoint[9] = 0.0f; pfJoint[10] = 1.0f; pfJoint[11] = 0.0f;
 
-			// Add other weights
-				for (uint32 nWeight=1; nWeight<nWeights; nWeight++) {
-					const Weight       &cWeight = lstWeights[lstVWeights[nWeight]];
-					const JointHandler &cJH     = lstJointHandlers[cWeight.GetJoint()];
-					const Vector3      &vJH     = cJH.GetTranslationJointSpace();
-					const Matrix3x3    &mMat    = cJH.GetMatrixTransform();
-					const float         fBias   = cWeight.GetBias();
-
-					// Position
-					{ // vPositionT += ((mTrans*vPosition)+cJH.GetTranslationJointSpace())*fBias;
-						pfPosition[Vector3::X] += ((mMat.xx*fPositionX + mMat.xy*fPositionY + mMat.xz*fPositionZ) + vJH.x) * fBias;
-						pfPosition[Vector3::Y] += ((mMat.yx*fPositionX + mMat.yy*fPositionY + mMat.yz*fPositionZ) + vJH.y) * fBias;
-						pfPosition[Vector3::Z] += ((mMat.zx*fPositionX + mMat.zy*fPositionY + mMat.zz*fPositionZ) + vJH.z) * fBias;
-					}
-					// Normal
-					{ // vNormalT += (mMat*vNormal)*fBias;
-						pfNormalT[Vector3::X] += (mMat.xx*fNormalX + mMat.xy*fNormalY + mMat.xz*fNormalZ) * fBias;
-						pfNormalT[Vector3::Y] += (mMat.yx*fNormalX + mMat.yy*fNormalY + mMat.yz*fNormalZ) * fBias;
-						pfNormalT[Vector3::Z] += (mMat.zx*fNormalX + mMat.zy*fNormalY + mMat.zz*fNormalZ) * fBias;
-					}
-					{ // vBinormalT += (mMat*vBinormal)*fBias;
-						pfBinormalT[Vector3::X] += (mMat.xx*fBinormalX + mMat.xy*fBinormalY + mMat.xz*fBinormalZ) * fBias;
-						pfBinormalT[Vector3::Y] += (mMat.yx*fBinormalX + mMat.yy*fBinormalY + mMat.yz*fBinormalZ) * fBias;
-						pfBinormalT[Vector3::Z] += (mMat.zx*fBinormalX + mMat.zy*fBinormalY + mMat.zz*fBinormalZ) * fBias;
-					}
-				}
-			}
-
-			// Next position, please
-			pfPosition = reinterpret_cast<float*>(reinterpret_cast<char*>(pfPosition)+nVertexSize);
-
-			// Next normal, please
-			pfNormal = reinterpret_cast<const float*>(reinterpret_cast<const char*>(pfNormal)+nVertexSize);
-			pfNormalT = reinterpret_cast<float*>(reinterpret_cast<char*>(pfNormalT)+nVertexTSize);
-
-			// Next binormal, please
-			pfBinormal = reinterpret_cast<const float*>(reinterpret_cast<const char*>(pfBinormal)+nVertexSize);
-			pfBinormalT = reinterpret_cast<float*>(reinterpret_cast<char*>(pfBinormalT)+nVertexTSize);
-
-			// Next vertex weights
-			pVertexWeights++;
-		}
-	} else { // Fallback for unusual combinations...
-		Vector3 vPos, vV;
-		for (uint32 nVertex=0; nVertex<nNumOfVertices; nVertex++) {
-			const Array<uint32> &lstVWeights = pVertexWeights->GetWeights();
-
-		// Position
-			// Get current vertex position
-			vV.x = pfPosition[0];
-			vV.y = pfPosition[1];
-			vV.z = pfPosition[2];
-
-			// Add weights
-			vPos = Vector3::Zero;
-			const uint32 nWeights = lstVWeights.GetNumOfElements();
-			for (uint32 nWeight=0; nWeight<nWeights; nWeight++) {
-				const Weight       &cWeight = lstWeights[lstVWeights[nWeight]];
-				const JointHandler &cJH     = lstJointHandlers[cWeight.GetJoint()];
-				const Matrix3x3    &mTrans  = cJH.GetMatrixTransform();
-				vPos += ((mTrans*vV)+cJH.GetTranslationJointSpace())*cWeight.GetBias();
-			}
-
-			// Set new vertex position
-			pfPosition[Vector3::X] = vPos.x;
-			pfPosition[Vector3::Y] = vPos.y;
-			pfPosition[Vector3::Z] = vPos.z;
-			// Next position, please
-			pfPosition = reinterpret_cast<float*>(reinterpret_cast<char*>(pfPosition)+nVertexSize);
-
-		// Normal
-			if (pfNormal) {
-				// Get current vertex normal
-				vV.x = pfNormal[0];
-				vV.y = pfNormal[1];
-				vV.z = pfNormal[2];
-
-				// Add weights
-				vPos = Vector3::Zero;
-				for (uint32 nWeight=0; nWeight<nWeights; nWeight++) {
-					const Weight       &cWeight = lstWeights[lstVWeights[nWeight]];
-					const JointHandler &cJH     = lstJointHandlers[cWeight.GetJoint()];
-					const Matrix3x3    &mTrans  = cJH.GetMatrixTransform();
-					vPos += (mTrans*vV)*cWeight.GetBias();
-				}
-
-				// Set new vertex normal
-				pfNormalT[Vector3::X] = vPos.x;
-				pfNormalT[Vector3::Y] = vPos.y;
-				pfNormalT[Vector3::Z] = vPos.z;
-				// Next normal, please
-				pfNormal = reinterpret_cast<const float*>(reinterpret_cast<const char*>(pfNormal)+nVertexSize);
-				pfNormalT = reinterpret_cast<float*>(reinterpret_cast<char*>(pfNormalT)+nVertexTSize);
-			}
-
-		// Tangent
-			if (pfTangent) {
-				// Get current vertex tangent
-				vV.x = pfTangent[0];
-				vV.y = pfTangent[1];
-				vV.z = pfTangent[2];
-
-				// Add weights
-				vPos = Vector3::Zero;
-				for (uint32 nWeight=0; nWeight<nWeights; nWeight++) {
-					const Weight       &cWeight = lstWeights[lstVWeights[nWeight]];
-					const JointHandler &cJH     = lstJointHandlers[cWeight.GetJoint()];
-					const Matrix3x3    &mTrans  = cJH.GetMatrixTransform();
-					vPos += (mTrans*vV)*cWeight.GetBias();
-				}
+	// Done, the vertices have to be skinned
+	sData.bSkinningRequired = true;
+	return true;
+}
 
-				// Set new vertex tangent
-				pfTangentT[Vector3::X] = vPos.x;
-				pfTangentT[Vector3::Y] = vPos.y;
-				pfTangentT[Vector3::Z] = vPos.z;
-				// Next tangent, please
-				pfTangent = reinterpret_cast<const float*>(reinterpret_cast<const char*>(pfTangent)+nVertexSize);
-				pfTangentT = reinterpret_cast<float*>(reinterpret_cast<char*>(pfTangentT)+nVertexTSize);
-			}
+/**
+*  @brief
+*    Updates the joint index and bias streams
+*/
+void MeshAnimationManagerSoftware::UpdateStreams(Mesh &cMesh, const VertexBuffer &cVertexBuffer, uint32 nNumOfVertices, uint32 nNumOfJoints) const
+{
+	const Array<Weight>		   &lstWeights		 = cMesh.GetWeights();
+	const Array<VertexWeights> &lstVertexWeights = cMesh.GetVertexWeights();
+
+	// Are the streams still up-to-date?
+	if (m_pStreamVertexBuffer == &cVertexBuffer && m_nStreamNumOfVertices == nNumOfVertices && m_nStreamNumOfWeights == lstWeights.GetNumOfElements() && m_nStreamNumOfJoints == nNumOfJoints)
+		return; // Nothing to do
+
+	// Get the maximum number of weights per vertex, vertices without vertex weights are handled like vertices with one weight
+	const uint32 nNumOfVertexWeights = Math::Min(nNumOfVertices, lstVertexWeights.GetNumOfElements());
+	uint32 nNumOfInfluences = 1;
+	for (uint32 nVertex=0; nVertex<nNumOfVertexWeights; nVertex++) {
+		const uint32 nWeights = lstVertexWeights[nVertex].GetWeights().GetNumOfElements();
+		if (nNumOfInfluences < nWeights)
+			nNumOfInfluences = nWeights;
+	}
 
-		// Binormal
-			if (pfBinormal) {
-				// Get current vertex binormal
-				vV.x = pfBinormal[0];
-				vV.y = pfBinormal[1];
-				vV.z = pfBinormal[2];
-
-				// Add weights
-				vPos = Vector3::Zero;
-				for (uint32 nWeight=0; nWeight<nWeights; nWeight++) {
-					const Weight       &cWeight = lstWeights[lstVWeights[nWeight]];
-					const JointHandler &cJH     = lstJointHandlers[cWeight.GetJoint()];
-					const Matrix3x3    &mTrans  = cJH.GetMatrixTransform();
-					vPos += (mTrans*vV)*cWeight.GetBias();
-				}
+	// Allocate the streams, unused stream elements are using the identity transform with a bias of zero
+	const uint32 nStreamSize = (nNumOfVertices + 3) & ~3;
+	m_lstJointStream.Resize(nNumOfInfluences*nStreamSize);
+	m_lstBiasStream. Resize(nNumOfInfluences*nStreamSize);
+	uint32 *pnJoints = m_lstJointStream.GetData();
+	float  *pfBiases = m_lstBiasStream. GetData();
+	for (uint32 i=0; i<nNumOfInfluences*nStreamSize; i++) {
+		pnJoints[i] = nNumOfJoints;
+		pfBiases[i] = 0.0f;
+	}
 
-				// Set new vertex binormal
-				pfBinormalT[Vector3::X] = vPos.x;
-				pfBinormalT[Vector3::Y] = vPos.y;
-				pfBinormalT[Vector3::Z] = vPos.z;
-				// Next binormal, please
-				pfBinormal = reinterpret_cast<const float*>(reinterpret_cast<const char*>(pfBinormal)+nVertexSize);
-				pfBinormalT = reinterpret_cast<float*>(reinterpret_cast<char*>(pfBinormalT)+nVertexTSize);
+	// Fill the streams
+	for (uint32 nVertex=0; nVertex<nNumOfVertices; nVertex++) {
+		if (nVertex < nNumOfVertexWeights && lstVertexWeights[nVertex].GetWeights().GetNumOfElements()) {
+			const Array<uint32> &lstVWeights = lstVertexWeights[nVertex].GetWeights();
+			for (uint32 nWeight=0; nWeight<lstVWeights.GetNumOfElements(); nWeight++) {
+				// An invalid joint index results in the identity transform, just like the default joint handler
+				const Weight &cWeight = lstWeights[lstVWeights[nWeight]];
+				const int     nJoint  = cWeight.GetJoint();
+				pnJoints[nWeight*nStreamSize + nVertex] = (nJoint >= 0 && static_cast<uint32>(nJoint) < nNumOfJoints) ? nJoint : nNumOfJoints;
+				pfBiases[nWeight*nStreamSize + nVertex] = cWeight.GetBias();
 			}
-
-			// Next vertex weights
-			pVertexWeights++;
+		} else {
+			// No weights, keep the vertex as it is
+			pfBiases[nVertex] = 1.0f;
 		}
 	}
 
-	// Unlock the vertex buffers
-	pVB->Unlock();
-	pVBT->Unlock();
+	// Backup the stream information
+	m_pStreamVertexBuffer  = &cVertexBuffer;
+	m_nStreamNumOfVertices = nNumOfVertices;
+	m_nStreamNumOfWeights  = lstWeights.GetNumOfElements();
+	m_nStreamNumOfJoints   = nNumOfJoints;
+	m_nNumOfInfluences	   = nNumOfInfluences;
+	m_nStreamSize		   = nStreamSize;
+}
 
-	// Done
-	return true;
+/**
+*  @brief
+*    Invalidates the joint index and bias streams
+*/
+void MeshAnimationManagerSoftware::InvalidateStreams()
+{
+	m_pStreamVertexBuffer  = nullptr;
+	m_nStreamNumOfVertices = 0;
+	m_nStreamNumOfWeights  = 0;
+	m_nStreamNumOfJoints   = 0;
+	m_nNumOfInfluences	   = 0;
+	m_nStreamSize		   = 0;
+	m_lstJointStream.Clear();
+	m_lstBiasStream.Clear();
 }
 
 
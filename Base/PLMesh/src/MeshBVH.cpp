@@ -0,0 +1,742 @@
+/*********************************************************\
+ *  File: MeshBVH.cpp                                    *
+ *
+ *  Copyright (C) 2002-2013 The PixelLight Team (http://www.pixellight.org/)
+ *
+ *  This file is part of PixelLight.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ *  and associated documentation files (the "Software"), to deal in the Software without
+ *  restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ *  Software is furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all copies or
+ *  substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ *  BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ *  DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ *  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include <PLCore/Container/Bitset.h>
+#include <PLCore/Core/MemoryManager.h>
+#include <PLMath/Math.h>
+#include <PLMath/Vector3.h>
+#include <PLRenderer/Renderer/IndexBuffer.h>
+#include <PLRenderer/Renderer/VertexBuffer.h>
+#include "PLMesh/Geometry.h"
+#include "PLMesh/MeshLODLevel.h"
+#include "PLMesh/MeshBVH.h"
+#ifdef PLMATH_SSE
+	#include <xmmintrin.h>
+#endif
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+using namespace PLCore;
+using namespace PLMath;
+using namespace PLRenderer;
+namespace PLMesh {
+
+
+//[-------------------------------------------------------]
+//[ Local definitions                                     ]
+//[-------------------------------------------------------]
+static const float Huge = 1e30f;	/**< Used instead of infinity for the line parameter and for inverse direction components of zero */
+
+
+//[-------------------------------------------------------]
+//[ Local functions                                       ]
+//[-------------------------------------------------------]
+/**
+*  @brief
+*    Returns half of the surface area of a bounding box
+*/
+static inline float GetHalfArea(const float fMin[3], const float fMax[3])
+{
+	const float fX = fMax[0] - fMin[0];
+	const float fY = fMax[1] - fMin[1];
+	const float fZ = fMax[2] - fMin[2];
+	return fX*fY + fY*fZ + fZ*fX;
+}
+
+/**
+*  @brief
+*    Intersects a line with a node bounding box and returns the distance of the line parameter interval within the box to the line start
+*
+*  @return
+*    'true' if the line intersects the box, else 'false'
+*/
+static inline bool IntersectBox(const float fMin[3], const float fMax[3], const float fOrigin[3], const float fInvDirection[3], float &fDistance)
+{
+	float fNear = -Huge;
+	float fFar  =  Huge;
+	for (uint32 i=0; i<3; i++) {
+		float fT1 = (fMin[i] - fOrigin[i])*fInvDirection[i];
+		float fT2 = (fMax[i] - fOrigin[i])*fInvDirection[i];
+		if (fT1 > fT2) {
+			const float fT = fT1;
+			fT1 = fT2;
+			fT2 = fT;
+		}
+		if (fT1 > fNear)
+			fNear = fT1;
+		if (fT2 < fFar)
+			fFar = fT2;
+	}
+	if (fNear > fFar)
+		return false; // No intersection
+
+	// The line is infinite in both directions, so the distance is the one of the interval end nearest to zero
+	fDistance = (fNear > 0.0f) ? fNear : ((fFar < 0.0f) ? -fFar : 0.0f);
+	return true;
+}
+
+
+//[-------------------------------------------------------]
+//[ Public functions                                      ]
+//[-------------------------------------------------------]
+/**
+*  @brief
+*    Constructor
+*/
+MeshBVH::MeshBVH() :
+	m_pMeshLODLevel(nullptr),
+	m_pVertexBuffer(nullptr),
+	m_nNumOfVertices(0)
+{
+}
+
+/**
+*  @brief
+*    Destructor
+*/
+MeshBVH::~MeshBVH()
+{
+}
+
+/**
+*  @brief
+*    Builds the bounding volume hierarchy
+*/
+bool MeshBVH::Build(const MeshLODLevel &cMeshLODLevel, VertexBuffer &cVertexBuffer)
+{
+	// Destroy the previous hierarchy
+	Clear();
+
+	// Check the mesh LOD level
+	IndexBuffer *pIndexBuffer = cMeshLODLevel.GetIndexBuffer();
+	const Array<Geometry> *plstGeometries = cMeshLODLevel.GetGeometries();
+	if (!pIndexBuffer || !plstGeometries)
+		return false; // Error!
+
+	// Gather the triangles of all geometries, lock the index buffer once so that "MeshLODLevel::GetTriangle()" doesn't need to do this for each triangle
+	const uint32 nNumOfVertices = cVertexBuffer.GetNumOfElements();
+	if (!pIndexBuffer->Lock(Lock::ReadOnly))
+		return false; // Error!
+	m_lstTriangles.Resize(cMeshLODLevel.GetNumOfTriangles(), false);
+	for (uint32 nGeometry=0; nGeometry<plstGeometries->GetNumOfElements(); nGeometry++) {
+		const uint32 nNumOfTriangles = plstGeometries->Get(nGeometry).GetNumOfTriangles();
+		for (uint32 nTriangle=0; nTriangle<nNumOfTriangles; nTriangle++) {
+			uint32 nVertex1, nVertex2, nVertex3;
+			if (cMeshLODLevel.GetTriangle(nGeometry, nTriangle, nVertex1, nVertex2, nVertex3) &&
+				nVertex1 < nNumOfVertices && nVertex2 < nNumOfVertices && nVertex3 < nNumOfVertices) {
+				Triangle &sTriangle = m_lstTriangles.Add();
+				sTriangle.nGeometry  = nGeometry;
+				sTriangle.nTriangle  = nTriangle;
+				sTriangle.nVertex[0] = nVertex1;
+				sTriangle.nVertex[1] = nVertex2;
+				sTriangle.nVertex[2] = nVertex3;
+			}
+		}
+	}
+	pIndexBuffer->Unlock();
+	const uint32 nNumOfTriangles = m_lstTriangles.GetNumOfElements();
+	if (!nNumOfTriangles)
+		return false; // Error!
+
+	// Get the vertex positions
+	if (!cVertexBuffer.Lock(Lock::ReadOnly)) {
+		Clear();
+
+		// Error!
+		return false;
+	}
+	const char *pFirstVertex = static_cast<const char*>(cVertexBuffer.GetData(0, VertexBuffer::Position));
+	if (!pFirstVertex) {
+		cVertexBuffer.Unlock();
+		Clear();
+
+		// Error!
+		return false;
+	}
+	const uint32 nVertexSize = cVertexBuffer.GetVertexSize();
+
+	// Setup the build information of the triangles
+	Array<BuildTriangle> lstBuildTriangles;
+	lstBuildTriangles.Resize(nNumOfTriangles);
+	BuildTriangle *pBuildTriangle = lstBuildTriangles.GetData();
+	const Triangle *pTriangle = m_lstTriangles.GetData();
+	for (uint32 i=0; i<nNumOfTriangles; i++, pBuildTriangle++, pTriangle++) {
+		const float *pfVertex = reinterpret_cast<const float*>(pFirstVertex + nVertexSize*pTriangle->nVertex[0]);
+		for (uint32 nAxis=0; nAxis<3; nAxis++)
+			pBuildTriangle->fMin[nAxis] = pBuildTriangle->fMax[nAxis] = pfVertex[nAxis];
+		for (uint32 nVertex=1; nVertex<3; nVertex++) {
+			pfVertex = reinterpret_cast<const float*>(pFirstVertex + nVertexSize*pTriangle->nVertex[nVertex]);
+			for (uint32 nAxis=0; nAxis<3; nAxis++) {
+				if (pBuildTriangle->fMin[nAxis] > pfVertex[nAxis])
+					pBuildTriangle->fMin[nAxis] = pfVertex[nAxis];
+				if (pBuildTriangle->fMax[nAxis] < pfVertex[nAxis])
+					pBuildTriangle->fMax[nAxis] = pfVertex[nAxis];
+			}
+		}
+		for (uint32 nAxis=0; nAxis<3; nAxis++)
+			pBuildTriangle->fCenter[nAxis] = (pBuildTriangle->fMin[nAxis] + pBuildTriangle->fMax[nAxis])*0.5f;
+		pBuildTriangle->nTriangle = i;
+	}
+
+	// Build the hierarchy, there are at most two nodes and one triangle pack per triangle so there's no reallocation while building
+	m_lstNodes.Resize(nNumOfTriangles*2, false);
+	m_lstPacks.Resize(nNumOfTriangles, false);
+	m_lstNodes.Add();
+	BuildNode(0, lstBuildTriangles, 0, nNumOfTriangles, 0);
+
+	// Write the vertex positions into the triangle packs and calculate the node bounding boxes
+	UpdatePositions(pFirstVertex, nVertexSize);
+	cVertexBuffer.Unlock();
+
+	// Done
+	m_pMeshLODLevel  = &cMeshLODLevel;
+	m_pVertexBuffer  = &cVertexBuffer;
+	m_nNumOfVertices = nNumOfVertices;
+	return true;
+}
+
+/**
+*  @brief
+*    Refits the bounding volume hierarchy to changed vertex positions
+*/
+bool MeshBVH::Refit(VertexBuffer &cVertexBuffer)
+{
+	// Check whether there's a hierarchy which can be refitted with the given vertex buffer
+	if (!m_lstNodes.GetNumOfElements() || cVertexBuffer.GetNumOfElements() != m_nNumOfVertices)
+		return false; // Error!
+
+	// Get the vertex positions
+	if (!cVertexBuffer.Lock(Lock::ReadOnly))
+		return false; // Error!
+	const char *pFirstVertex = static_cast<const char*>(cVertexBuffer.GetData(0, VertexBuffer::Position));
+	if (pFirstVertex) {
+		// Update the triangle packs and the node bounding boxes
+		UpdatePositions(pFirstVertex, cVertexBuffer.GetVertexSize());
+		m_pVertexBuffer = &cVertexBuffer;
+	}
+	cVertexBuffer.Unlock();
+
+	// Done
+	return (pFirstVertex != nullptr);
+}
+
+/**
+*  @brief
+*    Clears the bounding volume hierarchy
+*/
+void MeshBVH::Clear()
+{
+	m_pMeshLODLevel  = nullptr;
+	m_pVertexBuffer  = nullptr;
+	m_nNumOfVertices = 0;
+	m_lstTriangles.Clear();
+	m_lstPacks.Clear();
+	m_lstNodes.Clear();
+}
+
+/**
+*  @brief
+*    Returns the mesh LOD level the bounding volume hierarchy was built for
+*/
+const MeshLODLevel *MeshBVH::GetMeshLODLevel() const
+{
+	return m_pMeshLODLevel;
+}
+
+/**
+*  @brief
+*    Returns the vertex buffer the bounding volume hierarchy was built or refitted with
+*/
+const VertexBuffer *MeshBVH::GetVertexBuffer() const
+{
+	return m_pVertexBuffer;
+}
+
+/**
+*  @brief
+*    Returns the number of nodes
+*/
+uint32 MeshBVH::GetNumOfNodes() const
+{
+	return m_lstNodes.GetNumOfElements();
+}
+
+/**
+*  @brief
+*    Returns the number of triangles
+*/
+uint32 MeshBVH::GetNumOfTriangles() const
+{
+	return m_lstTriangles.GetNumOfElements();
+}
+
+/**
+*  @brief
+*    Returns the triangle intersecting the line which is nearest to the line start position
+*/
+bool MeshBVH::FindTriangle(const Vector3 &vLineStartPos, const Vector3 &vLineEndPos, const Array<Geometry> &lstGeometries, const Bitset *pGeometries,
+						   Cull::Enum nCull, uint32 &nTriangle, uint32 &nGeometry, Vector3 &vCollisionPoint) const
+{
+	// Is there a hierarchy?
+	if (!m_lstNodes.GetNumOfElements())
+		return false;
+
+	// Setup the line
+	const float fOrigin[3]	  = { vLineStartPos.x, vLineStartPos.y, vLineStartPos.z };
+	const float fDirection[3] = { vLineEndPos.x - vLineStartPos.x, vLineEndPos.y - vLineStartPos.y, vLineEndPos.z - vLineStartPos.z };
+	float fInvDirection[3];
+	for (uint32 i=0; i<3; i++)
+		fInvDirection[i] = fDirection[i] ? 1.0f/fDirection[i] : Huge;
+
+	// The nearest intersection so far, the distance is the absolute line parameter
+	float fNearestDistance = Huge;
+	float fNearestT = 0.0f;
+	const Triangle *pNearestTriangle = nullptr;
+
+	// Get the data
+	const Node		   *pNodes	   = m_lstNodes.GetData();
+	const TrianglePack *pPacks	   = m_lstPacks.GetData();
+	const Triangle	   *pTriangles = m_lstTriangles.GetData();
+
+	#ifdef PLMATH_SSE
+		// SSE method, the line is tested against the four triangles of a triangle pack at once
+		const __m128 vOriginX	 = _mm_set1_ps(fOrigin[0]);
+		const __m128 vOriginY	 = _mm_set1_ps(fOrigin[1]);
+		const __m128 vOriginZ	 = _mm_set1_ps(fOrigin[2]);
+		const __m128 vDirectionX = _mm_set1_ps(fDirection[0]);
+		const __m128 vDirectionY = _mm_set1_ps(fDirection[1]);
+		const __m128 vDirectionZ = _mm_set1_ps(fDirection[2]);
+		const __m128 vZero		 = _mm_setzero_ps();
+		const __m128 vOne		 = _mm_set1_ps(1.0f);
+		const __m128 vSignMask	 = _mm_set1_ps(-0.0f);
+	#endif
+
+	// Traverse the hierarchy, nearer children first so that farther ones can often be skipped
+	uint32 nStackNode[MaxDepth + 2];
+	float  fStackDistance[MaxDepth + 2];
+	uint32 nStackSize = 0;
+	float fDistance;
+	if (IntersectBox(pNodes[0].fMin, pNodes[0].fMax, fOrigin, fInvDirection, fDistance)) {
+		nStackNode[0]	  = 0;
+		fStackDistance[0] = fDistance;
+		nStackSize		  = 1;
+	}
+	while (nStackSize) {
+		// Get the next node, skip it if it can't contain a nearer intersection anymore
+		nStackSize--;
+		if (fStackDistance[nStackSize] > fNearestDistance)
+			continue;
+		const Node &sNode = pNodes[nStackNode[nStackSize]];
+
+		// Leaf?
+		if (sNode.nNumOfTriangles) {
+			const uint32 nNumOfPacks = (sNode.nNumOfTriangles + 3)/4;
+			for (uint32 nPack=0; nPack<nNumOfPacks; nPack++) {
+				const TrianglePack &sPack = pPacks[sNode.nIndex + nPack];
+
+				#ifdef PLMATH_SSE
+					// Moeller-Trumbore for four triangles at once
+					const __m128 vE1X = _mm_loadu_ps(sPack.fE1[0]);
+					const __m128 vE1Y = _mm_loadu_ps(sPack.fE1[1]);
+					const __m128 vE1Z = _mm_loadu_ps(sPack.fE1[2]);
+					const __m128 vE2X = _mm_loadu_ps(sPack.fE2[0]);
+					const __m128 vE2Y = _mm_loadu_ps(sPack.fE2[1]);
+					const __m128 vE2Z = _mm_loadu_ps(sPack.fE2[2]);
+
+					// P = direction x E2
+					const __m128 vPX = _mm_sub_ps(_mm_mul_ps(vDirectionY, vE2Z), _mm_mul_ps(vDirectionZ, vE2Y));
+					const __m128 vPY = _mm_sub_ps(_mm_mul_ps(vDirectionZ, vE2X), _mm_mul_ps(vDirectionX, vE2Z));
+					const __m128 vPZ = _mm_sub_ps(_mm_mul_ps(vDirectionX, vE2Y), _mm_mul_ps(vDirectionY, vE2X));
+
+					// Determinant = E1 . P, zero if the line is parallel to the triangle or the slot is unused
+					const __m128 vDeterminant = _mm_add_ps(_mm_add_ps(_mm_mul_ps(vE1X, vPX), _mm_mul_ps(vE1Y, vPY)), _mm_mul_ps(vE1Z, vPZ));
+					__m128 vMask = _mm_cmpneq_ps(vDeterminant, vZero);
+
+					// Perform culling? The face normal is E1 x E2, so the determinant is the negative dot product of face normal and direction.
+					if (nCull == Cull::CW)
+						vMask = _mm_and_ps(vMask, _mm_cmple_ps(vDeterminant, vZero));
+					else if (nCull == Cull::CCW)
+						vMask = _mm_and_ps(vMask, _mm_cmpge_ps(vDeterminant, vZero));
+					if (!_mm_movemask_ps(vMask))
+						continue;
+					const __m128 vInvDeterminant = _mm_div_ps(vOne, vDeterminant);
+
+					// S = origin - V0
+					const __m128 vSX = _mm_sub_ps(vOriginX, _mm_loadu_ps(sPack.fV0[0]));
+					const __m128 vSY = _mm_sub_ps(vOriginY, _mm_loadu_ps(sPack.fV0[1]));
+					const __m128 vSZ = _mm_sub_ps(vOriginZ, _mm_loadu_ps(sPack.fV0[2]));
+
+					// Q = S x E1
+					const __m128 vQX = _mm_sub_ps(_mm_mul_ps(vSY, vE1Z), _mm_mul_ps(vSZ, vE1Y));
+					const __m128 vQY = _mm_sub_ps(_mm_mul_ps(vSZ, vE1X), _mm_mul_ps(vSX, vE1Z));
+					const __m128 vQZ = _mm_sub_ps(_mm_mul_ps(vSX, vE1Y), _mm_mul_ps(vSY, vE1X));
+
+					// Barycentric coordinates and line parameter
+					const __m128 vU = _mm_mul_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(vSX, vPX), _mm_mul_ps(vSY, vPY)), _mm_mul_ps(vSZ, vPZ)), vInvDeterminant);
+					const __m128 vV = _mm_mul_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(vDirectionX, vQX), _mm_mul_ps(vDirectionY, vQY)), _mm_mul_ps(vDirectionZ, vQZ)), vInvDeterminant);
+					const __m128 vT = _mm_mul_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(vE2X, vQX), _mm_mul_ps(vE2Y, vQY)), _mm_mul_ps(vE2Z, vQZ)), vInvDeterminant);
+					vMask = _mm_and_ps(vMask, _mm_cmpge_ps(vU, vZero));
+					vMask = _mm_and_ps(vMask, _mm_cmpge_ps(vV, vZero));
+					vMask = _mm_and_ps(vMask, _mm_cmple_ps(_mm_add_ps(vU, vV), vOne));
+					vMask = _mm_and_ps(vMask, _mm_cmplt_ps(_mm_andnot_ps(vSignMask, vT), _mm_set1_ps(fNearestDistance)));
+					int nHits = _mm_movemask_ps(vMask);
+					if (nHits) {
+						float fT[4];
+						_mm_storeu_ps(fT, vT);
+						for (uint32 nSlot=0; nHits; nSlot++, nHits>>=1) {
+							if (nHits & 1) {
+								// Check the owner geometry and whether this intersection is still the nearest one
+								const Triangle &sTriangle = pTriangles[sPack.nTriangle[nSlot]];
+								const float fCurrentDistance = Math::Abs(fT[nSlot]);
+								if (fCurrentDistance < fNearestDistance && lstGeometries[sTriangle.nGeometry].IsActive() &&
+									(!pGeometries || pGeometries->IsSet(sTriangle.nGeometry))) {
+									fNearestDistance = fCurrentDistance;
+									fNearestT		 = fT[nSlot];
+									pNearestTriangle = &sTriangle;
+								}
+							}
+						}
+					}
+				#else
+					// C++ method, Moeller-Trumbore for each of the four triangles
+					for (uint32 nSlot=0; nSlot<4; nSlot++) {
+						const float fE1[3] = { sPack.fE1[0][nSlot], sPack.fE1[1][nSlot], sPack.fE1[2][nSlot] };
+						const float fE2[3] = { sPack.fE2[0][nSlot], sPack.fE2[1][nSlot], sPack.fE2[2][nSlot] };
+
+						// P = direction x E2
+						const float fP[3] = { fDirection[1]*fE2[2] - fDirection[2]*fE2[1],
+											  fDirection[2]*fE2[0] - fDirection[0]*fE2[2],
+											  fDirection[0]*fE2[1] - fDirection[1]*fE2[0] };
+
+						// Determinant = E1 . P, zero if the line is parallel to the triangle or the slot is unused
+						const float fDeterminant = fE1[0]*fP[0] + fE1[1]*fP[1] + fE1[2]*fP[2];
+						if (!fDeterminant)
+							continue;
+
+						// Perform culling? The face normal is E1 x E2, so the determinant is the negative dot product of face normal and direction.
+						if ((nCull == Cull::CW && fDeterminant > 0.0f) || (nCull == Cull::CCW && fDeterminant < 0.0f))
+							continue;
+						const float fInvDeterminant = 1.0f/fDeterminant;
+
+						// S = origin - V0
+						const float fS[3] = { fOrigin[0] - sPack.fV0[0][nSlot], fOrigin[1] - sPack.fV0[1][nSlot], fOrigin[2] - sPack.fV0[2][nSlot] };
+
+						// Barycentric coordinates
+						const float fU = (fS[0]*fP[0] + fS[1]*fP[1] + fS[2]*fP[2])*fInvDeterminant;
+						if (fU < 0.0f || fU > 1.0f)
+							continue;
+						const float fQ[3] = { fS[1]*fE1[2] - fS[2]*fE1[1],
+											  fS[2]*fE1[0] - fS[0]*fE1[2],
+											  fS[0]*fE1[1] - fS[1]*fE1[0] };
+						const float fV = (fDirection[0]*fQ[0] + fDirection[1]*fQ[1] + fDirection[2]*fQ[2])*fInvDeterminant;
+						if (fV < 0.0f || fU + fV > 1.0f)
+							continue;
+
+						// Line parameter, check the owner geometry and whether this intersection is the nearest one
+						const float fT = (fE2[0]*fQ[0] + fE2[1]*fQ[1] + fE2[2]*fQ[2])*fInvDeterminant;
+						const float fCurrentDistance = Math::Abs(fT);
+						if (fCurrentDistance < fNearestDistance) {
+							const Triangle &sTriangle = pTriangles[sPack.nTriangle[nSlot]];
+							if (lstGeometries[sTriangle.nGeometry].IsActive() && (!pGeometries || pGeometries->IsSet(sTriangle.nGeometry))) {
+								fNearestDistance = fCurrentDistance;
+								fNearestT		 = fT;
+								pNearestTriangle = &sTriangle;
+							}
+						}
+					}
+				#endif
+			}
+		} else {
+			// Inner node, push the children which are intersected, the nearer one is pushed last so it's processed first
+			float fDistance1, fDistance2;
+			const Node &sChild1 = pNodes[sNode.nIndex];
+			const Node &sChild2 = pNodes[sNode.nIndex + 1];
+			const bool bChild1 = IntersectBox(sChild1.fMin, sChild1.fMax, fOrigin, fInvDirection, fDistance1) && fDistance1 <= fNearestDistance;
+			const bool bChild2 = IntersectBox(sChild2.fMin, sChild2.fMax, fOrigin, fInvDirection, fDistance2) && fDistance2 <= fNearestDistance;
+			if (bChild1 && bChild2) {
+				const bool bChild1First = (fDistance1 <= fDistance2);
+				nStackNode[nStackSize]		= bChild1First ? sNode.nIndex + 1 : sNode.nIndex;
+				fStackDistance[nStackSize]	= bChild1First ? fDistance2 : fDistance1;
+				nStackSize++;
+				nStackNode[nStackSize]		= bChild1First ? sNode.nIndex : sNode.nIndex + 1;
+				fStackDistance[nStackSize]	= bChild1First ? fDistance1 : fDistance2;
+				nStackSize++;
+			} else if (bChild1) {
+				nStackNode[nStackSize]	   = sNode.nIndex;
+				fStackDistance[nStackSize] = fDistance1;
+				nStackSize++;
+			} else if (bChild2) {
+				nStackNode[nStackSize]	   = sNode.nIndex + 1;
+				fStackDistance[nStackSize] = fDistance2;
+				nStackSize++;
+			}
+		}
+	}
+
+	// Was a triangle found?
+	if (!pNearestTriangle)
+		return false;
+	nTriangle		  = pNearestTriangle->nTriangle;
+	nGeometry		  = pNearestTriangle->nGeometry;
+	vCollisionPoint.x = fOrigin[0] + fDirection[0]*fNearestT;
+	vCollisionPoint.y = fOrigin[1] + fDirection[1]*fNearestT;
+	vCollisionPoint.z = fOrigin[2] + fDirection[2]*fNearestT;
+
+	// Done
+	return true;
+}
+
+
+//[-------------------------------------------------------]
+//[ Private functions                                     ]
+//[-------------------------------------------------------]
+/**
+*  @brief
+*    Copy constructor
+*/
+MeshBVH::MeshBVH(const MeshBVH &cSource) :
+	m_pMeshLODLevel(nullptr),
+	m_pVertexBuffer(nullptr),
+	m_nNumOfVertices(0)
+{
+	// No implementation because the copy constructor is never used
+}
+
+/**
+*  @brief
+*    Copy operator
+*/
+MeshBVH &MeshBVH::operator =(const MeshBVH &cSource)
+{
+	// No implementation because the copy operator is never used
+	return *this;
+}
+
+/**
+*  @brief
+*    Builds a node recursively
+*/
+void MeshBVH::BuildNode(uint32 nNode, Array<BuildTriangle> &lstBuildTriangles, uint32 nFirst, uint32 nNumOfTriangles, uint32 nDepth)
+{
+	BuildTriangle *pBuildTriangles = lstBuildTriangles.GetData() + nFirst;
+
+	// Create a leaf?
+	if (nNumOfTriangles <= MaxLeafTriangles || nDepth >= MaxDepth) {
+		Node &sNode = m_lstNodes[nNode];
+		sNode.nIndex		  = m_lstPacks.GetNumOfElements();
+		sNode.nNumOfTriangles = nNumOfTriangles;
+		const uint32 nNumOfPacks = (nNumOfTriangles + 3)/4;
+		for (uint32 nPack=0; nPack<nNumOfPacks; nPack++) {
+			// The positions are written by "UpdatePositions()", unused slots keep their zero edges
+			TrianglePack &sPack = m_lstPacks.Add();
+			MemoryManager::Set(&sPack, 0, sizeof(TrianglePack));
+			for (uint32 nSlot=0; nSlot<4; nSlot++) {
+				const uint32 i = nPack*4 + nSlot;
+				sPack.nTriangle[nSlot] = pBuildTriangles[(i < nNumOfTriangles) ? i : 0].nTriangle;
+			}
+		}
+
+		// Done
+		return;
+	}
+
+	// Get the bounding box of the triangle centers and use the longest axis for splitting
+	float fCenterMin[3], fCenterMax[3];
+	for (uint32 nAxis=0; nAxis<3; nAxis++)
+		fCenterMin[nAxis] = fCenterMax[nAxis] = pBuildTriangles[0].fCenter[nAxis];
+	for (uint32 i=1; i<nNumOfTriangles; i++) {
+		for (uint32 nAxis=0; nAxis<3; nAxis++) {
+			if (fCenterMin[nAxis] > pBuildTriangles[i].fCenter[nAxis])
+				fCenterMin[nAxis] = pBuildTriangles[i].fCenter[nAxis];
+			if (fCenterMax[nAxis] < pBuildTriangles[i].fCenter[nAxis])
+				fCenterMax[nAxis] = pBuildTriangles[i].fCenter[nAxis];
+		}
+	}
+	uint32 nAxis = 0;
+	if (fCenterMax[1] - fCenterMin[1] > fCenterMax[nAxis] - fCenterMin[nAxis])
+		nAxis = 1;
+	if (fCenterMax[2] - fCenterMin[2] > fCenterMax[nAxis] - fCenterMin[nAxis])
+		nAxis = 2;
+	const float fExtent = fCenterMax[nAxis] - fCenterMin[nAxis];
+
+	// Split the triangles
+	uint32 nNumOfLeftTriangles = nNumOfTriangles/2;
+	if (fExtent > 0.0f) {
+		// Sort the triangles into bins along the split axis
+		struct Bin {
+			float  fMin[3];
+			float  fMax[3];
+			uint32 nNumOfTriangles;
+		} sBins[NumOfBins];
+		for (uint32 nBin=0; nBin<NumOfBins; nBin++) {
+			for (uint32 i=0; i<3; i++) {
+				sBins[nBin].fMin[i] =  Huge;
+				sBins[nBin].fMax[i] = -Huge;
+			}
+			sBins[nBin].nNumOfTriangles = 0;
+		}
+		const float fScale = NumOfBins/fExtent;
+		for (uint32 i=0; i<nNumOfTriangles; i++) {
+			const BuildTriangle &sBuildTriangle = pBuildTriangles[i];
+			Bin &sBin = sBins[Math::Min(static_cast<uint32>((sBuildTriangle.fCenter[nAxis] - fCenterMin[nAxis])*fScale), NumOfBins - 1)];
+			for (uint32 j=0; j<3; j++) {
+				if (sBin.fMin[j] > sBuildTriangle.fMin[j])
+					sBin.fMin[j] = sBuildTriangle.fMin[j];
+				if (sBin.fMax[j] < sBuildTriangle.fMax[j])
+					sBin.fMax[j] = sBuildTriangle.fMax[j];
+			}
+			sBin.nNumOfTriangles++;
+		}
+
+		// Surface area heuristic: Sweep from the right to get the cost of the right sides...
+		float  fRightCost[NumOfBins];
+		float  fMin[3] = {  Huge,  Huge,  Huge };
+		float  fMax[3] = { -Huge, -Huge, -Huge };
+		uint32 nCount  = 0;
+		for (uint32 nBin=NumOfBins-1; nBin>0; nBin--) {
+			const Bin &sBin = sBins[nBin];
+			for (uint32 i=0; i<3; i++) {
+				if (fMin[i] > sBin.fMin[i])
+					fMin[i] = sBin.fMin[i];
+				if (fMax[i] < sBin.fMax[i])
+					fMax[i] = sBin.fMax[i];
+			}
+			nCount += sBin.nNumOfTriangles;
+			fRightCost[nBin] = nCount ? GetHalfArea(fMin, fMax)*nCount : 0.0f;
+		}
+
+		// ... then sweep from the left and find the split with the lowest cost, the split is behind the bin
+		float  fBestCost = Huge;
+		uint32 nBestBin  = 0;
+		for (uint32 i=0; i<3; i++) {
+			fMin[i] =  Huge;
+			fMax[i] = -Huge;
+		}
+		nCount = 0;
+		for (uint32 nBin=0; nBin<NumOfBins-1; nBin++) {
+			const Bin &sBin = sBins[nBin];
+			for (uint32 i=0; i<3; i++) {
+				if (fMin[i] > sBin.fMin[i])
+					fMin[i] = sBin.fMin[i];
+				if (fMax[i] < sBin.fMax[i])
+					fMax[i] = sBin.fMax[i];
+			}
+			nCount += sBin.nNumOfTriangles;
+			if (nCount && nCount < nNumOfTriangles) {
+				const float fCost = GetHalfArea(fMin, fMax)*nCount + fRightCost[nBin + 1];
+				if (fCost < fBestCost) {
+					fBestCost = fCost;
+					nBestBin  = nBin;
+				}
+			}
+		}
+
+		// Move the triangles of the left side to the front
+		uint32 nLeft  = 0;
+		uint32 nRight = nNumOfTriangles;
+		while (nLeft < nRight) {
+			if (Math::Min(static_cast<uint32>((pBuildTriangles[nLeft].fCenter[nAxis] - fCenterMin[nAxis])*fScale), NumOfBins - 1) <= nBestBin) {
+				nLeft++;
+			} else {
+				nRight--;
+				const BuildTriangle sBuildTriangle = pBuildTriangles[nLeft];
+				pBuildTriangles[nLeft]  = pBuildTriangles[nRight];
+				pBuildTriangles[nRight] = sBuildTriangle;
+			}
+		}
+
+		// The center at the minimum is always on the left side and the one at the maximum always on the right side, so both sides are used
+		if (nLeft && nLeft < nNumOfTriangles)
+			nNumOfLeftTriangles = nLeft;
+	} else {
+		// All triangle centers are at the same position, just split the triangles in the middle
+	}
+
+	// Create the children, they are always next to each other
+	const uint32 nChild = m_lstNodes.GetNumOfElements();
+	m_lstNodes.Add();
+	m_lstNodes.Add();
+	Node &sNode = m_lstNodes[nNode];
+	sNode.nIndex		  = nChild;
+	sNode.nNumOfTriangles = 0;
+	BuildNode(nChild,	  lstBuildTriangles, nFirst,					   nNumOfLeftTriangles,					  nDepth + 1);
+	BuildNode(nChild + 1, lstBuildTriangles, nFirst + nNumOfLeftTriangles, nNumOfTriangles - nNumOfLeftTriangles, nDepth + 1);
+}
+
+/**
+*  @brief
+*    Writes the vertex positions of the triangles into the triangle packs of all leaves and updates the node bounding boxes
+*/
+void MeshBVH::UpdatePositions(const char *pFirstVertex, uint32 nVertexSize)
+{
+	Node		   *pNodes	   = m_lstNodes.GetData();
+	TrianglePack   *pPacks	   = m_lstPacks.GetData();
+	const Triangle *pTriangles = m_lstTriangles.GetData();
+
+	// Children are always behind their parent, so walking backwards updates the children first
+	for (uint32 nNode=m_lstNodes.GetNumOfElements(); nNode>0; nNode--) {
+		Node &sNode = pNodes[nNode - 1];
+		if (sNode.nNumOfTriangles) {
+			// Leaf, update the triangle packs and calculate the bounding box of the triangles
+			for (uint32 i=0; i<3; i++) {
+				sNode.fMin[i] =  Huge;
+				sNode.fMax[i] = -Huge;
+			}
+			for (uint32 nTriangle=0; nTriangle<sNode.nNumOfTriangles; nTriangle++) {
+				TrianglePack &sPack = pPacks[sNode.nIndex + nTriangle/4];
+				const uint32 nSlot = nTriangle%4;
+				const Triangle &sTriangle = pTriangles[sPack.nTriangle[nSlot]];
+				const float *pfV0 = reinterpret_cast<const float*>(pFirstVertex + nVertexSize*sTriangle.nVertex[0]);
+				const float *pfV1 = reinterpret_cast<const float*>(pFirstVertex + nVertexSize*sTriangle.nVertex[1]);
+				const float *pfV2 = reinterpret_cast<const float*>(pFirstVertex + nVertexSize*sTriangle.nVertex[2]);
+				for (uint32 i=0; i<3; i++) {
+					sPack.fV0[i][nSlot] = pfV0[i];
+					sPack.fE1[i][nSlot] = pfV1[i] - pfV0[i];
+					sPack.fE2[i][nSlot] = pfV2[i] - pfV0[i];
+					sNode.fMin[i] = Math::Min(sNode.fMin[i], pfV0[i], pfV1[i], pfV2[i]);
+					sNode.fMax[i] = Math::Max(sNode.fMax[i], pfV0[i], pfV1[i], pfV2[i]);
+				}
+			}
+		} else {
+			// Inner node, merge the bounding boxes of the children
+			const Node &sChild1 = pNodes[sNode.nIndex];
+			const Node &sChild2 = pNodes[sNode.nIndex + 1];
+			for (uint32 i=0; i<3; i++) {
+				sNode.fMin[i] = Math::Min(sChild1.fMin[i], sChild2.fMin[i]);
+				sNode.fMax[i] = Math::Max(sChild1.fMax[i], sChild2.fMax[i]);
+			}
+		}
+	}
+}
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+} // PLMesh
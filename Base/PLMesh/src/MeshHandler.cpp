@@ -49,6 +49,7 @@
 #include "PLMesh/MeshMorphTarget.h"
 #include "PLMesh/MorphTargetAni.h"
 #include "PLMesh/MeshOctree.h"
+#include "PLMesh/MeshBVH.h"
 #include "PLMesh/SkeletonManager.h"
 #include "PLMesh/MeshHandler.h"
 
@@ -76,10 +77,13 @@ MeshHandler::MeshHandler() :
 	m_pMesh(nullptr),
 	m_pVertexBuffer(nullptr),
 	m_bMeshUpdateRequired(false),
+	m_bMeshLoading(false),
 	m_nLOD(0),
 	m_pCurrentVertexBuffer(nullptr),
 	m_pSkeletonHandler(nullptr),
-	m_pMeshAnimationManager(nullptr)
+	m_pMeshAnimationManager(nullptr),
+	m_pBVH(nullptr),
+	m_bRefitBVH(false)
 {
 }
 
@@ -138,6 +142,7 @@ bool MeshHandler::SetMesh(Mesh *pMesh)
 		delete m_pVertexBuffer;
 		m_pVertexBuffer = nullptr;
 	}
+	m_bMeshLoading		   = (pMesh && pMesh->GetMeshManager() && pMesh->GetMeshManager()->IsResourceLoading(*pMesh));
 	if (pMesh) {
 		m_cGeometryVisibility.Resize(m_pMesh->GetMaxNumOfGeometries(), true, true);
 		m_lstBaseMorphTargetWeights.Resize(pMesh->GetNumOfMorphTargets(), true, true);
@@ -150,6 +155,10 @@ bool MeshHandler::SetMesh(Mesh *pMesh)
 	m_cGeometryVisibility.SetAll();
 	m_lstTrianglePlanes.Clear();
 	m_bRecalculateTrianglePlanes = true;
+	if (m_pBVH) {
+		delete m_pBVH;
+		m_pBVH = nullptr;
+	}
 
 	// Setup skeleton handler
 	if (pMesh && pMesh->GetSkeletonHandlers().GetNumOfElements()) {
@@ -176,9 +185,11 @@ bool MeshHandler::SetMesh(Mesh *pMesh)
 		m_pRenderer = nullptr;
 	}
 
-	// Reset mesh animation manager
-	if (m_pMeshAnimationManager)
+	// Reset mesh animation manager and let it drop data cached for the previous mesh
+	if (m_pMeshAnimationManager) {
 		m_pMeshAnimationManager->Clear();
+		m_pMeshAnimationManager->OnMeshChange();
+	}
 
 	// Update a first time
 	Update(0.0f);
@@ -193,6 +204,10 @@ bool MeshHandler::SetMesh(Mesh *pMesh)
 */
 void MeshHandler::Update(float fTimeDifference, uint32 nLODLevel)
 {
+	// The mesh was loading asynchronously as it was set, now that it's loaded set it again to set up the materials and so on
+	if (m_bMeshLoading && !m_pMesh->GetMeshManager()->IsResourceLoading(*m_pMesh))
+		SetMesh(m_pMesh);
+
 	// Is there a mesh?
 	if (m_pMesh && m_pRenderer) {
 		// Update mesh animation manager
@@ -238,8 +253,9 @@ void MeshHandler::Update(float fTimeDifference, uint32 nLODLevel)
 				if (m_pMeshAnimationManager)
 					static_cast<MeshAnimationManager*>(m_pMeshAnimationManager)->Apply(*this);
 
-				// Rebuild of current triangle plane list required
+				// Rebuild of current triangle plane list and refit of the triangle bounding volume hierarchy required
 				m_bRecalculateTrianglePlanes = true;
+				m_bRefitBVH					 = true;
 			}
 		} else {
 			const MeshMorphTarget *pMorphTarget = m_pMesh->GetMorphTarget(0);
@@ -883,498 +899,52 @@ bool MeshHandler::FindTriangle(const Vector3 &vLineStartPos,
 	// Check pointers
 	if (m_pMesh && m_pCurrentVertexBuffer) {
 		const MeshLODLevel *pLODLevel = m_pMesh->GetLODLevel(m_nLOD);
-		if (pLODLevel) {
-			// Lock buffers
-			if (m_pCurrentVertexBuffer->Lock(Lock::ReadOnly)) {
-				// Get a pointer to the first vertex position
-				const char *pFirstVertex = static_cast<const char*>(m_pCurrentVertexBuffer->GetData(0, VertexBuffer::Position));
-				if (pFirstVertex) {
-					const uint32 nVertexSize = m_pCurrentVertexBuffer->GetVertexSize();
-
-					// Get index buffer
-					IndexBuffer *pIndexBuffer = pLODLevel->GetIndexBuffer();
-					if (pIndexBuffer && pIndexBuffer->Lock(Lock::ReadOnly)) {
-						// Calculate line direction
-						Vector3 vDirection = vLineEndPos-vLineStartPos;
-
-						// Get normalized line direction (required for culling)
-						Vector3 vNormalizedDirection = vDirection;
-						vNormalizedDirection.Normalize();
-
-						// Variables
-						Vector3 vIntersectionPointPos, vCollisionPoint, vV1, vV2, vV3, vN;
-						float fSquaredDistance = -1.0f; // Not initialized yet
-
-						// Loop through all geometries
-						const Array<Geometry> &lstGeometries = *pLODLevel->GetGeometries();
-						if (plstGeometries) {
-							for (uint32 nGeo=0; nGeo<plstGeometries->GetNumOfElements(); nGeo++) {
-								// Get and check the geometry index
-								const uint32 nGeometryIndex = (*plstGeometries)[nGeo];
-								if (nGeometryIndex < lstGeometries.GetNumOfElements()) {
-									// Get the geometry
-									const Geometry &cGeometry = lstGeometries[nGeometryIndex];
-
-									// Is this geometry active?
-									if (cGeometry.IsActive()) {
-										const uint32 nNumOfTriangles = cGeometry.GetNumOfTriangles();
-
-										// Optimized for 'triangle list' ('MeshHandler::FindTriangle()' can become a heavy bottleneck!)
-										if (cGeometry.GetPrimitiveType() == Primitive::TriangleList) {
-											if (pIndexBuffer->GetElementType() == IndexBuffer::UInt) {
-												// Get a pointer to the first index of the geometry
-												const uint32 *pnIndex = static_cast<const uint32*>(pIndexBuffer->GetData()) + cGeometry.GetStartIndex();
-
-												// Loop through all triangles
-												for (uint32 nTri=0; nTri<nNumOfTriangles; nTri++) {
-													// Get triangle data
-													const float *pfVertex = reinterpret_cast<const float*>(pFirstVertex + nVertexSize*(*pnIndex));
-													vV1.x = pfVertex[Vector3::X];
-													vV1.y = pfVertex[Vector3::Y];
-													vV1.z = pfVertex[Vector3::Z];
-													pnIndex++;
-													pfVertex = reinterpret_cast<const float*>(pFirstVertex + nVertexSize*(*pnIndex));
-													vV2.x = pfVertex[Vector3::X];
-													vV2.y = pfVertex[Vector3::Y];
-													vV2.z = pfVertex[Vector3::Z];
-													pnIndex++;
-													pfVertex = reinterpret_cast<const float*>(pFirstVertex + nVertexSize*(*pnIndex));
-													vV3.x = pfVertex[Vector3::X];
-													vV3.y = pfVertex[Vector3::Y];
-													vV3.z = pfVertex[Vector3::Z];
-													pnIndex++;
-
-													// Get face normal
-													vN.GetFaceNormal(vV1, vV2, vV3);
-
-													// Perform culling?
-													if (nCull != Cull::None) {
-														// Calculate the dot product between the two normalized vectors
-														const float fDotProduct = vN.DotProduct(vNormalizedDirection);
-
-														// Perform culling
-														if ((nCull == Cull::CW && fDotProduct < 0.0f) || (nCull == Cull::CCW && fDotProduct > 0.0f))
-															continue;	// Use a simple "continue", not additional conditions
-													}
-
-													// Check triangle intersection
-													if (Intersect::TriangleRay(vV1, vV2, vV3, vN, vLineStartPos, vDirection, vIntersectionPointPos)) {
-														// Hit!
-														// Get squared distance
-														float fCurrentSquaredDistance = Math::Abs((vIntersectionPointPos-vLineStartPos).GetSquaredLength());
-
-														// Check squared distance
-														if (fSquaredDistance < 0.0f || fCurrentSquaredDistance < fSquaredDistance) {
-															fSquaredDistance = fCurrentSquaredDistance;
-															nTriangle = nTri;
-															if (pnGeometry)
-																*pnGeometry = nGeometryIndex;
-															if (pvCollisionPoint)
-																*pvCollisionPoint = vIntersectionPointPos;
-														}
-													}
-												}
-											} else if (pIndexBuffer->GetElementType() == IndexBuffer::UShort) {
-												// Get a pointer to the first index of the geometry
-												const uint16 *pnIndex = static_cast<const uint16*>(pIndexBuffer->GetData()) + cGeometry.GetStartIndex();
-
-												// Loop through all triangles
-												for (uint32 nTri=0; nTri<nNumOfTriangles; nTri++) {
-													// Get triangle data
-													const float *pfVertex = reinterpret_cast<const float*>(pFirstVertex + nVertexSize*(*pnIndex));
-													vV1.x = pfVertex[Vector3::X];
-													vV1.y = pfVertex[Vector3::Y];
-													vV1.z = pfVertex[Vector3::Z];
-													pnIndex++;
-													pfVertex = reinterpret_cast<const float*>(pFirstVertex + nVertexSize*(*pnIndex));
-													vV2.x = pfVertex[Vector3::X];
-													vV2.y = pfVertex[Vector3::Y];
-													vV2.z = pfVertex[Vector3::Z];
-													pnIndex++;
-													pfVertex = reinterpret_cast<const float*>(pFirstVertex + nVertexSize*(*pnIndex));
-													vV3.x = pfVertex[Vector3::X];
-													vV3.y = pfVertex[Vector3::Y];
-													vV3.z = pfVertex[Vector3::Z];
-													pnIndex++;
-
-													// Get face normal
-													vN.GetFaceNormal(vV1, vV2, vV3);
-
-													// Perform culling?
-													if (nCull != Cull::None) {
-														// Calculate the dot product between the two normalized vectors
-														const float fDotProduct = vN.DotProduct(vNormalizedDirection);
-
-														// Perform culling
-														if ((nCull == Cull::CW && fDotProduct < 0.0f) || (nCull == Cull::CCW && fDotProduct > 0.0f))
-															continue;	// Use a simple "continue", not additional conditions
-													}
-
-													// Check triangle intersection
-													if (Intersect::TriangleRay(vV1, vV2, vV3, vN, vLineStartPos, vDirection, vIntersectionPointPos)) {
-														// Hit!
-														// Get squared distance
-														float fCurrentSquaredDistance = Math::Abs((vIntersectionPointPos-vLineStartPos).GetSquaredLength());
-
-														// Check squared distance
-														if (fSquaredDistance < 0.0f || fCurrentSquaredDistance < fSquaredDistance) {
-															fSquaredDistance = fCurrentSquaredDistance;
-															nTriangle = nTri;
-															if (pnGeometry)
-																*pnGeometry = nGeometryIndex;
-															if (pvCollisionPoint)
-																*pvCollisionPoint = vIntersectionPointPos;
-														}
-													}
-												}
-											} else {
-												// Get a pointer to the first index of the geometry
-												const uint8 *pnIndex = static_cast<const uint8*>(pIndexBuffer->GetData()) + cGeometry.GetStartIndex();
-
-												// Loop through all triangles
-												for (uint32 nTri=0; nTri<nNumOfTriangles; nTri++) {
-													// Get triangle data
-													const float *pfVertex = reinterpret_cast<const float*>(pFirstVertex + nVertexSize*(*pnIndex));
-													vV1.x = pfVertex[Vector3::X];
-													vV1.y = pfVertex[Vector3::Y];
-													vV1.z = pfVertex[Vector3::Z];
-													pnIndex++;
-													pfVertex = reinterpret_cast<const float*>(pFirstVertex + nVertexSize*(*pnIndex));
-													vV2.x = pfVertex[Vector3::X];
-													vV2.y = pfVertex[Vector3::Y];
-													vV2.z = pfVertex[Vector3::Z];
-													pnIndex++;
-													pfVertex = reinterpret_cast<const float*>(pFirstVertex + nVertexSize*(*pnIndex));
-													vV3.x = pfVertex[Vector3::X];
-													vV3.y = pfVertex[Vector3::Y];
-													vV3.z = pfVertex[Vector3::Z];
-													pnIndex++;
-
-													// Get face normal
-													vN.GetFaceNormal(vV1, vV2, vV3);
-
-													// Perform culling?
-													if (nCull != Cull::None) {
-														// Calculate the dot product between the two normalized vectors
-														const float fDotProduct = vN.DotProduct(vNormalizedDirection);
-
-														// Perform culling
-														if ((nCull == Cull::CW && fDotProduct < 0.0f) || (nCull == Cull::CCW && fDotProduct > 0.0f))
-															continue;	// Use a simple "continue", not additional conditions
-													}
-
-													// Check triangle intersection
-													if (Intersect::TriangleRay(vV1, vV2, vV3, vN, vLineStartPos, vDirection, vIntersectionPointPos)) {
-														// Hit!
-														// Get squared distance
-														float fCurrentSquaredDistance = Math::Abs((vIntersectionPointPos-vLineStartPos).GetSquaredLength());
-
-														// Check squared distance
-														if (fSquaredDistance < 0.0f || fCurrentSquaredDistance < fSquaredDistance) {
-															fSquaredDistance = fCurrentSquaredDistance;
-															nTriangle = nTri;
-															if (pnGeometry)
-																*pnGeometry = nGeometryIndex;
-															if (pvCollisionPoint)
-																*pvCollisionPoint = vIntersectionPointPos;
-														}
-													}
-												}
-											}
-										} else {
-											// Loop through all triangles
-											for (uint32 nTri=0; nTri<nNumOfTriangles; nTri++) {
-												// Get triangle data
-												uint32 nVertex1, nVertex2, nVertex3;
-												pLODLevel->GetTriangle(nGeometryIndex, nTri, nVertex1, nVertex2, nVertex3);
-												const float *pfVertex = reinterpret_cast<const float*>(pFirstVertex + nVertexSize*nVertex1);
-												vV1.x = pfVertex[Vector3::X];
-												vV1.y = pfVertex[Vector3::Y];
-												vV1.z = pfVertex[Vector3::Z];
-												pfVertex = reinterpret_cast<const float*>(pFirstVertex + nVertexSize*nVertex2);
-												vV2.x = pfVertex[Vector3::X];
-												vV2.y = pfVertex[Vector3::Y];
-												vV2.z = pfVertex[Vector3::Z];
-												pfVertex = reinterpret_cast<const float*>(pFirstVertex + nVertexSize*nVertex3);
-												vV3.x = pfVertex[Vector3::X];
-												vV3.y = pfVertex[Vector3::Y];
-												vV3.z = pfVertex[Vector3::Z];
-
-												// Get face normal
-												vN.GetFaceNormal(vV1, vV2, vV3);
-
-												// Perform culling?
-												if (nCull != Cull::None) {
-													// Calculate the dot product between the two normalized vectors
-													const float fDotProduct = vN.DotProduct(vNormalizedDirection);
-
-													// Perform culling
-													if ((nCull == Cull::CW && fDotProduct < 0.0f) || (nCull == Cull::CCW && fDotProduct > 0.0f))
-														continue;	// Use a simple "continue", not additional conditions
-												}
-
-												// Check triangle intersection
-												if (Intersect::TriangleRay(vV1, vV2, vV3, vN, vLineStartPos, vDirection, vIntersectionPointPos)) {
-													// Hit!
-													// Get squared distance
-													float fCurrentSquaredDistance = Math::Abs((vIntersectionPointPos-vLineStartPos).GetSquaredLength());
-
-													// Check squared distance
-													if (fSquaredDistance < 0.0f || fCurrentSquaredDistance < fSquaredDistance) {
-														fSquaredDistance = fCurrentSquaredDistance;
-														nTriangle = nTri;
-														if (pnGeometry)
-															*pnGeometry = nGeometryIndex;
-														if (pvCollisionPoint)
-															*pvCollisionPoint = vIntersectionPointPos;
-													}
-												}
-											}
-										}
-									}
-								}
-							}
-						} else {
-							for (uint32 nGeo=0; nGeo<lstGeometries.GetNumOfElements(); nGeo++) {
-								// Get the geometry
-								const Geometry &cGeometry = lstGeometries[nGeo];
-
-								// Is this geometry active?
-								if (cGeometry.IsActive()) {
-									const uint32 nNumOfTriangles = cGeometry.GetNumOfTriangles();
-
-									// Optimized for 'triangle list' ('MeshHandler::FindTriangle()' can become a heavy bottleneck!)
-									if (cGeometry.GetPrimitiveType() == Primitive::TriangleList) {
-										if (pIndexBuffer->GetElementType() == IndexBuffer::UInt) {
-											// Get a pointer to the first index of the geometry
-											const uint32 *pnIndex = static_cast<const uint32*>(pIndexBuffer->GetData()) + cGeometry.GetStartIndex();
-
-											// Loop through all triangles
-											for (uint32 nTri=0; nTri<nNumOfTriangles; nTri++) {
-												// Get triangle data
-												const float *pfVertex = reinterpret_cast<const float*>(pFirstVertex + nVertexSize*(*pnIndex));
-												vV1.x = pfVertex[Vector3::X];
-												vV1.y = pfVertex[Vector3::Y];
-												vV1.z = pfVertex[Vector3::Z];
-												pnIndex++;
-												pfVertex = reinterpret_cast<const float*>(pFirstVertex + nVertexSize*(*pnIndex));
-												vV2.x = pfVertex[Vector3::X];
-												vV2.y = pfVertex[Vector3::Y];
-												vV2.z = pfVertex[Vector3::Z];
-												pnIndex++;
-												pfVertex = reinterpret_cast<const float*>(pFirstVertex + nVertexSize*(*pnIndex));
-												vV3.x = pfVertex[Vector3::X];
-												vV3.y = pfVertex[Vector3::Y];
-												vV3.z = pfVertex[Vector3::Z];
-												pnIndex++;
-
-												// Get face normal
-												vN.GetFaceNormal(vV1, vV2, vV3);
-
-												// Perform culling?
-												if (nCull != Cull::None) {
-													// Calculate the dot product between the two normalized vectors
-													const float fDotProduct = vN.DotProduct(vNormalizedDirection);
-
-													// Perform culling
-													if ((nCull == Cull::CW && fDotProduct < 0.0f) || (nCull == Cull::CCW && fDotProduct > 0.0f))
-														continue;	// Use a simple "continue", not additional conditions
-												}
-
-												// Check triangle intersection
-												if (Intersect::TriangleRay(vV1, vV2, vV3, vN, vLineStartPos, vDirection, vIntersectionPointPos)) {
-													// Hit!
-													// Get squared distance
-													float fCurrentSquaredDistance = Math::Abs((vIntersectionPointPos-vLineStartPos).GetSquaredLength());
-
-													// Check squared distance
-													if (fSquaredDistance < 0.0f || fCurrentSquaredDistance < fSquaredDistance) {
-														fSquaredDistance = fCurrentSquaredDistance;
-														nTriangle = nTri;
-														if (pnGeometry)
-															*pnGeometry = nGeo;
-														if (pvCollisionPoint)
-															*pvCollisionPoint = vIntersectionPointPos;
-													}
-												}
-											}
-										} else if (pIndexBuffer->GetElementType() == IndexBuffer::UShort) {
-											// Get a pointer to the first index of the geometry
-											const uint16 *pnIndex = static_cast<const uint16*>(pIndexBuffer->GetData()) + cGeometry.GetStartIndex();
-
-											// Loop through all triangles
-											for (uint32 nTri=0; nTri<nNumOfTriangles; nTri++) {
-												// Get triangle data
-												const float *pfVertex = reinterpret_cast<const float*>(pFirstVertex + nVertexSize*(*pnIndex));
-												vV1.x = pfVertex[Vector3::X];
-												vV1.y = pfVertex[Vector3::Y];
-												vV1.z = pfVertex[Vector3::Z];
-												pnIndex++;
-												pfVertex = reinterpret_cast<const float*>(pFirstVertex + nVertexSize*(*pnIndex));
-												vV2.x = pfVertex[Vector3::X];
-												vV2.y = pfVertex[Vector3::Y];
-												vV2.z = pfVertex[Vector3::Z];
-												pnIndex++;
-												pfVertex = reinterpret_cast<const float*>(pFirstVertex + nVertexSize*(*pnIndex));
-												vV3.x = pfVertex[Vector3::X];
-												vV3.y = pfVertex[Vector3::Y];
-												vV3.z = pfVertex[Vector3::Z];
-												pnIndex++;
-
-												// Get face normal
-												vN.GetFaceNormal(vV1, vV2, vV3);
-
-												// Perform culling?
-												if (nCull != Cull::None) {
-													// Calculate the dot product between the two normalized vectors
-													const float fDotProduct = vN.DotProduct(vNormalizedDirection);
-
-													// Perform culling
-													if ((nCull == Cull::CW && fDotProduct < 0.0f) || (nCull == Cull::CCW && fDotProduct > 0.0f))
-														continue;	// Use a simple "continue", not additional conditions
-												}
-
-												// Check triangle intersection
-												if (Intersect::TriangleRay(vV1, vV2, vV3, vN, vLineStartPos, vDirection, vIntersectionPointPos)) {
-													// Hit!
-													// Get squared distance
-													float fCurrentSquaredDistance = Math::Abs((vIntersectionPointPos-vLineStartPos).GetSquaredLength());
-
-													// Check squared distance
-													if (fSquaredDistance < 0.0f || fCurrentSquaredDistance < fSquaredDistance) {
-														fSquaredDistance = fCurrentSquaredDistance;
-														nTriangle = nTri;
-														if (pnGeometry)
-															*pnGeometry = nGeo;
-														if (pvCollisionPoint)
-															*pvCollisionPoint = vIntersectionPointPos;
-													}
-												}
-											}
-										} else {
-											// Get a pointer to the first index of the geometry
-											const uint8 *pnIndex = static_cast<const uint8*>(pIndexBuffer->GetData()) + cGeometry.GetStartIndex();
-
-											// Loop through all triangles
-											for (uint32 nTri=0; nTri<nNumOfTriangles; nTri++) {
-												// Get triangle data
-												const float *pfVertex = reinterpret_cast<const float*>(pFirstVertex + nVertexSize*(*pnIndex));
-												vV1.x = pfVertex[Vector3::X];
-												vV1.y = pfVertex[Vector3::Y];
-												vV1.z = pfVertex[Vector3::Z];
-												pnIndex++;
-												pfVertex = reinterpret_cast<const float*>(pFirstVertex + nVertexSize*(*pnIndex));
-												vV2.x = pfVertex[Vector3::X];
-												vV2.y = pfVertex[Vector3::Y];
-												vV2.z = pfVertex[Vector3::Z];
-												pnIndex++;
-												pfVertex = reinterpret_cast<const float*>(pFirstVertex + nVertexSize*(*pnIndex));
-												vV3.x = pfVertex[Vector3::X];
-												vV3.y = pfVertex[Vector3::Y];
-												vV3.z = pfVertex[Vector3::Z];
-												pnIndex++;
-
-												// Get face normal
-												vN.GetFaceNormal(vV1, vV2, vV3);
-
-												// Perform culling?
-												if (nCull != Cull::None) {
-													// Calculate the dot product between the two normalized vectors
-													const float fDotProduct = vN.DotProduct(vNormalizedDirection);
-
-													// Perform culling
-													if ((nCull == Cull::CW && fDotProduct < 0.0f) || (nCull == Cull::CCW && fDotProduct > 0.0f))
-														continue;	// Use a simple "continue", not additional conditions
-												}
-
-												// Check triangle intersection
-												if (Intersect::TriangleRay(vV1, vV2, vV3, vN, vLineStartPos, vDirection, vIntersectionPointPos)) {
-													// Hit!
-													// Get squared distance
-													float fCurrentSquaredDistance = Math::Abs((vIntersectionPointPos-vLineStartPos).GetSquaredLength());
-
-													// Check squared distance
-													if (fSquaredDistance < 0.0f || fCurrentSquaredDistance < fSquaredDistance) {
-														fSquaredDistance = fCurrentSquaredDistance;
-														nTriangle = nTri;
-														if (pnGeometry)
-															*pnGeometry = nGeo;
-														if (pvCollisionPoint)
-															*pvCollisionPoint = vIntersectionPointPos;
-													}
-												}
-											}
-										}
-									} else {
-										// Loop through all triangles
-										for (uint32 nTri=0; nTri<nNumOfTriangles; nTri++) {
-											// Get triangle data
-											uint32 nVertex1, nVertex2, nVertex3;
-											pLODLevel->GetTriangle(nGeo, nTri, nVertex1, nVertex2, nVertex3);
-											const float *pfVertex = reinterpret_cast<const float*>(pFirstVertex + nVertexSize*nVertex1);
-											vV1.x = pfVertex[Vector3::X];
-											vV1.y = pfVertex[Vector3::Y];
-											vV1.z = pfVertex[Vector3::Z];
-											pfVertex = reinterpret_cast<const float*>(pFirstVertex + nVertexSize*nVertex2);
-											vV2.x = pfVertex[Vector3::X];
-											vV2.y = pfVertex[Vector3::Y];
-											vV2.z = pfVertex[Vector3::Z];
-											pfVertex = reinterpret_cast<const float*>(pFirstVertex + nVertexSize*nVertex3);
-											vV3.x = pfVertex[Vector3::X];
-											vV3.y = pfVertex[Vector3::Y];
-											vV3.z = pfVertex[Vector3::Z];
-
-											// Get face normal
-											vN.GetFaceNormal(vV1, vV2, vV3);
-
-											// Perform culling?
-											if (nCull != Cull::None) {
-												// Calculate the dot product between the two normalized vectors
-												const float fDotProduct = vN.DotProduct(vNormalizedDirection);
-
-												// Perform culling
-												if ((nCull == Cull::CW && fDotProduct < 0.0f) || (nCull == Cull::CCW && fDotProduct > 0.0f))
-													continue;	// Use a simple "continue", not additional conditions
-											}
-
-											// Check triangle intersection
-											if (Intersect::TriangleRay(vV1, vV2, vV3, vN, vLineStartPos, vDirection, vIntersectionPointPos)) {
-												// Hit!
-												// Get squared distance
-												float fCurrentSquaredDistance = Math::Abs((vIntersectionPointPos-vLineStartPos).GetSquaredLength());
-
-												// Check squared distance
-												if (fSquaredDistance < 0.0f || fCurrentSquaredDistance < fSquaredDistance) {
-													fSquaredDistance = fCurrentSquaredDistance;
-													nTriangle = nTri;
-													if (pnGeometry)
-														*pnGeometry = nGeo;
-													if (pvCollisionPoint)
-														*pvCollisionPoint = vIntersectionPointPos;
-												}
-											}
-										}
-									}
-								}
-							}
-						}
+		if (pLODLevel && pLODLevel->GetGeometries()) {
+			// Get the triangle bounding volume hierarchy
+			const MeshBVH *pBVH = nullptr;
+			if (m_pVertexBuffer) {
+				// The mesh handler own vertex buffer is animated, so we need an own bounding volume hierarchy which is refitted after each change
+				if (!m_pBVH)
+					m_pBVH = new MeshBVH();
+				if (m_pBVH->GetMeshLODLevel() != pLODLevel || m_pBVH->GetVertexBuffer() != m_pVertexBuffer) {
+					m_pBVH->Build(*pLODLevel, *m_pVertexBuffer);
+					m_bRefitBVH = false;
+				} else if (m_bRefitBVH) {
+					m_pBVH->Refit(*m_pVertexBuffer);
+					m_bRefitBVH = false;
+				}
+				pBVH = m_pBVH;
+			} else {
+				// Use the bounding volume hierarchy of the LOD level
+				pBVH = pLODLevel->GetBVH();
+			}
 
-						// Unlock the buffers
-						pIndexBuffer->Unlock();
-						m_pCurrentVertexBuffer->Unlock();
+			// Get the geometries to use
+			Bitset cGeometries;
+			if (plstGeometries) {
+				cGeometries.Resize(pLODLevel->GetGeometries()->GetNumOfElements(), true, true);
+				for (uint32 i=0; i<plstGeometries->GetNumOfElements(); i++)
+					cGeometries.Set((*plstGeometries)[i]);
+			}
 
-						// Return result
-						return (fSquaredDistance >= 0.0f);
-					}
+			// Find the triangle
+			if (pBVH) {
+				Vector3 vCollisionPoint;
+				uint32 nGeometry;
+				if (pBVH->FindTriangle(vLineStartPos, vLineEndPos, *pLODLevel->GetGeometries(), plstGeometries ? &cGeometries : nullptr, nCull, nTriangle, nGeometry, vCollisionPoint)) {
+					if (pnGeometry)
+						*pnGeometry = nGeometry;
+					if (pvCollisionPoint)
+						*pvCollisionPoint = vCollisionPoint;
+
+					// Done
+					return true;
 				}
-
-				// Unlock the vertex buffer
-				m_pCurrentVertexBuffer->Unlock();
 			}
 		}
 	}
 
-	// No triangle found...
+	// Error!
 	return false;
 }
 
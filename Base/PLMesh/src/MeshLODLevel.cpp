@@ -32,8 +32,10 @@
 #include <PLRenderer/Renderer/IndexBuffer.h>
 #include <PLRenderer/Renderer/VertexBuffer.h>
 #include "PLMesh/Mesh.h"
+#include "PLMesh/MeshBVH.h"
 #include "PLMesh/Geometry.h"
 #include "PLMesh/MeshOctree.h"
+#include "PLMesh/MeshMorphTarget.h"
 #include "PLMesh/MeshLODLevel.h"
 
 
@@ -58,7 +60,8 @@ MeshLODLevel::MeshLODLevel(Mesh *pMesh) :
 	m_fDistance(0.0f),
 	m_pIndexBuffer(nullptr),
 	m_plstGeometries(nullptr),
-	m_pOctree(nullptr)
+	m_pOctree(nullptr),
+	m_pBVH(nullptr)
 {
 }
 
@@ -71,6 +74,7 @@ MeshLODLevel::~MeshLODLevel()
 	ClearIndexBuffer();
 	ClearGeometries();
 	DestroyOctree();
+	DestroyBVH();
 }
 
 /**
@@ -182,6 +186,9 @@ void MeshLODLevel::ClearIndexBuffer()
 		delete m_pIndexBuffer;
 		m_pIndexBuffer = nullptr;
 	}
+
+	// Destroy the bounding volume hierarchy, it's using the index buffer
+	DestroyBVH();
 }
 
 /**
@@ -240,6 +247,7 @@ void MeshLODLevel::ClearGeometries()
 	// Destroy precalculated data
 	m_lstTriangles.Clear();
 	    m_lstEdges.Clear();
+	DestroyBVH();
 }
 
 /**
@@ -321,6 +329,41 @@ MeshOctree *MeshLODLevel::GetOctree() const
 	return m_pOctree;
 }
 
+/**
+*  @brief
+*    Returns the LOD level triangle bounding volume hierarchy
+*/
+MeshBVH *MeshLODLevel::GetBVH() const
+{
+	// Build the bounding volume hierarchy right now?
+	if (!m_pBVH && m_pMesh) {
+		const MeshMorphTarget *pMorphTarget = m_pMesh->GetMorphTarget(0);
+		if (pMorphTarget && pMorphTarget->GetVertexBuffer()) {
+			m_pBVH = new MeshBVH();
+			if (!m_pBVH->Build(*this, *pMorphTarget->GetVertexBuffer())) {
+				// There's nothing to build a bounding volume hierarchy for, try again the next time
+				delete m_pBVH;
+				m_pBVH = nullptr;
+			}
+		}
+	}
+
+	// Return the bounding volume hierarchy
+	return m_pBVH;
+}
+
+/**
+*  @brief
+*    Destroys the LOD level triangle bounding volume hierarchy
+*/
+void MeshLODLevel::DestroyBVH()
+{
+	if (m_pBVH) {
+		delete m_pBVH;
+		m_pBVH = nullptr;
+	}
+}
+
 
 //[-------------------------------------------------------]
 //[ Tool functions                                        ]
@@ -751,8 +794,9 @@ bool MeshLODLevel::SplitGeometries(bool bSingleGeometries, uint32 *pSplit, uint3
 	delete m_pIndexBuffer;
 	m_pIndexBuffer = pIndexBuffer;
 
-	// Destroy old octee
+	// Destroy old octee and bounding volume hierarchy
 	DestroyOctree();
+	DestroyBVH();
 
 	// Done
 	return true;
@@ -866,8 +910,9 @@ bool MeshLODLevel::JoinGeometries(uint32 *pJoin, uint32 nJoinNumber)
 	delete m_pIndexBuffer;
 	m_pIndexBuffer = pIndexBuffer;
 
-	// Destroy old octee
+	// Destroy old octee and bounding volume hierarchy
 	DestroyOctree();
+	DestroyBVH();
 
 	// Done
 	return true;
@@ -1188,8 +1233,9 @@ bool MeshLODLevel::GenerateOctreeGeometries(uint32 nSubdivide, uint32 nMinGeomet
 		m_plstGeometries = plstGeometries;
 	}
 
-	// Destroy the temp octree
+	// Destroy the temp octree and the bounding volume hierarchy
 	DestroyOctree();
+	DestroyBVH();
 
 	// Destroy octree ID list
 	for (uint32 i=0; i<lstOctreeIDList.GetNumOfElements(); i++)
@@ -233,6 +233,11 @@ Mesh *MeshManager::LoadMesh(const String &sFilename, const String &sParams, cons
 			}
 			cTokenizer.Stop();
 
+		// Load the mesh asynchronously, as long as it's loading it's empty and mesh handlers using it are set up as soon as it's loaded
+		// -> Parameters are not supported by asynchronous loading
+		} else if (bStatic && GetAsyncLoading() && !sParams.GetLength() && !sMethod.GetLength()) {
+			pMesh = LoadResourceAsync(sFilename);
+
 		// Try to get/load the mesh
 		// -> There are file formats without an extension, so no extension must also be valid
 		} else {
@@ -56,6 +56,13 @@ class DrawHelpersBackend;
 *  @brief
 *    Renderer backend with general stuff which all backends will need
 *
+*  @remarks
+*    The render states, sampler states, texture buffers and program set through this class are cached. Setting a
+*    value which is already set is dropped before it reaches the API backend, so the backends only have to implement
+*    the real changes within "ApplyRenderState()", "ApplySamplerState()", "ApplyTextureBuffer()" and "ApplyProgram()".
+*    Real and dropped changes are counted per frame within the renderer statistics, this way passes can be measured
+*    without a GPU by using the null renderer.
+*
 *  @note
 *    - All renderer backends must be derived from this class in order to have a common ground
 */
@@ -245,6 +252,88 @@ class RendererBackend : public Renderer {
 		PLRENDERER_API bool CheckTextureBufferCube(PLGraphics::Image &cImage, TextureBuffer::EPixelFormat nInternalFormat = TextureBuffer::Unknown) const;
 
 
+	//[-------------------------------------------------------]
+	//[ Protected virtual RendererBackend functions           ]
+	//[-------------------------------------------------------]
+	protected:
+		/**
+		*  @brief
+		*    Sets a single render-state parameter within the API
+		*
+		*  @param[in] nState
+		*    State variable that is being modified, always valid
+		*  @param[in] nValue
+		*    New value for the render state to be set, differs from the previous value
+		*
+		*  @return
+		*    'true' if all went fine, else 'false'
+		*
+		*  @note
+		*    - Called by "SetRenderState()" after the state was validated and written into "m_nRenderState"
+		*    - Backends restoring their API states (e.g. after a lost device) may call this method directly
+		*    - The default implementation is empty, this is sufficient for backends only using the cached render states
+		*/
+		PLRENDERER_API virtual bool ApplyRenderState(RenderState::Enum nState, PLCore::uint32 nValue);
+
+		/**
+		*  @brief
+		*    Sets a single sampler-state parameter within the API
+		*
+		*  @param[in] nStage
+		*    Texture stage to set the value, always valid
+		*  @param[in] nState
+		*    State variable that is being modified, always valid
+		*  @param[in] nValue
+		*    New value for the sampler state to be set
+		*
+		*  @return
+		*    'true' if all went fine, else 'false'
+		*
+		*  @note
+		*    - Called by "SetSamplerState()" after the state was validated and written into "m_ppnSamplerState"
+		*    - Backends synchronizing the sampler states of a just bound texture buffer must call this method directly,
+		*      "SetSamplerState()" would drop the unchanged value
+		*    - The default implementation is empty, this is sufficient for backends only using the cached sampler states
+		*/
+		PLRENDERER_API virtual bool ApplySamplerState(PLCore::uint32 nStage, Sampler::Enum nState, PLCore::uint32 nValue);
+
+		/**
+		*  @brief
+		*    Sets the texture buffer at the given stage within the API
+		*
+		*  @param[in] nStage
+		*    Texture stage, always valid
+		*  @param[in] pPreviousTextureBuffer
+		*    The previously set texture buffer at the given stage, can be a null pointer
+		*
+		*  @return
+		*    'true' if all went fine, else 'false' (the previous texture buffer is set as current one again)
+		*
+		*  @note
+		*    - Called by "SetTextureBuffer()" after the new texture buffer was written into "m_ppCurrentTextureBuffer",
+		*      the new texture buffer differs from the previous one and can be a null pointer
+		*/
+		virtual bool ApplyTextureBuffer(PLCore::uint32 nStage, TextureBuffer *pPreviousTextureBuffer) = 0;
+
+		/**
+		*  @brief
+		*    Sets the currently used program within the API
+		*
+		*  @param[in] pProgram
+		*    Program to use, can be a null pointer
+		*  @param[in] pPreviousProgram
+		*    The previously used program, differs from the new one, can be a null pointer
+		*
+		*  @return
+		*    'true' if all went fine, else 'false' (invalid program?)
+		*
+		*  @note
+		*    - Called by "SetProgram()" after the new program was written into "m_cProgramHandler"
+		*    - The default implementation is empty, this is sufficient for backends without shader support
+		*/
+		PLRENDERER_API virtual bool ApplyProgram(Program *pProgram, Program *pPreviousProgram);
+
+
 	//[-------------------------------------------------------]
 	//[ Protected data                                        ]
 	//[-------------------------------------------------------]
@@ -354,10 +443,12 @@ class RendererBackend : public Renderer {
 		PLRENDERER_API virtual PLCore::uint32 GetDefaultRenderState(RenderState::Enum nState) const override;
 		PLRENDERER_API virtual void ResetRenderStates() override;
 		PLRENDERER_API virtual int GetRenderState(RenderState::Enum nState) const override;
+		PLRENDERER_API virtual bool SetRenderState(RenderState::Enum nState, PLCore::uint32 nValue) override;
 		// Sampler states
 		PLRENDERER_API virtual PLCore::uint32 GetDefaultSamplerState(Sampler::Enum nState) const override;
 		PLRENDERER_API virtual void ResetSamplerStates() override;
 		PLRENDERER_API virtual int GetSamplerState(PLCore::uint32 nStage, Sampler::Enum nState) const override;
+		PLRENDERER_API virtual bool SetSamplerState(PLCore::uint32 nStage, Sampler::Enum nState, PLCore::uint32 nValue) override;
 
 		//[-------------------------------------------------------]
 		//[ Misc                                                  ]
@@ -375,6 +466,7 @@ class RendererBackend : public Renderer {
 		PLRENDERER_API virtual Surface *GetRenderTarget(PLCore::uint8 *pnFace = nullptr) const override;
 		PLRENDERER_API virtual TextureBuffer *GetColorRenderTarget(PLCore::uint8 nColorIndex = 0) const override;
 		PLRENDERER_API virtual TextureBuffer *GetTextureBuffer(PLCore::uint32 nStage) const override;
+		PLRENDERER_API virtual bool SetTextureBuffer(int nStage = -1, TextureBuffer *pTextureBuffer = nullptr) override;
 		PLRENDERER_API virtual IndexBuffer *GetIndexBuffer() const override;
 		PLRENDERER_API virtual Program *GetProgram() const override;
 		PLRENDERER_API virtual bool SetProgram(Program *pProgram = nullptr) override;
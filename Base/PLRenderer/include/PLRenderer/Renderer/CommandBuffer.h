@@ -0,0 +1,690 @@
+/*********************************************************\
+ *  File: CommandBuffer.h                                *
+ *
+ *  Copyright (C) 2002-2013 The PixelLight Team (http://www.pixellight.org/)
+ *
+ *  This file is part of PixelLight.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ *  and associated documentation files (the "Software"), to deal in the Software without
+ *  restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ *  Software is furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all copies or
+ *  substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ *  BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ *  DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ *  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+#ifndef __PLRENDERER_COMMANDBUFFER_H__
+#define __PLRENDERER_COMMANDBUFFER_H__
+#pragma once
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include <PLGraphics/Color/Color4.h>
+#include "PLRenderer/Renderer/Types.h"
+#include "PLRenderer/Renderer/VertexBuffer.h"
+
+
+//[-------------------------------------------------------]
+//[ Forward declarations                                  ]
+//[-------------------------------------------------------]
+namespace PLMath {
+	class Vector2;
+	class Vector3;
+	class Vector4;
+	class Matrix3x3;
+	class Matrix4x4;
+	class Rectangle;
+}
+namespace PLRenderer {
+	class Program;
+	class Surface;
+	class Renderer;
+	class IndexBuffer;
+	class TextureBuffer;
+	class ProgramUniform;
+	class ProgramAttribute;
+}
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace PLRenderer {
+
+
+//[-------------------------------------------------------]
+//[ Classes                                               ]
+//[-------------------------------------------------------]
+/**
+*  @brief
+*    Command buffer recording renderer calls for a later replay
+*
+*  @remarks
+*    The renderer is an immediate mode interface which must only be used by the thread owning the renderer context.
+*    A command buffer offers the state and draw functions of the renderer, but instead of executing them, the calls
+*    are written into a compact command stream. Recording doesn't touch the renderer at all, so multiple command
+*    buffers can be filled in parallel by different threads (one thread per command buffer) - for example by the
+*    jobs of a scene renderer pass. The thread owning the renderer context then replays the command buffers in the
+*    desired order by using "Execute()".
+*
+*    The command stream is one continuous memory block which only grows when it's too small for a new command.
+*    "Reset()" only rewinds the stream and keeps the memory, so a command buffer which is reused every frame doesn't
+*    allocate memory after the first few frames.
+*
+*  @note
+*    - Resources (programs, buffers, surfaces...) are recorded by pointer, they must stay alive until the command buffer was executed
+*    - Values like uniform data, rectangles and colors are copied into the command stream
+*    - A command buffer itself is not thread safe, don't record into the same command buffer from multiple threads at the same time
+*/
+class CommandBuffer {
+
+
+	//[-------------------------------------------------------]
+	//[ Public functions                                      ]
+	//[-------------------------------------------------------]
+	public:
+		/**
+		*  @brief
+		*    Constructor
+		*/
+		PLRENDERER_API CommandBuffer();
+
+		/**
+		*  @brief
+		*    Destructor
+		*/
+		PLRENDERER_API ~CommandBuffer();
+
+		/**
+		*  @brief
+		*    Returns the number of recorded commands
+		*
+		*  @return
+		*    The number of recorded commands
+		*/
+		inline PLCore::uint32 GetNumOfCommands() const;
+
+		/**
+		*  @brief
+		*    Returns the size of the recorded command stream
+		*
+		*  @return
+		*    The size of the recorded command stream (in bytes)
+		*/
+		inline PLCore::uint32 GetSize() const;
+
+		/**
+		*  @brief
+		*    Returns whether or not the command buffer is empty
+		*
+		*  @return
+		*    'true' if there are no recorded commands, else 'false'
+		*/
+		inline bool IsEmpty() const;
+
+		/**
+		*  @brief
+		*    Removes all recorded commands
+		*
+		*  @note
+		*    - The memory of the command stream is kept for the next recording
+		*/
+		inline void Reset();
+
+		/**
+		*  @brief
+		*    Ensures that the command stream is able to hold at least the given number of bytes without reallocation
+		*
+		*  @param[in] nSize
+		*    Size of the command stream to reserve (in bytes)
+		*/
+		PLRENDERER_API void Reserve(PLCore::uint32 nSize);
+
+		/**
+		*  @brief
+		*    Appends all commands recorded by another command buffer
+		*
+		*  @param[in] cCommandBuffer
+		*    Command buffer to append the commands from, must not be this command buffer
+		*
+		*  @remarks
+		*    Can be used to merge command buffers recorded in parallel into one command stream.
+		*/
+		PLRENDERER_API void Append(const CommandBuffer &cCommandBuffer);
+
+		/**
+		*  @brief
+		*    Replays all recorded commands in the order they were recorded
+		*
+		*  @param[in] cRenderer
+		*    Renderer to execute the commands with, the current thread must be the one owning the renderer context
+		*
+		*  @return
+		*    Number of executed commands
+		*
+		*  @note
+		*    - The recorded commands are not removed, use "Reset()" to do so
+		*/
+		PLRENDERER_API PLCore::uint32 Execute(Renderer &cRenderer) const;
+
+		//[-------------------------------------------------------]
+		//[ States                                                ]
+		//[-------------------------------------------------------]
+		/**
+		*  @brief
+		*    Records a "Renderer::SetRenderState()" call
+		*
+		*  @param[in] nState
+		*    Render state to modify
+		*  @param[in] nValue
+		*    New value for the render state
+		*/
+		inline void SetRenderState(RenderState::Enum nState, PLCore::uint32 nValue);
+
+		/**
+		*  @brief
+		*    Records a "Renderer::SetSamplerState()" call
+		*
+		*  @param[in] nStage
+		*    Texture stage to set the value
+		*  @param[in] nState
+		*    Sampler state to modify
+		*  @param[in] nValue
+		*    New value for the sampler state
+		*/
+		inline void SetSamplerState(PLCore::uint32 nStage, Sampler::Enum nState, PLCore::uint32 nValue);
+
+		/**
+		*  @brief
+		*    Records a "Renderer::SetViewport()" call
+		*
+		*  @param[in] pRectangle
+		*    Viewport rectangle, if a null pointer, the current render target is used completely
+		*  @param[in] fMinZ
+		*    Minimum z value
+		*  @param[in] fMaxZ
+		*    Maximum z value
+		*/
+		PLRENDERER_API void SetViewport(const PLMath::Rectangle *pRectangle = nullptr, float fMinZ = 0.0f, float fMaxZ = 1.0f);
+
+		/**
+		*  @brief
+		*    Records a "Renderer::SetScissorRect()" call
+		*
+		*  @param[in] pRectangle
+		*    Scissor rectangle, if a null pointer, the current viewport is used completely
+		*/
+		PLRENDERER_API void SetScissorRect(const PLMath::Rectangle *pRectangle = nullptr);
+
+		/**
+		*  @brief
+		*    Records a "Renderer::SetColorMask()" call
+		*
+		*  @param[in] bRed
+		*    Write red component?
+		*  @param[in] bGreen
+		*    Write green component?
+		*  @param[in] bBlue
+		*    Write blue component?
+		*  @param[in] bAlpha
+		*    Write alpha component?
+		*/
+		inline void SetColorMask(bool bRed = true, bool bGreen = true, bool bBlue = true, bool bAlpha = true);
+
+		/**
+		*  @brief
+		*    Records a "Renderer::Clear()" call
+		*
+		*  @param[in] nFlags
+		*    Flags that indicate what should be cleared, see "Renderer::Clear()"
+		*  @param[in] cColor
+		*    RGBA clear color (used if Clear::Color is set)
+		*  @param[in] fZ
+		*    Z clear value (used if Clear::ZBuffer is set)
+		*  @param[in] nStencil
+		*    Value to clear the stencil-buffer with (used if Clear::Stencil is set)
+		*/
+		PLRENDERER_API void Clear(PLCore::uint32 nFlags = Clear::Color | Clear::ZBuffer,
+								  const PLGraphics::Color4 &cColor = PLGraphics::Color4::Black, float fZ = 1.0f,
+								  PLCore::uint32 nStencil = 0);
+
+		//[-------------------------------------------------------]
+		//[ Resources                                             ]
+		//[-------------------------------------------------------]
+		/**
+		*  @brief
+		*    Records a "Renderer::SetRenderTarget()" call
+		*
+		*  @param[in] pSurface
+		*    New renderer target surface, can be a null pointer
+		*  @param[in] nFace
+		*    Cube map face to render in (0-5) - only used if the surface is a cube map
+		*/
+		inline void SetRenderTarget(Surface *pSurface, PLCore::uint8 nFace = 0);
+
+		/**
+		*  @brief
+		*    Records a "Renderer::SetTextureBuffer()" call
+		*
+		*  @param[in] nStage
+		*    Texture stage, if < 0, set all available texture stages to this texture buffer
+		*  @param[in] pTextureBuffer
+		*    Texture buffer which should be set, a null pointer if no texture buffer should be used
+		*/
+		inline void SetTextureBuffer(int nStage = -1, TextureBuffer *pTextureBuffer = nullptr);
+
+		/**
+		*  @brief
+		*    Records a "Renderer::SetIndexBuffer()" call
+		*
+		*  @param[in] pIndexBuffer
+		*    Index buffer which should be set, a null pointer if no index buffer should be used
+		*/
+		inline void SetIndexBuffer(IndexBuffer *pIndexBuffer = nullptr);
+
+		/**
+		*  @brief
+		*    Records a "Renderer::SetProgram()" call
+		*
+		*  @param[in] pProgram
+		*    Program which should be set, a null pointer if no program should be used
+		*/
+		inline void SetProgram(Program *pProgram = nullptr);
+
+		/**
+		*  @brief
+		*    Records a "ProgramAttribute::Set()" call
+		*
+		*  @param[in] cProgramAttribute
+		*    Program attribute to set, must be an attribute of the program which is set at the time the command is executed
+		*  @param[in] pVertexBuffer
+		*    Vertex buffer to use, can be a null pointer
+		*  @param[in] nIndex
+		*    Index of the vertex buffer attribute to connect with the vertex shader attribute
+		*/
+		inline void SetProgramAttribute(ProgramAttribute &cProgramAttribute, VertexBuffer *pVertexBuffer, PLCore::uint32 nIndex);
+
+		/**
+		*  @brief
+		*    Records a "ProgramAttribute::Set()" call
+		*
+		*  @param[in] cProgramAttribute
+		*    Program attribute to set, must be an attribute of the program which is set at the time the command is executed
+		*  @param[in] pVertexBuffer
+		*    Vertex buffer to use, can be a null pointer
+		*  @param[in] nSemantic
+		*    Semantic of the vertex buffer attribute to connect with the vertex shader attribute
+		*  @param[in] nChannel
+		*    Pipeline channel (see ESemantic)
+		*/
+		inline void SetProgramAttribute(ProgramAttribute &cProgramAttribute, VertexBuffer *pVertexBuffer, VertexBuffer::ESemantic nSemantic, PLCore::uint32 nChannel = 0);
+
+		/**
+		*  @brief
+		*    Records a "ProgramUniform::Set()" call
+		*
+		*  @param[in] cProgramUniform
+		*    Program uniform to set, must be an uniform of the program which is set at the time the command is executed
+		*  @param[in] nX
+		*    Value to set
+		*/
+		inline void SetProgramUniform(ProgramUniform &cProgramUniform, int nX);
+
+		/**
+		*  @brief
+		*    Records a "ProgramUniform::Set()" call
+		*
+		*  @param[in] cProgramUniform
+		*    Program uniform to set, must be an uniform of the program which is set at the time the command is executed
+		*  @param[in] fX
+		*    Value to set
+		*/
+		inline void SetProgramUniform(ProgramUniform &cProgramUniform, float fX);
+
+		/**
+		*  @brief
+		*    Records a "ProgramUniform::Set()" call
+		*
+		*  @param[in] cProgramUniform
+		*    Program uniform to set, must be an uniform of the program which is set at the time the command is executed
+		*  @param[in] vVector
+		*    Value to set
+		*/
+		PLRENDERER_API void SetProgramUniform(ProgramUniform &cProgramUniform, const PLMath::Vector2 &vVector);
+		PLRENDERER_API void SetProgramUniform(ProgramUniform &cProgramUniform, const PLMath::Vector3 &vVector);
+		PLRENDERER_API void SetProgramUniform(ProgramUniform &cProgramUniform, const PLMath::Vector4 &vVector);
+
+		/**
+		*  @brief
+		*    Records a "ProgramUniform::Set()" call
+		*
+		*  @param[in] cProgramUniform
+		*    Program uniform to set, must be an uniform of the program which is set at the time the command is executed
+		*  @param[in] cColor
+		*    Floating point color to set
+		*/
+		PLRENDERER_API void SetProgramUniform(ProgramUniform &cProgramUniform, const PLGraphics::Color4 &cColor);
+
+		/**
+		*  @brief
+		*    Records a "ProgramUniform::Set()" call
+		*
+		*  @param[in] cProgramUniform
+		*    Program uniform to set, must be an uniform of the program which is set at the time the command is executed
+		*  @param[in] mMatrix
+		*    Matrix to set
+		*  @param[in] bTranspose
+		*    Transpose the matrix before setting it?
+		*/
+		PLRENDERER_API void SetProgramUniform(ProgramUniform &cProgramUniform, const PLMath::Matrix3x3 &mMatrix, bool bTranspose = false);
+		PLRENDERER_API void SetProgramUniform(ProgramUniform &cProgramUniform, const PLMath::Matrix4x4 &mMatrix, bool bTranspose = false);
+
+		/**
+		*  @brief
+		*    Records a "ProgramUniform::Set()" call
+		*
+		*  @param[in] cProgramUniform
+		*    Program uniform to set, must be a texture uniform of the program which is set at the time the command is executed
+		*  @param[in] pTextureBuffer
+		*    Texture buffer to set, can be a null pointer
+		*/
+		inline void SetProgramUniform(ProgramUniform &cProgramUniform, TextureBuffer *pTextureBuffer);
+
+		//[-------------------------------------------------------]
+		//[ Draw                                                  ]
+		//[-------------------------------------------------------]
+		/**
+		*  @brief
+		*    Records a "Renderer::DrawPrimitives()" call
+		*
+		*  @param[in] nType
+		*    Primitive type
+		*  @param[in] nStartIndex
+		*    First vertex to draw
+		*  @param[in] nNumVertices
+		*    Number of vertices to draw
+		*/
+		inline void DrawPrimitives(Primitive::Enum nType, PLCore::uint32 nStartIndex, PLCore::uint32 nNumVertices);
+
+		/**
+		*  @brief
+		*    Records a "Renderer::DrawIndexedPrimitives()" call
+		*
+		*  @param[in] nType
+		*    Primitive type
+		*  @param[in] nMinIndex
+		*    Minimum vertex index for vertices used during this call
+		*  @param[in] nMaxIndex
+		*    Maximum vertex index for vertices used during this call
+		*  @param[in] nStartIndex
+		*    Location in the index array to start reading vertices
+		*  @param[in] nNumVertices
+		*    Number of vertices to draw
+		*/
+		inline void DrawIndexedPrimitives(Primitive::Enum nType, PLCore::uint32 nMinIndex, PLCore::uint32 nMaxIndex, PLCore::uint32 nStartIndex, PLCore::uint32 nNumVertices);
+
+		/**
+		*  @brief
+		*    Records a "Renderer::DrawPrimitivesInstanced()" call
+		*
+		*  @param[in] nType
+		*    Primitive type
+		*  @param[in] nStartIndex
+		*    First vertex to draw
+		*  @param[in] nNumVertices
+		*    Number of vertices to draw
+		*  @param[in] nNumOfInstances
+		*    Number of instances to draw
+		*/
+		inline void DrawPrimitivesInstanced(Primitive::Enum nType, PLCore::uint32 nStartIndex, PLCore::uint32 nNumVertices, PLCore::uint32 nNumOfInstances);
+
+		/**
+		*  @brief
+		*    Records a "Renderer::DrawIndexedPrimitivesInstanced()" call
+		*
+		*  @param[in] nType
+		*    Primitive type
+		*  @param[in] nMinIndex
+		*    Minimum vertex index for vertices used during this call
+		*  @param[in] nMaxIndex
+		*    Maximum vertex index for vertices used during this call
+		*  @param[in] nStartIndex
+		*    Location in the index array to start reading vertices
+		*  @param[in] nNumVertices
+		*    Number of vertices to draw
+		*  @param[in] nNumOfInstances
+		*    Number of instances to draw
+		*/
+		inline void DrawIndexedPrimitivesInstanced(Primitive::Enum nType, PLCore::uint32 nMinIndex, PLCore::uint32 nMaxIndex, PLCore::uint32 nStartIndex, PLCore::uint32 nNumVertices, PLCore::uint32 nNumOfInstances);
+
+
+	//[-------------------------------------------------------]
+	//[ Private definitions                                   ]
+	//[-------------------------------------------------------]
+	private:
+		/**
+		*  @brief
+		*    Command types
+		*/
+		enum ECommand {
+			CommandSetRenderState,							/**< "StateCommand" */
+			CommandSetSamplerState,							/**< "StateCommand" */
+			CommandSetViewport,								/**< "RectangleCommand" */
+			CommandSetScissorRect,							/**< "RectangleCommand" */
+			CommandSetColorMask,							/**< "StateCommand", mask within the value */
+			CommandClear,									/**< "ClearCommand" */
+			CommandSetRenderTarget,							/**< "ResourceCommand" */
+			CommandSetTextureBuffer,						/**< "ResourceCommand" */
+			CommandSetIndexBuffer,							/**< "ResourceCommand" */
+			CommandSetProgram,								/**< "ResourceCommand" */
+			CommandSetProgramAttributeIndex,				/**< "ProgramAttributeCommand" */
+			CommandSetProgramAttributeSemantic,				/**< "ProgramAttributeCommand" */
+			CommandSetProgramUniformInt,					/**< "ProgramUniformCommand" */
+			CommandSetProgramUniformFloat,					/**< "ProgramUniformCommand" followed by the float components */
+			CommandSetProgramUniformTextureBuffer,			/**< "ProgramUniformCommand" */
+			CommandDrawPrimitives,							/**< "DrawCommand" */
+			CommandDrawIndexedPrimitives,					/**< "DrawCommand" */
+			CommandDrawPrimitivesInstanced,					/**< "DrawCommand" */
+			CommandDrawIndexedPrimitivesInstanced			/**< "DrawCommand" */
+		};
+
+		/**
+		*  @brief
+		*    Header in front of each command within the command stream
+		*/
+		struct CommandHeader {
+			PLCore::uint32 nType;	/**< Command type (ECommand) */
+			PLCore::uint32 nSize;	/**< Size of the command including this header (in bytes), multiple of 8 */
+		};
+
+		/**
+		*  @brief
+		*    Render state, sampler state and color mask command data
+		*/
+		struct StateCommand {
+			PLCore::uint32 nStage;	/**< Texture stage, only used by sampler states */
+			PLCore::uint32 nState;	/**< Render or sampler state */
+			PLCore::uint32 nValue;	/**< State value */
+		};
+
+		/**
+		*  @brief
+		*    Viewport and scissor rectangle command data
+		*/
+		struct RectangleCommand {
+			bool  bRectangle;		/**< Is there a rectangle? If not, the rectangle values are not used */
+			float fRectangle[4];	/**< Rectangle (minimum x, minimum y, maximum x, maximum y) */
+			float fMinZ;			/**< Minimum z value, only used by the viewport */
+			float fMaxZ;			/**< Maximum z value, only used by the viewport */
+		};
+
+		/**
+		*  @brief
+		*    Clear command data
+		*/
+		struct ClearCommand {
+			PLCore::uint32 nFlags;		/**< Clear flags */
+			float		   fColor[4];	/**< RGBA clear color */
+			float		   fZ;			/**< Z clear value */
+			PLCore::uint32 nStencil;	/**< Stencil clear value */
+		};
+
+		/**
+		*  @brief
+		*    Render target, texture buffer, index buffer and program command data
+		*/
+		struct ResourceCommand {
+			void		   *pResource;	/**< The resource, can be a null pointer */
+			PLCore::int32	nIndex;		/**< Texture stage or cube map face, not used by all commands */
+		};
+
+		/**
+		*  @brief
+		*    Program attribute command data
+		*/
+		struct ProgramAttributeCommand {
+			ProgramAttribute *pProgramAttribute;	/**< Program attribute to set, always valid */
+			VertexBuffer	 *pVertexBuffer;		/**< Vertex buffer to use, can be a null pointer */
+			PLCore::uint32	  nIndex;				/**< Vertex buffer attribute index or semantic */
+			PLCore::uint32	  nChannel;				/**< Pipeline channel, only used with a semantic */
+		};
+
+		/**
+		*  @brief
+		*    Program uniform command data
+		*/
+		struct ProgramUniformCommand {
+			ProgramUniform *pProgramUniform;	/**< Program uniform to set, always valid */
+			TextureBuffer  *pTextureBuffer;		/**< Texture buffer, can be a null pointer, only used by texture buffer uniforms */
+			int				nValue;				/**< Integer value, or number of float components (1, 2, 3, 4, 9 or 16) following this command data */
+			bool			bTranspose;			/**< Transpose a matrix? */
+		};
+
+		/**
+		*  @brief
+		*    Draw command data
+		*/
+		struct DrawCommand {
+			PLCore::uint32 nType;				/**< Primitive type */
+			PLCore::uint32 nMinIndex;			/**< Minimum vertex index, only used by indexed draw calls */
+			PLCore::uint32 nMaxIndex;			/**< Maximum vertex index, only used by indexed draw calls */
+			PLCore::uint32 nStartIndex;			/**< First vertex or first index to draw */
+			PLCore::uint32 nNumVertices;		/**< Number of vertices to draw */
+			PLCore::uint32 nNumOfInstances;		/**< Number of instances to draw, only used by instanced draw calls */
+		};
+
+
+	//[-------------------------------------------------------]
+	//[ Private functions                                     ]
+	//[-------------------------------------------------------]
+	private:
+		/**
+		*  @brief
+		*    Copy constructor
+		*
+		*  @param[in] cSource
+		*    Source to copy from
+		*/
+		CommandBuffer(const CommandBuffer &cSource);
+
+		/**
+		*  @brief
+		*    Copy operator
+		*
+		*  @param[in] cSource
+		*    Source to copy from
+		*
+		*  @return
+		*    Reference to this instance
+		*/
+		CommandBuffer &operator =(const CommandBuffer &cSource);
+
+		/**
+		*  @brief
+		*    Adds a command to the command stream
+		*
+		*  @param[in] nType
+		*    Command type
+		*  @param[in] nSize
+		*    Size of the command data (in bytes), without the command header
+		*
+		*  @return
+		*    The command data to fill, always valid
+		*/
+		inline void *AddCommand(ECommand nType, PLCore::uint32 nSize);
+
+		/**
+		*  @brief
+		*    Adds a command to the command stream
+		*
+		*  @param[in] nType
+		*    Command type
+		*
+		*  @return
+		*    The command data to fill
+		*/
+		template <typename T>
+		inline T &AddCommand(ECommand nType);
+
+		/**
+		*  @brief
+		*    Adds a float program uniform command to the command stream
+		*
+		*  @param[in] cProgramUniform
+		*    Program uniform to set
+		*  @param[in] pfComponents
+		*    Float components, must be valid
+		*  @param[in] nNumOfComponents
+		*    Number of float components (1, 2, 3, 4, 9 or 16)
+		*  @param[in] bTranspose
+		*    Transpose a matrix?
+		*/
+		PLRENDERER_API void AddProgramUniformFloat(ProgramUniform &cProgramUniform, const float *pfComponents, PLCore::uint16 nNumOfComponents, bool bTranspose = false);
+
+		/**
+		*  @brief
+		*    Enlarges the command stream so that at least the given number of bytes can be added
+		*
+		*  @param[in] nSize
+		*    Number of bytes which should be added to the command stream
+		*/
+		PLRENDERER_API void Grow(PLCore::uint32 nSize);
+
+
+	//[-------------------------------------------------------]
+	//[ Private data                                          ]
+	//[-------------------------------------------------------]
+	private:
+		PLCore::uint8  *m_pnData;			/**< Command stream, can be a null pointer */
+		PLCore::uint32  m_nSize;			/**< Used size of the command stream (in bytes) */
+		PLCore::uint32  m_nCapacity;		/**< Allocated size of the command stream (in bytes) */
+		PLCore::uint32  m_nNumOfCommands;	/**< Number of recorded commands */
+
+
+};
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+} // PLRenderer
+
+
+//[-------------------------------------------------------]
+//[ Implementation                                        ]
+//[-------------------------------------------------------]
+#include "PLRenderer/Renderer/CommandBuffer.inl"
+
+
+#endif // __PLRENDERER_COMMANDBUFFER_H__
@@ -0,0 +1,239 @@
+/*********************************************************\
+ *  File: CommandBuffer.inl                              *
+ *
+ *  Copyright (C) 2002-2013 The PixelLight Team (http://www.pixellight.org/)
+ *
+ *  This file is part of PixelLight.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ *  and associated documentation files (the "Software"), to deal in the Software without
+ *  restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ *  Software is furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all copies or
+ *  substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ *  BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ *  DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ *  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace PLRenderer {
+
+
+//[-------------------------------------------------------]
+//[ Public functions                                      ]
+//[-------------------------------------------------------]
+/**
+*  @brief
+*    Returns the number of recorded commands
+*/
+inline PLCore::uint32 CommandBuffer::GetNumOfCommands() const
+{
+	return m_nNumOfCommands;
+}
+
+/**
+*  @brief
+*    Returns the size of the recorded command stream
+*/
+inline PLCore::uint32 CommandBuffer::GetSize() const
+{
+	return m_nSize;
+}
+
+/**
+*  @brief
+*    Returns whether or not the command buffer is empty
+*/
+inline bool CommandBuffer::IsEmpty() const
+{
+	return !m_nNumOfCommands;
+}
+
+/**
+*  @brief
+*    Removes all recorded commands
+*/
+inline void CommandBuffer::Reset()
+{
+	m_nSize			 = 0;
+	m_nNumOfCommands = 0;
+}
+
+//[-------------------------------------------------------]
+//[ States                                                ]
+//[-------------------------------------------------------]
+inline void CommandBuffer::SetRenderState(RenderState::Enum nState, PLCore::uint32 nValue)
+{
+	StateCommand &sCommand = AddCommand<StateCommand>(CommandSetRenderState);
+	sCommand.nState = nState;
+	sCommand.nValue = nValue;
+}
+
+inline void CommandBuffer::SetSamplerState(PLCore::uint32 nStage, Sampler::Enum nState, PLCore::uint32 nValue)
+{
+	StateCommand &sCommand = AddCommand<StateCommand>(CommandSetSamplerState);
+	sCommand.nStage = nStage;
+	sCommand.nState = nState;
+	sCommand.nValue = nValue;
+}
+
+inline void CommandBuffer::SetColorMask(bool bRed, bool bGreen, bool bBlue, bool bAlpha)
+{
+	StateCommand &sCommand = AddCommand<StateCommand>(CommandSetColorMask);
+	sCommand.nValue = (bRed ? 1 : 0) | (bGreen ? 2 : 0) | (bBlue ? 4 : 0) | (bAlpha ? 8 : 0);
+}
+
+//[-------------------------------------------------------]
+//[ Resources                                             ]
+//[-------------------------------------------------------]
+inline void CommandBuffer::SetRenderTarget(Surface *pSurface, PLCore::uint8 nFace)
+{
+	ResourceCommand &sCommand = AddCommand<ResourceCommand>(CommandSetRenderTarget);
+	sCommand.pResource = pSurface;
+	sCommand.nIndex	   = nFace;
+}
+
+inline void CommandBuffer::SetTextureBuffer(int nStage, TextureBuffer *pTextureBuffer)
+{
+	ResourceCommand &sCommand = AddCommand<ResourceCommand>(CommandSetTextureBuffer);
+	sCommand.pResource = pTextureBuffer;
+	sCommand.nIndex	   = nStage;
+}
+
+inline void CommandBuffer::SetIndexBuffer(IndexBuffer *pIndexBuffer)
+{
+	AddCommand<ResourceCommand>(CommandSetIndexBuffer).pResource = pIndexBuffer;
+}
+
+inline void CommandBuffer::SetProgram(Program *pProgram)
+{
+	AddCommand<ResourceCommand>(CommandSetProgram).pResource = pProgram;
+}
+
+inline void CommandBuffer::SetProgramAttribute(ProgramAttribute &cProgramAttribute, VertexBuffer *pVertexBuffer, PLCore::uint32 nIndex)
+{
+	ProgramAttributeCommand &sCommand = AddCommand<ProgramAttributeCommand>(CommandSetProgramAttributeIndex);
+	sCommand.pProgramAttribute = &cProgramAttribute;
+	sCommand.pVertexBuffer	   = pVertexBuffer;
+	sCommand.nIndex			   = nIndex;
+}
+
+inline void CommandBuffer::SetProgramAttribute(ProgramAttribute &cProgramAttribute, VertexBuffer *pVertexBuffer, VertexBuffer::ESemantic nSemantic, PLCore::uint32 nChannel)
+{
+	ProgramAttributeCommand &sCommand = AddCommand<ProgramAttributeCommand>(CommandSetProgramAttributeSemantic);
+	sCommand.pProgramAttribute = &cProgramAttribute;
+	sCommand.pVertexBuffer	   = pVertexBuffer;
+	sCommand.nIndex			   = nSemantic;
+	sCommand.nChannel		   = nChannel;
+}
+
+inline void CommandBuffer::SetProgramUniform(ProgramUniform &cProgramUniform, int nX)
+{
+	ProgramUniformCommand &sCommand = AddCommand<ProgramUniformCommand>(CommandSetProgramUniformInt);
+	sCommand.pProgramUniform = &cProgramUniform;
+	sCommand.nValue			 = nX;
+}
+
+inline void CommandBuffer::SetProgramUniform(ProgramUniform &cProgramUniform, float fX)
+{
+	AddProgramUniformFloat(cProgramUniform, &fX, 1);
+}
+
+inline void CommandBuffer::SetProgramUniform(ProgramUniform &cProgramUniform, TextureBuffer *pTextureBuffer)
+{
+	ProgramUniformCommand &sCommand = AddCommand<ProgramUniformCommand>(CommandSetProgramUniformTextureBuffer);
+	sCommand.pProgramUniform = &cProgramUniform;
+	sCommand.pTextureBuffer	 = pTextureBuffer;
+}
+
+//[-------------------------------------------------------]
+//[ Draw                                                  ]
+//[-------------------------------------------------------]
+inline void CommandBuffer::DrawPrimitives(Primitive::Enum nType, PLCore::uint32 nStartIndex, PLCore::uint32 nNumVertices)
+{
+	DrawCommand &sCommand = AddCommand<DrawCommand>(CommandDrawPrimitives);
+	sCommand.nType		  = nType;
+	sCommand.nStartIndex  = nStartIndex;
+	sCommand.nNumVertices = nNumVertices;
+}
+
+inline void CommandBuffer::DrawIndexedPrimitives(Primitive::Enum nType, PLCore::uint32 nMinIndex, PLCore::uint32 nMaxIndex, PLCore::uint32 nStartIndex, PLCore::uint32 nNumVertices)
+{
+	DrawCommand &sCommand = AddCommand<DrawCommand>(CommandDrawIndexedPrimitives);
+	sCommand.nType		  = nType;
+	sCommand.nMinIndex	  = nMinIndex;
+	sCommand.nMaxIndex	  = nMaxIndex;
+	sCommand.nStartIndex  = nStartIndex;
+	sCommand.nNumVertices = nNumVertices;
+}
+
+inline void CommandBuffer::DrawPrimitivesInstanced(Primitive::Enum nType, PLCore::uint32 nStartIndex, PLCore::uint32 nNumVertices, PLCore::uint32 nNumOfInstances)
+{
+	DrawCommand &sCommand = AddCommand<DrawCommand>(CommandDrawPrimitivesInstanced);
+	sCommand.nType			 = nType;
+	sCommand.nStartIndex	 = nStartIndex;
+	sCommand.nNumVertices	 = nNumVertices;
+	sCommand.nNumOfInstances = nNumOfInstances;
+}
+
+inline void CommandBuffer::DrawIndexedPrimitivesInstanced(Primitive::Enum nType, PLCore::uint32 nMinIndex, PLCore::uint32 nMaxIndex, PLCore::uint32 nStartIndex, PLCore::uint32 nNumVertices, PLCore::uint32 nNumOfInstances)
+{
+	DrawCommand &sCommand = AddCommand<DrawCommand>(CommandDrawIndexedPrimitivesInstanced);
+	sCommand.nType			 = nType;
+	sCommand.nMinIndex		 = nMinIndex;
+	sCommand.nMaxIndex		 = nMaxIndex;
+	sCommand.nStartIndex	 = nStartIndex;
+	sCommand.nNumVertices	 = nNumVertices;
+	sCommand.nNumOfInstances = nNumOfInstances;
+}
+
+
+//[-------------------------------------------------------]
+//[ Private functions                                     ]
+//[-------------------------------------------------------]
+/**
+*  @brief
+*    Adds a command to the command stream
+*/
+inline void *CommandBuffer::AddCommand(ECommand nType, PLCore::uint32 nSize)
+{
+	// Keep the command data 8 byte aligned
+	const PLCore::uint32 nCommandSize = (sizeof(CommandHeader) + nSize + 7) & ~7;
+	if (m_nSize + nCommandSize > m_nCapacity)
+		Grow(nCommandSize);
+
+	// Write the command header
+	CommandHeader *pCommandHeader = reinterpret_cast<CommandHeader*>(m_pnData + m_nSize);
+	pCommandHeader->nType = nType;
+	pCommandHeader->nSize = nCommandSize;
+	m_nSize += nCommandSize;
+	m_nNumOfCommands++;
+
+	// Return the command data
+	return pCommandHeader + 1;
+}
+
+/**
+*  @brief
+*    Adds a command to the command stream
+*/
+template <typename T>
+inline T &CommandBuffer::AddCommand(ECommand nType)
+{
+	return *static_cast<T*>(AddCommand(nType, sizeof(T)));
+}
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+} // PLRenderer
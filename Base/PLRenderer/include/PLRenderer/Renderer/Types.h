@@ -490,6 +490,10 @@ struct Capabilities {
 struct Statistics {
 	PLCore::uint32 nRenderStateChanges;			/**< Number of render (internal API) state changes */
 	PLCore::uint32 nSamplerStateChanges;		/**< Number of sampler (internal API) state changes */
+	PLCore::uint32 nProgramChanges;				/**< Number of program (internal API) changes */
+	PLCore::uint32 nRedundantRenderStates;		/**< Number of dropped render state changes (the state was already set) */
+	PLCore::uint32 nRedundantSamplerStates;		/**< Number of dropped sampler state changes (the state was already set) */
+	PLCore::uint32 nRedundantPrograms;			/**< Number of dropped program changes (the program was already set) */
 	PLCore::uint32 nDrawPrimitivCalls;			/**< Number of draw primitive calls */
 	PLCore::uint32 nVertices;					/**< Number of rendered vertices */
 	PLCore::uint32 nTriangles;					/**< Number of rendered triangles */
@@ -498,6 +502,7 @@ struct Statistics {
 	PLCore::uint32 nTextureBuffersNum;			/**< Number of texture buffers */
 	PLCore::uint64 nTextureBuffersMem;			/**< Memory in bytes the texture buffers require */
 	PLCore::uint32 nTextureBufferBinds;			/**< Number of texture buffer bindings */
+	PLCore::uint32 nRedundantTextureBuffers;	/**< Number of dropped texture buffer bindings (the texture buffer was already set) */
 	// Vertex buffers
 	PLCore::uint32 nVertexBufferNum;			/**< Number of vertex buffers */
 	PLCore::uint64 nVertexBufferMem;			/**< Memory in bytes the vertex buffers require */
@@ -181,6 +181,7 @@ class RendererContext : public PLCore::AbstractContext {
 		*  @note
 		*    - Should be called once per frame
 		*    - Updates the effect manager
+		*    - Finalizes asynchronously loaded resources ("PLCore::LoadableManager::UpdateAsync()")
 		*    - Emits the update event
 		*    - Updates the renderer ("redraw")
 		*    - Collects renderer context profiling information
@@ -35,6 +35,14 @@
 #include "PLRenderer/PLRenderer.h"
 
 
+//[-------------------------------------------------------]
+//[ Forward declarations                                  ]
+//[-------------------------------------------------------]
+namespace PLGraphics {
+	class Image;
+}
+
+
 //[-------------------------------------------------------]
 //[ Namespace                                             ]
 //[-------------------------------------------------------]
@@ -262,6 +270,24 @@ class Texture : public PLCore::Resource<Texture> {
 		*/
 		void DestroyTextureBuffer();
 
+		/**
+		*  @brief
+		*    Loads the texture by using an already loaded image
+		*
+		*  @param[in] sFilename
+		*    Filename of the image
+		*  @param[in] cImage
+		*    Loaded image, may be manipulated (e.g. scaled) in here
+		*
+		*  @return
+		*    'true' if all went fine, else 'false'
+		*
+		*  @note
+		*    - Loading the image is done by the caller so it can be done by another thread, this function creates
+		*      the texture buffer and must be called by the thread owning the renderer
+		*/
+		bool LoadFromImage(const PLCore::String &sFilename, PLGraphics::Image &cImage);
+
 
 	//[-------------------------------------------------------]
 	//[ Private data                                          ]
@@ -278,6 +304,7 @@ class Texture : public PLCore::Resource<Texture> {
 	//[-------------------------------------------------------]
 	public:
 		PLRENDERER_API virtual bool LoadByFilename(const PLCore::String &sFilename, const PLCore::String &sParams = "", const PLCore::String &sMethod = "") override;
+		PLRENDERER_API virtual bool LoadByFile(PLCore::File &cFile, const PLCore::String &sParams = "", const PLCore::String &sMethod = "") override;
 		PLRENDERER_API virtual bool SaveByFilename(const PLCore::String &sFilename, const PLCore::String &sParams = "", const PLCore::String &sMethod = "") override;
 		PLRENDERER_API virtual bool SaveByFile(PLCore::File &cFile, const PLCore::String &sParams = "", const PLCore::String &sMethod = "") override;
 		PLRENDERER_API virtual bool Unload() override;
@@ -292,6 +292,9 @@ class TextureHandler : public PLCore::ResourceHandler<Texture> {
 		*
 		*  @return
 		*    Pointer to the texture handlers texture, can be a null pointer
+		*
+		*  @note
+		*    - As long as the texture is loading asynchronously, the standard texture of the texture manager is returned
 		*/
 		PLRENDERER_API Texture *GetTexture() const;
 
@@ -31,6 +31,7 @@
 //[ Includes                                              ]
 //[-------------------------------------------------------]
 #include <PLCore/Container/ResourceManager.h>
+#include <PLGraphics/Image/Image.h>
 #include "PLRenderer/Texture/Texture.h"
 #include "PLRenderer/Texture/TextureHandler.h"
 
@@ -74,6 +75,26 @@ class TextureManager : public PLCore::ResourceManager<Texture> {
 		static PLRENDERER_API const PLCore::String Default;	/**< Default texture */
 
 
+	//[-------------------------------------------------------]
+	//[ Private definitions                                   ]
+	//[-------------------------------------------------------]
+	private:
+		/**
+		*  @brief
+		*    Asynchronous load request of a texture, the image is loaded by a worker thread
+		*/
+		class TextureLoadRequest : public ResourceLoadRequest {
+			public:
+				TextureLoadRequest(TextureManager &cManager, Texture &cTexture, const PLCore::String &sFilename, float fPriority);
+				virtual ~TextureLoadRequest();
+			protected:
+				virtual bool OnDecode() override;
+				virtual bool OnFinalize() override;
+			private:
+				PLGraphics::Image m_cImage;	/**< Image loaded by a worker thread */
+		};
+
+
 	//[-------------------------------------------------------]
 	//[ Public functions                                      ]
 	//[-------------------------------------------------------]
@@ -275,6 +296,7 @@ class TextureManager : public PLCore::ResourceManager<Texture> {
 	//[-------------------------------------------------------]
 	private:
 		virtual Texture *CreateResource(const PLCore::String &sName) override;
+		virtual ResourceLoadRequest *CreateLoadRequest(Texture &cResource, const PLCore::String &sFilename, float fPriority) override;
 
 
 };
@@ -33,6 +33,7 @@
 #include <PLGraphics/Image/ImageBuffer.h>
 #include "PLRenderer/RendererContext.h"
 #include "PLRenderer/Renderer/Surface.h"
+#include "PLRenderer/Renderer/Program.h"
 #include "PLRenderer/Renderer/IndexBuffer.h"
 #include "PLRenderer/Renderer/VertexBuffer.h"
 #include "PLRenderer/Renderer/TextureBuffer.h"
@@ -358,6 +359,28 @@ bool RendererBackend::CheckTextureBufferCube(Image &cImage, TextureBuffer::EPixe
 }
 
 
+//[-------------------------------------------------------]
+//[ Protected virtual RendererBackend functions           ]
+//[-------------------------------------------------------]
+bool RendererBackend::ApplyRenderState(RenderState::Enum nState, uint32 nValue)
+{
+	// The default implementation is empty
+	return true;
+}
+
+bool RendererBackend::ApplySamplerState(uint32 nStage, Sampler::Enum nState, uint32 nValue)
+{
+	// The default implementation is empty
+	return true;
+}
+
+bool RendererBackend::ApplyProgram(Program *pProgram, Program *pPreviousProgram)
+{
+	// The default implementation is empty
+	return true;
+}
+
+
 //[-------------------------------------------------------]
 //[ Public virtual Renderer functions                     ]
 //[-------------------------------------------------------]
@@ -473,6 +496,8 @@ void RendererBackend::Update()
 		pProfiling->Set(sAPI, "Number of resources",			GetNumOfResources());
 		pProfiling->Set(sAPI, "Render state changes",			sS.nRenderStateChanges);
 		pProfiling->Set(sAPI, "Sampler state changes",			sS.nSamplerStateChanges);
+		pProfiling->Set(sAPI, "Program changes",				sS.nProgramChanges);
+		pProfiling->Set(sAPI, "Redundant state changes",		String::Format("%d render, %d sampler, %d program", sS.nRedundantRenderStates, sS.nRedundantSamplerStates, sS.nRedundantPrograms));
 		pProfiling->Set(sAPI, "Draw primitive calls",			sS.nDrawPrimitivCalls);
 		pProfiling->Set(sAPI, "Current triangles",				sS.nTriangles);
 		pProfiling->Set(sAPI, "Current vertices",				sS.nVertices);
@@ -481,7 +506,7 @@ void RendererBackend::Update()
 		pProfiling->Set(sAPI, "Number of texture buffers",		sS.nTextureBuffersNum);
 		const float fTextureBuffersMemKB = static_cast<float>(sS.nTextureBuffersMem)/1024.0f;
 		pProfiling->Set(sAPI, "Texture buffers memory",			String::Format("%g KB (%g MB)",			fTextureBuffersMemKB, fTextureBuffersMemKB/1024.0f));
-		pProfiling->Set(sAPI, "Texture buffer binds",			sS.nTextureBufferBinds);
+		pProfiling->Set(sAPI, "Texture buffer binds",			String::Format("%d (%d redundant)",		sS.nTextureBufferBinds, sS.nRedundantTextureBuffers));
 		// Vertex buffers
 		pProfiling->Set(sAPI, "Number of vertex buffers",		sS.nVertexBufferNum);
 		const float fVertexBufferMemKB = static_cast<float>(sS.nVertexBufferMem)/1024.0f;
@@ -502,11 +527,16 @@ void RendererBackend::Update()
 	// Reset some statistics
 	m_sStatistics.nRenderStateChanges		= 0;
 	m_sStatistics.nSamplerStateChanges		= 0;
+	m_sStatistics.nProgramChanges			= 0;
+	m_sStatistics.nRedundantRenderStates	= 0;
+	m_sStatistics.nRedundantSamplerStates	= 0;
+	m_sStatistics.nRedundantPrograms		= 0;
 	m_sStatistics.nDrawPrimitivCalls		= 0;
 	m_sStatistics.nVertices					= 0;
 	m_sStatistics.nTriangles				= 0;
 	m_sStatistics.fRenderingTime			= 0.0f;
 	m_sStatistics.nTextureBufferBinds		= 0;
+	m_sStatistics.nRedundantTextureBuffers	= 0;
 	m_sStatistics.nVertexBuffersSetupTime	= 0;
 	m_sStatistics.nVertexBufferLocks		= 0;
 	m_sStatistics.nIndexBuffersSetupTime	= 0;
@@ -625,6 +655,29 @@ int RendererBackend::GetRenderState(RenderState::Enum nState) const
 	return (nState < RenderState::Number) ? m_nRenderState[nState] : -1;
 }
 
+bool RendererBackend::SetRenderState(RenderState::Enum nState, uint32 nValue)
+{
+	// Check if the state is a valid render state member
+	if (nState >= RenderState::Number)
+		return false; // Error!
+
+	// Check if this render state is already set to this value
+	if (m_nRenderState[nState] == nValue) {
+		// Update statistics
+		m_sStatistics.nRedundantRenderStates++;
+
+		// Done, nothing to do here :)
+		return true;
+	}
+
+	// Set the render state
+	m_nRenderState[nState] = nValue;
+	m_sStatistics.nRenderStateChanges++;
+
+	// Let the API backend do the real work
+	return ApplyRenderState(nState, nValue);
+}
+
 // Sampler states
 uint32 RendererBackend::GetDefaultSamplerState(Sampler::Enum nState) const
 {
@@ -646,6 +699,29 @@ int RendererBackend::GetSamplerState(uint32 nStage, Sampler::Enum nState) const
 	return (nStage < m_sCapabilities.nMaxTextureUnits && nState < Sampler::Number) ? m_ppnSamplerState[nStage][nState] : -1;
 }
 
+bool RendererBackend::SetSamplerState(uint32 nStage, Sampler::Enum nState, uint32 nValue)
+{
+	// Check if the stage is correct and check if the state is a valid sampler member
+	if (nStage >= m_sCapabilities.nMaxTextureUnits || nState >= Sampler::Number)
+		return false; // Error!
+
+	// Check if this sampler state is already set to this value
+	if (m_ppnSamplerState[nStage][nState] == nValue) {
+		// Update statistics
+		m_sStatistics.nRedundantSamplerStates++;
+
+		// Done, nothing to do here :)
+		return true;
+	}
+
+	// Set the sampler state
+	m_ppnSamplerState[nStage][nState] = nValue;
+	m_sStatistics.nSamplerStateChanges++;
+
+	// Let the API backend do the real work
+	return ApplySamplerState(nStage, nState, nValue);
+}
+
 
 //[-------------------------------------------------------]
 //[ Misc                                                  ]
@@ -780,6 +856,45 @@ TextureBuffer *RendererBackend::GetTextureBuffer(uint32 nStage) const
 	return (nStage < m_sCapabilities.nMaxTextureUnits) ? m_ppCurrentTextureBuffer[nStage] : nullptr;
 }
 
+bool RendererBackend::SetTextureBuffer(int nStage, TextureBuffer *pTextureBuffer)
+{
+	// Set all available texture stages to this setting?
+	if (nStage < 0) {
+		for (uint32 i=0; i<m_sCapabilities.nMaxTextureUnits; i++)
+			SetTextureBuffer(i, pTextureBuffer);
+	} else {
+		// Check if the stage is correct
+		if (static_cast<uint32>(nStage) >= m_sCapabilities.nMaxTextureUnits)
+			return false; // Error!
+
+		// Is this texture buffer already set?
+		if (m_ppCurrentTextureBuffer[nStage] == pTextureBuffer) {
+			// Update statistics
+			m_sStatistics.nRedundantTextureBuffers++;
+
+			// Error!
+			return false;
+		}
+
+		// Make this texture buffer to the renderers current one
+		TextureBuffer *pPreviousTextureBuffer = m_ppCurrentTextureBuffer[nStage];
+		m_ppCurrentTextureBuffer[nStage] = pTextureBuffer;
+		if (pTextureBuffer)
+			m_sStatistics.nTextureBufferBinds++;
+
+		// Let the API backend do the real work
+		if (!ApplyTextureBuffer(nStage, pPreviousTextureBuffer)) {
+			m_ppCurrentTextureBuffer[nStage] = pPreviousTextureBuffer;
+
+			// Error!
+			return false;
+		}
+	}
+
+	// Done
+	return true;
+}
+
 IndexBuffer *RendererBackend::GetIndexBuffer() const
 {
 	return m_pCurrentIndexBuffer;
@@ -792,8 +907,22 @@ Program *RendererBackend::GetProgram() const
 
 bool RendererBackend::SetProgram(Program *pProgram)
 {
-	// Not implemented
-	return false;
+	// Is the new program the same one as the current one?
+	Program *pPreviousProgram = static_cast<Program*>(m_cProgramHandler.GetResource());
+	if (pPreviousProgram == pProgram) {
+		// Update statistics
+		m_sStatistics.nRedundantPrograms++;
+
+		// Done, nothing to do here :)
+		return true;
+	}
+
+	// Update the program resource handler
+	m_cProgramHandler.SetResource(pProgram);
+	m_sStatistics.nProgramChanges++;
+
+	// Let the API backend do the real work
+	return ApplyProgram(pProgram, pPreviousProgram);
 }
 
 
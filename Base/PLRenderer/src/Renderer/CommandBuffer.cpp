@@ -0,0 +1,415 @@
+/*********************************************************\
+ *  File: CommandBuffer.cpp                              *
+ *
+ *  Copyright (C) 2002-2013 The PixelLight Team (http://www.pixellight.org/)
+ *
+ *  This file is part of PixelLight.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ *  and associated documentation files (the "Software"), to deal in the Software without
+ *  restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ *  Software is furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all copies or
+ *  substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ *  BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ *  DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ *  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include <PLCore/Core/MemoryManager.h>
+#include <PLMath/Vector2.h>
+#include <PLMath/Vector3.h>
+#include <PLMath/Vector4.h>
+#include <PLMath/Matrix3x3.h>
+#include <PLMath/Matrix4x4.h>
+#include <PLMath/Rectangle.h>
+#include "PLRenderer/Renderer/Renderer.h"
+#include "PLRenderer/Renderer/ProgramUniform.h"
+#include "PLRenderer/Renderer/ProgramAttribute.h"
+#include "PLRenderer/Renderer/CommandBuffer.h"
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+using namespace PLCore;
+using namespace PLMath;
+using namespace PLGraphics;
+namespace PLRenderer {
+
+
+//[-------------------------------------------------------]
+//[ Public functions                                      ]
+//[-------------------------------------------------------]
+/**
+*  @brief
+*    Constructor
+*/
+CommandBuffer::CommandBuffer() :
+	m_pnData(nullptr),
+	m_nSize(0),
+	m_nCapacity(0),
+	m_nNumOfCommands(0)
+{
+}
+
+/**
+*  @brief
+*    Destructor
+*/
+CommandBuffer::~CommandBuffer()
+{
+	// The command stream is allocated by "MemoryManager::Reallocator()"
+	if (m_pnData)
+		MemoryManager::Deallocator(MemoryManager::DeleteArray, m_pnData);
+}
+
+/**
+*  @brief
+*    Ensures that the command stream is able to hold at least the given number of bytes without reallocation
+*/
+void CommandBuffer::Reserve(uint32 nSize)
+{
+	if (nSize > m_nCapacity) {
+		m_pnData	= static_cast<uint8*>(MemoryManager::Reallocator(m_pnData, nSize));
+		m_nCapacity = nSize;
+	}
+}
+
+/**
+*  @brief
+*    Appends all commands recorded by another command buffer
+*/
+void CommandBuffer::Append(const CommandBuffer &cCommandBuffer)
+{
+	if (&cCommandBuffer != this && cCommandBuffer.m_nSize) {
+		if (m_nSize + cCommandBuffer.m_nSize > m_nCapacity)
+			Grow(cCommandBuffer.m_nSize);
+		MemoryManager::Copy(m_pnData + m_nSize, cCommandBuffer.m_pnData, cCommandBuffer.m_nSize);
+		m_nSize			 += cCommandBuffer.m_nSize;
+		m_nNumOfCommands += cCommandBuffer.m_nNumOfCommands;
+	}
+}
+
+/**
+*  @brief
+*    Replays all recorded commands in the order they were recorded
+*/
+uint32 CommandBuffer::Execute(Renderer &cRenderer) const
+{
+	const uint8 *pnCommand = m_pnData;
+	const uint8 *pnEnd	   = m_pnData + m_nSize;
+	while (pnCommand < pnEnd) {
+		const CommandHeader *pCommandHeader = reinterpret_cast<const CommandHeader*>(pnCommand);
+		const void			*pData			= pCommandHeader + 1;
+		switch (pCommandHeader->nType) {
+			case CommandSetRenderState:
+			{
+				const StateCommand *pCommand = static_cast<const StateCommand*>(pData);
+				cRenderer.SetRenderState(static_cast<RenderState::Enum>(pCommand->nState), pCommand->nValue);
+				break;
+			}
+
+			case CommandSetSamplerState:
+			{
+				const StateCommand *pCommand = static_cast<const StateCommand*>(pData);
+				cRenderer.SetSamplerState(pCommand->nStage, static_cast<Sampler::Enum>(pCommand->nState), pCommand->nValue);
+				break;
+			}
+
+			case CommandSetViewport:
+			{
+				const RectangleCommand *pCommand = static_cast<const RectangleCommand*>(pData);
+				if (pCommand->bRectangle) {
+					const Rectangle cRectangle(pCommand->fRectangle[0], pCommand->fRectangle[1], pCommand->fRectangle[2], pCommand->fRectangle[3]);
+					cRenderer.SetViewport(&cRectangle, pCommand->fMinZ, pCommand->fMaxZ);
+				} else {
+					cRenderer.SetViewport(nullptr, pCommand->fMinZ, pCommand->fMaxZ);
+				}
+				break;
+			}
+
+			case CommandSetScissorRect:
+			{
+				const RectangleCommand *pCommand = static_cast<const RectangleCommand*>(pData);
+				if (pCommand->bRectangle) {
+					const Rectangle cRectangle(pCommand->fRectangle[0], pCommand->fRectangle[1], pCommand->fRectangle[2], pCommand->fRectangle[3]);
+					cRenderer.SetScissorRect(&cRectangle);
+				} else {
+					cRenderer.SetScissorRect(nullptr);
+				}
+				break;
+			}
+
+			case CommandSetColorMask:
+			{
+				const uint32 nMask = static_cast<const StateCommand*>(pData)->nValue;
+				cRenderer.SetColorMask((nMask & 1) != 0, (nMask & 2) != 0, (nMask & 4) != 0, (nMask & 8) != 0);
+				break;
+			}
+
+			case CommandClear:
+			{
+				const ClearCommand *pCommand = static_cast<const ClearCommand*>(pData);
+				cRenderer.Clear(pCommand->nFlags, Color4(pCommand->fColor), pCommand->fZ, pCommand->nStencil);
+				break;
+			}
+
+			case CommandSetRenderTarget:
+			{
+				const ResourceCommand *pCommand = static_cast<const ResourceCommand*>(pData);
+				cRenderer.SetRenderTarget(static_cast<Surface*>(pCommand->pResource), static_cast<uint8>(pCommand->nIndex));
+				break;
+			}
+
+			case CommandSetTextureBuffer:
+			{
+				const ResourceCommand *pCommand = static_cast<const ResourceCommand*>(pData);
+				cRenderer.SetTextureBuffer(pCommand->nIndex, static_cast<TextureBuffer*>(pCommand->pResource));
+				break;
+			}
+
+			case CommandSetIndexBuffer:
+				cRenderer.SetIndexBuffer(static_cast<IndexBuffer*>(static_cast<const ResourceCommand*>(pData)->pResource));
+				break;
+
+			case CommandSetProgram:
+				cRenderer.SetProgram(static_cast<Program*>(static_cast<const ResourceCommand*>(pData)->pResource));
+				break;
+
+			case CommandSetProgramAttributeIndex:
+			{
+				const ProgramAttributeCommand *pCommand = static_cast<const ProgramAttributeCommand*>(pData);
+				pCommand->pProgramAttribute->Set(pCommand->pVertexBuffer, pCommand->nIndex);
+				break;
+			}
+
+			case CommandSetProgramAttributeSemantic:
+			{
+				const ProgramAttributeCommand *pCommand = static_cast<const ProgramAttributeCommand*>(pData);
+				pCommand->pProgramAttribute->Set(pCommand->pVertexBuffer, static_cast<VertexBuffer::ESemantic>(pCommand->nIndex), pCommand->nChannel);
+				break;
+			}
+
+			case CommandSetProgramUniformInt:
+			{
+				const ProgramUniformCommand *pCommand = static_cast<const ProgramUniformCommand*>(pData);
+				pCommand->pProgramUniform->Set(pCommand->nValue);
+				break;
+			}
+
+			case CommandSetProgramUniformFloat:
+			{
+				// The float components are directly behind the command data
+				const ProgramUniformCommand *pCommand = static_cast<const ProgramUniformCommand*>(pData);
+				const float *pfComponents = reinterpret_cast<const float*>(pCommand + 1);
+				switch (pCommand->nValue) {
+					case 1:
+						pCommand->pProgramUniform->Set(pfComponents[0]);
+						break;
+
+					case 2:
+						pCommand->pProgramUniform->Set2(pfComponents);
+						break;
+
+					case 3:
+						pCommand->pProgramUniform->Set3(pfComponents);
+						break;
+
+					case 4:
+						pCommand->pProgramUniform->Set4(pfComponents);
+						break;
+
+					case 9:
+						pCommand->pProgramUniform->Set(Matrix3x3(pfComponents), pCommand->bTranspose);
+						break;
+
+					case 16:
+						pCommand->pProgramUniform->Set(Matrix4x4(pfComponents), pCommand->bTranspose);
+						break;
+				}
+				break;
+			}
+
+			case CommandSetProgramUniformTextureBuffer:
+			{
+				const ProgramUniformCommand *pCommand = static_cast<const ProgramUniformCommand*>(pData);
+				pCommand->pProgramUniform->Set(pCommand->pTextureBuffer);
+				break;
+			}
+
+			case CommandDrawPrimitives:
+			{
+				const DrawCommand *pCommand = static_cast<const DrawCommand*>(pData);
+				cRenderer.DrawPrimitives(static_cast<Primitive::Enum>(pCommand->nType), pCommand->nStartIndex, pCommand->nNumVertices);
+				break;
+			}
+
+			case CommandDrawIndexedPrimitives:
+			{
+				const DrawCommand *pCommand = static_cast<const DrawCommand*>(pData);
+				cRenderer.DrawIndexedPrimitives(static_cast<Primitive::Enum>(pCommand->nType), pCommand->nMinIndex, pCommand->nMaxIndex, pCommand->nStartIndex, pCommand->nNumVertices);
+				break;
+			}
+
+			case CommandDrawPrimitivesInstanced:
+			{
+				const DrawCommand *pCommand = static_cast<const DrawCommand*>(pData);
+				cRenderer.DrawPrimitivesInstanced(static_cast<Primitive::Enum>(pCommand->nType), pCommand->nStartIndex, pCommand->nNumVertices, pCommand->nNumOfInstances);
+				break;
+			}
+
+			case CommandDrawIndexedPrimitivesInstanced:
+			{
+				const DrawCommand *pCommand = static_cast<const DrawCommand*>(pData);
+				cRenderer.DrawIndexedPrimitivesInstanced(static_cast<Primitive::Enum>(pCommand->nType), pCommand->nMinIndex, pCommand->nMaxIndex, pCommand->nStartIndex, pCommand->nNumVertices, pCommand->nNumOfInstances);
+				break;
+			}
+		}
+
+		// Next command, please
+		pnCommand += pCommandHeader->nSize;
+	}
+
+	// Done
+	return m_nNumOfCommands;
+}
+
+//[-------------------------------------------------------]
+//[ States                                                ]
+//[-------------------------------------------------------]
+void CommandBuffer::SetViewport(const Rectangle *pRectangle, float fMinZ, float fMaxZ)
+{
+	RectangleCommand &sCommand = AddCommand<RectangleCommand>(CommandSetViewport);
+	sCommand.bRectangle = (pRectangle != nullptr);
+	if (pRectangle) {
+		sCommand.fRectangle[0] = pRectangle->vMin.x;
+		sCommand.fRectangle[1] = pRectangle->vMin.y;
+		sCommand.fRectangle[2] = pRectangle->vMax.x;
+		sCommand.fRectangle[3] = pRectangle->vMax.y;
+	}
+	sCommand.fMinZ = fMinZ;
+	sCommand.fMaxZ = fMaxZ;
+}
+
+void CommandBuffer::SetScissorRect(const Rectangle *pRectangle)
+{
+	RectangleCommand &sCommand = AddCommand<RectangleCommand>(CommandSetScissorRect);
+	sCommand.bRectangle = (pRectangle != nullptr);
+	if (pRectangle) {
+		sCommand.fRectangle[0] = pRectangle->vMin.x;
+		sCommand.fRectangle[1] = pRectangle->vMin.y;
+		sCommand.fRectangle[2] = pRectangle->vMax.x;
+		sCommand.fRectangle[3] = pRectangle->vMax.y;
+	}
+}
+
+void CommandBuffer::Clear(uint32 nFlags, const Color4 &cColor, float fZ, uint32 nStencil)
+{
+	ClearCommand &sCommand = AddCommand<ClearCommand>(CommandClear);
+	sCommand.nFlags = nFlags;
+	cColor.GetRGBA(sCommand.fColor);
+	sCommand.fZ		  = fZ;
+	sCommand.nStencil = nStencil;
+}
+
+//[-------------------------------------------------------]
+//[ Resources                                             ]
+//[-------------------------------------------------------]
+void CommandBuffer::SetProgramUniform(ProgramUniform &cProgramUniform, const Vector2 &vVector)
+{
+	AddProgramUniformFloat(cProgramUniform, vVector.fV, 2);
+}
+
+void CommandBuffer::SetProgramUniform(ProgramUniform &cProgramUniform, const Vector3 &vVector)
+{
+	AddProgramUniformFloat(cProgramUniform, vVector.fV, 3);
+}
+
+void CommandBuffer::SetProgramUniform(ProgramUniform &cProgramUniform, const Vector4 &vVector)
+{
+	AddProgramUniformFloat(cProgramUniform, vVector.fV, 4);
+}
+
+void CommandBuffer::SetProgramUniform(ProgramUniform &cProgramUniform, const Color4 &cColor)
+{
+	AddProgramUniformFloat(cProgramUniform, cColor.fColor, 4);
+}
+
+void CommandBuffer::SetProgramUniform(ProgramUniform &cProgramUniform, const Matrix3x3 &mMatrix, bool bTranspose)
+{
+	AddProgramUniformFloat(cProgramUniform, mMatrix.fM, 9, bTranspose);
+}
+
+void CommandBuffer::SetProgramUniform(ProgramUniform &cProgramUniform, const Matrix4x4 &mMatrix, bool bTranspose)
+{
+	AddProgramUniformFloat(cProgramUniform, mMatrix.fM, 16, bTranspose);
+}
+
+
+//[-------------------------------------------------------]
+//[ Private functions                                     ]
+//[-------------------------------------------------------]
+/**
+*  @brief
+*    Copy constructor
+*/
+CommandBuffer::CommandBuffer(const CommandBuffer &cSource) :
+	m_pnData(nullptr),
+	m_nSize(0),
+	m_nCapacity(0),
+	m_nNumOfCommands(0)
+{
+	// No implementation because the copy constructor is never used
+}
+
+/**
+*  @brief
+*    Copy operator
+*/
+CommandBuffer &CommandBuffer::operator =(const CommandBuffer &cSource)
+{
+	// No implementation because the copy operator is never used
+	return *this;
+}
+
+/**
+*  @brief
+*    Adds a float program uniform command to the command stream
+*/
+void CommandBuffer::AddProgramUniformFloat(ProgramUniform &cProgramUniform, const float *pfComponents, uint16 nNumOfComponents, bool bTranspose)
+{
+	ProgramUniformCommand *pCommand = static_cast<ProgramUniformCommand*>(AddCommand(CommandSetProgramUniformFloat, sizeof(ProgramUniformCommand) + nNumOfComponents*sizeof(float)));
+	pCommand->pProgramUniform = &cProgramUniform;
+	pCommand->nValue		  = nNumOfComponents;
+	pCommand->bTranspose	  = bTranspose;
+	MemoryManager::Copy(pCommand + 1, pfComponents, nNumOfComponents*sizeof(float));
+}
+
+/**
+*  @brief
+*    Enlarges the command stream so that at least the given number of bytes can be added
+*/
+void CommandBuffer::Grow(uint32 nSize)
+{
+	// Double the capacity to keep the number of reallocations low, start with 4 KiB
+	uint32 nCapacity = m_nCapacity ? m_nCapacity*2 : 4096;
+	while (nCapacity < m_nSize + nSize)
+		nCapacity *= 2;
+	Reserve(nCapacity);
+}
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+} // PLRenderer
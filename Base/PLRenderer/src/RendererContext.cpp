@@ -28,6 +28,7 @@
 #include <PLCore/Base/Class.h>
 #include <PLCore/Tools/Stopwatch.h>
 #include <PLCore/Tools/Profiling.h>
+#include <PLCore/Tools/LoadableManager.h>
 #include "PLRenderer/Renderer/Renderer.h"
 #include "PLRenderer/Texture/TextureManager.h"
 #include "PLRenderer/Effect/EffectManager.h"
@@ -134,6 +135,10 @@ void RendererContext::Update()
 	// Start stopwatch
 	Stopwatch cStopwatch(true);
 
+	// Finalize asynchronously loaded resources, renderer resources must be created by this thread
+	// -> Spend at most about 4 milliseconds on this so streaming in a bunch of resources doesn't stall the frame
+	LoadableManager::GetInstance()->UpdateAsync(4);
+
 	// Emit the update event
 	EventUpdate();
 
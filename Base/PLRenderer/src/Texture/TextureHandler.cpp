@@ -398,11 +398,16 @@ bool TextureHandler::Load(TextureManager &cTextureManager, const String &sFilena
 		} else {
 			pTexture = cTextureManager.GetByName(sFilename);
 			if (!pTexture) {
-				pTexture = cTextureManager.Create(sFilename);
-				if (pTexture && !pTexture->LoadByFilename(sFilename)) {
-					// Can't load texture...
-					delete pTexture;
-					pTexture = nullptr;
+				if (cTextureManager.GetAsyncLoading()) {
+					// As long as the texture is loading, "GetTexture()" returns the standard texture
+					pTexture = cTextureManager.LoadResourceAsync(sFilename);
+				} else {
+					pTexture = cTextureManager.Create(sFilename);
+					if (pTexture && !pTexture->LoadByFilename(sFilename)) {
+						// Can't load texture...
+						delete pTexture;
+						pTexture = nullptr;
+					}
 				}
 			}
 		}
@@ -454,7 +459,7 @@ bool TextureHandler::Bind(uint32 nStage) const
 		}
 	} else {
 		// Bind texture
-		const Texture *pTexture = GetResource();
+		const Texture *pTexture = GetTexture();
 		if (pTexture && pTexture->Bind(nStage)) {
 			// Fixed functions
 			FixedFunctions *pFixedFunctions = pTexture->GetTextureManager().GetRendererContext().GetRenderer().GetFixedFunctions();
@@ -479,7 +484,10 @@ bool TextureHandler::Bind(uint32 nStage) const
 Texture *TextureHandler::GetTexture() const
 {
 	// Is there a texture animation?
-	return m_pAnimationState ? m_pAnimationState->GetTexture() : GetResource();
+	Texture *pTexture = m_pAnimationState ? m_pAnimationState->GetTexture() : GetResource();
+
+	// As long as the texture is loading asynchronously, the standard texture is used instead
+	return pTexture ? &pTexture->GetTextureManager().GetUsableResource(*pTexture) : nullptr;
 }
 
 /**
@@ -488,9 +496,10 @@ Texture *TextureHandler::GetTexture() const
 */
 TextureHandler &TextureHandler::operator =(const TextureHandler &cSource)
 {
-	// Texture
-	if (cSource.GetTexture())
-		SetResource(cSource.GetTexture());
+	// Texture (not the standard texture which may be used while the texture is loading)
+	Texture *pTexture = cSource.m_pAnimationState ? cSource.m_pAnimationState->GetTexture() : cSource.GetResource();
+	if (pTexture)
+		SetResource(pTexture);
 
 	// Texture animation state
 	if (cSource.m_pAnimationState) {
@@ -190,6 +190,35 @@ Texture *TextureManager::CreateResource(const String &sName)
 	return new Texture(*this, sName);
 }
 
+PLCore::ResourceManager<Texture>::ResourceLoadRequest *TextureManager::CreateLoadRequest(Texture &cResource, const String &sFilename, float fPriority)
+{
+	return new TextureLoadRequest(*this, cResource, sFilename, fPriority);
+}
+
+
+//[-------------------------------------------------------]
+//[ TextureManager::TextureLoadRequest                    ]
+//[-------------------------------------------------------]
+TextureManager::TextureLoadRequest::TextureLoadRequest(TextureManager &cManager, Texture &cTexture, const String &sFilename, float fPriority) : ResourceLoadRequest(cManager, cTexture, sFilename, fPriority)
+{
+}
+
+TextureManager::TextureLoadRequest::~TextureLoadRequest()
+{
+}
+
+bool TextureManager::TextureLoadRequest::OnDecode()
+{
+	// Load the image by using the read file data, this is the expensive part
+	return m_cImage.LoadByFile(GetFile());
+}
+
+bool TextureManager::TextureLoadRequest::OnFinalize()
+{
+	// Create the texture buffer by using the loaded image
+	return (m_pResource && m_pResource->LoadFromImage(GetFile().GetUrl().GetUrl(), m_cImage));
+}
+
 
 //[-------------------------------------------------------]
 //[ Namespace                                             ]
@@ -115,6 +115,22 @@ class SceneRenderer : public PLCore::Resource<SceneRenderer>, public PLCore::Ele
 		*/
 		PLS_API SceneRendererPass *Create(const PLCore::String &sClass, const PLCore::String &sName = "", const PLCore::String &sParameters = "");
 
+		/**
+		*  @brief
+		*    Copy operator
+		*
+		*  @param[in] cSource
+		*    Source to copy from
+		*
+		*  @return
+		*    Reference to this instance
+		*
+		*  @note
+		*    - The scene renderer passes are recreated by using their class names and attribute values
+		*    - Events are not copied
+		*/
+		PLS_API SceneRenderer &operator =(const SceneRenderer &cSource);
+
 
 	//[-------------------------------------------------------]
 	//[ Protected functions                                   ]
@@ -72,6 +72,10 @@ namespace PLScene {
 *    only consists of one bit piece of code - and scene renderers can get REALLY extensive!
 *    In short, you can imagine 'scene renderer passes' as 'subsystems' of a scene renderer.
 *
+*    The renderer given to "Draw()" must only be used by the thread owning the renderer context. Passes building
+*    their draw work in parallel (for example by using the job system) can record it into "PLRenderer::CommandBuffer"
+*    instances, one per job, and replay them in the desired order within "Draw()" by using "CommandBuffer::Execute()".
+*
 *  @note
 *    - Derived classes should use a 'SRP' prefix (example: SRPBegin)
 */
@@ -39,6 +39,9 @@
 //[-------------------------------------------------------]
 //[ Forward declarations                                  ]
 //[-------------------------------------------------------]
+namespace PLCore {
+	class JobSystem;
+}
 namespace PLMath {
 	class GraphPathManager;
 }
@@ -53,6 +56,7 @@ namespace PLScene {
 	class VisManager;
 	class SceneContainer;
 	class SceneNodeHandler;
+	class SceneNodeModifier;
 	class SceneRendererManager;
 }
 
@@ -80,6 +84,7 @@ class SceneContext : public PLCore::AbstractContext {
 	//[ Friends                                               ]
 	//[-------------------------------------------------------]
 	friend class SceneNode;
+	friend class SceneNodeModifier;
 
 
 	//[-------------------------------------------------------]
@@ -171,6 +176,9 @@ class SceneContext : public PLCore::AbstractContext {
 		*    recommended to keep the work done within the implementation as compact as possible.
 		*    Don't use this method to perform 'polling'-everything, use events or if required
 		*    for example timers instead.
+		*
+		*    At first, "EventUpdate" is emitted. If "SetParallelUpdate()" is enabled, the scene node
+		*    modifiers registered by using "AddParallelUpdate()" are updated in parallel after this.
 		*/
 		PLS_API void Update(bool bRespectPause = true);
 
@@ -193,6 +201,75 @@ class SceneContext : public PLCore::AbstractContext {
 		PLS_API VisManager &GetVisManager();
 
 
+		//[-------------------------------------------------------]
+		//[ Parallel update                                       ]
+		//[-------------------------------------------------------]
+		/**
+		*  @brief
+		*    Returns whether or not the registered scene node modifiers are updated in parallel
+		*
+		*  @return
+		*    'true' if the registered scene node modifiers are updated in parallel, else 'false' (default)
+		*/
+		PLS_API bool GetParallelUpdate() const;
+
+		/**
+		*  @brief
+		*    Sets whether or not the registered scene node modifiers are updated in parallel
+		*
+		*  @param[in] bParallelUpdate
+		*    'true' if the registered scene node modifiers should be updated in parallel by using
+		*    "PLCore::JobSystem", else 'false'
+		*
+		*  @remarks
+		*    Within a parallel update, "SceneNodeModifier::OnUpdatePrepare()" is called for each registered
+		*    scene node modifier one after another by the thread calling "Update()". After that,
+		*    "SceneNodeModifier::OnUpdateParallel()" of the registered scene node modifiers is called in
+		*    batches on the worker threads of the job system. After all batches are done,
+		*    "SceneNodeModifier::OnUpdateCommit()" is called for each registered scene node modifier one
+		*    after another by the thread calling "Update()". Scene node modifiers do everything emitting
+		*    events or touching shared data within the preparation, store changes of the owner scene node
+		*    like a new transform within the parallel part and apply them within the commit, so the scene
+		*    node transform, the bounding boxes and the scene hierarchy stay consistent and all events are
+		*    emitted by the calling thread.
+		*
+		*    If the parallel update is disabled, the registered scene node modifiers are updated by their
+		*    "EventUpdate"-handlers in the usual order of the event handlers, "SceneNodeModifier::OnUpdatePrepare()",
+		*    "SceneNodeModifier::OnUpdateParallel()" and "SceneNodeModifier::OnUpdateCommit()" are called directly
+		*    after each other (see "SceneNodeModifier::UpdateSerial()"). The parallel update is only used if the
+		*    job system has worker threads.
+		*/
+		PLS_API void SetParallelUpdate(bool bParallelUpdate);
+
+		/**
+		*  @brief
+		*    Registers a scene node modifier for the (parallel) update
+		*
+		*  @param[in] cSceneNodeModifier
+		*    Scene node modifier to register, must have an implementation of "SceneNodeModifier::OnUpdateParallel()"
+		*    which is safe to be called concurrently with other scene node modifiers
+		*
+		*  @note
+		*    - Usually called by a scene node modifier within "SceneNodeModifier::OnActivate()" in addition to connecting to "EventUpdate"
+		*    - Registering an already registered scene node modifier has no effect
+		*    - A scene node modifier is unregistered automatically when it's destroyed
+		*    - Don't call this method from within "SceneNodeModifier::OnUpdateParallel()"
+		*/
+		PLS_API void AddParallelUpdate(SceneNodeModifier &cSceneNodeModifier);
+
+		/**
+		*  @brief
+		*    Unregisters a scene node modifier from the (parallel) update
+		*
+		*  @param[in] cSceneNodeModifier
+		*    Scene node modifier to unregister
+		*
+		*  @note
+		*    - Don't call this method from within "SceneNodeModifier::OnUpdateParallel()"
+		*/
+		PLS_API void RemoveParallelUpdate(SceneNodeModifier &cSceneNodeModifier);
+
+
 		//[-------------------------------------------------------]
 		//[ Processing                                            ]
 		//[-------------------------------------------------------]
@@ -260,19 +337,55 @@ class SceneContext : public PLCore::AbstractContext {
 		PLS_API bool EndProcess();
 
 
+	//[-------------------------------------------------------]
+	//[ Private functions                                     ]
+	//[-------------------------------------------------------]
+	private:
+		/**
+		*  @brief
+		*    Updates the registered scene node modifiers in parallel
+		*
+		*  @param[in] cJobSystem
+		*    Job system to use, must have worker threads
+		*  @param[in] bProfiling
+		*    Update the profiling data?
+		*/
+		void UpdateModifiers(PLCore::JobSystem &cJobSystem, bool bProfiling);
+
+		/**
+		*  @brief
+		*    Job system parallel for function updating a batch of registered scene node modifiers
+		*
+		*  @param[in] nBegin
+		*    Index of the first scene node modifier within the batch
+		*  @param[in] nEnd
+		*    Index behind the last scene node modifier within the batch
+		*  @param[in] pData
+		*    Scene context, always valid
+		*/
+		static void UpdateModifiersBatch(PLCore::uint32 nBegin, PLCore::uint32 nEnd, void *pData);
+
+
 	//[-------------------------------------------------------]
 	//[ Private data                                          ]
 	//[-------------------------------------------------------]
 	private:
-		PLRenderer::RendererContext  *m_pRendererContext;		/**< The used renderer context, not destroyed by the scene context (always valid!) */
-		PLMesh::MeshManager			 *m_pMeshManager;			/**< The mesh manager, can be a null pointer */
-		PLMath::GraphPathManager	 *m_pGraphPathManager;		/**< The graph path manager, can be a null pointer */
-		SceneNodeHandler			 *m_pRoot;					/**< The root of the scene graph (always valid!) */
-		PLCore::Array<SceneNode*>	  m_lstDeleteNodes;			/**< List of scene nodes to delete */
-		SceneRendererManager		 *m_pSceneRendererManager;	/**< Scene renderer manager, can be a null pointer */
-		VisManager					 *m_pVisManager;			/**< Visibility manager, can be a null pointer */
-		bool						  m_bProcessActive;			/**< Is there currently an active process? */
-		PLCore::uint32				  m_nProcessCounter;		/**< Internal process counter */
+		PLRenderer::RendererContext			 *m_pRendererContext;			/**< The used renderer context, not destroyed by the scene context (always valid!) */
+		PLMesh::MeshManager					 *m_pMeshManager;				/**< The mesh manager, can be a null pointer */
+		PLMath::GraphPathManager			 *m_pGraphPathManager;			/**< The graph path manager, can be a null pointer */
+		SceneNodeHandler					 *m_pRoot;						/**< The root of the scene graph (always valid!) */
+		PLCore::Array<SceneNode*>			  m_lstDeleteNodes;				/**< List of scene nodes to delete */
+		SceneRendererManager				 *m_pSceneRendererManager;		/**< Scene renderer manager, can be a null pointer */
+		VisManager							 *m_pVisManager;				/**< Visibility manager, can be a null pointer */
+		bool								  m_bProcessActive;				/**< Is there currently an active process? */
+		PLCore::uint32						  m_nProcessCounter;			/**< Internal process counter */
+		// Parallel update
+		bool								  m_bParallelUpdate;			/**< Update the registered scene node modifiers in parallel? */
+		bool								  m_bParallelUpdateActive;		/**< Is the current update a parallel update? If so, the "EventUpdate"-handlers of the registered scene node modifiers do nothing */
+		bool								  m_bUpdatingModifiers;			/**< Are the registered scene node modifiers currently updated? */
+		PLCore::Array<SceneNodeModifier*>	  m_lstParallelUpdate;			/**< Registered scene node modifiers, can contain null pointers while "m_bUpdatingModifiers" is set */
+		PLCore::uint32						  m_nBatchSize;					/**< Number of scene node modifiers per batch of the current parallel update */
+		PLCore::Array<PLCore::uint64>		  m_lstBatchTimes;				/**< Time in microseconds per batch of the current parallel update, empty if there's no profiling */
 
 
 };
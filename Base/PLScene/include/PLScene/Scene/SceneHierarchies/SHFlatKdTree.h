@@ -0,0 +1,276 @@
+/*********************************************************\
+ *  File: SHFlatKdTree.h                                 *
+ *
+ *  Copyright (C) 2002-2013 The PixelLight Team (http://www.pixellight.org/)
+ *
+ *  This file is part of PixelLight.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ *  and associated documentation files (the "Software"), to deal in the Software without
+ *  restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ *  Software is furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all copies or
+ *  substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ *  BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ *  DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ *  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+#ifndef __PLSCENE_SCENEHIERARCHY_FLATKDTREE_H__
+#define __PLSCENE_SCENEHIERARCHY_FLATKDTREE_H__
+#pragma once
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include "PLScene/Scene/SceneHierarchy.h"
+#include "PLScene/Scene/SceneHierarchyNode.h"
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace PLScene {
+
+
+//[-------------------------------------------------------]
+//[ Forward declarations                                  ]
+//[-------------------------------------------------------]
+class SHFlatKdTreeNode;
+
+
+//[-------------------------------------------------------]
+//[ Classes                                               ]
+//[-------------------------------------------------------]
+/**
+*  @brief
+*    Flat kd tree scene hierarchy (axis aligned binary tree stored within contiguous arrays)
+*
+*  @remarks
+*    Like "SHKdTree", but the scene hierarchy nodes are not created and destroyed one by one. All nodes of one
+*    tree level are stored within one contiguous array which is created as soon as the first node of the level
+*    above has to distribute it's items, and which is kept until the hierarchy is destroyed. The child nodes of
+*    node 'i' within level 'n' are the nodes '2i' and '2i+1' within level 'n+1', so no child node pointers are
+*    required and nodes which are close within the tree are also close within the memory.
+*
+*    The kd tree cells (split planes) never change. The axis aligned bounding box of a scene hierarchy node is
+*    not the kd tree cell, but the bounding box of the scene nodes within the subtree of the hierarchy node. It
+*    grows as soon as a scene node enters the subtree and is refitted when the hierarchy node is touched. Scene
+*    nodes intersecting a split plane stay within the parent node instead of being cloned into both child nodes,
+*    so, there are no duplicates, and empty subtrees are skipped because "GetNumOfNodes()" returns only non-empty
+*    child nodes. This way, scene queries can reject a lot of the scene hierarchy at the upper tree levels.
+*
+*  @note
+*    - The maximum level (tree depth) is limited to "MaxNumOfLevels-1" because a level is always created completely
+*/
+class SHFlatKdTree : public SceneHierarchy {
+
+
+	//[-------------------------------------------------------]
+	//[ Friends                                               ]
+	//[-------------------------------------------------------]
+	friend class SHFlatKdTreeNode;
+
+
+	//[-------------------------------------------------------]
+	//[ Public definitions                                    ]
+	//[-------------------------------------------------------]
+	public:
+		static const PLCore::uint32 MaxNumOfLevels = 16;	/**< Maximum number of tree levels (the last level has 2^15 nodes) */
+
+
+	//[-------------------------------------------------------]
+	//[ RTTI interface                                        ]
+	//[-------------------------------------------------------]
+	pl_class(PLS_RTTI_EXPORT, SHFlatKdTree, "PLScene", PLScene::SceneHierarchy, "Flat kd tree scene hierarchy (axis aligned binary tree stored within contiguous arrays)")
+		// Constructors
+		pl_constructor_0(DefaultConstructor,	"Default constructor",	"")
+	pl_class_end
+
+
+	//[-------------------------------------------------------]
+	//[ Public functions                                      ]
+	//[-------------------------------------------------------]
+	public:
+		/**
+		*  @brief
+		*    Default constructor
+		*/
+		PLS_API SHFlatKdTree();
+
+		/**
+		*  @brief
+		*    Destructor
+		*/
+		PLS_API virtual ~SHFlatKdTree();
+
+		/**
+		*  @brief
+		*    Returns the number of currently created tree levels
+		*
+		*  @return
+		*    The number of currently created tree levels, at least 1 (root level)
+		*/
+		PLS_API PLCore::uint32 GetNumOfLevels() const;
+
+
+	//[-------------------------------------------------------]
+	//[ Private functions                                     ]
+	//[-------------------------------------------------------]
+	private:
+		/**
+		*  @brief
+		*    Creates the next tree level
+		*
+		*  @return
+		*    'true' if all went fine, else 'false' (maximum number of levels reached)
+		*/
+		bool CreateLevel();
+
+
+	//[-------------------------------------------------------]
+	//[ Private data                                          ]
+	//[-------------------------------------------------------]
+	private:
+		PLCore::uint32	  m_nNumOfLevels;				/**< Number of created tree levels */
+		SHFlatKdTreeNode *m_pLevels[MaxNumOfLevels];	/**< Nodes per tree level (level 'n' has 2^n nodes), the first 'm_nNumOfLevels' are valid */
+
+
+	//[-------------------------------------------------------]
+	//[ Private virtual SceneHierarchy functions              ]
+	//[-------------------------------------------------------]
+	private:
+		virtual SceneHierarchyNode &CreateNode() override;
+		virtual bool AddSceneNode(SceneNode &cSceneNode) override;
+		virtual bool RefreshSceneNode(SceneNode &cSceneNode) override;
+
+
+};
+
+/**
+*  @brief
+*    Flat kd tree scene hierarchy node class
+*/
+class SHFlatKdTreeNode : public SceneHierarchyNode {
+
+
+	//[-------------------------------------------------------]
+	//[ Friends                                               ]
+	//[-------------------------------------------------------]
+	friend class SHFlatKdTree;
+
+
+	//[-------------------------------------------------------]
+	//[ Private functions                                     ]
+	//[-------------------------------------------------------]
+	private:
+		/**
+		*  @brief
+		*    Constructor
+		*
+		*  @param[in] cHierarchy
+		*    The owner hierarchy
+		*/
+		SHFlatKdTreeNode(SceneHierarchy &cHierarchy);
+
+		/**
+		*  @brief
+		*    Destructor
+		*/
+		virtual ~SHFlatKdTreeNode();
+
+		/**
+		*  @brief
+		*    Returns the first of the two child nodes
+		*
+		*  @return
+		*    The first of the two child nodes (the second one is directly behind it), a null pointer if
+		*    the next tree level was not created, yet
+		*/
+		SHFlatKdTreeNode *GetChildNodes() const;
+
+		/**
+		*  @brief
+		*    Returns whether or not there are any scene nodes within the subtree of this node
+		*
+		*  @return
+		*    'true' if there are no scene nodes within the subtree of this node, else 'false'
+		*/
+		bool IsEmpty() const;
+
+		/**
+		*  @brief
+		*    Lets the axis aligned bounding box of this node grow so that it contains the given axis aligned bounding box
+		*
+		*  @param[in] cAABoundingBox
+		*    Axis aligned bounding box to include
+		*/
+		void Include(const PLMath::AABoundingBox &cAABoundingBox);
+
+		/**
+		*  @brief
+		*    Distributes the items of this node to the child nodes
+		*
+		*  @return
+		*    'true' if all went fine, else 'false' (maximum number of levels reached)
+		*/
+		bool Distribute();
+
+		/**
+		*  @brief
+		*    Refits the axis aligned bounding box of this node to the items of this node and the child nodes
+		*/
+		void Refit();
+
+
+	//[-------------------------------------------------------]
+	//[ Private definitions                                   ]
+	//[-------------------------------------------------------]
+	private:
+		/**
+		*  @brief
+		*    Split axis
+		*/
+		enum EAxis {
+			AxisX = 0,
+			AxisY = 1,
+			AxisZ = 2
+		};
+
+
+	//[-------------------------------------------------------]
+	//[ Private data                                          ]
+	//[-------------------------------------------------------]
+	private:
+		PLCore::uint32		  m_nIndex;			/**< Index of the node within it's tree level */
+		PLMath::AABoundingBox m_cCell;			/**< The kd tree cell of this node, never changed after the cell was set */
+		EAxis				  m_nSplitAxis;		/**< Split axis */
+		float				  m_fSplitValue;	/**< Split value */
+
+
+	//[-------------------------------------------------------]
+	//[ Public virtual SceneHierarchyNode functions           ]
+	//[-------------------------------------------------------]
+	public:
+		PLS_API virtual void Touch(bool bRecursive = false) override;
+		PLS_API virtual PLCore::uint32 GetNumOfNodes() const override;
+		PLS_API virtual SceneHierarchyNode *GetNode(PLCore::uint32 nIndex) const override;
+
+
+};
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+} // PLScene
+
+
+#endif // __PLSCENE_SCENEHIERARCHY_FLATKDTREE_H__
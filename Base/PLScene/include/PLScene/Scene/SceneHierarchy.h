@@ -232,55 +232,55 @@ class SceneHierarchy : public PLCore::Object {
 
 		/**
 		*  @brief
-		*    Adds a scene node
+		*    Removes a scene node
 		*
 		*  @param[in] cSceneNode
-		*    Scene node to add
+		*    Scene node to remove
 		*
 		*  @return
 		*    'true' if all went fine, else 'false'
-		*    (maybe the given scene node is already within a hierarchy)
 		*/
-		PLS_API bool AddSceneNode(SceneNode &cSceneNode);
+		PLS_API bool RemoveSceneNode(SceneNode &cSceneNode);
+
 
+	//[-------------------------------------------------------]
+	//[ Protected virtual SceneHierarchy functions            ]
+	//[-------------------------------------------------------]
+	protected:
 		/**
 		*  @brief
-		*    Removes a scene node
-		*
-		*  @param[in] cSceneNode
-		*    Scene node to remove
+		*    Creates a hierarchy node
 		*
 		*  @return
-		*    'true' if all went fine, else 'false'
+		*    The created scene hierarchy node
 		*/
-		PLS_API bool RemoveSceneNode(SceneNode &cSceneNode);
+		virtual SceneHierarchyNode &CreateNode() = 0;
 
 		/**
 		*  @brief
-		*    Refreshes a scene node
+		*    Adds a scene node
 		*
 		*  @param[in] cSceneNode
-		*    Scene node to refresh
+		*    Scene node to add
 		*
 		*  @return
 		*    'true' if all went fine, else 'false'
-		*    (maybe the given scene node is within no hierarchy)
+		*    (maybe the given scene node is already within a hierarchy)
 		*/
-		PLS_API bool RefreshSceneNode(SceneNode &cSceneNode);
-
+		PLS_API virtual bool AddSceneNode(SceneNode &cSceneNode);
 
-	//[-------------------------------------------------------]
-	//[ Protected virtual SceneHierarchy functions            ]
-	//[-------------------------------------------------------]
-	protected:
 		/**
 		*  @brief
-		*    Creates a hierarchy node
+		*    Refreshes a scene node
+		*
+		*  @param[in] cSceneNode
+		*    Scene node to refresh
 		*
 		*  @return
-		*    The created scene hierarchy node
+		*    'true' if all went fine, else 'false'
+		*    (maybe the given scene node is within no hierarchy)
 		*/
-		virtual SceneHierarchyNode &CreateNode() = 0;
+		PLS_API virtual bool RefreshSceneNode(SceneNode &cSceneNode);
 
 
 	//[-------------------------------------------------------]
@@ -954,6 +954,21 @@ class SceneNode : public PLCore::Object, public PLCore::Element<SceneNode> {
 		*/
 		PLS_API virtual ~SceneNode();
 
+		/**
+		*  @brief
+		*    Copy operator
+		*
+		*  @param[in] cSource
+		*    Source to copy from
+		*
+		*  @return
+		*    Reference to this instance
+		*
+		*  @note
+		*    - Only the attribute values are copied, signals are not copied
+		*/
+		PLS_API SceneNode &operator =(const SceneNode &cSource);
+
 		/**
 		*  @brief
 		*    The current axis align bounding box is dirty and must be updated if used next time
@@ -62,6 +62,7 @@ class SceneNodeModifier : public PLCore::Object {
 	//[ Friends                                               ]
 	//[-------------------------------------------------------]
 	friend class SceneNode;
+	friend class SceneContext;
 
 
 	//[-------------------------------------------------------]
@@ -267,6 +268,53 @@ class SceneNodeModifier : public PLCore::Object {
 		*/
 		PLS_API virtual void OnActivate(bool bActivate);
 
+		/**
+		*  @brief
+		*    Called before "OnUpdateParallel()" to prepare the update
+		*
+		*  @remarks
+		*    Only called for scene node modifiers registered by using "SceneContext::AddParallelUpdate()" or calling
+		*    "UpdateSerial()". Always called
+		*    by the thread calling "SceneContext::Update()", one scene node modifier after another. Everything which is not
+		*    allowed within "OnUpdateParallel()" but is required to compute the update has to be done in here, for instance
+		*    updating an animation controller which emits events or requesting data the scene is caching on demand like
+		*    transform matrices.
+		*
+		*  @note
+		*    - The default implementation is empty
+		*/
+		PLS_API virtual void OnUpdatePrepare();
+
+		/**
+		*  @brief
+		*    Called when the scene node modifier needs to be updated, may run in parallel to other scene node modifiers
+		*
+		*  @remarks
+		*    Only called for scene node modifiers registered by using "SceneContext::AddParallelUpdate()" or calling
+		*    "UpdateSerial()". If the parallel
+		*    update of the scene context is enabled, this method is called by a worker thread of "PLCore::JobSystem" while
+		*    other scene node modifiers are updated as well. So, it's only allowed to read the scene and to write data owned
+		*    by this scene node modifier. Changes of the scene, for instance a new transform of the owner scene node, have to
+		*    be stored and applied within "OnUpdateCommit()". Don't emit events and don't request data the scene is caching
+		*    on demand (for instance "SceneContainer::GetTransformMatrixTo()"), do this within "OnUpdatePrepare()" instead.
+		*
+		*  @note
+		*    - The default implementation is empty
+		*/
+		PLS_API virtual void OnUpdateParallel();
+
+		/**
+		*  @brief
+		*    Called after "OnUpdateParallel()" to apply the results to the scene
+		*
+		*  @remarks
+		*    Always called by the thread calling "SceneContext::Update()", one scene node modifier after another.
+		*
+		*  @note
+		*    - The default implementation is empty
+		*/
+		PLS_API virtual void OnUpdateCommit();
+
 
 	//[-------------------------------------------------------]
 	//[ Protected functions                                   ]
@@ -287,13 +335,27 @@ class SceneNodeModifier : public PLCore::Object {
 		*/
 		PLS_API virtual ~SceneNodeModifier();
 
+		/**
+		*  @brief
+		*    Updates this scene node modifier by calling "OnUpdatePrepare()", "OnUpdateParallel()" and "OnUpdateCommit()"
+		*
+		*  @remarks
+		*    Scene node modifiers registered by using "SceneContext::AddParallelUpdate()" also connect to "SceneContext::EventUpdate"
+		*    and call this method within their event handler, so they're updated in the usual order of the event handlers as long
+		*    as the parallel update is disabled. During a parallel update of the scene context, this method does nothing because
+		*    the scene context updates all registered scene node modifiers after "SceneContext::EventUpdate" was emitted.
+		*/
+		PLS_API void UpdateSerial();
+
 
 	//[-------------------------------------------------------]
 	//[ Private data                                          ]
 	//[-------------------------------------------------------]
 	private:
-		PLCore::uint32  m_nFlags;		/**< Flags */
-		SceneNode	   *m_pSceneNode;	/**< Owner scene node (ALWAYS valid!) */
+		PLCore::uint32  m_nFlags;					/**< Flags */
+		SceneNode	   *m_pSceneNode;				/**< Owner scene node (ALWAYS valid!) */
+		SceneContext   *m_pParallelUpdateContext;	/**< Scene context this scene node modifier is registered at for the (parallel) update, can be a null pointer */
+		PLCore::uint32  m_nParallelUpdateIndex;		/**< Index within the (parallel) update list of the scene context */
 
 
 };
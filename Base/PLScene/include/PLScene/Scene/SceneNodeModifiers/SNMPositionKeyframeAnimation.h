@@ -31,6 +31,8 @@
 //[ Includes                                              ]
 //[-------------------------------------------------------]
 #include <PLCore/Base/Event/EventHandler.h>
+#include <PLMath/Vector3.h>
+#include <PLMath/Matrix3x4.h>
 #include "PLScene/Scene/SceneNodeModifiers/SNMTransform.h"
 
 
@@ -63,6 +65,7 @@ namespace PLScene {
 *
 *  @note
 *    - The "CoordinateSystem" attribute can be quite useful if the scene contains portals
+*    - Supports the parallel scene context update (see "SceneContext::SetParallelUpdate()"), in this case the animation events are emitted by a worker thread
 */
 class SNMPositionKeyframeAnimation : public SNMTransform {
 
@@ -153,6 +156,9 @@ class SNMPositionKeyframeAnimation : public SNMTransform {
 	//[-------------------------------------------------------]
 	protected:
 		PLS_API virtual void OnActivate(bool bActivate) override;
+		PLS_API virtual void OnUpdatePrepare() override;
+		PLS_API virtual void OnUpdateParallel() override;
+		PLS_API virtual void OnUpdateCommit() override;
 
 
 	//[-------------------------------------------------------]
@@ -180,6 +186,10 @@ class SNMPositionKeyframeAnimation : public SNMTransform {
 		PLCore::String		   m_sKeys;			/**< Position keys (x, y and z) chunk filename */
 		PLCore::Chunk		  *m_pChunk;		/**< Chunk holding the keyframe data, always valid! */
 		PLRenderer::Animation *m_pAnimation;	/**< Animation */
+		bool				   m_bUseTransform;	/**< Transform the position keys by using "m_mTransform"? */
+		PLMath::Matrix3x4	   m_mTransform;	/**< Transform from the requested coordinate system into the scene container of the owner scene node, set within "OnUpdatePrepare()" */
+		bool				   m_bPosition;		/**< Is there a new position to apply within "OnUpdateCommit()"? */
+		PLMath::Vector3		   m_vPosition;		/**< New position to apply within "OnUpdateCommit()" */
 
 
 };
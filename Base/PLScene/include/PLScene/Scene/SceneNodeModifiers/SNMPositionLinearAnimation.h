@@ -50,6 +50,9 @@ namespace PLScene {
 *
 *  @remarks
 *    Animates the position of the scene nodes over time.
+*
+*  @note
+*    - Supports the parallel scene context update (see "SceneContext::SetParallelUpdate()")
 */
 class SNMPositionLinearAnimation : public SNMTransform {
 
@@ -114,6 +117,8 @@ class SNMPositionLinearAnimation : public SNMTransform {
 	//[-------------------------------------------------------]
 	protected:
 		PLS_API virtual void OnActivate(bool bActivate) override;
+		PLS_API virtual void OnUpdateParallel() override;
+		PLS_API virtual void OnUpdateCommit() override;
 
 
 	//[-------------------------------------------------------]
@@ -134,6 +139,13 @@ class SNMPositionLinearAnimation : public SNMTransform {
 		PLCore::EventHandler<> EventHandlerUpdate;
 
 
+	//[-------------------------------------------------------]
+	//[ Private data                                          ]
+	//[-------------------------------------------------------]
+	private:
+		PLMath::Vector3 m_vPositionIncrease;	/**< Position increase to apply within "OnUpdateCommit()" */
+
+
 };
 
 
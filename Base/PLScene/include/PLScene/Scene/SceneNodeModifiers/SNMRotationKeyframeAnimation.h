@@ -31,6 +31,7 @@
 //[ Includes                                              ]
 //[-------------------------------------------------------]
 #include <PLCore/Base/Event/EventHandler.h>
+#include <PLMath/Quaternion.h>
 #include "PLScene/Scene/SceneNodeModifiers/SNMTransform.h"
 
 
@@ -60,6 +61,9 @@ namespace PLScene {
 *
 *  @remarks
 *    Animates the rotation of the scene nodes over time using keyframes.
+*
+*  @note
+*    - Supports the parallel scene context update (see "SceneContext::SetParallelUpdate()"), in this case the animation events are emitted by a worker thread
 */
 class SNMRotationKeyframeAnimation : public SNMTransform {
 
@@ -149,6 +153,9 @@ class SNMRotationKeyframeAnimation : public SNMTransform {
 	//[-------------------------------------------------------]
 	protected:
 		PLS_API virtual void OnActivate(bool bActivate) override;
+		PLS_API virtual void OnUpdatePrepare() override;
+		PLS_API virtual void OnUpdateParallel() override;
+		PLS_API virtual void OnUpdateCommit() override;
 
 
 	//[-------------------------------------------------------]
@@ -176,6 +183,8 @@ class SNMRotationKeyframeAnimation : public SNMTransform {
 		PLCore::String		   m_sKeys;			/**< Rotation keys (x, y and z) chunk filename */
 		PLCore::Chunk		  *m_pChunk;		/**< Chunk holding the keyframe data, always valid! */
 		PLRenderer::Animation *m_pAnimation;	/**< Animation, always valid! */
+		bool				   m_bRotation;		/**< Is there a new rotation to apply within "OnUpdateCommit()"? */
+		PLMath::Quaternion	   m_qRotation;		/**< New rotation to apply within "OnUpdateCommit()" */
 
 
 };
@@ -32,6 +32,7 @@
 //[-------------------------------------------------------]
 #include <PLCore/Base/Event/EventHandler.h>
 #include <PLMath/Vector3.h>
+#include <PLMath/Quaternion.h>
 #include "PLScene/Scene/SceneNodeModifiers/SNMTransform.h"
 
 
@@ -50,6 +51,9 @@ namespace PLScene {
 *
 *  @remarks
 *    Animates the rotation of the scene nodes over time.
+*
+*  @note
+*    - Supports the parallel scene context update (see "SceneContext::SetParallelUpdate()")
 */
 class SNMRotationLinearAnimation : public SNMTransform {
 
@@ -90,6 +94,8 @@ class SNMRotationLinearAnimation : public SNMTransform {
 	//[-------------------------------------------------------]
 	protected:
 		PLS_API virtual void OnActivate(bool bActivate) override;
+		PLS_API virtual void OnUpdateParallel() override;
+		PLS_API virtual void OnUpdateCommit() override;
 
 
 	//[-------------------------------------------------------]
@@ -110,6 +116,14 @@ class SNMRotationLinearAnimation : public SNMTransform {
 		PLCore::EventHandler<> EventHandlerUpdate;
 
 
+	//[-------------------------------------------------------]
+	//[ Private data                                          ]
+	//[-------------------------------------------------------]
+	private:
+		bool			   m_bRotationIncrease;	/**< Is there a rotation increase to apply within "OnUpdateCommit()"? */
+		PLMath::Quaternion m_qRotationIncrease;	/**< Rotation increase to apply within "OnUpdateCommit()" */
+
+
 };
 
 
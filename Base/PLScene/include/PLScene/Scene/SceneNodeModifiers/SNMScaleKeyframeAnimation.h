@@ -31,6 +31,7 @@
 //[ Includes                                              ]
 //[-------------------------------------------------------]
 #include <PLCore/Base/Event/EventHandler.h>
+#include <PLMath/Vector3.h>
 #include "PLScene/Scene/SceneNodeModifiers/SNMTransform.h"
 
 
@@ -60,6 +61,9 @@ namespace PLScene {
 *
 *  @remarks
 *    Animates the scale of the scene nodes over time using keyframes.
+*
+*  @note
+*    - Supports the parallel scene context update (see "SceneContext::SetParallelUpdate()"), in this case the animation events are emitted by a worker thread
 */
 class SNMScaleKeyframeAnimation : public SNMTransform {
 
@@ -149,6 +153,9 @@ class SNMScaleKeyframeAnimation : public SNMTransform {
 	//[-------------------------------------------------------]
 	protected:
 		PLS_API virtual void OnActivate(bool bActivate) override;
+		PLS_API virtual void OnUpdatePrepare() override;
+		PLS_API virtual void OnUpdateParallel() override;
+		PLS_API virtual void OnUpdateCommit() override;
 
 
 	//[-------------------------------------------------------]
@@ -176,6 +183,8 @@ class SNMScaleKeyframeAnimation : public SNMTransform {
 		PLCore::String		   m_sKeys;			/**< Scale keys (x, y and z) chunk filename */
 		PLCore::Chunk		  *m_pChunk;		/**< Chunk holding the keyframe data, always valid! */
 		PLRenderer::Animation *m_pAnimation;	/**< Animation, always valid! */
+		bool				   m_bScale;			/**< Is there a new scale to apply within "OnUpdateCommit()"? */
+		PLMath::Vector3		   m_vScale;			/**< New scale to apply within "OnUpdateCommit()" */
 
 
 };
@@ -183,6 +183,21 @@ class SceneQuery : public PLCore::Object, public PLCore::Element<SceneQuery> {
 		*/
 		PLS_API virtual ~SceneQuery();
 
+		/**
+		*  @brief
+		*    Copy operator
+		*
+		*  @param[in] cSource
+		*    Source to copy from
+		*
+		*  @return
+		*    Reference to this instance
+		*
+		*  @note
+		*    - Only the attribute values are copied, signals are not copied
+		*/
+		PLS_API SceneQuery &operator =(const SceneQuery &cSource);
+
 
 	//[-------------------------------------------------------]
 	//[ Protected data                                        ]
@@ -98,10 +98,12 @@ class SQCull : public SceneQuery {
 		*    Cull mode
 		*/
 		enum EMode {
-			Frustum     = 0,	/**< Culls the scene with view frustum culling only */
-			StopAndWait = 1,	/**< Culls the scene with the hierarchical stop and wait algorithm */
-			Coherent    = 2,	/**< Culls the scene with the coherent hierarchical algorithm (CHC) */
-			Previous    = 3		/**< Culls the scene using the visibility information of the previous frame */
+			Frustum         = 0,	/**< Culls the scene with view frustum culling only */
+			StopAndWait     = 1,	/**< Culls the scene with the hierarchical stop and wait algorithm */
+			Coherent        = 2,	/**< Culls the scene with the coherent hierarchical algorithm (CHC) */
+			Previous        = 3,	/**< Culls the scene using the visibility information of the previous frame */
+			ParallelFrustum = 4		/**< Culls the scene with view frustum culling only, scene node bounding boxes are tested in batches using
+										 SIMD and the worker threads of the job system (same result as "Frustum", interesting for large scenes) */
 		};
 
 
@@ -135,6 +137,12 @@ class SQCull : public SceneQuery {
 			PLCore::uint32 nNumOfQueries;						/**< Total number of occlusion queries */
 			PLCore::uint32 nMaxNumOfQueries;					/**< Maximum number of occlusion queries active at the same time */
 			bool		   bWaitForQueryResult;					/**< Was waiting for a query result required? */
+			// ParallelFrustum only
+			PLCore::uint64 nTraversalTime;						/**< Time of the hierarchy traversal including gathering the scene node bounding boxes (in microseconds) */
+			PLCore::uint64 nTestTime;							/**< Time of the batched scene node bounding box tests (in microseconds) */
+			PLCore::uint64 nMergeTime;							/**< Time of merging the test results into the visibility container (in microseconds) */
+			PLCore::uint32 nNumOfTestedBoxes;					/**< Number of scene node bounding boxes tested in batches */
+			PLCore::uint32 nNumOfWorkers;						/**< Number of job system worker threads which helped with the tests (0 = calling thread only) */
 		};
 
 
@@ -329,6 +337,23 @@ class SQCull : public SceneQuery {
 		*/
 		bool CullFrustum();
 
+		/**
+		*  @brief
+		*    Frustum culling only, the scene node bounding box tests are performed in batches
+		*
+		*  @return
+		*    'false' if the query was cancelled by the user, else 'true'
+		*
+		*  @remarks
+		*    The scene hierarchy is split lazily when it's touched and the container space bounding boxes of the
+		*    scene nodes are calculated lazily as well, so the hierarchy traversal and the gathering of the bounding
+		*    boxes is done on the calling thread. The gathered bounding boxes are then tested against all view frustum
+		*    planes at once using SIMD, split into ranges processed by the worker threads of the job system. Finally,
+		*    the test results are merged into the visibility container by using "TraverseNode()" in the same
+		*    front-to-back order "CullFrustum()" is using, so both produce the same visibility tree.
+		*/
+		bool CullFrustumParallel();
+
 		/**
 		*  @brief
 		*    This is the naive algorithm always waiting for the query to finish
@@ -359,11 +384,15 @@ class SQCull : public SceneQuery {
 		*
 		*  @param[in] cHierarchyNode
 		*    Hierarchy node to traverse
+		*  @param[in] pnItemVisibility
+		*    Precalculated view frustum test result per item of the hierarchy node (0 = culled), can be a null pointer
+		*  @param[in] bAddChildNodes
+		*    Add the child nodes of the hierarchy node to the distance queue?
 		*
 		*  @return
 		*    'false' if the query was cancelled by the user, else 'true'
 		*/
-		bool TraverseNode(const SceneHierarchyNode &cHierarchyNode);
+		bool TraverseNode(const SceneHierarchyNode &cHierarchyNode, const PLCore::uint8 *pnItemVisibility = nullptr, bool bAddChildNodes = true);
 
 		/**
 		*  @brief
@@ -429,6 +458,27 @@ class SQCull : public SceneQuery {
 		bool InsideViewFrustum(const SceneHierarchyNode &cHierarchyNode, bool &bIntersects, bool bCheckNear = true);
 
 
+	//[-------------------------------------------------------]
+	//[ Private static functions                              ]
+	//[-------------------------------------------------------]
+	private:
+		/**
+		*  @brief
+		*    Tests a range of the gathered bounding boxes against the view frustum
+		*
+		*  @param[in] nFirst
+		*    Index of the first bounding box to test
+		*  @param[in] nEnd
+		*    Index behind the last bounding box to test
+		*  @param[in] pData
+		*    The cull query (SQCull), always valid
+		*
+		*  @note
+		*    - Job system parallel for function, the ranges are processed concurrently
+		*/
+		static void TestBoxes(PLCore::uint32 nFirst, PLCore::uint32 nEnd, void *pData);
+
+
 	//[-------------------------------------------------------]
 	//[ Private data                                          ]
 	//[-------------------------------------------------------]
@@ -460,6 +510,15 @@ class SQCull : public SceneQuery {
 		PLCore::BinaryHeap<float, SceneHierarchyNode*> 	 m_lstDistanceQueue;		/**< Distance queue */
 		PLCore::BinaryHeap<float, SceneNode*>			 m_lstNodeDistanceQueue;	/**< Distance queue for the scene nodes*/
 
+		// Batched frustum test data (ParallelFrustum)
+		PLCore::Array<float>					 m_lstPlanes;		/**< View frustum planes in groups of four, each group is stored as normal x, y, z, distance and absolute normal x, y, z (4 floats each) */
+		PLCore::Array<const SceneHierarchyNode*> m_lstVisibleNodes;	/**< Visible hierarchy nodes in front-to-back order */
+		PLCore::Array<PLCore::uint32>			 m_lstFirstBox;		/**< Per visible hierarchy node: Index of the bounding box of the first item, or -1 if no tests are required */
+		PLCore::Array<PLCore::uint32>			 m_lstNumOfBoxes;	/**< Per visible hierarchy node: Number of items at the time the bounding boxes were gathered */
+		PLCore::uint32							 m_nMaxNumOfBoxes;	/**< Maximum number of bounding boxes the buffers below can hold */
+		float									*m_pfBoxes;			/**< Bounding box center and half extent (6 floats per box), can be a null pointer */
+		PLCore::uint8							*m_pnBoxVisibility;	/**< View frustum test result per bounding box (0 = culled), can be a null pointer */
+
 		VisContainer *m_pVisRootContainer;	/**< Visibility root container */
 		VisContainer *m_pVisContainer;		/**< Visibility container (do NOT use this variable directly, use GetVisContainer()!) */
 
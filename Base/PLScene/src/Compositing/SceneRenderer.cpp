@@ -89,6 +89,23 @@ SceneRendererPass *SceneRenderer::Create(const String &sClass, const String &sNa
 	return nullptr;
 }
 
+/**
+*  @brief
+*    Copy operator
+*/
+SceneRenderer &SceneRenderer::operator =(const SceneRenderer &cSource)
+{
+	// Recreate the scene renderer passes
+	Clear();
+	for (uint32 i=0; i<cSource.GetNumOfElements(); i++) {
+		const SceneRendererPass *pPass = cSource.GetByIndex(i);
+		Create(pPass->GetClass()->GetClassName(), pPass->GetName(), pPass->GetValues());
+	}
+
+	// Return a reference to this instance
+	return *this;
+}
+
 
 //[-------------------------------------------------------]
 //[ Protected functions                                   ]
@@ -27,13 +27,16 @@
 //[-------------------------------------------------------]
 #include <PLCore/Base/Class.h>
 #include <PLCore/Tools/Timing.h>
+#include <PLCore/Tools/Profiler.h>
 #include <PLCore/Tools/Stopwatch.h>
 #include <PLCore/Tools/Profiling.h>
+#include <PLCore/System/JobSystem.h>
 #include <PLMath/Graph/GraphPathManager.h>
 #include <PLRenderer/RendererContext.h>
 #include <PLMesh/MeshManager.h>
 #include "PLScene/Scene/SceneContainer.h"
 #include "PLScene/Scene/SceneNodeHandler.h"
+#include "PLScene/Scene/SceneNodeModifier.h"
 #include "PLScene/Visibility/VisManager.h"
 #include "PLScene/Compositing/SceneRendererManager.h"
 #include "PLScene/Scene/SceneContext.h"
@@ -64,7 +67,11 @@ SceneContext::SceneContext(RendererContext &cRendererContext) :
 	m_pSceneRendererManager(nullptr),
 	m_pVisManager(nullptr),
 	m_bProcessActive(false),
-	m_nProcessCounter(0)
+	m_nProcessCounter(0),
+	m_bParallelUpdate(false),
+	m_bParallelUpdateActive(false),
+	m_bUpdatingModifiers(false),
+	m_nBatchSize(0)
 {
 }
 
@@ -190,6 +197,12 @@ void SceneContext::Update(bool bRespectPause)
 {
 	// Do only emit the update event when timing currently not paused
 	if (!Timing::GetInstance()->IsPaused()) {
+		PL_PROFILE_ZONE("Scene context update");
+
+		// Update the registered scene node modifiers in parallel? If not, they're updated by their "EventUpdate"-handlers.
+		JobSystem *pJobSystem = (m_bParallelUpdate && m_lstParallelUpdate.GetNumOfElements()) ? JobSystem::GetInstance() : nullptr;
+		m_bParallelUpdateActive = (pJobSystem && pJobSystem->GetNumOfWorkers());
+
 		// Perform profiling?
 		Profiling *pProfiling = Profiling::GetInstance();
 		if (pProfiling->IsActive()) {
@@ -199,13 +212,25 @@ void SceneContext::Update(bool bRespectPause)
 			// Emit event
 			EventUpdate();
 
+			// Update the registered scene node modifiers in parallel
+			if (m_bParallelUpdateActive)
+				UpdateModifiers(*pJobSystem, true);
+
 			// Update the profiling data
 			pProfiling->Set("Scene context", "Update time",		 String::Format("%.3f ms", cStopwatch.GetMilliseconds()));
 			pProfiling->Set("Scene context", "Updated elements", String::Format("%d", EventUpdate.GetNumOfConnects()));
 		} else {
 			// Emit event
 			EventUpdate();
+
+			// Update the registered scene node modifiers in parallel
+			if (m_bParallelUpdateActive)
+				UpdateModifiers(*pJobSystem, false);
 		}
+		m_bParallelUpdateActive = false;
+
+		// Update the profiler data
+		PL_PROFILE_COUNTER("Scene context updated elements", EventUpdate.GetNumOfConnects());
 	}
 }
 
@@ -231,6 +256,65 @@ VisManager &SceneContext::GetVisManager()
 	return *m_pVisManager;
 }
 
+/**
+*  @brief
+*    Returns whether or not the registered scene node modifiers are updated in parallel
+*/
+bool SceneContext::GetParallelUpdate() const
+{
+	return m_bParallelUpdate;
+}
+
+/**
+*  @brief
+*    Sets whether or not the registered scene node modifiers are updated in parallel
+*/
+void SceneContext::SetParallelUpdate(bool bParallelUpdate)
+{
+	m_bParallelUpdate = bParallelUpdate;
+}
+
+/**
+*  @brief
+*    Registers a scene node modifier for the (parallel) update
+*/
+void SceneContext::AddParallelUpdate(SceneNodeModifier &cSceneNodeModifier)
+{
+	// Not registered, yet?
+	if (!cSceneNodeModifier.m_pParallelUpdateContext) {
+		cSceneNodeModifier.m_pParallelUpdateContext = this;
+		cSceneNodeModifier.m_nParallelUpdateIndex   = m_lstParallelUpdate.GetNumOfElements();
+		m_lstParallelUpdate.Add(&cSceneNodeModifier);
+	}
+}
+
+/**
+*  @brief
+*    Unregisters a scene node modifier from the (parallel) update
+*/
+void SceneContext::RemoveParallelUpdate(SceneNodeModifier &cSceneNodeModifier)
+{
+	// Registered at this scene context?
+	if (cSceneNodeModifier.m_pParallelUpdateContext == this) {
+		const uint32 nIndex = cSceneNodeModifier.m_nParallelUpdateIndex;
+		cSceneNodeModifier.m_pParallelUpdateContext = nullptr;
+
+		// Currently updating? If so, just invalidate the entry so we don't mess up the list while it's used.
+		if (m_bUpdatingModifiers) {
+			m_lstParallelUpdate[nIndex] = nullptr;
+		} else {
+			// Move the last scene node modifier into the free slot, the update order is not defined
+			const uint32 nLastIndex = m_lstParallelUpdate.GetNumOfElements() - 1;
+			if (nIndex != nLastIndex) {
+				SceneNodeModifier *pLastSceneNodeModifier = m_lstParallelUpdate[nLastIndex];
+				m_lstParallelUpdate[nIndex] = pLastSceneNodeModifier;
+				pLastSceneNodeModifier->m_nParallelUpdateIndex = nIndex;
+			}
+			m_lstParallelUpdate.RemoveAtIndex(nLastIndex);
+		}
+	}
+}
+
 /**
 *  @brief
 *    Starts a scene process
@@ -296,6 +380,117 @@ bool SceneContext::EndProcess()
 }
 
 
+//[-------------------------------------------------------]
+//[ Private functions                                     ]
+//[-------------------------------------------------------]
+/**
+*  @brief
+*    Updates the registered scene node modifiers in parallel
+*/
+void SceneContext::UpdateModifiers(JobSystem &cJobSystem, bool bProfiling)
+{
+	const uint32 nNumOfModifiers = m_lstParallelUpdate.GetNumOfElements();
+	if (nNumOfModifiers) {
+		m_bUpdatingModifiers = true;
+
+		// Split the scene node modifiers into batches, a few batches per thread for load balancing
+		const uint32 nNumOfBatches = (cJobSystem.GetNumOfWorkers() + 1)*4;
+		m_nBatchSize = (nNumOfModifiers + nNumOfBatches - 1)/nNumOfBatches;
+		if (m_nBatchSize < 16)
+			m_nBatchSize = 16;	// Scene node modifier updates are usually cheap, don't make the batches too small
+		if (bProfiling)
+			m_lstBatchTimes.Resize((nNumOfModifiers + m_nBatchSize - 1)/m_nBatchSize);
+		PL_PROFILE_COUNTER("Scene context modifiers per batch", m_nBatchSize);
+
+		// Preparation part, the scene node modifiers update everything emitting events or touching shared data one after another
+		Stopwatch cStopwatch(bProfiling);
+		{
+			PL_PROFILE_ZONE("Scene context parallel update prepare");
+			for (uint32 i=0; i<nNumOfModifiers; i++) {
+				SceneNodeModifier *pSceneNodeModifier = m_lstParallelUpdate[i];
+				if (pSceneNodeModifier)
+					pSceneNodeModifier->OnUpdatePrepare();
+			}
+		}
+		const float fPrepareTime = cStopwatch.GetMilliseconds();
+
+		// Parallel part, each batch records its time
+		cStopwatch.Start();
+		{
+			PL_PROFILE_ZONE("Scene context parallel update");
+			cJobSystem.ParallelFor(nNumOfModifiers, m_nBatchSize, &SceneContext::UpdateModifiersBatch, this);
+		}
+		const float fParallelTime = cStopwatch.GetMilliseconds();
+
+		// Commit part, the scene node modifiers apply their results to the scene one after another
+		cStopwatch.Start();
+		{
+			PL_PROFILE_ZONE("Scene context parallel update commit");
+			for (uint32 i=0; i<nNumOfModifiers; i++) {
+				SceneNodeModifier *pSceneNodeModifier = m_lstParallelUpdate[i];
+				if (pSceneNodeModifier)
+					pSceneNodeModifier->OnUpdateCommit();
+			}
+		}
+
+		// Update the profiling data
+		if (bProfiling) {
+			uint64 nTotalBatchTime = 0;
+			uint64 nMaxBatchTime   = 0;
+			for (uint32 i=0; i<m_lstBatchTimes.GetNumOfElements(); i++) {
+				const uint64 nBatchTime = m_lstBatchTimes[i];
+				nTotalBatchTime += nBatchTime;
+				if (nMaxBatchTime < nBatchTime)
+					nMaxBatchTime = nBatchTime;
+			}
+			Profiling *pProfiling = Profiling::GetInstance();
+			pProfiling->Set("Scene context", "Parallel update prepare time",	String::Format("%.3f ms", fPrepareTime));
+			pProfiling->Set("Scene context", "Parallel update time",			String::Format("%.3f ms", fParallelTime));
+			pProfiling->Set("Scene context", "Parallel update commit time",		String::Format("%.3f ms", cStopwatch.GetMilliseconds()));
+			pProfiling->Set("Scene context", "Parallel update batches",			String::Format("%d (%d modifiers each)", m_lstBatchTimes.GetNumOfElements(), m_nBatchSize));
+			pProfiling->Set("Scene context", "Parallel update batch time",		String::Format("%.3f ms average, %.3f ms maximum", nTotalBatchTime/1000.0f/m_lstBatchTimes.GetNumOfElements(), nMaxBatchTime/1000.0f));
+			m_lstBatchTimes.Reset();
+		}
+
+		// Remove the scene node modifiers which were unregistered during the update
+		uint32 nNumOfValidModifiers = 0;
+		for (uint32 i=0; i<m_lstParallelUpdate.GetNumOfElements(); i++) {
+			SceneNodeModifier *pSceneNodeModifier = m_lstParallelUpdate[i];
+			if (pSceneNodeModifier) {
+				m_lstParallelUpdate[nNumOfValidModifiers] = pSceneNodeModifier;
+				pSceneNodeModifier->m_nParallelUpdateIndex = nNumOfValidModifiers;
+				nNumOfValidModifiers++;
+			}
+		}
+		while (m_lstParallelUpdate.GetNumOfElements() > nNumOfValidModifiers)
+			m_lstParallelUpdate.RemoveAtIndex(m_lstParallelUpdate.GetNumOfElements() - 1);
+		m_bUpdatingModifiers = false;
+	}
+}
+
+/**
+*  @brief
+*    Job system parallel for function updating a batch of registered scene node modifiers
+*/
+void SceneContext::UpdateModifiersBatch(uint32 nBegin, uint32 nEnd, void *pData)
+{
+	PL_PROFILE_ZONE("Scene context parallel update batch");
+	SceneContext *pSceneContext = static_cast<SceneContext*>(pData);
+	Stopwatch cStopwatch(pSceneContext->m_lstBatchTimes.GetNumOfElements() != 0);
+
+	// Update the scene node modifiers of this batch
+	for (uint32 i=nBegin; i<nEnd; i++) {
+		SceneNodeModifier *pSceneNodeModifier = pSceneContext->m_lstParallelUpdate[i];
+		if (pSceneNodeModifier)
+			pSceneNodeModifier->OnUpdateParallel();
+	}
+
+	// Each batch writes its own entry, so there's no need for synchronization
+	if (pSceneContext->m_lstBatchTimes.GetNumOfElements())
+		pSceneContext->m_lstBatchTimes[nBegin/pSceneContext->m_nBatchSize] = cStopwatch.GetMicroseconds();
+}
+
+
 //[-------------------------------------------------------]
 //[ Namespace                                             ]
 //[-------------------------------------------------------]
@@ -0,0 +1,378 @@
+/*********************************************************\
+ *  File: SHFlatKdTree.cpp                               *
+ *
+ *  Copyright (C) 2002-2013 The PixelLight Team (http://www.pixellight.org/)
+ *
+ *  This file is part of PixelLight.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ *  and associated documentation files (the "Software"), to deal in the Software without
+ *  restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ *  Software is furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all copies or
+ *  substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ *  BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ *  DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ *  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include <new>
+#include "PLScene/Scene/SceneNode.h"
+#include "PLScene/Scene/SceneHierarchyNodeItem.h"
+#include "PLScene/Scene/SceneHierarchies/SHFlatKdTree.h"
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+using namespace PLCore;
+using namespace PLMath;
+namespace PLScene {
+
+
+//[-------------------------------------------------------]
+//[ RTTI interface                                        ]
+//[-------------------------------------------------------]
+pl_implement_class(SHFlatKdTree)
+
+
+//[-------------------------------------------------------]
+//[ Local definitions                                     ]
+//[-------------------------------------------------------]
+// Empty axis aligned bounding box, minimum > maximum so that all intersection tests fail (finite values so
+// that plane tests don't produce NaN)
+static const AABoundingBox EmptyAABoundingBox(1e30f, 1e30f, 1e30f, -1e30f, -1e30f, -1e30f);
+
+
+
+
+//[-------------------------------------------------------]
+//[ SHFlatKdTree implementation                           ]
+//[-------------------------------------------------------]
+//[-------------------------------------------------------]
+//[ Public functions                                      ]
+//[-------------------------------------------------------]
+/**
+*  @brief
+*    Default constructor
+*/
+SHFlatKdTree::SHFlatKdTree() :
+	m_nNumOfLevels(0)
+{
+	// Create the root level
+	CreateLevel();
+	m_pRootNode = m_pLevels[0];
+}
+
+/**
+*  @brief
+*    Destructor
+*/
+SHFlatKdTree::~SHFlatKdTree()
+{
+	// Destroy the tree levels
+	for (uint32 nLevel=0; nLevel<m_nNumOfLevels; nLevel++) {
+		SHFlatKdTreeNode *pNodes = m_pLevels[nLevel];
+		const uint32 nNumOfNodes = 1 << nLevel;
+		for (uint32 i=0; i<nNumOfNodes; i++)
+			pNodes[i].~SHFlatKdTreeNode();
+		delete [] reinterpret_cast<uint8*>(pNodes);
+	}
+
+	// The root node was destroyed, the base class must not destroy it again
+	m_pRootNode = nullptr;
+}
+
+/**
+*  @brief
+*    Returns the number of currently created tree levels
+*/
+uint32 SHFlatKdTree::GetNumOfLevels() const
+{
+	return m_nNumOfLevels;
+}
+
+
+//[-------------------------------------------------------]
+//[ Private functions                                     ]
+//[-------------------------------------------------------]
+/**
+*  @brief
+*    Creates the next tree level
+*/
+bool SHFlatKdTree::CreateLevel()
+{
+	// Maximum number of levels reached?
+	const uint32 nLevel = m_nNumOfLevels;
+	if (nLevel >= MaxNumOfLevels || (nLevel && nLevel > GetMaxLevel()))
+		return false; // Error!
+
+	// The cell of the root node is fixed as soon as the root node distributes it's items for the first time
+	if (nLevel == 1) {
+		SHFlatKdTreeNode &cRootNode = m_pLevels[0][0];
+		cRootNode.m_cCell       = cRootNode.m_cAABoundingBox;
+		cRootNode.m_nSplitAxis  = static_cast<SHFlatKdTreeNode::EAxis>(cRootNode.m_cCell.GetLongestAxis());
+		cRootNode.m_fSplitValue = (cRootNode.m_cCell.vMin[cRootNode.m_nSplitAxis] + cRootNode.m_cCell.vMax[cRootNode.m_nSplitAxis])*0.5f;
+	}
+
+	// Create all nodes of the level within one contiguous memory block
+	const uint32 nNumOfNodes = 1 << nLevel;
+	SHFlatKdTreeNode *pNodes = reinterpret_cast<SHFlatKdTreeNode*>(new uint8[sizeof(SHFlatKdTreeNode)*nNumOfNodes]);
+	for (uint32 i=0; i<nNumOfNodes; i++) {
+		SHFlatKdTreeNode &cNode = *new (&pNodes[i]) SHFlatKdTreeNode(*this);
+		cNode.m_nLevel = static_cast<uint8>(nLevel);
+		cNode.m_nIndex = i;
+
+		// Setup the cell, the root cell is set as soon as the root node distributes it's items for the first time
+		if (nLevel) {
+			SHFlatKdTreeNode &cParentNode = m_pLevels[nLevel-1][i >> 1];
+			cNode.m_pParentNode = &cParentNode;
+			cNode.m_cCell       = cParentNode.m_cCell;
+			if (i & 1)
+				cNode.m_cCell.vMin[cParentNode.m_nSplitAxis] = cParentNode.m_fSplitValue;
+			else
+				cNode.m_cCell.vMax[cParentNode.m_nSplitAxis] = cParentNode.m_fSplitValue;
+
+			// Split the cell in the middle of it's longest axis
+			cNode.m_nSplitAxis  = static_cast<SHFlatKdTreeNode::EAxis>(cNode.m_cCell.GetLongestAxis());
+			cNode.m_fSplitValue = (cNode.m_cCell.vMin[cNode.m_nSplitAxis] + cNode.m_cCell.vMax[cNode.m_nSplitAxis])*0.5f;
+		}
+	}
+	m_pLevels[nLevel] = pNodes;
+	m_nNumOfLevels++;
+
+	// Done
+	return true;
+}
+
+
+//[-------------------------------------------------------]
+//[ Private virtual SceneHierarchy functions              ]
+//[-------------------------------------------------------]
+SceneHierarchyNode &SHFlatKdTree::CreateNode()
+{
+	// The nodes of this hierarchy are created level by level, so this function is only used if someone asks for a free node
+	return *(new SHFlatKdTreeNode(*this));
+}
+
+bool SHFlatKdTree::AddSceneNode(SceneNode &cSceneNode)
+{
+	// Call base implementation, the scene node is attached to the root node
+	if (!SceneHierarchy::AddSceneNode(cSceneNode))
+		return false; // Error!
+
+	// Let the root node grow, the scene node is distributed as soon as the root node is touched
+	static_cast<SHFlatKdTreeNode*>(m_pRootNode)->Include(cSceneNode.GetContainerAABoundingBox());
+
+	// Done
+	return true;
+}
+
+bool SHFlatKdTree::RefreshSceneNode(SceneNode &cSceneNode)
+{
+	// Call base implementation, if the scene node left the axis aligned bounding box of it's hierarchy node, it's
+	// attached to the root node
+	if (!SceneHierarchy::RefreshSceneNode(cSceneNode))
+		return false; // Error!
+
+	// Let the root node grow, the scene node is distributed as soon as the root node is touched
+	static_cast<SHFlatKdTreeNode*>(m_pRootNode)->Include(cSceneNode.GetContainerAABoundingBox());
+
+	// Done
+	return true;
+}
+
+
+
+
+//[-------------------------------------------------------]
+//[ SHFlatKdTreeNode implementation                       ]
+//[-------------------------------------------------------]
+//[-------------------------------------------------------]
+//[ Private functions                                     ]
+//[-------------------------------------------------------]
+/**
+*  @brief
+*    Constructor
+*/
+SHFlatKdTreeNode::SHFlatKdTreeNode(SceneHierarchy &cHierarchy) : SceneHierarchyNode(cHierarchy),
+	m_nIndex(0),
+	m_cCell(EmptyAABoundingBox),
+	m_nSplitAxis(AxisX),
+	m_fSplitValue(0.0f)
+{
+	// The subtree of this node is empty
+	m_cAABoundingBox = EmptyAABoundingBox;
+}
+
+/**
+*  @brief
+*    Destructor
+*/
+SHFlatKdTreeNode::~SHFlatKdTreeNode()
+{
+}
+
+/**
+*  @brief
+*    Returns the first of the two child nodes
+*/
+SHFlatKdTreeNode *SHFlatKdTreeNode::GetChildNodes() const
+{
+	const SHFlatKdTree *pHierarchy = static_cast<const SHFlatKdTree*>(m_pHierarchy);
+	return (static_cast<uint32>(m_nLevel+1) < pHierarchy->m_nNumOfLevels) ? &pHierarchy->m_pLevels[m_nLevel+1][m_nIndex << 1] : nullptr;
+}
+
+/**
+*  @brief
+*    Returns whether or not there are any scene nodes within the subtree of this node
+*/
+bool SHFlatKdTreeNode::IsEmpty() const
+{
+	return (m_cAABoundingBox.vMin.x > m_cAABoundingBox.vMax.x);
+}
+
+/**
+*  @brief
+*    Lets the axis aligned bounding box of this node grow so that it contains the given axis aligned bounding box
+*/
+void SHFlatKdTreeNode::Include(const AABoundingBox &cAABoundingBox)
+{
+	if (IsEmpty())
+		m_cAABoundingBox = cAABoundingBox;
+	else
+		m_cAABoundingBox.CombineAABoxes(cAABoundingBox);
+}
+
+/**
+*  @brief
+*    Distributes the items of this node to the child nodes
+*/
+bool SHFlatKdTreeNode::Distribute()
+{
+	// Get the child nodes, create the next tree level if required
+	SHFlatKdTreeNode *pChildNodes = GetChildNodes();
+	if (!pChildNodes) {
+		if (!static_cast<SHFlatKdTree*>(m_pHierarchy)->CreateLevel())
+			return false; // Error!
+		pChildNodes = GetChildNodes();
+	}
+
+	// Move all items which are completely on one side of the split plane into the according child node, all
+	// other items stay within this node
+	SceneHierarchyNodeItem *pItem = m_pFirstItem;
+	while (pItem) {
+		SceneHierarchyNodeItem *pNextItem = pItem->GetNextItem();
+		if (pItem->GetSceneNode()) {
+			const AABoundingBox &cAABox = pItem->GetSceneNode()->GetContainerAABoundingBox();
+			SHFlatKdTreeNode *pChildNode = nullptr;
+			if (cAABox.vMax[m_nSplitAxis] <= m_fSplitValue)
+				pChildNode = &pChildNodes[0];
+			else if (cAABox.vMin[m_nSplitAxis] >= m_fSplitValue)
+				pChildNode = &pChildNodes[1];
+			if (pChildNode) {
+				pItem->Detach();
+				pItem->Attach(*pChildNode);
+				pChildNode->Include(cAABox);
+			}
+		} else {
+			// Hm, this item is NOT required...
+			delete pItem;
+		}
+
+		// Next item, please
+		pItem = pNextItem;
+	}
+
+	// Done
+	return true;
+}
+
+/**
+*  @brief
+*    Refits the axis aligned bounding box of this node to the items of this node and the child nodes
+*/
+void SHFlatKdTreeNode::Refit()
+{
+	m_cAABoundingBox = EmptyAABoundingBox;
+
+	// Items of this node
+	for (const SceneHierarchyNodeItem *pItem=m_pFirstItem; pItem; pItem=pItem->GetNextItem()) {
+		if (pItem->GetSceneNode())
+			Include(pItem->GetSceneNode()->GetContainerAABoundingBox());
+	}
+
+	// Child nodes
+	const SHFlatKdTreeNode *pChildNodes = GetChildNodes();
+	if (pChildNodes) {
+		if (!pChildNodes[0].IsEmpty())
+			Include(pChildNodes[0].m_cAABoundingBox);
+		if (!pChildNodes[1].IsEmpty())
+			Include(pChildNodes[1].m_cAABoundingBox);
+	}
+}
+
+
+//[-------------------------------------------------------]
+//[ Public virtual SceneHierarchyNode functions           ]
+//[-------------------------------------------------------]
+void SHFlatKdTreeNode::Touch(bool bRecursive)
+{
+	// Distribute the items of the scene hierarchy node to the child nodes if required
+	if (m_nNumOfItems > m_pHierarchy->GetMaxNumOfNodeItems())
+		Distribute();
+
+	// Touch recursive?
+	if (bRecursive) {
+		SHFlatKdTreeNode *pChildNodes = GetChildNodes();
+		if (pChildNodes) {
+			if (!pChildNodes[0].IsEmpty())
+				pChildNodes[0].Touch(bRecursive);
+			if (!pChildNodes[1].IsEmpty())
+				pChildNodes[1].Touch(bRecursive);
+		}
+	}
+
+	// Refit the axis aligned bounding box, there's no need to merge child nodes
+	Refit();
+}
+
+uint32 SHFlatKdTreeNode::GetNumOfNodes() const
+{
+	const SHFlatKdTreeNode *pChildNodes = GetChildNodes();
+	return pChildNodes ? (!pChildNodes[0].IsEmpty() + !pChildNodes[1].IsEmpty()) : 0;
+}
+
+SceneHierarchyNode *SHFlatKdTreeNode::GetNode(uint32 nIndex) const
+{
+	// Get the child nodes
+	SHFlatKdTreeNode *pChildNodes = GetChildNodes();
+	if (pChildNodes) {
+		// Empty child nodes are skipped
+		if (!pChildNodes[0].IsEmpty()) {
+			if (!nIndex)
+				return &pChildNodes[0];
+			nIndex--;
+		}
+		if (!nIndex && !pChildNodes[1].IsEmpty())
+			return &pChildNodes[1];
+	}
+
+	// Error!
+	return nullptr;
+}
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+} // PLScene
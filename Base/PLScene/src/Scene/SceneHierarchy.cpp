@@ -198,26 +198,6 @@ SceneHierarchy::~SceneHierarchy()
 	}
 }
 
-/**
-*  @brief
-*    Adds a scene node
-*/
-bool SceneHierarchy::AddSceneNode(SceneNode &cSceneNode)
-{
-	// Check parameter and is the given scene node already within a hierarchy?
-	if (cSceneNode.m_pFirstSceneHierarchyNodeItem) {
-		// Error!
-		return false;
-	} else {
-		// Add the scene node to this hierarchy
-		m_nNumOfSceneNodes++;
-		m_pRootNode->AddSceneNode(cSceneNode);
-
-		// Done
-		return true;
-	}
-}
-
 /**
 *  @brief
 *    Removes a scene node
@@ -241,6 +221,30 @@ bool SceneHierarchy::RemoveSceneNode(SceneNode &cSceneNode)
 	}
 }
 
+
+//[-------------------------------------------------------]
+//[ Protected virtual SceneHierarchy functions            ]
+//[-------------------------------------------------------]
+/**
+*  @brief
+*    Adds a scene node
+*/
+bool SceneHierarchy::AddSceneNode(SceneNode &cSceneNode)
+{
+	// Check parameter and is the given scene node already within a hierarchy?
+	if (cSceneNode.m_pFirstSceneHierarchyNodeItem) {
+		// Error!
+		return false;
+	} else {
+		// Add the scene node to this hierarchy
+		m_nNumOfSceneNodes++;
+		m_pRootNode->AddSceneNode(cSceneNode);
+
+		// Done
+		return true;
+	}
+}
+
 /**
 *  @brief
 *    Refreshes a scene node
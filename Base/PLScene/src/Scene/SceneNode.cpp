@@ -1168,6 +1168,19 @@ SceneNode::~SceneNode()
 	ClearModifiers();
 }
 
+/**
+*  @brief
+*    Copy operator
+*/
+SceneNode &SceneNode::operator =(const SceneNode &cSource)
+{
+	// Copy the attribute values, signals are not copied
+	SetValues(cSource.GetValues());
+
+	// Return a reference to this instance
+	return *this;
+}
+
 
 //[-------------------------------------------------------]
 //[ Protected virtual SceneNode functions                 ]
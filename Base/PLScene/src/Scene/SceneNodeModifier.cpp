@@ -26,6 +26,7 @@
 //[ Includes                                              ]
 //[-------------------------------------------------------]
 #include <PLCore/Base/Class.h>
+#include "PLScene/Scene/SceneContext.h"
 #include "PLScene/Scene/SceneNodeModifier.h"
 
 
@@ -184,6 +185,33 @@ void SceneNodeModifier::OnActivate(bool bActivate)
 	// The default implementation is empty
 }
 
+/**
+*  @brief
+*    Called before "OnUpdateParallel()" to prepare the update
+*/
+void SceneNodeModifier::OnUpdatePrepare()
+{
+	// The default implementation is empty
+}
+
+/**
+*  @brief
+*    Called when the scene node modifier needs to be updated, may run in parallel to other scene node modifiers
+*/
+void SceneNodeModifier::OnUpdateParallel()
+{
+	// The default implementation is empty
+}
+
+/**
+*  @brief
+*    Called after "OnUpdateParallel()" to apply the results to the scene
+*/
+void SceneNodeModifier::OnUpdateCommit()
+{
+	// The default implementation is empty
+}
+
 
 //[-------------------------------------------------------]
 //[ Protected functions                                   ]
@@ -195,7 +223,9 @@ void SceneNodeModifier::OnActivate(bool bActivate)
 SceneNodeModifier::SceneNodeModifier(SceneNode &cSceneNode) :
 	Flags(this),
 	m_nFlags(0),
-	m_pSceneNode(&cSceneNode)
+	m_pSceneNode(&cSceneNode),
+	m_pParallelUpdateContext(nullptr),
+	m_nParallelUpdateIndex(0)
 {
 }
 
@@ -205,6 +235,23 @@ SceneNodeModifier::SceneNodeModifier(SceneNode &cSceneNode) :
 */
 SceneNodeModifier::~SceneNodeModifier()
 {
+	// Unregister from the (parallel) update, scene node modifiers are not always deactivated before they're destroyed
+	if (m_pParallelUpdateContext)
+		m_pParallelUpdateContext->RemoveParallelUpdate(*this);
+}
+
+/**
+*  @brief
+*    Updates this scene node modifier by calling "OnUpdatePrepare()", "OnUpdateParallel()" and "OnUpdateCommit()"
+*/
+void SceneNodeModifier::UpdateSerial()
+{
+	// Within a parallel update, the scene context updates this scene node modifier after emitting its update event
+	if (!m_pParallelUpdateContext || !m_pParallelUpdateContext->m_bParallelUpdateActive) {
+		OnUpdatePrepare();
+		OnUpdateParallel();
+		OnUpdateCommit();
+	}
 }
 
 
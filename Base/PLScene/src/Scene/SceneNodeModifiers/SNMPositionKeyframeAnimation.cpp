@@ -111,7 +111,9 @@ SNMPositionKeyframeAnimation::SNMPositionKeyframeAnimation(SceneNode &cSceneNode
 	Flags(this),
 	EventHandlerUpdate(&SNMPositionKeyframeAnimation::OnUpdate, this),
 	m_pChunk(new Chunk()),
-	m_pAnimation(new Animation())
+	m_pAnimation(new Animation()),
+	m_bUseTransform(false),
+	m_bPosition(false)
 {
 	// Set chunk semantic
 	m_pChunk->SetSemantic(Chunk::Position);
@@ -151,49 +153,54 @@ Animation &SNMPositionKeyframeAnimation::GetAnimation()
 //[-------------------------------------------------------]
 void SNMPositionKeyframeAnimation::OnActivate(bool bActivate)
 {
-	// Connect/disconnect event handler
+	// Connect/disconnect event handler and register/unregister for the parallel update
 	SceneContext *pSceneContext = GetSceneContext();
 	if (pSceneContext) {
 		if (bActivate) {
 			pSceneContext->EventUpdate.Connect(EventHandlerUpdate);
+			pSceneContext->AddParallelUpdate(*this);
 
 			// Make a first update to ensure everything is up-to-date when we're going active (synchronization and logic update)
-			OnUpdate();
+			OnUpdatePrepare();
+			OnUpdateParallel();
+			OnUpdateCommit();
 		} else {
 			pSceneContext->EventUpdate.Disconnect(EventHandlerUpdate);
+			pSceneContext->RemoveParallelUpdate(*this);
 		}
 	}
 }
 
-
-//[-------------------------------------------------------]
-//[ Private functions                                     ]
-//[-------------------------------------------------------]
-/**
-*  @brief
-*    Called when the scene node modifier needs to be updated
-*/
-void SNMPositionKeyframeAnimation::OnUpdate()
+void SNMPositionKeyframeAnimation::OnUpdatePrepare()
 {
+	m_bUseTransform = false;
+
 	// Are there any keys?
-	const float *pfData = reinterpret_cast<const float*>(m_pChunk->GetData());
-	if (pfData) {
-		// Update the animation
+	if (m_pChunk->GetData()) {
+		// Update the animation, this may emit events
 		m_pAnimation->Update(Speed*Timing::GetInstance()->GetTimeDifference());
 
 		// Transform the position using the requested scene container space?
-		bool bUseTransform = false;
-		Matrix3x4 mTransform;
 		if (CoordinateSystem.Get().GetLength() && GetSceneNode().GetContainer()) {
 			// Get the scene container the position keys should be in
 			SceneNode *pTargetSceneNode = GetSceneNode().GetContainer()->GetByName(CoordinateSystem);
 			if (pTargetSceneNode && pTargetSceneNode->IsContainer()) {
 				// Get the transform matrix that transform from "the other scene container" into "this scene container"
-				static_cast<SceneContainer*>(pTargetSceneNode)->GetTransformMatrixTo(*GetSceneNode().GetContainer(), mTransform);
-				bUseTransform = true;
+				// -> The transform matrices are calculated on demand, so this must not be done in parallel
+				static_cast<SceneContainer*>(pTargetSceneNode)->GetTransformMatrixTo(*GetSceneNode().GetContainer(), m_mTransform);
+				m_bUseTransform = true;
 			}
 		}
+	}
+}
+
+void SNMPositionKeyframeAnimation::OnUpdateParallel()
+{
+	m_bPosition = false;
 
+	// Are there any keys?
+	const float *pfData = reinterpret_cast<const float*>(m_pChunk->GetData());
+	if (pfData) {
 		// Get the current frame
 		const uint32 nCurrentFrame = m_pAnimation->GetCurrentFrame();
 		if (nCurrentFrame < m_pChunk->GetNumOfElements()) {
@@ -204,8 +211,8 @@ void SNMPositionKeyframeAnimation::OnUpdate()
 				Vector3 vCurrentPosition = &pfData[nCurrentFrameFirstComponent];
 
 				// Transform the position from the requested coordinate system?
-				if (bUseTransform)
-					vCurrentPosition *= mTransform;
+				if (m_bUseTransform)
+					vCurrentPosition *= m_mTransform;
 
 				// Get the next frame
 				const uint32 nNextFrame = m_pAnimation->GetNextFrame();
@@ -217,11 +224,12 @@ void SNMPositionKeyframeAnimation::OnUpdate()
 						Vector3 vNextPosition = &pfData[nNextFrameFirstComponent];
 
 						// Transform the position from the requested coordinate system?
-						if (bUseTransform)
-							vNextPosition *= mTransform;
+						if (m_bUseTransform)
+							vNextPosition *= m_mTransform;
 
-						// Set scene node interpolated position
-						GetSceneNode().MoveTo(vCurrentPosition + (vNextPosition-vCurrentPosition)*m_pAnimation->GetProgress());
+						// Get the interpolated position
+						m_vPosition = vCurrentPosition + (vNextPosition-vCurrentPosition)*m_pAnimation->GetProgress();
+						m_bPosition = true;
 					}
 				}
 			}
@@ -229,6 +237,26 @@ void SNMPositionKeyframeAnimation::OnUpdate()
 	}
 }
 
+void SNMPositionKeyframeAnimation::OnUpdateCommit()
+{
+	// Set scene node interpolated position
+	if (m_bPosition)
+		GetSceneNode().MoveTo(m_vPosition);
+}
+
+
+//[-------------------------------------------------------]
+//[ Private functions                                     ]
+//[-------------------------------------------------------]
+/**
+*  @brief
+*    Called when the scene node modifier needs to be updated
+*/
+void SNMPositionKeyframeAnimation::OnUpdate()
+{
+	UpdateSerial();
+}
+
 
 //[-------------------------------------------------------]
 //[ Namespace                                             ]
@@ -73,28 +73,23 @@ SNMPositionLinearAnimation::~SNMPositionLinearAnimation()
 //[-------------------------------------------------------]
 void SNMPositionLinearAnimation::OnActivate(bool bActivate)
 {
-	// Connect/disconnect event handler
+	// Connect/disconnect event handler and register/unregister for the parallel update
 	SceneContext *pSceneContext = GetSceneContext();
 	if (pSceneContext) {
-		if (bActivate)
+		if (bActivate) {
 			pSceneContext->EventUpdate.Connect(EventHandlerUpdate);
-		else
+			pSceneContext->AddParallelUpdate(*this);
+		} else {
 			pSceneContext->EventUpdate.Disconnect(EventHandlerUpdate);
+			pSceneContext->RemoveParallelUpdate(*this);
+		}
 	}
 }
 
-
-//[-------------------------------------------------------]
-//[ Private functions                                     ]
-//[-------------------------------------------------------]
-/**
-*  @brief
-*    Called when the scene node modifier needs to be updated
-*/
-void SNMPositionLinearAnimation::OnUpdate()
+void SNMPositionLinearAnimation::OnUpdateParallel()
 {
 	// Get the scene node
-	SceneNode &cSceneNode = GetSceneNode();
+	const SceneNode &cSceneNode = GetSceneNode();
 
 	// Get movement vector
 	Vector3 vVector;
@@ -117,11 +112,29 @@ void SNMPositionLinearAnimation::OnUpdate()
 	}
 
 	// Apply vector, speed and time difference
-	const Vector3 vPosInc = vVector*Speed*Timing::GetInstance()->GetTimeDifference();
+	m_vPositionIncrease = vVector*Speed*Timing::GetInstance()->GetTimeDifference();
+}
 
+void SNMPositionLinearAnimation::OnUpdateCommit()
+{
 	// 'Move' to the new position
-	if (!vPosInc.IsNull())
-		cSceneNode.MoveTo(cSceneNode.GetTransform().GetPosition()-vPosInc);
+	if (!m_vPositionIncrease.IsNull()) {
+		SceneNode &cSceneNode = GetSceneNode();
+		cSceneNode.MoveTo(cSceneNode.GetTransform().GetPosition()-m_vPositionIncrease);
+	}
+}
+
+
+//[-------------------------------------------------------]
+//[ Private functions                                     ]
+//[-------------------------------------------------------]
+/**
+*  @brief
+*    Called when the scene node modifier needs to be updated
+*/
+void SNMPositionLinearAnimation::OnUpdate()
+{
+	UpdateSerial();
 }
 
 
@@ -109,7 +109,8 @@ SNMRotationKeyframeAnimation::SNMRotationKeyframeAnimation(SceneNode &cSceneNode
 	Flags(this),
 	EventHandlerUpdate(&SNMRotationKeyframeAnimation::OnUpdate, this),
 	m_pChunk(new Chunk()),
-	m_pAnimation(new Animation())
+	m_pAnimation(new Animation()),
+	m_bRotation(false)
 {
 	// Set chunk semantic
 	m_pChunk->SetSemantic(Chunk::Rotation);
@@ -149,36 +150,38 @@ Animation &SNMRotationKeyframeAnimation::GetAnimation()
 //[-------------------------------------------------------]
 void SNMRotationKeyframeAnimation::OnActivate(bool bActivate)
 {
-	// Connect/disconnect event handler
+	// Connect/disconnect event handler and register/unregister for the parallel update
 	SceneContext *pSceneContext = GetSceneContext();
 	if (pSceneContext) {
 		if (bActivate) {
 			pSceneContext->EventUpdate.Connect(EventHandlerUpdate);
+			pSceneContext->AddParallelUpdate(*this);
 
 			// Make a first update to ensure everything is up-to-date when we're going active (synchronization and logic update)
-			OnUpdate();
+			OnUpdatePrepare();
+			OnUpdateParallel();
+			OnUpdateCommit();
 		} else {
 			pSceneContext->EventUpdate.Disconnect(EventHandlerUpdate);
+			pSceneContext->RemoveParallelUpdate(*this);
 		}
 	}
 }
 
+void SNMRotationKeyframeAnimation::OnUpdatePrepare()
+{
+	// Are there any keys? If so, update the frame, this may emit events
+	if (m_pChunk->GetData())
+		m_pAnimation->Update(Speed*Timing::GetInstance()->GetTimeDifference());
+}
 
-//[-------------------------------------------------------]
-//[ Private functions                                     ]
-//[-------------------------------------------------------]
-/**
-*  @brief
-*    Called when the scene node modifier needs to be updated
-*/
-void SNMRotationKeyframeAnimation::OnUpdate()
+void SNMRotationKeyframeAnimation::OnUpdateParallel()
 {
+	m_bRotation = false;
+
 	// Are there any keys?
 	const float *pfData = reinterpret_cast<const float*>(m_pChunk->GetData());
 	if (pfData) {
-		// Update the frame
-		m_pAnimation->Update(Speed*Timing::GetInstance()->GetTimeDifference());
-
 		// Get the current frame
 		const uint32 nCurrentFrame = m_pAnimation->GetCurrentFrame();
 		if (nCurrentFrame < m_pChunk->GetNumOfElements()) {
@@ -198,11 +201,8 @@ void SNMRotationKeyframeAnimation::OnUpdate()
 						const Quaternion qNextRotation = &pfData[nNextFrameFirstComponent];
 
 						// Get the interpolated rotation
-						Quaternion qResultRotation;
-						qResultRotation.Slerp(qCurrentRotation, qNextRotation, m_pAnimation->GetProgress());
-
-						// Set scene node rotation
-						GetSceneNode().GetTransform().SetRotation(qResultRotation);
+						m_qRotation.Slerp(qCurrentRotation, qNextRotation, m_pAnimation->GetProgress());
+						m_bRotation = true;
 					}
 				}
 			}
@@ -210,6 +210,26 @@ void SNMRotationKeyframeAnimation::OnUpdate()
 	}
 }
 
+void SNMRotationKeyframeAnimation::OnUpdateCommit()
+{
+	// Set scene node rotation
+	if (m_bRotation)
+		GetSceneNode().GetTransform().SetRotation(m_qRotation);
+}
+
+
+//[-------------------------------------------------------]
+//[ Private functions                                     ]
+//[-------------------------------------------------------]
+/**
+*  @brief
+*    Called when the scene node modifier needs to be updated
+*/
+void SNMRotationKeyframeAnimation::OnUpdate()
+{
+	UpdateSerial();
+}
+
 
 //[-------------------------------------------------------]
 //[ Namespace                                             ]
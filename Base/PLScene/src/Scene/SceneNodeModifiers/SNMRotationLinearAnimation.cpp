@@ -54,7 +54,8 @@ pl_implement_class(SNMRotationLinearAnimation)
 */
 SNMRotationLinearAnimation::SNMRotationLinearAnimation(SceneNode &cSceneNode) : SNMTransform(cSceneNode),
 	Velocity(this),
-	EventHandlerUpdate(&SNMRotationLinearAnimation::OnUpdate, this)
+	EventHandlerUpdate(&SNMRotationLinearAnimation::OnUpdate, this),
+	m_bRotationIncrease(false)
 {
 }
 
@@ -72,16 +73,40 @@ SNMRotationLinearAnimation::~SNMRotationLinearAnimation()
 //[-------------------------------------------------------]
 void SNMRotationLinearAnimation::OnActivate(bool bActivate)
 {
-	// Connect/disconnect event handler
+	// Connect/disconnect event handler and register/unregister for the parallel update
 	SceneContext *pSceneContext = GetSceneContext();
 	if (pSceneContext) {
-		if (bActivate)
+		if (bActivate) {
 			pSceneContext->EventUpdate.Connect(EventHandlerUpdate);
-		else
+			pSceneContext->AddParallelUpdate(*this);
+		} else {
 			pSceneContext->EventUpdate.Disconnect(EventHandlerUpdate);
+			pSceneContext->RemoveParallelUpdate(*this);
+		}
 	}
 }
 
+void SNMRotationLinearAnimation::OnUpdateParallel()
+{
+	// Is the velocity not null?
+	m_bRotationIncrease = !Velocity.Get().IsNull();
+	if (m_bRotationIncrease) {
+		// Get rotation increase in Euler angles (degree)
+		Vector3 vRot = Velocity.Get();
+		vRot *= Timing::GetInstance()->GetTimeDifference();
+
+		// Get a quaternion representation of the rotation increase
+		EulerAngles::ToQuaternion(static_cast<float>(vRot.x*Math::DegToRad), static_cast<float>(vRot.y*Math::DegToRad), static_cast<float>(vRot.z*Math::DegToRad), m_qRotationIncrease);
+	}
+}
+
+void SNMRotationLinearAnimation::OnUpdateCommit()
+{
+	// Apply the rotation increase
+	if (m_bRotationIncrease)
+		GetSceneNode().GetTransform().SetRotation(GetSceneNode().GetTransform().GetRotation()*m_qRotationIncrease);
+}
+
 
 //[-------------------------------------------------------]
 //[ Private functions                                     ]
@@ -92,19 +117,7 @@ void SNMRotationLinearAnimation::OnActivate(bool bActivate)
 */
 void SNMRotationLinearAnimation::OnUpdate()
 {
-	// Is the velocity not null?
-	if (!Velocity.Get().IsNull()) {
-		// Get rotation increase in Euler angles (degree)
-		Vector3 vRot = Velocity.Get();
-		vRot *= Timing::GetInstance()->GetTimeDifference();
-
-		// Get a quaternion representation of the rotation increase
-		Quaternion qRot;
-		EulerAngles::ToQuaternion(static_cast<float>(vRot.x*Math::DegToRad), static_cast<float>(vRot.y*Math::DegToRad), static_cast<float>(vRot.z*Math::DegToRad), qRot);
-
-		// Apply the rotation increase
-		GetSceneNode().GetTransform().SetRotation(GetSceneNode().GetTransform().GetRotation()*qRot);
-	}
+	UpdateSerial();
 }
 
 
@@ -109,7 +109,8 @@ SNMScaleKeyframeAnimation::SNMScaleKeyframeAnimation(SceneNode &cSceneNode) : SN
 	Flags(this),
 	EventHandlerUpdate(&SNMScaleKeyframeAnimation::OnUpdate, this),
 	m_pChunk(new Chunk()),
-	m_pAnimation(new Animation())
+	m_pAnimation(new Animation()),
+	m_bScale(false)
 {
 	// Set chunk semantic
 	m_pChunk->SetSemantic(Chunk::Scale);
@@ -149,36 +150,38 @@ Animation &SNMScaleKeyframeAnimation::GetAnimation()
 //[-------------------------------------------------------]
 void SNMScaleKeyframeAnimation::OnActivate(bool bActivate)
 {
-	// Connect/disconnect event handler
+	// Connect/disconnect event handler and register/unregister for the parallel update
 	SceneContext *pSceneContext = GetSceneContext();
 	if (pSceneContext) {
 		if (bActivate) {
 			pSceneContext->EventUpdate.Connect(EventHandlerUpdate);
+			pSceneContext->AddParallelUpdate(*this);
 
 			// Make a first update to ensure everything is up-to-date when we're going active (synchronization and logic update)
-			OnUpdate();
+			OnUpdatePrepare();
+			OnUpdateParallel();
+			OnUpdateCommit();
 		} else {
 			pSceneContext->EventUpdate.Disconnect(EventHandlerUpdate);
+			pSceneContext->RemoveParallelUpdate(*this);
 		}
 	}
 }
 
+void SNMScaleKeyframeAnimation::OnUpdatePrepare()
+{
+	// Are there any keys? If so, update the frame, this may emit events
+	if (m_pChunk->GetData())
+		m_pAnimation->Update(Speed*Timing::GetInstance()->GetTimeDifference());
+}
 
-//[-------------------------------------------------------]
-//[ Private functions                                     ]
-//[-------------------------------------------------------]
-/**
-*  @brief
-*    Called when the scene node modifier needs to be updated
-*/
-void SNMScaleKeyframeAnimation::OnUpdate()
+void SNMScaleKeyframeAnimation::OnUpdateParallel()
 {
+	m_bScale = false;
+
 	// Are there any keys?
 	const float *pfData = reinterpret_cast<const float*>(m_pChunk->GetData());
 	if (pfData) {
-		// Update the frame
-		m_pAnimation->Update(Speed*Timing::GetInstance()->GetTimeDifference());
-
 		// Get the current frame
 		const uint32 nCurrentFrame = m_pAnimation->GetCurrentFrame();
 		if (nCurrentFrame < m_pChunk->GetNumOfElements()) {
@@ -197,8 +200,9 @@ void SNMScaleKeyframeAnimation::OnUpdate()
 						// Get the next scale
 						const Vector3 vNextScale = &pfData[nNextFrameFirstComponent];
 
-						// Set scene node interpolated scae
-						GetSceneNode().GetTransform().SetScale(vCurrentScale + (vNextScale-vCurrentScale)*m_pAnimation->GetProgress());
+						// Get the interpolated scale
+						m_vScale = vCurrentScale + (vNextScale-vCurrentScale)*m_pAnimation->GetProgress();
+						m_bScale = true;
 					}
 				}
 			}
@@ -206,6 +210,26 @@ void SNMScaleKeyframeAnimation::OnUpdate()
 	}
 }
 
+void SNMScaleKeyframeAnimation::OnUpdateCommit()
+{
+	// Set scene node interpolated scale
+	if (m_bScale)
+		GetSceneNode().GetTransform().SetScale(m_vScale);
+}
+
+
+//[-------------------------------------------------------]
+//[ Private functions                                     ]
+//[-------------------------------------------------------]
+/**
+*  @brief
+*    Called when the scene node modifier needs to be updated
+*/
+void SNMScaleKeyframeAnimation::OnUpdate()
+{
+	UpdateSerial();
+}
+
 
 //[-------------------------------------------------------]
 //[ Namespace                                             ]
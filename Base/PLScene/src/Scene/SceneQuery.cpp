@@ -76,6 +76,19 @@ SceneQuery::~SceneQuery()
 {
 }
 
+/**
+*  @brief
+*    Copy operator
+*/
+SceneQuery &SceneQuery::operator =(const SceneQuery &cSource)
+{
+	// Copy the attribute values, signals are not copied
+	SetValues(cSource.GetValues());
+
+	// Return a reference to this instance
+	return *this;
+}
+
 
 //[-------------------------------------------------------]
 //[ Namespace                                             ]
@@ -27,6 +27,7 @@
 //[-------------------------------------------------------]
 #include <PLCore/Tools/Tools.h>
 #include <PLCore/Tools/Stopwatch.h>
+#include <PLCore/System/JobSystem.h>
 #include <PLMath/Matrix4x4.h>
 #include <PLMath/Intersect.h>
 #include <PLRenderer/RendererContext.h>
@@ -49,6 +50,9 @@
 #include "PLScene/Visibility/VisContainer.h"
 #include "PLScene/Visibility/VisPortal.h"
 #include "PLScene/Visibility/SQCull.h"
+#ifdef PLMATH_SSE
+	#include <xmmintrin.h>
+#endif
 
 
 //[-------------------------------------------------------]
@@ -86,6 +90,9 @@ SQCull::SQCull() :
 	m_nCurrentQueries(0),
 	m_nOcclusionQueries(0),
 	m_ppOcclusionQueries(nullptr),
+	m_nMaxNumOfBoxes(0),
+	m_pfBoxes(nullptr),
+	m_pnBoxVisibility(nullptr),
 	m_pVisRootContainer(nullptr),
 	m_pVisContainer(nullptr)
 {
@@ -110,6 +117,12 @@ SQCull::~SQCull()
 		delete [] m_ppOcclusionQueries;
 	}
 
+	// Destroy the batched frustum test buffers
+	if (m_pfBoxes)
+		delete [] m_pfBoxes;
+	if (m_pnBoxVisibility)
+		delete [] m_pnBoxVisibility;
+
 	// If this is the root of the scene, destroy the visibility tree
 	if (m_pVisRootContainer == m_pVisContainer && m_pVisRootContainer) {
 		m_pVisRootContainer->m_pQueryHandler->SetElement(nullptr);
@@ -308,6 +321,11 @@ void SQCull::InitStatistics()
 	m_sStatistics.nNumOfQueries					   = 0;
 	m_sStatistics.nMaxNumOfQueries				   = 0;
 	m_sStatistics.bWaitForQueryResult			   = false;
+	m_sStatistics.nTraversalTime				   = 0;
+	m_sStatistics.nTestTime						   = 0;
+	m_sStatistics.nMergeTime					   = 0;
+	m_sStatistics.nNumOfTestedBoxes				   = 0;
+	m_sStatistics.nNumOfWorkers					   = 0;
 }
 
 /**
@@ -369,6 +387,154 @@ bool SQCull::CullFrustum()
 	return true;
 }
 
+/**
+*  @brief
+*    Frustum culling only, the scene node bounding box tests are performed in batches
+*/
+bool SQCull::CullFrustumParallel()
+{
+	// Number of bounding boxes per job, below this number it's not worth the effort to use the worker threads
+	static const uint32 BoxesPerJob = 512;
+
+	// Start stopwatch
+	Stopwatch cStopwatch(true);
+
+	// PART 1: Hierarchical traversal, the order of the visible hierarchy nodes is the same as within "CullFrustum()"
+	m_lstVisibleNodes.Reset();
+	m_lstFirstBox.Reset();
+	m_lstNumOfBoxes.Reset();
+	uint32 nNumOfBoxes = 0;
+	m_lstDistanceQueue.Add(0.0f, &GetSceneContainer().GetHierarchyInstance()->GetRootNode());
+	while (m_lstDistanceQueue.GetNumOfElements()) {
+		// Get the first node and it's nearest distance to the camera and remove the node from the queue
+		SceneHierarchyNode *pHierarchyNode;
+		float				fNearestSquaredDistance;
+		m_lstDistanceQueue.ExtractTop(&pHierarchyNode, &fNearestSquaredDistance);
+		m_sStatistics.nNumOfTraversedNodes++;
+
+		// We don't need to know about near plane intersection
+		// for frustum culling only, but we have to pass a parameter
+		bool bIntersectsNearplane;
+		if (InsideViewFrustum(*pHierarchyNode, bIntersectsNearplane, false)) {
+			// Touch this node and resize our arrays if required
+			pHierarchyNode->Touch();
+			ResizeArrays();
+			m_lstVisibility.Set(pHierarchyNode->GetID());
+
+			// The items only need to be tested if the hierarchy node is not complete within the frustum
+			const uint32 nNumOfItems = pHierarchyNode->GetNumOfItems();
+			m_lstVisibleNodes.Add(pHierarchyNode);
+			if (nNumOfItems && !m_lstTotalVisibility.IsSet(pHierarchyNode->GetID())) {
+				m_lstFirstBox.Add(nNumOfBoxes);
+				nNumOfBoxes += nNumOfItems;
+			} else {
+				m_lstFirstBox.Add(static_cast<uint32>(-1));
+			}
+			m_lstNumOfBoxes.Add(nNumOfItems);
+
+			// Add children to priority queue for further processing
+			for (uint32 i=0; i<pHierarchyNode->GetNumOfNodes(); i++) {
+				SceneHierarchyNode *pNode = pHierarchyNode->GetNode(i);
+				m_lstDistanceQueue.Add(pNode->GetShortestDistance(m_vCameraPosition), pNode);
+			}
+		} else {
+			m_lstVisibility.Clear(pHierarchyNode->GetID());
+			m_sStatistics.nNumOfFrustumCulledNodes++;
+		}
+	}
+
+	// PART 2: Gather the container space bounding boxes of the items to test (the bounding boxes are calculated on demand, so this can't be done by the worker threads)
+	if (m_nMaxNumOfBoxes < nNumOfBoxes) {
+		if (m_pfBoxes)
+			delete [] m_pfBoxes;
+		if (m_pnBoxVisibility)
+			delete [] m_pnBoxVisibility;
+		m_nMaxNumOfBoxes  = nNumOfBoxes;
+		m_pfBoxes		  = new float[m_nMaxNumOfBoxes*6];
+		m_pnBoxVisibility = new uint8[m_nMaxNumOfBoxes];
+	}
+	float *pfBox = m_pfBoxes;
+	for (uint32 i=0; i<m_lstVisibleNodes.GetNumOfElements(); i++) {
+		if (m_lstFirstBox[i] != static_cast<uint32>(-1)) {
+			const SceneHierarchyNodeItem *pItem = m_lstVisibleNodes[i]->GetFirstItem();
+			for (uint32 nItem=0; nItem<m_lstNumOfBoxes[i]; nItem++, pfBox+=6) {
+				if (pItem && pItem->GetSceneNode()) {
+					// Store center and half extent, just like "Intersect::PlaneSetAABox()" is using it
+					const AABoundingBox &cAABB = pItem->GetSceneNode()->GetContainerAABoundingBox();
+					const Vector3 vCenter = (cAABB.vMin + cAABB.vMax)*0.5f;
+					const Vector3 vExtent = cAABB.vMax - vCenter;
+					pfBox[0] = vCenter.x;
+					pfBox[1] = vCenter.y;
+					pfBox[2] = vCenter.z;
+					pfBox[3] = vExtent.x;
+					pfBox[4] = vExtent.y;
+					pfBox[5] = vExtent.z;
+				} else {
+					// The result is not used, but we need to fill the box
+					pfBox[0] = pfBox[1] = pfBox[2] = pfBox[3] = pfBox[4] = pfBox[5] = 0.0f;
+				}
+
+				// Next item, please
+				if (pItem)
+					pItem = pItem->GetNextItem();
+			}
+		}
+	}
+
+	// Setup the view frustum planes in groups of four, unused planes of the last group will never cull anything
+	const uint32 nNumOfPlanes = m_cViewFrustum.GetNumOfPlanes();
+	const uint32 nNumOfGroups = (nNumOfPlanes + 3)/4;
+	m_lstPlanes.Resize(nNumOfGroups*28, true, false);
+	for (uint32 nGroup=0; nGroup<nNumOfGroups; nGroup++) {
+		float *pfGroup = &m_lstPlanes[nGroup*28];
+		for (uint32 nLane=0; nLane<4; nLane++) {
+			const uint32 nPlane = nGroup*4 + nLane;
+			if (nPlane < nNumOfPlanes) {
+				const Plane &cPlane = *m_cViewFrustum[nPlane];
+				pfGroup[nLane]		= cPlane.fN[Vector3::X];
+				pfGroup[4  + nLane] = cPlane.fN[Vector3::Y];
+				pfGroup[8  + nLane] = cPlane.fN[Vector3::Z];
+				pfGroup[12 + nLane] = cPlane.fD;
+				pfGroup[16 + nLane] = Math::Abs(cPlane.fN[Vector3::X]);
+				pfGroup[20 + nLane] = Math::Abs(cPlane.fN[Vector3::Y]);
+				pfGroup[24 + nLane] = Math::Abs(cPlane.fN[Vector3::Z]);
+			} else {
+				pfGroup[nLane] = pfGroup[4 + nLane] = pfGroup[8 + nLane] = pfGroup[16 + nLane] = pfGroup[20 + nLane] = pfGroup[24 + nLane] = 0.0f;
+				pfGroup[12 + nLane] = 1.0f;
+			}
+		}
+	}
+	m_sStatistics.nTraversalTime = cStopwatch.GetMicroseconds();
+
+	// PART 3: Test the gathered bounding boxes, use the worker threads of the job system if there are any
+	m_sStatistics.nNumOfTestedBoxes = nNumOfBoxes;
+	JobSystem *pJobSystem = (nNumOfBoxes > BoxesPerJob) ? JobSystem::GetInstance() : nullptr;
+	if (pJobSystem && pJobSystem->GetNumOfWorkers()) {
+		m_sStatistics.nNumOfWorkers = pJobSystem->GetNumOfWorkers();
+		pJobSystem->ParallelFor(nNumOfBoxes, BoxesPerJob, &SQCull::TestBoxes, this);
+	} else {
+		TestBoxes(0, nNumOfBoxes, this);
+	}
+	m_sStatistics.nTestTime = cStopwatch.GetMicroseconds() - m_sStatistics.nTraversalTime;
+
+	// PART 4: Merge the test results into the visibility container, front-to-back
+	bool bContinue = true;
+	for (uint32 i=0; i<m_lstVisibleNodes.GetNumOfElements() && bContinue; i++) {
+		const SceneHierarchyNode &cHierarchyNode = *m_lstVisibleNodes[i];
+
+		// Use the test results only if the items of the hierarchy node were not changed in the meantime (e.g. by a scene node signal listener)
+		const uint32 nFirstBox = m_lstFirstBox[i];
+		const uint8 *pnItemVisibility = (nFirstBox != static_cast<uint32>(-1) && cHierarchyNode.GetNumOfItems() == m_lstNumOfBoxes[i]) ? &m_pnBoxVisibility[nFirstBox] : nullptr;
+
+		// Traverse the node, the child nodes were already processed
+		bContinue = TraverseNode(cHierarchyNode, pnItemVisibility, false);
+	}
+	m_sStatistics.nMergeTime = cStopwatch.GetMicroseconds() - m_sStatistics.nTraversalTime - m_sStatistics.nTestTime;
+
+	// Done
+	return bContinue;
+}
+
 /**
 *  @brief
 *    This is the naive algorithm always waiting for the query to finish
@@ -536,7 +702,7 @@ bool SQCull::CullCoherentWithQueue()
 *  @brief
 *    Traverses a node
 */
-bool SQCull::TraverseNode(const SceneHierarchyNode &cHierarchyNode)
+bool SQCull::TraverseNode(const SceneHierarchyNode &cHierarchyNode, const uint8 *pnItemVisibility, bool bAddChildNodes)
 {
 	// Insert all assigned scene nodes to the scene node distance query
 	if (cHierarchyNode.GetNumOfItems()) {
@@ -600,7 +766,7 @@ bool SQCull::TraverseNode(const SceneHierarchyNode &cHierarchyNode)
 		SceneContext *pSceneContext = GetSceneContext();
 		if (pSceneContext) {
 			const SceneHierarchyNodeItem *pItem = cHierarchyNode.GetFirstItem();
-			while (pItem) {
+			for (uint32 nItem=0; pItem; pItem=pItem->GetNextItem(), nItem++) {
 				// Get the linked scene node
 				SceneNode *pSceneNode = pItem->GetSceneNode();
 
@@ -608,7 +774,6 @@ bool SQCull::TraverseNode(const SceneHierarchyNode &cHierarchyNode)
 				// outside, we can ONLY see it through a cell-portal! :)
 				if (!pSceneNode || !pSceneNode->IsVisible() || (pSceneNode->IsCell() && m_bCameraInCell && pSceneNode != m_pCameraContainer->GetElement())) {
 					// Next item, please
-					pItem = pItem->GetNextItem();
 					continue;
 				}
 
@@ -631,7 +796,6 @@ bool SQCull::TraverseNode(const SceneHierarchyNode &cHierarchyNode)
 						// Check if the scene node is 'out of range', if not, add it to the query
 						if (fMaxDrawDistance > 0.0f && fNearestSquaredDistance > fMaxDrawDistance*fMaxDrawDistance) {
 							// Next item, please
-							pItem = pItem->GetNextItem();
 							continue;
 						}
 					}
@@ -650,7 +814,6 @@ bool SQCull::TraverseNode(const SceneHierarchyNode &cHierarchyNode)
 							Plane::ESide nSide = static_cast<SNCellPortal*>(pSceneNode)->GetPolygon().GetPlane().GetSide(pSceneNode->GetTransform().GetInverseMatrix()*m_vCameraPosition);
 							if (nSide == Plane::InFront) {
 								// Next item, please
-								pItem = pItem->GetNextItem();
 								continue;
 							}
 						}
@@ -670,10 +833,10 @@ bool SQCull::TraverseNode(const SceneHierarchyNode &cHierarchyNode)
 								} else if (static_cast<SNLight*>(pSceneNode)->IsPointLight()) {
 									bVisible = Intersect::PlaneSetSphere(m_cViewFrustum, pSceneNode->GetTransform().GetPosition(), static_cast<SNPointLight*>(pSceneNode)->GetRange());
 								} else {
-									bVisible = Intersect::PlaneSetAABox(m_cViewFrustum, cAABB.vMin, cAABB.vMax);
+									bVisible = pnItemVisibility ? (pnItemVisibility[nItem] != 0) : Intersect::PlaneSetAABox(m_cViewFrustum, cAABB.vMin, cAABB.vMax);
 								}
 							} else {
-								bVisible = Intersect::PlaneSetAABox(m_cViewFrustum, cAABB.vMin, cAABB.vMax);
+								bVisible = pnItemVisibility ? (pnItemVisibility[nItem] != 0) : Intersect::PlaneSetAABox(m_cViewFrustum, cAABB.vMin, cAABB.vMax);
 							}
 
 
@@ -714,9 +877,6 @@ bool SQCull::TraverseNode(const SceneHierarchyNode &cHierarchyNode)
 						}
 					}
 				}
-
-				// Next item, please
-				pItem = pItem->GetNextItem();
 			}
 		}
 
@@ -935,9 +1095,11 @@ bool SQCull::TraverseNode(const SceneHierarchyNode &cHierarchyNode)
 	}
 
 	// Add children to priority queue for further processing
-	for (uint32 i=0; i<cHierarchyNode.GetNumOfNodes(); i++) {
-		SceneHierarchyNode *pNode = cHierarchyNode.GetNode(i);
-		m_lstDistanceQueue.Add(pNode->GetShortestDistance(m_vCameraPosition), pNode);
+	if (bAddChildNodes) {
+		for (uint32 i=0; i<cHierarchyNode.GetNumOfNodes(); i++) {
+			SceneHierarchyNode *pNode = cHierarchyNode.GetNode(i);
+			m_lstDistanceQueue.Add(pNode->GetShortestDistance(m_vCameraPosition), pNode);
+		}
 	}
 
 	// Done, not cancelled by the user
@@ -1080,6 +1242,74 @@ bool SQCull::InsideViewFrustum(const SceneHierarchyNode &cHierarchyNode, bool &b
 }
 
 
+//[-------------------------------------------------------]
+//[ Private static functions                              ]
+//[-------------------------------------------------------]
+/**
+*  @brief
+*    Tests a range of the gathered bounding boxes against the view frustum
+*/
+void SQCull::TestBoxes(uint32 nFirst, uint32 nEnd, void *pData)
+{
+	const SQCull &cCullQuery   = *static_cast<const SQCull*>(pData);
+	const uint32  nNumOfGroups = cCullQuery.m_lstPlanes.GetNumOfElements()/28;
+	const float  *pfPlanes	   = cCullQuery.m_lstPlanes.GetData();
+	const float  *pfBox		   = &cCullQuery.m_pfBoxes[nFirst*6];
+	uint8		 *pnVisibility = &cCullQuery.m_pnBoxVisibility[nFirst];
+
+	// Just like "Intersect::PlaneSetAABox()": A box is culled as soon as it's completely behind one of the planes,
+	// without any planes, everything is culled
+	const uint8 nVisibleByDefault = nNumOfGroups ? 1 : 0;
+#ifdef PLMATH_SSE
+	const __m128 vZero = _mm_setzero_ps();
+	for (uint32 i=nFirst; i<nEnd; i++, pfBox+=6, pnVisibility++) {
+		const __m128 vCenterX = _mm_set1_ps(pfBox[0]);
+		const __m128 vCenterY = _mm_set1_ps(pfBox[1]);
+		const __m128 vCenterZ = _mm_set1_ps(pfBox[2]);
+		const __m128 vExtentX = _mm_set1_ps(pfBox[3]);
+		const __m128 vExtentY = _mm_set1_ps(pfBox[4]);
+		const __m128 vExtentZ = _mm_set1_ps(pfBox[5]);
+		uint8 nVisible = nVisibleByDefault;
+		const float *pfGroup = pfPlanes;
+		for (uint32 nGroup=0; nGroup<nNumOfGroups; nGroup++, pfGroup+=28) {
+			// Signed distance of the box center and projected half extent, four planes at once
+			const __m128 vMP = _mm_add_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(vCenterX, _mm_loadu_ps(pfGroup)),
+																_mm_mul_ps(vCenterY, _mm_loadu_ps(pfGroup + 4))),
+																_mm_mul_ps(vCenterZ, _mm_loadu_ps(pfGroup + 8))),
+																_mm_loadu_ps(pfGroup + 12));
+			const __m128 vNP = _mm_add_ps(_mm_add_ps(_mm_mul_ps(vExtentX, _mm_loadu_ps(pfGroup + 16)),
+													 _mm_mul_ps(vExtentY, _mm_loadu_ps(pfGroup + 20))),
+													 _mm_mul_ps(vExtentZ, _mm_loadu_ps(pfGroup + 24)));
+
+			// Behind one of the planes?
+			if (_mm_movemask_ps(_mm_cmplt_ps(_mm_add_ps(vMP, vNP), vZero))) {
+				nVisible = 0;
+				break;
+			}
+		}
+		*pnVisibility = nVisible;
+	}
+#else
+	// C++ method
+	for (uint32 i=nFirst; i<nEnd; i++, pfBox+=6, pnVisibility++) {
+		uint8 nVisible = nVisibleByDefault;
+		const float *pfGroup = pfPlanes;
+		for (uint32 nGroup=0; nGroup<nNumOfGroups && nVisible; nGroup++, pfGroup+=28) {
+			for (uint32 nLane=0; nLane<4; nLane++) {
+				const float fMP = pfBox[0]*pfGroup[nLane] + pfBox[1]*pfGroup[4 + nLane] + pfBox[2]*pfGroup[8 + nLane] + pfGroup[12 + nLane];
+				const float fNP = pfBox[3]*pfGroup[16 + nLane] + pfBox[4]*pfGroup[20 + nLane] + pfBox[5]*pfGroup[24 + nLane];
+				if ((fMP + fNP) < 0.0f) {
+					nVisible = 0;
+					break;
+				}
+			}
+		}
+		*pnVisibility = nVisible;
+	}
+#endif
+}
+
+
 //[-------------------------------------------------------]
 //[ Public virtual SceneQuery functions                   ]
 //[-------------------------------------------------------]
@@ -1210,6 +1440,8 @@ bool SQCull::PerformQuery()
 			// Use the desired render mode
 			if (m_nMode == Frustum) {
 				bContinue = CullFrustum();
+			} else if (m_nMode == ParallelFrustum) {
+				bContinue = CullFrustumParallel();
 			} else if (m_nMode == StopAndWait || m_nMode == Coherent) {
 				// [TODO] Make those settings configurable?
 				const float fSlopeScaleDepthBias	= -0.1f;
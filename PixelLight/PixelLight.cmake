@@ -221,6 +221,7 @@ if(CMAKETOOLS_MINIMAL)
 	set (PL_PLUGIN_PHYSICS_PHYSX					"0"					CACHE BOOL "Build plugin 'PLPhysicsPhysX'?" (due to legal issues, we can't provide a public downloadable package))
 	set (PL_PLUGIN_PHYSICS_BULLET					"0"					CACHE BOOL "Build plugin 'PLPhysicsBullet'? (heavily under construction)")
 	set (PL_PLUGIN_RENDERER_NULL					"0"					CACHE BOOL "Build plugin 'PLRendererNull'?")
+	set (PL_PLUGIN_RENDERER_SOFTWARE				"0"					CACHE BOOL "Build plugin 'PLRendererSoftware'?")
 	if(PL_MOBILE)
 		set (PL_PLUGIN_FRONTEND_OS					"1"					CACHE BOOL "Build plugin 'PLFrontendOS'?")
 		set (PL_PLUGIN_RENDERER_OPENGL				"0"					CACHE BOOL "Build plugin 'PLRendererOpenGL'? (for font support, do also enable 'PL_PLUGIN_RENDERER_OPENGL_FONT')")
@@ -323,6 +324,7 @@ elseif(CMAKETOOLS_SDK)
 	set (PL_PLUGIN_ENGINE_IMAGEEXR					"1"					CACHE BOOL "Build plugin 'PLImageLoaderEXR'?")
 	set (PL_TOOL_PLINSTALL							"1"					CACHE BOOL "Build plugin 'PLInstall'?")
 	set (PL_PLUGIN_RENDERER_NULL					"1"					CACHE BOOL "Build plugin 'PLRendererNull'?")
+	set (PL_PLUGIN_RENDERER_SOFTWARE				"1"					CACHE BOOL "Build plugin 'PLRendererSoftware'?")
 	set (PL_PLUGIN_RENDERER_OPENGL					"1"					CACHE BOOL "Build plugin 'PLRendererOpenGL'? (for font support, do also enable 'PL_PLUGIN_RENDERER_OPENGL_FONT')")
 	set (PL_PLUGIN_RENDERER_OPENGL_FONT				"1"					CACHE BOOL "Build plugin 'PLRendererOpenGL' with font support? (requires 'freetype' external dependency)")
 	set (PL_PLUGIN_RENDERER_OPENGLCG				"1"					CACHE BOOL "Build plugin 'PLRendererOpenGLCg'? (requires 'PLRendererOpenGL') (due to legal issues, we can't provide a public downloadable package)")	# ${PL_USE_NONPUBLIC}
@@ -398,6 +400,7 @@ else()
 	set (PL_PLUGIN_ENGINE_IMAGEEXR					"1"					CACHE BOOL "Build plugin 'PLImageLoaderEXR'?")
 	set (PL_TOOL_PLINSTALL							"1"					CACHE BOOL "Build plugin 'PLInstall'?")
 	set (PL_PLUGIN_RENDERER_NULL					"1"					CACHE BOOL "Build plugin 'PLRendererNull'?")
+	set (PL_PLUGIN_RENDERER_SOFTWARE				"1"					CACHE BOOL "Build plugin 'PLRendererSoftware'?")
 	set (PL_PLUGIN_RENDERER_OPENGL					"1"					CACHE BOOL "Build plugin 'PLRendererOpenGL'? (for font support, do also enable 'PL_PLUGIN_RENDERER_OPENGL_FONT')")
 	set (PL_PLUGIN_RENDERER_OPENGL_FONT				"1"					CACHE BOOL "Build plugin 'PLRendererOpenGL' with font support? (requires 'freetype' external dependency)")
 	set (PL_PLUGIN_RENDERER_OPENGLCG				"1"					CACHE BOOL "Build plugin 'PLRendererOpenGLCg'? (requires 'PLRendererOpenGL') (due to legal issues, we can't provide a public downloadable package)")
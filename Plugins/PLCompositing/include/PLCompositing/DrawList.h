@@ -0,0 +1,350 @@
+/*********************************************************\
+ *  File: DrawList.h                                     *
+ *
+ *  Copyright (C) 2002-2013 The PixelLight Team (http://www.pixellight.org/)
+ *
+ *  This file is part of PixelLight.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ *  and associated documentation files (the "Software"), to deal in the Software without
+ *  restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ *  Software is furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all copies or
+ *  substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ *  BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ *  DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ *  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+#ifndef __PLCOMPOSITING_DRAWLIST_H__
+#define __PLCOMPOSITING_DRAWLIST_H__
+#pragma once
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include <PLCore/Container/Array.h>
+#include "PLCompositing/PLCompositing.h"
+
+
+//[-------------------------------------------------------]
+//[ Forward declarations                                  ]
+//[-------------------------------------------------------]
+namespace PLRenderer {
+	class Material;
+	class IndexBuffer;
+	class VertexBuffer;
+}
+namespace PLMesh {
+	class Geometry;
+	class MeshHandler;
+}
+namespace PLScene {
+	class SQCull;
+	class VisNode;
+	class SceneNode;
+}
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace PLCompositing {
+
+
+//[-------------------------------------------------------]
+//[ Classes                                               ]
+//[-------------------------------------------------------]
+/**
+*  @brief
+*    Draw list helper class gathering visible mesh geometries and ordering them by 64 bit sort keys
+*
+*  @remarks
+*    Drawing the visible scene nodes in traversal order switches the program, the material textures and uniforms
+*    for nearly every geometry. Scene renderer passes can use a draw list to avoid this:
+*      1. "Collect()" gathers all visible and active mesh geometries of the visibility containers of a cull query,
+*         including the ones visible through portals and within containers
+*      2. The scene renderer pass assigns a sort key to each item, usually by using "GetStateSortKey()" for opaque
+*         geometries (ordered by program, material and texture, front to back within identical states) and
+*         "GetDepthSortKey()" for transparent geometries (ordered back to front)
+*      3. "Sort()" orders the items by their sort key, the scene renderer pass then draws them by using "GetSortedItem()"
+*         and only changes states which differ from the previously drawn item
+*    The program, material and texture identifiers within a sort key are hashed from the given pointers, a collision
+*    just results in less batching but never in a wrong result because the drawing code compares the real states.
+*
+*    The memory of the draw list is kept across "Clear()" calls so gathering and sorting the geometries of a frame
+*    doesn't perform any memory allocations once the draw list has grown to the required size.
+*
+*  @note
+*    - Sort key layout when using "GetStateSortKey()": 4 bit pass, 12 bit program, 16 bit material, 12 bit texture, 20 bit depth (most significant first)
+*    - Sort key layout when using "GetDepthSortKey()": 4 bit pass, 20 bit depth, 12 bit program, 16 bit material, 12 bit texture (most significant first)
+*/
+class DrawList {
+
+
+	//[-------------------------------------------------------]
+	//[ Public definitions                                    ]
+	//[-------------------------------------------------------]
+	public:
+		/**
+		*  @brief
+		*    Collect flags
+		*/
+		enum ECollectFlags {
+			CollectOpaque      = 1<<0,	/**< Collect geometries using a material without "Opacity" parameter or with an opacity of >= 1 */
+			CollectTransparent = 1<<1	/**< Collect geometries using a material with an "Opacity" parameter < 1 */
+		};
+
+		/**
+		*  @brief
+		*    Draw list item, one per visible mesh geometry
+		*/
+		struct Item {
+			PLCore::uint64				 nSortKey;		/**< Sort key, set by the user of the draw list, initially 0 */
+			PLCore::uint32				 nUserData;		/**< Free to use by the user of the draw list (for example environment flags), initially 0 */
+			float						 fDepth;		/**< Squared distance of the visibility node to the camera */
+			const PLScene::SQCull		*pCullQuery;	/**< Cull query the visibility node is in, always valid */
+			const PLScene::VisNode		*pVisNode;		/**< Visibility node, always valid */
+			PLScene::SceneNode			*pSceneNode;	/**< Scene node owning the mesh, always valid */
+			const PLMesh::MeshHandler	*pMeshHandler;	/**< Mesh handler, always valid */
+			PLRenderer::Material		*pMaterial;		/**< Material used by the geometry, always valid */
+			PLRenderer::VertexBuffer	*pVertexBuffer;	/**< Vertex buffer with at least a position attribute, always valid */
+			PLRenderer::IndexBuffer		*pIndexBuffer;	/**< Index buffer, always valid */
+			const PLMesh::Geometry		*pGeometry;		/**< Geometry to draw, always valid */
+
+			bool operator ==(const Item &cItem) const
+			{
+				return (pVisNode == cItem.pVisNode && pGeometry == cItem.pGeometry);
+			}
+		};
+
+
+	//[-------------------------------------------------------]
+	//[ Public static functions                               ]
+	//[-------------------------------------------------------]
+	public:
+		/**
+		*  @brief
+		*    Returns a sort key ordering by states first and front to back within identical states
+		*
+		*  @param[in] nPass
+		*    Pass, only the lower 4 bits are used, items of a lower pass are drawn first
+		*  @param[in] pProgram
+		*    Pointer identifying the program, can be a null pointer
+		*  @param[in] pMaterial
+		*    Pointer identifying the material, can be a null pointer
+		*  @param[in] pTexture
+		*    Pointer identifying the (main) texture, can be a null pointer
+		*  @param[in] fDepth
+		*    Squared distance to the camera (see "Item::fDepth")
+		*
+		*  @return
+		*    The sort key
+		*/
+		static PLCOM_API PLCore::uint64 GetStateSortKey(PLCore::uint32 nPass, const void *pProgram, const void *pMaterial, const void *pTexture, float fDepth);
+
+		/**
+		*  @brief
+		*    Returns a sort key ordering back to front first and by states within identical depths
+		*
+		*  @param[in] nPass
+		*    Pass, only the lower 4 bits are used, items of a lower pass are drawn first
+		*  @param[in] pProgram
+		*    Pointer identifying the program, can be a null pointer
+		*  @param[in] pMaterial
+		*    Pointer identifying the material, can be a null pointer
+		*  @param[in] pTexture
+		*    Pointer identifying the (main) texture, can be a null pointer
+		*  @param[in] fDepth
+		*    Squared distance to the camera (see "Item::fDepth")
+		*
+		*  @return
+		*    The sort key
+		*
+		*  @note
+		*    - Required for transparent geometries which have to be blended back to front
+		*/
+		static PLCOM_API PLCore::uint64 GetDepthSortKey(PLCore::uint32 nPass, const void *pProgram, const void *pMaterial, const void *pTexture, float fDepth);
+
+
+	//[-------------------------------------------------------]
+	//[ Public functions                                      ]
+	//[-------------------------------------------------------]
+	public:
+		/**
+		*  @brief
+		*    Constructor
+		*/
+		PLCOM_API DrawList();
+
+		/**
+		*  @brief
+		*    Destructor
+		*/
+		PLCOM_API ~DrawList();
+
+		/**
+		*  @brief
+		*    Removes all items, the memory is kept
+		*/
+		PLCOM_API void Clear();
+
+		/**
+		*  @brief
+		*    Gathers the visible mesh geometries of a cull query
+		*
+		*  @param[in] cCullQuery
+		*    Cull query to gather the visible mesh geometries from, visibility containers and portals are processed recursively
+		*  @param[in] nFlags
+		*    Collect flags (see ECollectFlags)
+		*
+		*  @return
+		*    Number of added items
+		*
+		*  @note
+		*    - The gathered items are appended, use "Clear()" to start a new draw list
+		*    - Only the first LOD level of each mesh is used
+		*/
+		PLCOM_API PLCore::uint32 Collect(const PLScene::SQCull &cCullQuery, PLCore::uint32 nFlags = CollectOpaque);
+
+		/**
+		*  @brief
+		*    Adds an item
+		*
+		*  @return
+		*    The added item, the sort key and the user data are 0, the caller has to set all other members
+		*
+		*  @note
+		*    - Can be used to add geometries which are not gathered by "Collect()"
+		*/
+		PLCOM_API Item &AddItem();
+
+		/**
+		*  @brief
+		*    Returns the number of items
+		*
+		*  @return
+		*    The number of items
+		*/
+		PLCOM_API PLCore::uint32 GetNumOfItems() const;
+
+		/**
+		*  @brief
+		*    Returns an item in collect order
+		*
+		*  @param[in] nIndex
+		*    Index of the item, must be valid
+		*
+		*  @return
+		*    The requested item, use it to set the sort key
+		*/
+		PLCOM_API Item &GetItem(PLCore::uint32 nIndex);
+
+		/**
+		*  @brief
+		*    Orders the items by their sort key
+		*
+		*  @remarks
+		*    Uses a stable radix sort over the sort keys, bytes which are identical for all items are skipped.
+		*    Sorting doesn't allocate memory once the draw list has grown to the required size. The items itself are not moved, use "GetSortedItem()" to access them in sorted order.
+		*/
+		PLCOM_API void Sort();
+
+		/**
+		*  @brief
+		*    Returns an item in sorted order
+		*
+		*  @param[in] nIndex
+		*    Index of the item within the sorted order, must be valid
+		*
+		*  @return
+		*    The requested item
+		*
+		*  @note
+		*    - Only valid after "Sort()" has been called and as long as no items were added after the sort
+		*/
+		PLCOM_API const Item &GetSortedItem(PLCore::uint32 nIndex) const;
+
+
+	//[-------------------------------------------------------]
+	//[ Private definitions                                   ]
+	//[-------------------------------------------------------]
+	private:
+		/**
+		*  @brief
+		*    Sort entry, the sort key is copied to keep the radix sort passes cache friendly
+		*/
+		struct SortEntry {
+			PLCore::uint64 nSortKey;	/**< Sort key of the item */
+			PLCore::uint32 nIndex;		/**< Index of the item */
+
+			bool operator ==(const SortEntry &sSortEntry) const
+			{
+				return (nIndex == sSortEntry.nIndex);
+			}
+		};
+
+
+	//[-------------------------------------------------------]
+	//[ Private functions                                     ]
+	//[-------------------------------------------------------]
+	private:
+		/**
+		*  @brief
+		*    Copy constructor
+		*
+		*  @param[in] cSource
+		*    Source to copy from
+		*/
+		DrawList(const DrawList &cSource);
+
+		/**
+		*  @brief
+		*    Copy operator
+		*
+		*  @param[in] cSource
+		*    Source to copy from
+		*
+		*  @return
+		*    Reference to this instance
+		*/
+		DrawList &operator =(const DrawList &cSource);
+
+		/**
+		*  @brief
+		*    Gathers the visible mesh geometries of a cull query, recursive part
+		*
+		*  @param[in] cCullQuery
+		*    Cull query to gather the visible mesh geometries from
+		*  @param[in] nFlags
+		*    Collect flags (see ECollectFlags)
+		*/
+		void CollectRec(const PLScene::SQCull &cCullQuery, PLCore::uint32 nFlags);
+
+
+	//[-------------------------------------------------------]
+	//[ Private data                                          ]
+	//[-------------------------------------------------------]
+	private:
+		PLCore::Array<Item>		 m_lstItems;		/**< Items in collect order */
+		PLCore::Array<SortEntry> m_lstSorted;		/**< Sort entries in sorted order, only the data is used, the number of elements is the number of items */
+		PLCore::Array<SortEntry> m_lstSortTemp;		/**< Temporary sort entries used while sorting, only the data is used */
+
+
+};
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+} // PLCompositing
+
+
+#endif // __PLCOMPOSITING_DRAWLIST_H__
@@ -208,8 +208,12 @@ class SRPDirectionalLighting : public PLScene::SceneRendererPass {
 		*    LOD level of the mesh to draw
 		*  @param[in] cVertexBuffer
 		*    Vertex buffer to use
+		*
+		*  @note
+		*    - Called by "DrawRec()", the default implementation does nothing so that derived classes
+		*      drawing in another way (for example by using a "DrawList") don't need to implement it
 		*/
-		virtual void DrawMesh(PLRenderer::Renderer &cRenderer, const PLScene::SQCull &cCullQuery, const PLScene::VisNode &cVisNode, PLScene::SceneNode &cSceneNode, const PLMesh::MeshHandler &cMeshHandler, const PLMesh::Mesh &cMesh, const PLMesh::MeshLODLevel &cMeshLODLevel, PLRenderer::VertexBuffer &cVertexBuffer) = 0;
+		PLCOM_API virtual void DrawMesh(PLRenderer::Renderer &cRenderer, const PLScene::SQCull &cCullQuery, const PLScene::VisNode &cVisNode, PLScene::SceneNode &cSceneNode, const PLMesh::MeshHandler &cMeshHandler, const PLMesh::Mesh &cMesh, const PLMesh::MeshLODLevel &cMeshLODLevel, PLRenderer::VertexBuffer &cVertexBuffer);
 
 
 	//[-------------------------------------------------------]
@@ -30,12 +30,11 @@
 //[-------------------------------------------------------]
 //[ Includes                                              ]
 //[-------------------------------------------------------]
-#include <PLCore/Container/Pool.h>
-#include <PLMath/Rectangle.h>
 #include <PLCore/Base/Event/EventHandler.h>
 #include <PLRenderer/Renderer/ProgramGenerator.h>
 #include "PLCompositing/Shaders/Deferred/SRPDeferredGBufferMaterial.h"
 #include "PLCompositing/Shaders/Deferred/SRPDeferred.h"
+#include "PLCompositing/DrawList.h"
 
 
 //[-------------------------------------------------------]
@@ -44,21 +43,11 @@
 namespace PLRenderer {
 	class Surface;
 	class Material;
-	class IndexBuffer;
-	class VertexBuffer;
 	class SurfaceTextureBuffer;
 	class TextureBufferRectangle;
 }
-namespace PLMesh {
-	class Mesh;
-	class Geometry;
-	class MeshHandler;
-	class MeshLODLevel;
-}
 namespace PLScene {
 	class SQCull;
-	class VisNode;
-	class SceneNode;
 }
 namespace PLCompositing {
 	class FullscreenQuad;
@@ -154,6 +143,8 @@ namespace PLCompositing {
 *    - Geometry/attributes stage
 *    - Another known name "fat frame buffer"
 *    - Normal map compression using swizzled DXT5 (xGxR), LATC2 and alternate XY swizzle LATC2 is supported
+*    - The visible geometries are drawn ordered by program, material and texture (front to back within identical states) so
+*      that redundant state changes are skipped, see "PLRenderer::Renderer::GetStatistics()" for the resulting state changes
 *    - By default, this scene renderer pass writes into the stencil buffer whether or not a pixel has valid content.
 *      1 within the stencil buffer means: The GBuffer has no information about the pixel because no geometry is covering it.
 */
@@ -292,62 +283,30 @@ class SRPDeferredGBuffer : public SRPDeferred {
 		PLCOM_API FullscreenQuad *GetFullscreenQuad() const;
 
 
-	//[-------------------------------------------------------]
-	//[ Private definitions                                   ]
-	//[-------------------------------------------------------]
-	private:
-		/**
-		*  @brief
-		*    Mesh batch
-		*/
-		struct MeshBatch {
-			const PLRenderer::Material		*pMaterial;			/**< Used material, always valid! */
-				  PLRenderer::VertexBuffer	*pVertexBuffer;		/**< Used vertex buffer, always valid! */
-				  PLRenderer::IndexBuffer	*pIndexBuffer;		/**< Used index buffer, always valid! */
-			const PLMesh::Geometry			*pGeometry;			/**< Used geometry, always valid! */
-			const PLScene::SQCull			*pCullQuery;		/**< Used cull query, always valid! */
-			const PLScene::VisNode			*pVisNode;			/**< Used visibility node, always valid! */
-				  PLMath::Rectangle			 sScissorRectangle;	/**< Scissor rectangle */
-		};
-
-
 	//[-------------------------------------------------------]
 	//[ Private functions                                     ]
 	//[-------------------------------------------------------]
 	private:
 		/**
 		*  @brief
-		*    Collect mesh batches recursive
+		*    Returns the cached SRPDeferredGBuffer-material of a material
 		*
-		*  @param[in] cCullQuery
-		*    Cull query to use
+		*  @param[in] cMaterial
+		*    Material to return the cached SRPDeferredGBuffer-material from, it's created if not yet cached
+		*
+		*  @return
+		*    The cached SRPDeferredGBuffer-material
 		*/
-		void CollectMeshBatchesRec(const PLScene::SQCull &cCullQuery);
+		SRPDeferredGBufferMaterial &GetCachedMaterial(PLRenderer::Material &cMaterial);
 
 		/**
 		*  @brief
-		*    Draws a mesh batch
+		*    Draws the gathered and sorted draw list items
 		*
 		*  @param[in] cRenderer
 		*    Renderer to use
-		*  @param[in] cGeneratedProgramUserData
-		*    Generated program user data for the mesh batch material
-		*  @param[in] cMeshBatch
-		*    Mesh batch to use
-		*/
-		void DrawMeshBatch(PLRenderer::Renderer &cRenderer, SRPDeferredGBufferMaterial::GeneratedProgramUserData &cGeneratedProgramUserData, MeshBatch &cMeshBatch) const;
-
-		/**
-		*  @brief
-		*    Returns a free mesh batch
-		*
-		*  @return
-		*    Free mesh batch
-		*
-		*  @note
-		*    - Use FreeMeshBatch() if you no longer need this mesh batch
 		*/
-		MeshBatch &GetFreeMeshBatch();
+		void DrawSortedItems(PLRenderer::Renderer &cRenderer);
 
 		/**
 		*  @brief
@@ -378,9 +337,7 @@ class SRPDeferredGBuffer : public SRPDeferred {
 		bool									 m_bColorTarget3AlphaUsed;	/**< Was the alpha component of target 3 actually used when filling the current GBuffer content? */
 		PLRenderer::Surface						*m_pSurfaceBackup;			/**< Backup of the previously set render surface, can be a null pointer */
 		FullscreenQuad							*m_pFullscreenQuad;			/**< Fullscreen quad instance, can be a null pointer */
-		PLCore::Pool<PLRenderer::Material*>  	 m_lstMaterials;			/**< List of currently used materials */
-		PLCore::Pool<MeshBatch*>				 m_lstFreeMeshBatches;		/**< List of currently free mesh batches */
-		PLCore::Pool<MeshBatch*>				 m_lstMeshBatches;			/**< List of currently used mesh batches */
+		DrawList								 m_cDrawList;				/**< Visible geometries of the current frame, the memory is reused across frames */
 
 		// Material cache
 		PLRenderer::ProgramGenerator							     *m_pProgramGenerator;	/**< Program generator, can be a null pointer */
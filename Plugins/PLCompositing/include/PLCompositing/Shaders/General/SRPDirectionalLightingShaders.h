@@ -34,7 +34,7 @@
 #include <PLRenderer/Renderer/ProgramGenerator.h>
 #include <PLScene/Scene/SceneNodeHandler.h>
 #include "PLCompositing/SRPDirectionalLighting.h"
-#include "PLCompositing/PLCompositing.h"
+#include "PLCompositing/DrawList.h"
 
 
 //[-------------------------------------------------------]
@@ -142,6 +142,11 @@ namespace PLCompositing {
 *    </Material>
 *  @endverbatim
 *
+*    The visible geometries are gathered into a draw list and drawn ordered by program, material and texture
+*    (front to back within identical states) so that redundant state changes are skipped. Within a transparent pass,
+*    the geometries are drawn back to front. The resulting number of state changes can be inspected by using
+*    "PLRenderer::Renderer::GetStatistics()".
+*
 *  @note
 *    - Normal map compression using swizzled DXT5 (xGxR), LATC2 and alternate XY swizzle LATC2 is supported
 *    - Build in support for a glow post processing effect writing values into the alpha channel of the framebuffer
@@ -257,6 +262,41 @@ class SRPDirectionalLightingShaders : public SRPDirectionalLighting {
 		*/
 		void OnMaterialRemoved(PLRenderer::Material &cMaterial);
 
+		/**
+		*  @brief
+		*    Returns the cached SRPDirectionalLightingShaders-material of a material
+		*
+		*  @param[in] cMaterial
+		*    Material to return the cached SRPDirectionalLightingShaders-material from, it's created if not yet cached
+		*
+		*  @return
+		*    The cached SRPDirectionalLightingShaders-material
+		*/
+		SRPDirectionalLightingShadersMaterial &GetCachedMaterial(PLRenderer::Material &cMaterial);
+
+		/**
+		*  @brief
+		*    Returns the environment flags to use for a mesh
+		*
+		*  @param[in] cSceneNode
+		*    Mesh owner scene node
+		*  @param[in] cVertexBuffer
+		*    Vertex buffer of the mesh
+		*
+		*  @return
+		*    Environment flags (see SRPDirectionalLightingShadersMaterial::EEnvironmentFlags)
+		*/
+		PLCore::uint32 GetEnvironmentFlags(const PLScene::SceneNode &cSceneNode, const PLRenderer::VertexBuffer &cVertexBuffer) const;
+
+		/**
+		*  @brief
+		*    Draws the gathered and sorted draw list items
+		*
+		*  @param[in] cRenderer
+		*    Renderer to use
+		*/
+		void DrawSortedItems(PLRenderer::Renderer &cRenderer);
+
 
 	//[-------------------------------------------------------]
 	//[ Private event handlers                                ]
@@ -284,12 +324,8 @@ class SRPDirectionalLightingShaders : public SRPDirectionalLighting {
 		PLRenderer::RenderStates												*m_pRenderStates;		/**< Used to 'translate' render state strings, always valid! */
 		PLCore::HashMap<PLCore::uint64, SRPDirectionalLightingShadersMaterial*>  m_lstMaterialCache;	/**< List of cached materials */
 
-
-	//[-------------------------------------------------------]
-	//[ Private virtual SRPDirectionalLighting functions      ]
-	//[-------------------------------------------------------]
-	private:
-		virtual void DrawMesh(PLRenderer::Renderer &cRenderer, const PLScene::SQCull &cCullQuery, const PLScene::VisNode &cVisNode, PLScene::SceneNode &cSceneNode, const PLMesh::MeshHandler &cMeshHandler, const PLMesh::Mesh &cMesh, const PLMesh::MeshLODLevel &cMeshLODLevel, PLRenderer::VertexBuffer &cVertexBuffer) override;
+		// Draw list
+		DrawList m_cDrawList;	/**< Visible geometries of the current frame, the memory is reused across frames */
 
 
 	//[-------------------------------------------------------]
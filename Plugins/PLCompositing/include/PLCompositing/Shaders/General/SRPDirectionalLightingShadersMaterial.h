@@ -43,6 +43,7 @@ namespace PLRenderer {
 	class Material;
 	class Renderer;
 	class Parameter;
+	class TextureBuffer;
 	class RenderStates;
 	class ProgramUniform;
 	class ProgramAttribute;
@@ -203,6 +204,35 @@ class SRPDirectionalLightingShadersMaterial {
 		*/
 		GeneratedProgramUserData *MakeMaterialCurrent(PLCore::uint32 nRendererFlags, PLCore::uint32 nEnvironmentFlags, ETextureFiltering nTextureFiltering);
 
+		/**
+		*  @brief
+		*    Returns the generated program this material is using
+		*
+		*  @param[in] nRendererFlags
+		*    SRPDirectionalLightingShaders-flags to use
+		*  @param[in] nEnvironmentFlags
+		*    Environment flags to use (see EEnvironmentFlags)
+		*
+		*  @return
+		*    The generated program, a null pointer on error, do NOT delete the memory the pointer points to
+		*
+		*  @note
+		*    - Doesn't change any renderer states, can for example be used to sort by program before "MakeMaterialCurrent()" is called
+		*/
+		PLRenderer::ProgramGenerator::GeneratedProgram *GetGeneratedProgram(PLCore::uint32 nRendererFlags, PLCore::uint32 nEnvironmentFlags);
+
+		/**
+		*  @brief
+		*    Returns the texture buffer of the diffuse map
+		*
+		*  @return
+		*    The texture buffer of the diffuse map, can be a null pointer
+		*
+		*  @note
+		*    - Only valid after "GetGeneratedProgram()" or "MakeMaterialCurrent()" has been called
+		*/
+		PLRenderer::TextureBuffer *GetDiffuseMapTextureBuffer() const;
+
 
 	//[-------------------------------------------------------]
 	//[ Private definitions                                   ]
@@ -31,7 +31,9 @@
 //[ Includes                                              ]
 //[-------------------------------------------------------]
 #include <PLCore/Container/Pool.h>
+#include <PLCore/Container/Array.h>
 #include <PLMath/Rectangle.h>
+#include <PLRenderer/Renderer/CommandBuffer.h>
 #include <PLRenderer/Renderer/ProgramGenerator.h>
 #include <PLScene/Compositing/SceneRendererPass.h>
 #include "PLCompositing/PLCompositing.h"
@@ -246,6 +248,8 @@ class SRPShadowMapping : public PLScene::SceneRendererPass {
 			const PLScene::SQCull			*pCullQuery;		/**< Used cull query, always valid! */
 			const PLScene::VisNode			*pVisNode;			/**< Used visibility node, always valid! */
 				  PLMath::Rectangle			 sScissorRectangle;	/**< Scissor rectangle */
+				  PLMath::Matrix4x4			 mWorldViewProjection;	/**< World view projection matrix of the visibility node */
+				  PLMath::Matrix4x4			 mWorldView;			/**< World view matrix of the visibility node */
 		};
 
 
@@ -280,16 +284,49 @@ class SRPShadowMapping : public PLScene::SceneRendererPass {
 
 		/**
 		*  @brief
-		*    Draws a mesh batch
+		*    Draws all mesh batches using the given material
 		*
 		*  @param[in] cRenderer
 		*    Renderer to use
 		*  @param[in] cGeneratedProgramUserData
+		*    Generated program user data for the material, the program must already be the current one
+		*  @param[in] cMaterial
+		*    Material to draw the mesh batches of
+		*
+		*  @note
+		*    - The draw calls are recorded into command buffers, using the worker threads of the job system if there
+		*      are enough mesh batches, and then executed in the order of the mesh batches
+		*/
+		void DrawMeshBatches(PLRenderer::Renderer &cRenderer, GeneratedProgramUserData &cGeneratedProgramUserData, const PLRenderer::Material &cMaterial);
+
+		/**
+		*  @brief
+		*    Records a mesh batch
+		*
+		*  @param[in] cCommandBuffer
+		*    Command buffer to record into
+		*  @param[in] cGeneratedProgramUserData
 		*    Generated program user data for the mesh batch material
 		*  @param[in] cMeshBatch
 		*    Mesh batch to use
 		*/
-		void DrawMeshBatch(PLRenderer::Renderer &cRenderer, GeneratedProgramUserData &cGeneratedProgramUserData, MeshBatch &cMeshBatch) const;
+		void DrawMeshBatch(PLRenderer::CommandBuffer &cCommandBuffer, const GeneratedProgramUserData &cGeneratedProgramUserData, const MeshBatch &cMeshBatch) const;
+
+		/**
+		*  @brief
+		*    Records the mesh batches of the given command buffers
+		*
+		*  @param[in] nFirst
+		*    Index of the first command buffer to record
+		*  @param[in] nEnd
+		*    Index behind the last command buffer to record
+		*  @param[in] pData
+		*    The scene renderer pass (SRPShadowMapping), always valid
+		*
+		*  @note
+		*    - Job system parallel for function, the ranges are processed concurrently
+		*/
+		static void RecordMeshBatches(PLCore::uint32 nFirst, PLCore::uint32 nEnd, void *pData);
 
 		/**
 		*  @brief
@@ -331,6 +368,14 @@ class SRPShadowMapping : public PLScene::SceneRendererPass {
 		PLRenderer::ProgramGenerator			  *m_pProgramGenerator;		/**< Program generator, can be a null pointer */
 		PLRenderer::ProgramGenerator::Flags		   m_cProgramFlags;			/**< Program flags as class member to reduce dynamic memory allocations */
 
+		// Command buffers
+		static const PLCore::uint32 NumOfCommandBuffers			= 8;	/**< Maximum number of command buffers recorded in parallel */
+		static const PLCore::uint32 MeshBatchesPerCommandBuffer	= 32;	/**< Minimum number of mesh batches per command buffer */
+		PLRenderer::CommandBuffer		  m_cCommandBuffers[NumOfCommandBuffers];	/**< Command buffers, reused to reduce dynamic memory allocations */
+		PLCore::uint32					  m_nNumOfUsedCommandBuffers;				/**< Number of command buffers used for the current material */
+		PLCore::Array<const MeshBatch*>	  m_lstMaterialMeshBatches;					/**< Mesh batches of the current material */
+		const GeneratedProgramUserData	 *m_pMaterialProgramUserData;				/**< Generated program user data of the current material, can be a null pointer */
+
 
 	//[-------------------------------------------------------]
 	//[ Private virtual PLScene::SceneRendererPass functions  ]
@@ -0,0 +1,368 @@
+/*********************************************************\
+ *  File: DrawList.cpp                                   *
+ *
+ *  Copyright (C) 2002-2013 The PixelLight Team (http://www.pixellight.org/)
+ *
+ *  This file is part of PixelLight.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ *  and associated documentation files (the "Software"), to deal in the Software without
+ *  restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ *  Software is furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all copies or
+ *  substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ *  BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ *  DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ *  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include <PLCore/Core/MemoryManager.h>
+#include <PLRenderer/Renderer/VertexBuffer.h>
+#include <PLRenderer/Material/Material.h>
+#include <PLRenderer/Material/Parameter.h>
+#include <PLMesh/Mesh.h>
+#include <PLMesh/MeshHandler.h>
+#include <PLMesh/MeshLODLevel.h>
+#include <PLScene/Scene/SceneNode.h>
+#include <PLScene/Visibility/SQCull.h>
+#include <PLScene/Visibility/VisPortal.h>
+#include <PLScene/Visibility/VisContainer.h>
+#include "PLCompositing/DrawList.h"
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+using namespace PLCore;
+using namespace PLRenderer;
+using namespace PLMesh;
+using namespace PLScene;
+namespace PLCompositing {
+
+
+//[-------------------------------------------------------]
+//[ Local functions                                       ]
+//[-------------------------------------------------------]
+/**
+*  @brief
+*    Returns a hashed identifier with the given number of bits for a pointer
+*/
+static uint64 GetPointerID(const void *pPointer, uint32 nNumOfBits)
+{
+	// Fibonacci hashing, the upper bits of the product are the well distributed ones
+	return (reinterpret_cast<uint64>(pPointer)*0x9E3779B97F4A7C15ULL) >> (64 - nNumOfBits);
+}
+
+/**
+*  @brief
+*    Returns the 20 bit depth value for a squared distance to the camera
+*/
+static uint64 GetDepthBits(float fDepth)
+{
+	// The bits of a positive float are ordered like the float values, because the sign bit is
+	// always 0 the upper 20 bits of the remaining 31 bits are used
+	if (fDepth <= 0.0f)
+		return 0;
+	uint32 nBits;
+	MemoryManager::Copy(&nBits, &fDepth, sizeof(float));
+	return nBits >> 11;
+}
+
+
+//[-------------------------------------------------------]
+//[ Public static functions                               ]
+//[-------------------------------------------------------]
+/**
+*  @brief
+*    Returns a sort key ordering by states first and front to back within identical states
+*/
+uint64 DrawList::GetStateSortKey(uint32 nPass, const void *pProgram, const void *pMaterial, const void *pTexture, float fDepth)
+{
+	return (static_cast<uint64>(nPass & 0xF) << 60) |
+		   (GetPointerID(pProgram, 12)       << 48) |
+		   (GetPointerID(pMaterial, 16)      << 32) |
+		   (GetPointerID(pTexture, 12)       << 20) |
+		   GetDepthBits(fDepth);
+}
+
+/**
+*  @brief
+*    Returns a sort key ordering back to front first and by states within identical depths
+*/
+uint64 DrawList::GetDepthSortKey(uint32 nPass, const void *pProgram, const void *pMaterial, const void *pTexture, float fDepth)
+{
+	return (static_cast<uint64>(nPass & 0xF)        << 60) |
+		   ((~GetDepthBits(fDepth) & 0xFFFFF)       << 40) |
+		   (GetPointerID(pProgram, 12)              << 28) |
+		   (GetPointerID(pMaterial, 16)             << 12) |
+		   GetPointerID(pTexture, 12);
+}
+
+
+//[-------------------------------------------------------]
+//[ Public functions                                      ]
+//[-------------------------------------------------------]
+/**
+*  @brief
+*    Constructor
+*/
+DrawList::DrawList()
+{
+}
+
+/**
+*  @brief
+*    Destructor
+*/
+DrawList::~DrawList()
+{
+}
+
+/**
+*  @brief
+*    Removes all items, the memory is kept
+*/
+void DrawList::Clear()
+{
+	m_lstItems.Reset();
+}
+
+/**
+*  @brief
+*    Gathers the visible mesh geometries of a cull query
+*/
+uint32 DrawList::Collect(const SQCull &cCullQuery, uint32 nFlags)
+{
+	// Get the current number of items
+	const uint32 nNumOfItems = m_lstItems.GetNumOfElements();
+
+	// Collect recursive
+	CollectRec(cCullQuery, nFlags);
+
+	// Return the number of added items
+	return m_lstItems.GetNumOfElements() - nNumOfItems;
+}
+
+/**
+*  @brief
+*    Adds an item
+*/
+DrawList::Item &DrawList::AddItem()
+{
+	// Grow the item list if required, double the size to keep the number of reallocations low
+	if (m_lstItems.GetNumOfElements() == m_lstItems.GetMaxNumOfElements())
+		m_lstItems.Resize(m_lstItems.GetMaxNumOfElements() ? m_lstItems.GetMaxNumOfElements()*2 : 256, false);
+
+	// Add the item
+	Item &cItem = m_lstItems.Add();
+	cItem.nSortKey	= 0;
+	cItem.nUserData	= 0;
+	return cItem;
+}
+
+/**
+*  @brief
+*    Returns the number of items
+*/
+uint32 DrawList::GetNumOfItems() const
+{
+	return m_lstItems.GetNumOfElements();
+}
+
+/**
+*  @brief
+*    Returns an item in collect order
+*/
+DrawList::Item &DrawList::GetItem(uint32 nIndex)
+{
+	return m_lstItems.GetData()[nIndex];
+}
+
+/**
+*  @brief
+*    Orders the items by their sort key
+*/
+void DrawList::Sort()
+{
+	// Ensure the sort buffers are large enough, they only grow
+	const uint32 nNumOfItems = m_lstItems.GetNumOfElements();
+	if (m_lstSorted.GetMaxNumOfElements() < nNumOfItems) {
+		m_lstSorted  .Resize(nNumOfItems, false);
+		m_lstSortTemp.Resize(nNumOfItems, false);
+	}
+	if (!nNumOfItems)
+		return; // Done
+
+	// Copy the sort keys and gather the histograms of all 8 bytes within a single pass
+	SortEntry *pSource = m_lstSorted.GetData();
+	SortEntry *pTarget = m_lstSortTemp.GetData();
+	const Item *pItems = m_lstItems.GetData();
+	uint32 nHistograms[8][256];
+	MemoryManager::Set(nHistograms, 0, sizeof(nHistograms));
+	for (uint32 i=0; i<nNumOfItems; i++) {
+		const uint64 nSortKey = pItems[i].nSortKey;
+		pSource[i].nSortKey = nSortKey;
+		pSource[i].nIndex   = i;
+		for (uint32 nByte=0; nByte<8; nByte++)
+			nHistograms[nByte][(nSortKey >> (nByte*8)) & 0xFF]++;
+	}
+
+	// Radix sort, least significant byte first
+	for (uint32 nByte=0; nByte<8; nByte++) {
+		uint32 *pnHistogram = nHistograms[nByte];
+
+		// Skip this byte if it's identical for all items (for example the pass or unused texture bits)
+		if (pnHistogram[(pSource[0].nSortKey >> (nByte*8)) & 0xFF] == nNumOfItems)
+			continue;
+
+		// Turn the histogram into offsets
+		uint32 nOffset = 0;
+		for (uint32 nBucket=0; nBucket<256; nBucket++) {
+			const uint32 nCount = pnHistogram[nBucket];
+			pnHistogram[nBucket] = nOffset;
+			nOffset += nCount;
+		}
+
+		// Scatter, this is stable so the order of the previous passes is kept
+		for (uint32 i=0; i<nNumOfItems; i++)
+			pTarget[pnHistogram[(pSource[i].nSortKey >> (nByte*8)) & 0xFF]++] = pSource[i];
+
+		// Swap source and target
+		SortEntry *pTemp = pSource;
+		pSource = pTarget;
+		pTarget = pTemp;
+	}
+
+	// Ensure the sorted entries are within "m_lstSorted"
+	if (pSource != m_lstSorted.GetData())
+		MemoryManager::Copy(m_lstSorted.GetData(), pSource, sizeof(SortEntry)*nNumOfItems);
+}
+
+/**
+*  @brief
+*    Returns an item in sorted order
+*/
+const DrawList::Item &DrawList::GetSortedItem(uint32 nIndex) const
+{
+	return m_lstItems.GetData()[m_lstSorted.GetData()[nIndex].nIndex];
+}
+
+
+//[-------------------------------------------------------]
+//[ Private functions                                     ]
+//[-------------------------------------------------------]
+/**
+*  @brief
+*    Copy constructor
+*/
+DrawList::DrawList(const DrawList &cSource)
+{
+	// No implementation because the copy constructor is never used
+}
+
+/**
+*  @brief
+*    Copy operator
+*/
+DrawList &DrawList::operator =(const DrawList &cSource)
+{
+	// No implementation because the copy operator is never used
+	return *this;
+}
+
+/**
+*  @brief
+*    Gathers the visible mesh geometries of a cull query, recursive part
+*/
+void DrawList::CollectRec(const SQCull &cCullQuery, uint32 nFlags)
+{
+	// Get scene container
+	const VisContainer &cVisContainer = cCullQuery.GetVisContainer();
+
+	// Loop through all visible scene nodes of this scene container
+	Iterator<VisNode*> cIterator = cVisContainer.GetVisNodes().GetIterator();
+	while (cIterator.HasNext()) {
+		// Get visibility node and scene node
+		const VisNode   *pVisNode   = cIterator.Next();
+			  SceneNode *pSceneNode = pVisNode->GetSceneNode();
+		if (pSceneNode) {
+			// Is this scene node a portal?
+			if (pVisNode->IsPortal()) {
+				// Get the target cell visibility container
+				const VisContainer *pVisCell = static_cast<const VisPortal*>(pVisNode)->GetTargetVisContainer();
+				if (pVisCell && pVisCell->GetCullQuery())
+					CollectRec(*pVisCell->GetCullQuery(), nFlags);
+
+			// Is this scene node a container? We do not need to check for cells because we will
+			// NEVER receive cells from SQCull directly, they are ONLY visible through portals! (see above)
+			} else if (pVisNode->IsContainer()) {
+				// Collect this container without special processing
+				if (static_cast<const VisContainer*>(pVisNode)->GetCullQuery())
+					CollectRec(*static_cast<const VisContainer*>(pVisNode)->GetCullQuery(), nFlags);
+
+			// This must just be a quite boring scene node :)
+			} else {
+				const MeshHandler *pMeshHandler = pSceneNode->GetMeshHandler();
+				if (pMeshHandler && pMeshHandler->GetNumOfMaterials()) {
+					// Get the used mesh
+					const Mesh *pMesh = pMeshHandler->GetResource();
+					if (pMesh) {
+						// Get the mesh LOD level to use
+						const MeshLODLevel *pLODLevel = pMesh->GetLODLevel(0);
+						if (pLODLevel && pLODLevel->GetIndexBuffer()) {
+							// Get the vertex buffer which needs at least a position attribute
+							VertexBuffer *pVertexBuffer = pMeshHandler->GetVertexBuffer();
+							if (pVertexBuffer && pVertexBuffer->GetVertexAttribute(VertexBuffer::Position)) {
+								// Loop through all mesh geometries
+								const float fDepth = pVisNode->GetSquaredDistanceToCamera();
+								const Array<Geometry> &lstGeometries = *pLODLevel->GetGeometries();
+								for (uint32 nGeo=0; nGeo<lstGeometries.GetNumOfElements(); nGeo++) {
+									// Is this geometry active?
+									const Geometry &cGeometry = lstGeometries[nGeo];
+									if (cGeometry.IsActive()) {
+										// Get the material the mesh geometry is using
+										Material *pMaterial = pMeshHandler->GetMaterial(cGeometry.GetMaterial());
+										if (pMaterial) {
+											// Transparent material?
+											static const String sOpacity = "Opacity";
+											const Parameter *pParameter = pMaterial->GetParameter(sOpacity);
+											const bool bTransparent = (pParameter && pParameter->GetValue1f() < 1.0f);
+											if (nFlags & (bTransparent ? CollectTransparent : CollectOpaque)) {
+												// Add and fill the item
+												Item &cItem = AddItem();
+												cItem.fDepth		= fDepth;
+												cItem.pCullQuery	= &cCullQuery;
+												cItem.pVisNode		= pVisNode;
+												cItem.pSceneNode	= pSceneNode;
+												cItem.pMeshHandler	= pMeshHandler;
+												cItem.pMaterial		= pMaterial;
+												cItem.pVertexBuffer	= pVertexBuffer;
+												cItem.pIndexBuffer	= pLODLevel->GetIndexBuffer();
+												cItem.pGeometry		= &cGeometry;
+											}
+										}
+									}
+								}
+							}
+						}
+					}
+				}
+			}
+		}
+	}
+}
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+} // PLCompositing
@@ -184,6 +184,15 @@ const VisNode *SRPDirectionalLighting::GetFirstDirectionalLight(const SQCull &cC
 }
 
 
+//[-------------------------------------------------------]
+//[ Protected virtual SRPDirectionalLighting functions    ]
+//[-------------------------------------------------------]
+void SRPDirectionalLighting::DrawMesh(Renderer &cRenderer, const SQCull &cCullQuery, const VisNode &cVisNode, SceneNode &cSceneNode, const MeshHandler &cMeshHandler, const Mesh &cMesh, const MeshLODLevel &cMeshLODLevel, VertexBuffer &cVertexBuffer)
+{
+	// The default implementation is empty
+}
+
+
 //[-------------------------------------------------------]
 //[ Private functions                                     ]
 //[-------------------------------------------------------]
@@ -37,13 +37,10 @@
 #include <PLRenderer/Effect/EffectManager.h>
 #include <PLRenderer/Material/Parameter.h>
 #include <PLRenderer/Material/MaterialManager.h>
-#include <PLMesh/Mesh.h>
-#include <PLMesh/MeshHandler.h>
-#include <PLMesh/MeshLODLevel.h>
+#include <PLMesh/Geometry.h>
 #include <PLScene/Scene/SNCamera.h>
 #include <PLScene/Scene/SceneNodeModifier.h>
 #include <PLScene/Visibility/SQCull.h>
-#include <PLScene/Visibility/VisPortal.h>
 #include <PLScene/Visibility/VisContainer.h>
 #include "PLCompositing/SRPBegin.h"
 #include "PLCompositing/FullscreenQuad.h"
@@ -122,20 +119,6 @@ SRPDeferredGBuffer::~SRPDeferredGBuffer()
 	// Destroy the program generator
 	if (m_pProgramGenerator)
 		delete m_pProgramGenerator;
-
-	// Destroy all mesh batches
-	{ // Currently free ones
-		Iterator<MeshBatch*> cIterator = m_lstFreeMeshBatches.GetIterator();
-		while (cIterator.HasNext())
-			delete cIterator.Next();
-		m_lstFreeMeshBatches.Clear();
-	}
-	{ // Currently used ones
-		Iterator<MeshBatch*> cIterator = m_lstMeshBatches.GetIterator();
-		while (cIterator.HasNext())
-			delete cIterator.Next();
-		m_lstMeshBatches.Clear();
-	}
 }
 
 /**
@@ -201,195 +184,151 @@ FullscreenQuad *SRPDeferredGBuffer::GetFullscreenQuad() const
 //[-------------------------------------------------------]
 /**
 *  @brief
-*    Collect mesh batches recursive
+*    Returns the cached SRPDeferredGBuffer-material of a material
 */
-void SRPDeferredGBuffer::CollectMeshBatchesRec(const SQCull &cCullQuery)
+SRPDeferredGBufferMaterial &SRPDeferredGBuffer::GetCachedMaterial(Material &cMaterial)
 {
-	// Get scene container
-	const VisContainer &cVisContainer = cCullQuery.GetVisContainer();
-
-	// Loop through all visible scene nodes of this scene container
-	Iterator<VisNode*> cIterator = cVisContainer.GetVisNodes().GetIterator();
-	while (cIterator.HasNext()) {
-		// Get visibility node and scene node
-		const VisNode   *pVisNode   = cIterator.Next();
-			  SceneNode *pSceneNode = pVisNode->GetSceneNode();
-		if (pSceneNode) {
-			// Is this scene node a portal?
-			if (pVisNode->IsPortal()) {
-				// Get the target cell visibility container
-				const VisContainer *pVisCell = static_cast<const VisPortal*>(pVisNode)->GetTargetVisContainer();
-				if (pVisCell && pVisCell->GetCullQuery())
-					CollectMeshBatchesRec(*pVisCell->GetCullQuery());
-
-			// Is this scene node a container? We do not need to check for cells because we will
-			// NEVER receive cells from SQCull directly, they are ONLY visible through portals! (see above)
-			} else if (pVisNode->IsContainer()) {
-				// Collect this container without special processing
-				if (static_cast<const VisContainer*>(pVisNode)->GetCullQuery())
-					CollectMeshBatchesRec(*static_cast<const VisContainer*>(pVisNode)->GetCullQuery());
-
-			// This must just be a quite boring scene node :)
-			} else {
-				// Here we draw the stuff by hand in order to minimize state changes and other overhead
-				const MeshHandler *pMeshHandler = pSceneNode->GetMeshHandler();
-				if (pMeshHandler && pMeshHandler->GetVertexBuffer() && pMeshHandler->GetNumOfMaterials()) {
-					// Get the used mesh
-					const Mesh *pMesh = pMeshHandler->GetResource();
-					if (pMesh) {
-						// Get the mesh LOD level to use
-						const MeshLODLevel *pLODLevel = pMesh->GetLODLevel(0);
-						if (pLODLevel && pLODLevel->GetIndexBuffer() && pMeshHandler->GetVertexBuffer()) {
-							// Loop through all mesh geometries
-							const Array<Geometry> &lstGeometries = *pLODLevel->GetGeometries();
-							for (uint32 nGeo=0; nGeo<lstGeometries.GetNumOfElements(); nGeo++) {
-								// Is this geometry active and is it using the current used mesh material?
-								const Geometry &cGeometry = lstGeometries[nGeo];
-								if (cGeometry.IsActive()) {
-									// Get the material the mesh geometry is using
-									Material *pMaterial = pMeshHandler->GetMaterial(cGeometry.GetMaterial());
-									if (pMaterial) {
-										// Transparent material?
-										static const String sOpacity = "Opacity";
-										const Parameter *pParameter = pMaterial->GetParameter(sOpacity);
-										if (!pParameter || pParameter->GetValue1f() >= 1.0f) {
-											// Get a free mesh batch
-											MeshBatch &cMeshBatch = GetFreeMeshBatch();
-											m_lstMeshBatches.Add(&cMeshBatch);
-
-											// Fill the mesh batch
-											cMeshBatch.pMaterial			= pMaterial;
-											cMeshBatch.pVertexBuffer		= pMeshHandler->GetVertexBuffer();
-											cMeshBatch.pIndexBuffer			= pLODLevel->GetIndexBuffer();
-											cMeshBatch.pCullQuery			= &cCullQuery;
-											cMeshBatch.pGeometry			= &cGeometry;
-											cMeshBatch.pVisNode				= pVisNode;
-											cMeshBatch.sScissorRectangle	= cVisContainer.GetProjection().cRectangle;
-
-											// Add material
-											if (!m_lstMaterials.IsElement(pMaterial))
-												m_lstMaterials.Add(pMaterial);
-										}
-									}
-								}
-							}
-						}
-					}
-				}
-			}
-		}
+	// SRPDeferredGBuffer-material caching
+	SRPDeferredGBufferMaterial *pSRPDeferredGBufferMaterial = m_lstMaterialCache.Get(reinterpret_cast<uint64>(&cMaterial));
+	if (!pSRPDeferredGBufferMaterial) {
+		// The material is not yet cached
+		pSRPDeferredGBufferMaterial = new SRPDeferredGBufferMaterial(cMaterial, *m_pProgramGenerator);
+		m_lstMaterialCache.Add(reinterpret_cast<uint64>(&cMaterial), pSRPDeferredGBufferMaterial);
 	}
+	return *pSRPDeferredGBufferMaterial;
 }
 
 /**
 *  @brief
-*    Draws a mesh batch
+*    Draws the gathered and sorted draw list items
 */
-void SRPDeferredGBuffer::DrawMeshBatch(Renderer &cRenderer, SRPDeferredGBufferMaterial::GeneratedProgramUserData &cGeneratedProgramUserData, MeshBatch &cMeshBatch) const
+void SRPDeferredGBuffer::DrawSortedItems(Renderer &cRenderer)
 {
-	// Get the mesh batch vertex buffer
-	VertexBuffer *pVertexBuffer = cMeshBatch.pVertexBuffer;
+	// Currently set states, used to skip redundant state changes
+	const SQCull		*pCurrentCullQuery	  = nullptr;
+	Material			*pCurrentMaterial	  = nullptr;
+	const VertexBuffer	*pCurrentVertexBuffer = nullptr;
+	const VisNode		*pCurrentVisNode	  = nullptr;
+	IndexBuffer			*pCurrentIndexBuffer  = nullptr;
+	SRPDeferredGBufferMaterial::GeneratedProgramUserData *pGeneratedProgramUserData = nullptr;
+	SRPDeferredGBufferMaterial::GeneratedProgramUserData *pCurrentProgramUserData   = nullptr;
+
+	// Loop through all items in sorted order
+	for (uint32 i=0; i<m_cDrawList.GetNumOfItems(); i++) {
+		const DrawList::Item &cItem = m_cDrawList.GetSortedItem(i);
+
+		// Set the scissor rectangle of the visibility container the item is in
+		if (pCurrentCullQuery != cItem.pCullQuery) {
+			pCurrentCullQuery = cItem.pCullQuery;
+			cRenderer.SetScissorRect(&pCurrentCullQuery->GetVisContainer().GetProjection().cRectangle);
+		}
 
-	{ // Set per mesh batch program parameters
-		// Set program vertex attributes, this creates a connection between "Vertex Buffer Attribute" and "Vertex Shader Attribute"
-		if (cGeneratedProgramUserData.pVertexPosition)
-			cGeneratedProgramUserData.pVertexPosition->Set(pVertexBuffer, PLRenderer::VertexBuffer::Position);
-		if (cGeneratedProgramUserData.pVertexTexCoord0)
-			cGeneratedProgramUserData.pVertexTexCoord0->Set(pVertexBuffer, PLRenderer::VertexBuffer::TexCoord);
-		if (cGeneratedProgramUserData.pVertexTexCoord1)
-			cGeneratedProgramUserData.pVertexTexCoord1->Set(pVertexBuffer, PLRenderer::VertexBuffer::TexCoord, 1);
-		if (cGeneratedProgramUserData.pVertexNormal)
-			cGeneratedProgramUserData.pVertexNormal->Set(pVertexBuffer, PLRenderer::VertexBuffer::Normal);
-		if (cGeneratedProgramUserData.pVertexTangent)
-			cGeneratedProgramUserData.pVertexTangent->Set(pVertexBuffer, PLRenderer::VertexBuffer::Tangent);
-		if (cGeneratedProgramUserData.pVertexBinormal)
-			cGeneratedProgramUserData.pVertexBinormal->Set(pVertexBuffer, PLRenderer::VertexBuffer::Binormal);
-
-		// Get the mesh batch visibility node
-		const VisNode *pVisNode = cMeshBatch.pVisNode;
+		// Make the material to the currently used one - the program, textures and material uniforms are only set if the material changes
+		if (pCurrentMaterial != cItem.pMaterial) {
+			pCurrentMaterial = cItem.pMaterial;
+			pGeneratedProgramUserData = GetCachedMaterial(*cItem.pMaterial).MakeMaterialCurrent(GetFlags(), TextureFiltering, m_bColorTarget3Used, m_bColorTarget3AlphaUsed);
+
+			// Set the uniforms which are identical for all items using the same program
+			if (pGeneratedProgramUserData && pCurrentProgramUserData != pGeneratedProgramUserData) {
+				pCurrentProgramUserData = pGeneratedProgramUserData;
+
+				// Vertex attributes and per visibility node uniforms have to be set for the new program
+				pCurrentVertexBuffer = nullptr;
+				pCurrentVisNode		 = nullptr;
+
+				// Set the "ViewSpaceToWorldSpace" fragment shader parameter
+				if (pGeneratedProgramUserData->pViewSpaceToWorldSpace) {
+					// [TODO] Add *SNCamera::GetInvViewMatrix()?
+					Matrix3x3 mRot;
+					if (SNCamera::GetCamera())
+						mRot = SNCamera::GetCamera()->GetViewMatrix().GetInverted();
+					else
+						mRot = Matrix3x3::Identity;
+					pGeneratedProgramUserData->pViewSpaceToWorldSpace->Set(mRot);
+				}
+			}
+		}
+		if (!pGeneratedProgramUserData)
+			continue;
 
-		// Two sided lighting?
-		if (cGeneratedProgramUserData.pNormalScale)
-			cGeneratedProgramUserData.pNormalScale->Set(1.0f);
-
-		// Set world view projection matrix
-		if (cGeneratedProgramUserData.pWorldVP)
-			cGeneratedProgramUserData.pWorldVP->Set(pVisNode->GetWorldViewProjectionMatrix());
-
-		// Set world view matrix
-		if (cGeneratedProgramUserData.pWorldV)
-			cGeneratedProgramUserData.pWorldV->Set(pVisNode->GetWorldViewMatrix());
-
-		// Set object space eye position
-		if (cGeneratedProgramUserData.pEyePos)
-			cGeneratedProgramUserData.pEyePos->Set(pVisNode->GetInverseWorldMatrix()*(cMeshBatch.pCullQuery->GetVisContainer().GetWorldMatrix()*cMeshBatch.pCullQuery->GetCameraPosition()));
-
-		// Set the "ViewSpaceToWorldSpace" fragment shader parameter
-		if (cGeneratedProgramUserData.pViewSpaceToWorldSpace) {
-			// [TODO] Add *SNCamera::GetInvViewMatrix()?
-			Matrix3x3 mRot;
-			if (SNCamera::GetCamera())
-				mRot = SNCamera::GetCamera()->GetViewMatrix().GetInverted();
-			else
-				mRot = Matrix3x3::Identity;
-			cGeneratedProgramUserData.pViewSpaceToWorldSpace->Set(mRot);
+		// Set program vertex attributes, this creates a connection between "Vertex Buffer Attribute" and "Vertex Shader Attribute"
+		VertexBuffer *pVertexBuffer = cItem.pVertexBuffer;
+		if (pCurrentVertexBuffer != pVertexBuffer) {
+			pCurrentVertexBuffer = pVertexBuffer;
+			if (pGeneratedProgramUserData->pVertexPosition)
+				pGeneratedProgramUserData->pVertexPosition->Set(pVertexBuffer, PLRenderer::VertexBuffer::Position);
+			if (pGeneratedProgramUserData->pVertexTexCoord0)
+				pGeneratedProgramUserData->pVertexTexCoord0->Set(pVertexBuffer, PLRenderer::VertexBuffer::TexCoord);
+			if (pGeneratedProgramUserData->pVertexTexCoord1)
+				pGeneratedProgramUserData->pVertexTexCoord1->Set(pVertexBuffer, PLRenderer::VertexBuffer::TexCoord, 1);
+			if (pGeneratedProgramUserData->pVertexNormal)
+				pGeneratedProgramUserData->pVertexNormal->Set(pVertexBuffer, PLRenderer::VertexBuffer::Normal);
+			if (pGeneratedProgramUserData->pVertexTangent)
+				pGeneratedProgramUserData->pVertexTangent->Set(pVertexBuffer, PLRenderer::VertexBuffer::Tangent);
+			if (pGeneratedProgramUserData->pVertexBinormal)
+				pGeneratedProgramUserData->pVertexBinormal->Set(pVertexBuffer, PLRenderer::VertexBuffer::Binormal);
 		}
-	}
 
-	// Bind index buffer
-	cRenderer.SetIndexBuffer(cMeshBatch.pIndexBuffer);
+		// Set the per visibility node uniforms
+		const VisNode &cVisNode = *cItem.pVisNode;
+		if (pCurrentVisNode != &cVisNode) {
+			pCurrentVisNode = &cVisNode;
 
-	// Set the new scissor rectangle
-	cRenderer.SetScissorRect(&cMeshBatch.sScissorRectangle);
+			// Set world view projection matrix
+			if (pGeneratedProgramUserData->pWorldVP)
+				pGeneratedProgramUserData->pWorldVP->Set(cVisNode.GetWorldViewProjectionMatrix());
 
-	// Get the mesh patch geometry
-	const Geometry *pGeometry = cMeshBatch.pGeometry;
+			// Set world view matrix
+			if (pGeneratedProgramUserData->pWorldV)
+				pGeneratedProgramUserData->pWorldV->Set(cVisNode.GetWorldViewMatrix());
 
-	// Draw the geometry
-	cRenderer.DrawIndexedPrimitives(
-		pGeometry->GetPrimitiveType(),
-		0,
-		pVertexBuffer->GetNumOfElements()-1,
-		pGeometry->GetStartIndex(),
-		pGeometry->GetIndexSize()
-	);
+			// Set object space eye position
+			if (pGeneratedProgramUserData->pEyePos)
+				pGeneratedProgramUserData->pEyePos->Set(cVisNode.GetInverseWorldMatrix()*(cItem.pCullQuery->GetVisContainer().GetWorldMatrix()*cItem.pCullQuery->GetCameraPosition()));
+		}
 
-	// If this is a two sided material, draw the primitives again - but with
-	// flipped culling mode and vertex normals
-	if (cGeneratedProgramUserData.pNormalScale) {
-		// Flip normals
-		cGeneratedProgramUserData.pNormalScale->Set(-1.0f);
+		// Bind index buffer
+		if (pCurrentIndexBuffer != cItem.pIndexBuffer) {
+			pCurrentIndexBuffer = cItem.pIndexBuffer;
+			cRenderer.SetIndexBuffer(pCurrentIndexBuffer);
+		}
 
-		// Flip the backface culling
-		const uint32 nCullModeBackup = cRenderer.GetRenderState(RenderState::CullMode);
-		cRenderer.SetRenderState(RenderState::CullMode, Cull::CW);
+		// Two sided lighting?
+		if (pGeneratedProgramUserData->pNormalScale)
+			pGeneratedProgramUserData->pNormalScale->Set(1.0f);
 
-		// Draw geometry - again
+		// Draw the geometry
+		const Geometry &cGeometry = *cItem.pGeometry;
 		cRenderer.DrawIndexedPrimitives(
-			pGeometry->GetPrimitiveType(),
+			cGeometry.GetPrimitiveType(),
 			0,
 			pVertexBuffer->GetNumOfElements()-1,
-			pGeometry->GetStartIndex(),
-			pGeometry->GetIndexSize()
+			cGeometry.GetStartIndex(),
+			cGeometry.GetIndexSize()
 		);
 
-		// Restore the previous cull mode
-		cRenderer.SetRenderState(RenderState::CullMode, nCullModeBackup);
-	}
-}
-
-/**
-*  @brief
-*    Returns a free mesh batch
-*/
-SRPDeferredGBuffer::MeshBatch &SRPDeferredGBuffer::GetFreeMeshBatch()
-{
-	if (m_lstFreeMeshBatches.IsEmpty())
-		return *(new MeshBatch);
-	else {
-		MeshBatch *pMeshBatch = m_lstFreeMeshBatches.Get(0);
-		m_lstFreeMeshBatches.RemoveAtIndex(0);
-		return *pMeshBatch;
+		// If this is a two sided material, draw the primitives again - but with
+		// flipped culling mode and vertex normals
+		if (pGeneratedProgramUserData->pNormalScale) {
+			// Flip normals
+			pGeneratedProgramUserData->pNormalScale->Set(-1.0f);
+
+			// Flip the backface culling
+			const uint32 nCullModeBackup = cRenderer.GetRenderState(RenderState::CullMode);
+			cRenderer.SetRenderState(RenderState::CullMode, Cull::CW);
+
+			// Draw geometry - again
+			cRenderer.DrawIndexedPrimitives(
+				cGeometry.GetPrimitiveType(),
+				0,
+				pVertexBuffer->GetNumOfElements()-1,
+				cGeometry.GetStartIndex(),
+				cGeometry.GetIndexSize()
+			);
+
+			// Restore the previous cull mode
+			cRenderer.SetRenderState(RenderState::CullMode, nCullModeBackup);
+		}
 	}
 }
 
@@ -528,48 +467,21 @@ void SRPDeferredGBuffer::Draw(Renderer &cRenderer, const SQCull &cCullQuery)
 			m_bColorTarget3Used			= false;
 			m_bColorTarget3AlphaUsed	= false;
 
-			// Collect recursive
-			CollectMeshBatchesRec(cCullQuery);
-
-			{ // Loop through all currently used materials
-				Iterator<Material*> cMaterialIterator = m_lstMaterials.GetIterator();
-				while (cMaterialIterator.HasNext()) {
-					// Get the current material
-					Material *pMaterial = cMaterialIterator.Next();
-
-					// SRPDeferredGBuffer-material caching
-					SRPDeferredGBufferMaterial *pSRPDeferredGBufferMaterial = m_lstMaterialCache.Get(reinterpret_cast<uint64>(pMaterial));
-					if (!pSRPDeferredGBufferMaterial) {
-						// The material is not yet cached
-						pSRPDeferredGBufferMaterial = new SRPDeferredGBufferMaterial(*pMaterial, *m_pProgramGenerator);
-						m_lstMaterialCache.Add(reinterpret_cast<uint64>(pMaterial), pSRPDeferredGBufferMaterial);
-					}
-
-					// Make the material to the currently used one
-					SRPDeferredGBufferMaterial::GeneratedProgramUserData *pGeneratedProgramUserData = pSRPDeferredGBufferMaterial->MakeMaterialCurrent(GetFlags(), TextureFiltering, m_bColorTarget3Used, m_bColorTarget3AlphaUsed);
-					if (pGeneratedProgramUserData) {
-						// Draw all mesh batches using this material
-						Iterator<MeshBatch*> cMeshBatchIterator = m_lstMeshBatches.GetIterator();
-						while (cMeshBatchIterator.HasNext()) {
-							// Get the current mesh batch
-							MeshBatch *pMeshBatch = cMeshBatchIterator.Next();
-
-							// Same material?
-							if (pMeshBatch->pMaterial == pMaterial) {
-								// Draw the mesh batch
-								DrawMeshBatch(cRenderer, *pGeneratedProgramUserData, *pMeshBatch);
-							}
-						}
-					}
-				}
-				{ // Free the mesh batches
-					Iterator<MeshBatch*> cMeshBatchIterator = m_lstMeshBatches.GetIterator();
-					while (cMeshBatchIterator.HasNext())
-						m_lstFreeMeshBatches.Add(cMeshBatchIterator.Next());
-					m_lstMeshBatches.Clear();
-				}
-				m_lstMaterials.Clear();
+			// Gather the visible opaque geometries
+			m_cDrawList.Clear();
+			m_cDrawList.Collect(cCullQuery, DrawList::CollectOpaque);
+
+			// Setup the sort keys: Order by program, material and texture, front to back within identical states
+			for (uint32 i=0; i<m_cDrawList.GetNumOfItems(); i++) {
+				DrawList::Item &cItem = m_cDrawList.GetItem(i);
+				SRPDeferredGBufferMaterial &cSRPDeferredGBufferMaterial = GetCachedMaterial(*cItem.pMaterial);
+				const ProgramGenerator::GeneratedProgram *pGeneratedProgram = cSRPDeferredGBufferMaterial.GetGeneratedProgram(GetFlags());
+				cItem.nSortKey = DrawList::GetStateSortKey(0, pGeneratedProgram, cItem.pMaterial, cSRPDeferredGBufferMaterial.GetDiffuseMapTextureBuffer(), cItem.fDepth);
 			}
+			m_cDrawList.Sort();
+
+			// Draw the sorted geometries
+			DrawSortedItems(cRenderer);
 
 			// Restore the color mask
 			cRenderer.SetColorMask(bRed, bGreen, bBlue, bAlpha);
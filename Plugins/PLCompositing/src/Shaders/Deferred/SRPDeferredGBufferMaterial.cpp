@@ -194,12 +194,8 @@ SRPDeferredGBufferMaterial::GeneratedProgramUserData *SRPDeferredGBufferMaterial
 	// Get the used renderer
 	Renderer &cRenderer = m_pProgramGenerator->GetRenderer();
 
-	// Synchronize this material cache with the owner
-	if (m_nRendererFlags != nRendererFlags || !m_bSynchronized)
-		Synchronize(nRendererFlags);
-
-	// Get a program instance from the program generator using the given program flags
-	ProgramGenerator::GeneratedProgram *pGeneratedProgram = m_pProgramGenerator->GetProgram(m_cProgramFlags);
+	// Get the program instance to use
+	ProgramGenerator::GeneratedProgram *pGeneratedProgram = GetGeneratedProgram(nRendererFlags);
 
 	// Make our program to the current one
 	GeneratedProgramUserData *pGeneratedProgramUserData = nullptr;
@@ -478,6 +474,29 @@ SRPDeferredGBufferMaterial::GeneratedProgramUserData *SRPDeferredGBufferMaterial
 	return pGeneratedProgramUserData;
 }
 
+/**
+*  @brief
+*    Returns the generated program this material is using
+*/
+ProgramGenerator::GeneratedProgram *SRPDeferredGBufferMaterial::GetGeneratedProgram(uint32 nRendererFlags)
+{
+	// Synchronize this material cache with the owner
+	if (m_nRendererFlags != nRendererFlags || !m_bSynchronized)
+		Synchronize(nRendererFlags);
+
+	// Get a program instance from the program generator using the given program flags
+	return m_pProgramGenerator->GetProgram(m_cProgramFlags);
+}
+
+/**
+*  @brief
+*    Returns the texture buffer of the diffuse map
+*/
+TextureBuffer *SRPDeferredGBufferMaterial::GetDiffuseMapTextureBuffer() const
+{
+	return m_pDiffuseMap ? m_pDiffuseMap->GetValueTextureBuffer() : nullptr;
+}
+
 
 //[-------------------------------------------------------]
 //[ Private functions                                     ]
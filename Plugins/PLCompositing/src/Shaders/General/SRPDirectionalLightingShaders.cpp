@@ -27,6 +27,7 @@
 //[-------------------------------------------------------]
 #include <PLMath/Matrix3x3.h>
 #include <PLRenderer/RendererContext.h>
+#include <PLRenderer/Renderer/IndexBuffer.h>
 #include <PLRenderer/Renderer/VertexBuffer.h>
 #include <PLRenderer/Renderer/RenderStates.h>
 #include <PLRenderer/Renderer/Shader.h>
@@ -36,8 +37,7 @@
 #include <PLRenderer/Effect/EffectManager.h>
 #include <PLRenderer/Material/Parameter.h>
 #include <PLRenderer/Material/MaterialManager.h>
-#include <PLMesh/MeshHandler.h>
-#include <PLMesh/MeshLODLevel.h>
+#include <PLMesh/Geometry.h>
 #include <PLScene/Scene/SNLight.h>
 #include <PLScene/Scene/SNCamera.h>
 #include <PLScene/Scene/SceneNodeModifier.h>
@@ -136,22 +136,28 @@ void SRPDirectionalLightingShaders::OnMaterialRemoved(Material &cMaterial)
 	}
 }
 
-
-//[-------------------------------------------------------]
-//[ Private virtual SRPDirectionalLighting functions      ]
-//[-------------------------------------------------------]
-void SRPDirectionalLightingShaders::DrawMesh(Renderer &cRenderer, const SQCull &cCullQuery, const VisNode &cVisNode, SceneNode &cSceneNode, const MeshHandler &cMeshHandler, const Mesh &cMesh, const MeshLODLevel &cMeshLODLevel, VertexBuffer &cVertexBuffer)
+/**
+*  @brief
+*    Returns the cached SRPDirectionalLightingShaders-material of a material
+*/
+SRPDirectionalLightingShadersMaterial &SRPDirectionalLightingShaders::GetCachedMaterial(Material &cMaterial)
 {
-	// Get scene container
-	const VisContainer &cVisContainer = cCullQuery.GetVisContainer();
-
-	// Get buffers
-		  IndexBuffer     *pIndexBuffer  = cMeshLODLevel.GetIndexBuffer();
-	const Array<Geometry> &lstGeometries = *cMeshLODLevel.GetGeometries();
-
-	// Bind buffers
-	cRenderer.SetIndexBuffer(pIndexBuffer);
+	// SRPDirectionalLightingShaders-material caching
+	SRPDirectionalLightingShadersMaterial *pSRPDirectionalLightingShadersMaterial = m_lstMaterialCache.Get(reinterpret_cast<uint64>(&cMaterial));
+	if (!pSRPDirectionalLightingShadersMaterial) {
+		// The material is not yet cached
+		pSRPDirectionalLightingShadersMaterial = new SRPDirectionalLightingShadersMaterial(*m_pRenderStates, cMaterial, *m_pProgramGenerator);
+		m_lstMaterialCache.Add(reinterpret_cast<uint64>(&cMaterial), pSRPDirectionalLightingShadersMaterial);
+	}
+	return *pSRPDirectionalLightingShadersMaterial;
+}
 
+/**
+*  @brief
+*    Returns the environment flags to use for a mesh
+*/
+uint32 SRPDirectionalLightingShaders::GetEnvironmentFlags(const SceneNode &cSceneNode, const VertexBuffer &cVertexBuffer) const
+{
 	// Is lighting enabled for this scene node?
 	const bool bLightingEnabled = !(cSceneNode.GetFlags() & SceneNode::NoLighting) && (m_cLightColor != Color3::Black);
 
@@ -160,13 +166,13 @@ void SRPDirectionalLightingShaders::DrawMesh(Renderer &cRenderer, const SQCull &
 	const bool bHasVertexTexCoord0 = (cVertexBuffer.GetVertexAttribute(VertexBuffer::TexCoord, 0) != nullptr);	// e.g. for diffuse maps
 	const bool bHasVertexTexCoord1 = (cVertexBuffer.GetVertexAttribute(VertexBuffer::TexCoord, 1) != nullptr);	// e.g. for light maps
 	const bool bHasVertexNormal    = (cVertexBuffer.GetVertexAttribute(VertexBuffer::Normal) != nullptr);
-		  bool bHasVertexTangent   = bHasVertexNormal && (cVertexBuffer.GetVertexAttribute(VertexBuffer::Tangent) != nullptr);
+	const bool bHasVertexTangent   = bHasVertexNormal && (cVertexBuffer.GetVertexAttribute(VertexBuffer::Tangent) != nullptr);
 	const bool bHasVertexBinormal  = bHasVertexTangent && (cVertexBuffer.GetVertexAttribute(VertexBuffer::Binormal) != nullptr);
 
 	// For better readability, define whether or not normal mapping is possible with the given vertex data
 	const bool bNormalMappingPossible = bHasVertexBinormal;	// We don't need to check for all three vectors in here :D
 
-	// [TODO] Cleanup
+	// Get the environment flags
 	uint32 nEnvironmentFlags = 0;
 	if (bHasVertexNormal)
 		nEnvironmentFlags |= SRPDirectionalLightingShadersMaterial::EnvironmentVertexNormal;
@@ -183,120 +189,164 @@ void SRPDirectionalLightingShaders::DrawMesh(Renderer &cRenderer, const SQCull &
 	if (m_fDOFBlurrinessCutoff)
 		nEnvironmentFlags |= SRPDirectionalLightingShadersMaterial::EnvironmentDOFEnabled;
 
-	// Draw mesh
-	for (uint32 nMat=0; nMat<cMeshHandler.GetNumOfMaterials(); nMat++) {
-		// Get mesh material
-		Material *pMaterial = cMeshHandler.GetMaterial(nMat);
-		if (pMaterial) {
-			// Draw geometries
-			for (uint32 nGeo=0; nGeo<lstGeometries.GetNumOfElements(); nGeo++) {
-				// Is this geometry active and is it using the current used mesh material?
-				const Geometry &cGeometry = lstGeometries[nGeo];
-				if (cGeometry.IsActive() && nMat == cGeometry.GetMaterial()) {
-					// Transparent material?
-					static const String sOpacity = "Opacity";
-					const Parameter *pParameter = pMaterial->GetParameter(sOpacity);
-					if ((GetFlags() & TransparentPass) ? (pParameter && pParameter->GetValue1f() < 1.0f) : (!pParameter || pParameter->GetValue1f() >= 1.0f)) {
-						// SRPDirectionalLightingShaders-material caching
-						SRPDirectionalLightingShadersMaterial *pSRPDirectionalLightingShadersMaterial = m_lstMaterialCache.Get(reinterpret_cast<uint64>(pMaterial));
-						if (!pSRPDirectionalLightingShadersMaterial) {
-							// The material is not yet cached
-							pSRPDirectionalLightingShadersMaterial = new SRPDirectionalLightingShadersMaterial(*m_pRenderStates, *pMaterial, *m_pProgramGenerator);
-							m_lstMaterialCache.Add(reinterpret_cast<uint64>(pMaterial), pSRPDirectionalLightingShadersMaterial);
-						}
-
-						// [TODO] Correct texture filter
-						SRPDirectionalLightingShadersMaterial::GeneratedProgramUserData *pGeneratedProgramUserData = pSRPDirectionalLightingShadersMaterial->MakeMaterialCurrent(GetFlags(), nEnvironmentFlags, SRPDirectionalLightingShadersMaterial::Anisotropic2);
-						if (pGeneratedProgramUserData) {
-							// Ambient color
-							if (pGeneratedProgramUserData->pAmbientColor)
-								pGeneratedProgramUserData->pAmbientColor->Set(AmbientColor.Get());
-
-							// Set the "ViewSpaceToWorldSpace" fragment shader parameter
-							if (pGeneratedProgramUserData->pViewSpaceToWorldSpace) {
-								// [TODO] Add *SQCullQuery::GetInvViewMatrix()?
-								Matrix3x3 mRot = cCullQuery.GetViewMatrix().GetInverted();
-								pGeneratedProgramUserData->pViewSpaceToWorldSpace->Set(mRot);
-							}
-
-							if (bLightingEnabled) {
-								// Set view space light direction and light color
-								if (pGeneratedProgramUserData->pLightDirection)
-									pGeneratedProgramUserData->pLightDirection->Set(m_vLightDirection);
-								if (pGeneratedProgramUserData->pLightColor)
-									pGeneratedProgramUserData->pLightColor->Set(m_cLightColor);
-							}
-
-							// DOF
-							if (pGeneratedProgramUserData->pDOFParams)
-								pGeneratedProgramUserData->pDOFParams->Set(m_fDOFNearBlurDepth, m_fDOFFocalPlaneDepth, m_fDOFFarBlurDepth, m_fDOFBlurrinessCutoff);
-
-							// Set object space to clip space matrix uniform
-							if (pGeneratedProgramUserData->pObjectSpaceToClipSpaceMatrix)
-								pGeneratedProgramUserData->pObjectSpaceToClipSpaceMatrix->Set(cVisNode.GetWorldViewProjectionMatrix());
-
-							// Set object space to view space matrix uniform
-							if (pGeneratedProgramUserData->pObjectSpaceToViewSpaceMatrix)
-								pGeneratedProgramUserData->pObjectSpaceToViewSpaceMatrix->Set(cVisNode.GetWorldViewMatrix());
-
-							// Parallax mapping - set object space eye position
-							if (pGeneratedProgramUserData->pHeightMap && pGeneratedProgramUserData->pEyePos)
-								pGeneratedProgramUserData->pEyePos->Set(cVisNode.GetInverseWorldMatrix()*(cVisContainer.GetWorldMatrix()*cCullQuery.GetCameraPosition()));
-
-							// Set program vertex attributes, this creates a connection between "Vertex Buffer Attribute" and "Vertex Shader Attribute"
-							if (pGeneratedProgramUserData->pVertexPosition)
-								pGeneratedProgramUserData->pVertexPosition->Set(&cVertexBuffer, PLRenderer::VertexBuffer::Position);
-							if (pGeneratedProgramUserData->pVertexTexCoord0)
-								pGeneratedProgramUserData->pVertexTexCoord0->Set(&cVertexBuffer, PLRenderer::VertexBuffer::TexCoord, 0);
-							if (pGeneratedProgramUserData->pVertexTexCoord1)
-								pGeneratedProgramUserData->pVertexTexCoord1->Set(&cVertexBuffer, PLRenderer::VertexBuffer::TexCoord, 1);
-							if (pGeneratedProgramUserData->pVertexNormal)
-								pGeneratedProgramUserData->pVertexNormal->Set(&cVertexBuffer, PLRenderer::VertexBuffer::Normal);
-							if (pGeneratedProgramUserData->pVertexTangent)
-								pGeneratedProgramUserData->pVertexTangent->Set(&cVertexBuffer, PLRenderer::VertexBuffer::Tangent);
-							if (pGeneratedProgramUserData->pVertexBinormal)
-								pGeneratedProgramUserData->pVertexBinormal->Set(&cVertexBuffer, PLRenderer::VertexBuffer::Binormal);
-
-							// Two sided lighting?
-							if (pGeneratedProgramUserData->pNormalScale)
-								pGeneratedProgramUserData->pNormalScale->Set(1.0f);
-
-							// Draw the geometry
-							cRenderer.DrawIndexedPrimitives(
-								cGeometry.GetPrimitiveType(),
-								0,
-								cVertexBuffer.GetNumOfElements()-1,
-								cGeometry.GetStartIndex(),
-								cGeometry.GetIndexSize()
-							);
-
-							// If this is a two sided material, draw the primitives again - but with
-							// flipped culling mode and vertex normals
-							if (pGeneratedProgramUserData->pNormalScale) {
-								// Flip normals
-								pGeneratedProgramUserData->pNormalScale->Set(-1.0f);
-
-								// Flip the backface culling
-								const uint32 nCullModeBackup = cRenderer.GetRenderState(RenderState::CullMode);
-								cRenderer.SetRenderState(RenderState::CullMode, Cull::CW);
-
-								// Draw geometry - again
-								cRenderer.DrawIndexedPrimitives(
-									cGeometry.GetPrimitiveType(),
-									0,
-									cVertexBuffer.GetNumOfElements()-1,
-									cGeometry.GetStartIndex(),
-									cGeometry.GetIndexSize()
-								);
-
-								// Restore the previous cull mode
-								cRenderer.SetRenderState(RenderState::CullMode, nCullModeBackup);
-							}
-						}
-					}
+	// Done
+	return nEnvironmentFlags;
+}
+
+/**
+*  @brief
+*    Draws the gathered and sorted draw list items
+*/
+void SRPDirectionalLightingShaders::DrawSortedItems(Renderer &cRenderer)
+{
+	// Currently set states, used to skip redundant state changes
+	const SQCull *pCurrentCullQuery		   = nullptr;
+	Material	 *pCurrentMaterial		   = nullptr;
+	uint32		  nCurrentEnvironmentFlags = 0;
+	const VertexBuffer *pCurrentVertexBuffer = nullptr;
+	const VisNode	   *pCurrentVisNode		 = nullptr;
+	IndexBuffer		   *pCurrentIndexBuffer	 = nullptr;
+	const SQCull	   *pProgramCullQuery	 = nullptr;
+	SRPDirectionalLightingShadersMaterial::GeneratedProgramUserData *pGeneratedProgramUserData = nullptr;
+	SRPDirectionalLightingShadersMaterial::GeneratedProgramUserData *pCurrentProgramUserData   = nullptr;
+
+	// Loop through all items in sorted order
+	for (uint32 i=0; i<m_cDrawList.GetNumOfItems(); i++) {
+		const DrawList::Item &cItem = m_cDrawList.GetSortedItem(i);
+
+		// Set the scissor rectangle of the visibility container the item is in
+		if (pCurrentCullQuery != cItem.pCullQuery) {
+			pCurrentCullQuery = cItem.pCullQuery;
+			cRenderer.SetScissorRect(&pCurrentCullQuery->GetVisContainer().GetProjection().cRectangle);
+		}
+
+		// Make the material to the currently used one - the program, textures and material uniforms are only set if the material changes
+		if (pCurrentMaterial != cItem.pMaterial || nCurrentEnvironmentFlags != cItem.nUserData) {
+			pCurrentMaterial		 = cItem.pMaterial;
+			nCurrentEnvironmentFlags = cItem.nUserData;
+
+			// [TODO] Correct texture filter
+			pGeneratedProgramUserData = GetCachedMaterial(*cItem.pMaterial).MakeMaterialCurrent(GetFlags(), nCurrentEnvironmentFlags, SRPDirectionalLightingShadersMaterial::Anisotropic2);
+
+			// Set the uniforms which are identical for all items using the same program
+			if (pGeneratedProgramUserData && pCurrentProgramUserData != pGeneratedProgramUserData) {
+				pCurrentProgramUserData = pGeneratedProgramUserData;
+
+				// Vertex attributes, per cull query and per visibility node uniforms have to be set for the new program
+				pCurrentVertexBuffer = nullptr;
+				pCurrentVisNode		 = nullptr;
+				pProgramCullQuery	 = nullptr;
+
+				// Ambient color
+				if (pGeneratedProgramUserData->pAmbientColor)
+					pGeneratedProgramUserData->pAmbientColor->Set(AmbientColor.Get());
+
+				if (nCurrentEnvironmentFlags & SRPDirectionalLightingShadersMaterial::EnvironmentLightingEnabled) {
+					// Set view space light direction and light color
+					if (pGeneratedProgramUserData->pLightDirection)
+						pGeneratedProgramUserData->pLightDirection->Set(m_vLightDirection);
+					if (pGeneratedProgramUserData->pLightColor)
+						pGeneratedProgramUserData->pLightColor->Set(m_cLightColor);
 				}
+
+				// DOF
+				if (pGeneratedProgramUserData->pDOFParams)
+					pGeneratedProgramUserData->pDOFParams->Set(m_fDOFNearBlurDepth, m_fDOFFocalPlaneDepth, m_fDOFFarBlurDepth, m_fDOFBlurrinessCutoff);
+			}
+		}
+		if (!pGeneratedProgramUserData)
+			continue;
+
+		// Set the per cull query uniforms, the items of the program may be within several visibility containers with different view matrices
+		if (pProgramCullQuery != cItem.pCullQuery) {
+			pProgramCullQuery = cItem.pCullQuery;
+
+			// Set the "ViewSpaceToWorldSpace" fragment shader parameter
+			if (pGeneratedProgramUserData->pViewSpaceToWorldSpace) {
+				// [TODO] Add *SQCullQuery::GetInvViewMatrix()?
+				Matrix3x3 mRot = pProgramCullQuery->GetViewMatrix().GetInverted();
+				pGeneratedProgramUserData->pViewSpaceToWorldSpace->Set(mRot);
 			}
 		}
+
+		// Set program vertex attributes, this creates a connection between "Vertex Buffer Attribute" and "Vertex Shader Attribute"
+		VertexBuffer *pVertexBuffer = cItem.pVertexBuffer;
+		if (pCurrentVertexBuffer != pVertexBuffer) {
+			pCurrentVertexBuffer = pVertexBuffer;
+			if (pGeneratedProgramUserData->pVertexPosition)
+				pGeneratedProgramUserData->pVertexPosition->Set(pVertexBuffer, PLRenderer::VertexBuffer::Position);
+			if (pGeneratedProgramUserData->pVertexTexCoord0)
+				pGeneratedProgramUserData->pVertexTexCoord0->Set(pVertexBuffer, PLRenderer::VertexBuffer::TexCoord, 0);
+			if (pGeneratedProgramUserData->pVertexTexCoord1)
+				pGeneratedProgramUserData->pVertexTexCoord1->Set(pVertexBuffer, PLRenderer::VertexBuffer::TexCoord, 1);
+			if (pGeneratedProgramUserData->pVertexNormal)
+				pGeneratedProgramUserData->pVertexNormal->Set(pVertexBuffer, PLRenderer::VertexBuffer::Normal);
+			if (pGeneratedProgramUserData->pVertexTangent)
+				pGeneratedProgramUserData->pVertexTangent->Set(pVertexBuffer, PLRenderer::VertexBuffer::Tangent);
+			if (pGeneratedProgramUserData->pVertexBinormal)
+				pGeneratedProgramUserData->pVertexBinormal->Set(pVertexBuffer, PLRenderer::VertexBuffer::Binormal);
+		}
+
+		// Set the per visibility node uniforms
+		const VisNode &cVisNode = *cItem.pVisNode;
+		if (pCurrentVisNode != &cVisNode) {
+			pCurrentVisNode = &cVisNode;
+
+			// Set object space to clip space matrix uniform
+			if (pGeneratedProgramUserData->pObjectSpaceToClipSpaceMatrix)
+				pGeneratedProgramUserData->pObjectSpaceToClipSpaceMatrix->Set(cVisNode.GetWorldViewProjectionMatrix());
+
+			// Set object space to view space matrix uniform
+			if (pGeneratedProgramUserData->pObjectSpaceToViewSpaceMatrix)
+				pGeneratedProgramUserData->pObjectSpaceToViewSpaceMatrix->Set(cVisNode.GetWorldViewMatrix());
+
+			// Parallax mapping - set object space eye position
+			if (pGeneratedProgramUserData->pHeightMap && pGeneratedProgramUserData->pEyePos)
+				pGeneratedProgramUserData->pEyePos->Set(cVisNode.GetInverseWorldMatrix()*(cItem.pCullQuery->GetVisContainer().GetWorldMatrix()*cItem.pCullQuery->GetCameraPosition()));
+		}
+
+		// Bind index buffer
+		if (pCurrentIndexBuffer != cItem.pIndexBuffer) {
+			pCurrentIndexBuffer = cItem.pIndexBuffer;
+			cRenderer.SetIndexBuffer(pCurrentIndexBuffer);
+		}
+
+		// Two sided lighting?
+		if (pGeneratedProgramUserData->pNormalScale)
+			pGeneratedProgramUserData->pNormalScale->Set(1.0f);
+
+		// Draw the geometry
+		const Geometry &cGeometry = *cItem.pGeometry;
+		cRenderer.DrawIndexedPrimitives(
+			cGeometry.GetPrimitiveType(),
+			0,
+			pVertexBuffer->GetNumOfElements()-1,
+			cGeometry.GetStartIndex(),
+			cGeometry.GetIndexSize()
+		);
+
+		// If this is a two sided material, draw the primitives again - but with
+		// flipped culling mode and vertex normals
+		if (pGeneratedProgramUserData->pNormalScale) {
+			// Flip normals
+			pGeneratedProgramUserData->pNormalScale->Set(-1.0f);
+
+			// Flip the backface culling
+			const uint32 nCullModeBackup = cRenderer.GetRenderState(RenderState::CullMode);
+			cRenderer.SetRenderState(RenderState::CullMode, Cull::CW);
+
+			// Draw geometry - again
+			cRenderer.DrawIndexedPrimitives(
+				cGeometry.GetPrimitiveType(),
+				0,
+				pVertexBuffer->GetNumOfElements()-1,
+				cGeometry.GetStartIndex(),
+				cGeometry.GetIndexSize()
+			);
+
+			// Restore the previous cull mode
+			cRenderer.SetRenderState(RenderState::CullMode, nCullModeBackup);
+		}
 	}
 }
 
@@ -409,8 +459,27 @@ void SRPDirectionalLightingShaders::Draw(Renderer &cRenderer, const SQCull &cCul
 			m_cLightNodeHandler.SetElement();
 		}
 
-		// Draw recursive from front to back
-		DrawRec(cRenderer, cCullQuery);
+		// Gather the visible geometries
+		const bool bTransparentPass = (GetFlags() & TransparentPass) != 0;
+		m_cDrawList.Clear();
+		m_cDrawList.Collect(cCullQuery, bTransparentPass ? DrawList::CollectTransparent : DrawList::CollectOpaque);
+
+		// Setup the sort keys: Transparent geometries are drawn from back to front, opaque geometries are
+		// ordered by program, material and texture and drawn from front to back within identical states
+		for (uint32 i=0; i<m_cDrawList.GetNumOfItems(); i++) {
+			DrawList::Item &cItem = m_cDrawList.GetItem(i);
+			cItem.nUserData = GetEnvironmentFlags(*cItem.pSceneNode, *cItem.pVertexBuffer);
+			SRPDirectionalLightingShadersMaterial &cSRPDirectionalLightingShadersMaterial = GetCachedMaterial(*cItem.pMaterial);
+			const ProgramGenerator::GeneratedProgram *pGeneratedProgram = cSRPDirectionalLightingShadersMaterial.GetGeneratedProgram(GetFlags(), cItem.nUserData);
+			const TextureBuffer *pTextureBuffer = cSRPDirectionalLightingShadersMaterial.GetDiffuseMapTextureBuffer();
+			cItem.nSortKey = bTransparentPass ? DrawList::GetDepthSortKey(0, pGeneratedProgram, cItem.pMaterial, pTextureBuffer, cItem.fDepth)
+											  : DrawList::GetStateSortKey(0, pGeneratedProgram, cItem.pMaterial, pTextureBuffer, cItem.fDepth);
+		}
+		m_cDrawList.Sort();
+
+		// Draw the sorted geometries, the material sets the cull mode
+		cRenderer.SetRenderState(RenderState::CullMode, Cull::CCW);
+		DrawSortedItems(cRenderer);
 
 		// Restore the color mask
 		cRenderer.SetColorMask(bRed, bGreen, bBlue, bAlpha);
@@ -195,12 +195,8 @@ SRPDirectionalLightingShadersMaterial::GeneratedProgramUserData *SRPDirectionalL
 	// Get the used renderer
 	Renderer &cRenderer = m_pProgramGenerator->GetRenderer();
 
-	// Synchronize this material cache with the owner
-	if (m_nRendererFlags != nRendererFlags || m_nEnvironmentFlags != nEnvironmentFlags || !m_bSynchronized)
-		Synchronize(nRendererFlags, nEnvironmentFlags);
-
-	// Get a program instance from the program generator using the given program flags
-	ProgramGenerator::GeneratedProgram *pGeneratedProgram = m_pProgramGenerator->GetProgram(m_cProgramFlags);
+	// Get the program instance to use
+	ProgramGenerator::GeneratedProgram *pGeneratedProgram = GetGeneratedProgram(nRendererFlags, nEnvironmentFlags);
 
 	// Make our program to the current one
 	GeneratedProgramUserData *pGeneratedProgramUserData = nullptr;
@@ -531,6 +527,29 @@ SRPDirectionalLightingShadersMaterial::GeneratedProgramUserData *SRPDirectionalL
 	return pGeneratedProgramUserData;
 }
 
+/**
+*  @brief
+*    Returns the generated program this material is using
+*/
+ProgramGenerator::GeneratedProgram *SRPDirectionalLightingShadersMaterial::GetGeneratedProgram(uint32 nRendererFlags, uint32 nEnvironmentFlags)
+{
+	// Synchronize this material cache with the owner
+	if (m_nRendererFlags != nRendererFlags || m_nEnvironmentFlags != nEnvironmentFlags || !m_bSynchronized)
+		Synchronize(nRendererFlags, nEnvironmentFlags);
+
+	// Get a program instance from the program generator using the given program flags
+	return m_pProgramGenerator->GetProgram(m_cProgramFlags);
+}
+
+/**
+*  @brief
+*    Returns the texture buffer of the diffuse map
+*/
+TextureBuffer *SRPDirectionalLightingShadersMaterial::GetDiffuseMapTextureBuffer() const
+{
+	return m_pDiffuseMap ? m_pDiffuseMap->GetValueTextureBuffer() : nullptr;
+}
+
 
 //[-------------------------------------------------------]
 //[ Private functions                                     ]
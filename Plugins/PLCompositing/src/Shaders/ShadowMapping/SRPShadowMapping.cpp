@@ -26,6 +26,7 @@
 //[ Includes                                              ]
 //[-------------------------------------------------------]
 #include <PLCore/Tools/Tools.h>
+#include <PLCore/System/JobSystem.h>
 #include <PLMath/EulerAngles.h>
 #include <PLRenderer/RendererContext.h>
 #include <PLRenderer/Renderer/Shader.h>
@@ -84,7 +85,9 @@ SRPShadowMapping::SRPShadowMapping() :
 	m_pLightCullQuery(new SceneQueryHandler()),
 	m_pCurrentCubeShadowRenderTarget(nullptr),
 	m_pCurrentSpotShadowRenderTarget(nullptr),
-	m_pProgramGenerator(nullptr)
+	m_pProgramGenerator(nullptr),
+	m_nNumOfUsedCommandBuffers(0),
+	m_pMaterialProgramUserData(nullptr)
 {
 	// Init shadow maps
 	for (int i=0; i<CubeShadowRenderTargets; i++)
@@ -321,17 +324,7 @@ void SRPShadowMapping::UpdateShadowMap(Renderer &cRenderer, SNLight &cLight, con
 											GeneratedProgramUserData *pGeneratedProgramUserData = MakeMaterialCurrent(cRenderer, *pMaterial, fInvRadius);
 											if (pGeneratedProgramUserData) {
 												// Draw all mesh batches using this material
-												Iterator<MeshBatch*> cMeshBatchIterator = m_lstMeshBatches.GetIterator();
-												while (cMeshBatchIterator.HasNext()) {
-													// Get the current mesh batch
-													MeshBatch *pMeshBatch = cMeshBatchIterator.Next();
-
-													// Same material?
-													if (pMeshBatch->pMaterial == pMaterial) {
-														// Draw the mesh batch
-														DrawMeshBatch(cRenderer, *pGeneratedProgramUserData, *pMeshBatch);
-													}
-												}
+												DrawMeshBatches(cRenderer, *pGeneratedProgramUserData, *pMaterial);
 											}
 										}
 										{ // Free the mesh batches
@@ -431,17 +424,7 @@ void SRPShadowMapping::UpdateShadowMap(Renderer &cRenderer, SNLight &cLight, con
 											GeneratedProgramUserData *pGeneratedProgramUserData = MakeMaterialCurrent(cRenderer, *pMaterial, fInvRadius);
 											if (pGeneratedProgramUserData) {
 												// Draw all mesh batches using this material
-												Iterator<MeshBatch*> cMeshBatchIterator = m_lstMeshBatches.GetIterator();
-												while (cMeshBatchIterator.HasNext()) {
-													// Get the current mesh batch
-													MeshBatch *pMeshBatch = cMeshBatchIterator.Next();
-
-													// Same material?
-													if (pMeshBatch->pMaterial == pMaterial) {
-														// Draw the mesh batch
-														DrawMeshBatch(cRenderer, *pGeneratedProgramUserData, *pMeshBatch);
-													}
-												}
+												DrawMeshBatches(cRenderer, *pGeneratedProgramUserData, *pMaterial);
 											}
 										}
 										{ // Free the mesh batches
@@ -587,6 +570,11 @@ void SRPShadowMapping::CollectMeshBatchesRec(const SQCull &cCullQuery)
 											cMeshBatch.pVisNode				= pVisNode;
 											cMeshBatch.sScissorRectangle	= cVisContainer.GetProjection().cRectangle;
 
+											// The visibility node matrices are calculated on demand, so get them right now because
+											// the mesh batches may be recorded by several threads at the same time
+											cMeshBatch.mWorldViewProjection	= pVisNode->GetWorldViewProjectionMatrix();
+											cMeshBatch.mWorldView			= pVisNode->GetWorldViewMatrix();
+
 											// Add material
 											if (!m_lstMaterials.IsElement(pMaterial))
 												m_lstMaterials.Add(pMaterial);
@@ -695,9 +683,50 @@ SRPShadowMapping::GeneratedProgramUserData *SRPShadowMapping::MakeMaterialCurren
 
 /**
 *  @brief
-*    Draws a mesh batch
+*    Draws all mesh batches using the given material
+*/
+void SRPShadowMapping::DrawMeshBatches(Renderer &cRenderer, GeneratedProgramUserData &cGeneratedProgramUserData, const Material &cMaterial)
+{
+	// Gather the mesh batches using this material
+	m_lstMaterialMeshBatches.Reset();
+	Iterator<MeshBatch*> cMeshBatchIterator = m_lstMeshBatches.GetIterator();
+	while (cMeshBatchIterator.HasNext()) {
+		// Get the current mesh batch
+		const MeshBatch *pMeshBatch = cMeshBatchIterator.Next();
+
+		// Same material?
+		if (pMeshBatch->pMaterial == &cMaterial)
+			m_lstMaterialMeshBatches.Add(pMeshBatch);
+	}
+	const uint32 nNumOfMeshBatches = m_lstMaterialMeshBatches.GetNumOfElements();
+	if (nNumOfMeshBatches) {
+		// Get the number of command buffers to use, there's no need to split up the work if there are no worker threads
+		JobSystem *pJobSystem = JobSystem::GetInstance();
+		m_nNumOfUsedCommandBuffers = pJobSystem->GetNumOfWorkers() ? nNumOfMeshBatches/MeshBatchesPerCommandBuffer : 1;
+		if (m_nNumOfUsedCommandBuffers < 1)
+			m_nNumOfUsedCommandBuffers = 1;
+		else if (m_nNumOfUsedCommandBuffers > NumOfCommandBuffers)
+			m_nNumOfUsedCommandBuffers = NumOfCommandBuffers;
+
+		// Record the mesh batches, use the worker threads of the job system if there are several command buffers
+		m_pMaterialProgramUserData = &cGeneratedProgramUserData;
+		if (m_nNumOfUsedCommandBuffers > 1)
+			pJobSystem->ParallelFor(m_nNumOfUsedCommandBuffers, 1, &SRPShadowMapping::RecordMeshBatches, this);
+		else
+			RecordMeshBatches(0, 1, this);
+		m_pMaterialProgramUserData = nullptr;
+
+		// Execute the recorded commands in order
+		for (uint32 i=0; i<m_nNumOfUsedCommandBuffers; i++)
+			m_cCommandBuffers[i].Execute(cRenderer);
+	}
+}
+
+/**
+*  @brief
+*    Records a mesh batch
 */
-void SRPShadowMapping::DrawMeshBatch(Renderer &cRenderer, GeneratedProgramUserData &cGeneratedProgramUserData, MeshBatch &cMeshBatch) const
+void SRPShadowMapping::DrawMeshBatch(CommandBuffer &cCommandBuffer, const GeneratedProgramUserData &cGeneratedProgramUserData, const MeshBatch &cMeshBatch) const
 {
 	// Get the mesh batch vertex buffer
 	VertexBuffer *pVertexBuffer = cMeshBatch.pVertexBuffer;
@@ -705,33 +734,30 @@ void SRPShadowMapping::DrawMeshBatch(Renderer &cRenderer, GeneratedProgramUserDa
 	{ // Set per mesh batch program parameters
 		// Set program vertex attributes, this creates a connection between "Vertex Buffer Attribute" and "Vertex Shader Attribute"
 		if (cGeneratedProgramUserData.pVertexPosition)
-			cGeneratedProgramUserData.pVertexPosition->Set(pVertexBuffer, PLRenderer::VertexBuffer::Position);
+			cCommandBuffer.SetProgramAttribute(*cGeneratedProgramUserData.pVertexPosition, pVertexBuffer, PLRenderer::VertexBuffer::Position);
 		if (cGeneratedProgramUserData.pVertexTexCoord0)
-			cGeneratedProgramUserData.pVertexTexCoord0->Set(pVertexBuffer, PLRenderer::VertexBuffer::TexCoord);
-
-		// Get the mesh batch visibility node
-		const VisNode *pVisNode = cMeshBatch.pVisNode;
+			cCommandBuffer.SetProgramAttribute(*cGeneratedProgramUserData.pVertexTexCoord0, pVertexBuffer, PLRenderer::VertexBuffer::TexCoord);
 
 		// Set world view projection matrix
 		if (cGeneratedProgramUserData.pWorldVP)
-			cGeneratedProgramUserData.pWorldVP->Set(pVisNode->GetWorldViewProjectionMatrix());
+			cCommandBuffer.SetProgramUniform(*cGeneratedProgramUserData.pWorldVP, cMeshBatch.mWorldViewProjection);
 
 		// Set world view matrix
 		if (cGeneratedProgramUserData.pWorldV)
-			cGeneratedProgramUserData.pWorldV->Set(pVisNode->GetWorldViewMatrix());
+			cCommandBuffer.SetProgramUniform(*cGeneratedProgramUserData.pWorldV, cMeshBatch.mWorldView);
 	}
 
 	// Bind index buffer
-	cRenderer.SetIndexBuffer(cMeshBatch.pIndexBuffer);
+	cCommandBuffer.SetIndexBuffer(cMeshBatch.pIndexBuffer);
 
 	// Set the new scissor rectangle
-	cRenderer.SetScissorRect(&cMeshBatch.sScissorRectangle);
+	cCommandBuffer.SetScissorRect(&cMeshBatch.sScissorRectangle);
 
 	// Get the mesh patch geometry
 	const Geometry *pGeometry = cMeshBatch.pGeometry;
 
 	// Draw the geometry
-	cRenderer.DrawIndexedPrimitives(
+	cCommandBuffer.DrawIndexedPrimitives(
 		pGeometry->GetPrimitiveType(),
 		0,
 		pVertexBuffer->GetNumOfElements()-1,
@@ -740,6 +766,25 @@ void SRPShadowMapping::DrawMeshBatch(Renderer &cRenderer, GeneratedProgramUserDa
 	);
 }
 
+/**
+*  @brief
+*    Records the mesh batches of the given command buffers
+*/
+void SRPShadowMapping::RecordMeshBatches(uint32 nFirst, uint32 nEnd, void *pData)
+{
+	SRPShadowMapping &cSRPShadowMapping		= *static_cast<SRPShadowMapping*>(pData);
+	const uint32	  nNumOfMeshBatches		= cSRPShadowMapping.m_lstMaterialMeshBatches.GetNumOfElements();
+	const uint32	  nNumOfCommandBuffers	= cSRPShadowMapping.m_nNumOfUsedCommandBuffers;
+	for (uint32 nPart=nFirst; nPart<nEnd; nPart++) {
+		// Each command buffer records a contiguous range of mesh batches, so executing the command buffers in order keeps the draw order
+		CommandBuffer &cCommandBuffer = cSRPShadowMapping.m_cCommandBuffers[nPart];
+		cCommandBuffer.Reset();
+		const uint32 nLast = (nPart + 1)*nNumOfMeshBatches/nNumOfCommandBuffers;
+		for (uint32 i=nPart*nNumOfMeshBatches/nNumOfCommandBuffers; i<nLast; i++)
+			cSRPShadowMapping.DrawMeshBatch(cCommandBuffer, *cSRPShadowMapping.m_pMaterialProgramUserData, *cSRPShadowMapping.m_lstMaterialMeshBatches[i]);
+	}
+}
+
 /**
 *  @brief
 *    Returns a free mesh batch
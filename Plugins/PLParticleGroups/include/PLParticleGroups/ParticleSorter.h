@@ -0,0 +1,246 @@
+/*********************************************************\
+ *  File: ParticleSorter.h                               *
+ *
+ *  Copyright (C) 2002-2013 The PixelLight Team (http://www.pixellight.org/)
+ *
+ *  This file is part of PixelLight.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ *  and associated documentation files (the "Software"), to deal in the Software without
+ *  restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ *  Software is furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all copies or
+ *  substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ *  BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ *  DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ *  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+#ifndef __PLPG_PARTICLESORTER_H__
+#define __PLPG_PARTICLESORTER_H__
+#pragma once
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include <PLMath/Vector3.h>
+#include <PLMath/Matrix4x4.h>
+#include "PLParticleGroups/PLParticleGroups.h"
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace PLParticleGroups {
+
+
+//[-------------------------------------------------------]
+//[ Classes                                               ]
+//[-------------------------------------------------------]
+/**
+*  @brief
+*    Sorts particles back to front for rendering alpha blended particles
+*
+*  @remarks
+*    Usage: Call "SetView()" with the current world view matrix, set the position of each particle by
+*    using "SetPosition()" and call "Sort()" to get the particle order.
+*
+*    The view depth of each particle is quantized to 16 bit and the particles are sorted by using a two pass
+*    radix sort. Both passes are linear passes over the data with 256 buckets each, so there are no comparisons
+*    and the memory accesses stay cache friendly even for several hundred thousand particles.
+*
+*    The order only depends on the view direction, moving the camera doesn't change it. Usually, the view
+*    direction and the particles change only a little bit between two frames, so the previous order is almost
+*    correct. If the view direction didn't change a lot, the previous order is repaired by using an insertion
+*    sort which is linear for almost sorted data. If the insertion sort has to move too many particles,
+*    it's aborted and the radix sort is used for the next sorts.
+*
+*  @note
+*    - The particle indices may change between two sorts (for example when particles are removed from a
+*      "ParticleStore"), the previous order is just a hint and the result is always a complete order
+*/
+class ParticleSorter {
+
+
+	//[-------------------------------------------------------]
+	//[ Public functions                                      ]
+	//[-------------------------------------------------------]
+	public:
+		/**
+		*  @brief
+		*    Default constructor
+		*/
+		PLPG_API ParticleSorter();
+
+		/**
+		*  @brief
+		*    Destructor
+		*/
+		PLPG_API ~ParticleSorter();
+
+		/**
+		*  @brief
+		*    Allocates the sort buffers
+		*
+		*  @param[in] nMaxNumOfParticles
+		*    Maximum possible number of particles, 0 to free the buffers
+		*
+		*  @note
+		*    - The previous order is discarded
+		*/
+		PLPG_API void Allocate(PLCore::uint32 nMaxNumOfParticles);
+
+		/**
+		*  @brief
+		*    Returns the maximum possible number of particles
+		*
+		*  @return
+		*    The maximum possible number of particles
+		*/
+		inline PLCore::uint32 GetMaxNumOfParticles() const;
+
+		/**
+		*  @brief
+		*    Sets the view the particles are sorted for
+		*
+		*  @param[in] mWorldView
+		*    World view matrix, transforms the particle positions into view space
+		*
+		*  @note
+		*    - Must be called before the particle positions are set
+		*/
+		PLPG_API void SetView(const PLMath::Matrix4x4 &mWorldView);
+
+		/**
+		*  @brief
+		*    Sets the position of a particle
+		*
+		*  @param[in] nIndex
+		*    Index of the particle, must be < "GetMaxNumOfParticles()"
+		*  @param[in] vPosition
+		*    Particle position
+		*/
+		inline void SetPosition(PLCore::uint32 nIndex, const PLMath::Vector3 &vPosition);
+
+		/**
+		*  @brief
+		*    Sorts the particles back to front
+		*
+		*  @param[in] nNumOfParticles
+		*    Number of particles to sort, the positions of the particles [0, nNumOfParticles) must be set
+		*
+		*  @return
+		*    The particle indices from back to front, a null pointer if the buffers are not allocated
+		*/
+		PLPG_API const PLCore::uint32 *Sort(PLCore::uint32 nNumOfParticles);
+
+		/**
+		*  @brief
+		*    Returns whether or not the last sort repaired the previous order
+		*
+		*  @return
+		*    'true' if the last sort used the insertion sort, 'false' if the radix sort was used
+		*/
+		inline bool IsIncremental() const;
+
+
+	//[-------------------------------------------------------]
+	//[ Private definitions                                   ]
+	//[-------------------------------------------------------]
+	private:
+		/**
+		*  @brief
+		*    Particle within the sort buffer
+		*/
+		struct SortItem {
+			PLCore::uint32 nKey;	/**< Quantized depth */
+			PLCore::uint32 nIndex;	/**< Particle index */
+		};
+
+
+	//[-------------------------------------------------------]
+	//[ Private functions                                     ]
+	//[-------------------------------------------------------]
+	private:
+		/**
+		*  @brief
+		*    Copy constructor
+		*
+		*  @param[in] cSource
+		*    Source to copy from
+		*/
+		ParticleSorter(const ParticleSorter &cSource);
+
+		/**
+		*  @brief
+		*    Copy operator
+		*
+		*  @param[in] cSource
+		*    Source to copy from
+		*
+		*  @return
+		*    Reference to this instance
+		*/
+		ParticleSorter &operator =(const ParticleSorter &cSource);
+
+		/**
+		*  @brief
+		*    Repairs the order within the sort buffer by using an insertion sort
+		*
+		*  @param[in] nNumOfParticles
+		*    Number of particles to sort
+		*
+		*  @return
+		*    'true' if all went fine, 'false' if the insertion sort was aborted because the order was too different
+		*/
+		bool InsertionSort(PLCore::uint32 nNumOfParticles);
+
+		/**
+		*  @brief
+		*    Sorts the sort buffer by using a radix sort and writes the result into the order
+		*
+		*  @param[in] nNumOfParticles
+		*    Number of particles to sort
+		*/
+		void RadixSort(PLCore::uint32 nNumOfParticles);
+
+
+	//[-------------------------------------------------------]
+	//[ Private data                                          ]
+	//[-------------------------------------------------------]
+	private:
+		PLCore::uint32	 m_nMaxNumOfParticles;	/**< Maximum possible number of particles */
+		float			*m_pfDepths;			/**< View depth of each particle relative to the particle space origin, can be a null pointer */
+		PLCore::uint16	*m_pnKeys;				/**< Quantized view depth of each particle, 0 is the farthest particle, can be a null pointer */
+		PLCore::uint32	*m_pnOrder;				/**< Particle indices from back to front, can be a null pointer */
+		SortItem		*m_pSortItems;			/**< Sort buffer with two halfs of "m_nMaxNumOfParticles" items each, can be a null pointer */
+		PLCore::uint32	 m_nNumOfOrdered;		/**< Number of particles within the current order */
+		PLCore::uint32	 m_nInsertionSortDelay;	/**< Number of sorts before the insertion sort is tried again */
+		PLMath::Vector3	 m_vViewDirection;		/**< View direction within particle space */
+		bool			 m_bCoherentView;		/**< Did the last "SetView()" call only change the view direction a little bit? */
+		bool			 m_bIncremental;		/**< Did the last sort use the insertion sort? */
+
+
+};
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+} // PLParticleGroups
+
+
+//[-------------------------------------------------------]
+//[ Implementation                                        ]
+//[-------------------------------------------------------]
+#include "PLParticleGroups/ParticleSorter.inl"
+
+
+#endif // __PLPG_PARTICLESORTER_H__
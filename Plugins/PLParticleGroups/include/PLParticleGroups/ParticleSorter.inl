@@ -0,0 +1,65 @@
+/*********************************************************\
+ *  File: ParticleSorter.inl                             *
+ *
+ *  Copyright (C) 2002-2013 The PixelLight Team (http://www.pixellight.org/)
+ *
+ *  This file is part of PixelLight.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ *  and associated documentation files (the "Software"), to deal in the Software without
+ *  restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ *  Software is furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all copies or
+ *  substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ *  BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ *  DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ *  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace PLParticleGroups {
+
+
+//[-------------------------------------------------------]
+//[ Public functions                                      ]
+//[-------------------------------------------------------]
+/**
+*  @brief
+*    Returns the maximum possible number of particles
+*/
+inline PLCore::uint32 ParticleSorter::GetMaxNumOfParticles() const
+{
+	return m_nMaxNumOfParticles;
+}
+
+/**
+*  @brief
+*    Sets the position of a particle
+*/
+inline void ParticleSorter::SetPosition(PLCore::uint32 nIndex, const PLMath::Vector3 &vPosition)
+{
+	m_pfDepths[nIndex] = m_vViewDirection.x*vPosition.x + m_vViewDirection.y*vPosition.y + m_vViewDirection.z*vPosition.z;
+}
+
+/**
+*  @brief
+*    Returns whether or not the last sort repaired the previous order
+*/
+inline bool ParticleSorter::IsIncremental() const
+{
+	return m_bIncremental;
+}
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+} // PLParticleGroups
@@ -0,0 +1,391 @@
+/*********************************************************\
+ *  File: ParticleStore.h                                *
+ *
+ *  Copyright (C) 2002-2013 The PixelLight Team (http://www.pixellight.org/)
+ *
+ *  This file is part of PixelLight.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ *  and associated documentation files (the "Software"), to deal in the Software without
+ *  restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ *  Software is furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all copies or
+ *  substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ *  BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ *  DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ *  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+#ifndef __PLPG_PARTICLESTORE_H__
+#define __PLPG_PARTICLESTORE_H__
+#pragma once
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include <PLMath/Vector3.h>
+#include <PLMath/AABoundingBox.h>
+#include <PLGraphics/Color/Color4.h>
+#include "PLParticleGroups/PLParticleGroups.h"
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace PLParticleGroups {
+
+
+//[-------------------------------------------------------]
+//[ Classes                                               ]
+//[-------------------------------------------------------]
+/**
+*  @brief
+*    Contiguous "structure of arrays" particle storage
+*
+*  @remarks
+*    Each particle attribute is stored within an own continuous stream, particle 'i' is the element 'i'
+*    of each stream. The particles are always packed at the beginning of the streams: Removing a particle
+*    moves the last particle into the resulting gap ("swap remove"), so the particle order is not stable.
+*
+*    "Update()" integrates the particles, removes the particles without energy and calculates the bounding
+*    box of the remaining particles within a single pass over the streams. With PLMATH_SSE, four particles
+*    are processed at once. Large stores can be split into ranges, which are updated by the PLCore job system
+*    workers.
+*
+*  @note
+*    - Particles within a store have no individual orientation, distortion or custom data, use the
+*      "SNParticleGroup::Particle" pool for particles requiring such features
+*/
+class ParticleStore {
+
+
+	//[-------------------------------------------------------]
+	//[ Public definitions                                    ]
+	//[-------------------------------------------------------]
+	public:
+		/**
+		*  @brief
+		*    Float particle attribute streams
+		*/
+		enum EStream {
+			PositionX      = 0,		/**< Position x component */
+			PositionY      = 1,		/**< Position y component */
+			PositionZ      = 2,		/**< Position z component */
+			VelocityX      = 3,		/**< Velocity x component */
+			VelocityY      = 4,		/**< Velocity y component */
+			VelocityZ      = 5,		/**< Velocity z component */
+			Energy         = 6,		/**< Energy, particles with an energy below zero are removed by "Update()" */
+			Size           = 7,		/**< Size */
+			ColorR         = 8,		/**< Red color component */
+			ColorG         = 9,		/**< Green color component */
+			ColorB         = 10,	/**< Blue color component */
+			ColorA         = 11,	/**< Alpha color component */
+			AnimationTimer = 12,	/**< Texture animation timer */
+			NumOfStreams   = 13		/**< Number of float streams */
+		};
+
+		/**
+		*  @brief
+		*    Particle simulation parameters used by "Update()"
+		*/
+		struct Physics {
+			float			fTimeDiff;				/**< Past time in seconds since the last update */
+			PLMath::Vector3	vAcceleration;			/**< Velocity change per second (e.g. gravity) */
+			float			fEnergyLoss;			/**< Energy loss per second */
+			float			fSizeGrowth;			/**< Size change per second */
+			float			fAlphaScale;			/**< The alpha color component is set to energy*alpha scale, clamped to [0, 1] */
+			float			fAnimationFrameTime;	/**< Duration of one texture animation step in seconds, 0 if there's no texture animation */
+			PLCore::uint32	nAnimationSteps;		/**< Number of texture animation steps, the animation starts again at the first step after the last one */
+		};
+
+
+	//[-------------------------------------------------------]
+	//[ Public functions                                      ]
+	//[-------------------------------------------------------]
+	public:
+		/**
+		*  @brief
+		*    Default constructor
+		*/
+		PLPG_API ParticleStore();
+
+		/**
+		*  @brief
+		*    Destructor
+		*/
+		PLPG_API ~ParticleStore();
+
+		/**
+		*  @brief
+		*    Allocates the particle streams
+		*
+		*  @param[in] nMaxNumOfParticles
+		*    Maximum possible number of particles, 0 to free the streams
+		*
+		*  @note
+		*    - All particles are removed
+		*/
+		PLPG_API void Allocate(PLCore::uint32 nMaxNumOfParticles);
+
+		/**
+		*  @brief
+		*    Returns the maximum possible number of particles
+		*
+		*  @return
+		*    The maximum possible number of particles
+		*/
+		inline PLCore::uint32 GetMaxNumOfParticles() const;
+
+		/**
+		*  @brief
+		*    Returns the current number of particles
+		*
+		*  @return
+		*    The current number of particles
+		*/
+		inline PLCore::uint32 GetNumOfParticles() const;
+
+		/**
+		*  @brief
+		*    Adds new particles
+		*
+		*  @param[in] nNumOfParticles
+		*    Number of particles to add
+		*
+		*  @return
+		*    Number of added particles, less than requested if the particle limit was reached
+		*
+		*  @remarks
+		*    The new particles are at the end of the streams, for example, if "GetNumOfParticles()" returned
+		*    'n' before this call and 'm' particles were added, the new particles have the indices [n, n+m).
+		*    All attributes of the new particles are set to zero.
+		*/
+		PLPG_API PLCore::uint32 Add(PLCore::uint32 nNumOfParticles = 1);
+
+		/**
+		*  @brief
+		*    Removes a particle
+		*
+		*  @param[in] nIndex
+		*    Index of the particle to remove, must be valid
+		*
+		*  @note
+		*    - The last particle is moved to the given index
+		*/
+		PLPG_API void Remove(PLCore::uint32 nIndex);
+
+		/**
+		*  @brief
+		*    Removes all particles
+		*/
+		PLPG_API void Clear();
+
+		/**
+		*  @brief
+		*    Returns a float particle attribute stream
+		*
+		*  @param[in] nStream
+		*    Stream to return
+		*
+		*  @return
+		*    The requested stream, a null pointer if the streams are not allocated
+		*
+		*  @note
+		*    - The non-constant version marks the bounding box as dirty
+		*/
+		inline float *GetStream(EStream nStream);
+		inline const float *GetStream(EStream nStream) const;
+
+		/**
+		*  @brief
+		*    Returns the texture animation steps of the particles
+		*
+		*  @return
+		*    The texture animation step stream, a null pointer if the streams are not allocated
+		*/
+		inline PLCore::uint32 *GetAnimationSteps();
+		inline const PLCore::uint32 *GetAnimationSteps() const;
+
+		/**
+		*  @brief
+		*    Sets the position of a particle
+		*
+		*  @param[in] nIndex
+		*    Index of the particle, must be valid
+		*  @param[in] vPosition
+		*    New position
+		*/
+		inline void SetPosition(PLCore::uint32 nIndex, const PLMath::Vector3 &vPosition);
+
+		/**
+		*  @brief
+		*    Sets the velocity of a particle
+		*
+		*  @param[in] nIndex
+		*    Index of the particle, must be valid
+		*  @param[in] vVelocity
+		*    New velocity
+		*/
+		inline void SetVelocity(PLCore::uint32 nIndex, const PLMath::Vector3 &vVelocity);
+
+		/**
+		*  @brief
+		*    Sets the color of a particle
+		*
+		*  @param[in] nIndex
+		*    Index of the particle, must be valid
+		*  @param[in] cColor
+		*    New color
+		*/
+		inline void SetColor(PLCore::uint32 nIndex, const PLGraphics::Color4 &cColor);
+
+		/**
+		*  @brief
+		*    Integrates the particles, removes the particles without energy and updates the bounding box
+		*
+		*  @param[in] sPhysics
+		*    Simulation parameters
+		*  @param[in] bParallel
+		*    Use the job system worker threads for large stores?
+		*
+		*  @remarks
+		*    For each particle:
+		*    - energy -= energy loss*time
+		*    - size += size growth*time
+		*    - alpha = energy*alpha scale, clamped to [0, 1]
+		*    - velocity += acceleration*time
+		*    - position += velocity*time
+		*    Particles with an energy below zero are removed afterwards.
+		*/
+		PLPG_API void Update(const Physics &sPhysics, bool bParallel = false);
+
+		/**
+		*  @brief
+		*    Returns the bounding box of all particles
+		*
+		*  @return
+		*    The bounding box enclosing each particle position +/- the particle size
+		*
+		*  @note
+		*    - The bounding box is calculated by "Update()", if the streams were changed after the last update,
+		*      it's recalculated by this function
+		*/
+		PLPG_API const PLMath::AABoundingBox &GetBoundingBox();
+
+
+	//[-------------------------------------------------------]
+	//[ Private definitions                                   ]
+	//[-------------------------------------------------------]
+	private:
+		static const PLCore::uint32 ParticlesPerJob = 4096;	/**< Number of particles updated by one job */
+
+		/**
+		*  @brief
+		*    Particle range to update, used to split the update work into jobs
+		*/
+		struct UpdateRange {
+			ParticleStore  *pStore;			/**< Particle store the range belongs to, always valid */
+			const Physics  *pPhysics;		/**< Simulation parameters, always valid */
+			PLCore::uint32	nFirst;			/**< Index of the first particle to update */
+			PLCore::uint32	nEnd;			/**< Index behind the last particle to update */
+			PLCore::uint32	nNumOfDead;		/**< Receives the number of particles without energy within the range */
+			float			fMin[3];		/**< Receives the minimum of the bounding box of the remaining particles within the range */
+			float			fMax[3];		/**< Receives the maximum of the bounding box of the remaining particles within the range */
+		};
+
+
+	//[-------------------------------------------------------]
+	//[ Private static functions                              ]
+	//[-------------------------------------------------------]
+	private:
+		/**
+		*  @brief
+		*    Job system parallel for function updating a range of update ranges
+		*
+		*  @param[in] nFirst
+		*    Index of the first update range
+		*  @param[in] nEnd
+		*    Index behind the last update range
+		*  @param[in] pData
+		*    Pointer to the first update range, always valid
+		*/
+		static void UpdateRanges(PLCore::uint32 nFirst, PLCore::uint32 nEnd, void *pData);
+
+
+	//[-------------------------------------------------------]
+	//[ Private functions                                     ]
+	//[-------------------------------------------------------]
+	private:
+		/**
+		*  @brief
+		*    Copy constructor
+		*
+		*  @param[in] cSource
+		*    Source to copy from
+		*/
+		ParticleStore(const ParticleStore &cSource);
+
+		/**
+		*  @brief
+		*    Copy operator
+		*
+		*  @param[in] cSource
+		*    Source to copy from
+		*
+		*  @return
+		*    Reference to this instance
+		*/
+		ParticleStore &operator =(const ParticleStore &cSource);
+
+		/**
+		*  @brief
+		*    Integrates the particles of an update range and calculates the bounding box of the range
+		*
+		*  @param[in, out] sRange
+		*    Update range
+		*/
+		void IntegrateRange(UpdateRange &sRange);
+
+		/**
+		*  @brief
+		*    Calculates the bounding box of all particles
+		*/
+		void CalculateBoundingBox();
+
+
+	//[-------------------------------------------------------]
+	//[ Private data                                          ]
+	//[-------------------------------------------------------]
+	private:
+		PLCore::uint32		  m_nMaxNumOfParticles;		/**< Maximum possible number of particles */
+		PLCore::uint32		  m_nNumOfParticles;		/**< Current number of particles */
+		float				 *m_pfStreams;				/**< All float streams, each stream has "m_nMaxNumOfParticles" elements, can be a null pointer */
+		PLCore::uint32		 *m_pnAnimationSteps;		/**< Texture animation step stream, can be a null pointer */
+		UpdateRange			 *m_pUpdateRanges;			/**< Update ranges, one per job, can be a null pointer */
+		PLMath::AABoundingBox m_cBoundingBox;			/**< Bounding box of all particles */
+		bool				  m_bBoundingBoxDirty;		/**< Has the bounding box to be recalculated? */
+
+
+};
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+} // PLParticleGroups
+
+
+//[-------------------------------------------------------]
+//[ Implementation                                        ]
+//[-------------------------------------------------------]
+#include "PLParticleGroups/ParticleStore.inl"
+
+
+#endif // __PLPG_PARTICLESTORE_H__
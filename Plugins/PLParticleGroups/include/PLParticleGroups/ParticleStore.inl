@@ -0,0 +1,120 @@
+/*********************************************************\
+ *  File: ParticleStore.inl                              *
+ *
+ *  Copyright (C) 2002-2013 The PixelLight Team (http://www.pixellight.org/)
+ *
+ *  This file is part of PixelLight.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ *  and associated documentation files (the "Software"), to deal in the Software without
+ *  restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ *  Software is furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all copies or
+ *  substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ *  BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ *  DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ *  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace PLParticleGroups {
+
+
+//[-------------------------------------------------------]
+//[ Public functions                                      ]
+//[-------------------------------------------------------]
+/**
+*  @brief
+*    Returns the maximum possible number of particles
+*/
+inline PLCore::uint32 ParticleStore::GetMaxNumOfParticles() const
+{
+	return m_nMaxNumOfParticles;
+}
+
+/**
+*  @brief
+*    Returns the current number of particles
+*/
+inline PLCore::uint32 ParticleStore::GetNumOfParticles() const
+{
+	return m_nNumOfParticles;
+}
+
+/**
+*  @brief
+*    Returns a float particle attribute stream
+*/
+inline float *ParticleStore::GetStream(EStream nStream)
+{
+	m_bBoundingBoxDirty = true;
+	return m_pfStreams ? &m_pfStreams[nStream*m_nMaxNumOfParticles] : nullptr;
+}
+
+inline const float *ParticleStore::GetStream(EStream nStream) const
+{
+	return m_pfStreams ? &m_pfStreams[nStream*m_nMaxNumOfParticles] : nullptr;
+}
+
+/**
+*  @brief
+*    Returns the texture animation steps of the particles
+*/
+inline PLCore::uint32 *ParticleStore::GetAnimationSteps()
+{
+	return m_pnAnimationSteps;
+}
+
+inline const PLCore::uint32 *ParticleStore::GetAnimationSteps() const
+{
+	return m_pnAnimationSteps;
+}
+
+/**
+*  @brief
+*    Sets the position of a particle
+*/
+inline void ParticleStore::SetPosition(PLCore::uint32 nIndex, const PLMath::Vector3 &vPosition)
+{
+	m_pfStreams[PositionX*m_nMaxNumOfParticles + nIndex] = vPosition.x;
+	m_pfStreams[PositionY*m_nMaxNumOfParticles + nIndex] = vPosition.y;
+	m_pfStreams[PositionZ*m_nMaxNumOfParticles + nIndex] = vPosition.z;
+	m_bBoundingBoxDirty = true;
+}
+
+/**
+*  @brief
+*    Sets the velocity of a particle
+*/
+inline void ParticleStore::SetVelocity(PLCore::uint32 nIndex, const PLMath::Vector3 &vVelocity)
+{
+	m_pfStreams[VelocityX*m_nMaxNumOfParticles + nIndex] = vVelocity.x;
+	m_pfStreams[VelocityY*m_nMaxNumOfParticles + nIndex] = vVelocity.y;
+	m_pfStreams[VelocityZ*m_nMaxNumOfParticles + nIndex] = vVelocity.z;
+}
+
+/**
+*  @brief
+*    Sets the color of a particle
+*/
+inline void ParticleStore::SetColor(PLCore::uint32 nIndex, const PLGraphics::Color4 &cColor)
+{
+	m_pfStreams[ColorR*m_nMaxNumOfParticles + nIndex] = cColor.r;
+	m_pfStreams[ColorG*m_nMaxNumOfParticles + nIndex] = cColor.g;
+	m_pfStreams[ColorB*m_nMaxNumOfParticles + nIndex] = cColor.b;
+	m_pfStreams[ColorA*m_nMaxNumOfParticles + nIndex] = cColor.a;
+}
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+} // PLParticleGroups
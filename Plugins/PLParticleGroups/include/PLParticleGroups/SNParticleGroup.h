@@ -36,6 +36,8 @@
 #include <PLMesh/Mesh.h>
 #include <PLScene/Scene/SceneNode.h>
 #include "PLParticleGroups/PLParticleGroups.h"
+#include "PLParticleGroups/ParticleStore.h"
+#include "PLParticleGroups/ParticleSorter.h"
 
 
 //[-------------------------------------------------------]
@@ -64,6 +66,12 @@ namespace PLParticleGroups {
 *    If 'Material' is not a material or an effect, the effect of the default value of
 *    'Material' is used together with the given texture.
 *
+*    Particle groups are either using the particle list ("AddParticle()", "GetParticleIterator()") where each
+*    particle is an object with all features like individual orientation and custom data, or the contiguous
+*    "structure of arrays" particle store ("GetParticleStore()") which is updated by "UpdateParticleStore()" and
+*    is meant for groups with many simple particles. Derived classes select the particle store by setting
+*    "m_bUseParticleStore" within their constructor.
+*
 *  @note
 *    - The 'UpdateAABoundingBox()' implementation for dirty axis align bounding box in 'scene node space'
 *      gets the current bounding box by checking each particle. Try to avoid calling the 'dirty' function
@@ -84,7 +92,9 @@ class SNParticleGroup : public PLScene::SceneNode {
 			ForceUpdate             = 1<<10,	/**< Do always update the particle group, even if it's currently not visible on the screen. */
 			PointSprites            = 1<<11,	/**< Use point sprites. Setup the point sprites within the material. */
 			UseGlobalColor          = 1<<12,	/**< Use global particle color. Only possible if the 'PointSprites'-flag is set! */
-			SceneNodeSpaceParticles = 1<<13		/**< Particles are within the local scene node space */
+			SceneNodeSpaceParticles = 1<<13,	/**< Particles are within the local scene node space */
+			ParallelUpdate          = 1<<14,	/**< Update large particle stores by using the job system worker threads */
+			DepthSort               = 1<<15		/**< Draw the particles back to front, required for correct alpha blending. Not used for point sprites. Can be changed at any time. */
 		};
 		pl_enum(EFlags)
 			pl_enum_base(SceneNode::EFlags)
@@ -92,6 +102,8 @@ class SNParticleGroup : public PLScene::SceneNode {
 			pl_enum_value(PointSprites,				"Use point sprites. Setup the point sprites within the material.")
 			pl_enum_value(UseGlobalColor,			"Use global particle color. Only possible if the 'PointSprites'-flag is set!")
 			pl_enum_value(SceneNodeSpaceParticles,	"Particles are within the local scene node space")
+			pl_enum_value(ParallelUpdate,			"Update large particle stores by using the job system worker threads")
+			pl_enum_value(DepthSort,				"Draw the particles back to front, required for correct alpha blending. Not used for point sprites.")
 		pl_enum_end
 
 
@@ -268,6 +280,31 @@ class SNParticleGroup : public PLScene::SceneNode {
 		*/
 		PLPG_API PLCore::Iterator<Particle> GetParticleIterator() const;
 
+		/**
+		*  @brief
+		*    Returns the particle store
+		*
+		*  @return
+		*    The particle store, a null pointer if the particle group doesn't use the particle store
+		*/
+		PLPG_API ParticleStore *GetParticleStore();
+
+		/**
+		*  @brief
+		*    Adds new particles to the particle store
+		*
+		*  @param[in] nNumOfParticles
+		*    Number of particles to add
+		*
+		*  @return
+		*    Number of added particles, less than requested if the particle limit of this group was reached
+		*
+		*  @note
+		*    - The new particles are at the end of the particle store, see "ParticleStore::Add()"
+		*    - If GetCreateParticles() is 'false' or the particle group doesn't use the particle store, this function will always return 0
+		*/
+		PLPG_API PLCore::uint32 AddStoreParticles(PLCore::uint32 nNumOfParticles);
+
 		/**
 		*  @brief
 		*    Returns whether the particle group can create new particles or not
@@ -368,6 +405,19 @@ class SNParticleGroup : public PLScene::SceneNode {
 		*/
 		PLPG_API bool InitParticles(PLCore::uint32 nMaxNumOfParticles, const PLCore::String &sMaterial = "");
 
+		/**
+		*  @brief
+		*    Updates the particles of the particle store
+		*
+		*  @param[in] sPhysics
+		*    Simulation parameters
+		*
+		*  @note
+		*    - Uses the job system worker threads if the 'ParallelUpdate'-flag is set
+		*    - The bounding box is calculated by the update as well, so "DirtyAABoundingBox()" is cheap afterwards
+		*/
+		PLPG_API void UpdateParticleStore(const ParticleStore::Physics &sPhysics);
+
 
 	//[-------------------------------------------------------]
 	//[ Private functions                                     ]
@@ -388,6 +438,24 @@ class SNParticleGroup : public PLScene::SceneNode {
 		*/
 		void DrawShapes(PLRenderer::Renderer &cRenderer);
 
+		/**
+		*  @brief
+		*    Writes the indices of the particle shapes from back to front into the index buffer
+		*
+		*  @note
+		*    - The particle positions must have been set within the particle sorter
+		*/
+		void WriteSortedIndices();
+
+		/**
+		*  @brief
+		*    Sets up the index buffer and the particle sorter depending on the 'DepthSort'-flag
+		*
+		*  @note
+		*    - The index buffer must have been created with the element type required by the maximum number of particles
+		*/
+		void SetupIndexBuffer();
+
 
 	//[-------------------------------------------------------]
 	//[ Private classes                                       ]
@@ -437,6 +505,9 @@ class SNParticleGroup : public PLScene::SceneNode {
 		PLCore::FastPool<Particle>		 m_lstParticles;				/**< Particle list */
 		bool							 m_bCreateParticles;			/**< Create new particles? */
 		PLCore::Array<ParticleTexCoord>	 m_lstTexCoord;					/**< A list of all texture coordinates */
+		bool							 m_bUseParticleStore;			/**< Use the particle store instead of the particle list? (set this within the constructor of derived classes) */
+		ParticleStore					 m_cParticleStore;				/**< Particle store, only allocated if "m_bUseParticleStore" is 'true' */
+		ParticleSorter					 m_cParticleSorter;				/**< Particle sorter, only allocated if the 'DepthSort'-flag is set, changes of the flag are applied by "CreateShapes()" */
 
 
 	//[-------------------------------------------------------]
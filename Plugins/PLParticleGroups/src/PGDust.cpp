@@ -35,6 +35,7 @@
 //[-------------------------------------------------------]
 using namespace PLCore;
 using namespace PLMath;
+using namespace PLGraphics;
 using namespace PLScene;
 namespace PLParticleGroups {
 
@@ -56,6 +57,8 @@ PGDust::PGDust() :
 	EventHandlerUpdate(&PGDust::OnUpdate, this),
 	m_bUpdate(false)
 {
+	// Overwritten SNParticleGroup variables
+	m_bUseParticleStore = true;
 }
 
 /**
@@ -77,18 +80,19 @@ void PGDust::InitFunction()
 
 	// If there are free particles, create new particles
 	float fLength = 0.01f;
-	Particle *pParticle = AddParticle();
-	while (pParticle) {
-		pParticle->fSize	   = fLength + static_cast<float>(Math::GetRand() % 100) / 400.0f;
-		pParticle->vColor.a    = pParticle->fEnergy = 0.4f + static_cast<float>(Math::GetRand() % 100) / 500.0f;
-		pParticle->vPos		   = GetTransform().GetPosition();
-		pParticle->vVelocity.x = Math::GetRandNegFloat()*fLength;
-		pParticle->vVelocity.y = Math::GetRandNegFloat()*fLength;
-		pParticle->vVelocity.z = -fLength*2-Math::GetRandFloat()*fLength*0.5f;
-		pParticle->vColor.r    = pParticle->vColor.g = pParticle->vColor.b = pParticle->fEnergy/2;
-
-		// Next particle, please
-		pParticle = AddParticle();
+	ParticleStore &cParticleStore = *GetParticleStore();
+	const uint32 nFirst   = cParticleStore.GetNumOfParticles();
+	const uint32 nEnd     = nFirst + AddStoreParticles(GetMaxNumOfParticles());
+	float		*pfEnergy = cParticleStore.GetStream(ParticleStore::Energy);
+	float		*pfSize   = cParticleStore.GetStream(ParticleStore::Size);
+	for (uint32 i=nFirst; i<nEnd; i++) {
+		pfSize[i]   = fLength + static_cast<float>(Math::GetRand() % 100) / 400.0f;
+		pfEnergy[i] = 0.4f + static_cast<float>(Math::GetRand() % 100) / 500.0f;
+		cParticleStore.SetPosition(i, GetTransform().GetPosition());
+		const float fVelocityX = Math::GetRandNegFloat()*fLength;
+		const float fVelocityY = Math::GetRandNegFloat()*fLength;
+		cParticleStore.SetVelocity(i, Vector3(fVelocityX, fVelocityY, -fLength*2-Math::GetRandFloat()*fLength*0.5f));
+		cParticleStore.SetColor(i, Color4(pfEnergy[i]/2, pfEnergy[i]/2, pfEnergy[i]/2, pfEnergy[i]));
 	}
 }
 
@@ -124,40 +128,22 @@ void PGDust::OnUpdate()
 {
 	// If this scene node wasn't drawn at the last frame, we can skip some update stuff
 	if ((GetFlags() & ForceUpdate) || m_bUpdate) {
-		uint32 nActive = 0;
-
 		m_bUpdate = false;
 
 		{ // Update particles
-			float fTimeDiff = Timing::GetInstance()->GetTimeDifference();
-			Iterator<Particle> cIterator = GetParticleIterator();
-			while (cIterator.HasNext()) {
-				Particle &cParticle = cIterator.Next();
-
-				cParticle.fEnergy -= fTimeDiff;
-				if (cParticle.fEnergy < 0.0f) {
-					RemoveParticle(cParticle);
-				} else {
-					nActive++;
-					cParticle.fSize     += fTimeDiff*4;
-					cParticle.vColor.a   = cParticle.fEnergy;
-					cParticle.vVelocity += GetGravity()*fTimeDiff*2;
-					cParticle.vPos      += cParticle.vVelocity*fTimeDiff;
-
-					// Texture animation
-					cParticle.fAnimationTimer += fTimeDiff;
-					if (cParticle.fAnimationTimer > 0.04f) {
-						cParticle.fAnimationTimer = 0.0f;
-						cParticle.nAnimationStep++;
-						if (cParticle.nAnimationStep >= GetTextureAnimationSteps())
-							cParticle.nAnimationStep = 0;
-					}
-				}
-			}
+			ParticleStore::Physics sPhysics;
+			sPhysics.fTimeDiff			 = Timing::GetInstance()->GetTimeDifference();
+			sPhysics.vAcceleration		 = GetGravity()*2;
+			sPhysics.fEnergyLoss		 = 1.0f;
+			sPhysics.fSizeGrowth		 = 4.0f;
+			sPhysics.fAlphaScale		 = 1.0f;
+			sPhysics.fAnimationFrameTime = 0.04f;
+			sPhysics.nAnimationSteps	 = GetTextureAnimationSteps();
+			UpdateParticleStore(sPhysics);
 		}
 
 		// Remove particle group?
-		if (nActive) {
+		if (GetNumOfParticles()) {
 			// We have to recalculate the current axis align bounding box in 'scene node space'
 			DirtyAABoundingBox();
 		} else {
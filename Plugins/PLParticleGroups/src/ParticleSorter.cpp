@@ -0,0 +1,305 @@
+/*********************************************************\
+ *  File: ParticleSorter.cpp                             *
+ *
+ *  Copyright (C) 2002-2013 The PixelLight Team (http://www.pixellight.org/)
+ *
+ *  This file is part of PixelLight.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ *  and associated documentation files (the "Software"), to deal in the Software without
+ *  restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ *  Software is furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all copies or
+ *  substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ *  BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ *  DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ *  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include <PLCore/Core/MemoryManager.h>
+#include "PLParticleGroups/ParticleSorter.h"
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+using namespace PLCore;
+using namespace PLMath;
+namespace PLParticleGroups {
+
+
+//[-------------------------------------------------------]
+//[ Local definitions                                     ]
+//[-------------------------------------------------------]
+static const float  CoherentViewDirection = 0.999f;	// Minimum cosine of the angle between the current and the previous view direction for reusing the previous order
+static const uint32 InsertionSortMoves    = 1;		// Maximum average number of positions a particle is moved by the insertion sort before the radix sort is used instead
+static const uint32 InsertionSortDelay    = 8;		// Number of sorts using the radix sort after the insertion sort was aborted
+
+
+//[-------------------------------------------------------]
+//[ Public functions                                      ]
+//[-------------------------------------------------------]
+/**
+*  @brief
+*    Default constructor
+*/
+ParticleSorter::ParticleSorter() :
+	m_nMaxNumOfParticles(0),
+	m_pfDepths(nullptr),
+	m_pnKeys(nullptr),
+	m_pnOrder(nullptr),
+	m_pSortItems(nullptr),
+	m_nNumOfOrdered(0),
+	m_nInsertionSortDelay(0),
+	m_bCoherentView(false),
+	m_bIncremental(false)
+{
+}
+
+/**
+*  @brief
+*    Destructor
+*/
+ParticleSorter::~ParticleSorter()
+{
+	Allocate(0);
+}
+
+/**
+*  @brief
+*    Allocates the sort buffers
+*/
+void ParticleSorter::Allocate(uint32 nMaxNumOfParticles)
+{
+	// Free the old buffers
+	if (m_pfDepths) {
+		delete [] m_pfDepths;
+		m_pfDepths = nullptr;
+	}
+	if (m_pnKeys) {
+		delete [] m_pnKeys;
+		m_pnKeys = nullptr;
+	}
+	if (m_pnOrder) {
+		delete [] m_pnOrder;
+		m_pnOrder = nullptr;
+	}
+	if (m_pSortItems) {
+		delete [] m_pSortItems;
+		m_pSortItems = nullptr;
+	}
+	m_nMaxNumOfParticles = nMaxNumOfParticles;
+	m_nNumOfOrdered		 = 0;
+	m_nInsertionSortDelay = 0;
+	m_bCoherentView		 = false;
+	m_bIncremental		 = false;
+
+	// Allocate the new buffers
+	if (m_nMaxNumOfParticles) {
+		m_pfDepths	 = new float[m_nMaxNumOfParticles];
+		m_pnKeys	 = new uint16[m_nMaxNumOfParticles];
+		m_pnOrder	 = new uint32[m_nMaxNumOfParticles];
+		m_pSortItems = new SortItem[m_nMaxNumOfParticles*2];
+	}
+}
+
+/**
+*  @brief
+*    Sets the view the particles are sorted for
+*/
+void ParticleSorter::SetView(const Matrix4x4 &mWorldView)
+{
+	// The view looks along the negative z axis, so the depth is the negative view space z component. The translation
+	// of the view is ignored because it moves all particles by the same depth and therefore doesn't change the order.
+	const Vector3 vViewDirection(-mWorldView.zx, -mWorldView.zy, -mWorldView.zz);
+	m_bCoherentView  = (vViewDirection.DotProduct(m_vViewDirection) >= CoherentViewDirection*vViewDirection.GetSquaredLength());
+	m_vViewDirection = vViewDirection;
+}
+
+/**
+*  @brief
+*    Sorts the particles back to front
+*/
+const uint32 *ParticleSorter::Sort(uint32 nNumOfParticles)
+{
+	m_bIncremental = false;
+
+	// Check the buffers
+	if (!m_pnOrder)
+		return nullptr;
+	if (nNumOfParticles > m_nMaxNumOfParticles)
+		nNumOfParticles = m_nMaxNumOfParticles;
+
+	// Get the depth range
+	float fMinDepth = nNumOfParticles ? m_pfDepths[0] : 0.0f;
+	float fMaxDepth = fMinDepth;
+	for (uint32 i=1; i<nNumOfParticles; i++) {
+		if (fMinDepth > m_pfDepths[i])
+			fMinDepth = m_pfDepths[i];
+		else if (fMaxDepth < m_pfDepths[i])
+			fMaxDepth = m_pfDepths[i];
+	}
+
+	// Quantize the depths, the farthest particle gets the key 0
+	const float fScale = (fMaxDepth > fMinDepth) ? 65535.0f/(fMaxDepth - fMinDepth) : 0.0f;
+	for (uint32 i=0; i<nNumOfParticles; i++)
+		m_pnKeys[i] = static_cast<uint16>((fMaxDepth - m_pfDepths[i])*fScale);
+
+	// Adapt the previous order to the current number of particles, the previous order is a permutation of [0, m_nNumOfOrdered)
+	// so after removing the indices >= nNumOfParticles or appending the new indices, it's a permutation of [0, nNumOfParticles)
+	if (nNumOfParticles < m_nNumOfOrdered) {
+		uint32 nNumOfOrdered = 0;
+		for (uint32 i=0; i<m_nNumOfOrdered; i++) {
+			if (m_pnOrder[i] < nNumOfParticles)
+				m_pnOrder[nNumOfOrdered++] = m_pnOrder[i];
+		}
+	} else {
+		for (uint32 i=m_nNumOfOrdered; i<nNumOfParticles; i++)
+			m_pnOrder[i] = i;
+	}
+	const bool bPreviousOrder = (m_nNumOfOrdered != 0);
+	m_nNumOfOrdered = nNumOfParticles;
+
+	// Gather the keys in the current order, so both sorts work on continuous memory
+	for (uint32 i=0; i<nNumOfParticles; i++) {
+		SortItem &sItem = m_pSortItems[i];
+		sItem.nIndex = m_pnOrder[i];
+		sItem.nKey	 = m_pnKeys[sItem.nIndex];
+	}
+
+	// Repair the previous order if the view direction didn't change a lot, else sort again (the radix sort is stable,
+	// so particles with the same key keep their previous order which avoids flickering). After the insertion sort was
+	// aborted, it's not used for some sorts because the particles are obviously moving too fast.
+	if (bPreviousOrder && m_bCoherentView) {
+		if (m_nInsertionSortDelay) {
+			m_nInsertionSortDelay--;
+		} else {
+			m_bIncremental = InsertionSort(nNumOfParticles);
+			if (m_bIncremental) {
+				for (uint32 i=0; i<nNumOfParticles; i++)
+					m_pnOrder[i] = m_pSortItems[i].nIndex;
+			} else {
+				m_nInsertionSortDelay = InsertionSortDelay;
+			}
+		}
+	}
+	if (!m_bIncremental)
+		RadixSort(nNumOfParticles);
+
+	// Done
+	return m_pnOrder;
+}
+
+
+//[-------------------------------------------------------]
+//[ Private functions                                     ]
+//[-------------------------------------------------------]
+/**
+*  @brief
+*    Copy constructor
+*/
+ParticleSorter::ParticleSorter(const ParticleSorter &cSource) :
+	m_nMaxNumOfParticles(0),
+	m_pfDepths(nullptr),
+	m_pnKeys(nullptr),
+	m_pnOrder(nullptr),
+	m_pSortItems(nullptr),
+	m_nNumOfOrdered(0),
+	m_nInsertionSortDelay(0),
+	m_bCoherentView(false),
+	m_bIncremental(false)
+{
+	// No implementation because the copy constructor is never used
+}
+
+/**
+*  @brief
+*    Copy operator
+*/
+ParticleSorter &ParticleSorter::operator =(const ParticleSorter &cSource)
+{
+	// No implementation because the copy operator is never used
+	return *this;
+}
+
+/**
+*  @brief
+*    Repairs the current order by using an insertion sort
+*/
+bool ParticleSorter::InsertionSort(uint32 nNumOfParticles)
+{
+	// If the insertion sort has to move more particles, the order is too different and the radix sort is faster
+	uint32 nNumOfMoves = 0;
+	const uint32 nMaxNumOfMoves = nNumOfParticles*InsertionSortMoves;
+
+	// Sort by ascending keys
+	for (uint32 i=1; i<nNumOfParticles; i++) {
+		const SortItem sItem = m_pSortItems[i];
+		uint32 j = i;
+		for (; j>0 && m_pSortItems[j-1].nKey>sItem.nKey; j--)
+			m_pSortItems[j] = m_pSortItems[j-1];
+		m_pSortItems[j] = sItem;
+
+		// Abort? (the order is still a valid permutation)
+		nNumOfMoves += i - j;
+		if (nNumOfMoves > nMaxNumOfMoves)
+			return false; // Error!
+	}
+
+	// Done
+	return true;
+}
+
+/**
+*  @brief
+*    Sorts the current order by using a radix sort
+*/
+void ParticleSorter::RadixSort(uint32 nNumOfParticles)
+{
+	// Build the histograms of both key bytes within one pass
+	uint32 nOffsets[2][256];
+	MemoryManager::Set(nOffsets, 0, sizeof(nOffsets));
+	for (uint32 i=0; i<nNumOfParticles; i++) {
+		const uint32 nKey = m_pSortItems[i].nKey;
+		nOffsets[0][nKey & 0xFF]++;
+		nOffsets[1][nKey >> 8]++;
+	}
+
+	// Turn the histograms into bucket offsets
+	for (int nPass=0; nPass<2; nPass++) {
+		uint32 nOffset = 0;
+		for (uint32 nBucket=0; nBucket<256; nBucket++) {
+			const uint32 nCount = nOffsets[nPass][nBucket];
+			nOffsets[nPass][nBucket] = nOffset;
+			nOffset += nCount;
+		}
+	}
+
+	// Pass 1: Sort by the low key byte into the second half of the sort buffer
+	SortItem *pSortItems = &m_pSortItems[m_nMaxNumOfParticles];
+	for (uint32 i=0; i<nNumOfParticles; i++) {
+		const SortItem &sItem = m_pSortItems[i];
+		pSortItems[nOffsets[0][sItem.nKey & 0xFF]++] = sItem;
+	}
+
+	// Pass 2: Sort by the high key byte into the order
+	for (uint32 i=0; i<nNumOfParticles; i++) {
+		const SortItem &sItem = pSortItems[i];
+		m_pnOrder[nOffsets[1][sItem.nKey >> 8]++] = sItem.nIndex;
+	}
+}
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+} // PLParticleGroups
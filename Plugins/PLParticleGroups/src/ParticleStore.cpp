@@ -0,0 +1,458 @@
+/*********************************************************\
+ *  File: ParticleStore.cpp                              *
+ *
+ *  Copyright (C) 2002-2013 The PixelLight Team (http://www.pixellight.org/)
+ *
+ *  This file is part of PixelLight.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ *  and associated documentation files (the "Software"), to deal in the Software without
+ *  restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ *  Software is furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all copies or
+ *  substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ *  BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ *  DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ *  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include <float.h>
+#include <PLCore/Core/MemoryManager.h>
+#include <PLCore/System/JobSystem.h>
+#include <PLMath/Math.h>
+#include "PLParticleGroups/ParticleStore.h"
+#ifdef PLMATH_SSE
+	#include <xmmintrin.h>
+#endif
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+using namespace PLCore;
+using namespace PLMath;
+namespace PLParticleGroups {
+
+
+//[-------------------------------------------------------]
+//[ Public functions                                      ]
+//[-------------------------------------------------------]
+/**
+*  @brief
+*    Default constructor
+*/
+ParticleStore::ParticleStore() :
+	m_nMaxNumOfParticles(0),
+	m_nNumOfParticles(0),
+	m_pfStreams(nullptr),
+	m_pnAnimationSteps(nullptr),
+	m_pUpdateRanges(nullptr),
+	m_bBoundingBoxDirty(false)
+{
+}
+
+/**
+*  @brief
+*    Destructor
+*/
+ParticleStore::~ParticleStore()
+{
+	Allocate(0);
+}
+
+/**
+*  @brief
+*    Allocates the particle streams
+*/
+void ParticleStore::Allocate(uint32 nMaxNumOfParticles)
+{
+	// Free the old streams
+	if (m_pfStreams) {
+		delete [] m_pfStreams;
+		m_pfStreams = nullptr;
+	}
+	if (m_pnAnimationSteps) {
+		delete [] m_pnAnimationSteps;
+		m_pnAnimationSteps = nullptr;
+	}
+	if (m_pUpdateRanges) {
+		delete [] m_pUpdateRanges;
+		m_pUpdateRanges = nullptr;
+	}
+	m_nMaxNumOfParticles = nMaxNumOfParticles;
+	m_nNumOfParticles	 = 0;
+
+	// Allocate the new streams, all float streams are within one continuous memory block
+	if (m_nMaxNumOfParticles) {
+		m_pfStreams		   = new float[NumOfStreams*m_nMaxNumOfParticles];
+		m_pnAnimationSteps = new uint32[m_nMaxNumOfParticles];
+		m_pUpdateRanges	   = new UpdateRange[(m_nMaxNumOfParticles + ParticlesPerJob - 1)/ParticlesPerJob];
+	}
+
+	// Reset the bounding box
+	m_cBoundingBox.vMin = m_cBoundingBox.vMax = Vector3::Zero;
+	m_bBoundingBoxDirty = false;
+}
+
+/**
+*  @brief
+*    Adds new particles
+*/
+uint32 ParticleStore::Add(uint32 nNumOfParticles)
+{
+	// Particle limitation reached?
+	if (m_nNumOfParticles + nNumOfParticles > m_nMaxNumOfParticles)
+		nNumOfParticles = m_nMaxNumOfParticles - m_nNumOfParticles;
+
+	// Initialize the new particles
+	if (nNumOfParticles) {
+		for (uint32 nStream=0; nStream<NumOfStreams; nStream++)
+			MemoryManager::Set(&m_pfStreams[nStream*m_nMaxNumOfParticles + m_nNumOfParticles], 0, nNumOfParticles*sizeof(float));
+		MemoryManager::Set(&m_pnAnimationSteps[m_nNumOfParticles], 0, nNumOfParticles*sizeof(uint32));
+		m_nNumOfParticles  += nNumOfParticles;
+		m_bBoundingBoxDirty = true;
+	}
+
+	// Done
+	return nNumOfParticles;
+}
+
+/**
+*  @brief
+*    Removes a particle
+*/
+void ParticleStore::Remove(uint32 nIndex)
+{
+	// Move the last particle into the gap
+	m_nNumOfParticles--;
+	if (nIndex != m_nNumOfParticles) {
+		for (uint32 nStream=0; nStream<NumOfStreams; nStream++) {
+			float *pfStream = &m_pfStreams[nStream*m_nMaxNumOfParticles];
+			pfStream[nIndex] = pfStream[m_nNumOfParticles];
+		}
+		m_pnAnimationSteps[nIndex] = m_pnAnimationSteps[m_nNumOfParticles];
+	}
+	m_bBoundingBoxDirty = true;
+}
+
+/**
+*  @brief
+*    Removes all particles
+*/
+void ParticleStore::Clear()
+{
+	m_nNumOfParticles = 0;
+	m_cBoundingBox.vMin = m_cBoundingBox.vMax = Vector3::Zero;
+	m_bBoundingBoxDirty = false;
+}
+
+/**
+*  @brief
+*    Integrates the particles, removes the particles without energy and updates the bounding box
+*/
+void ParticleStore::Update(const Physics &sPhysics, bool bParallel)
+{
+	// Nothing to do?
+	if (!m_nNumOfParticles)
+		return;
+
+	// Split the particles into ranges, one per job - small stores are updated as one range on the calling thread
+	const uint32 nNumOfRanges = (bParallel && m_nNumOfParticles > ParticlesPerJob) ? (m_nNumOfParticles + ParticlesPerJob - 1)/ParticlesPerJob : 1;
+	const uint32 nRangeSize	  = (nNumOfRanges > 1) ? ParticlesPerJob : m_nNumOfParticles;
+	for (uint32 i=0; i<nNumOfRanges; i++) {
+		UpdateRange &sRange = m_pUpdateRanges[i];
+		sRange.pStore	= this;
+		sRange.pPhysics = &sPhysics;
+		sRange.nFirst	= i*nRangeSize;
+		sRange.nEnd		= Math::Min(sRange.nFirst + nRangeSize, m_nNumOfParticles);
+	}
+
+	// Integrate the ranges, use the worker threads of the job system if there are any
+	JobSystem *pJobSystem = (nNumOfRanges > 1) ? JobSystem::GetInstance() : nullptr;
+	if (pJobSystem && pJobSystem->GetNumOfWorkers())
+		pJobSystem->ParallelFor(nNumOfRanges, 1, &ParticleStore::UpdateRanges, m_pUpdateRanges);
+	else
+		UpdateRanges(0, nNumOfRanges, m_pUpdateRanges);
+
+	// Merge the bounding boxes of the ranges and remove the particles without energy, only ranges
+	// with such particles have to be visited (a particle moved into a gap is checked again)
+	float fMin[3] = {  FLT_MAX,  FLT_MAX,  FLT_MAX };
+	float fMax[3] = { -FLT_MAX, -FLT_MAX, -FLT_MAX };
+	const float *pfEnergy = &m_pfStreams[Energy*m_nMaxNumOfParticles];
+	for (uint32 i=0; i<nNumOfRanges; i++) {
+		const UpdateRange &sRange = m_pUpdateRanges[i];
+		for (int nAxis=0; nAxis<3; nAxis++) {
+			if (fMin[nAxis] > sRange.fMin[nAxis])
+				fMin[nAxis] = sRange.fMin[nAxis];
+			if (fMax[nAxis] < sRange.fMax[nAxis])
+				fMax[nAxis] = sRange.fMax[nAxis];
+		}
+		if (sRange.nNumOfDead) {
+			for (uint32 nParticle=sRange.nFirst; nParticle<sRange.nEnd && nParticle<m_nNumOfParticles;) {
+				if (pfEnergy[nParticle] < 0.0f)
+					Remove(nParticle);
+				else
+					nParticle++;
+			}
+		}
+	}
+
+	// Set the bounding box
+	if (m_nNumOfParticles) {
+		m_cBoundingBox.vMin.SetXYZ(fMin[0], fMin[1], fMin[2]);
+		m_cBoundingBox.vMax.SetXYZ(fMax[0], fMax[1], fMax[2]);
+	} else {
+		m_cBoundingBox.vMin = m_cBoundingBox.vMax = Vector3::Zero;
+	}
+	m_bBoundingBoxDirty = false;
+}
+
+/**
+*  @brief
+*    Returns the bounding box of all particles
+*/
+const AABoundingBox &ParticleStore::GetBoundingBox()
+{
+	if (m_bBoundingBoxDirty)
+		CalculateBoundingBox();
+	return m_cBoundingBox;
+}
+
+
+//[-------------------------------------------------------]
+//[ Private static functions                              ]
+//[-------------------------------------------------------]
+/**
+*  @brief
+*    Job system parallel for function updating a range of update ranges
+*/
+void ParticleStore::UpdateRanges(uint32 nFirst, uint32 nEnd, void *pData)
+{
+	UpdateRange *pRanges = static_cast<UpdateRange*>(pData);
+	for (uint32 i=nFirst; i<nEnd; i++) {
+		UpdateRange &sRange = pRanges[i];
+		sRange.pStore->IntegrateRange(sRange);
+	}
+}
+
+
+//[-------------------------------------------------------]
+//[ Private functions                                     ]
+//[-------------------------------------------------------]
+/**
+*  @brief
+*    Copy constructor
+*/
+ParticleStore::ParticleStore(const ParticleStore &cSource) :
+	m_nMaxNumOfParticles(0),
+	m_nNumOfParticles(0),
+	m_pfStreams(nullptr),
+	m_pnAnimationSteps(nullptr),
+	m_pUpdateRanges(nullptr),
+	m_bBoundingBoxDirty(false)
+{
+	// No implementation because the copy constructor is never used
+}
+
+/**
+*  @brief
+*    Copy operator
+*/
+ParticleStore &ParticleStore::operator =(const ParticleStore &cSource)
+{
+	// No implementation because the copy operator is never used
+	return *this;
+}
+
+/**
+*  @brief
+*    Integrates the particles of an update range and calculates the bounding box of the range
+*/
+void ParticleStore::IntegrateRange(UpdateRange &sRange)
+{
+	const Physics &sPhysics    = *sRange.pPhysics;
+	float		  *pfPositionX = &m_pfStreams[PositionX*m_nMaxNumOfParticles];
+	float		  *pfPositionY = &m_pfStreams[PositionY*m_nMaxNumOfParticles];
+	float		  *pfPositionZ = &m_pfStreams[PositionZ*m_nMaxNumOfParticles];
+	float		  *pfVelocityX = &m_pfStreams[VelocityX*m_nMaxNumOfParticles];
+	float		  *pfVelocityY = &m_pfStreams[VelocityY*m_nMaxNumOfParticles];
+	float		  *pfVelocityZ = &m_pfStreams[VelocityZ*m_nMaxNumOfParticles];
+	float		  *pfEnergy    = &m_pfStreams[Energy*m_nMaxNumOfParticles];
+	float		  *pfSize	   = &m_pfStreams[Size*m_nMaxNumOfParticles];
+	float		  *pfAlpha	   = &m_pfStreams[ColorA*m_nMaxNumOfParticles];
+
+	// The per update changes
+	const float fTimeDiff	  = sPhysics.fTimeDiff;
+	const float fEnergyLoss	  = sPhysics.fEnergyLoss*fTimeDiff;
+	const float fSizeGrowth	  = sPhysics.fSizeGrowth*fTimeDiff;
+	const float fAlphaScale	  = sPhysics.fAlphaScale;
+	const float fVelocityX	  = sPhysics.vAcceleration.x*fTimeDiff;
+	const float fVelocityY	  = sPhysics.vAcceleration.y*fTimeDiff;
+	const float fVelocityZ	  = sPhysics.vAcceleration.z*fTimeDiff;
+
+	// The particles without energy are removed later on, they don't contribute to the bounding box
+	float  fMin[3]	  = {  FLT_MAX,  FLT_MAX,  FLT_MAX };
+	float  fMax[3]	  = { -FLT_MAX, -FLT_MAX, -FLT_MAX };
+	uint32 nNumOfDead = 0;
+	uint32 i		  = sRange.nFirst;
+
+#ifdef PLMATH_SSE
+	{ // SSE method, four particles at once, each SIMD lane is one particle
+		static const uint32 NumOfBits[16] = { 0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4 };
+		const __m128 vZero		 = _mm_setzero_ps();
+		const __m128 vOne		 = _mm_set1_ps(1.0f);
+		const __m128 vMaxFloat	 = _mm_set1_ps(FLT_MAX);
+		const __m128 vMinFloat	 = _mm_set1_ps(-FLT_MAX);
+		const __m128 vTimeDiff	 = _mm_set1_ps(fTimeDiff);
+		const __m128 vEnergyLoss = _mm_set1_ps(fEnergyLoss);
+		const __m128 vSizeGrowth = _mm_set1_ps(fSizeGrowth);
+		const __m128 vAlphaScale = _mm_set1_ps(fAlphaScale);
+		const __m128 vVelocityX	 = _mm_set1_ps(fVelocityX);
+		const __m128 vVelocityY	 = _mm_set1_ps(fVelocityY);
+		const __m128 vVelocityZ	 = _mm_set1_ps(fVelocityZ);
+		__m128 vMinX = vMaxFloat, vMinY = vMaxFloat, vMinZ = vMaxFloat;
+		__m128 vMaxX = vMinFloat, vMaxY = vMinFloat, vMaxZ = vMinFloat;
+		for (; i+4<=sRange.nEnd; i+=4) {
+			// Energy, size and alpha
+			const __m128 vEnergy = _mm_sub_ps(_mm_loadu_ps(&pfEnergy[i]), vEnergyLoss);
+			const __m128 vSize	 = _mm_add_ps(_mm_loadu_ps(&pfSize[i]), vSizeGrowth);
+			_mm_storeu_ps(&pfEnergy[i], vEnergy);
+			_mm_storeu_ps(&pfSize[i], vSize);
+			_mm_storeu_ps(&pfAlpha[i], _mm_min_ps(_mm_max_ps(_mm_mul_ps(vEnergy, vAlphaScale), vZero), vOne));
+
+			// Velocity and position
+			const __m128 vVelX = _mm_add_ps(_mm_loadu_ps(&pfVelocityX[i]), vVelocityX);
+			const __m128 vVelY = _mm_add_ps(_mm_loadu_ps(&pfVelocityY[i]), vVelocityY);
+			const __m128 vVelZ = _mm_add_ps(_mm_loadu_ps(&pfVelocityZ[i]), vVelocityZ);
+			const __m128 vPosX = _mm_add_ps(_mm_loadu_ps(&pfPositionX[i]), _mm_mul_ps(vVelX, vTimeDiff));
+			const __m128 vPosY = _mm_add_ps(_mm_loadu_ps(&pfPositionY[i]), _mm_mul_ps(vVelY, vTimeDiff));
+			const __m128 vPosZ = _mm_add_ps(_mm_loadu_ps(&pfPositionZ[i]), _mm_mul_ps(vVelZ, vTimeDiff));
+			_mm_storeu_ps(&pfVelocityX[i], vVelX);
+			_mm_storeu_ps(&pfVelocityY[i], vVelY);
+			_mm_storeu_ps(&pfVelocityZ[i], vVelZ);
+			_mm_storeu_ps(&pfPositionX[i], vPosX);
+			_mm_storeu_ps(&pfPositionY[i], vPosY);
+			_mm_storeu_ps(&pfPositionZ[i], vPosZ);
+
+			// Bounding box, the lanes of particles without energy are replaced by the initial minimum/maximum
+			const __m128 vDead = _mm_cmplt_ps(vEnergy, vZero);
+			nNumOfDead += NumOfBits[_mm_movemask_ps(vDead)];
+			vMinX = _mm_min_ps(vMinX, _mm_or_ps(_mm_and_ps(vDead, vMaxFloat), _mm_andnot_ps(vDead, _mm_sub_ps(vPosX, vSize))));
+			vMinY = _mm_min_ps(vMinY, _mm_or_ps(_mm_and_ps(vDead, vMaxFloat), _mm_andnot_ps(vDead, _mm_sub_ps(vPosY, vSize))));
+			vMinZ = _mm_min_ps(vMinZ, _mm_or_ps(_mm_and_ps(vDead, vMaxFloat), _mm_andnot_ps(vDead, _mm_sub_ps(vPosZ, vSize))));
+			vMaxX = _mm_max_ps(vMaxX, _mm_or_ps(_mm_and_ps(vDead, vMinFloat), _mm_andnot_ps(vDead, _mm_add_ps(vPosX, vSize))));
+			vMaxY = _mm_max_ps(vMaxY, _mm_or_ps(_mm_and_ps(vDead, vMinFloat), _mm_andnot_ps(vDead, _mm_add_ps(vPosY, vSize))));
+			vMaxZ = _mm_max_ps(vMaxZ, _mm_or_ps(_mm_and_ps(vDead, vMinFloat), _mm_andnot_ps(vDead, _mm_add_ps(vPosZ, vSize))));
+		}
+
+		// Reduce the lanes
+		float fLanes[4];
+		_mm_storeu_ps(fLanes, vMinX);
+		fMin[0] = Math::Min(fLanes[0], fLanes[1], fLanes[2], fLanes[3]);
+		_mm_storeu_ps(fLanes, vMinY);
+		fMin[1] = Math::Min(fLanes[0], fLanes[1], fLanes[2], fLanes[3]);
+		_mm_storeu_ps(fLanes, vMinZ);
+		fMin[2] = Math::Min(fLanes[0], fLanes[1], fLanes[2], fLanes[3]);
+		_mm_storeu_ps(fLanes, vMaxX);
+		fMax[0] = Math::Max(fLanes[0], fLanes[1], fLanes[2], fLanes[3]);
+		_mm_storeu_ps(fLanes, vMaxY);
+		fMax[1] = Math::Max(fLanes[0], fLanes[1], fLanes[2], fLanes[3]);
+		_mm_storeu_ps(fLanes, vMaxZ);
+		fMax[2] = Math::Max(fLanes[0], fLanes[1], fLanes[2], fLanes[3]);
+	}
+#endif
+
+	// C++ method (also used for the remaining particles of the SSE method)
+	for (; i<sRange.nEnd; i++) {
+		// Energy, size and alpha
+		pfEnergy[i] -= fEnergyLoss;
+		pfSize[i]	+= fSizeGrowth;
+		pfAlpha[i]	 = Math::Min(Math::Max(pfEnergy[i]*fAlphaScale, 0.0f), 1.0f);
+
+		// Velocity and position
+		pfVelocityX[i] += fVelocityX;
+		pfVelocityY[i] += fVelocityY;
+		pfVelocityZ[i] += fVelocityZ;
+		pfPositionX[i] += pfVelocityX[i]*fTimeDiff;
+		pfPositionY[i] += pfVelocityY[i]*fTimeDiff;
+		pfPositionZ[i] += pfVelocityZ[i]*fTimeDiff;
+
+		// Bounding box
+		if (pfEnergy[i] < 0.0f) {
+			nNumOfDead++;
+		} else {
+			const float fPosition[3] = { pfPositionX[i], pfPositionY[i], pfPositionZ[i] };
+			for (int nAxis=0; nAxis<3; nAxis++) {
+				if (fMin[nAxis] > fPosition[nAxis] - pfSize[i])
+					fMin[nAxis] = fPosition[nAxis] - pfSize[i];
+				if (fMax[nAxis] < fPosition[nAxis] + pfSize[i])
+					fMax[nAxis] = fPosition[nAxis] + pfSize[i];
+			}
+		}
+	}
+
+	// Texture animation
+	if (sPhysics.fAnimationFrameTime > 0.0f && sPhysics.nAnimationSteps > 1) {
+		float  *pfAnimationTimer = &m_pfStreams[AnimationTimer*m_nMaxNumOfParticles];
+		uint32 *pnAnimationSteps = m_pnAnimationSteps;
+		for (i=sRange.nFirst; i<sRange.nEnd; i++) {
+			pfAnimationTimer[i] += fTimeDiff;
+			if (pfAnimationTimer[i] > sPhysics.fAnimationFrameTime) {
+				pfAnimationTimer[i] = 0.0f;
+				pnAnimationSteps[i] = (pnAnimationSteps[i] + 1 < sPhysics.nAnimationSteps) ? pnAnimationSteps[i] + 1 : 0;
+			}
+		}
+	}
+
+	// Write back the results of the range
+	sRange.nNumOfDead = nNumOfDead;
+	for (int nAxis=0; nAxis<3; nAxis++) {
+		sRange.fMin[nAxis] = fMin[nAxis];
+		sRange.fMax[nAxis] = fMax[nAxis];
+	}
+}
+
+/**
+*  @brief
+*    Calculates the bounding box of all particles
+*/
+void ParticleStore::CalculateBoundingBox()
+{
+	if (m_nNumOfParticles) {
+		const float *pfPositionX = &m_pfStreams[PositionX*m_nMaxNumOfParticles];
+		const float *pfPositionY = &m_pfStreams[PositionY*m_nMaxNumOfParticles];
+		const float *pfPositionZ = &m_pfStreams[PositionZ*m_nMaxNumOfParticles];
+		const float *pfSize		 = &m_pfStreams[Size*m_nMaxNumOfParticles];
+		float fMin[3] = {  FLT_MAX,  FLT_MAX,  FLT_MAX };
+		float fMax[3] = { -FLT_MAX, -FLT_MAX, -FLT_MAX };
+		for (uint32 i=0; i<m_nNumOfParticles; i++) {
+			const float fPosition[3] = { pfPositionX[i], pfPositionY[i], pfPositionZ[i] };
+			for (int nAxis=0; nAxis<3; nAxis++) {
+				if (fMin[nAxis] > fPosition[nAxis] - pfSize[i])
+					fMin[nAxis] = fPosition[nAxis] - pfSize[i];
+				if (fMax[nAxis] < fPosition[nAxis] + pfSize[i])
+					fMax[nAxis] = fPosition[nAxis] + pfSize[i];
+			}
+		}
+		m_cBoundingBox.vMin.SetXYZ(fMin[0], fMin[1], fMin[2]);
+		m_cBoundingBox.vMax.SetXYZ(fMax[0], fMax[1], fMax[2]);
+	} else {
+		m_cBoundingBox.vMin = m_cBoundingBox.vMax = Vector3::Zero;
+	}
+	m_bBoundingBoxDirty = false;
+}
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+} // PLParticleGroups
@@ -43,6 +43,7 @@
 //[-------------------------------------------------------]
 using namespace PLCore;
 using namespace PLMath;
+using namespace PLGraphics;
 using namespace PLRenderer;
 using namespace PLScene;
 namespace PLParticleGroups {
@@ -164,10 +165,13 @@ void SNParticleGroup::SetTextureAnimationRows(const uint32 &nValue)
 void SNParticleGroup::SetFlags(uint32 nValue)
 {
 	if (GetFlags() != nValue) {
+		// The 'DepthSort'-flag is applied as soon as the particles are drawn the next time, all other flags require a reinitialization
+		const bool bReinitialize = ((GetFlags() ^ nValue) & ~DepthSort) != 0;
+
 		// Call base implementation
 		SceneNode::SetFlags(nValue);
 
-		if (IsInitialized()) {
+		if (bReinitialize && IsInitialized()) {
 			DeInitFunction();
 			InitFunction();
 		}
@@ -203,7 +207,7 @@ uint32 SNParticleGroup::GetMaxNumOfParticles() const
 */
 uint32 SNParticleGroup::GetNumOfParticles() const
 {
-	return m_lstParticles.GetNumOfElements();
+	return m_lstParticles.GetNumOfElements() + m_cParticleStore.GetNumOfParticles();
 }
 
 /**
@@ -215,7 +219,7 @@ SNParticleGroup::Particle *SNParticleGroup::AddParticle()
 	// Is the creation of new particles allowed?
 	if (m_bCreateParticles) {
 		// Particle limitation reached?
-		if (m_lstParticles.GetNumOfElements() < m_nMaxNumOfParticles) {
+		if (GetNumOfParticles() < m_nMaxNumOfParticles) {
 			// Add/get particle
 			Particle &cParticle = m_lstParticles.Add();
 			return (&cParticle != &FastPool<Particle>::Null) ? &cParticle : nullptr;
@@ -244,6 +248,32 @@ Iterator<SNParticleGroup::Particle> SNParticleGroup::GetParticleIterator() const
 	return m_lstParticles.GetIterator();
 }
 
+/**
+*  @brief
+*    Returns the particle store
+*/
+ParticleStore *SNParticleGroup::GetParticleStore()
+{
+	return m_bUseParticleStore ? &m_cParticleStore : nullptr;
+}
+
+/**
+*  @brief
+*    Adds new particles to the particle store
+*/
+uint32 SNParticleGroup::AddStoreParticles(uint32 nNumOfParticles)
+{
+	// Is the creation of new particles allowed?
+	if (m_bCreateParticles && m_bUseParticleStore) {
+		// Particle limitation reached?
+		const uint32 nNumOfFreeParticles = m_nMaxNumOfParticles - GetNumOfParticles();
+		return m_cParticleStore.Add((nNumOfParticles < nNumOfFreeParticles) ? nNumOfParticles : nNumOfFreeParticles);
+	}
+
+	// Error!
+	return 0;
+}
+
 /**
 *  @brief
 *    Returns whether the particle group can create new particles or not
@@ -365,7 +395,8 @@ SNParticleGroup::SNParticleGroup() :
 	m_nUsedVertices(0),
 	m_bRemoveAutomatically(false),
 	m_nMaxNumOfParticles(0),
-	m_bCreateParticles(true)
+	m_bCreateParticles(true),
+	m_bUseParticleStore(false)
 {
 	// Set draw function flags
 	SetDrawFunctionFlags(static_cast<uint8>(GetDrawFunctionFlags() | UseDrawSolid | UseDrawTransparent));
@@ -387,12 +418,16 @@ bool SNParticleGroup::InitParticles(uint32 nMaxNumOfParticles, const String &sMa
 {
 	// Delete the old particles
 	m_lstParticles.Clear();
+	m_cParticleStore.Allocate(0);
+	m_cParticleSorter.Allocate(0);
 	m_nMaxNumOfParticles = 0;
 
 	// Check parameter
 	if (!nMaxNumOfParticles)
 		return false; // Error!
 	m_nMaxNumOfParticles = nMaxNumOfParticles;
+	if (m_bUseParticleStore)
+		m_cParticleStore.Allocate(m_nMaxNumOfParticles);
 
 	// Get the renderer
 	Renderer &cRenderer = GetSceneContext()->GetRendererContext().GetRenderer();
@@ -419,23 +454,8 @@ bool SNParticleGroup::InitParticles(uint32 nMaxNumOfParticles, const String &sMa
 		if (m_pIndexBuffer)
 			delete m_pIndexBuffer;
 		m_pIndexBuffer = cRenderer.CreateIndexBuffer();
-		m_pIndexBuffer->Allocate(m_nMaxNumOfParticles*6, Usage::Static, false);
-		if (m_pIndexBuffer->Lock(Lock::WriteOnly)) {
-			for (uint32 i=0, nVertices=4, nIndex=0; i<m_nMaxNumOfParticles; i++, nVertices+=4) {
-				// Triangle 1
-				m_pIndexBuffer->SetData(nIndex++, nVertices-4);
-				m_pIndexBuffer->SetData(nIndex++, nVertices-3);
-				m_pIndexBuffer->SetData(nIndex++, nVertices-2);
-
-				// Triangle 2
-				m_pIndexBuffer->SetData(nIndex++, nVertices-4);
-				m_pIndexBuffer->SetData(nIndex++, nVertices-2);
-				m_pIndexBuffer->SetData(nIndex++, nVertices-1);
-			}
-
-			// Unlock the index buffer
-			m_pIndexBuffer->Unlock();
-		}
+		m_pIndexBuffer->SetElementTypeByMaximumIndex(m_nMaxNumOfParticles*4 - 1);
+		SetupIndexBuffer();
 
 		// Setup the vertex buffer
 		if (m_pVertexBuffer)
@@ -474,6 +494,15 @@ bool SNParticleGroup::InitParticles(uint32 nMaxNumOfParticles, const String &sMa
 	return true;
 }
 
+/**
+*  @brief
+*    Updates the particles of the particle store
+*/
+void SNParticleGroup::UpdateParticleStore(const ParticleStore::Physics &sPhysics)
+{
+	m_cParticleStore.Update(sPhysics, (GetFlags() & ParallelUpdate) != 0);
+}
+
 
 //[-------------------------------------------------------]
 //[ Private functions                                     ]
@@ -490,6 +519,17 @@ void SNParticleGroup::CreateShapes()
 		const uint32 nVertexSize = m_pVertexBuffer->GetVertexSize();
 		float *pfPosition = static_cast<float*>(m_pVertexBuffer->GetData(0, VertexBuffer::Position));
 
+		// Particle store data, the particles of the particle store are behind the particles of the particle list
+		const ParticleStore &cParticleStore		  = m_cParticleStore;
+		const uint32		 nNumOfStoreParticles = Math::Min(cParticleStore.GetNumOfParticles(), m_nMaxNumOfParticles - m_lstParticles.GetNumOfElements());
+		const float			*pfPositionX		  = cParticleStore.GetStream(ParticleStore::PositionX);
+		const float			*pfPositionY		  = cParticleStore.GetStream(ParticleStore::PositionY);
+		const float			*pfPositionZ		  = cParticleStore.GetStream(ParticleStore::PositionZ);
+		const float			*pfColorR			  = cParticleStore.GetStream(ParticleStore::ColorR);
+		const float			*pfColorG			  = cParticleStore.GetStream(ParticleStore::ColorG);
+		const float			*pfColorB			  = cParticleStore.GetStream(ParticleStore::ColorB);
+		const float			*pfColorA			  = cParticleStore.GetStream(ParticleStore::ColorA);
+
 		// Particle data
 		if (GetFlags() & PointSprites) {
 			m_nUsedVertices = 0;
@@ -505,6 +545,15 @@ void SNParticleGroup::CreateShapes()
 						m_nUsedVertices++;
 					}
 				}
+
+				// Particle store
+				for (uint32 i=0; i<nNumOfStoreParticles; i++) {
+					pfPosition[0] = pfPositionX[i];
+					pfPosition[1] = pfPositionY[i];
+					pfPosition[2] = pfPositionZ[i];
+					pfPosition = reinterpret_cast<float*>(reinterpret_cast<char*>(pfPosition)+nVertexSize);
+					m_nUsedVertices++;
+				}
 			} else {
 				Iterator<Particle> cIterator = m_lstParticles.GetIterator();
 				while (cIterator.HasNext()) {
@@ -518,6 +567,16 @@ void SNParticleGroup::CreateShapes()
 						m_nUsedVertices++;
 					}
 				}
+
+				// Particle store
+				for (uint32 i=0; i<nNumOfStoreParticles; i++) {
+					pfPosition[0] = pfPositionX[i];
+					pfPosition[1] = pfPositionY[i];
+					pfPosition[2] = pfPositionZ[i];
+					pfPosition = reinterpret_cast<float*>(reinterpret_cast<char*>(pfPosition)+nVertexSize);
+					m_pVertexBuffer->SetColor(m_nUsedVertices, Color4(pfColorR[i], pfColorG[i], pfColorB[i], pfColorA[i]));
+					m_nUsedVertices++;
+				}
 			}
 		} else {
 			// Get billboard information
@@ -538,6 +597,15 @@ void SNParticleGroup::CreateShapes()
 			Vector3 vBottomRightT = vX+vY;
 			vX.Invert();
 
+			// The 'DepthSort'-flag may have been changed since the index buffer was set up
+			const bool bDepthSort = (GetFlags() & DepthSort) != 0;
+			if (bDepthSort != (m_cParticleSorter.GetMaxNumOfParticles() != 0))
+				SetupIndexBuffer();
+
+			// Setup the particle sorter, the particle positions are transformed into view space by using the world view matrix
+			if (bDepthSort)
+				m_cParticleSorter.SetView(pFixedFunctions ? mView*pFixedFunctions->GetTransformState(FixedFunctions::Transform::World) : Matrix4x4::Identity);
+
 			// Create the particle shapes
 			float *pfTexCoord = static_cast<float*>(m_pVertexBuffer->GetData(0, VertexBuffer::TexCoord));
 			Vector3 vRight, vUp, vXT, vYT;
@@ -674,10 +742,40 @@ void SNParticleGroup::CreateShapes()
 						m_nUsedVertices++;
 
 						// Setup indices
+						if (bDepthSort)
+							m_cParticleSorter.SetPosition(m_nUsedIndices/6, vPos);
 						m_nUsedIndices += 6;
 					}
 				}
 			}
+
+			// Particle store, quite standard particles only - all data is read in one linear pass over the streams
+			const float	 *pfSize		   = cParticleStore.GetStream(ParticleStore::Size);
+			const uint32 *pnAnimationSteps = cParticleStore.GetAnimationSteps();
+			const Vector3 vCorners[4]	   = { vTopLeftT, vTopRightT, vBottomRightT, vBottomLeftT };
+			for (uint32 i=0; i<nNumOfStoreParticles; i++) {
+				const uint32   nAnimationStep	  = (pnAnimationSteps[i] < m_lstTexCoord.GetNumOfElements()) ? pnAnimationSteps[i] : 0;
+				const Vector2 *pvParticleTexCoord = m_lstTexCoord[nAnimationStep].vTexCoord;
+				const Color4   cColor(pfColorR[i], pfColorG[i], pfColorB[i], pfColorA[i]);
+				for (int nCorner=0; nCorner<4; nCorner++) {
+					pfPosition[0] = pfPositionX[i] + vCorners[nCorner].x*pfSize[i];
+					pfPosition[1] = pfPositionY[i] + vCorners[nCorner].y*pfSize[i];
+					pfPosition[2] = pfPositionZ[i] + vCorners[nCorner].z*pfSize[i];
+					pfPosition = reinterpret_cast<float*>(reinterpret_cast<char*>(pfPosition)+nVertexSize);
+					pfTexCoord[0] = pvParticleTexCoord[nCorner].x;
+					pfTexCoord[1] = pvParticleTexCoord[nCorner].y;
+					pfTexCoord = reinterpret_cast<float*>(reinterpret_cast<char*>(pfTexCoord)+nVertexSize);
+					m_pVertexBuffer->SetColor(m_nUsedVertices, cColor);
+					m_nUsedVertices++;
+				}
+				if (bDepthSort)
+					m_cParticleSorter.SetPosition(m_nUsedIndices/6, Vector3(pfPositionX[i], pfPositionY[i], pfPositionZ[i]));
+				m_nUsedIndices += 6;
+			}
+
+			// Write the indices from back to front
+			if (bDepthSort)
+				WriteSortedIndices();
 		}
 
 		// Unlock the vertex buffer
@@ -727,6 +825,100 @@ void SNParticleGroup::DrawShapes(Renderer &cRenderer)
 	}
 }
 
+/**
+*  @brief
+*    Writes the indices of the particle shapes from back to front into the index buffer
+*/
+void SNParticleGroup::WriteSortedIndices()
+{
+	// Sort the particle shapes, each shape consists of 4 vertices and 6 indices
+	const uint32  nNumOfShapes = m_nUsedIndices/6;
+	const uint32 *pnOrder	   = m_cParticleSorter.Sort(nNumOfShapes);
+	if (pnOrder && m_pIndexBuffer->Lock(Lock::WriteOnly)) {
+		switch (m_pIndexBuffer->GetElementType()) {
+			case IndexBuffer::UInt:
+			{
+				uint32 *pnIndex = static_cast<uint32*>(m_pIndexBuffer->GetData());
+				for (uint32 i=0; i<nNumOfShapes; i++, pnIndex+=6) {
+					const uint32 nVertex = pnOrder[i]*4;
+					pnIndex[0] = nVertex;
+					pnIndex[1] = nVertex + 1;
+					pnIndex[2] = nVertex + 2;
+					pnIndex[3] = nVertex;
+					pnIndex[4] = nVertex + 2;
+					pnIndex[5] = nVertex + 3;
+				}
+				break;
+			}
+
+			case IndexBuffer::UShort:
+			{
+				uint16 *pnIndex = static_cast<uint16*>(m_pIndexBuffer->GetData());
+				for (uint32 i=0; i<nNumOfShapes; i++, pnIndex+=6) {
+					const uint16 nVertex = static_cast<uint16>(pnOrder[i]*4);
+					pnIndex[0] = nVertex;
+					pnIndex[1] = nVertex + 1;
+					pnIndex[2] = nVertex + 2;
+					pnIndex[3] = nVertex;
+					pnIndex[4] = nVertex + 2;
+					pnIndex[5] = nVertex + 3;
+				}
+				break;
+			}
+
+			case IndexBuffer::UByte:
+			{
+				uint8 *pnIndex = static_cast<uint8*>(m_pIndexBuffer->GetData());
+				for (uint32 i=0; i<nNumOfShapes; i++, pnIndex+=6) {
+					const uint8 nVertex = static_cast<uint8>(pnOrder[i]*4);
+					pnIndex[0] = nVertex;
+					pnIndex[1] = nVertex + 1;
+					pnIndex[2] = nVertex + 2;
+					pnIndex[3] = nVertex;
+					pnIndex[4] = nVertex + 2;
+					pnIndex[5] = nVertex + 3;
+				}
+				break;
+			}
+		}
+
+		// Unlock the index buffer
+		m_pIndexBuffer->Unlock();
+	}
+}
+
+/**
+*  @brief
+*    Sets up the index buffer and the particle sorter depending on the 'DepthSort'-flag
+*/
+void SNParticleGroup::SetupIndexBuffer()
+{
+	// If the particles are sorted, the indices are written each time the particles are drawn
+	if (GetFlags() & DepthSort) {
+		m_cParticleSorter.Allocate(m_nMaxNumOfParticles);
+		m_pIndexBuffer->Allocate(m_nMaxNumOfParticles*6, Usage::Dynamic, false);
+	} else {
+		m_cParticleSorter.Allocate(0);
+		m_pIndexBuffer->Allocate(m_nMaxNumOfParticles*6, Usage::Static, false);
+	}
+	if (m_pIndexBuffer->Lock(Lock::WriteOnly)) {
+		for (uint32 i=0, nVertices=4, nIndex=0; i<m_nMaxNumOfParticles; i++, nVertices+=4) {
+			// Triangle 1
+			m_pIndexBuffer->SetData(nIndex++, nVertices-4);
+			m_pIndexBuffer->SetData(nIndex++, nVertices-3);
+			m_pIndexBuffer->SetData(nIndex++, nVertices-2);
+
+			// Triangle 2
+			m_pIndexBuffer->SetData(nIndex++, nVertices-4);
+			m_pIndexBuffer->SetData(nIndex++, nVertices-2);
+			m_pIndexBuffer->SetData(nIndex++, nVertices-1);
+		}
+
+		// Unlock the index buffer
+		m_pIndexBuffer->Unlock();
+	}
+}
+
 
 //[-------------------------------------------------------]
 //[ Public virtual SceneNode functions                    ]
@@ -810,6 +1002,8 @@ void SNParticleGroup::DeInitFunction()
 {
 	// Destroy particles
 	m_lstParticles.Clear();
+	m_cParticleStore.Allocate(0);
+	m_cParticleSorter.Allocate(0);
 	m_nMaxNumOfParticles = 0;
 
 	// Delete the index buffer
@@ -882,6 +1076,18 @@ void SNParticleGroup::UpdateAABoundingBox()
 		}
 	}
 
+	// Add the particles of the particle store, their bounding box was already calculated by the last update
+	if (m_cParticleStore.GetNumOfParticles()) {
+		const AABoundingBox &cStoreBoundingBox = m_cParticleStore.GetBoundingBox();
+		for (int i=0; i<3; i++) {
+			if (!bActiveParticles || cStoreBoundingBox.vMin[i] < fBoundingBox[0][i])
+				fBoundingBox[0][i] = cStoreBoundingBox.vMin[i];
+			if (!bActiveParticles || cStoreBoundingBox.vMax[i] > fBoundingBox[1][i])
+				fBoundingBox[1][i] = cStoreBoundingBox.vMax[i];
+		}
+		bActiveParticles = true;
+	}
+
 	// Set bounding box
 	AABoundingBox cAABoundingBox(fBoundingBox[0][Vector3::X], fBoundingBox[0][Vector3::Y], fBoundingBox[0][Vector3::Z],
 								 fBoundingBox[1][Vector3::X], fBoundingBox[1][Vector3::Y], fBoundingBox[1][Vector3::Z]);
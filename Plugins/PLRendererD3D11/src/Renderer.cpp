@@ -700,46 +700,6 @@ PLRenderer::OcclusionQuery *Renderer::CreateOcclusionQuery()
 }
 
 
-//[-------------------------------------------------------]
-//[ States                                                ]
-//[-------------------------------------------------------]
-bool Renderer::SetRenderState(PLRenderer::RenderState::Enum nState, uint32 nValue)
-{
-	// Check if the state is a valid render state member
-	if (nState >= PLRenderer::RenderState::Number)
-		return false; // Error!
-
-	// Check if this render state is already set to this value
-	if (m_nRenderState[nState] != nValue) {
-		// Set the render state
-		m_nRenderState[nState] = nValue;
-		m_sStatistics.nRenderStateChanges++;
-	}
-
-	// All went fine
-	return true;
-}
-
-bool Renderer::SetSamplerState(uint32 nStage, PLRenderer::Sampler::Enum nState, uint32 nValue)
-{
-	// Check if the stage is correct and check if the state is a valid sampler member
-	if (nStage < m_sCapabilities.nMaxTextureUnits && nState < PLRenderer::Sampler::Number) {
-		// Check if this sampler state is already set to this value
-		if (m_ppnSamplerState[nStage][nState] != nValue) {
-			// Set the sampler state
-			m_ppnSamplerState[nStage][nState] = nValue;
-			m_sStatistics.nSamplerStateChanges++;
-		}
-
-		// All went fine
-		return true;
-	} else {
-		// Error!
-		return false;
-	}
-}
-
-
 //[-------------------------------------------------------]
 //[ Misc                                                  ]
 //[-------------------------------------------------------]
@@ -919,40 +879,11 @@ bool Renderer::MakeScreenshot(Image &cImage)
 	return true;
 }
 
-bool Renderer::SetTextureBuffer(int nStage, PLRenderer::TextureBuffer *pTextureBuffer)
+bool Renderer::ApplyTextureBuffer(uint32 nStage, PLRenderer::TextureBuffer *pPreviousTextureBuffer)
 {
-	// Set all available texture stages to this setting?
-	if (nStage < 0) {
-		for (uint32 i=0; i<m_sCapabilities.nMaxTextureUnits; i++)
-			SetTextureBuffer(i, pTextureBuffer);
-	} else {
-		// Check if the stage is correct
-		if (nStage >= m_sCapabilities.nMaxTextureUnits)
-			return false; // Error!
-
-		// Is this texture buffer already set?
-		if (m_ppCurrentTextureBuffer[nStage] == pTextureBuffer)
-			return false; // Error!
-
-		// Make this texture buffer to the renderers current one
-		PLRenderer::TextureBuffer *pT = m_ppCurrentTextureBuffer[nStage];
-		m_ppCurrentTextureBuffer[nStage] = pTextureBuffer;
-
-		// Should an texture buffer be set?
-		if (pTextureBuffer) {
-			// Yes, make it current
-			m_sStatistics.nTextureBufferBinds++;
-			if (!MakeTextureBufferCurrent(*pTextureBuffer, nStage)) {
-				m_ppCurrentTextureBuffer[nStage] = pT;
-
-				// Error!
-				return false;
-			}
-		}
-	}
-
-	// Done
-	return true;
+	// Should a texture buffer be set?
+	PLRenderer::TextureBuffer *pTextureBuffer = m_ppCurrentTextureBuffer[nStage];
+	return (!pTextureBuffer || MakeTextureBufferCurrent(*pTextureBuffer, nStage));
 }
 
 bool Renderer::SetIndexBuffer(PLRenderer::IndexBuffer *pIndexBuffer)
@@ -213,12 +213,6 @@ class Renderer : public PLRenderer::RendererBackend {
 		virtual PLRenderer::VertexBuffer *CreateVertexBuffer() override;
 		virtual PLRenderer::OcclusionQuery *CreateOcclusionQuery() override;
 
-		//[-------------------------------------------------------]
-		//[ States                                                ]
-		//[-------------------------------------------------------]
-		virtual bool SetRenderState(PLRenderer::RenderState::Enum nState, PLCore::uint32 nValue) override;
-		virtual bool SetSamplerState(PLCore::uint32 nStage, PLRenderer::Sampler::Enum nState, PLCore::uint32 nValue) override;
-
 		//[-------------------------------------------------------]
 		//[ Misc                                                  ]
 		//[-------------------------------------------------------]
@@ -240,7 +234,6 @@ class Renderer : public PLRenderer::RendererBackend {
 		virtual bool SetColorRenderTarget(PLRenderer::TextureBuffer *pTextureBuffer, PLCore::uint8 nColorIndex = 0, PLCore::uint8 nFace = 0) override;
 		virtual bool SetDepthRenderTarget(PLRenderer::TextureBuffer *pTextureBuffer, PLCore::uint8 nFace = 0) override;
 		virtual bool MakeScreenshot(PLGraphics::Image &cImage) override;
-		virtual bool SetTextureBuffer(int nStage = -1, PLRenderer::TextureBuffer *pTextureBuffer = nullptr) override;
 		virtual bool SetIndexBuffer(PLRenderer::IndexBuffer *pIndexBuffer = nullptr) override;
 
 		//[-------------------------------------------------------]
@@ -260,6 +253,15 @@ class Renderer : public PLRenderer::RendererBackend {
 		virtual bool DrawIndexedPatchesInstanced(PLCore::uint32 nVerticesPerPatch, PLCore::uint32 nMinIndex, PLCore::uint32 nMaxIndex, PLCore::uint32 nStartIndex, PLCore::uint32 nNumVertices, PLCore::uint32 nNumOfInstances) override;
 
 
+	//[-------------------------------------------------------]
+	//[ Protected virtual PLRenderer::RendererBackend functions ]
+	//[-------------------------------------------------------]
+	protected:
+		virtual bool ApplyRenderState(PLRenderer::RenderState::Enum nState, PLCore::uint32 nValue) override;
+		virtual bool ApplySamplerState(PLCore::uint32 nStage, PLRenderer::Sampler::Enum nState, PLCore::uint32 nValue) override;
+		virtual bool ApplyTextureBuffer(PLCore::uint32 nStage, PLRenderer::TextureBuffer *pPreviousTextureBuffer) override;
+
+
 };
 
 
@@ -942,18 +942,13 @@ PLRenderer::OcclusionQuery *Renderer::CreateOcclusionQuery()
 //[-------------------------------------------------------]
 //[ States                                                ]
 //[-------------------------------------------------------]
-bool Renderer::SetRenderState(PLRenderer::RenderState::Enum nState, uint32 nValue)
+bool Renderer::ApplyRenderState(PLRenderer::RenderState::Enum nState, uint32 nValue)
 {
-	// Check if the state is a valid render state member
-	if (!m_pDevice || nState >= PLRenderer::RenderState::Number)
+	// Check device
+	if (!m_pDevice)
 		return false; // Error!
 
-	// Check if this render state is already set to this value
-	if (m_nRenderState[nState] != nValue) {
-		// Set the render state
-		m_nRenderState[nState] = nValue;
-		m_sStatistics.nRenderStateChanges++;
-
+	{ // The render state was changed, the state cache is updated by "RendererBackend::SetRenderState()"
 		// Set render state - because there are that many render states, split the states binary tree like
 		if (nState < PLRenderer::RenderState::PointSize) {
 			if (nState < PLRenderer::RenderState::BlendEnable) {
@@ -1385,15 +1380,12 @@ uint32 GetD3DFilterMode(uint32 nMode)
 	}
 }
 
-bool Renderer::SetSamplerState(uint32 nStage, PLRenderer::Sampler::Enum nState, uint32 nValue)
+bool Renderer::ApplySamplerState(uint32 nStage, PLRenderer::Sampler::Enum nState, uint32 nValue)
 {
-	// Check if the stage is correct and check if the state is a valid sampler member
-	if (nStage >= m_sCapabilities.nMaxTextureUnits || !m_pDevice || nState >= PLRenderer::Sampler::Number)
+	// Check device
+	if (!m_pDevice)
 		return false; // Error!
 
-	// Set the sampler state
-	m_ppnSamplerState[nStage][nState] = nValue;
-
 	// Check if this sampler state is already set to this value
 	if (m_ppnInternalSamplerState[nStage][nState] != nValue) {
 		// Check whether mipmapping is allowed, if not, set a proper internal texture filter mode
@@ -1411,7 +1403,6 @@ bool Renderer::SetSamplerState(uint32 nStage, PLRenderer::Sampler::Enum nState,
 
 		// Set the sampler state
 		m_ppnInternalSamplerState[nStage][nState] = nValue;
-		m_sStatistics.nSamplerStateChanges++;
 
 		// Set sampler state
 		switch (nState) {
@@ -1779,43 +1770,21 @@ bool Renderer::MakeScreenshot(Image &cImage)
 	return true;
 }
 
-bool Renderer::SetTextureBuffer(int nStage, PLRenderer::TextureBuffer *pTextureBuffer)
+bool Renderer::ApplyTextureBuffer(uint32 nStage, PLRenderer::TextureBuffer *pPreviousTextureBuffer)
 {
-	// Set all available texture stages to this setting?
-	if (nStage < 0) {
-		for (uint32 i=0; i<m_sCapabilities.nMaxTextureUnits; i++)
-			SetTextureBuffer(i, pTextureBuffer);
-	} else {
-		// Check if the stage is correct
-		if (nStage >= static_cast<signed>(m_sCapabilities.nMaxTextureUnits))
-			return false; // Error!
-
-		// Is this texture buffer already set?
-		if (m_ppCurrentTextureBuffer[nStage] == pTextureBuffer)
+	// Should a texture buffer be set?
+	PLRenderer::TextureBuffer *pTextureBuffer = m_ppCurrentTextureBuffer[nStage];
+	if (pTextureBuffer) {
+		// Yes, make it current
+		if (!MakeTextureBufferCurrent(*pTextureBuffer, nStage))
 			return false; // Error!
 
-		// Make this texture buffer to the renderers current one
-		PLRenderer::TextureBuffer *pT = m_ppCurrentTextureBuffer[nStage];
-		m_ppCurrentTextureBuffer[nStage] = pTextureBuffer;
-
-		// Should an texture buffer be set?
-		if (pTextureBuffer) {
-			// Yes, make it current
-			m_sStatistics.nTextureBufferBinds++;
-			if (!MakeTextureBufferCurrent(*pTextureBuffer, nStage)) {
-				m_ppCurrentTextureBuffer[nStage] = pT;
-
-				// Error!
-				return false;
-			}
-
-			// Is the internal PLRenderer::Sampler::MipFilter state other than the 'official' state?
-			if (m_ppnInternalSamplerState[nStage][PLRenderer::Sampler::MipFilter] != m_ppnSamplerState[nStage][PLRenderer::Sampler::MipFilter])
-				SetSamplerState(nStage, static_cast<PLRenderer::Sampler::Enum>(PLRenderer::Sampler::MipFilter), m_ppnSamplerState[nStage][PLRenderer::Sampler::MipFilter]);
-		} else {
-			// No, deactivate texture buffer
-			m_pDevice->SetTexture(nStage, nullptr);
-		}
+		// Is the internal PLRenderer::Sampler::MipFilter state other than the 'official' state? ("SetSamplerState()" would drop the unchanged state)
+		if (m_ppnInternalSamplerState[nStage][PLRenderer::Sampler::MipFilter] != m_ppnSamplerState[nStage][PLRenderer::Sampler::MipFilter])
+			ApplySamplerState(nStage, PLRenderer::Sampler::MipFilter, m_ppnSamplerState[nStage][PLRenderer::Sampler::MipFilter]);
+	} else {
+		// No, deactivate texture buffer
+		m_pDevice->SetTexture(nStage, nullptr);
 	}
 
 	// Done
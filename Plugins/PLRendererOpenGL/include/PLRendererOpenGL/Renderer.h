@@ -274,12 +274,6 @@ class Renderer : public PLRenderer::RendererBackend {
 		virtual PLRenderer::VertexBuffer *CreateVertexBuffer() override;
 		virtual PLRenderer::OcclusionQuery *CreateOcclusionQuery() override;
 
-		//[-------------------------------------------------------]
-		//[ States                                                ]
-		//[-------------------------------------------------------]
-		virtual bool SetRenderState(PLRenderer::RenderState::Enum nState, PLCore::uint32 nValue) override;
-		virtual bool SetSamplerState(PLCore::uint32 nStage, PLRenderer::Sampler::Enum nState, PLCore::uint32 nValue) override;
-
 		//[-------------------------------------------------------]
 		//[ Misc                                                  ]
 		//[-------------------------------------------------------]
@@ -301,13 +295,11 @@ class Renderer : public PLRenderer::RendererBackend {
 		virtual bool SetColorRenderTarget(PLRenderer::TextureBuffer *pTextureBuffer, PLCore::uint8 nColorIndex = 0, PLCore::uint8 nFace = 0) override;
 		virtual bool SetDepthRenderTarget(PLRenderer::TextureBuffer *pTextureBuffer, PLCore::uint8 nFace = 0) override;
 		virtual bool MakeScreenshot(PLGraphics::Image &cImage) override;
-		virtual bool SetTextureBuffer(int nStage = -1, PLRenderer::TextureBuffer *pTextureBuffer = nullptr) override;
 
 		// [TODO] Clean this up!
 		PLRENDEREROPENGL_API bool SetShaderProgramTextureBuffer(int nStage = -1, PLRenderer::TextureBuffer *pTextureBuffer = nullptr);
 
 		virtual bool SetIndexBuffer(PLRenderer::IndexBuffer *pIndexBuffer = nullptr) override;
-		virtual bool SetProgram(PLRenderer::Program *pProgram = nullptr) override;
 
 		//[-------------------------------------------------------]
 		//[ Draw call                                             ]
@@ -326,6 +318,16 @@ class Renderer : public PLRenderer::RendererBackend {
 		virtual bool DrawIndexedPatchesInstanced(PLCore::uint32 nVerticesPerPatch, PLCore::uint32 nMinIndex, PLCore::uint32 nMaxIndex, PLCore::uint32 nStartIndex, PLCore::uint32 nNumVertices, PLCore::uint32 nNumOfInstances) override;
 
 
+	//[-------------------------------------------------------]
+	//[ Protected virtual PLRenderer::RendererBackend functions ]
+	//[-------------------------------------------------------]
+	protected:
+		virtual bool ApplyRenderState(PLRenderer::RenderState::Enum nState, PLCore::uint32 nValue) override;
+		virtual bool ApplySamplerState(PLCore::uint32 nStage, PLRenderer::Sampler::Enum nState, PLCore::uint32 nValue) override;
+		virtual bool ApplyTextureBuffer(PLCore::uint32 nStage, PLRenderer::TextureBuffer *pPreviousTextureBuffer) override;
+		virtual bool ApplyProgram(PLRenderer::Program *pProgram, PLRenderer::Program *pPreviousProgram) override;
+
+
 };
 
 
@@ -1364,20 +1364,11 @@ PLRenderer::OcclusionQuery *Renderer::CreateOcclusionQuery()
 //[-------------------------------------------------------]
 //[ States                                                ]
 //[-------------------------------------------------------]
-bool Renderer::SetRenderState(PLRenderer::RenderState::Enum nState, uint32 nValue)
+bool Renderer::ApplyRenderState(PLRenderer::RenderState::Enum nState, uint32 nValue)
 {
-	// Check if the state is a valid render state member
-	if (nState >= PLRenderer::RenderState::Number)
-		return false; // Error!
-
-	// Check if this render state is already set to this value
-	if (m_nRenderState[nState] != nValue) {
-		const Extensions &cExtensions = m_pContext->GetExtensions();
-
-		// Set the render state
-		m_nRenderState[nState] = nValue;
-		m_sStatistics.nRenderStateChanges++;
+	const Extensions &cExtensions = m_pContext->GetExtensions();
 
+	{ // The render state was changed, the state cache is updated by "RendererBackend::SetRenderState()"
 		// Set render state - because there are that many render states, split the states binary tree like
 		if (nState < PLRenderer::RenderState::PointSize) {
 			if (nState < PLRenderer::RenderState::BlendEnable) {
@@ -2263,15 +2254,8 @@ bool Renderer::SetRenderState(PLRenderer::RenderState::Enum nState, uint32 nValu
 	return true;
 }
 
-bool Renderer::SetSamplerState(uint32 nStage, PLRenderer::Sampler::Enum nState, uint32 nValue)
+bool Renderer::ApplySamplerState(uint32 nStage, PLRenderer::Sampler::Enum nState, uint32 nValue)
 {
-	// Check if the stage is correct and check if the state is a valid sampler member
-	if (nStage >= m_sCapabilities.nMaxTextureUnits || nState >= PLRenderer::Sampler::Number)
-		return false; // Error!
-
-	// Set the sampler state
-	m_ppnSamplerState[nStage][nState] = nValue;
-
 	// Check if this sampler state is already set to this value and whether currently a correct
 	// texture buffer is used
 	if (m_ppnInternalSamplerState[nStage][nState] != nValue && m_nTextureBufferTypes[nStage]) {
@@ -2291,7 +2275,6 @@ bool Renderer::SetSamplerState(uint32 nStage, PLRenderer::Sampler::Enum nState,
 		// Set the sampler state
 		m_ppnInternalSamplerState[nStage][nState] = nValue;
 		uint32 nType = m_nTextureBufferTypes[nStage];
-		m_sStatistics.nSamplerStateChanges++;
 
 		// Activate the correct OpenGL texture stage
 		if (glActiveTextureARB)
@@ -2690,25 +2673,12 @@ bool Renderer::MakeScreenshot(PLGraphics::Image &cImage)
 	return true;
 }
 
-bool Renderer::SetTextureBuffer(int nStage, PLRenderer::TextureBuffer *pTextureBuffer)
+bool Renderer::ApplyTextureBuffer(uint32 nStage, PLRenderer::TextureBuffer *pPreviousTextureBuffer)
 {
-	// Set all available texture stages to this setting?
-	if (nStage < 0) {
-		for (uint32 i=0; i<m_sCapabilities.nMaxTextureUnits; i++)
-			SetTextureBuffer(i, pTextureBuffer);
-	} else {
-		// Check if the stage is correct
-		if (nStage >= static_cast<int>(m_sCapabilities.nMaxTextureUnits))
-			return false; // Error!
-
-		// Is this texture buffer already set?
-		if (m_ppCurrentTextureBuffer[nStage] == pTextureBuffer)
-			return false; // Error!
-
-		// Make this texture buffer to the renderers current one
-		PLRenderer::TextureBuffer *pPreviousTextureBuffer = m_ppCurrentTextureBuffer[nStage];
-		m_ppCurrentTextureBuffer[nStage] = pTextureBuffer;
+	// Get the new current texture buffer
+	PLRenderer::TextureBuffer *pTextureBuffer = m_ppCurrentTextureBuffer[nStage];
 
+	{ // The texture buffer was changed, the current texture buffer is updated by "RendererBackend::SetTextureBuffer()"
 		// The previous texture buffer needs a backup of the current sampler states
 		if (pPreviousTextureBuffer) {
 			uint32 *pnSamplerState = nullptr;
@@ -2818,7 +2788,6 @@ bool Renderer::SetTextureBuffer(int nStage, PLRenderer::TextureBuffer *pTextureB
 				}
 			} else {
 				// Yes, make it current
-				m_sStatistics.nTextureBufferBinds++;
 				if (!MakeTextureBufferCurrent(*pTextureBuffer, nStage)) {
 					// [TODO] What now?
 	//				m_ppCurrentTextureBuffer[nStage] = pPreviousTextureBuffer;
@@ -2914,8 +2883,8 @@ bool Renderer::SetTextureBuffer(int nStage, PLRenderer::TextureBuffer *pTextureB
 							// Make this state 'dirty'
 							m_ppnInternalSamplerState[nStage][i]++;
 
-							// Reset the state
-							SetSamplerState(nStage, static_cast<PLRenderer::Sampler::Enum>(i), m_ppnSamplerState[nStage][i]);
+							// Reset the state ("SetSamplerState()" would drop the unchanged state)
+							ApplySamplerState(nStage, static_cast<PLRenderer::Sampler::Enum>(i), m_ppnSamplerState[nStage][i]);
 						}
 					}
 				}
@@ -2972,8 +2941,13 @@ bool Renderer::SetShaderProgramTextureBuffer(int nStage, PLRenderer::TextureBuff
 			return false; // Error!
 
 		// Is this texture buffer already set?
-		if (m_ppCurrentTextureBuffer[nStage] == pTextureBuffer)
-			return false; // Error!
+		if (m_ppCurrentTextureBuffer[nStage] == pTextureBuffer) {
+			// Update statistics
+			m_sStatistics.nRedundantTextureBuffers++;
+
+			// Error!
+			return false;
+		}
 
 		// Make this texture buffer to the renderers current one
 		PLRenderer::TextureBuffer *pPreviousTextureBuffer = m_ppCurrentTextureBuffer[nStage];
@@ -3126,8 +3100,8 @@ bool Renderer::SetShaderProgramTextureBuffer(int nStage, PLRenderer::TextureBuff
 						// Make this state 'dirty'
 						m_ppnInternalSamplerState[nStage][i]++;
 
-						// Reset the state
-						SetSamplerState(nStage, static_cast<PLRenderer::Sampler::Enum>(i), m_ppnSamplerState[nStage][i]);
+						// Reset the state ("SetSamplerState()" would drop the unchanged state)
+						ApplySamplerState(nStage, static_cast<PLRenderer::Sampler::Enum>(i), m_ppnSamplerState[nStage][i]);
 					}
 				}
 			}
@@ -3191,27 +3165,20 @@ bool Renderer::SetIndexBuffer(PLRenderer::IndexBuffer *pIndexBuffer)
 	return true;
 }
 
-bool Renderer::SetProgram(PLRenderer::Program *pProgram)
+bool Renderer::ApplyProgram(PLRenderer::Program *pProgram, PLRenderer::Program *pPreviousProgram)
 {
-	// Is the new program the same one as the current one?
-	PLRenderer::Program *pCurrentProgram = static_cast<PLRenderer::Program*>(m_cProgramHandler.GetResource());
-	if (pCurrentProgram != pProgram) {
-		// Was there a previous program?
-		if (pCurrentProgram) {
-			static_cast<Program*>(pCurrentProgram)->UnmakeCurrent();
-
-			// [HACK] When using GLSL as Cg profile we need to use 'glUseProgramObjectARB()' to deactivate shaders
-			glUseProgramObjectARB(0);
-		}
-
-		// Update the program resource handler
-		m_cProgramHandler.SetResource(pProgram);
+	// Was there a previous program?
+	if (pPreviousProgram) {
+		static_cast<Program*>(pPreviousProgram)->UnmakeCurrent();
 
-		// Make the new program to the current one
-		if (pProgram)
-			return static_cast<Program*>(pProgram)->MakeCurrent();
+		// [HACK] When using GLSL as Cg profile we need to use 'glUseProgramObjectARB()' to deactivate shaders
+		glUseProgramObjectARB(0);
 	}
 
+	// Make the new program to the current one
+	if (pProgram)
+		return static_cast<Program*>(pProgram)->MakeCurrent();
+
 	// Done
 	return true;
 }
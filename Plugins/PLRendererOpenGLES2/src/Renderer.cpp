@@ -501,19 +501,26 @@ bool Renderer::SetShaderProgramTextureBuffer(int nStage, PLRenderer::TextureBuff
 			return false; // Error!
 
 		// Is this texture buffer already set?
-		if (m_ppCurrentTextureBuffer[nStage] == pTextureBuffer)
-			return false; // Error!
+		if (m_ppCurrentTextureBuffer[nStage] == pTextureBuffer) {
+			// Update statistics
+			m_sStatistics.nRedundantTextureBuffers++;
+
+			// Error!
+			return false;
+		}
 
 		// Make this texture buffer to the renderers current one
 		m_ppCurrentTextureBuffer[nStage] = pTextureBuffer;
+		if (pTextureBuffer)
+			m_sStatistics.nTextureBufferBinds++;
 
 		// Loop through all sampler states
 		for (uint32 i=0; i<PLRenderer::Sampler::Number; i++) {
 			// Make this state 'dirty'
 			m_ppnInternalSamplerState[nStage][i]++;
 
-			// Reset the state
-			SetSamplerState(nStage, static_cast<PLRenderer::Sampler::Enum>(i), m_ppnSamplerState[nStage][i]);
+			// Reset the state ("SetSamplerState()" would drop the unchanged state)
+			ApplySamplerState(nStage, static_cast<PLRenderer::Sampler::Enum>(i), m_ppnSamplerState[nStage][i]);
 		}
 	}
 
@@ -1041,18 +1048,9 @@ PLRenderer::OcclusionQuery *Renderer::CreateOcclusionQuery()
 //[-------------------------------------------------------]
 //[ States                                                ]
 //[-------------------------------------------------------]
-bool Renderer::SetRenderState(PLRenderer::RenderState::Enum nState, uint32 nValue)
+bool Renderer::ApplyRenderState(PLRenderer::RenderState::Enum nState, uint32 nValue)
 {
-	// Check if the state is a valid render state member
-	if (nState >= PLRenderer::RenderState::Number)
-		return false; // Error!
-
-	// Check if this render state is already set to this value
-	if (m_nRenderState[nState] != nValue) {
-		// Set the render state
-		m_nRenderState[nState] = nValue;
-		m_sStatistics.nRenderStateChanges++;
-
+	{ // The render state was changed, the state cache is updated by "RendererBackend::SetRenderState()"
 		// Set render state - because there are that many render states, split the states binary tree like
 		if (nState < PLRenderer::RenderState::PointSize) {
 			if (nState < PLRenderer::RenderState::BlendEnable) {
@@ -1650,15 +1648,8 @@ bool Renderer::SetRenderState(PLRenderer::RenderState::Enum nState, uint32 nValu
 	return true;
 }
 
-bool Renderer::SetSamplerState(uint32 nStage, PLRenderer::Sampler::Enum nState, uint32 nValue)
+bool Renderer::ApplySamplerState(uint32 nStage, PLRenderer::Sampler::Enum nState, uint32 nValue)
 {
-	// Check if the stage is correct and check if the state is a valid sampler member
-	if (nStage >= m_sCapabilities.nMaxTextureUnits || nState >= PLRenderer::Sampler::Number)
-		return false; // Error!
-
-	// Set the sampler state
-	m_ppnSamplerState[nStage][nState] = nValue;
-
 	{ // Handle rectangle texture restrictions
 		PLRenderer::TextureBuffer *pTextureBuffer = m_ppCurrentTextureBuffer[nStage];
 		if (pTextureBuffer && pTextureBuffer->GetType() == PLRenderer::Resource::TypeTextureBuffer2D && static_cast<TextureBuffer2D*>(pTextureBuffer)->IsRectangleTexture()) {
@@ -1733,7 +1724,6 @@ bool Renderer::SetSamplerState(uint32 nStage, PLRenderer::Sampler::Enum nState,
 		if (nOpenGLESTextureTarget) {
 			// Set the sampler state
 			m_ppnInternalSamplerState[nStage][nState] = nValue;
-			m_sStatistics.nSamplerStateChanges++;
 
 			// Activate the correct OpenGL ES texture unit
 			glActiveTexture(GL_TEXTURE0 + nStage);
@@ -2087,40 +2077,11 @@ bool Renderer::MakeScreenshot(PLGraphics::Image &cImage)
 	return true;
 }
 
-bool Renderer::SetTextureBuffer(int nStage, PLRenderer::TextureBuffer *pTextureBuffer)
+bool Renderer::ApplyTextureBuffer(uint32 nStage, PLRenderer::TextureBuffer *pPreviousTextureBuffer)
 {
-	// Set all available texture stages to this setting?
-	if (nStage < 0) {
-		for (uint32 i=0; i<m_sCapabilities.nMaxTextureUnits; i++)
-			SetTextureBuffer(i, pTextureBuffer);
-	} else {
-		// Check if the stage is correct
-		if (nStage >= m_sCapabilities.nMaxTextureUnits)
-			return false; // Error!
-
-		// Is this texture buffer already set?
-		if (m_ppCurrentTextureBuffer[nStage] == pTextureBuffer)
-			return false; // Error!
-
-		// Make this texture buffer to the renderers current one
-		PLRenderer::TextureBuffer *pT = m_ppCurrentTextureBuffer[nStage];
-		m_ppCurrentTextureBuffer[nStage] = pTextureBuffer;
-
-		// Should an texture buffer be set?
-		if (pTextureBuffer) {
-			// Yes, make it current
-			m_sStatistics.nTextureBufferBinds++;
-			if (!MakeTextureBufferCurrent(*pTextureBuffer, nStage)) {
-				m_ppCurrentTextureBuffer[nStage] = pT;
-
-				// Error!
-				return false;
-			}
-		}
-	}
-
-	// Done
-	return true;
+	// Should a texture buffer be set?
+	PLRenderer::TextureBuffer *pTextureBuffer = m_ppCurrentTextureBuffer[nStage];
+	return (!pTextureBuffer || MakeTextureBufferCurrent(*pTextureBuffer, nStage));
 }
 
 bool Renderer::SetIndexBuffer(PLRenderer::IndexBuffer *pIndexBuffer)
@@ -2152,22 +2113,15 @@ bool Renderer::SetIndexBuffer(PLRenderer::IndexBuffer *pIndexBuffer)
 	return true;
 }
 
-bool Renderer::SetProgram(PLRenderer::Program *pProgram)
+bool Renderer::ApplyProgram(PLRenderer::Program *pProgram, PLRenderer::Program *pPreviousProgram)
 {
-	// Is the new program the same one as the current one?
-	PLRenderer::Program *pCurrentProgram = static_cast<PLRenderer::Program*>(m_cProgramHandler.GetResource());
-	if (pCurrentProgram != pProgram) {
-		// Was there a previous program? (must be GLSL because that's the only supported shader language in here :D)
-		if (pCurrentProgram)
-			static_cast<ProgramGLSL*>(pCurrentProgram)->UnmakeCurrent();
-
-		// Update the program resource handler
-		m_cProgramHandler.SetResource(pProgram);
-
-		// Make the new program to the current one (must be GLSL because that's the only supported shader language in here :D)
-		if (pProgram)
-			return static_cast<ProgramGLSL*>(pProgram)->MakeCurrent();
-	}
+	// Was there a previous program? (must be GLSL because that's the only supported shader language in here :D)
+	if (pPreviousProgram)
+		static_cast<ProgramGLSL*>(pPreviousProgram)->UnmakeCurrent();
+
+	// Make the new program to the current one (must be GLSL because that's the only supported shader language in here :D)
+	if (pProgram)
+		return static_cast<ProgramGLSL*>(pProgram)->MakeCurrent();
 
 	// Done
 	return true;
@@ -0,0 +1,205 @@
+/*********************************************************\
+ *  File: FixedFunctionsShader.h                         *
+ *
+ *  Copyright (C) 2002-2013 The PixelLight Team (http://www.pixellight.org/)
+ *
+ *  This file is part of PixelLight.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ *  and associated documentation files (the "Software"), to deal in the Software without
+ *  restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ *  Software is furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all copies or
+ *  substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ *  BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ *  DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ *  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+#ifndef __PLRENDERERSOFTWARE_FIXEDFUNCTIONSSHADER_H__
+#define __PLRENDERERSOFTWARE_FIXEDFUNCTIONSSHADER_H__
+#pragma once
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include <PLMath/Vector3.h>
+#include <PLMath/Matrix4x4.h>
+#include <PLGraphics/Color/Color4.h>
+#include <PLRenderer/Renderer/FixedFunctions.h>
+#include "PLRendererSoftware/Shader.h"
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace PLRendererSoftware {
+
+
+//[-------------------------------------------------------]
+//[ Classes                                               ]
+//[-------------------------------------------------------]
+/**
+*  @brief
+*    C++ shader implementing the fixed functions pipeline
+*
+*  @remarks
+*    Supported are the world, view and projection matrices, vertex colors (or the fixed functions color if the
+*    vertices have no color), per vertex lighting and texture stages 0 and 1 with their texture matrices and the
+*    color and alpha texture environments. Lighting works like the one of OpenGL with enabled color material
+*    (the color is used as ambient and diffuse material color), an infinite viewer and a separate specular color
+*    which is added after texturing. This is everything the "FixedFunctions" scene renderer passes of
+*    PLCompositing are using for the diffuse, light and ambient occlusion maps as well as the lighting.
+*    Fog, flat shading, texture coordinate generation, user clip planes and the other texture stages are not supported.
+*/
+class FixedFunctionsShader : public Shader {
+
+
+	//[-------------------------------------------------------]
+	//[ Public functions                                      ]
+	//[-------------------------------------------------------]
+	public:
+		/**
+		*  @brief
+		*    Default constructor
+		*/
+		FixedFunctionsShader();
+
+		/**
+		*  @brief
+		*    Destructor
+		*/
+		virtual ~FixedFunctionsShader();
+
+
+	//[-------------------------------------------------------]
+	//[ Private definitions                                   ]
+	//[-------------------------------------------------------]
+	private:
+		static const PLCore::uint32 NumOfTextureStages = 2;	/**< Number of supported texture stages */
+
+		/**
+		*  @brief
+		*    Varyings, the varyings behind the color are only used if required
+		*/
+		enum EVarying {
+			VaryingR = 0,
+			VaryingG = 1,
+			VaryingB = 2,
+			VaryingA = 3
+		};
+
+		/**
+		*  @brief
+		*    Enabled light prepared for the vertex processing, all in world space
+		*/
+		struct Light {
+			PLRenderer::FixedFunctions::LightType::Enum nType;					/**< Light type */
+			PLGraphics::Color4							cAmbient;				/**< Ambient color of the light */
+			PLGraphics::Color4							cDiffuse;				/**< Diffuse color of the light */
+			PLGraphics::Color4							cSpecular;				/**< Specular color of the light multiplied with the specular material color */
+			PLMath::Vector3								vPosition;				/**< Position of point and spot lights */
+			PLMath::Vector3								vDirection;				/**< Normalized direction towards a directional light or normalized spot direction */
+			float										fCosCutOff;				/**< Cosine of the spot cutoff angle */
+			float										fConstantAttenuation;	/**< Constant attenuation */
+			float										fLinearAttenuation;		/**< Linear attenuation */
+			float										fQuadraticAttenuation;	/**< Quadratic attenuation */
+		};
+
+
+	//[-------------------------------------------------------]
+	//[ Private static functions                              ]
+	//[-------------------------------------------------------]
+	private:
+		/**
+		*  @brief
+		*    Applies a texture environment
+		*
+		*  @param[in]  nTexEnv
+		*    Texture environment mode (see PLRenderer::FixedFunctions::TextureEnvironment)
+		*  @param[in]  fTexel
+		*    Texel component
+		*  @param[in, out] fValue
+		*    Color component to combine the texel component with
+		*/
+		static inline void ApplyTextureEnvironment(PLCore::uint32 nTexEnv, float fTexel, float &fValue);
+
+
+	//[-------------------------------------------------------]
+	//[ Private functions                                     ]
+	//[-------------------------------------------------------]
+	private:
+		/**
+		*  @brief
+		*    Lights a vertex
+		*
+		*  @param[in]  pnVertex
+		*    Vertex data
+		*  @param[in]  fColor
+		*    RGBA color used as ambient and diffuse material color
+		*  @param[out] fVarying
+		*    Receives the lit color and, if used, the separate specular color
+		*/
+		void LightVertex(const PLCore::uint8 *pnVertex, const float fColor[4], float fVarying[]) const;
+
+
+	//[-------------------------------------------------------]
+	//[ Private data                                          ]
+	//[-------------------------------------------------------]
+	private:
+		// Transformation
+		PLMath::Matrix4x4							  m_mWorldViewProjection;					/**< World view projection matrix */
+		PLMath::Matrix4x4							  m_mWorld;									/**< World matrix */
+		PLMath::Matrix4x4							  m_mWorldInverseTranspose;					/**< Inverse transposed world matrix, transforms normals into world space */
+		PLGraphics::Color4							  m_cColor;									/**< Color used if the vertices have no color */
+		// Lighting
+		bool										  m_bLighting;								/**< Is lighting enabled? */
+		PLGraphics::Color4							  m_cSceneColor;							/**< Emissive material color plus the global ambient color multiplied with the ambient material color */
+		float										  m_fShininess;								/**< Specular exponent */
+		bool										  m_bSpecular;								/**< Is there any specular color? */
+		bool										  m_bNormalizeNormals;						/**< Normalize the normals after the transformation? */
+		PLMath::Vector3								  m_vViewDirection;							/**< Normalized direction towards the infinite viewer in world space */
+		Light										  m_sLight[8];								/**< Enabled lights */
+		PLCore::uint32								  m_nNumOfLights;							/**< Number of enabled lights */
+		PLCore::uint32								  m_nVaryingSpecular;						/**< First varying of the separate specular color, only valid if "m_bSpecular" is 'true' */
+		// Texturing
+		PLMath::Matrix4x4							  m_mTexture[NumOfTextureStages];			/**< Texture matrices */
+		Texture										  m_sTexture[NumOfTextureStages];			/**< Textures, "pnData" is a null pointer if there's no texture */
+		PLCore::uint32								  m_nColorTexEnv[NumOfTextureStages];		/**< Color texture environment modes (see PLRenderer::FixedFunctions::TextureEnvironment) */
+		PLCore::uint32								  m_nAlphaTexEnv[NumOfTextureStages];		/**< Alpha texture environment modes (see PLRenderer::FixedFunctions::TextureEnvironment) */
+		PLCore::uint32								  m_nVaryingTexCoord[NumOfTextureStages];	/**< First varying of the texture coordinate, only valid if there's a texture */
+		PLCore::uint32								  m_nNumOfVaryings;							/**< Number of used varyings */
+		// Vertex attributes
+		const PLRenderer::VertexBuffer::Attribute	 *m_pPosition;								/**< Position vertex attribute, always valid after "Setup()" returned 'true' */
+		const PLRenderer::VertexBuffer::Attribute	 *m_pNormal;								/**< Normal vertex attribute, can be a null pointer */
+		const PLRenderer::VertexBuffer::Attribute	 *m_pColor;									/**< Color vertex attribute, can be a null pointer */
+		const PLRenderer::VertexBuffer::Attribute	 *m_pTexCoord[NumOfTextureStages];			/**< Texture coordinate vertex attributes, can be a null pointer */
+
+
+	//[-------------------------------------------------------]
+	//[ Public virtual Shader functions                       ]
+	//[-------------------------------------------------------]
+	public:
+		virtual bool Setup(const PLRenderer::Renderer &cRenderer, const PLRenderer::VertexBuffer &cVertexBuffer) override;
+		virtual PLCore::uint32 GetNumOfVaryings() const override;
+		virtual void ProcessVertex(const PLCore::uint8 *pnVertex, float fPosition[4], float fVarying[]) const override;
+		virtual bool ProcessPixel(const float fVarying[], float fColor[4]) const override;
+
+
+};
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+} // PLRendererSoftware
+
+
+#endif // __PLRENDERERSOFTWARE_FIXEDFUNCTIONSSHADER_H__
@@ -0,0 +1,78 @@
+/*********************************************************\
+ *  File: PLRendererSoftware.h                               *
+ *      Main header file of this project
+ *
+ *  Copyright (C) 2002-2013 The PixelLight Team (http://www.pixellight.org/)
+ *
+ *  This file is part of PixelLight.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ *  and associated documentation files (the "Software"), to deal in the Software without
+ *  restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ *  Software is furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all copies or
+ *  substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ *  BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ *  DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ *  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+#ifndef __PLRENDERERSOFTWARE_PLRENDERERSOFTWARE_H__
+#define __PLRENDERERSOFTWARE_PLRENDERERSOFTWARE_H__
+#pragma once
+
+
+/**
+*  @mainpage PLRendererSoftware
+*
+*  @section intro_sec Introduction
+*
+*  This is the PLRendererSoftware API reference.
+*/
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include <PLCore/PLCore.h>
+
+
+//[-------------------------------------------------------]
+//[ OS definitions                                        ]
+//[-------------------------------------------------------]
+// Windows platform
+#ifdef WIN32
+	#include "PLRendererSoftware/PLRendererSoftwareWindows.h"
+#endif
+
+// Linux platform
+#ifdef LINUX
+	#include "PLRendererSoftware/PLRendererSoftwareLinux.h"
+#endif
+
+
+//[-------------------------------------------------------]
+//[ Import/Export                                         ]
+//[-------------------------------------------------------]
+#ifdef PLRENDERERSOFTWARE_EXPORTS
+	// To export classes, methods and variables
+	#define PLRENDERERSOFTWARE_API			PL_GENERIC_API_EXPORT
+
+	// To export RTTI elements
+	#define PLRENDERERSOFTWARE_RTTI_EXPORT	PL_GENERIC_RTTI_EXPORT
+#else
+	// To import classes, methods and variables
+	#define PLRENDERERSOFTWARE_API			PL_GENERIC_API_IMPORT
+
+	// To import RTTI elements
+	#define PLRENDERERSOFTWARE_RTTI_EXPORT	PL_GENERIC_RTTI_IMPORT
+#endif
+
+
+#endif // __PLRENDERERSOFTWARE_PLRENDERERSOFTWARE_H__
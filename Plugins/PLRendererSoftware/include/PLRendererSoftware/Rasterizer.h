@@ -0,0 +1,472 @@
+/*********************************************************\
+ *  File: Rasterizer.h                                   *
+ *
+ *  Copyright (C) 2002-2013 The PixelLight Team (http://www.pixellight.org/)
+ *
+ *  This file is part of PixelLight.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ *  and associated documentation files (the "Software"), to deal in the Software without
+ *  restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ *  Software is furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all copies or
+ *  substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ *  BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ *  DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ *  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+#ifndef __PLRENDERERSOFTWARE_RASTERIZER_H__
+#define __PLRENDERERSOFTWARE_RASTERIZER_H__
+#pragma once
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include <PLCore/Container/Array.h>
+#include <PLGraphics/Color/Color4.h>
+#include <PLRenderer/Renderer/Types.h>
+#include "PLRendererSoftware/FixedFunctionsShader.h"
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace PLRendererSoftware {
+
+
+//[-------------------------------------------------------]
+//[ Forward declarations                                  ]
+//[-------------------------------------------------------]
+class Renderer;
+class IndexBuffer;
+class VertexBuffer;
+
+
+//[-------------------------------------------------------]
+//[ Classes                                               ]
+//[-------------------------------------------------------]
+/**
+*  @brief
+*    Tiled triangle rasterizer of the software renderer
+*
+*  @remarks
+*    A draw call transforms the used vertices, clips and sets up the triangles and sorts them into
+*    bins of "TileSize" x "TileSize" pixel screen tiles. The tiles are rasterized in parallel by using
+*    the job system. Each tile is owned by exactly one job, so the triangles of a tile are always
+*    drawn in submission order and no pixel is touched by two threads at the same time. When SSE is
+*    available (see "PLMATH_SSE"), the coverage and depth tests are done for four pixels at once.
+*
+*    The edge functions are evaluated with floating point values. The projected vertex positions are snapped
+*    to 1/16 pixel and the edge functions of a shared edge are exactly negated within the neighbour triangle,
+*    so there are neither gaps nor pixels drawn twice between triangles sharing an edge.
+*
+*    Vertex and pixel processing is done by the shader of the renderer (see "Shader"), the rasterizer takes care
+*    of culling, fill mode, alpha test, depth test, blending and the color mask. Points and lines are drawn as
+*    screen aligned quads with the point size and line width of the renderer. Stencil, polygon offset, point
+*    sprites and point parameters are not supported.
+*/
+class Rasterizer {
+
+
+	//[-------------------------------------------------------]
+	//[ Public definitions                                    ]
+	//[-------------------------------------------------------]
+	public:
+		static const PLCore::uint32 TileSize = 64;	/**< Width and height of a screen tile in pixels */
+
+		/**
+		*  @brief
+		*    Render target the rasterizer draws into
+		*
+		*  @note
+		*    - Like within OpenGL, the first row of the buffers is the bottom row
+		*/
+		struct Target {
+			PLCore::uint8  *pnColor;	/**< RGBA color buffer (4 bytes per pixel), can be a null pointer */
+			float		   *pfDepth;	/**< Depth buffer (one float per pixel), can be a null pointer */
+			PLCore::uint32  nWidth;		/**< Width of the buffers in pixels */
+			PLCore::uint32  nHeight;	/**< Height of the buffers in pixels */
+		};
+
+
+	//[-------------------------------------------------------]
+	//[ Public functions                                      ]
+	//[-------------------------------------------------------]
+	public:
+		/**
+		*  @brief
+		*    Constructor
+		*
+		*  @param[in] cRenderer
+		*    Owner renderer
+		*/
+		Rasterizer(Renderer &cRenderer);
+
+		/**
+		*  @brief
+		*    Destructor
+		*/
+		~Rasterizer();
+
+		/**
+		*  @brief
+		*    Clears the given render target
+		*
+		*  @param[in] sTarget
+		*    Render target to clear
+		*  @param[in] nFlags
+		*    Flags which buffers should be cleared (see PLRenderer::Clear)
+		*  @param[in] cColor
+		*    Color to clear the color buffer with
+		*  @param[in] fZ
+		*    Z value to clear the depth buffer with
+		*
+		*  @note
+		*    - The scissor test and the color mask of the renderer are taken into account
+		*/
+		void Clear(const Target &sTarget, PLCore::uint32 nFlags, const PLGraphics::Color4 &cColor, float fZ);
+
+		/**
+		*  @brief
+		*    Draws primitives by using the current renderer states
+		*
+		*  @param[in] sTarget
+		*    Render target to draw into
+		*  @param[in] nType
+		*    Primitive type
+		*  @param[in] nStartIndex
+		*    First vertex or index to draw
+		*  @param[in] nNumVertices
+		*    Number of vertices or indices to draw
+		*  @param[in] pIndexBuffer
+		*    Index buffer to use, if a null pointer the vertices are used in order
+		*  @param[in] nMinIndex
+		*    Minimum vertex index within the used indices, not used if there's no index buffer
+		*  @param[in] nMaxIndex
+		*    Maximum vertex index within the used indices, not used if there's no index buffer
+		*
+		*  @return
+		*    'true' if all went fine, else 'false' (invalid parameters, no vertex buffer or the vertex buffer can't be used by the shader)
+		*/
+		bool Draw(const Target &sTarget, PLRenderer::Primitive::Enum nType, PLCore::uint32 nStartIndex, PLCore::uint32 nNumVertices,
+				  const IndexBuffer *pIndexBuffer = nullptr, PLCore::uint32 nMinIndex = 0, PLCore::uint32 nMaxIndex = 0);
+
+
+	//[-------------------------------------------------------]
+	//[ Private definitions                                   ]
+	//[-------------------------------------------------------]
+	private:
+		/**
+		*  @brief
+		*    Vertex attributes, the clip space position followed by the varyings of the shader
+		*/
+		enum EAttribute {
+			AttributeX		 = 0,
+			AttributeY		 = 1,
+			AttributeZ		 = 2,
+			AttributeW		 = 3,
+			AttributeVarying = 4,	/**< First varying */
+			NumOfAttributes	 = AttributeVarying + Shader::MaxVaryings
+		};
+
+		/**
+		*  @brief
+		*    Attribute planes of a triangle set up for rasterization
+		*/
+		enum EPlane {
+			PlaneZ			= 0,	/**< Window space depth */
+			PlaneOneOverW	= 1,	/**< 1/w, the varying planes are divided by w for perspective correct interpolation */
+			PlaneVarying	= 2,	/**< First varying */
+			NumOfPlanes		= PlaneVarying + Shader::MaxVaryings
+		};
+
+		/**
+		*  @brief
+		*    Transformed vertex
+		*/
+		struct Vertex {
+			float fAttribute[NumOfAttributes];	/**< Vertex attributes (see EAttribute), only the varyings used by the shader are valid */
+
+			bool operator ==(const Vertex &sVertex) const
+			{
+				return (fAttribute[AttributeX] == sVertex.fAttribute[AttributeX] && fAttribute[AttributeY] == sVertex.fAttribute[AttributeY] &&
+						fAttribute[AttributeZ] == sVertex.fAttribute[AttributeZ] && fAttribute[AttributeW] == sVertex.fAttribute[AttributeW]);
+			}
+		};
+
+		/**
+		*  @brief
+		*    Triangle set up for rasterization
+		*/
+		struct Triangle {
+			float fEdge[3][3];				/**< Edge functions (a, b, c), a pixel center (x, y) is inside if a*x + b*y + c >= 0 for all edges */
+			bool  bTopLeft[3];				/**< Is the edge a top or left edge? If not, a pixel center exactly on the edge is outside. */
+			float fPlane[NumOfPlanes][3];	/**< Attribute planes (a, b, c), the attribute at (x, y) is a*x + b*y + c, only the varyings used by the shader are valid */
+			int   nMinX;					/**< Bounding box, first pixel column */
+			int   nMinY;					/**< Bounding box, first pixel row */
+			int   nMaxX;					/**< Bounding box, pixel column behind the last one */
+			int   nMaxY;					/**< Bounding box, pixel row behind the last one */
+
+			bool operator ==(const Triangle &sTriangle) const
+			{
+				return (nMinX == sTriangle.nMinX && nMinY == sTriangle.nMinY && nMaxX == sTriangle.nMaxX && nMaxY == sTriangle.nMaxY &&
+						fEdge[0][2] == sTriangle.fEdge[0][2] && fEdge[1][2] == sTriangle.fEdge[1][2] && fEdge[2][2] == sTriangle.fEdge[2][2]);
+			}
+		};
+
+		/**
+		*  @brief
+		*    Renderer states used while rasterizing, gathered at the beginning of each draw call so
+		*    that the rasterizer jobs don't need to access the renderer
+		*/
+		struct DrawState {
+			Target				sTarget;				/**< Render target */
+			int					nClipMinX;				/**< Drawing area (viewport, scissor rectangle and target), first pixel column */
+			int					nClipMinY;				/**< Drawing area, first pixel row */
+			int					nClipMaxX;				/**< Drawing area, pixel column behind the last one */
+			int					nClipMaxY;				/**< Drawing area, pixel row behind the last one */
+			float				fViewportX;				/**< Viewport, left pixel column */
+			float				fViewportY;				/**< Viewport, bottom pixel row */
+			float				fViewportWidth;			/**< Viewport width */
+			float				fViewportHeight;		/**< Viewport height */
+			float				fMinZ;					/**< Viewport minimum depth */
+			float				fMaxZ;					/**< Viewport maximum depth */
+			bool				bCullCW;				/**< Drop clockwise triangles? */
+			bool				bCullCCW;				/**< Drop counterclockwise triangles? */
+			PLCore::uint32		nFillMode;				/**< Fill mode of triangles (see PLRenderer::Fill) */
+			float				fPointSize;				/**< Point size in pixels */
+			float				fLineWidth;				/**< Line width in pixels */
+			bool				bDepthTest;				/**< Depth test enabled? */
+			bool				bDepthWrite;			/**< Depth write enabled? */
+			bool				bDepthClamp;			/**< Depth clamp enabled? */
+			PLCore::uint32		nDepthFunction;			/**< Depth test function (see PLRenderer::Compare) */
+			bool				bBlend;					/**< Blending enabled? */
+			PLCore::uint32		nSrcBlendFunc;			/**< Source blend function (see PLRenderer::BlendFunc) */
+			PLCore::uint32		nDstBlendFunc;			/**< Destination blend function (see PLRenderer::BlendFunc) */
+			bool				bColorMask[4];			/**< Color mask (RGBA) */
+			bool				bAlphaTest;				/**< Alpha test enabled? */
+			PLCore::uint32		nAlphaTestFunction;		/**< Alpha test function (see PLRenderer::Compare) */
+			float				fAlphaTestReference;	/**< Alpha test reference value */
+			const Shader	   *pShader;				/**< Shader doing the vertex and pixel processing, always valid */
+			PLCore::uint32		nNumOfVaryings;			/**< Number of varyings used by the shader */
+		};
+
+
+	//[-------------------------------------------------------]
+	//[ Private static functions                              ]
+	//[-------------------------------------------------------]
+	private:
+		/**
+		*  @brief
+		*    Job system parallel for function rasterizing a range of the used tiles
+		*
+		*  @param[in] nFirst
+		*    Index of the first used tile to rasterize
+		*  @param[in] nEnd
+		*    Index behind the last used tile to rasterize
+		*  @param[in] pData
+		*    Rasterizer instance, always valid
+		*/
+		static void RasterizeTiles(PLCore::uint32 nFirst, PLCore::uint32 nEnd, void *pData);
+
+
+	//[-------------------------------------------------------]
+	//[ Private functions                                     ]
+	//[-------------------------------------------------------]
+	private:
+		/**
+		*  @brief
+		*    Copy constructor
+		*
+		*  @param[in] cSource
+		*    Source to copy from
+		*/
+		Rasterizer(const Rasterizer &cSource);
+
+		/**
+		*  @brief
+		*    Copy operator
+		*
+		*  @param[in] cSource
+		*    Source to copy from
+		*
+		*  @return
+		*    Reference to this instance
+		*/
+		Rasterizer &operator =(const Rasterizer &cSource);
+
+		/**
+		*  @brief
+		*    Gathers the current renderer states
+		*
+		*  @param[in] sTarget
+		*    Render target to draw into
+		*  @param[in] cShader
+		*    Shader to use, "Shader::Setup()" must have been called
+		*
+		*  @return
+		*    'false' if nothing can be drawn at all, else 'true'
+		*/
+		bool SetupDrawState(const Target &sTarget, const Shader &cShader);
+
+		/**
+		*  @brief
+		*    Transforms a range of vertices of the current vertex buffer
+		*
+		*  @param[in] cVertexBuffer
+		*    Vertex buffer to use, must be allocated and set up within the shader
+		*  @param[in] nVertexOffset
+		*    Vertex offset the vertex buffer was set with
+		*  @param[in] nFirstVertex
+		*    First vertex to transform
+		*  @param[in] nNumOfVertices
+		*    Number of vertices to transform
+		*
+		*  @return
+		*    'true' if all went fine, else 'false' (invalid range)
+		*/
+		bool TransformVertices(const VertexBuffer &cVertexBuffer, PLCore::uint32 nVertexOffset, PLCore::uint32 nFirstVertex, PLCore::uint32 nNumOfVertices);
+
+		/**
+		*  @brief
+		*    Returns a transformed vertex of the current draw call
+		*
+		*  @param[in] pIndexBuffer
+		*    Index buffer of the draw call, can be a null pointer
+		*  @param[in] nIndex
+		*    Index within the index buffer, or the vertex index if there's no index buffer
+		*
+		*  @return
+		*    The transformed vertex, a null pointer if the vertex index is invalid
+		*/
+		const Vertex *GetVertex(const IndexBuffer *pIndexBuffer, PLCore::uint32 nIndex) const;
+
+		/**
+		*  @brief
+		*    Adds a point as screen aligned quad
+		*
+		*  @param[in] sVertex
+		*    Vertex of the point
+		*/
+		void AddPoint(const Vertex &sVertex);
+
+		/**
+		*  @brief
+		*    Adds a line as screen aligned quad
+		*
+		*  @param[in] sVertex0
+		*    First vertex of the line
+		*  @param[in] sVertex1
+		*    Second vertex of the line
+		*/
+		void AddLine(const Vertex &sVertex0, const Vertex &sVertex1);
+
+		/**
+		*  @brief
+		*    Adds a triangle by using the current fill mode
+		*
+		*  @param[in] sVertex0
+		*    First vertex of the triangle
+		*  @param[in] sVertex1
+		*    Second vertex of the triangle
+		*  @param[in] sVertex2
+		*    Third vertex of the triangle
+		*/
+		void AddTriangle(const Vertex &sVertex0, const Vertex &sVertex1, const Vertex &sVertex2);
+
+		/**
+		*  @brief
+		*    Clips a triangle and adds the resulting triangles
+		*
+		*  @param[in] sVertex0
+		*    First vertex of the triangle
+		*  @param[in] sVertex1
+		*    Second vertex of the triangle
+		*  @param[in] sVertex2
+		*    Third vertex of the triangle
+		*  @param[in] bCull
+		*    Apply the cull mode? (not done for the quads of points and lines)
+		*/
+		void ClipTriangle(const Vertex &sVertex0, const Vertex &sVertex1, const Vertex &sVertex2, bool bCull);
+
+		/**
+		*  @brief
+		*    Sets up a clipped triangle and sorts it into the tile bins
+		*
+		*  @param[in] sVertex0
+		*    First vertex of the triangle
+		*  @param[in] sVertex1
+		*    Second vertex of the triangle
+		*  @param[in] sVertex2
+		*    Third vertex of the triangle
+		*  @param[in] bCull
+		*    Apply the cull mode?
+		*/
+		void SetupTriangle(const Vertex &sVertex0, const Vertex &sVertex1, const Vertex &sVertex2, bool bCull);
+
+		/**
+		*  @brief
+		*    Rasterizes all binned triangles and resets the bins
+		*/
+		void Flush();
+
+		/**
+		*  @brief
+		*    Rasterizes the triangles of a tile
+		*
+		*  @param[in] nTile
+		*    Index of the tile to rasterize
+		*/
+		void RasterizeTile(PLCore::uint32 nTile) const;
+
+		/**
+		*  @brief
+		*    Shades a pixel which passed the coverage and depth tests
+		*
+		*  @param[in] sTriangle
+		*    Triangle the pixel belongs to
+		*  @param[in] nX
+		*    Pixel column
+		*  @param[in] nY
+		*    Pixel row
+		*  @param[in] fZ
+		*    Depth of the pixel
+		*/
+		void ShadePixel(const Triangle &sTriangle, int nX, int nY, float fZ) const;
+
+
+	//[-------------------------------------------------------]
+	//[ Private data                                          ]
+	//[-------------------------------------------------------]
+	private:
+		Renderer					  *m_pRenderer;			/**< Owner renderer, always valid! */
+		DrawState					   m_sState;			/**< Renderer states of the current draw call */
+		PLCore::Array<Vertex>		   m_lstVertices;		/**< Transformed vertices of the current draw call, the array only grows */
+		PLCore::uint32				   m_nNumOfVertices;	/**< Number of transformed vertices of the current draw call */
+		PLCore::uint32				   m_nFirstVertex;		/**< Index of the first transformed vertex within the vertex buffer */
+		PLCore::Array<Triangle>		   m_lstTriangles;		/**< Triangles of the current draw call */
+		PLCore::Array<PLCore::uint32> *m_plstBins;			/**< Per tile triangle indices, can be a null pointer */
+		PLCore::uint32				   m_nNumOfTilesX;		/**< Number of tiles in x direction */
+		PLCore::uint32				   m_nNumOfTilesY;		/**< Number of tiles in y direction */
+		PLCore::Array<PLCore::uint32>  m_lstUsedTiles;		/**< Indices of the tiles with at least one triangle */
+		FixedFunctionsShader		   m_cFixedFunctionsShader;	/**< Shader used if the renderer has no custom shader */
+
+
+};
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+} // PLRendererSoftware
+
+
+#endif // __PLRENDERERSOFTWARE_RASTERIZER_H__
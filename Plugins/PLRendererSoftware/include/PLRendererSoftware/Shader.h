@@ -0,0 +1,256 @@
+/*********************************************************\
+ *  File: Shader.h                                       *
+ *
+ *  Copyright (C) 2002-2013 The PixelLight Team (http://www.pixellight.org/)
+ *
+ *  This file is part of PixelLight.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ *  and associated documentation files (the "Software"), to deal in the Software without
+ *  restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ *  Software is furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all copies or
+ *  substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ *  BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ *  DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ *  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+#ifndef __PLRENDERERSOFTWARE_SHADER_H__
+#define __PLRENDERERSOFTWARE_SHADER_H__
+#pragma once
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include <PLRenderer/Renderer/VertexBuffer.h>
+#include "PLRendererSoftware/PLRendererSoftware.h"
+
+
+//[-------------------------------------------------------]
+//[ Forward declarations                                  ]
+//[-------------------------------------------------------]
+namespace PLRenderer {
+	class Renderer;
+}
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace PLRendererSoftware {
+
+
+//[-------------------------------------------------------]
+//[ Classes                                               ]
+//[-------------------------------------------------------]
+/**
+*  @brief
+*    Abstract C++ shader of the software renderer
+*
+*  @remarks
+*    A shader does the vertex and pixel processing of the rasterizer (see "Rasterizer"). The rasterizer itself
+*    is still in charge of clipping, culling, the alpha and depth tests, blending and the color mask. The shader
+*    outputs per vertex a clip space position and up to "MaxVaryings" values which are interpolated perspective
+*    correct across the primitive and handed over to the pixel processing. By default, the renderer is using
+*    "FixedFunctionsShader" which implements the fixed functions pipeline, a custom shader can be set by using
+*    "Renderer::SetShader()".
+*
+*  @note
+*    - "Setup()" and "ProcessVertex()" are called by the thread the renderer is used in
+*    - "ProcessPixel()" is called by multiple job system workers at the same time, it must not change any data
+*/
+class Shader {
+
+
+	//[-------------------------------------------------------]
+	//[ Public definitions                                    ]
+	//[-------------------------------------------------------]
+	public:
+		static const PLCore::uint32 MaxVaryings = 12;	/**< Maximum number of values interpolated between the vertices */
+
+		/**
+		*  @brief
+		*    Texture buffer a shader can sample from
+		*
+		*  @note
+		*    - Only the top level of 2D and rectangle texture buffers can be sampled
+		*/
+		struct Texture {
+			const PLCore::uint8 *pnData;	/**< RGBA data (4 bytes per texel, the first row is at v = 0), a null pointer if there's no texture to sample from */
+			int					 nWidth;	/**< Width in texels */
+			int					 nHeight;	/**< Height in texels */
+			float				 fScaleU;	/**< Scale of the u texture coordinate, rectangle texture buffers are addressed in texels */
+			float				 fScaleV;	/**< Scale of the v texture coordinate */
+			bool				 bLinear;	/**< Bilinear filtering? If not, the nearest texel is used. */
+			PLCore::uint32		 nAddressU;	/**< Texture addressing mode for u (see PLRenderer::TextureAddressing) */
+			PLCore::uint32		 nAddressV;	/**< Texture addressing mode for v (see PLRenderer::TextureAddressing) */
+
+			/**
+			*  @brief
+			*    Gets the texture buffer and the sampler states of a texture stage
+			*
+			*  @param[in] cRenderer
+			*    Renderer to get the texture buffer from
+			*  @param[in] nStage
+			*    Texture stage
+			*
+			*  @return
+			*    'true' if there's a texture to sample from, else 'false' (no or unsupported texture buffer)
+			*/
+			PLRENDERERSOFTWARE_API bool Setup(const PLRenderer::Renderer &cRenderer, PLCore::uint32 nStage);
+
+			/**
+			*  @brief
+			*    Samples the texture
+			*
+			*  @param[in]  fU
+			*    U texture coordinate
+			*  @param[in]  fV
+			*    V texture coordinate
+			*  @param[out] fColor
+			*    Receives the RGBA color
+			*
+			*  @note
+			*    - "pnData" must be valid
+			*/
+			PLRENDERERSOFTWARE_API void Sample(float fU, float fV, float fColor[4]) const;
+		};
+
+
+	//[-------------------------------------------------------]
+	//[ Public static functions                               ]
+	//[-------------------------------------------------------]
+	public:
+		/**
+		*  @brief
+		*    Reads a vertex attribute
+		*
+		*  @param[in]  pnVertex
+		*    Vertex data
+		*  @param[in]  sAttribute
+		*    Vertex attribute to read
+		*  @param[out] fValue
+		*    Receives the value, missing components are set to (0, 0, 0, 1)
+		*/
+		static PLRENDERERSOFTWARE_API void ReadAttribute(const PLCore::uint8 *pnVertex, const PLRenderer::VertexBuffer::Attribute &sAttribute, float fValue[4]);
+
+
+	//[-------------------------------------------------------]
+	//[ Public functions                                      ]
+	//[-------------------------------------------------------]
+	public:
+		/**
+		*  @brief
+		*    Default constructor
+		*/
+		PLRENDERERSOFTWARE_API Shader();
+
+		/**
+		*  @brief
+		*    Destructor
+		*/
+		PLRENDERERSOFTWARE_API virtual ~Shader();
+
+
+	//[-------------------------------------------------------]
+	//[ Public virtual Shader functions                       ]
+	//[-------------------------------------------------------]
+	public:
+		/**
+		*  @brief
+		*    Gathers the renderer states used by the shader, called at the beginning of each draw call
+		*
+		*  @param[in] cRenderer
+		*    Renderer the draw call is done with
+		*  @param[in] cVertexBuffer
+		*    Vertex buffer the draw call is using
+		*
+		*  @return
+		*    'true' if all went fine, else 'false' (the vertex buffer can't be used, nothing is drawn)
+		*/
+		virtual bool Setup(const PLRenderer::Renderer &cRenderer, const PLRenderer::VertexBuffer &cVertexBuffer) = 0;
+
+		/**
+		*  @brief
+		*    Returns the number of varyings written by "ProcessVertex()"
+		*
+		*  @return
+		*    The number of varyings, must not be greater than "MaxVaryings"
+		*
+		*  @note
+		*    - Called after "Setup()", so the number can depend on the renderer states
+		*/
+		virtual PLCore::uint32 GetNumOfVaryings() const = 0;
+
+		/**
+		*  @brief
+		*    Processes a vertex
+		*
+		*  @param[in]  pnVertex
+		*    Vertex data within the vertex buffer given to "Setup()"
+		*  @param[out] fPosition
+		*    Receives the clip space position (x, y, z, w)
+		*  @param[out] fVarying
+		*    Receives the varyings
+		*/
+		virtual void ProcessVertex(const PLCore::uint8 *pnVertex, float fPosition[4], float fVarying[]) const = 0;
+
+		/**
+		*  @brief
+		*    Processes a pixel
+		*
+		*  @param[in]  fVarying
+		*    Interpolated varyings
+		*  @param[out] fColor
+		*    Receives the RGBA color, the rasterizer clamps it into [0, 1]
+		*
+		*  @return
+		*    'true' if the pixel should be drawn, 'false' to discard it
+		*/
+		virtual bool ProcessPixel(const float fVarying[], float fColor[4]) const = 0;
+
+
+	//[-------------------------------------------------------]
+	//[ Private functions                                     ]
+	//[-------------------------------------------------------]
+	private:
+		/**
+		*  @brief
+		*    Copy constructor
+		*
+		*  @param[in] cSource
+		*    Source to copy from
+		*/
+		Shader(const Shader &cSource);
+
+		/**
+		*  @brief
+		*    Copy operator
+		*
+		*  @param[in] cSource
+		*    Source to copy from
+		*
+		*  @return
+		*    Reference to this instance
+		*/
+		Shader &operator =(const Shader &cSource);
+
+
+};
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+} // PLRendererSoftware
+
+
+#endif // __PLRENDERERSOFTWARE_SHADER_H__
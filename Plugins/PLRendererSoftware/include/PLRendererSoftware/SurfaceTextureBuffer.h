@@ -0,0 +1,209 @@
+/*********************************************************\
+ *  File: SurfaceTextureBuffer.h                         *
+ *
+ *  Copyright (C) 2002-2013 The PixelLight Team (http://www.pixellight.org/)
+ *
+ *  This file is part of PixelLight.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ *  and associated documentation files (the "Software"), to deal in the Software without
+ *  restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ *  Software is furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all copies or
+ *  substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ *  BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ *  DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ *  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+#ifndef __PLRENDERERSOFTWARE_SURFACETEXTUREBUFFER_H__
+#define __PLRENDERERSOFTWARE_SURFACETEXTUREBUFFER_H__
+#pragma once
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include <PLRenderer/Renderer/SurfaceTextureBuffer.h>
+#include <PLRenderer/Renderer/ResourceHandler.h>
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace PLRendererSoftware {
+
+
+//[-------------------------------------------------------]
+//[ Classes                                               ]
+//[-------------------------------------------------------]
+/**
+*  @brief
+*    A software texture buffer renderer surface where we can render in
+*
+*  @note
+*    - There's only a single color render target, it can be replaced by another 2D or rectangle texture buffer of the same size
+*    - A depth render target receives the depth buffer content as luminance (like an OpenGL depth texture with "GL_LUMINANCE"
+*      depth texture mode) when the surface is no longer the current render target or when the depth render target is changed
+*/
+class SurfaceTextureBuffer : public PLRenderer::SurfaceTextureBuffer {
+
+
+	//[-------------------------------------------------------]
+	//[ Friends                                               ]
+	//[-------------------------------------------------------]
+	friend class Renderer;
+
+
+	//[-------------------------------------------------------]
+	//[ Public functions                                      ]
+	//[-------------------------------------------------------]
+	public:
+		/**
+		*  @brief
+		*    Destructor
+		*/
+		virtual ~SurfaceTextureBuffer();
+
+
+	//[-------------------------------------------------------]
+	//[ Private static functions                              ]
+	//[-------------------------------------------------------]
+	private:
+		/**
+		*  @brief
+		*    Returns the RGBA data and the size of a texture buffer
+		*
+		*  @param[in]  cTextureBuffer
+		*    Texture buffer
+		*  @param[out] vSize
+		*    Receives the size of the texture buffer, not touched on failure
+		*
+		*  @return
+		*    RGBA data of the texture buffer (4 bytes per texel, bottom row first), a null pointer if
+		*    it's neither a 2D nor a rectangle texture buffer or if it has no data
+		*/
+		static PLCore::uint8 *GetTextureBufferData(PLRenderer::TextureBuffer &cTextureBuffer, PLMath::Vector2i &vSize);
+
+
+	//[-------------------------------------------------------]
+	//[ Private functions                                     ]
+	//[-------------------------------------------------------]
+	private:
+		/**
+		*  @brief
+		*    Constructor
+		*
+		*  @param[in] cRenderer
+		*    Owner renderer
+		*  @param[in] cTextureBuffer
+		*    Texture buffer bound to the this surface
+		*  @param[in] nFlags
+		*    Texture buffer surface flags (see EFlags)
+		*  @param[in] nMaxColorTargets
+		*    Maximum number of color render targets. This must be at least 1 - main renderer
+		*    target color.
+		*/
+		SurfaceTextureBuffer(PLRenderer::Renderer &cRenderer, PLRenderer::TextureBuffer &cTextureBuffer,
+							 PLCore::uint32 nFlags = Depth | Stencil, PLCore::uint8 nMaxColorTargets = 1);
+
+		/**
+		*  @brief
+		*    Sets a color render target
+		*
+		*  @param[in] nColorIndex
+		*    Color index of the color render target, only 0 is supported
+		*  @param[in] pTextureBuffer
+		*    Color render target, a null pointer to render into the texture buffer of this surface again
+		*
+		*  @return
+		*    'true' if all went fine, else 'false' (invalid color index, unsupported texture buffer type or size mismatch)
+		*/
+		bool SetColorRenderTarget(PLCore::uint8 nColorIndex, PLRenderer::TextureBuffer *pTextureBuffer);
+
+		/**
+		*  @brief
+		*    Sets a depth render target
+		*
+		*  @param[in] pTextureBuffer
+		*    Depth render target, a null pointer to detach the current one
+		*
+		*  @return
+		*    'true' if all went fine, else 'false' (no depth buffer, unsupported texture buffer type or size mismatch)
+		*
+		*  @note
+		*    - The content of the previous depth render target is updated before it's detached
+		*/
+		bool SetDepthRenderTarget(PLRenderer::TextureBuffer *pTextureBuffer);
+
+		/**
+		*  @brief
+		*    Returns the color buffer the rasterizer is rendering into
+		*
+		*  @return
+		*    RGBA data of the current color render target (4 bytes per pixel, bottom row first), a null pointer if
+		*    there's nothing to render into (cube texture buffers are not supported)
+		*/
+		PLCore::uint8 *GetColorBuffer() const;
+
+		/**
+		*  @brief
+		*    Copies the depth buffer into the depth render target
+		*/
+		void ResolveDepthRenderTarget();
+
+
+	//[-------------------------------------------------------]
+	//[ Private data                                          ]
+	//[-------------------------------------------------------]
+	private:
+		PLRenderer::ResourceHandler  m_cTextureBufferHandler;	/**< Texture buffer to render in */
+		PLRenderer::ResourceHandler  m_cColorRenderTarget;		/**< Color render target used instead of the texture buffer of this surface, can be empty */
+		PLRenderer::ResourceHandler  m_cDepthRenderTarget;		/**< Depth render target, can be empty */
+		PLCore::uint8				 m_nFace;					/**< Texture buffer face currently rendered in (cube map) */
+		float						*m_pfDepth;					/**< Depth buffer (one float per pixel, bottom row first), a null pointer if there's no "Depth" flag */
+
+
+	//[-------------------------------------------------------]
+	//[ Public virtual PLRenderer::SurfaceTexture functions   ]
+	//[-------------------------------------------------------]
+	public:
+		virtual PLRenderer::TextureBuffer *GetTextureBuffer() const override;
+		virtual PLCore::uint8 GetTextureBufferFace() const override;
+		virtual void TakeDepthBufferFromSurfaceTextureBuffer(PLRenderer::SurfaceTextureBuffer &cSurfaceTextureBuffer) override;
+
+
+	//[-------------------------------------------------------]
+	//[ Public virtual PLRenderer::Surface functions          ]
+	//[-------------------------------------------------------]
+	public:
+		virtual PLMath::Vector2i GetSize() const override;
+
+
+	//[-------------------------------------------------------]
+	//[ Private virtual PLRenderer::Surface functions         ]
+	//[-------------------------------------------------------]
+	private:
+		virtual bool Init() override;
+		virtual void DeInit() override;
+		virtual bool MakeCurrent(PLCore::uint8 nFace = 0) override;
+		virtual bool UnmakeCurrent() override;
+		virtual bool Present() override;
+
+
+};
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+} // PLRendererSoftware
+
+
+#endif // __PLRENDERERSOFTWARE_SURFACETEXTUREBUFFER_H__
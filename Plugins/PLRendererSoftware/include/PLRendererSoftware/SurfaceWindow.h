@@ -0,0 +1,158 @@
+/*********************************************************\
+ *  File: SurfaceWindow.h                                *
+ *
+ *  Copyright (C) 2002-2013 The PixelLight Team (http://www.pixellight.org/)
+ *
+ *  This file is part of PixelLight.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ *  and associated documentation files (the "Software"), to deal in the Software without
+ *  restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ *  Software is furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all copies or
+ *  substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ *  BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ *  DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ *  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+#ifndef __PLRENDERERSOFTWARE_SURFACE_WINDOW_H__
+#define __PLRENDERERSOFTWARE_SURFACE_WINDOW_H__
+#pragma once
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include <PLRenderer/Renderer/SurfaceWindow.h>
+
+
+//[-------------------------------------------------------]
+//[ Forward declarations                                  ]
+//[-------------------------------------------------------]
+#ifdef LINUX
+	typedef struct _XDisplay Display;
+#endif
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace PLRendererSoftware {
+
+
+//[-------------------------------------------------------]
+//[ Classes                                               ]
+//[-------------------------------------------------------]
+/**
+*  @brief
+*    A software window renderer surface where we can render in
+*
+*  @remarks
+*    The surface owns color and depth buffers in system memory the rasterizer draws into, they are not shown
+*    within the native window. Use "PLRenderer::Renderer::MakeScreenshot()" to get the rendered image.
+*/
+class SurfaceWindow : public PLRenderer::SurfaceWindow {
+
+
+	//[-------------------------------------------------------]
+	//[ Friends                                               ]
+	//[-------------------------------------------------------]
+	friend class Renderer;
+
+
+	//[-------------------------------------------------------]
+	//[ Public functions                                      ]
+	//[-------------------------------------------------------]
+	public:
+		/**
+		*  @brief
+		*    Destructor
+		*/
+		virtual ~SurfaceWindow();
+
+
+	//[-------------------------------------------------------]
+	//[ Private functions                                     ]
+	//[-------------------------------------------------------]
+	private:
+		/**
+		*  @brief
+		*    Constructor
+		*
+		*  @param[in] cHandler
+		*    Renderer surface handler this surface is assigned with (MUST be valid!)
+		*  @param[in] nNativeWindowHandle
+		*    Handle to the native window the renderer surface is assigned with
+		*  @param[in] vSize
+		*    Surface size used if the size can't be taken from the native window
+		*  @param[in] bFullscreen
+		*    Fullscreen mode?
+		*/
+		SurfaceWindow(PLRenderer::SurfaceWindowHandler &cHandler, PLCore::handle nNativeWindowHandle, const PLMath::Vector2i &vSize, bool bFullscreen = false);
+
+		/**
+		*  @brief
+		*    Makes sure that the color and depth buffers are matching the current surface size
+		*
+		*  @return
+		*    'true' if all went fine, else 'false' (the surface has no size)
+		*/
+		bool UpdateBuffers();
+
+
+	//[-------------------------------------------------------]
+	//[ Private data                                          ]
+	//[-------------------------------------------------------]
+	private:
+		PLMath::Vector2i  m_vSize;			/**< Surface size used if the size can't be taken from the native window */
+		PLMath::Vector2i  m_vBufferSize;	/**< Size of the color and depth buffers */
+		PLCore::uint8	 *m_pnColor;		/**< RGBA color buffer (4 bytes per pixel, bottom row first), can be a null pointer */
+		float			 *m_pfDepth;		/**< Depth buffer (one float per pixel, bottom row first), can be a null pointer */
+		#ifdef LINUX
+			::Display	 *m_pDisplay;		/**< X server display connection used to get the size of the native window, can be a null pointer */
+		#endif
+
+
+	//[-------------------------------------------------------]
+	//[ Public virtual PLRenderer::SurfaceWindow functions    ]
+	//[-------------------------------------------------------]
+	public:
+		virtual bool GetGamma(float &fRed, float &fGreen, float &fBlue) const override;
+		virtual bool SetGamma(float fRed = 1.0f, float fGreen = 1.0f, float fBlue = 1.0f) override;
+
+
+	//[-------------------------------------------------------]
+	//[ Public virtual PLRenderer::Surface functions          ]
+	//[-------------------------------------------------------]
+	public:
+		virtual PLMath::Vector2i GetSize() const override;
+
+
+	//[-------------------------------------------------------]
+	//[ Private virtual PLRenderer::Surface functions         ]
+	//[-------------------------------------------------------]
+	private:
+		virtual bool Init() override;
+		virtual void DeInit() override;
+		virtual bool MakeCurrent(PLCore::uint8 nFace = 0) override;
+		virtual bool UnmakeCurrent() override;
+		virtual bool Present() override;
+
+
+};
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+} // PLRendererSoftware
+
+
+#endif // __PLRENDERERSOFTWARE_SURFACE_WINDOW_H__
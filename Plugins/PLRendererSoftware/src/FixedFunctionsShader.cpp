@@ -0,0 +1,381 @@
+/*********************************************************\
+ *  File: FixedFunctionsShader.cpp                       *
+ *
+ *  Copyright (C) 2002-2013 The PixelLight Team (http://www.pixellight.org/)
+ *
+ *  This file is part of PixelLight.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ *  and associated documentation files (the "Software"), to deal in the Software without
+ *  restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ *  Software is furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all copies or
+ *  substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ *  BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ *  DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ *  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include <PLCore/Tools/Tools.h>
+#include <PLMath/Math.h>
+#include <PLRenderer/Renderer/Renderer.h>
+#include "PLRendererSoftware/FixedFunctionsShader.h"
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+using namespace PLCore;
+using namespace PLMath;
+using namespace PLGraphics;
+namespace PLRendererSoftware {
+
+
+//[-------------------------------------------------------]
+//[ Public functions                                      ]
+//[-------------------------------------------------------]
+/**
+*  @brief
+*    Default constructor
+*/
+FixedFunctionsShader::FixedFunctionsShader() :
+	m_bLighting(false),
+	m_fShininess(0.0f),
+	m_bSpecular(false),
+	m_bNormalizeNormals(true),
+	m_nNumOfLights(0),
+	m_nVaryingSpecular(0),
+	m_nNumOfVaryings(VaryingA + 1),
+	m_pPosition(nullptr),
+	m_pNormal(nullptr),
+	m_pColor(nullptr)
+{
+	// Init data
+	for (uint32 i=0; i<NumOfTextureStages; i++) {
+		m_sTexture[i].pnData  = nullptr;
+		m_nColorTexEnv[i]	  = PLRenderer::FixedFunctions::TextureEnvironment::Modulate;
+		m_nAlphaTexEnv[i]	  = PLRenderer::FixedFunctions::TextureEnvironment::Modulate;
+		m_nVaryingTexCoord[i] = 0;
+		m_pTexCoord[i]		  = nullptr;
+	}
+}
+
+/**
+*  @brief
+*    Destructor
+*/
+FixedFunctionsShader::~FixedFunctionsShader()
+{
+}
+
+
+//[-------------------------------------------------------]
+//[ Private static functions                              ]
+//[-------------------------------------------------------]
+/**
+*  @brief
+*    Applies a texture environment
+*/
+void FixedFunctionsShader::ApplyTextureEnvironment(uint32 nTexEnv, float fTexel, float &fValue)
+{
+	switch (nTexEnv) {
+		case PLRenderer::FixedFunctions::TextureEnvironment::Replace:
+			fValue = fTexel;
+			break;
+
+		case PLRenderer::FixedFunctions::TextureEnvironment::Add:
+			fValue += fTexel;
+			break;
+
+		case PLRenderer::FixedFunctions::TextureEnvironment::PassThru:
+			break;
+
+		default:
+			fValue *= fTexel;
+			break;
+	}
+}
+
+
+//[-------------------------------------------------------]
+//[ Private functions                                     ]
+//[-------------------------------------------------------]
+/**
+*  @brief
+*    Lights a vertex
+*/
+void FixedFunctionsShader::LightVertex(const uint8 *pnVertex, const float fColor[4], float fVarying[]) const
+{
+	// Position and normal in world space, like within OpenGL (0, 0, 1) is used if there's no normal
+	float fValue[4];
+	ReadAttribute(pnVertex, *m_pPosition, fValue);
+	const float *pfM = m_mWorld.fM;
+	const Vector3 vPosition(pfM[0]*fValue[0] + pfM[4]*fValue[1] + pfM[ 8]*fValue[2] + pfM[12]*fValue[3],
+							pfM[1]*fValue[0] + pfM[5]*fValue[1] + pfM[ 9]*fValue[2] + pfM[13]*fValue[3],
+							pfM[2]*fValue[0] + pfM[6]*fValue[1] + pfM[10]*fValue[2] + pfM[14]*fValue[3]);
+	if (m_pNormal) {
+		ReadAttribute(pnVertex, *m_pNormal, fValue);
+	} else {
+		fValue[0] = 0.0f;
+		fValue[1] = 0.0f;
+		fValue[2] = 1.0f;
+	}
+	pfM = m_mWorldInverseTranspose.fM;
+	Vector3 vNormal(pfM[0]*fValue[0] + pfM[4]*fValue[1] + pfM[ 8]*fValue[2],
+					pfM[1]*fValue[0] + pfM[5]*fValue[1] + pfM[ 9]*fValue[2],
+					pfM[2]*fValue[0] + pfM[6]*fValue[1] + pfM[10]*fValue[2]);
+	if (m_bNormalizeNormals)
+		vNormal.Normalize();
+
+	// Emissive and global ambient color
+	float fDiffuse[3]  = { m_cSceneColor.r, m_cSceneColor.g, m_cSceneColor.b };
+	float fSpecular[3] = { 0.0f, 0.0f, 0.0f };
+
+	// Add the contribution of each light
+	for (uint32 i=0; i<m_nNumOfLights; i++) {
+		const Light &sLight = m_sLight[i];
+
+		// Direction towards the light and attenuation
+		Vector3 vLight;
+		float fAttenuation = 1.0f;
+		if (sLight.nType == PLRenderer::FixedFunctions::LightType::Directional) {
+			vLight = sLight.vDirection;
+		} else {
+			vLight = sLight.vPosition - vPosition;
+			const float fDistance = vLight.GetLength();
+			if (fDistance > 0.0f)
+				vLight /= fDistance;
+			const float fDenominator = sLight.fConstantAttenuation + (sLight.fLinearAttenuation + sLight.fQuadraticAttenuation*fDistance)*fDistance;
+			fAttenuation = (fDenominator > 0.0f) ? 1.0f/fDenominator : 1.0f;
+
+			// The spot exponent is always 0, so there's either the full or no light
+			if (sLight.nType == PLRenderer::FixedFunctions::LightType::Spot && -vLight.DotProduct(sLight.vDirection) < sLight.fCosCutOff)
+				continue;
+		}
+
+		// Ambient and diffuse
+		const float fNDotL	  = vNormal.DotProduct(vLight);
+		const float fDiffuseL = (fNDotL > 0.0f) ? fNDotL : 0.0f;
+		fDiffuse[0] += fAttenuation*(sLight.cAmbient.r + sLight.cDiffuse.r*fDiffuseL)*fColor[0];
+		fDiffuse[1] += fAttenuation*(sLight.cAmbient.g + sLight.cDiffuse.g*fDiffuseL)*fColor[1];
+		fDiffuse[2] += fAttenuation*(sLight.cAmbient.b + sLight.cDiffuse.b*fDiffuseL)*fColor[2];
+
+		// Specular of an infinite viewer, only if the surface is facing the light
+		if (m_bSpecular && fNDotL > 0.0f) {
+			Vector3 vHalf = vLight + m_vViewDirection;
+			vHalf.Normalize();
+			const float fNDotH = vNormal.DotProduct(vHalf);
+			if (fNDotH > 0.0f) {
+				const float fSpecularL = fAttenuation*Math::Pow(fNDotH, m_fShininess);
+				fSpecular[0] += sLight.cSpecular.r*fSpecularL;
+				fSpecular[1] += sLight.cSpecular.g*fSpecularL;
+				fSpecular[2] += sLight.cSpecular.b*fSpecularL;
+			}
+		}
+	}
+
+	// Lit color, the alpha of the diffuse material color is kept
+	fVarying[VaryingR] = fDiffuse[0];
+	fVarying[VaryingG] = fDiffuse[1];
+	fVarying[VaryingB] = fDiffuse[2];
+	fVarying[VaryingA] = fColor[3];
+	if (m_bSpecular) {
+		fVarying[m_nVaryingSpecular]	 = fSpecular[0];
+		fVarying[m_nVaryingSpecular + 1] = fSpecular[1];
+		fVarying[m_nVaryingSpecular + 2] = fSpecular[2];
+	}
+}
+
+
+//[-------------------------------------------------------]
+//[ Public virtual Shader functions                       ]
+//[-------------------------------------------------------]
+bool FixedFunctionsShader::Setup(const PLRenderer::Renderer &cRenderer, const PLRenderer::VertexBuffer &cVertexBuffer)
+{
+	const PLRenderer::FixedFunctions *pFixedFunctions = cRenderer.GetFixedFunctions();
+	if (!pFixedFunctions)
+		return false; // Error!
+
+	// Transform states and color
+	m_mWorld			   = pFixedFunctions->GetTransformState(PLRenderer::FixedFunctions::Transform::World);
+	m_mWorldViewProjection = pFixedFunctions->GetTransformState(PLRenderer::FixedFunctions::Transform::Projection)*
+							 pFixedFunctions->GetTransformState(PLRenderer::FixedFunctions::Transform::View)*
+							 m_mWorld;
+	m_cColor			   = pFixedFunctions->GetColor();
+	m_nNumOfVaryings	   = VaryingA + 1;
+
+	// Lighting
+	m_bLighting = (pFixedFunctions->GetRenderState(PLRenderer::FixedFunctions::RenderState::Lighting) != 0);
+	m_bSpecular = false;
+	if (m_bLighting) {
+		// Normals into world space
+		m_mWorldInverseTranspose = m_mWorld.GetInverted().GetTransposed();
+		m_bNormalizeNormals = (pFixedFunctions->GetRenderState(PLRenderer::FixedFunctions::RenderState::NormalizeNormals) != 0);
+
+		// The infinite viewer is looking along the negative z axis of the view space
+		const Matrix4x4 mViewInverse = pFixedFunctions->GetTransformState(PLRenderer::FixedFunctions::Transform::View).GetInverted();
+		m_vViewDirection.SetXYZ(mViewInverse.fM[8], mViewInverse.fM[9], mViewInverse.fM[10]);
+		m_vViewDirection.Normalize();
+
+		// Material
+		const uint32 nAmbient  = pFixedFunctions->GetRenderState(PLRenderer::FixedFunctions::RenderState::Ambient);
+		const uint32 nEmission = pFixedFunctions->GetMaterialState(PLRenderer::FixedFunctions::MaterialState::Emission);
+		const uint32 nSpecular = pFixedFunctions->GetMaterialState(PLRenderer::FixedFunctions::MaterialState::Specular);
+		m_cSceneColor.SetRGBA(Color4::RedFromUInt32  (nEmission) + Color4::RedFromUInt32  (nAmbient)*m_cColor.r,
+							  Color4::GreenFromUInt32(nEmission) + Color4::GreenFromUInt32(nAmbient)*m_cColor.g,
+							  Color4::BlueFromUInt32 (nEmission) + Color4::BlueFromUInt32 (nAmbient)*m_cColor.b,
+							  0.0f);
+		m_fShininess = Tools::UInt32ToFloat(pFixedFunctions->GetMaterialState(PLRenderer::FixedFunctions::MaterialState::Shininess));
+
+		// Enabled lights
+		m_nNumOfLights = 0;
+		const uint32 nMaxLights = Math::Min(static_cast<uint32>(pFixedFunctions->GetCapabilities().nMaxActiveLights), static_cast<uint32>(sizeof(m_sLight)/sizeof(Light)));
+		for (uint32 i=0; i<nMaxLights; i++) {
+			PLRenderer::FixedFunctions::Light sFixedFunctionsLight;
+			if (pFixedFunctions->IsLightEnabled(i) && pFixedFunctions->GetLight(i, sFixedFunctionsLight)) {
+				Light &sLight = m_sLight[m_nNumOfLights];
+				sLight.nType				 = sFixedFunctionsLight.nType;
+				sLight.cAmbient				 = sFixedFunctionsLight.cAmbient;
+				sLight.cDiffuse				 = sFixedFunctionsLight.cDiffuse;
+				sLight.cSpecular.SetRGBA(sFixedFunctionsLight.cSpecular.r*Color4::RedFromUInt32  (nSpecular),
+										 sFixedFunctionsLight.cSpecular.g*Color4::GreenFromUInt32(nSpecular),
+										 sFixedFunctionsLight.cSpecular.b*Color4::BlueFromUInt32 (nSpecular),
+										 0.0f);
+				sLight.vPosition			 = sFixedFunctionsLight.vPosition;
+				sLight.vDirection			 = sFixedFunctionsLight.vDirection.GetNormalized();
+				sLight.fCosCutOff			 = Math::Cos(sFixedFunctionsLight.fCutOff*static_cast<float>(Math::DegToRad));
+				sLight.fConstantAttenuation  = sFixedFunctionsLight.fConstantAttenuation;
+				sLight.fLinearAttenuation	 = sFixedFunctionsLight.fLinearAttenuation;
+				sLight.fQuadraticAttenuation = sFixedFunctionsLight.fQuadraticAttenuation;
+				if (sLight.cSpecular.r || sLight.cSpecular.g || sLight.cSpecular.b)
+					m_bSpecular = true;
+				m_nNumOfLights++;
+			}
+		}
+
+		// The separate specular color is only interpolated if there's any
+		if (m_bSpecular) {
+			m_nVaryingSpecular = m_nNumOfVaryings;
+			m_nNumOfVaryings += 3;
+		}
+	}
+
+	// Texture stages, the texture coordinate is only interpolated if there's a texture
+	for (uint32 i=0; i<NumOfTextureStages; i++) {
+		if (m_sTexture[i].Setup(cRenderer, i)) {
+			m_mTexture[i]		  = pFixedFunctions->GetTransformState(static_cast<PLRenderer::FixedFunctions::Transform::Enum>(PLRenderer::FixedFunctions::Transform::Texture0 + i));
+			m_nColorTexEnv[i]	  = pFixedFunctions->GetTextureStageState(i, PLRenderer::FixedFunctions::TextureStage::ColorTexEnv);
+			m_nAlphaTexEnv[i]	  = pFixedFunctions->GetTextureStageState(i, PLRenderer::FixedFunctions::TextureStage::AlphaTexEnv);
+			m_nVaryingTexCoord[i] = m_nNumOfVaryings;
+			m_nNumOfVaryings += 2;
+		}
+	}
+
+	// Get the used vertex attributes, each texture stage is using the texture coordinate channel with the same index
+	m_pPosition = cVertexBuffer.GetVertexAttribute(PLRenderer::VertexBuffer::Position);
+	m_pNormal	= m_bLighting ? cVertexBuffer.GetVertexAttribute(PLRenderer::VertexBuffer::Normal) : nullptr;
+	m_pColor	= cVertexBuffer.GetVertexAttribute(PLRenderer::VertexBuffer::Color);
+	for (uint32 i=0; i<NumOfTextureStages; i++)
+		m_pTexCoord[i] = m_sTexture[i].pnData ? cVertexBuffer.GetVertexAttribute(PLRenderer::VertexBuffer::TexCoord, i) : nullptr;
+
+	// A position is required
+	return (m_pPosition != nullptr);
+}
+
+uint32 FixedFunctionsShader::GetNumOfVaryings() const
+{
+	return m_nNumOfVaryings;
+}
+
+void FixedFunctionsShader::ProcessVertex(const uint8 *pnVertex, float fPosition[4], float fVarying[]) const
+{
+	// Position into clip space
+	const float *pfM = m_mWorldViewProjection.fM;
+	float fValue[4];
+	ReadAttribute(pnVertex, *m_pPosition, fValue);
+	fPosition[0] = pfM[0]*fValue[0] + pfM[4]*fValue[1] + pfM[ 8]*fValue[2] + pfM[12]*fValue[3];
+	fPosition[1] = pfM[1]*fValue[0] + pfM[5]*fValue[1] + pfM[ 9]*fValue[2] + pfM[13]*fValue[3];
+	fPosition[2] = pfM[2]*fValue[0] + pfM[6]*fValue[1] + pfM[10]*fValue[2] + pfM[14]*fValue[3];
+	fPosition[3] = pfM[3]*fValue[0] + pfM[7]*fValue[1] + pfM[11]*fValue[2] + pfM[15]*fValue[3];
+
+	// Color, lit if lighting is enabled
+	if (m_pColor)
+		ReadAttribute(pnVertex, *m_pColor, fValue);
+	else
+		m_cColor.GetRGBA(fValue);
+	if (m_bLighting) {
+		LightVertex(pnVertex, fValue, fVarying);
+	} else {
+		fVarying[VaryingR] = fValue[0];
+		fVarying[VaryingG] = fValue[1];
+		fVarying[VaryingB] = fValue[2];
+		fVarying[VaryingA] = fValue[3];
+	}
+
+	// Texture coordinates transformed by the texture matrices
+	for (uint32 i=0; i<NumOfTextureStages; i++) {
+		if (m_sTexture[i].pnData) {
+			float *pfTexCoord = &fVarying[m_nVaryingTexCoord[i]];
+			if (m_pTexCoord[i]) {
+				const float *pfT = m_mTexture[i].fM;
+				ReadAttribute(pnVertex, *m_pTexCoord[i], fValue);
+				const float fU = pfT[0]*fValue[0] + pfT[4]*fValue[1] + pfT[ 8]*fValue[2] + pfT[12]*fValue[3];
+				const float fV = pfT[1]*fValue[0] + pfT[5]*fValue[1] + pfT[ 9]*fValue[2] + pfT[13]*fValue[3];
+				const float fQ = pfT[3]*fValue[0] + pfT[7]*fValue[1] + pfT[11]*fValue[2] + pfT[15]*fValue[3];
+				const float fInvQ = (fQ != 0.0f) ? 1.0f/fQ : 1.0f;
+				pfTexCoord[0] = fU*fInvQ;
+				pfTexCoord[1] = fV*fInvQ;
+			} else {
+				pfTexCoord[0] = 0.0f;
+				pfTexCoord[1] = 0.0f;
+			}
+		}
+	}
+}
+
+bool FixedFunctionsShader::ProcessPixel(const float fVarying[], float fColor[4]) const
+{
+	// Interpolated color
+	fColor[0] = fVarying[VaryingR];
+	fColor[1] = fVarying[VaryingG];
+	fColor[2] = fVarying[VaryingB];
+	fColor[3] = fVarying[VaryingA];
+
+	// Texture stages, each one is combining its texel with the result of the previous stage
+	for (uint32 i=0; i<NumOfTextureStages; i++) {
+		const Texture &sTexture = m_sTexture[i];
+		if (sTexture.pnData) {
+			float fTexel[4];
+			sTexture.Sample(fVarying[m_nVaryingTexCoord[i]], fVarying[m_nVaryingTexCoord[i] + 1], fTexel);
+			ApplyTextureEnvironment(m_nColorTexEnv[i], fTexel[0], fColor[0]);
+			ApplyTextureEnvironment(m_nColorTexEnv[i], fTexel[1], fColor[1]);
+			ApplyTextureEnvironment(m_nColorTexEnv[i], fTexel[2], fColor[2]);
+			ApplyTextureEnvironment(m_nAlphaTexEnv[i], fTexel[3], fColor[3]);
+		}
+	}
+
+	// Add the separate specular color after texturing
+	if (m_bSpecular) {
+		fColor[0] += fVarying[m_nVaryingSpecular];
+		fColor[1] += fVarying[m_nVaryingSpecular + 1];
+		fColor[2] += fVarying[m_nVaryingSpecular + 2];
+	}
+
+	// Done, the fixed functions pipeline never discards a pixel (the alpha test is done by the rasterizer)
+	return true;
+}
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+} // PLRendererSoftware
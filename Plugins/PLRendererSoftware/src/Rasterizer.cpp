@@ -0,0 +1,1081 @@
+/*********************************************************\
+ *  File: Rasterizer.cpp                                 *
+ *
+ *  Copyright (C) 2002-2013 The PixelLight Team (http://www.pixellight.org/)
+ *
+ *  This file is part of PixelLight.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ *  and associated documentation files (the "Software"), to deal in the Software without
+ *  restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ *  Software is furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all copies or
+ *  substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ *  BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ *  DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ *  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include <PLCore/Tools/Tools.h>
+#include <PLCore/System/JobSystem.h>
+#include <PLMath/Math.h>
+#include <PLRenderer/Renderer/FixedFunctions.h>
+#include "PLRendererSoftware/Renderer.h"
+#include "PLRendererSoftware/IndexBuffer.h"
+#include "PLRendererSoftware/VertexBuffer.h"
+#include "PLRendererSoftware/Rasterizer.h"
+#ifdef PLMATH_SSE
+	#include <xmmintrin.h>
+#endif
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+using namespace PLCore;
+using namespace PLMath;
+using namespace PLGraphics;
+using namespace PLRenderer;
+namespace PLRendererSoftware {
+
+
+//[-------------------------------------------------------]
+//[ Local definitions                                     ]
+//[-------------------------------------------------------]
+static const uint32 MaxTrianglesPerFlush = 16384;	/**< Number of binned triangles after which the tiles are rasterized even if the draw call isn't finished yet */
+static const float  GuardBand			 = 4.0f;	/**< Triangles are clipped against x and y at [-GuardBand*w, GuardBand*w], everything else is done by the pixel scissoring */
+static const float  SubPixelPrecision	 = 16.0f;	/**< Projected vertex positions are snapped to 1/SubPixelPrecision pixels */
+static const uint32 NumOfClipPlanes		 = 6;		/**< Near, far, left, right, bottom, top */
+
+
+//[-------------------------------------------------------]
+//[ Local functions                                       ]
+//[-------------------------------------------------------]
+/**
+*  @brief
+*    Returns an index of an index buffer
+*/
+static inline uint32 GetIndex(const void *pData, PLRenderer::IndexBuffer::EType nType, uint32 nIndex)
+{
+	switch (nType) {
+		case PLRenderer::IndexBuffer::UInt:
+			return static_cast<const uint32*>(pData)[nIndex];
+
+		case PLRenderer::IndexBuffer::UShort:
+			return static_cast<const uint16*>(pData)[nIndex];
+
+		case PLRenderer::IndexBuffer::UByte:
+		default:
+			return static_cast<const uint8*>(pData)[nIndex];
+	}
+}
+
+/**
+*  @brief
+*    Compares two values by using the given comparison function (see PLRenderer::Compare)
+*/
+static inline bool CompareValues(uint32 nFunction, float fValue, float fReference)
+{
+	switch (nFunction) {
+		case Compare::Never:		return false;
+		case Compare::Less:			return (fValue <  fReference);
+		case Compare::Equal:		return (fValue == fReference);
+		case Compare::LessEqual:	return (fValue <= fReference);
+		case Compare::Greater:		return (fValue >  fReference);
+		case Compare::NotEqual:		return (fValue != fReference);
+		case Compare::GreaterEqual:	return (fValue >= fReference);
+		case Compare::Always:
+		default:					return true;
+	}
+}
+
+#ifdef PLMATH_SSE
+	/**
+	*  @brief
+	*    Returns the lanes passing the comparison as bit mask (see PLRenderer::Compare)
+	*/
+	static inline int CompareValues(uint32 nFunction, __m128 vValue, __m128 vReference)
+	{
+		switch (nFunction) {
+			case Compare::Never:		return 0;
+			case Compare::Less:			return _mm_movemask_ps(_mm_cmplt_ps (vValue, vReference));
+			case Compare::Equal:		return _mm_movemask_ps(_mm_cmpeq_ps (vValue, vReference));
+			case Compare::LessEqual:	return _mm_movemask_ps(_mm_cmple_ps (vValue, vReference));
+			case Compare::Greater:		return _mm_movemask_ps(_mm_cmpgt_ps (vValue, vReference));
+			case Compare::NotEqual:		return _mm_movemask_ps(_mm_cmpneq_ps(vValue, vReference));
+			case Compare::GreaterEqual:	return _mm_movemask_ps(_mm_cmpge_ps (vValue, vReference));
+			case Compare::Always:
+			default:					return 0xF;
+		}
+	}
+#endif
+
+/**
+*  @brief
+*    Returns the blend factor for a color (see PLRenderer::BlendFunc)
+*/
+static inline void GetBlendFactor(uint32 nFunction, const float fSource[4], const float fDestination[4], float fFactor[4])
+{
+	switch (nFunction) {
+		case BlendFunc::Zero:
+			fFactor[0] = fFactor[1] = fFactor[2] = fFactor[3] = 0.0f;
+			break;
+
+		case BlendFunc::SrcColor:
+			fFactor[0] = fSource[0];
+			fFactor[1] = fSource[1];
+			fFactor[2] = fSource[2];
+			fFactor[3] = fSource[3];
+			break;
+
+		case BlendFunc::InvSrcColor:
+			fFactor[0] = 1.0f - fSource[0];
+			fFactor[1] = 1.0f - fSource[1];
+			fFactor[2] = 1.0f - fSource[2];
+			fFactor[3] = 1.0f - fSource[3];
+			break;
+
+		case BlendFunc::SrcAlpha:
+			fFactor[0] = fFactor[1] = fFactor[2] = fFactor[3] = fSource[3];
+			break;
+
+		case BlendFunc::InvSrcAlpha:
+			fFactor[0] = fFactor[1] = fFactor[2] = fFactor[3] = 1.0f - fSource[3];
+			break;
+
+		case BlendFunc::SrcAlphaSat:
+			fFactor[0] = fFactor[1] = fFactor[2] = Math::Min(fSource[3], 1.0f - fDestination[3]);
+			fFactor[3] = 1.0f;
+			break;
+
+		case BlendFunc::DstColor:
+			fFactor[0] = fDestination[0];
+			fFactor[1] = fDestination[1];
+			fFactor[2] = fDestination[2];
+			fFactor[3] = fDestination[3];
+			break;
+
+		case BlendFunc::InvDstColor:
+			fFactor[0] = 1.0f - fDestination[0];
+			fFactor[1] = 1.0f - fDestination[1];
+			fFactor[2] = 1.0f - fDestination[2];
+			fFactor[3] = 1.0f - fDestination[3];
+			break;
+
+		case BlendFunc::DstAlpha:
+			fFactor[0] = fFactor[1] = fFactor[2] = fFactor[3] = fDestination[3];
+			break;
+
+		case BlendFunc::InvDstAlpha:
+			fFactor[0] = fFactor[1] = fFactor[2] = fFactor[3] = 1.0f - fDestination[3];
+			break;
+
+		case BlendFunc::One:
+		default:
+			fFactor[0] = fFactor[1] = fFactor[2] = fFactor[3] = 1.0f;
+			break;
+	}
+}
+
+/**
+*  @brief
+*    Converts a color component into a byte
+*/
+static inline uint8 ToByte(float fValue)
+{
+	return (fValue <= 0.0f) ? 0 : ((fValue >= 1.0f) ? 255 : static_cast<uint8>(fValue*255.0f + 0.5f));
+}
+
+
+//[-------------------------------------------------------]
+//[ Public functions                                      ]
+//[-------------------------------------------------------]
+/**
+*  @brief
+*    Constructor
+*/
+Rasterizer::Rasterizer(Renderer &cRenderer) :
+	m_pRenderer(&cRenderer),
+	m_nNumOfVertices(0),
+	m_nFirstVertex(0),
+	m_plstBins(nullptr),
+	m_nNumOfTilesX(0),
+	m_nNumOfTilesY(0)
+{
+	// Init data
+	m_lstTriangles.SetResizeCount(1024);
+	m_lstUsedTiles.SetResizeCount(64);
+}
+
+/**
+*  @brief
+*    Destructor
+*/
+Rasterizer::~Rasterizer()
+{
+	if (m_plstBins)
+		delete [] m_plstBins;
+}
+
+/**
+*  @brief
+*    Clears the given render target
+*/
+void Rasterizer::Clear(const Target &sTarget, uint32 nFlags, const Color4 &cColor, float fZ)
+{
+	// Get the area to clear, the scissor rectangle is given with the top-left corner
+	int nMinX = 0;
+	int nMinY = 0;
+	int nMaxX = static_cast<int>(sTarget.nWidth);
+	int nMaxY = static_cast<int>(sTarget.nHeight);
+	if (m_pRenderer->GetRenderState(RenderState::ScissorTestEnable)) {
+		const Rectangle &cScissorRect = m_pRenderer->GetScissorRect();
+		nMinX = Math::Max(nMinX, static_cast<int>(cScissorRect.vMin.x));
+		nMaxX = Math::Min(nMaxX, static_cast<int>(cScissorRect.vMax.x));
+		nMinY = Math::Max(nMinY, static_cast<int>(sTarget.nHeight) - static_cast<int>(cScissorRect.vMax.y));
+		nMaxY = Math::Min(nMaxY, static_cast<int>(sTarget.nHeight) - static_cast<int>(cScissorRect.vMin.y));
+	}
+	if (nMinX >= nMaxX || nMinY >= nMaxY)
+		return; // Nothing to do
+
+	// Clear the color buffer
+	if ((nFlags & PLRenderer::Clear::Color) && sTarget.pnColor) {
+		bool bColorMask[4];
+		m_pRenderer->GetColorMask(bColorMask[0], bColorMask[1], bColorMask[2], bColorMask[3]);
+		const uint8 nColor[4] = { ToByte(cColor.r), ToByte(cColor.g), ToByte(cColor.b), ToByte(cColor.a) };
+		for (int nY=nMinY; nY<nMaxY; nY++) {
+			uint8 *pnColor = &sTarget.pnColor[(nY*sTarget.nWidth + nMinX)*4];
+			for (int nX=nMinX; nX<nMaxX; nX++, pnColor+=4) {
+				for (int i=0; i<4; i++) {
+					if (bColorMask[i])
+						pnColor[i] = nColor[i];
+				}
+			}
+		}
+	}
+
+	// Clear the depth buffer
+	if ((nFlags & PLRenderer::Clear::ZBuffer) && sTarget.pfDepth) {
+		for (int nY=nMinY; nY<nMaxY; nY++) {
+			float *pfDepth = &sTarget.pfDepth[nY*sTarget.nWidth + nMinX];
+			for (int nX=nMinX; nX<nMaxX; nX++, pfDepth++)
+				*pfDepth = fZ;
+		}
+	}
+}
+
+/**
+*  @brief
+*    Draws primitives by using the current renderer states
+*/
+bool Rasterizer::Draw(const Target &sTarget, Primitive::Enum nType, uint32 nStartIndex, uint32 nNumVertices,
+					  const IndexBuffer *pIndexBuffer, uint32 nMinIndex, uint32 nMaxIndex)
+{
+	// Get the vertex buffer of stream 0, the other streams are ignored
+	uint32 nVertexOffset = 0;
+	const VertexBuffer *pVertexBuffer = static_cast<const VertexBuffer*>(m_pRenderer->GetFixedFunctions()->GetVertexBuffer(0, &nVertexOffset));
+	if (!pVertexBuffer || !pVertexBuffer->m_pData)
+		return false; // Error!
+
+	// Check the index buffer
+	if (pIndexBuffer && (!pIndexBuffer->m_pData || nStartIndex + nNumVertices > pIndexBuffer->GetNumOfElements() || nMinIndex > nMaxIndex))
+		return false; // Error!
+
+	// Gather the renderer states, the shader of the renderer is used if there's one
+	Shader &cShader = m_pRenderer->GetShader() ? *m_pRenderer->GetShader() : static_cast<Shader&>(m_cFixedFunctionsShader);
+	if (!cShader.Setup(*m_pRenderer, *pVertexBuffer))
+		return false; // Error!
+	if (!SetupDrawState(sTarget, cShader))
+		return true; // Done, nothing to draw
+
+	// Transform the used vertices
+	const bool bResult = pIndexBuffer ? TransformVertices(*pVertexBuffer, nVertexOffset, nMinIndex, nMaxIndex - nMinIndex + 1)
+									  : TransformVertices(*pVertexBuffer, nVertexOffset, nStartIndex, nNumVertices);
+	if (!bResult)
+		return false; // Error!
+
+	// Assemble the primitives, primitives using invalid indices are skipped
+	switch (nType) {
+		case Primitive::PointList:
+			for (uint32 i=0; i<nNumVertices; i++) {
+				const Vertex *pVertex = GetVertex(pIndexBuffer, nStartIndex + i);
+				if (pVertex)
+					AddPoint(*pVertex);
+			}
+			break;
+
+		case Primitive::LineList:
+		case Primitive::LineStrip:
+		{
+			const uint32 nNumOfLines = (nType == Primitive::LineList) ? nNumVertices/2 : ((nNumVertices > 1) ? nNumVertices - 1 : 0);
+			for (uint32 nLine=0; nLine<nNumOfLines; nLine++) {
+				const uint32 nIndex = (nType == Primitive::LineList) ? nLine*2 : nLine;
+				const Vertex *pVertex0 = GetVertex(pIndexBuffer, nStartIndex + nIndex);
+				const Vertex *pVertex1 = GetVertex(pIndexBuffer, nStartIndex + nIndex + 1);
+				if (pVertex0 && pVertex1)
+					AddLine(*pVertex0, *pVertex1);
+			}
+			break;
+		}
+
+		case Primitive::TriangleList:
+		case Primitive::TriangleStrip:
+		case Primitive::TriangleFan:
+		{
+			const uint32 nNumOfTriangles = (nType == Primitive::TriangleList) ? nNumVertices/3 : ((nNumVertices > 2) ? nNumVertices - 2 : 0);
+			for (uint32 nTriangle=0; nTriangle<nNumOfTriangles; nTriangle++) {
+				// Get the vertices of the triangle, every second triangle of a strip has the other orientation
+				uint32 nIndex[3];
+				switch (nType) {
+					case Primitive::TriangleStrip:
+						nIndex[0] = (nTriangle & 1) ? nTriangle + 1 : nTriangle;
+						nIndex[1] = (nTriangle & 1) ? nTriangle     : nTriangle + 1;
+						nIndex[2] = nTriangle + 2;
+						break;
+
+					case Primitive::TriangleFan:
+						nIndex[0] = 0;
+						nIndex[1] = nTriangle + 1;
+						nIndex[2] = nTriangle + 2;
+						break;
+
+					case Primitive::TriangleList:
+					default:
+						nIndex[0] = nTriangle*3;
+						nIndex[1] = nTriangle*3 + 1;
+						nIndex[2] = nTriangle*3 + 2;
+						break;
+				}
+				const Vertex *pVertex0 = GetVertex(pIndexBuffer, nStartIndex + nIndex[0]);
+				const Vertex *pVertex1 = GetVertex(pIndexBuffer, nStartIndex + nIndex[1]);
+				const Vertex *pVertex2 = GetVertex(pIndexBuffer, nStartIndex + nIndex[2]);
+				if (pVertex0 && pVertex1 && pVertex2)
+					AddTriangle(*pVertex0, *pVertex1, *pVertex2);
+			}
+			break;
+		}
+
+		default:
+			return false; // Error, unknown primitive type!
+	}
+
+	// Rasterize the binned triangles
+	Flush();
+
+	// Done
+	return true;
+}
+
+
+//[-------------------------------------------------------]
+//[ Private static functions                              ]
+//[-------------------------------------------------------]
+/**
+*  @brief
+*    Job system parallel for function rasterizing a range of the used tiles
+*/
+void Rasterizer::RasterizeTiles(uint32 nFirst, uint32 nEnd, void *pData)
+{
+	const Rasterizer &cRasterizer = *static_cast<const Rasterizer*>(pData);
+	const uint32 *pnUsedTiles = cRasterizer.m_lstUsedTiles.GetData();
+	for (uint32 i=nFirst; i<nEnd; i++)
+		cRasterizer.RasterizeTile(pnUsedTiles[i]);
+}
+
+
+//[-------------------------------------------------------]
+//[ Private functions                                     ]
+//[-------------------------------------------------------]
+/**
+*  @brief
+*    Copy constructor
+*/
+Rasterizer::Rasterizer(const Rasterizer &cSource) :
+	m_pRenderer(cSource.m_pRenderer),
+	m_nNumOfVertices(0),
+	m_nFirstVertex(0),
+	m_plstBins(nullptr),
+	m_nNumOfTilesX(0),
+	m_nNumOfTilesY(0)
+{
+	// No implementation because the copy constructor is never used
+}
+
+/**
+*  @brief
+*    Copy operator
+*/
+Rasterizer &Rasterizer::operator =(const Rasterizer &cSource)
+{
+	// No implementation because the copy operator is never used
+	return *this;
+}
+
+/**
+*  @brief
+*    Gathers the current renderer states
+*/
+bool Rasterizer::SetupDrawState(const Target &sTarget, const Shader &cShader)
+{
+	const PLRenderer::FixedFunctions &cFixedFunctions = *m_pRenderer->GetFixedFunctions();
+	DrawState &sState = m_sState;
+	sState.sTarget = sTarget;
+
+	// Viewport, the renderer gives us the top-left corner but the buffers start with the bottom row
+	const Rectangle &cViewport = m_pRenderer->GetViewport(&sState.fMinZ, &sState.fMaxZ);
+	sState.fViewportX	   = cViewport.vMin.x;
+	sState.fViewportY	   = static_cast<float>(sTarget.nHeight) - cViewport.vMax.y;
+	sState.fViewportWidth  = cViewport.GetWidth();
+	sState.fViewportHeight = cViewport.GetHeight();
+
+	// Drawing area, a pixel is within the viewport if its center is
+	sState.nClipMinX = Math::Max(0, static_cast<int>(Math::Ceil(sState.fViewportX - 0.5f)));
+	sState.nClipMinY = Math::Max(0, static_cast<int>(Math::Ceil(sState.fViewportY - 0.5f)));
+	sState.nClipMaxX = Math::Min(static_cast<int>(sTarget.nWidth),  static_cast<int>(Math::Ceil(sState.fViewportX + sState.fViewportWidth  - 0.5f)));
+	sState.nClipMaxY = Math::Min(static_cast<int>(sTarget.nHeight), static_cast<int>(Math::Ceil(sState.fViewportY + sState.fViewportHeight - 0.5f)));
+	if (m_pRenderer->GetRenderState(RenderState::ScissorTestEnable)) {
+		const Rectangle &cScissorRect = m_pRenderer->GetScissorRect();
+		sState.nClipMinX = Math::Max(sState.nClipMinX, static_cast<int>(cScissorRect.vMin.x));
+		sState.nClipMaxX = Math::Min(sState.nClipMaxX, static_cast<int>(cScissorRect.vMax.x));
+		sState.nClipMinY = Math::Max(sState.nClipMinY, static_cast<int>(sTarget.nHeight) - static_cast<int>(cScissorRect.vMax.y));
+		sState.nClipMaxY = Math::Min(sState.nClipMaxY, static_cast<int>(sTarget.nHeight) - static_cast<int>(cScissorRect.vMin.y));
+	}
+	if (sState.nClipMinX >= sState.nClipMaxX || sState.nClipMinY >= sState.nClipMaxY)
+		return false; // Nothing to draw
+
+	// Culling, Cull::CCW means that counterclockwise triangles are front-facing and therefore clockwise ones are culled
+	uint32 nCullMode = m_pRenderer->GetRenderState(RenderState::CullMode);
+	if (m_pRenderer->GetRenderState(RenderState::InvCullMode) && nCullMode != Cull::None)
+		nCullMode = (nCullMode == Cull::CW) ? Cull::CCW : Cull::CW;
+	sState.bCullCW  = (nCullMode == Cull::CCW);
+	sState.bCullCCW = (nCullMode == Cull::CW);
+
+	// Fill mode, point size and line width
+	sState.nFillMode  = (m_pRenderer->GetRenderState(RenderState::FixedFillMode) != Fill::Unknown) ?
+						 m_pRenderer->GetRenderState(RenderState::FixedFillMode) : m_pRenderer->GetRenderState(RenderState::FillMode);
+	sState.fPointSize = Tools::UInt32ToFloat(m_pRenderer->GetRenderState(RenderState::PointSize));
+	sState.fLineWidth = Tools::UInt32ToFloat(m_pRenderer->GetRenderState(RenderState::LineWidth));
+
+	// Depth, like within OpenGL there are no depth buffer writes while the depth test is disabled
+	sState.bDepthTest	  = (m_pRenderer->GetRenderState(RenderState::ZEnable) && sTarget.pfDepth);
+	sState.bDepthWrite	  = (sState.bDepthTest && m_pRenderer->GetRenderState(RenderState::ZWriteEnable));
+	sState.bDepthClamp	  = (m_pRenderer->GetRenderState(RenderState::DepthClamp) != 0);
+	sState.nDepthFunction = m_pRenderer->GetRenderState(RenderState::ZFunc);
+
+	// Blending and color mask
+	sState.bBlend		 = (m_pRenderer->GetRenderState(RenderState::BlendEnable) != 0);
+	sState.nSrcBlendFunc = m_pRenderer->GetRenderState(RenderState::SrcBlendFunc);
+	sState.nDstBlendFunc = m_pRenderer->GetRenderState(RenderState::DstBlendFunc);
+	m_pRenderer->GetColorMask(sState.bColorMask[0], sState.bColorMask[1], sState.bColorMask[2], sState.bColorMask[3]);
+	if (!sTarget.pnColor)
+		sState.bColorMask[0] = sState.bColorMask[1] = sState.bColorMask[2] = sState.bColorMask[3] = false;
+	if (!sState.bDepthWrite && !sState.bColorMask[0] && !sState.bColorMask[1] && !sState.bColorMask[2] && !sState.bColorMask[3])
+		return false; // Nothing to draw
+
+	// Alpha test
+	sState.bAlphaTest		   = (cFixedFunctions.GetRenderState(PLRenderer::FixedFunctions::RenderState::AlphaTestEnable) != 0);
+	sState.nAlphaTestFunction  = cFixedFunctions.GetRenderState(PLRenderer::FixedFunctions::RenderState::AlphaTestFunction);
+	sState.fAlphaTestReference = Tools::UInt32ToFloat(cFixedFunctions.GetRenderState(PLRenderer::FixedFunctions::RenderState::AlphaTestReference));
+
+	// Shader
+	sState.pShader		  = &cShader;
+	sState.nNumOfVaryings = Math::Min(cShader.GetNumOfVaryings(), Shader::MaxVaryings);
+
+	// Make sure the tile bins are matching the render target
+	const uint32 nNumOfTilesX = (sTarget.nWidth  + TileSize - 1)/TileSize;
+	const uint32 nNumOfTilesY = (sTarget.nHeight + TileSize - 1)/TileSize;
+	if (!m_plstBins || m_nNumOfTilesX*m_nNumOfTilesY < nNumOfTilesX*nNumOfTilesY) {
+		if (m_plstBins)
+			delete [] m_plstBins;
+		m_plstBins = new Array<uint32>[nNumOfTilesX*nNumOfTilesY];
+		for (uint32 i=0; i<nNumOfTilesX*nNumOfTilesY; i++)
+			m_plstBins[i].SetResizeCount(256);
+	}
+	m_nNumOfTilesX = nNumOfTilesX;
+	m_nNumOfTilesY = nNumOfTilesY;
+
+	// Done
+	return true;
+}
+
+/**
+*  @brief
+*    Transforms a range of vertices of the current vertex buffer
+*/
+bool Rasterizer::TransformVertices(const VertexBuffer &cVertexBuffer, uint32 nVertexOffset, uint32 nFirstVertex, uint32 nNumOfVertices)
+{
+	// Check the range
+	if (nVertexOffset + nFirstVertex + nNumOfVertices > cVertexBuffer.GetNumOfElements())
+		return false; // Error!
+
+	// Make sure there's enough space for the transformed vertices
+	if (m_lstVertices.GetNumOfElements() < nNumOfVertices)
+		m_lstVertices.Resize(nNumOfVertices);
+	m_nNumOfVertices = nNumOfVertices;
+	m_nFirstVertex	 = nFirstVertex;
+
+	// Let the shader process the vertices
+	const Shader &cShader	  = *m_sState.pShader;
+	const uint32  nVertexSize = cVertexBuffer.GetVertexSize();
+	const uint8  *pnVertex	  = &cVertexBuffer.m_pData[(nVertexOffset + nFirstVertex)*nVertexSize];
+	Vertex		 *pVertex	  = m_lstVertices.GetData();
+	for (uint32 i=0; i<nNumOfVertices; i++, pnVertex+=nVertexSize, pVertex++)
+		cShader.ProcessVertex(pnVertex, pVertex->fAttribute, &pVertex->fAttribute[AttributeVarying]);
+
+	// Done
+	return true;
+}
+
+/**
+*  @brief
+*    Returns a transformed vertex of the current draw call
+*/
+const Rasterizer::Vertex *Rasterizer::GetVertex(const IndexBuffer *pIndexBuffer, uint32 nIndex) const
+{
+	const uint32 nVertex = (pIndexBuffer ? GetIndex(pIndexBuffer->m_pData, pIndexBuffer->GetElementType(), nIndex) : nIndex) - m_nFirstVertex;
+	return (nVertex < m_nNumOfVertices) ? &m_lstVertices[nVertex] : nullptr;
+}
+
+/**
+*  @brief
+*    Adds a point as screen aligned quad
+*/
+void Rasterizer::AddPoint(const Vertex &sVertex)
+{
+	const DrawState &sState = m_sState;
+
+	// Like within OpenGL, a point is dropped if its center is outside of the view volume
+	const float *pfAttribute = sVertex.fAttribute;
+	const float  fW			 = pfAttribute[AttributeW];
+	if (fW <= 0.0f || pfAttribute[AttributeX] < -fW || pfAttribute[AttributeX] > fW || pfAttribute[AttributeY] < -fW || pfAttribute[AttributeY] > fW ||
+		pfAttribute[AttributeZ] < -fW || (!sState.bDepthClamp && pfAttribute[AttributeZ] > fW))
+		return;
+
+	// Half of the point size within clip space
+	const float fHalfX = sState.fPointSize/sState.fViewportWidth*fW;
+	const float fHalfY = sState.fPointSize/sState.fViewportHeight*fW;
+
+	// Quad, all corners are getting the attributes of the point
+	Vertex sCorner[4] = { sVertex, sVertex, sVertex, sVertex };
+	sCorner[0].fAttribute[AttributeX] -= fHalfX;
+	sCorner[0].fAttribute[AttributeY] -= fHalfY;
+	sCorner[1].fAttribute[AttributeX] += fHalfX;
+	sCorner[1].fAttribute[AttributeY] -= fHalfY;
+	sCorner[2].fAttribute[AttributeX] += fHalfX;
+	sCorner[2].fAttribute[AttributeY] += fHalfY;
+	sCorner[3].fAttribute[AttributeX] -= fHalfX;
+	sCorner[3].fAttribute[AttributeY] += fHalfY;
+	ClipTriangle(sCorner[0], sCorner[1], sCorner[2], false);
+	ClipTriangle(sCorner[0], sCorner[2], sCorner[3], false);
+}
+
+/**
+*  @brief
+*    Adds a line as screen aligned quad
+*/
+void Rasterizer::AddLine(const Vertex &sVertex0, const Vertex &sVertex1)
+{
+	const DrawState &sState = m_sState;
+	const uint32 nNumOfAttributes = AttributeVarying + sState.nNumOfVaryings;
+
+	// Clip the line against the near plane so that both end points can be projected
+	Vertex sEndPoint[2] = { sVertex0, sVertex1 };
+	const float fDistance0 = sVertex0.fAttribute[AttributeZ] + sVertex0.fAttribute[AttributeW];
+	const float fDistance1 = sVertex1.fAttribute[AttributeZ] + sVertex1.fAttribute[AttributeW];
+	if (fDistance0 < 0.0f && fDistance1 < 0.0f)
+		return;
+	if (fDistance0 < 0.0f || fDistance1 < 0.0f) {
+		const float fT = fDistance0/(fDistance0 - fDistance1);
+		float *pfOutput = sEndPoint[(fDistance0 < 0.0f) ? 0 : 1].fAttribute;
+		for (uint32 nAttribute=0; nAttribute<nNumOfAttributes; nAttribute++)
+			pfOutput[nAttribute] = sVertex0.fAttribute[nAttribute] + (sVertex1.fAttribute[nAttribute] - sVertex0.fAttribute[nAttribute])*fT;
+	}
+	const float fW0 = sEndPoint[0].fAttribute[AttributeW];
+	const float fW1 = sEndPoint[1].fAttribute[AttributeW];
+	if (fW0 <= 0.0f || fW1 <= 0.0f)
+		return;
+
+	// Line direction within window space
+	const float fDirectionX = (sEndPoint[1].fAttribute[AttributeX]/fW1 - sEndPoint[0].fAttribute[AttributeX]/fW0)*0.5f*sState.fViewportWidth;
+	const float fDirectionY = (sEndPoint[1].fAttribute[AttributeY]/fW1 - sEndPoint[0].fAttribute[AttributeY]/fW0)*0.5f*sState.fViewportHeight;
+	const float fLength = Math::Sqrt(fDirectionX*fDirectionX + fDirectionY*fDirectionY);
+	if (fLength == 0.0f)
+		return; // Degenerated
+
+	// Offset perpendicular to the line by half of the line width, converted from pixels into normalized device coordinates
+	const float fHalfWidth = sState.fLineWidth*0.5f/fLength;
+	const float fOffsetX = -fDirectionY*fHalfWidth*2.0f/sState.fViewportWidth;
+	const float fOffsetY =  fDirectionX*fHalfWidth*2.0f/sState.fViewportHeight;
+
+	// Quad, the offset is multiplied by w so that it's constant within window space
+	Vertex sCorner[4] = { sEndPoint[0], sEndPoint[1], sEndPoint[1], sEndPoint[0] };
+	sCorner[0].fAttribute[AttributeX] -= fOffsetX*fW0;
+	sCorner[0].fAttribute[AttributeY] -= fOffsetY*fW0;
+	sCorner[1].fAttribute[AttributeX] -= fOffsetX*fW1;
+	sCorner[1].fAttribute[AttributeY] -= fOffsetY*fW1;
+	sCorner[2].fAttribute[AttributeX] += fOffsetX*fW1;
+	sCorner[2].fAttribute[AttributeY] += fOffsetY*fW1;
+	sCorner[3].fAttribute[AttributeX] += fOffsetX*fW0;
+	sCorner[3].fAttribute[AttributeY] += fOffsetY*fW0;
+	ClipTriangle(sCorner[0], sCorner[1], sCorner[2], false);
+	ClipTriangle(sCorner[0], sCorner[2], sCorner[3], false);
+}
+
+/**
+*  @brief
+*    Adds a triangle by using the current fill mode
+*/
+void Rasterizer::AddTriangle(const Vertex &sVertex0, const Vertex &sVertex1, const Vertex &sVertex2)
+{
+	const DrawState &sState = m_sState;
+	if (sState.nFillMode == Fill::Point || sState.nFillMode == Fill::Line) {
+		// The cull mode is applied to the triangle and not to its points or lines. While all vertices are in front of the viewer,
+		// the sign of the determinant of the homogeneous (x, y, w) coordinates is the sign of the window space area. Otherwise
+		// the triangle is not culled.
+		const float *pfA = sVertex0.fAttribute;
+		const float *pfB = sVertex1.fAttribute;
+		const float *pfC = sVertex2.fAttribute;
+		if (pfA[AttributeW] > 0.0f && pfB[AttributeW] > 0.0f && pfC[AttributeW] > 0.0f) {
+			const float fDeterminant = pfA[AttributeX]*(pfB[AttributeY]*pfC[AttributeW] - pfC[AttributeY]*pfB[AttributeW]) -
+									   pfA[AttributeY]*(pfB[AttributeX]*pfC[AttributeW] - pfC[AttributeX]*pfB[AttributeW]) +
+									   pfA[AttributeW]*(pfB[AttributeX]*pfC[AttributeY] - pfC[AttributeX]*pfB[AttributeY]);
+			if ((fDeterminant < 0.0f && sState.bCullCW) || (fDeterminant > 0.0f && sState.bCullCCW))
+				return; // Culled
+		}
+
+		// Draw the points or the outline of the triangle
+		if (sState.nFillMode == Fill::Point) {
+			AddPoint(sVertex0);
+			AddPoint(sVertex1);
+			AddPoint(sVertex2);
+		} else {
+			AddLine(sVertex0, sVertex1);
+			AddLine(sVertex1, sVertex2);
+			AddLine(sVertex2, sVertex0);
+		}
+	} else {
+		// Solid
+		ClipTriangle(sVertex0, sVertex1, sVertex2, true);
+	}
+}
+
+/**
+*  @brief
+*    Clips a triangle and adds the resulting triangles
+*/
+void Rasterizer::ClipTriangle(const Vertex &sVertex0, const Vertex &sVertex1, const Vertex &sVertex2, bool bCull)
+{
+	// Don't let the bins grow without limit
+	if (m_lstTriangles.GetNumOfElements() >= MaxTrianglesPerFlush)
+		Flush();
+
+	// Clip planes (x, y, z, w), a vertex is inside if the dot product is >= 0
+	static const float fClipPlanes[NumOfClipPlanes][4] = {
+		{  0.0f,  0.0f,  1.0f, 1.0f },		// Near
+		{  0.0f,  0.0f, -1.0f, 1.0f },		// Far
+		{  1.0f,  0.0f,  0.0f, GuardBand },	// Left
+		{ -1.0f,  0.0f,  0.0f, GuardBand },	// Right
+		{  0.0f,  1.0f,  0.0f, GuardBand },	// Bottom
+		{  0.0f, -1.0f,  0.0f, GuardBand }	// Top
+	};
+	const Vertex *pVertices[3] = { &sVertex0, &sVertex1, &sVertex2 };
+
+	// Get the outcodes, the far plane is not used when depth clamp is active
+	const uint32 nPlaneMask = m_sState.bDepthClamp ? ((1 << NumOfClipPlanes) - 1) & ~2 : ((1 << NumOfClipPlanes) - 1);
+	uint32 nOutcode[3];
+	for (int i=0; i<3; i++) {
+		const float *pfPosition = pVertices[i]->fAttribute;
+		nOutcode[i] = 0;
+		for (uint32 nPlane=0; nPlane<NumOfClipPlanes; nPlane++) {
+			const float *pfPlane = fClipPlanes[nPlane];
+			if (pfPlane[0]*pfPosition[0] + pfPlane[1]*pfPosition[1] + pfPlane[2]*pfPosition[2] + pfPlane[3]*pfPosition[3] < 0.0f)
+				nOutcode[i] |= (1 << nPlane);
+		}
+		nOutcode[i] &= nPlaneMask;
+	}
+
+	// Trivial accept or reject
+	if (!(nOutcode[0] | nOutcode[1] | nOutcode[2])) {
+		SetupTriangle(sVertex0, sVertex1, sVertex2, bCull);
+		return;
+	}
+	if (nOutcode[0] & nOutcode[1] & nOutcode[2])
+		return;
+
+	// Clip the polygon against each plane a vertex is outside of (Sutherland-Hodgman)
+	const uint32 nNumOfAttributes = AttributeVarying + m_sState.nNumOfVaryings;
+	Vertex sPolygon[2][3 + NumOfClipPlanes];
+	uint32 nNumOfVertices = 3;
+	uint32 nCurrent = 0;
+	sPolygon[0][0] = sVertex0;
+	sPolygon[0][1] = sVertex1;
+	sPolygon[0][2] = sVertex2;
+	const uint32 nClipMask = nOutcode[0] | nOutcode[1] | nOutcode[2];
+	for (uint32 nPlane=0; nPlane<NumOfClipPlanes && nNumOfVertices >= 3; nPlane++) {
+		if (nClipMask & (1 << nPlane)) {
+			const float *pfPlane = fClipPlanes[nPlane];
+			const Vertex *pInput  = sPolygon[nCurrent];
+			Vertex		 *pOutput = sPolygon[1 - nCurrent];
+			uint32 nNumOfOutputVertices = 0;
+			for (uint32 i=0; i<nNumOfVertices; i++) {
+				const float *pfA = pInput[i].fAttribute;
+				const float *pfB = pInput[(i + 1)%nNumOfVertices].fAttribute;
+				const float fDistanceA = pfPlane[0]*pfA[0] + pfPlane[1]*pfA[1] + pfPlane[2]*pfA[2] + pfPlane[3]*pfA[3];
+				const float fDistanceB = pfPlane[0]*pfB[0] + pfPlane[1]*pfB[1] + pfPlane[2]*pfB[2] + pfPlane[3]*pfB[3];
+				if (fDistanceA >= 0.0f)
+					pOutput[nNumOfOutputVertices++] = pInput[i];
+				if ((fDistanceA >= 0.0f) != (fDistanceB >= 0.0f)) {
+					// The edge is crossing the plane, all attributes are linear within clip space
+					const float fT = fDistanceA/(fDistanceA - fDistanceB);
+					float *pfOutput = pOutput[nNumOfOutputVertices++].fAttribute;
+					for (uint32 nAttribute=0; nAttribute<nNumOfAttributes; nAttribute++)
+						pfOutput[nAttribute] = pfA[nAttribute] + (pfB[nAttribute] - pfA[nAttribute])*fT;
+				}
+			}
+			nNumOfVertices = nNumOfOutputVertices;
+			nCurrent = 1 - nCurrent;
+		}
+	}
+
+	// Triangulate the resulting convex polygon
+	const Vertex *pPolygon = sPolygon[nCurrent];
+	for (uint32 i=2; i<nNumOfVertices; i++)
+		SetupTriangle(pPolygon[0], pPolygon[i - 1], pPolygon[i], bCull);
+}
+
+/**
+*  @brief
+*    Sets up a clipped triangle and sorts it into the tile bins
+*/
+void Rasterizer::SetupTriangle(const Vertex &sVertex0, const Vertex &sVertex1, const Vertex &sVertex2, bool bCull)
+{
+	const DrawState &sState = m_sState;
+	const uint32 nNumOfPlanes = PlaneVarying + sState.nNumOfVaryings;
+
+	// Project the vertices into window space and snap the positions to the sub-pixel grid
+	const Vertex *pVertices[3] = { &sVertex0, &sVertex1, &sVertex2 };
+	float fX[3], fY[3], fValue[3][NumOfPlanes];
+	for (int i=0; i<3; i++) {
+		// After clipping, w can only be zero if the vertex is at the clip space origin
+		const float *pfAttribute = pVertices[i]->fAttribute;
+		if (pfAttribute[AttributeW] <= 0.0f)
+			return;
+		const float fInvW = 1.0f/pfAttribute[AttributeW];
+		fX[i] = Math::Floor((sState.fViewportX + (pfAttribute[AttributeX]*fInvW*0.5f + 0.5f)*sState.fViewportWidth)*SubPixelPrecision + 0.5f)/SubPixelPrecision;
+		fY[i] = Math::Floor((sState.fViewportY + (pfAttribute[AttributeY]*fInvW*0.5f + 0.5f)*sState.fViewportHeight)*SubPixelPrecision + 0.5f)/SubPixelPrecision;
+		fValue[i][PlaneZ]		 = sState.fMinZ + (pfAttribute[AttributeZ]*fInvW*0.5f + 0.5f)*(sState.fMaxZ - sState.fMinZ);
+		fValue[i][PlaneOneOverW] = fInvW;
+		for (uint32 nVarying=0; nVarying<sState.nNumOfVaryings; nVarying++)
+			fValue[i][PlaneVarying + nVarying] = pfAttribute[AttributeVarying + nVarying]*fInvW;
+	}
+
+	// Twice the signed area, positive for counterclockwise triangles (the window space y axis is pointing up)
+	float fArea = (fX[1] - fX[0])*(fY[2] - fY[0]) - (fX[2] - fX[0])*(fY[1] - fY[0]);
+	if (fArea == 0.0f || (bCull && ((fArea < 0.0f && sState.bCullCW) || (fArea > 0.0f && sState.bCullCCW))))
+		return; // Degenerated or culled
+
+	// Make the triangle counterclockwise so that the inside is always on the left side of the edges
+	int nV0 = 0, nV1 = 1, nV2 = 2;
+	if (fArea < 0.0f) {
+		nV1 = 2;
+		nV2 = 1;
+		fArea = -fArea;
+	}
+
+	// Bounding box of the covered pixel centers, clipped against the drawing area
+	const float fMinX = Math::Min(Math::Min(fX[0], fX[1]), fX[2]);
+	const float fMinY = Math::Min(Math::Min(fY[0], fY[1]), fY[2]);
+	const float fMaxX = Math::Max(Math::Max(fX[0], fX[1]), fX[2]);
+	const float fMaxY = Math::Max(Math::Max(fY[0], fY[1]), fY[2]);
+	const int nMinX = Math::Max(static_cast<int>(Math::Ceil(fMinX - 0.5f)), sState.nClipMinX);
+	const int nMinY = Math::Max(static_cast<int>(Math::Ceil(fMinY - 0.5f)), sState.nClipMinY);
+	const int nMaxX = Math::Min(static_cast<int>(Math::Floor(fMaxX - 0.5f)) + 1, sState.nClipMaxX);
+	const int nMaxY = Math::Min(static_cast<int>(Math::Floor(fMaxY - 0.5f)) + 1, sState.nClipMaxY);
+	if (nMinX >= nMaxX || nMinY >= nMaxY)
+		return; // No pixel center covered
+
+	// Setup the triangle
+	const uint32 nTriangle = m_lstTriangles.GetNumOfElements();
+	Triangle &sTriangle = m_lstTriangles.Add();
+	sTriangle.nMinX = nMinX;
+	sTriangle.nMinY = nMinY;
+	sTriangle.nMaxX = nMaxX;
+	sTriangle.nMaxY = nMaxY;
+
+	// Edge functions, a shared edge gets exactly the negated values within the neighbour triangle so that there are
+	// neither gaps nor double drawn pixels, pixel centers exactly on an edge belong to top and left edges only
+	const int nEdgeVertices[3][2] = { { nV0, nV1 }, { nV1, nV2 }, { nV2, nV0 } };
+	for (int nEdge=0; nEdge<3; nEdge++) {
+		const int nA = nEdgeVertices[nEdge][0];
+		const int nB = nEdgeVertices[nEdge][1];
+		float *pfEdge = sTriangle.fEdge[nEdge];
+		pfEdge[0] = fY[nA] - fY[nB];
+		pfEdge[1] = fX[nB] - fX[nA];
+		pfEdge[2] = fX[nA]*fY[nB] - fY[nA]*fX[nB];
+		sTriangle.bTopLeft[nEdge] = (pfEdge[0] > 0.0f || (pfEdge[0] == 0.0f && pfEdge[1] < 0.0f));
+	}
+
+	// Attribute planes
+	const float fInvArea = 1.0f/fArea;
+	const float fX10 = fX[nV1] - fX[nV0], fY10 = fY[nV1] - fY[nV0];
+	const float fX20 = fX[nV2] - fX[nV0], fY20 = fY[nV2] - fY[nV0];
+	for (uint32 nPlane=0; nPlane<nNumOfPlanes; nPlane++) {
+		const float fValue10 = fValue[nV1][nPlane] - fValue[nV0][nPlane];
+		const float fValue20 = fValue[nV2][nPlane] - fValue[nV0][nPlane];
+		float *pfPlane = sTriangle.fPlane[nPlane];
+		pfPlane[0] = (fValue10*fY20 - fValue20*fY10)*fInvArea;
+		pfPlane[1] = (fValue20*fX10 - fValue10*fX20)*fInvArea;
+		pfPlane[2] = fValue[nV0][nPlane] - pfPlane[0]*fX[nV0] - pfPlane[1]*fY[nV0];
+	}
+
+	// Sort the triangle into the bins of all touched tiles
+	const int nFirstTileX = nMinX/TileSize;
+	const int nFirstTileY = nMinY/TileSize;
+	const int nLastTileX  = (nMaxX - 1)/TileSize;
+	const int nLastTileY  = (nMaxY - 1)/TileSize;
+	const bool bSingleTile = (nFirstTileX == nLastTileX && nFirstTileY == nLastTileY);
+	for (int nTileY=nFirstTileY; nTileY<=nLastTileY; nTileY++) {
+		for (int nTileX=nFirstTileX; nTileX<=nLastTileX; nTileX++) {
+			// Reject tiles which are completely outside of one of the edges, the test uses the pixel center
+			// of the tile area within the bounding box with the largest edge function value
+			bool bInside = true;
+			if (!bSingleTile) {
+				const float fTileMinX = static_cast<float>(Math::Max(nTileX*static_cast<int>(TileSize), nMinX)) + 0.5f;
+				const float fTileMinY = static_cast<float>(Math::Max(nTileY*static_cast<int>(TileSize), nMinY)) + 0.5f;
+				const float fTileMaxX = static_cast<float>(Math::Min((nTileX + 1)*static_cast<int>(TileSize), nMaxX) - 1) + 0.5f;
+				const float fTileMaxY = static_cast<float>(Math::Min((nTileY + 1)*static_cast<int>(TileSize), nMaxY) - 1) + 0.5f;
+				for (int nEdge=0; nEdge<3 && bInside; nEdge++) {
+					const float *pfEdge = sTriangle.fEdge[nEdge];
+					const float fCornerX = (pfEdge[0] > 0.0f) ? fTileMaxX : fTileMinX;
+					const float fCornerY = (pfEdge[1] > 0.0f) ? fTileMaxY : fTileMinY;
+					if (pfEdge[0]*fCornerX + (pfEdge[1]*fCornerY + pfEdge[2]) < 0.0f)
+						bInside = false;
+				}
+			}
+			if (bInside) {
+				const uint32 nTile = nTileY*m_nNumOfTilesX + nTileX;
+				Array<uint32> &lstBin = m_plstBins[nTile];
+				if (!lstBin.GetNumOfElements())
+					m_lstUsedTiles.Add(nTile);
+				lstBin.Add(nTriangle);
+			}
+		}
+	}
+}
+
+/**
+*  @brief
+*    Rasterizes all binned triangles and resets the bins
+*/
+void Rasterizer::Flush()
+{
+	const uint32 nNumOfUsedTiles = m_lstUsedTiles.GetNumOfElements();
+	if (nNumOfUsedTiles) {
+		// Rasterize the tiles, each job owns its tiles so that there's no need for any synchronization
+		JobSystem *pJobSystem = (nNumOfUsedTiles > 1) ? JobSystem::GetInstance() : nullptr;
+		if (pJobSystem && pJobSystem->GetNumOfWorkers())
+			pJobSystem->ParallelFor(nNumOfUsedTiles, 1, &Rasterizer::RasterizeTiles, this);
+		else
+			RasterizeTiles(0, nNumOfUsedTiles, this);
+
+		// Reset the bins, but keep the memory
+		const uint32 *pnUsedTiles = m_lstUsedTiles.GetData();
+		for (uint32 i=0; i<nNumOfUsedTiles; i++)
+			m_plstBins[pnUsedTiles[i]].Reset();
+		m_lstUsedTiles.Reset();
+	}
+	m_lstTriangles.Reset();
+}
+
+/**
+*  @brief
+*    Rasterizes the triangles of a tile
+*/
+void Rasterizer::RasterizeTile(uint32 nTile) const
+{
+	const DrawState &sState = m_sState;
+	const int nTileMinX = (nTile%m_nNumOfTilesX)*TileSize;
+	const int nTileMinY = (nTile/m_nNumOfTilesX)*TileSize;
+	const int nTileMaxX = nTileMinX + TileSize;
+	const int nTileMaxY = nTileMinY + TileSize;
+	const Triangle *pTriangles = m_lstTriangles.GetData();
+	const Array<uint32> &lstBin = m_plstBins[nTile];
+	const uint32 *pnBin = lstBin.GetData();
+	const uint32 nNumOfTriangles = lstBin.GetNumOfElements();
+
+	// Draw the triangles in submission order
+	for (uint32 nBinEntry=0; nBinEntry<nNumOfTriangles; nBinEntry++) {
+		const Triangle &sTriangle = pTriangles[pnBin[nBinEntry]];
+		const int nMinX = Math::Max(sTriangle.nMinX, nTileMinX);
+		const int nMinY = Math::Max(sTriangle.nMinY, nTileMinY);
+		const int nMaxX = Math::Min(sTriangle.nMaxX, nTileMaxX);
+		const int nMaxY = Math::Min(sTriangle.nMaxY, nTileMaxY);
+		const float *pfEdge0 = sTriangle.fEdge[0];
+		const float *pfEdge1 = sTriangle.fEdge[1];
+		const float *pfEdge2 = sTriangle.fEdge[2];
+		const float *pfZ	 = sTriangle.fPlane[PlaneZ];
+
+#ifdef PLMATH_SSE
+		// Four pixels at once, coverage and depth test by using SSE
+		const __m128 vZero	  = _mm_setzero_ps();
+		const __m128 vOffsetX = _mm_set_ps(3.5f, 2.5f, 1.5f, 0.5f);
+		const __m128 vEdgeA0  = _mm_set1_ps(pfEdge0[0]);
+		const __m128 vEdgeA1  = _mm_set1_ps(pfEdge1[0]);
+		const __m128 vEdgeA2  = _mm_set1_ps(pfEdge2[0]);
+		const __m128 vZA	  = _mm_set1_ps(pfZ[0]);
+		const __m128 vMinZ	  = _mm_set1_ps(Math::Min(sState.fMinZ, sState.fMaxZ));
+		const __m128 vMaxZ	  = _mm_set1_ps(Math::Max(sState.fMinZ, sState.fMaxZ));
+		for (int nY=nMinY; nY<nMaxY; nY++) {
+			const float fY = static_cast<float>(nY) + 0.5f;
+			const __m128 vRow0 = _mm_set1_ps(pfEdge0[1]*fY + pfEdge0[2]);
+			const __m128 vRow1 = _mm_set1_ps(pfEdge1[1]*fY + pfEdge1[2]);
+			const __m128 vRow2 = _mm_set1_ps(pfEdge2[1]*fY + pfEdge2[2]);
+			const __m128 vRowZ = _mm_set1_ps(pfZ[1]*fY + pfZ[2]);
+			float *pfDepthRow = sState.sTarget.pfDepth ? &sState.sTarget.pfDepth[nY*sState.sTarget.nWidth] : nullptr;
+			for (int nX=nMinX; nX<nMaxX; nX+=4) {
+				const __m128 vX = _mm_add_ps(_mm_set1_ps(static_cast<float>(nX)), vOffsetX);
+
+				// Coverage
+				const __m128 vEdge0 = _mm_add_ps(_mm_mul_ps(vEdgeA0, vX), vRow0);
+				const __m128 vEdge1 = _mm_add_ps(_mm_mul_ps(vEdgeA1, vX), vRow1);
+				const __m128 vEdge2 = _mm_add_ps(_mm_mul_ps(vEdgeA2, vX), vRow2);
+				int nMask = _mm_movemask_ps(_mm_and_ps(_mm_and_ps(sTriangle.bTopLeft[0] ? _mm_cmpge_ps(vEdge0, vZero) : _mm_cmpgt_ps(vEdge0, vZero),
+																  sTriangle.bTopLeft[1] ? _mm_cmpge_ps(vEdge1, vZero) : _mm_cmpgt_ps(vEdge1, vZero)),
+																  sTriangle.bTopLeft[2] ? _mm_cmpge_ps(vEdge2, vZero) : _mm_cmpgt_ps(vEdge2, vZero)));
+				const int nNumOfPixels = nMaxX - nX;
+				if (nNumOfPixels < 4)
+					nMask &= (1 << nNumOfPixels) - 1;
+				if (!nMask)
+					continue;
+
+				// Depth
+				__m128 vZ = _mm_add_ps(_mm_mul_ps(vZA, vX), vRowZ);
+				if (sState.bDepthClamp)
+					vZ = _mm_min_ps(_mm_max_ps(vZ, vMinZ), vMaxZ);
+				if (sState.bDepthTest) {
+					// Don't read behind the end of the row
+					__m128 vDepth;
+					if (nNumOfPixels >= 4) {
+						vDepth = _mm_loadu_ps(&pfDepthRow[nX]);
+					} else {
+						float fDepth[4] = { 0.0f, 0.0f, 0.0f, 0.0f };
+						for (int i=0; i<nNumOfPixels; i++)
+							fDepth[i] = pfDepthRow[nX + i];
+						vDepth = _mm_loadu_ps(fDepth);
+					}
+					nMask &= CompareValues(sState.nDepthFunction, vZ, vDepth);
+					if (!nMask)
+						continue;
+				}
+
+				// Shade the remaining pixels
+				float fZ[4];
+				_mm_storeu_ps(fZ, vZ);
+				for (int i=0; i<4; i++) {
+					if (nMask & (1 << i))
+						ShadePixel(sTriangle, nX + i, nY, fZ[i]);
+				}
+			}
+		}
+#else
+		// C++ method
+		const float fMinZ = Math::Min(sState.fMinZ, sState.fMaxZ);
+		const float fMaxZ = Math::Max(sState.fMinZ, sState.fMaxZ);
+		for (int nY=nMinY; nY<nMaxY; nY++) {
+			const float fY = static_cast<float>(nY) + 0.5f;
+			const float fRow0 = pfEdge0[1]*fY + pfEdge0[2];
+			const float fRow1 = pfEdge1[1]*fY + pfEdge1[2];
+			const float fRow2 = pfEdge2[1]*fY + pfEdge2[2];
+			const float fRowZ = pfZ[1]*fY + pfZ[2];
+			const float *pfDepthRow = sState.sTarget.pfDepth ? &sState.sTarget.pfDepth[nY*sState.sTarget.nWidth] : nullptr;
+			for (int nX=nMinX; nX<nMaxX; nX++) {
+				const float fX = static_cast<float>(nX) + 0.5f;
+
+				// Coverage
+				const float fEdge0 = pfEdge0[0]*fX + fRow0;
+				const float fEdge1 = pfEdge1[0]*fX + fRow1;
+				const float fEdge2 = pfEdge2[0]*fX + fRow2;
+				if ((sTriangle.bTopLeft[0] ? fEdge0 >= 0.0f : fEdge0 > 0.0f) &&
+					(sTriangle.bTopLeft[1] ? fEdge1 >= 0.0f : fEdge1 > 0.0f) &&
+					(sTriangle.bTopLeft[2] ? fEdge2 >= 0.0f : fEdge2 > 0.0f)) {
+					// Depth
+					float fZ = pfZ[0]*fX + fRowZ;
+					if (sState.bDepthClamp)
+						fZ = (fZ < fMinZ) ? fMinZ : ((fZ > fMaxZ) ? fMaxZ : fZ);
+					if (!sState.bDepthTest || CompareValues(sState.nDepthFunction, fZ, pfDepthRow[nX]))
+						ShadePixel(sTriangle, nX, nY, fZ);
+				}
+			}
+		}
+#endif
+	}
+}
+
+/**
+*  @brief
+*    Shades a pixel which passed the coverage and depth tests
+*/
+void Rasterizer::ShadePixel(const Triangle &sTriangle, int nX, int nY, float fZ) const
+{
+	const DrawState &sState = m_sState;
+	const float fX = static_cast<float>(nX) + 0.5f;
+	const float fY = static_cast<float>(nY) + 0.5f;
+
+	// Perspective correct varyings
+	const float *pfPlane = sTriangle.fPlane[PlaneOneOverW];
+	const float  fW		 = 1.0f/(pfPlane[0]*fX + (pfPlane[1]*fY + pfPlane[2]));
+	float fVarying[Shader::MaxVaryings];
+	for (uint32 i=0; i<sState.nNumOfVaryings; i++) {
+		pfPlane = sTriangle.fPlane[PlaneVarying + i];
+		fVarying[i] = (pfPlane[0]*fX + (pfPlane[1]*fY + pfPlane[2]))*fW;
+	}
+
+	// Let the shader compute the color
+	float fColor[4];
+	if (!sState.pShader->ProcessPixel(fVarying, fColor))
+		return; // Discarded
+
+	// Clamp the color
+	for (int i=0; i<4; i++)
+		fColor[i] = (fColor[i] < 0.0f) ? 0.0f : ((fColor[i] > 1.0f) ? 1.0f : fColor[i]);
+
+	// Alpha test
+	if (sState.bAlphaTest && !CompareValues(sState.nAlphaTestFunction, fColor[3], sState.fAlphaTestReference))
+		return;
+
+	// Depth write
+	if (sState.bDepthWrite)
+		sState.sTarget.pfDepth[nY*sState.sTarget.nWidth + nX] = fZ;
+
+	// Color write
+	if (sState.sTarget.pnColor) {
+		uint8 *pnColor = &sState.sTarget.pnColor[(nY*sState.sTarget.nWidth + nX)*4];
+		if (sState.bBlend) {
+			const float fDestination[4] = { pnColor[0]/255.0f, pnColor[1]/255.0f, pnColor[2]/255.0f, pnColor[3]/255.0f };
+			float fSourceFactor[4], fDestinationFactor[4];
+			GetBlendFactor(sState.nSrcBlendFunc, fColor, fDestination, fSourceFactor);
+			GetBlendFactor(sState.nDstBlendFunc, fColor, fDestination, fDestinationFactor);
+			for (int i=0; i<4; i++)
+				fColor[i] = fColor[i]*fSourceFactor[i] + fDestination[i]*fDestinationFactor[i];
+		}
+		for (int i=0; i<4; i++) {
+			if (sState.bColorMask[i])
+				pnColor[i] = ToByte(fColor[i]);
+		}
+	}
+}
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+} // PLRendererSoftware
@@ -0,0 +1,269 @@
+/*********************************************************\
+ *  File: Shader.cpp                                     *
+ *
+ *  Copyright (C) 2002-2013 The PixelLight Team (http://www.pixellight.org/)
+ *
+ *  This file is part of PixelLight.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ *  and associated documentation files (the "Software"), to deal in the Software without
+ *  restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ *  Software is furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all copies or
+ *  substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ *  BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ *  DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ *  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include <PLMath/Math.h>
+#include <PLMath/Half.h>
+#include <PLRenderer/Renderer/Renderer.h>
+#include "PLRendererSoftware/TextureBuffer2D.h"
+#include "PLRendererSoftware/TextureBufferRectangle.h"
+#include "PLRendererSoftware/Shader.h"
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+using namespace PLCore;
+using namespace PLMath;
+using namespace PLRenderer;
+namespace PLRendererSoftware {
+
+
+//[-------------------------------------------------------]
+//[ Local functions                                       ]
+//[-------------------------------------------------------]
+/**
+*  @brief
+*    Applies a texture addressing mode to a texel coordinate (see PLRenderer::TextureAddressing)
+*/
+static inline int AddressTexel(uint32 nAddressing, int nTexel, int nSize)
+{
+	switch (nAddressing) {
+		case TextureAddressing::Wrap:
+			nTexel %= nSize;
+			return (nTexel < 0) ? nTexel + nSize : nTexel;
+
+		case TextureAddressing::Mirror:
+			nTexel %= nSize*2;
+			if (nTexel < 0)
+				nTexel += nSize*2;
+			return (nTexel < nSize) ? nTexel : nSize*2 - 1 - nTexel;
+
+		case TextureAddressing::Clamp:
+		case TextureAddressing::Border:
+		default:
+			return (nTexel < 0) ? 0 : ((nTexel >= nSize) ? nSize - 1 : nTexel);
+	}
+}
+
+/**
+*  @brief
+*    Converts a texture coordinate into a texel coordinate without running into integer overflows
+*/
+static inline float ToTexelCoordinate(float fCoordinate, int nSize)
+{
+	const float fTexel = fCoordinate*nSize;
+	return (fTexel < -16777216.0f) ? -16777216.0f : ((fTexel > 16777216.0f) ? 16777216.0f : fTexel);
+}
+
+
+//[-------------------------------------------------------]
+//[ Public Shader::Texture functions                      ]
+//[-------------------------------------------------------]
+/**
+*  @brief
+*    Gets the texture buffer and the sampler states of a texture stage
+*/
+bool Shader::Texture::Setup(const PLRenderer::Renderer &cRenderer, uint32 nStage)
+{
+	// Only 2D and rectangle texture buffers are supported
+	pnData = nullptr;
+	const PLRenderer::TextureBuffer *pTextureBuffer = cRenderer.GetTextureBuffer(nStage);
+	if (pTextureBuffer) {
+		if (pTextureBuffer->GetType() == PLRenderer::Resource::TypeTextureBuffer2D) {
+			const TextureBuffer2D &cTextureBuffer = static_cast<const TextureBuffer2D&>(*pTextureBuffer);
+			pnData  = cTextureBuffer.m_pnData;
+			nWidth  = cTextureBuffer.GetSize().x;
+			nHeight = cTextureBuffer.GetSize().y;
+			fScaleU = 1.0f;
+			fScaleV = 1.0f;
+		} else if (pTextureBuffer->GetType() == PLRenderer::Resource::TypeTextureBufferRectangle) {
+			const TextureBufferRectangle &cTextureBuffer = static_cast<const TextureBufferRectangle&>(*pTextureBuffer);
+			pnData  = cTextureBuffer.m_pnData;
+			nWidth  = cTextureBuffer.GetSize().x;
+			nHeight = cTextureBuffer.GetSize().y;
+			fScaleU = 1.0f/nWidth;
+			fScaleV = 1.0f/nHeight;
+		}
+	}
+	if (!pnData)
+		return false; // Nothing to sample from
+
+	// Sampler states
+	const int nMagFilter = cRenderer.GetSamplerState(nStage, Sampler::MagFilter);
+	bLinear   = (nMagFilter == TextureFiltering::Linear || nMagFilter == TextureFiltering::Anisotropic);
+	nAddressU = cRenderer.GetSamplerState(nStage, Sampler::AddressU);
+	nAddressV = cRenderer.GetSamplerState(nStage, Sampler::AddressV);
+
+	// Done
+	return true;
+}
+
+/**
+*  @brief
+*    Samples the texture
+*/
+void Shader::Texture::Sample(float fU, float fV, float fColor[4]) const
+{
+	// Like within OpenGL, the first row of the texture data is at v = 0
+	if (bLinear) {
+		// Bilinear filtering of the four nearest texels
+		const float fTexelX = ToTexelCoordinate(fU*fScaleU, nWidth)  - 0.5f;
+		const float fTexelY = ToTexelCoordinate(fV*fScaleV, nHeight) - 0.5f;
+		const float fFloorX = Math::Floor(fTexelX);
+		const float fFloorY = Math::Floor(fTexelY);
+		const float fFractionX = fTexelX - fFloorX;
+		const float fFractionY = fTexelY - fFloorY;
+		const int nX0 = AddressTexel(nAddressU, static_cast<int>(fFloorX),	   nWidth);
+		const int nX1 = AddressTexel(nAddressU, static_cast<int>(fFloorX) + 1, nWidth);
+		const int nY0 = AddressTexel(nAddressV, static_cast<int>(fFloorY),	   nHeight);
+		const int nY1 = AddressTexel(nAddressV, static_cast<int>(fFloorY) + 1, nHeight);
+		const uint8 *pnTexel00 = &pnData[(nY0*nWidth + nX0)*4];
+		const uint8 *pnTexel10 = &pnData[(nY0*nWidth + nX1)*4];
+		const uint8 *pnTexel01 = &pnData[(nY1*nWidth + nX0)*4];
+		const uint8 *pnTexel11 = &pnData[(nY1*nWidth + nX1)*4];
+		for (int i=0; i<4; i++) {
+			const float fRow0 = pnTexel00[i] + (pnTexel10[i] - pnTexel00[i])*fFractionX;
+			const float fRow1 = pnTexel01[i] + (pnTexel11[i] - pnTexel01[i])*fFractionX;
+			fColor[i] = (fRow0 + (fRow1 - fRow0)*fFractionY)/255.0f;
+		}
+	} else {
+		// Nearest texel
+		const int nX = AddressTexel(nAddressU, static_cast<int>(Math::Floor(ToTexelCoordinate(fU*fScaleU, nWidth))),  nWidth);
+		const int nY = AddressTexel(nAddressV, static_cast<int>(Math::Floor(ToTexelCoordinate(fV*fScaleV, nHeight))), nHeight);
+		const uint8 *pnTexel = &pnData[(nY*nWidth + nX)*4];
+		for (int i=0; i<4; i++)
+			fColor[i] = pnTexel[i]/255.0f;
+	}
+}
+
+
+//[-------------------------------------------------------]
+//[ Public static functions                               ]
+//[-------------------------------------------------------]
+/**
+*  @brief
+*    Reads a vertex attribute
+*/
+void Shader::ReadAttribute(const uint8 *pnVertex, const PLRenderer::VertexBuffer::Attribute &sAttribute, float fValue[4])
+{
+	const uint8 *pnData = pnVertex + sAttribute.nOffset;
+	fValue[0] = fValue[1] = fValue[2] = 0.0f;
+	fValue[3] = 1.0f;
+	switch (sAttribute.nType) {
+		case PLRenderer::VertexBuffer::RGBA:
+		case PLRenderer::VertexBuffer::Float4:
+			fValue[3] = reinterpret_cast<const float*>(pnData)[3];
+			// No break, continue with the other components
+
+		case PLRenderer::VertexBuffer::Float3:
+			fValue[2] = reinterpret_cast<const float*>(pnData)[2];
+			// No break, continue with the other components
+
+		case PLRenderer::VertexBuffer::Float2:
+			fValue[1] = reinterpret_cast<const float*>(pnData)[1];
+			// No break, continue with the other components
+
+		case PLRenderer::VertexBuffer::Float1:
+			fValue[0] = reinterpret_cast<const float*>(pnData)[0];
+			break;
+
+		case PLRenderer::VertexBuffer::Short4:
+			fValue[3] = static_cast<float>(reinterpret_cast<const short*>(pnData)[3]);
+			fValue[2] = static_cast<float>(reinterpret_cast<const short*>(pnData)[2]);
+			// No break, continue with the other components
+
+		case PLRenderer::VertexBuffer::Short2:
+			fValue[1] = static_cast<float>(reinterpret_cast<const short*>(pnData)[1]);
+			fValue[0] = static_cast<float>(reinterpret_cast<const short*>(pnData)[0]);
+			break;
+
+		case PLRenderer::VertexBuffer::Half4:
+			fValue[3] = Half::ToFloat(reinterpret_cast<const uint16*>(pnData)[3]);
+			// No break, continue with the other components
+
+		case PLRenderer::VertexBuffer::Half3:
+			fValue[2] = Half::ToFloat(reinterpret_cast<const uint16*>(pnData)[2]);
+			// No break, continue with the other components
+
+		case PLRenderer::VertexBuffer::Half2:
+			fValue[1] = Half::ToFloat(reinterpret_cast<const uint16*>(pnData)[1]);
+			// No break, continue with the other components
+
+		case PLRenderer::VertexBuffer::Half1:
+			fValue[0] = Half::ToFloat(reinterpret_cast<const uint16*>(pnData)[0]);
+			break;
+	}
+}
+
+
+//[-------------------------------------------------------]
+//[ Public functions                                      ]
+//[-------------------------------------------------------]
+/**
+*  @brief
+*    Default constructor
+*/
+Shader::Shader()
+{
+}
+
+/**
+*  @brief
+*    Destructor
+*/
+Shader::~Shader()
+{
+}
+
+
+//[-------------------------------------------------------]
+//[ Private functions                                     ]
+//[-------------------------------------------------------]
+/**
+*  @brief
+*    Copy constructor
+*/
+Shader::Shader(const Shader &cSource)
+{
+	// No implementation because the copy constructor is never used
+}
+
+/**
+*  @brief
+*    Copy operator
+*/
+Shader &Shader::operator =(const Shader &cSource)
+{
+	// No implementation because the copy operator is never used
+	return *this;
+}
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+} // PLRendererSoftware
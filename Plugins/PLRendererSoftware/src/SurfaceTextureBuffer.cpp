@@ -0,0 +1,322 @@
+/*********************************************************\
+ *  File: SurfaceTextureBuffer.cpp                       *
+ *
+ *  Copyright (C) 2002-2013 The PixelLight Team (http://www.pixellight.org/)
+ *
+ *  This file is part of PixelLight.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ *  and associated documentation files (the "Software"), to deal in the Software without
+ *  restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ *  Software is furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all copies or
+ *  substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ *  BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ *  DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ *  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include "PLRendererSoftware/TextureBuffer2D.h"
+#include "PLRendererSoftware/TextureBufferRectangle.h"
+#include "PLRendererSoftware/TextureBufferCube.h"
+#include "PLRendererSoftware/SurfaceTextureBuffer.h"
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+using namespace PLCore;
+using namespace PLMath;
+namespace PLRendererSoftware {
+
+
+//[-------------------------------------------------------]
+//[ Public functions                                      ]
+//[-------------------------------------------------------]
+/**
+*  @brief
+*    Destructor
+*/
+SurfaceTextureBuffer::~SurfaceTextureBuffer()
+{
+	// De-initialize
+	DeInit();
+
+	// Delete texture buffer
+	if (m_cTextureBufferHandler.GetResource())
+		delete m_cTextureBufferHandler.GetResource();
+}
+
+
+//[-------------------------------------------------------]
+//[ Private static functions                              ]
+//[-------------------------------------------------------]
+/**
+*  @brief
+*    Returns the RGBA data and the size of a texture buffer
+*/
+uint8 *SurfaceTextureBuffer::GetTextureBufferData(PLRenderer::TextureBuffer &cTextureBuffer, Vector2i &vSize)
+{
+	if (cTextureBuffer.GetType() == PLRenderer::Resource::TypeTextureBuffer2D) {
+		TextureBuffer2D &cTextureBuffer2D = static_cast<TextureBuffer2D&>(cTextureBuffer);
+		if (cTextureBuffer2D.m_pnData) {
+			vSize = cTextureBuffer2D.GetSize();
+			return cTextureBuffer2D.m_pnData;
+		}
+	} else if (cTextureBuffer.GetType() == PLRenderer::Resource::TypeTextureBufferRectangle) {
+		TextureBufferRectangle &cTextureBufferRectangle = static_cast<TextureBufferRectangle&>(cTextureBuffer);
+		if (cTextureBufferRectangle.m_pnData) {
+			vSize = cTextureBufferRectangle.GetSize();
+			return cTextureBufferRectangle.m_pnData;
+		}
+	}
+
+	// Error, the rasterizer can't render into other texture buffer types!
+	return nullptr;
+}
+
+
+//[-------------------------------------------------------]
+//[ Private functions                                     ]
+//[-------------------------------------------------------]
+/**
+*  @brief
+*    Constructor
+*/
+SurfaceTextureBuffer::SurfaceTextureBuffer(PLRenderer::Renderer &cRenderer, PLRenderer::TextureBuffer &cTextureBuffer, uint32 nFlags, uint8 nMaxColorTargets) :
+	PLRenderer::SurfaceTextureBuffer(cRenderer, nFlags, nMaxColorTargets),
+	m_nFace(0),
+	m_pfDepth(nullptr)
+{
+	// Init data
+	m_cTextureBufferHandler.SetResource(&cTextureBuffer);
+
+	// Init
+	Init();
+}
+
+/**
+*  @brief
+*    Sets a color render target
+*/
+bool SurfaceTextureBuffer::SetColorRenderTarget(uint8 nColorIndex, PLRenderer::TextureBuffer *pTextureBuffer)
+{
+	// The rasterizer has only a single color render target, so there's nothing to detach at the other color indices
+	if (nColorIndex)
+		return !pTextureBuffer;
+
+	// The color render target must have the size of this surface
+	if (pTextureBuffer) {
+		Vector2i vSize;
+		if (!GetTextureBufferData(*pTextureBuffer, vSize) || vSize != GetSize())
+			return false; // Error!
+	}
+
+	// Set the color render target
+	m_cColorRenderTarget.SetResource(pTextureBuffer);
+
+	// Done
+	return true;
+}
+
+/**
+*  @brief
+*    Sets a depth render target
+*/
+bool SurfaceTextureBuffer::SetDepthRenderTarget(PLRenderer::TextureBuffer *pTextureBuffer)
+{
+	// The depth render target must have the size of this surface and there must be a depth buffer to copy from
+	if (pTextureBuffer) {
+		Vector2i vSize;
+		if (!m_pfDepth || !GetTextureBufferData(*pTextureBuffer, vSize) || vSize != GetSize())
+			return false; // Error!
+	}
+
+	// Update the previous depth render target and set the new one
+	ResolveDepthRenderTarget();
+	m_cDepthRenderTarget.SetResource(pTextureBuffer);
+
+	// Done
+	return true;
+}
+
+/**
+*  @brief
+*    Returns the color buffer the rasterizer is rendering into
+*/
+uint8 *SurfaceTextureBuffer::GetColorBuffer() const
+{
+	PLRenderer::TextureBuffer *pTextureBuffer = static_cast<PLRenderer::TextureBuffer*>(m_cColorRenderTarget.GetResource() ? m_cColorRenderTarget.GetResource() : m_cTextureBufferHandler.GetResource());
+	Vector2i vSize;
+	return pTextureBuffer ? GetTextureBufferData(*pTextureBuffer, vSize) : nullptr;
+}
+
+/**
+*  @brief
+*    Copies the depth buffer into the depth render target
+*/
+void SurfaceTextureBuffer::ResolveDepthRenderTarget()
+{
+	PLRenderer::TextureBuffer *pTextureBuffer = static_cast<PLRenderer::TextureBuffer*>(m_cDepthRenderTarget.GetResource());
+	if (pTextureBuffer && m_pfDepth) {
+		Vector2i vSize;
+		uint8 *pnData = GetTextureBufferData(*pTextureBuffer, vSize);
+		if (pnData && vSize == GetSize()) {
+			// Both are starting with the bottom row, the depth is written as luminance with an alpha of one
+			const uint32 nNumOfPixels = vSize.x*vSize.y;
+			for (uint32 i=0; i<nNumOfPixels; i++, pnData+=4) {
+				const float fDepth = m_pfDepth[i];
+				pnData[0] = pnData[1] = pnData[2] = (fDepth <= 0.0f) ? 0 : ((fDepth >= 1.0f) ? 255 : static_cast<uint8>(fDepth*255.0f + 0.5f));
+				pnData[3] = 255;
+			}
+		}
+	}
+}
+
+
+//[-------------------------------------------------------]
+//[ Public virtual PLRenderer::SurfaceTexture functions   ]
+//[-------------------------------------------------------]
+PLRenderer::TextureBuffer *SurfaceTextureBuffer::GetTextureBuffer() const
+{
+	return static_cast<PLRenderer::TextureBuffer*>(m_cTextureBufferHandler.GetResource());
+}
+
+uint8 SurfaceTextureBuffer::GetTextureBufferFace() const
+{
+	return m_nFace;
+}
+
+void SurfaceTextureBuffer::TakeDepthBufferFromSurfaceTextureBuffer(PLRenderer::SurfaceTextureBuffer &cSurfaceTextureBuffer)
+{
+	// Cast to software implementation
+	SurfaceTextureBuffer &cSurfaceTextureBufferSoftware = static_cast<SurfaceTextureBuffer&>(cSurfaceTextureBuffer);
+
+	// Has the other surface a depth buffer? The rasterizer is addressing the depth buffer with the size of the surface, so both sizes must match.
+	if (&cSurfaceTextureBufferSoftware != this && cSurfaceTextureBufferSoftware.m_pfDepth && cSurfaceTextureBufferSoftware.GetSize() == GetSize()) {
+		// If we have a depth buffer, we destroy it because we're using the one of the other surface from now on
+		if (m_pfDepth)
+			delete [] m_pfDepth;
+
+		// Take away the ownership of the depth buffer
+		m_pfDepth = cSurfaceTextureBufferSoftware.m_pfDepth;
+		cSurfaceTextureBufferSoftware.m_pfDepth = nullptr;
+	}
+}
+
+
+//[-------------------------------------------------------]
+//[ Public virtual PLRenderer::Surface functions          ]
+//[-------------------------------------------------------]
+Vector2i SurfaceTextureBuffer::GetSize() const
+{
+	// Return the size depending of the texture buffer type
+	PLRenderer::TextureBuffer *pTextureBuffer = static_cast<PLRenderer::TextureBuffer*>(m_cTextureBufferHandler.GetResource());
+	if (pTextureBuffer) {
+		switch (pTextureBuffer->GetType()) {
+			case PLRenderer::Resource::TypeTextureBuffer2D:
+				return static_cast<PLRenderer::TextureBuffer2D*>(pTextureBuffer)->GetSize();
+
+			case PLRenderer::Resource::TypeTextureBufferRectangle:
+				return static_cast<PLRenderer::TextureBufferRectangle*>(pTextureBuffer)->GetSize();
+
+			case PLRenderer::Resource::TypeTextureBufferCube:
+			{
+				 const uint32 nSize = static_cast<PLRenderer::TextureBufferCube*>(pTextureBuffer)->GetSize();
+				 return Vector2i(nSize, nSize);
+			}
+
+			case PLRenderer::Resource::TypeIndexBuffer:
+			case PLRenderer::Resource::TypeVertexBuffer:
+			case PLRenderer::Resource::TypeUniformBuffer:
+			case PLRenderer::Resource::TypeTextureBuffer1D:
+			case PLRenderer::Resource::TypeTextureBuffer2DArray:
+			case PLRenderer::Resource::TypeTextureBuffer3D:
+			case PLRenderer::Resource::TypeOcclusionQuery:
+			case PLRenderer::Resource::TypeVertexShader:
+			case PLRenderer::Resource::TypeTessellationControlShader:
+			case PLRenderer::Resource::TypeTessellationEvaluationShader:
+			case PLRenderer::Resource::TypeGeometryShader:
+			case PLRenderer::Resource::TypeFragmentShader:
+			case PLRenderer::Resource::TypeProgram:
+			case PLRenderer::Resource::TypeFont:
+			default:
+				break;	// Error, must be 2D, rectangle or cube!
+		}
+	}
+
+	// Error!
+	return Vector2i::Zero;
+}
+
+
+//[-------------------------------------------------------]
+//[ Private virtual PLRenderer::Surface functions         ]
+//[-------------------------------------------------------]
+bool SurfaceTextureBuffer::Init()
+{
+	// First de-initialize the old stuff
+	DeInit();
+
+	// Create the depth buffer, the stencil buffer is not supported
+	if (GetFlags() & Depth) {
+		const Vector2i vSize = GetSize();
+		if (vSize.x > 0 && vSize.y > 0) {
+			const uint32 nNumOfPixels = vSize.x*vSize.y;
+			m_pfDepth = new float[nNumOfPixels];
+			for (uint32 i=0; i<nNumOfPixels; i++)
+				m_pfDepth[i] = 1.0f;
+		}
+	}
+
+	// Done
+	return true;
+}
+
+void SurfaceTextureBuffer::DeInit()
+{
+	// Destroy the depth buffer
+	if (m_pfDepth) {
+		delete [] m_pfDepth;
+		m_pfDepth = nullptr;
+	}
+}
+
+bool SurfaceTextureBuffer::MakeCurrent(uint8 nFace)
+{
+	// Set the face, the rasterizer can't render into cube texture buffers but the depth buffer is still used
+	m_nFace = nFace;
+
+	// Done
+	return true;
+}
+
+bool SurfaceTextureBuffer::UnmakeCurrent()
+{
+	// Update the depth render target
+	ResolveDepthRenderTarget();
+
+	// Done
+	return true;
+}
+
+bool SurfaceTextureBuffer::Present()
+{
+	// Nothing to do here...
+	return true;
+}
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+} // PLRendererSoftware
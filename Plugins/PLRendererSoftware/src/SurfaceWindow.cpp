@@ -0,0 +1,206 @@
+/*********************************************************\
+ *  File: SurfaceWindow.cpp                              *
+ *
+ *  Copyright (C) 2002-2013 The PixelLight Team (http://www.pixellight.org/)
+ *
+ *  This file is part of PixelLight.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ *  and associated documentation files (the "Software"), to deal in the Software without
+ *  restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ *  Software is furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all copies or
+ *  substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ *  BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ *  DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ *  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#ifdef WIN32
+	#include <PLCore/PLCoreWindowsIncludes.h>
+#endif
+#include "PLRendererSoftware/SurfaceWindow.h"
+#ifdef LINUX
+	#include <X11/Xlib.h>
+#endif
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+using namespace PLCore;
+using namespace PLMath;
+namespace PLRendererSoftware {
+
+
+//[-------------------------------------------------------]
+//[ Public functions                                      ]
+//[-------------------------------------------------------]
+/**
+*  @brief
+*    Destructor
+*/
+SurfaceWindow::~SurfaceWindow()
+{
+	DeInit();
+
+	// Close the X server display connection
+	#ifdef LINUX
+		if (m_pDisplay)
+			XCloseDisplay(m_pDisplay);
+	#endif
+}
+
+
+//[-------------------------------------------------------]
+//[ Private functions                                     ]
+//[-------------------------------------------------------]
+/**
+*  @brief
+*    Constructor
+*/
+SurfaceWindow::SurfaceWindow(PLRenderer::SurfaceWindowHandler &cHandler, handle nNativeWindowHandle, const Vector2i &vSize, bool bFullscreen) :
+	PLRenderer::SurfaceWindow(cHandler, nNativeWindowHandle, bFullscreen),
+	m_vSize(vSize),
+	m_pnColor(nullptr),
+	m_pfDepth(nullptr)
+{
+	// Open a X server display connection to get the size of the native window, without X server the given size is used
+	#ifdef LINUX
+		m_pDisplay = nNativeWindowHandle ? XOpenDisplay(nullptr) : nullptr;
+	#endif
+
+	// Init
+	Init();
+}
+
+/**
+*  @brief
+*    Makes sure that the color and depth buffers are matching the current surface size
+*/
+bool SurfaceWindow::UpdateBuffers()
+{
+	// Is the size still the same?
+	const Vector2i vSize = GetSize();
+	if (vSize != m_vBufferSize || !m_pnColor) {
+		// Destroy the previous buffers
+		DeInit();
+
+		// Create the buffers, black and with the farthest depth
+		if (vSize.x > 0 && vSize.y > 0) {
+			const uint32 nNumOfPixels = vSize.x*vSize.y;
+			m_pnColor = new uint8[nNumOfPixels*4];
+			MemoryManager::Set(m_pnColor, 0, nNumOfPixels*4);
+			m_pfDepth = new float[nNumOfPixels];
+			for (uint32 i=0; i<nNumOfPixels; i++)
+				m_pfDepth[i] = 1.0f;
+			m_vBufferSize = vSize;
+		}
+	}
+
+	// Done
+	return (m_pnColor != nullptr);
+}
+
+
+//[-------------------------------------------------------]
+//[ Public virtual PLRenderer::SurfaceWindow functions    ]
+//[-------------------------------------------------------]
+bool SurfaceWindow::GetGamma(float &fRed, float &fGreen, float &fBlue) const
+{
+	// Error!
+	return false;
+}
+
+bool SurfaceWindow::SetGamma(float fRed, float fGreen, float fBlue)
+{
+	// Error!
+	return false;
+}
+
+
+//[-------------------------------------------------------]
+//[ Public virtual PLRenderer::Surface functions          ]
+//[-------------------------------------------------------]
+Vector2i SurfaceWindow::GetSize() const
+{
+	#ifdef WIN32
+		if (GetNativeWindowHandle()) {
+			RECT sRect;
+			GetClientRect(reinterpret_cast<HWND>(GetNativeWindowHandle()), &sRect);
+			return Vector2i(sRect.right, sRect.bottom);
+		}
+	#endif
+
+	#ifdef LINUX
+		if (GetNativeWindowHandle() && m_pDisplay) {
+			::Window nRootWindow = 0;
+			int nPositionX = 0, nPositionY = 0;
+			unsigned int nWidth = 0, nHeight = 0, nBorder = 0, nDepth = 0;
+
+			// Get X window geometry information
+			if (XGetGeometry(m_pDisplay, GetNativeWindowHandle(), &nRootWindow, &nPositionX, &nPositionY, &nWidth, &nHeight, &nBorder, &nDepth))
+				return Vector2i(nWidth, nHeight);
+		}
+	#endif
+
+	// Use the given surface size
+	return m_vSize;
+}
+
+
+//[-------------------------------------------------------]
+//[ Private virtual PLRenderer::Surface functions         ]
+//[-------------------------------------------------------]
+bool SurfaceWindow::Init()
+{
+	// Create the buffers
+	return UpdateBuffers();
+}
+
+void SurfaceWindow::DeInit()
+{
+	// Destroy the buffers
+	if (m_pnColor) {
+		delete [] m_pnColor;
+		m_pnColor = nullptr;
+	}
+	if (m_pfDepth) {
+		delete [] m_pfDepth;
+		m_pfDepth = nullptr;
+	}
+	m_vBufferSize = Vector2i::Zero;
+}
+
+bool SurfaceWindow::MakeCurrent(uint8 nFace)
+{
+	// The window size may have been changed
+	return UpdateBuffers();
+}
+
+bool SurfaceWindow::UnmakeCurrent()
+{
+	// Done
+	return true;
+}
+
+bool SurfaceWindow::Present()
+{
+	// Nothing to do here, the buffers are not shown within the native window
+	return true;
+}
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+} // PLRendererSoftware
@@ -0,0 +1,229 @@
+/*********************************************************\
+ *  File: TextureBufferRectangle.cpp                     *
+ *
+ *  Copyright (C) 2002-2013 The PixelLight Team (http://www.pixellight.org/)
+ *
+ *  This file is part of PixelLight.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ *  and associated documentation files (the "Software"), to deal in the Software without
+ *  restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ *  Software is furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all copies or
+ *  substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ *  BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ *  DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ *  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include <PLGraphics/Image/Image.h>
+#include <PLGraphics/Image/ImageBuffer.h>
+#include <PLGraphics/Image/Effects/IEConvert.h>
+#include <PLRenderer/Renderer/Backend/RendererBackend.h>
+#include "PLRendererSoftware/TextureBufferRectangle.h"
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+using namespace PLCore;
+using namespace PLMath;
+using namespace PLGraphics;
+namespace PLRendererSoftware {
+
+
+//[-------------------------------------------------------]
+//[ Public functions                                      ]
+//[-------------------------------------------------------]
+/**
+*  @brief
+*    Destructor
+*/
+TextureBufferRectangle::~TextureBufferRectangle()
+{
+	// Destroy the data
+	if (m_pnData) {
+		delete [] m_pnData;
+
+		// Update renderer statistics
+		static_cast<PLRenderer::RendererBackend&>(GetRenderer()).GetWritableStatistics().nTextureBuffersMem -= m_vSize.x*m_vSize.y*4;
+	}
+
+	// Update renderer statistics
+	static_cast<PLRenderer::RendererBackend&>(GetRenderer()).GetWritableStatistics().nTextureBuffersNum--;
+}
+
+
+//[-------------------------------------------------------]
+//[ Private functions                                     ]
+//[-------------------------------------------------------]
+/**
+*  @brief
+*    Constructor
+*/
+TextureBufferRectangle::TextureBufferRectangle(PLRenderer::Renderer &cRenderer, Image &cImage, EPixelFormat nInternalFormat, uint32 nFlags) :
+	PLRenderer::TextureBufferRectangle(cRenderer, nFlags),
+	m_pnData(nullptr)
+{
+	// Update renderer statistics
+	static_cast<PLRenderer::RendererBackend&>(cRenderer).GetWritableStatistics().nTextureBuffersNum++;
+
+	// Get the image buffer
+	ImageBuffer *pImageBuffer = cImage.GetBuffer();
+	if (pImageBuffer) {
+		// Set data
+		m_vSize.x = pImageBuffer->GetSize().x;
+		m_vSize.y = pImageBuffer->GetSize().y;
+		m_nFormat = (nInternalFormat == Unknown) ? GetFormatFromImage(cImage) : nInternalFormat;
+
+		// The rasterizer works with RGBA bytes, so convert a copy of the image buffer
+		ImageBuffer cImageBuffer = *pImageBuffer;
+		cImageBuffer.ApplyEffect(IEConvert(DataByte, ColorRGBA));
+		const uint32 nNumOfBytes = m_vSize.x*m_vSize.y*4;
+		if (nNumOfBytes && cImageBuffer.GetDataSize() >= nNumOfBytes) {
+			m_pnData = new uint8[nNumOfBytes];
+			MemoryManager::Copy(m_pnData, cImageBuffer.GetData(), nNumOfBytes);
+
+			// Update renderer statistics
+			static_cast<PLRenderer::RendererBackend&>(cRenderer).GetWritableStatistics().nTextureBuffersMem += nNumOfBytes;
+		}
+	}
+}
+
+/**
+*  @brief
+*    Constructor
+*/
+TextureBufferRectangle::TextureBufferRectangle(PLRenderer::Renderer &cRenderer, const Vector2i &vSize, EPixelFormat nInternalFormat, uint32 nFlags) :
+	PLRenderer::TextureBufferRectangle(cRenderer, nFlags),
+	m_pnData(nullptr)
+{
+	// Update renderer statistics
+	static_cast<PLRenderer::RendererBackend&>(cRenderer).GetWritableStatistics().nTextureBuffersNum++;
+
+	// Init data
+	m_vSize   = vSize;
+	m_nFormat = nInternalFormat;
+
+	// Create the data, black and transparent, this texture buffer is usually used as render target
+	const uint32 nNumOfBytes = m_vSize.x*m_vSize.y*4;
+	if (nNumOfBytes) {
+		m_pnData = new uint8[nNumOfBytes];
+		MemoryManager::Set(m_pnData, 0, nNumOfBytes);
+
+		// Update renderer statistics
+		static_cast<PLRenderer::RendererBackend&>(cRenderer).GetWritableStatistics().nTextureBuffersMem += nNumOfBytes;
+	}
+}
+
+
+//[-------------------------------------------------------]
+//[ Public virtual PLRenderer::TextureBuffer functions    ]
+//[-------------------------------------------------------]
+bool TextureBufferRectangle::CopyDataFrom(uint32 nMipmap, EPixelFormat nFormat, const void *pData, uint8 nFace)
+{
+	// Error?
+	if (nMipmap != 0 || nFormat == Unknown || !pData || nFace || !m_pnData)
+		return false;
+
+	// Convert the given data into RGBA bytes, the rasterizer only uses the top level
+	const uint32  nNumOfTexels = m_vSize.x*m_vSize.y;
+	const uint8  *pnSource	   = static_cast<const uint8*>(pData);
+	uint8		 *pnData	   = m_pnData;
+	switch (nFormat) {
+		case R8G8B8A8:
+			MemoryManager::Copy(m_pnData, pData, nNumOfTexels*4);
+			break;
+
+		case R8G8B8:
+			for (uint32 i=0; i<nNumOfTexels; i++, pnSource+=3, pnData+=4) {
+				pnData[0] = pnSource[0];
+				pnData[1] = pnSource[1];
+				pnData[2] = pnSource[2];
+				pnData[3] = 255;
+			}
+			break;
+
+		case L8:
+			for (uint32 i=0; i<nNumOfTexels; i++, pnSource++, pnData+=4) {
+				pnData[0] = pnData[1] = pnData[2] = *pnSource;
+				pnData[3] = 255;
+			}
+			break;
+
+		default:
+			// Error, format not supported by the rasterizer
+			return false;
+	}
+
+	// Done
+	return true;
+}
+
+bool TextureBufferRectangle::CopyDataTo(uint32 nMipmap, EPixelFormat nFormat, void *pData, uint8 nFace) const
+{
+	// Error?
+	if (nMipmap != 0 || nFormat == Unknown || !pData || nFace || !m_pnData)
+		return false;
+
+	// Convert the RGBA bytes into the requested format
+	const uint32  nNumOfTexels	= m_vSize.x*m_vSize.y;
+	const uint8  *pnData		= m_pnData;
+	uint8		 *pnDestination	= static_cast<uint8*>(pData);
+	switch (nFormat) {
+		case R8G8B8A8:
+			MemoryManager::Copy(pData, m_pnData, nNumOfTexels*4);
+			break;
+
+		case R8G8B8:
+			for (uint32 i=0; i<nNumOfTexels; i++, pnData+=4, pnDestination+=3) {
+				pnDestination[0] = pnData[0];
+				pnDestination[1] = pnData[1];
+				pnDestination[2] = pnData[2];
+			}
+			break;
+
+		case L8:
+			for (uint32 i=0; i<nNumOfTexels; i++, pnData+=4, pnDestination++)
+				*pnDestination = pnData[0];
+			break;
+
+		default:
+			// Error, format not supported by the rasterizer
+			return false;
+	}
+
+	// Done
+	return true;
+}
+
+
+//[-------------------------------------------------------]
+//[ Private virtual PLRenderer::TextureBuffer functions   ]
+//[-------------------------------------------------------]
+bool TextureBufferRectangle::MakeCurrent(uint32 nStage)
+{
+	// Check if there are renderer information
+	if (GetRenderer().GetTextureBuffer(nStage) != this) {
+		if (!GetRenderer().SetTextureBuffer(nStage, this))
+			return true; // Done
+	}
+
+	// Done
+	return true;
+}
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+} // PLRendererSoftware
@@ -0,0 +1,644 @@
+/*********************************************************\
+ *  File: BrickedVolume.h                                *
+ *
+ *  Copyright (C) 2002-2013 The PixelLight Team (http://www.pixellight.org/)
+ *
+ *  This file is part of PixelLight.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ *  and associated documentation files (the "Software"), to deal in the Software without
+ *  restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ *  Software is furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all copies or
+ *  substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ *  BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ *  DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ *  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+#ifndef __PLVOLUME_BRICKEDVOLUME_H__
+#define __PLVOLUME_BRICKEDVOLUME_H__
+#pragma once
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include <PLCore/String/String.h>
+#include <PLCore/Container/Array.h>
+#include <PLMath/Vector3i.h>
+#include "PLVolume/PLVolume.h"
+
+
+//[-------------------------------------------------------]
+//[ Forward declarations                                  ]
+//[-------------------------------------------------------]
+namespace PLCore {
+	class File;
+}
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace PLVolume {
+
+
+//[-------------------------------------------------------]
+//[ Classes                                               ]
+//[-------------------------------------------------------]
+/**
+*  @brief
+*    Out-of-core volume data storage split into bricks
+*
+*  @remarks
+*    Volumes which don't fit into the host memory are split into cubic bricks. The bricks are stored within brick
+*    files on disk and only the currently used bricks are kept within a brick cache with a configurable memory budget,
+*    the least recently used brick is replaced first.
+*
+*    Beside the original resolution (level 0), there are further resolution levels down to a level fitting into one
+*    brick, each level has half the resolution of the previous level. For each brick, the minimum and the maximum voxel
+*    value is known without accessing the brick data, so e.g. empty or uniform bricks can be skipped.
+*
+*    Usage:
+*    - Build the brick files by using "Create()", "AddSlices()" and "Finish()", or "Load()" which reads a raw voxel file slice by slice
+*    - Reuse already built brick files by using "Open()"
+*    - Access the bricks by using "GetBrick()" or copy a complete resolution level by using "CopyLevel()"
+*
+*    The brick files are "<filename>" holding the header and the brick ranges, and "<filename>.<n>" holding the brick
+*    data. A brick data file never gets bigger than 256 MiB so it can be memory mapped even within 32 bit processes.
+*    If possible, the brick data files are memory mapped, else they are read by using the usual file functions.
+*
+*  @note
+*    - Only 8 bit and 16 bit volumes with one component per voxel are supported
+*    - Bricks which are crossing the volume border are padded by repeating the border voxels
+*/
+class BrickedVolume {
+
+
+	//[-------------------------------------------------------]
+	//[ Public static data                                    ]
+	//[-------------------------------------------------------]
+	public:
+		static PLVOLUME_API const PLCore::uint32 DefaultBrickSize;		/**< Default number of voxels along each brick axis (32) */
+		static PLVOLUME_API const PLCore::uint32 DefaultMemoryBudget;	/**< Default brick cache memory budget in bytes (256 MiB) */
+
+
+	//[-------------------------------------------------------]
+	//[ Public functions                                      ]
+	//[-------------------------------------------------------]
+	public:
+		/**
+		*  @brief
+		*    Default constructor
+		*/
+		PLVOLUME_API BrickedVolume();
+
+		/**
+		*  @brief
+		*    Destructor
+		*/
+		PLVOLUME_API ~BrickedVolume();
+
+		/**
+		*  @brief
+		*    Opens already built brick files
+		*
+		*  @param[in] sFilename
+		*    Filename of the brick files
+		*  @param[in] nSourceModificationTime
+		*    Modification time of the source the brick files were built from, brick files older than this are not used, 0 to ignore the modification time
+		*
+		*  @return
+		*    'true' if all went fine, else 'false' (no or outdated brick files?)
+		*
+		*  @note
+		*    - The previous bricked volume is closed
+		*/
+		PLVOLUME_API bool Open(const PLCore::String &sFilename, PLCore::uint64 nSourceModificationTime = 0);
+
+		/**
+		*  @brief
+		*    Starts building new brick files
+		*
+		*  @param[in] sFilename
+		*    Filename of the brick files, existing brick files are overwritten
+		*  @param[in] vSize
+		*    Number of voxels along each axis, each component must be >0
+		*  @param[in] nBytesPerVoxel
+		*    Number of bytes per voxel, must be 1 or 2
+		*  @param[in] nBrickSize
+		*    Number of voxels along each brick axis, must be a power of two between 8 and 128
+		*
+		*  @return
+		*    'true' if all went fine, else 'false'
+		*
+		*  @note
+		*    - The previous bricked volume is closed
+		*    - Add the voxel data by using "AddSlices()" and call "Finish()" when all slices were added
+		*/
+		PLVOLUME_API bool Create(const PLCore::String &sFilename, const PLMath::Vector3i &vSize, PLCore::uint32 nBytesPerVoxel, PLCore::uint32 nBrickSize = DefaultBrickSize);
+
+		/**
+		*  @brief
+		*    Adds slices of voxel data to the brick files which are currently being built
+		*
+		*  @param[in] pnData
+		*    Voxel data of the slices, voxel(x, y, z) = pnData[(z*<height> + y)*<width> + x], must be valid!
+		*  @param[in] nNumOfSlices
+		*    Number of slices within the given data
+		*
+		*  @return
+		*    'true' if all went fine, else 'false' (not building? too many slices? write error?)
+		*
+		*  @note
+		*    - The slices have to be added in order, starting with the slice 0
+		*/
+		PLVOLUME_API bool AddSlices(const PLCore::uint8 *pnData, PLCore::uint32 nNumOfSlices);
+
+		/**
+		*  @brief
+		*    Finishes building the brick files
+		*
+		*  @return
+		*    'true' if all went fine, else 'false' (not building? missing slices? write error?)
+		*
+		*  @remarks
+		*    Builds the further resolution levels and writes the header. On success, the bricked volume is open,
+		*    on error the bricked volume is closed and the incomplete brick files are deleted.
+		*/
+		PLVOLUME_API bool Finish();
+
+		/**
+		*  @brief
+		*    Loads a bricked volume from a raw voxel file
+		*
+		*  @param[in] cFile
+		*    Raw voxel file to read from, the voxel data starts at the current file position
+		*  @param[in] vSize
+		*    Number of voxels along each axis, each component must be >0
+		*  @param[in] nBytesPerVoxel
+		*    Number of bytes per voxel, must be 1 or 2
+		*
+		*  @return
+		*    'true' if all went fine, else 'false' (on error, the file position is restored)
+		*
+		*  @remarks
+		*    The brick files are stored next to the raw voxel file by using "<filename>.bricks" as filename. If there are
+		*    already up-to-date brick files, they are reused without reading the raw voxel file. Else, the raw voxel file is
+		*    read slice by slice and the brick files are built, so just a few slices are within the host memory at once.
+		*/
+		PLVOLUME_API bool Load(PLCore::File &cFile, const PLMath::Vector3i &vSize, PLCore::uint32 nBytesPerVoxel);
+
+		/**
+		*  @brief
+		*    Closes the bricked volume
+		*
+		*  @param[in] bDeleteFiles
+		*    Delete the brick files?
+		*/
+		PLVOLUME_API void Close(bool bDeleteFiles = false);
+
+		/**
+		*  @brief
+		*    Returns whether or not the bricked volume is open
+		*
+		*  @return
+		*    'true' if the bricked volume is open and the bricks can be accessed, else 'false'
+		*/
+		inline bool IsOpen() const;
+
+		/**
+		*  @brief
+		*    Returns the filename of the brick files
+		*
+		*  @return
+		*    Filename of the brick files, empty string if there are no brick files
+		*/
+		inline const PLCore::String &GetFilename() const;
+
+		/**
+		*  @brief
+		*    Returns the number of voxels along each axis
+		*
+		*  @return
+		*    Number of voxels along each axis of the original resolution
+		*/
+		inline const PLMath::Vector3i &GetSize() const;
+
+		/**
+		*  @brief
+		*    Returns the number of bytes per voxel
+		*
+		*  @return
+		*    Number of bytes per voxel (1 or 2), 0 if there's no volume
+		*/
+		inline PLCore::uint32 GetBytesPerVoxel() const;
+
+		/**
+		*  @brief
+		*    Returns the number of voxels along each brick axis
+		*
+		*  @return
+		*    Number of voxels along each brick axis
+		*/
+		inline PLCore::uint32 GetBrickSize() const;
+
+		/**
+		*  @brief
+		*    Returns the size of the data of one brick
+		*
+		*  @return
+		*    Size of the data of one brick in bytes
+		*/
+		inline PLCore::uint32 GetBrickDataSize() const;
+
+		/**
+		*  @brief
+		*    Returns the number of resolution levels
+		*
+		*  @return
+		*    Number of resolution levels, level 0 is the original resolution and the last level fits into one brick
+		*/
+		inline PLCore::uint32 GetNumOfLevels() const;
+
+		/**
+		*  @brief
+		*    Returns the number of voxels along each axis of a resolution level
+		*
+		*  @param[in] nLevel
+		*    Resolution level, must be valid
+		*
+		*  @return
+		*    Number of voxels along each axis of the resolution level
+		*/
+		inline const PLMath::Vector3i &GetLevelSize(PLCore::uint32 nLevel) const;
+
+		/**
+		*  @brief
+		*    Returns the number of bricks along each axis of a resolution level
+		*
+		*  @param[in] nLevel
+		*    Resolution level, must be valid
+		*
+		*  @return
+		*    Number of bricks along each axis of the resolution level
+		*/
+		inline const PLMath::Vector3i &GetNumOfBricks(PLCore::uint32 nLevel) const;
+
+		/**
+		*  @brief
+		*    Returns the minimum and maximum voxel value of a brick
+		*
+		*  @param[in]  nLevel
+		*    Resolution level
+		*  @param[in]  vBrick
+		*    Brick position within the resolution level
+		*  @param[out] nMinimum
+		*    Receives the minimum voxel value of the brick, not touched on error
+		*  @param[out] nMaximum
+		*    Receives the maximum voxel value of the brick, not touched on error
+		*
+		*  @return
+		*    'true' if all went fine, else 'false' (invalid brick?)
+		*
+		*  @note
+		*    - The brick data is not accessed, so this is cheap
+		*/
+		PLVOLUME_API bool GetBrickRange(PLCore::uint32 nLevel, const PLMath::Vector3i &vBrick, PLCore::uint32 &nMinimum, PLCore::uint32 &nMaximum) const;
+
+		/**
+		*  @brief
+		*    Returns the data of a brick
+		*
+		*  @param[in] nLevel
+		*    Resolution level
+		*  @param[in] vBrick
+		*    Brick position within the resolution level
+		*
+		*  @return
+		*    The brick data, voxel(x, y, z) = data[(z*<brick size> + y)*<brick size> + x], a null pointer on error
+		*
+		*  @note
+		*    - The brick is loaded into the brick cache if it's not already cached
+		*    - The returned data is only valid until the next call of this method
+		*/
+		PLVOLUME_API const PLCore::uint8 *GetBrick(PLCore::uint32 nLevel, const PLMath::Vector3i &vBrick);
+
+		/**
+		*  @brief
+		*    Copies a complete resolution level brick by brick into a linear buffer
+		*
+		*  @param[in]  nLevel
+		*    Resolution level
+		*  @param[out] pnDestination
+		*    Receives the voxel data, voxel(x, y, z) = pnDestination[(z*<height> + y)*<width> + x], must be valid and big enough!
+		*
+		*  @return
+		*    'true' if all went fine, else 'false'
+		*/
+		PLVOLUME_API bool CopyLevel(PLCore::uint32 nLevel, PLCore::uint8 *pnDestination);
+
+		//[-------------------------------------------------------]
+		//[ Brick cache                                           ]
+		//[-------------------------------------------------------]
+		/**
+		*  @brief
+		*    Returns the brick cache memory budget
+		*
+		*  @return
+		*    The brick cache memory budget in bytes
+		*/
+		inline PLCore::uint32 GetMemoryBudget() const;
+
+		/**
+		*  @brief
+		*    Sets the brick cache memory budget
+		*
+		*  @param[in] nMemoryBudget
+		*    The brick cache memory budget in bytes, at least a few bricks are always cached
+		*
+		*  @note
+		*    - The cached bricks are discarded
+		*/
+		PLVOLUME_API void SetMemoryBudget(PLCore::uint32 nMemoryBudget);
+
+		/**
+		*  @brief
+		*    Returns the number of currently cached bricks
+		*
+		*  @return
+		*    The number of currently cached bricks
+		*/
+		inline PLCore::uint32 GetNumOfCachedBricks() const;
+
+
+	//[-------------------------------------------------------]
+	//[ Private definitions                                   ]
+	//[-------------------------------------------------------]
+	private:
+		static const PLCore::uint32 InvalidIndex = 0xFFFFFFFF;	/**< Invalid brick or brick cache slot index */
+
+		/**
+		*  @brief
+		*    Resolution level
+		*/
+		struct Level {
+			PLMath::Vector3i vSize;			/**< Number of voxels along each axis */
+			PLMath::Vector3i vNumOfBricks;	/**< Number of bricks along each axis */
+			PLCore::uint32	 nFirstBrick;	/**< Index of the first brick of this level */
+		};
+
+		/**
+		*  @brief
+		*    Brick cache slot, the slots are linked from the most recently to the least recently used one
+		*/
+		struct CacheSlot {
+			PLCore::uint8  *pnData;		/**< Brick data, can be a null pointer */
+			PLCore::uint32  nBrick;		/**< Index of the cached brick, "InvalidIndex" if there's no cached brick */
+			PLCore::uint32  nPrevious;	/**< Previous (more recently used) slot, "InvalidIndex" if there's no previous slot */
+			PLCore::uint32  nNext;		/**< Next (less recently used) slot, "InvalidIndex" if there's no next slot */
+		};
+
+
+	//[-------------------------------------------------------]
+	//[ Private functions                                     ]
+	//[-------------------------------------------------------]
+	private:
+		/**
+		*  @brief
+		*    Copy constructor
+		*
+		*  @param[in] cSource
+		*    Source to copy from
+		*/
+		BrickedVolume(const BrickedVolume &cSource);
+
+		/**
+		*  @brief
+		*    Copy operator
+		*
+		*  @param[in] cSource
+		*    Source to copy from
+		*
+		*  @return
+		*    Reference to this instance
+		*/
+		BrickedVolume &operator =(const BrickedVolume &cSource);
+
+		/**
+		*  @brief
+		*    Sets up the resolution levels
+		*
+		*  @param[in] vSize
+		*    Number of voxels along each axis of the original resolution
+		*  @param[in] nBytesPerVoxel
+		*    Number of bytes per voxel
+		*  @param[in] nBrickSize
+		*    Number of voxels along each brick axis
+		*/
+		void SetupLevels(const PLMath::Vector3i &vSize, PLCore::uint32 nBytesPerVoxel, PLCore::uint32 nBrickSize);
+
+		/**
+		*  @brief
+		*    Returns the index of a brick
+		*
+		*  @param[in] nLevel
+		*    Resolution level
+		*  @param[in] vBrick
+		*    Brick position within the resolution level
+		*
+		*  @return
+		*    Index of the brick, "InvalidIndex" if the brick is invalid
+		*/
+		PLCore::uint32 GetBrickIndex(PLCore::uint32 nLevel, const PLMath::Vector3i &vBrick) const;
+
+		/**
+		*  @brief
+		*    Returns the filename of a brick data file
+		*
+		*  @param[in] nFile
+		*    Index of the brick data file
+		*
+		*  @return
+		*    The filename of the brick data file
+		*/
+		PLCore::String GetBrickFilename(PLCore::uint32 nFile) const;
+
+		/**
+		*  @brief
+		*    Opens the brick data files
+		*
+		*  @param[in] bWrite
+		*    Create the brick data files for building? If 'false', open the brick data files for reading and map them into memory if possible
+		*
+		*  @return
+		*    'true' if all went fine, else 'false'
+		*/
+		bool OpenBrickFiles(bool bWrite);
+
+		/**
+		*  @brief
+		*    Closes the brick data files
+		*
+		*  @param[in] bDelete
+		*    Delete the brick data files?
+		*/
+		void CloseBrickFiles(bool bDelete);
+
+		/**
+		*  @brief
+		*    Reads the data of a brick from the brick data files
+		*
+		*  @param[in]  nBrick
+		*    Index of the brick
+		*  @param[out] pnData
+		*    Receives the brick data, must be valid!
+		*
+		*  @return
+		*    'true' if all went fine, else 'false'
+		*/
+		bool ReadBrick(PLCore::uint32 nBrick, PLCore::uint8 *pnData);
+
+		/**
+		*  @brief
+		*    Writes the data of a brick into the brick data files and updates the brick range
+		*
+		*  @param[in] nBrick
+		*    Index of the brick
+		*  @param[in] pnData
+		*    Brick data, must be valid!
+		*
+		*  @return
+		*    'true' if all went fine, else 'false'
+		*/
+		bool WriteBrick(PLCore::uint32 nBrick, const PLCore::uint8 *pnData);
+
+		/**
+		*  @brief
+		*    Splits the slab of the original resolution into bricks and writes them
+		*
+		*  @return
+		*    'true' if all went fine, else 'false'
+		*/
+		bool WriteSlab();
+
+		/**
+		*  @brief
+		*    Builds a resolution level by downsampling the previous resolution level
+		*
+		*  @param[in] nLevel
+		*    Resolution level to build, must be >0 and the previous level must already be built
+		*
+		*  @return
+		*    'true' if all went fine, else 'false'
+		*/
+		bool BuildLevel(PLCore::uint32 nLevel);
+
+		/**
+		*  @brief
+		*    Pads a brick by repeating the border voxels of the valid brick region
+		*
+		*  @param[in, out] pnData
+		*    Brick data, must be valid!
+		*  @param[in]      vValid
+		*    Number of valid voxels along each brick axis, each component must be >0
+		*/
+		void PadBrick(PLCore::uint8 *pnData, const PLMath::Vector3i &vValid) const;
+
+		/**
+		*  @brief
+		*    Writes the header file
+		*
+		*  @return
+		*    'true' if all went fine, else 'false'
+		*/
+		bool WriteHeader() const;
+
+		/**
+		*  @brief
+		*    Discards all cached bricks and sets up the brick cache slots
+		*/
+		void ResetCache();
+
+		/**
+		*  @brief
+		*    Frees the brick cache
+		*/
+		void FreeCache();
+
+		/**
+		*  @brief
+		*    Links a brick cache slot
+		*
+		*  @param[in] nSlot
+		*    Slot to link, must be unlinked
+		*  @param[in] bMostRecent
+		*    Link the slot as the most recently used one? If 'false', the slot is linked as the least recently used one.
+		*/
+		void LinkSlot(PLCore::uint32 nSlot, bool bMostRecent);
+
+		/**
+		*  @brief
+		*    Unlinks a brick cache slot
+		*
+		*  @param[in] nSlot
+		*    Slot to unlink, must be linked
+		*/
+		void UnlinkSlot(PLCore::uint32 nSlot);
+
+
+	//[-------------------------------------------------------]
+	//[ Private data                                          ]
+	//[-------------------------------------------------------]
+	private:
+		// General
+		PLCore::String				 m_sFilename;			/**< Filename of the brick files, empty string if there are no brick files */
+		PLCore::uint32				 m_nBytesPerVoxel;		/**< Number of bytes per voxel, 0 if there's no volume */
+		PLCore::uint32				 m_nBrickSize;			/**< Number of voxels along each brick axis */
+		PLCore::uint32				 m_nBrickDataSize;		/**< Size of the data of one brick in bytes */
+		Level						*m_pLevels;				/**< Resolution levels, can be a null pointer */
+		PLCore::uint32				 m_nNumOfLevels;		/**< Number of resolution levels */
+		PLCore::uint32				 m_nNumOfBricks;		/**< Total number of bricks of all resolution levels */
+		PLCore::uint16				*m_pnBrickRanges;		/**< Minimum and maximum voxel value of each brick, can be a null pointer */
+		PLCore::Array<PLCore::File*> m_lstFiles;			/**< Brick data files */
+		PLCore::uint32				 m_nBricksPerFile;		/**< Number of bricks per brick data file */
+		bool						 m_bOpen;				/**< Is the bricked volume open? */
+		// Building
+		bool						 m_bBuilding;			/**< Are the brick files currently being built? */
+		PLCore::uint8				*m_pnSlab;				/**< One brick layer of slices of the original resolution, can be a null pointer */
+		PLCore::uint32				 m_nNumOfSlabSlices;	/**< Number of slices within the slab */
+		PLCore::uint32				 m_nNumOfSlices;		/**< Number of already added slices */
+		PLCore::uint8				*m_pnBrickBuffer;		/**< Brick data buffer, can be a null pointer */
+		// Brick cache
+		PLCore::uint32				 m_nMemoryBudget;		/**< Brick cache memory budget in bytes */
+		CacheSlot					*m_pCacheSlots;			/**< Brick cache slots, can be a null pointer */
+		PLCore::uint32				 m_nNumOfCacheSlots;	/**< Number of brick cache slots */
+		PLCore::uint32				 m_nNumOfUsedSlots;		/**< Number of used brick cache slots */
+		PLCore::uint32				 m_nMostRecentSlot;		/**< Most recently used brick cache slot, "InvalidIndex" if there's no such slot */
+		PLCore::uint32				 m_nLeastRecentSlot;	/**< Least recently used brick cache slot, "InvalidIndex" if there's no such slot */
+		PLCore::uint32				*m_pnBrickSlots;		/**< Brick cache slot of each brick, "InvalidIndex" if the brick is not cached, can be a null pointer */
+
+
+};
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+} // PLVolume
+
+
+//[-------------------------------------------------------]
+//[ Implementation                                        ]
+//[-------------------------------------------------------]
+#include "PLVolume/BrickedVolume.inl"
+
+
+#endif // __PLVOLUME_BRICKEDVOLUME_H__
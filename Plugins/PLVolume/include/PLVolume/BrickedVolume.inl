@@ -0,0 +1,137 @@
+/*********************************************************\
+ *  File: BrickedVolume.inl                              *
+ *
+ *  Copyright (C) 2002-2013 The PixelLight Team (http://www.pixellight.org/)
+ *
+ *  This file is part of PixelLight.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ *  and associated documentation files (the "Software"), to deal in the Software without
+ *  restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ *  Software is furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all copies or
+ *  substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ *  BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ *  DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ *  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace PLVolume {
+
+
+//[-------------------------------------------------------]
+//[ Public functions                                      ]
+//[-------------------------------------------------------]
+/**
+*  @brief
+*    Returns whether or not the bricked volume is open
+*/
+inline bool BrickedVolume::IsOpen() const
+{
+	return m_bOpen;
+}
+
+/**
+*  @brief
+*    Returns the filename of the brick files
+*/
+inline const PLCore::String &BrickedVolume::GetFilename() const
+{
+	return m_sFilename;
+}
+
+/**
+*  @brief
+*    Returns the number of voxels along each axis
+*/
+inline const PLMath::Vector3i &BrickedVolume::GetSize() const
+{
+	return m_pLevels ? m_pLevels[0].vSize : PLMath::Vector3i::Zero;
+}
+
+/**
+*  @brief
+*    Returns the number of bytes per voxel
+*/
+inline PLCore::uint32 BrickedVolume::GetBytesPerVoxel() const
+{
+	return m_nBytesPerVoxel;
+}
+
+/**
+*  @brief
+*    Returns the number of voxels along each brick axis
+*/
+inline PLCore::uint32 BrickedVolume::GetBrickSize() const
+{
+	return m_nBrickSize;
+}
+
+/**
+*  @brief
+*    Returns the size of the data of one brick
+*/
+inline PLCore::uint32 BrickedVolume::GetBrickDataSize() const
+{
+	return m_nBrickDataSize;
+}
+
+/**
+*  @brief
+*    Returns the number of resolution levels
+*/
+inline PLCore::uint32 BrickedVolume::GetNumOfLevels() const
+{
+	return m_nNumOfLevels;
+}
+
+/**
+*  @brief
+*    Returns the number of voxels along each axis of a resolution level
+*/
+inline const PLMath::Vector3i &BrickedVolume::GetLevelSize(PLCore::uint32 nLevel) const
+{
+	return m_pLevels[nLevel].vSize;
+}
+
+/**
+*  @brief
+*    Returns the number of bricks along each axis of a resolution level
+*/
+inline const PLMath::Vector3i &BrickedVolume::GetNumOfBricks(PLCore::uint32 nLevel) const
+{
+	return m_pLevels[nLevel].vNumOfBricks;
+}
+
+/**
+*  @brief
+*    Returns the brick cache memory budget
+*/
+inline PLCore::uint32 BrickedVolume::GetMemoryBudget() const
+{
+	return m_nMemoryBudget;
+}
+
+/**
+*  @brief
+*    Returns the number of currently cached bricks
+*/
+inline PLCore::uint32 BrickedVolume::GetNumOfCachedBricks() const
+{
+	return m_nNumOfUsedSlots;
+}
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+} // PLVolume
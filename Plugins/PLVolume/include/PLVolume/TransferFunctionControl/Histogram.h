@@ -130,6 +130,41 @@ class Histogram {
 		*/
 		PLVOLUME_API void Create(PLCore::uint32 nNumOfBytesPerElement, PLCore::uint32 nNumOfElements, const PLCore::uint8 *pnData);
 
+		/**
+		*  @brief
+		*    Adds luminance data (= one component per element) to the histogram data
+		*
+		*  @param[in] nNumOfElements
+		*    Number elements (pixel/voxel)
+		*  @param[in] pnData
+		*    Luminance data to add to the histogram data, must be valid! (only accessed from within this method)
+		*
+		*  @remarks
+		*    Use this method to create the histogram of data which is not available at once, e.g. brick by brick. Call
+		*    "Create()" without data first, the number of bytes per element is the one given to "Create()".
+		*
+		*  @note
+		*    - The histogram must not be normalized
+		*/
+		PLVOLUME_API void Add(PLCore::uint32 nNumOfElements, const PLCore::uint8 *pnData);
+
+		/**
+		*  @brief
+		*    Adds a number of elements with the same value to the histogram data
+		*
+		*  @param[in] nValue
+		*    Value of the elements, must be < "GetNumOfBins()"
+		*  @param[in] nNumOfElements
+		*    Number elements (pixel/voxel)
+		*
+		*  @remarks
+		*    Uniform data, e.g. a brick whose minimum and maximum value are equal, can be added without looking at the data.
+		*
+		*  @note
+		*    - The histogram must not be normalized
+		*/
+		PLVOLUME_API void AddValue(PLCore::uint32 nValue, PLCore::uint32 nNumOfElements);
+
 		/**
 		*  @brief
 		*    Returns the number of bins
@@ -139,6 +174,15 @@ class Histogram {
 		*/
 		inline PLCore::uint32 GetNumOfBins() const;
 
+		/**
+		*  @brief
+		*    Returns the number of elements the histogram was created from
+		*
+		*  @return
+		*    The number of elements (pixel/voxel) the histogram was created from
+		*/
+		inline PLCore::uint64 GetNumOfElements() const;
+
 		/**
 		*  @brief
 		*    Returns the minimum value encountered while creating the histogram
@@ -230,11 +274,23 @@ class Histogram {
 		PLVOLUME_API void ToNormalizedImage(PLCore::uint32 nHeight, PLGraphics::Image &cDestinationImage, const PLGraphics::Color4 &cEmptySpaceColor, const PLGraphics::Color4 &cFilledSpaceColor);
 
 
+	//[-------------------------------------------------------]
+	//[ Private functions                                     ]
+	//[-------------------------------------------------------]
+	private:
+		/**
+		*  @brief
+		*    Invalidates the cached values which are calculated from the histogram data
+		*/
+		void InvalidateCachedValues();
+
+
 	//[-------------------------------------------------------]
 	//[ Private data                                          ]
 	//[-------------------------------------------------------]
 	private:
 		PLCore::Array<float> m_lstData;					/**< Histogram data */
+		PLCore::uint64		 m_nNumOfElements;			/**< Number of elements the histogram was created from */
 		float				 m_fMinScalarValue;			/**< The minimum value encountered while creating the histogram */
 		float				 m_fMaxScalarValue;			/**< The maximum value encountered while creating the histogram */
 		float				 m_fMinValue;				/**< The minimum value within the histogram, <0 if not yet initialized */
@@ -36,6 +36,7 @@ namespace PLVolume {
 *    Default constructor
 */
 inline Histogram::Histogram() :
+	m_nNumOfElements(0),
 	m_fMinScalarValue(0.0f),
 	m_fMaxScalarValue(0.0f),
 	m_fMinValue(-1.0f),
@@ -51,6 +52,7 @@ inline Histogram::Histogram() :
 */
 inline Histogram::Histogram(const Histogram &cSource) :
 	m_lstData(cSource.m_lstData),
+	m_nNumOfElements(cSource.m_nNumOfElements),
 	m_fMinScalarValue(cSource.m_fMinScalarValue),
 	m_fMaxScalarValue(cSource.m_fMaxScalarValue),
 	m_fMinValue(cSource.m_fMinValue),
@@ -72,7 +74,8 @@ inline Histogram::~Histogram()
 *  @brief
 *    Constructor, creates the histogram data from luminance data (= one component per element)
 */
-inline Histogram::Histogram(PLCore::uint32 nNumOfBytesPerElement, PLCore::uint32 nNumOfElements, const PLCore::uint8 *pnData)
+inline Histogram::Histogram(PLCore::uint32 nNumOfBytesPerElement, PLCore::uint32 nNumOfElements, const PLCore::uint8 *pnData) :
+	m_nNumOfElements(0)
 {
 	// Create the histogram data from luminance data (= one component per element)
 	Create(nNumOfBytesPerElement, nNumOfElements, pnData);
@@ -86,6 +89,7 @@ inline Histogram &Histogram::operator =(const Histogram &cSource)
 {
 	// Copy data
 	m_lstData				= cSource.m_lstData;
+	m_nNumOfElements		= cSource.m_nNumOfElements;
 	m_fMinScalarValue		= cSource.m_fMinScalarValue;
 	m_fMaxScalarValue		= cSource.m_fMaxScalarValue;
 	m_fMinValue				= cSource.m_fMinValue;
@@ -106,6 +110,15 @@ inline PLCore::uint32 Histogram::GetNumOfBins() const
 	return m_lstData.GetNumOfElements();
 }
 
+/**
+*  @brief
+*    Returns the number of elements the histogram was created from
+*/
+inline PLCore::uint64 Histogram::GetNumOfElements() const
+{
+	return m_nNumOfElements;
+}
+
 /**
 *  @brief
 *    Returns the minimum value encountered while creating the histogram
@@ -46,6 +46,7 @@ namespace PLRenderer {
 }
 namespace PLVolume {
 	class Histogram;
+	class BrickedVolume;
 	class TransferFunction;
 	class TransferFunctionControl;
 }
@@ -71,7 +72,8 @@ class Volume : public PLCore::Resource<Volume> {
 	//[ Public static data                                    ]
 	//[-------------------------------------------------------]
 	public:
-		static PLVOLUME_API const PLMath::Vector3 DefaultVoxelSize;	/**< 0.001, 0.001, 0.001 */
+		static PLVOLUME_API const PLMath::Vector3 DefaultVoxelSize;			/**< 0.001, 0.001, 0.001 */
+		static PLVOLUME_API const PLCore::uint32  DefaultBrickingThreshold;	/**< 256 MiB */
 
 
 	//[-------------------------------------------------------]
@@ -122,6 +124,61 @@ class Volume : public PLCore::Resource<Volume> {
 		*/
 		PLVOLUME_API PLMath::Vector3i GetVolumeImageSize() const;
 
+		/**
+		*  @brief
+		*    Returns whether or not the volumetric data is held by the bricked volume
+		*
+		*  @return
+		*    'true' if the volumetric data is held by the bricked volume, else 'false'
+		*
+		*  @see
+		*    - "GetBrickedVolume()"
+		*/
+		PLVOLUME_API bool IsBricked() const;
+
+		/**
+		*  @brief
+		*    Returns the bricked volume
+		*
+		*  @return
+		*    The bricked volume holding the volumetric data of huge datasets which don't fit into the host memory
+		*
+		*  @remarks
+		*    Volume loaders supporting bricked volumes use the bricked volume instead of the volume image if the size of the
+		*    volumetric data is above the bricking threshold. In this case, the volume image is empty.
+		*/
+		PLVOLUME_API BrickedVolume &GetBrickedVolume();
+
+		/**
+		*  @brief
+		*    Returns the bricked volume
+		*
+		*  @return
+		*    The bricked volume holding the volumetric data of huge datasets which don't fit into the host memory
+		*/
+		PLVOLUME_API const BrickedVolume &GetBrickedVolume() const;
+
+		/**
+		*  @brief
+		*    Returns the bricking threshold
+		*
+		*  @return
+		*    The size of the volumetric data in bytes above which volume loaders should use the bricked volume
+		*/
+		PLVOLUME_API PLCore::uint32 GetBrickingThreshold() const;
+
+		/**
+		*  @brief
+		*    Sets the bricking threshold
+		*
+		*  @param[in] nBrickingThreshold
+		*    The size of the volumetric data in bytes above which volume loaders should use the bricked volume, 0 to always use the bricked volume
+		*
+		*  @note
+		*    - Has only an effect on volumes loaded after this call
+		*/
+		PLVOLUME_API void SetBrickingThreshold(PLCore::uint32 nBrickingThreshold);
+
 		/**
 		*  @brief
 		*    Returns the size of one voxel
@@ -216,6 +273,7 @@ class Volume : public PLCore::Resource<Volume> {
 		*  @remarks
 		*    For the histogram, we need the volume image data. If we're in luck it's still on the host memory, else we have
 		*    to download the data temporarily from the GPU and possibly let it uncompress on the fly. May not be optimal for huge datasets.
+		*    For bricked volumes, the histogram is created brick by brick, bricks with only one value are added without accessing their data.
 		*
 		*  @note
 		*    - This method may internally need to download the data from the GPU (memory & performance may be an issue on huge datasets)
@@ -254,6 +312,7 @@ class Volume : public PLCore::Resource<Volume> {
 		*
 		*  @note
 		*    - Texture buffer is created automatically on-the-fly if there's currently no such instance
+		*    - For bricked volumes, the finest resolution level fitting into the GPU is assembled brick by brick
 		*
 		*  @see
 		*    - "GetVolumeTextureBuffer()"-method above
@@ -298,6 +357,8 @@ class Volume : public PLCore::Resource<Volume> {
 		PLGraphics::Image			 m_cVolumeImage;				/**< Image holding the volumetric data */
 		PLMath::Vector3				 m_vVoxelSize;					/**< Size of one voxel (without metric, but usually one unit is equal to one meter) */
 		TransferFunctionControl		*m_pTransferFunctionControl;	/**< Transfer function control, always valid */
+		BrickedVolume				*m_pBrickedVolume;				/**< Bricked volume, always valid */
+		PLCore::uint32				 m_nBrickingThreshold;			/**< Size of the volumetric data in bytes above which volume loaders should use the bricked volume */
 		// Cached texture buffer
 		PLRenderer::ResourceHandler *m_pTextureBufferHandler;		/**< Renderer texture buffer holding the 3D voxel data, can be a null pointer */
 
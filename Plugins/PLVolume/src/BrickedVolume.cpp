@@ -0,0 +1,972 @@
+/*********************************************************\
+ *  File: BrickedVolume.cpp                              *
+ *
+ *  Copyright (C) 2002-2013 The PixelLight Team (http://www.pixellight.org/)
+ *
+ *  This file is part of PixelLight.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ *  and associated documentation files (the "Software"), to deal in the Software without
+ *  restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ *  Software is furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all copies or
+ *  substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ *  BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ *  DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ *  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include <PLCore/File/File.h>
+#include <PLCore/Core/MemoryManager.h>
+#include <PLMath/Math.h>
+#include "PLVolume/BrickedVolume.h"
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+using namespace PLCore;
+using namespace PLMath;
+namespace PLVolume {
+
+
+//[-------------------------------------------------------]
+//[ Public static data                                    ]
+//[-------------------------------------------------------]
+const uint32 BrickedVolume::DefaultBrickSize	= 32;
+const uint32 BrickedVolume::DefaultMemoryBudget	= 256*1024*1024;
+
+
+//[-------------------------------------------------------]
+//[ Local definitions                                     ]
+//[-------------------------------------------------------]
+static const uint32 HeaderMagic		   = 0x42564C50;		// "PLVB" - Magic number of the brick header file
+static const uint32 HeaderVersion	   = 1;					// Version of the brick header file
+static const uint32 MaxBrickFileSize   = 256*1024*1024;		// Maximum size of a brick data file in bytes
+static const uint32 MaxSlabSize		   = 0x7FFFFFFF;		// Maximum size of one brick layer of slices in bytes
+static const uint32 MinNumOfCacheSlots = 8;					// Minimum number of brick cache slots, independent of the memory budget
+
+
+//[-------------------------------------------------------]
+//[ Local functions                                       ]
+//[-------------------------------------------------------]
+/**
+*  @brief
+*    Returns whether or not the given brick size is supported
+*/
+static inline bool IsValidBrickSize(uint32 nBrickSize)
+{
+	return (nBrickSize >= 8 && nBrickSize <= 128 && Math::IsPowerOfTwo(nBrickSize));
+}
+
+/**
+*  @brief
+*    Downsamples a brick into one octant of another brick by averaging 2x2x2 voxels
+*/
+template <typename TYPE>
+static void DownsampleOctant(const TYPE *pSource, TYPE *pDestination, uint32 nBrickSize, const Vector3i &vOffset)
+{
+	const uint32 nHalfSize  = nBrickSize/2;
+	const uint32 nSliceSize = nBrickSize*nBrickSize;
+	for (uint32 z=0; z<nHalfSize; z++) {
+		for (uint32 y=0; y<nHalfSize; y++) {
+			// The four source rows of the current destination row
+			const TYPE *pSource0 = pSource + (z*2)*nSliceSize + (y*2)*nBrickSize;
+			const TYPE *pSource1 = pSource0 + nBrickSize;
+			const TYPE *pSource2 = pSource0 + nSliceSize;
+			const TYPE *pSource3 = pSource2 + nBrickSize;
+			TYPE *pDestinationRow = pDestination + (vOffset.z + z)*nSliceSize + (vOffset.y + y)*nBrickSize + vOffset.x;
+			for (uint32 x=0; x<nHalfSize; x++) {
+				const uint32 i = x*2;
+				pDestinationRow[x] = static_cast<TYPE>((pSource0[i] + pSource0[i + 1] + pSource1[i] + pSource1[i + 1] +
+														pSource2[i] + pSource2[i + 1] + pSource3[i] + pSource3[i + 1] + 4) >> 3);
+			}
+		}
+	}
+}
+
+/**
+*  @brief
+*    Returns the minimum and the maximum voxel value of the given voxels
+*/
+template <typename TYPE>
+static void GetVoxelRange(const TYPE *pData, uint32 nNumOfVoxels, uint16 &nMinimum, uint16 &nMaximum)
+{
+	TYPE nMin = pData[0];
+	TYPE nMax = pData[0];
+	for (uint32 i=1; i<nNumOfVoxels; i++) {
+		if (nMin > pData[i])
+			nMin = pData[i];
+		else if (nMax < pData[i])
+			nMax = pData[i];
+	}
+	nMinimum = nMin;
+	nMaximum = nMax;
+}
+
+
+//[-------------------------------------------------------]
+//[ Public functions                                      ]
+//[-------------------------------------------------------]
+/**
+*  @brief
+*    Default constructor
+*/
+BrickedVolume::BrickedVolume() :
+	m_nBytesPerVoxel(0),
+	m_nBrickSize(0),
+	m_nBrickDataSize(0),
+	m_pLevels(nullptr),
+	m_nNumOfLevels(0),
+	m_nNumOfBricks(0),
+	m_pnBrickRanges(nullptr),
+	m_nBricksPerFile(0),
+	m_bOpen(false),
+	m_bBuilding(false),
+	m_pnSlab(nullptr),
+	m_nNumOfSlabSlices(0),
+	m_nNumOfSlices(0),
+	m_pnBrickBuffer(nullptr),
+	m_nMemoryBudget(DefaultMemoryBudget),
+	m_pCacheSlots(nullptr),
+	m_nNumOfCacheSlots(0),
+	m_nNumOfUsedSlots(0),
+	m_nMostRecentSlot(InvalidIndex),
+	m_nLeastRecentSlot(InvalidIndex),
+	m_pnBrickSlots(nullptr)
+{
+}
+
+/**
+*  @brief
+*    Destructor
+*/
+BrickedVolume::~BrickedVolume()
+{
+	Close();
+}
+
+/**
+*  @brief
+*    Opens already built brick files
+*/
+bool BrickedVolume::Open(const String &sFilename, uint64 nSourceModificationTime)
+{
+	// Close the previous bricked volume
+	Close();
+
+	// Are the brick files up-to-date?
+	File cFile(sFilename);
+	if (cFile.Exists() && (!nSourceModificationTime || cFile.GetModificationTime() >= nSourceModificationTime) && cFile.Open(File::FileRead)) {
+		// Read and check the header: Magic, version, width, height, depth, bytes per voxel and brick size
+		uint32 nHeader[7];
+		if (cFile.Read(nHeader, sizeof(nHeader), 1) == 1 && nHeader[0] == HeaderMagic && nHeader[1] == HeaderVersion &&
+			nHeader[2] && nHeader[3] && nHeader[4] && nHeader[2] <= 0xFFFF && nHeader[3] <= 0xFFFF && nHeader[4] <= 0xFFFF &&
+			(nHeader[5] == 1 || nHeader[5] == 2) && IsValidBrickSize(nHeader[6])) {
+			// Setup the resolution levels
+			m_sFilename = sFilename;
+			SetupLevels(Vector3i(nHeader[2], nHeader[3], nHeader[4]), nHeader[5], nHeader[6]);
+
+			// Read the brick ranges and open the brick data files
+			const uint32 nBrickRangesSize = m_nNumOfBricks*2*sizeof(uint16);
+			if (cFile.Read(m_pnBrickRanges, 1, nBrickRangesSize) == nBrickRangesSize && OpenBrickFiles(false)) {
+				// Done
+				m_bOpen = true;
+				return true;
+			}
+		}
+
+		// Error!
+		cFile.Close();
+		Close();
+	}
+
+	// Error!
+	return false;
+}
+
+/**
+*  @brief
+*    Starts building new brick files
+*/
+bool BrickedVolume::Create(const String &sFilename, const Vector3i &vSize, uint32 nBytesPerVoxel, uint32 nBrickSize)
+{
+	// Close the previous bricked volume
+	Close();
+
+	// Check the parameters, one brick layer of slices must fit into the host memory
+	if (sFilename.GetLength() && vSize.x > 0 && vSize.y > 0 && vSize.z > 0 && vSize.x <= 0xFFFF && vSize.y <= 0xFFFF && vSize.z <= 0xFFFF &&
+		(nBytesPerVoxel == 1 || nBytesPerVoxel == 2) && IsValidBrickSize(nBrickSize) &&
+		static_cast<uint64>(vSize.x)*vSize.y*nBytesPerVoxel*nBrickSize <= MaxSlabSize) {
+		// Delete the old header file first, so the brick files are never used while they are incomplete
+		m_sFilename = sFilename;
+		{
+			File cFile(m_sFilename);
+			if (cFile.Exists())
+				cFile.Delete();
+		}
+
+		// Setup the resolution levels
+		SetupLevels(vSize, nBytesPerVoxel, nBrickSize);
+
+		// Create the slab and the brick buffer
+		m_pnSlab		   = new uint8[vSize.x*vSize.y*nBytesPerVoxel*nBrickSize];
+		m_pnBrickBuffer	   = new uint8[m_nBrickDataSize];
+		m_nNumOfSlabSlices = 0;
+		m_nNumOfSlices	   = 0;
+
+		// Create the brick data files
+		if (OpenBrickFiles(true)) {
+			// Done
+			m_bBuilding = true;
+			return true;
+		}
+
+		// Error!
+		Close(true);
+	}
+
+	// Error!
+	return false;
+}
+
+/**
+*  @brief
+*    Adds slices of voxel data to the brick files which are currently being built
+*/
+bool BrickedVolume::AddSlices(const uint8 *pnData, uint32 nNumOfSlices)
+{
+	// Check the state and the number of slices
+	const Vector3i &vSize = m_pLevels ? m_pLevels[0].vSize : Vector3i::Zero;
+	if (!m_bBuilding || !pnData || m_nNumOfSlices + nNumOfSlices > static_cast<uint32>(vSize.z))
+		return false; // Error!
+
+	// Fill the slab and write it whenever it's complete
+	const uint32 nSliceSize = vSize.x*vSize.y*m_nBytesPerVoxel;
+	while (nNumOfSlices) {
+		const uint32 nNumOfCopiedSlices = Math::Min(nNumOfSlices, m_nBrickSize - m_nNumOfSlabSlices);
+		MemoryManager::Copy(m_pnSlab + m_nNumOfSlabSlices*nSliceSize, pnData, nNumOfCopiedSlices*nSliceSize);
+		pnData			   += nNumOfCopiedSlices*nSliceSize;
+		nNumOfSlices	   -= nNumOfCopiedSlices;
+		m_nNumOfSlabSlices += nNumOfCopiedSlices;
+		m_nNumOfSlices	   += nNumOfCopiedSlices;
+		if ((m_nNumOfSlabSlices == m_nBrickSize || m_nNumOfSlices == static_cast<uint32>(vSize.z)) && !WriteSlab())
+			return false; // Error!
+	}
+
+	// Done
+	return true;
+}
+
+/**
+*  @brief
+*    Finishes building the brick files
+*/
+bool BrickedVolume::Finish()
+{
+	// Check the state
+	if (!m_bBuilding)
+		return false; // Error!
+
+	// Were all slices added?
+	bool bResult = (m_nNumOfSlices == static_cast<uint32>(m_pLevels[0].vSize.z));
+
+	// The slab is no longer required
+	delete [] m_pnSlab;
+	m_pnSlab = nullptr;
+
+	// Build the further resolution levels
+	for (uint32 nLevel=1; nLevel<m_nNumOfLevels && bResult; nLevel++)
+		bResult = BuildLevel(nLevel);
+	delete [] m_pnBrickBuffer;
+	m_pnBrickBuffer = nullptr;
+	m_bBuilding = false;
+
+	// Write the header (as last file) and reopen the brick data files for reading
+	CloseBrickFiles(false);
+	if (bResult && WriteHeader() && OpenBrickFiles(false)) {
+		// Done
+		m_bOpen = true;
+		return true;
+	}
+
+	// Error!
+	Close(true);
+	return false;
+}
+
+/**
+*  @brief
+*    Loads a bricked volume from a raw voxel file
+*/
+bool BrickedVolume::Load(File &cFile, const Vector3i &vSize, uint32 nBytesPerVoxel)
+{
+	// Get the filename of the brick files
+	const String sFilename = cFile.GetUrl().GetUrl() + ".bricks";
+
+	// Reuse up-to-date brick files (only if the modification time of the raw voxel file is known)
+	const uint64 nModificationTime = cFile.GetModificationTime();
+	if (nModificationTime && Open(sFilename, nModificationTime) && GetSize() == vSize && m_nBytesPerVoxel == nBytesPerVoxel)
+		return true; // Done
+
+	// Build the brick files, the slices are directly read into the slab
+	const int32 nPosition = cFile.Tell();
+	if (Create(sFilename, vSize, nBytesPerVoxel)) {
+		const uint32 nSliceSize = vSize.x*vSize.y*nBytesPerVoxel;
+		bool bResult = true;
+		while (bResult && m_nNumOfSlices < static_cast<uint32>(vSize.z)) {
+			const uint32 nNumOfSlabSlices = Math::Min(m_nBrickSize, vSize.z - m_nNumOfSlices);
+			if (cFile.Read(m_pnSlab, nSliceSize, nNumOfSlabSlices) == nNumOfSlabSlices) {
+				m_nNumOfSlabSlices  = nNumOfSlabSlices;
+				m_nNumOfSlices	   += nNumOfSlabSlices;
+				bResult = WriteSlab();
+			} else {
+				// Error!
+				bResult = false;
+			}
+		}
+		if (bResult && Finish())
+			return true; // Done
+
+		// Error!
+		Close(true);
+	}
+
+	// Error!
+	cFile.Seek(nPosition);
+	return false;
+}
+
+/**
+*  @brief
+*    Closes the bricked volume
+*/
+void BrickedVolume::Close(bool bDeleteFiles)
+{
+	// Close the brick data files
+	CloseBrickFiles(bDeleteFiles);
+
+	// Delete the header file
+	if (bDeleteFiles && m_sFilename.GetLength()) {
+		File cFile(m_sFilename);
+		if (cFile.Exists())
+			cFile.Delete();
+	}
+
+	// Free the brick cache
+	FreeCache();
+	if (m_pnBrickSlots) {
+		delete [] m_pnBrickSlots;
+		m_pnBrickSlots = nullptr;
+	}
+
+	// Free the building buffers
+	if (m_pnSlab) {
+		delete [] m_pnSlab;
+		m_pnSlab = nullptr;
+	}
+	if (m_pnBrickBuffer) {
+		delete [] m_pnBrickBuffer;
+		m_pnBrickBuffer = nullptr;
+	}
+	m_bBuilding		   = false;
+	m_nNumOfSlabSlices = 0;
+	m_nNumOfSlices	   = 0;
+
+	// Free the resolution levels
+	if (m_pLevels) {
+		delete [] m_pLevels;
+		m_pLevels = nullptr;
+	}
+	if (m_pnBrickRanges) {
+		delete [] m_pnBrickRanges;
+		m_pnBrickRanges = nullptr;
+	}
+	m_sFilename		 = "";
+	m_nBytesPerVoxel = 0;
+	m_nBrickSize	 = 0;
+	m_nBrickDataSize = 0;
+	m_nNumOfLevels	 = 0;
+	m_nNumOfBricks	 = 0;
+	m_nBricksPerFile = 0;
+	m_bOpen			 = false;
+}
+
+/**
+*  @brief
+*    Returns the minimum and maximum voxel value of a brick
+*/
+bool BrickedVolume::GetBrickRange(uint32 nLevel, const Vector3i &vBrick, uint32 &nMinimum, uint32 &nMaximum) const
+{
+	// Get the brick index
+	const uint32 nBrick = GetBrickIndex(nLevel, vBrick);
+	if (nBrick == InvalidIndex)
+		return false; // Error!
+
+	// Get the brick range
+	nMinimum = m_pnBrickRanges[nBrick*2];
+	nMaximum = m_pnBrickRanges[nBrick*2 + 1];
+
+	// Done
+	return true;
+}
+
+/**
+*  @brief
+*    Returns the data of a brick
+*/
+const uint8 *BrickedVolume::GetBrick(uint32 nLevel, const Vector3i &vBrick)
+{
+	// Get the brick index
+	const uint32 nBrick = GetBrickIndex(nLevel, vBrick);
+	if (nBrick == InvalidIndex || !m_pCacheSlots || !m_lstFiles.GetNumOfElements())
+		return nullptr; // Error!
+
+	// Is the brick already cached?
+	uint32 nSlot = m_pnBrickSlots[nBrick];
+	if (nSlot == InvalidIndex) {
+		// Use a free brick cache slot or replace the least recently used brick
+		if (m_nNumOfUsedSlots < m_nNumOfCacheSlots) {
+			nSlot = m_nNumOfUsedSlots++;
+			m_pCacheSlots[nSlot].pnData = new uint8[m_nBrickDataSize];
+		} else {
+			nSlot = m_nLeastRecentSlot;
+			UnlinkSlot(nSlot);
+			if (m_pCacheSlots[nSlot].nBrick != InvalidIndex)
+				m_pnBrickSlots[m_pCacheSlots[nSlot].nBrick] = InvalidIndex;
+		}
+		CacheSlot &sSlot = m_pCacheSlots[nSlot];
+
+		// Load the brick
+		if (!ReadBrick(nBrick, sSlot.pnData)) {
+			// Error! -> The slot is the first one to be used again
+			sSlot.nBrick = InvalidIndex;
+			LinkSlot(nSlot, false);
+			return nullptr;
+		}
+		sSlot.nBrick = nBrick;
+		m_pnBrickSlots[nBrick] = nSlot;
+		LinkSlot(nSlot, true);
+	} else if (nSlot != m_nMostRecentSlot) {
+		// The brick is now the most recently used one
+		UnlinkSlot(nSlot);
+		LinkSlot(nSlot, true);
+	}
+
+	// Done
+	return m_pCacheSlots[nSlot].pnData;
+}
+
+/**
+*  @brief
+*    Copies a complete resolution level brick by brick into a linear buffer
+*/
+bool BrickedVolume::CopyLevel(uint32 nLevel, uint8 *pnDestination)
+{
+	// Check the parameters
+	if (!m_bOpen || nLevel >= m_nNumOfLevels || !pnDestination)
+		return false; // Error!
+
+	// Copy the valid region of each brick row by row
+	const Level &sLevel = m_pLevels[nLevel];
+	const int	 nBrickSize	   = static_cast<int>(m_nBrickSize);
+	const uint32 nBrickRowSize = m_nBrickSize*m_nBytesPerVoxel;
+	const uint32 nRowSize	   = sLevel.vSize.x*m_nBytesPerVoxel;
+	const uint64 nSliceSize	   = static_cast<uint64>(nRowSize)*sLevel.vSize.y;
+	Vector3i vBrick;
+	for (vBrick.z=0; vBrick.z<sLevel.vNumOfBricks.z; vBrick.z++) {
+		for (vBrick.y=0; vBrick.y<sLevel.vNumOfBricks.y; vBrick.y++) {
+			for (vBrick.x=0; vBrick.x<sLevel.vNumOfBricks.x; vBrick.x++) {
+				// Get the brick
+				const uint8 *pnBrick = GetBrick(nLevel, vBrick);
+				if (!pnBrick)
+					return false; // Error!
+
+				// Copy the valid region
+				const Vector3i vStart(vBrick.x*nBrickSize, vBrick.y*nBrickSize, vBrick.z*nBrickSize);
+				const Vector3i vValid(Math::Min(nBrickSize, sLevel.vSize.x - vStart.x),
+									  Math::Min(nBrickSize, sLevel.vSize.y - vStart.y),
+									  Math::Min(nBrickSize, sLevel.vSize.z - vStart.z));
+				for (int z=0; z<vValid.z; z++) {
+					for (int y=0; y<vValid.y; y++) {
+						MemoryManager::Copy(pnDestination + (vStart.z + z)*nSliceSize + (vStart.y + y)*nRowSize + vStart.x*m_nBytesPerVoxel,
+											pnBrick + (z*m_nBrickSize + y)*nBrickRowSize, vValid.x*m_nBytesPerVoxel);
+					}
+				}
+			}
+		}
+	}
+
+	// Done
+	return true;
+}
+
+/**
+*  @brief
+*    Sets the brick cache memory budget
+*/
+void BrickedVolume::SetMemoryBudget(uint32 nMemoryBudget)
+{
+	m_nMemoryBudget = nMemoryBudget;
+	ResetCache();
+}
+
+
+//[-------------------------------------------------------]
+//[ Private functions                                     ]
+//[-------------------------------------------------------]
+/**
+*  @brief
+*    Copy constructor
+*/
+BrickedVolume::BrickedVolume(const BrickedVolume &cSource) :
+	m_nBytesPerVoxel(0),
+	m_nBrickSize(0),
+	m_nBrickDataSize(0),
+	m_pLevels(nullptr),
+	m_nNumOfLevels(0),
+	m_nNumOfBricks(0),
+	m_pnBrickRanges(nullptr),
+	m_nBricksPerFile(0),
+	m_bOpen(false),
+	m_bBuilding(false),
+	m_pnSlab(nullptr),
+	m_nNumOfSlabSlices(0),
+	m_nNumOfSlices(0),
+	m_pnBrickBuffer(nullptr),
+	m_nMemoryBudget(DefaultMemoryBudget),
+	m_pCacheSlots(nullptr),
+	m_nNumOfCacheSlots(0),
+	m_nNumOfUsedSlots(0),
+	m_nMostRecentSlot(InvalidIndex),
+	m_nLeastRecentSlot(InvalidIndex),
+	m_pnBrickSlots(nullptr)
+{
+	// No implementation because the copy constructor is never used
+}
+
+/**
+*  @brief
+*    Copy operator
+*/
+BrickedVolume &BrickedVolume::operator =(const BrickedVolume &cSource)
+{
+	// No implementation because the copy operator is never used
+	return *this;
+}
+
+/**
+*  @brief
+*    Sets up the resolution levels
+*/
+void BrickedVolume::SetupLevels(const Vector3i &vSize, uint32 nBytesPerVoxel, uint32 nBrickSize)
+{
+	m_nBytesPerVoxel = nBytesPerVoxel;
+	m_nBrickSize	 = nBrickSize;
+	m_nBrickDataSize = nBrickSize*nBrickSize*nBrickSize*nBytesPerVoxel;
+
+	// Get the number of resolution levels, each level has half the resolution of the previous one until it fits into one brick
+	const int nSize = static_cast<int>(nBrickSize);
+	Vector3i vLevelSize = vSize;
+	m_nNumOfLevels = 1;
+	while (vLevelSize.x > nSize || vLevelSize.y > nSize || vLevelSize.z > nSize) {
+		vLevelSize.x = (vLevelSize.x + 1)/2;
+		vLevelSize.y = (vLevelSize.y + 1)/2;
+		vLevelSize.z = (vLevelSize.z + 1)/2;
+		m_nNumOfLevels++;
+	}
+
+	// Setup the resolution levels
+	m_pLevels	   = new Level[m_nNumOfLevels];
+	m_nNumOfBricks = 0;
+	vLevelSize	   = vSize;
+	for (uint32 nLevel=0; nLevel<m_nNumOfLevels; nLevel++) {
+		Level &sLevel = m_pLevels[nLevel];
+		sLevel.vSize		  = vLevelSize;
+		sLevel.vNumOfBricks.x = (vLevelSize.x + nSize - 1)/nSize;
+		sLevel.vNumOfBricks.y = (vLevelSize.y + nSize - 1)/nSize;
+		sLevel.vNumOfBricks.z = (vLevelSize.z + nSize - 1)/nSize;
+		sLevel.nFirstBrick	  = m_nNumOfBricks;
+		m_nNumOfBricks += sLevel.vNumOfBricks.x*sLevel.vNumOfBricks.y*sLevel.vNumOfBricks.z;
+		vLevelSize.x = (vLevelSize.x + 1)/2;
+		vLevelSize.y = (vLevelSize.y + 1)/2;
+		vLevelSize.z = (vLevelSize.z + 1)/2;
+	}
+
+	// Create the brick ranges
+	m_pnBrickRanges = new uint16[m_nNumOfBricks*2];
+	MemoryManager::Set(m_pnBrickRanges, 0, m_nNumOfBricks*2*sizeof(uint16));
+
+	// Get the number of bricks per brick data file
+	m_nBricksPerFile = Math::Max(MaxBrickFileSize/m_nBrickDataSize, 1U);
+
+	// Setup the brick cache
+	m_pnBrickSlots = new uint32[m_nNumOfBricks];
+	ResetCache();
+}
+
+/**
+*  @brief
+*    Returns the index of a brick
+*/
+uint32 BrickedVolume::GetBrickIndex(uint32 nLevel, const Vector3i &vBrick) const
+{
+	// Check the resolution level and the brick position
+	if (nLevel >= m_nNumOfLevels)
+		return InvalidIndex; // Error!
+	const Level &sLevel = m_pLevels[nLevel];
+	if (vBrick.x < 0 || vBrick.y < 0 || vBrick.z < 0 || vBrick.x >= sLevel.vNumOfBricks.x || vBrick.y >= sLevel.vNumOfBricks.y || vBrick.z >= sLevel.vNumOfBricks.z)
+		return InvalidIndex; // Error!
+
+	// Return the brick index
+	return sLevel.nFirstBrick + (vBrick.z*sLevel.vNumOfBricks.y + vBrick.y)*sLevel.vNumOfBricks.x + vBrick.x;
+}
+
+/**
+*  @brief
+*    Returns the filename of a brick data file
+*/
+String BrickedVolume::GetBrickFilename(uint32 nFile) const
+{
+	return m_sFilename + '.' + nFile;
+}
+
+/**
+*  @brief
+*    Opens the brick data files
+*/
+bool BrickedVolume::OpenBrickFiles(bool bWrite)
+{
+	const uint32 nNumOfFiles = (m_nNumOfBricks + m_nBricksPerFile - 1)/m_nBricksPerFile;
+	for (uint32 nFile=0; nFile<nNumOfFiles; nFile++) {
+		File *pFile = new File(GetBrickFilename(nFile));
+		m_lstFiles.Add(pFile);
+		if (bWrite) {
+			// Create the brick data file, it's read while the further resolution levels are built
+			if (!pFile->Open(File::FileCreate | File::FileWrite | File::FileRead))
+				return false; // Error!
+		} else {
+			// Map the brick data file into memory, if this is not possible don't keep a copy of the complete file within the host memory
+			if (!pFile->Open(File::FileRead | File::FileMemMapOnly) && !pFile->Open(File::FileRead))
+				return false; // Error!
+
+			// Check the size of the brick data file
+			const uint32 nNumOfFileBricks = (nFile < nNumOfFiles - 1) ? m_nBricksPerFile : (m_nNumOfBricks - nFile*m_nBricksPerFile);
+			if (pFile->GetSize() != nNumOfFileBricks*m_nBrickDataSize)
+				return false; // Error!
+		}
+	}
+
+	// Done
+	return true;
+}
+
+/**
+*  @brief
+*    Closes the brick data files
+*/
+void BrickedVolume::CloseBrickFiles(bool bDelete)
+{
+	for (uint32 i=0; i<m_lstFiles.GetNumOfElements(); i++) {
+		File *pFile = m_lstFiles[i];
+		pFile->Close();
+		if (bDelete && pFile->Exists())
+			pFile->Delete();
+		delete pFile;
+	}
+	m_lstFiles.Clear();
+}
+
+/**
+*  @brief
+*    Reads the data of a brick from the brick data files
+*/
+bool BrickedVolume::ReadBrick(uint32 nBrick, uint8 *pnData)
+{
+	// Get the brick data file and the brick offset within it
+	File *pFile = m_lstFiles[nBrick/m_nBricksPerFile];
+	const uint32 nOffset = (nBrick%m_nBricksPerFile)*m_nBrickDataSize;
+
+	// Copy the brick from the memory mapping, the mapping itself is not used as brick cache because the
+	// operating system may page out the mapped bricks at any time which makes the memory budget useless
+	const uint8 *pnMemoryBuffer = pFile->GetMemoryBuffer();
+	if (pnMemoryBuffer) {
+		if (nOffset + m_nBrickDataSize > pFile->GetSize())
+			return false; // Error!
+		MemoryManager::Copy(pnData, pnMemoryBuffer + nOffset, m_nBrickDataSize);
+		return true;
+	}
+
+	// Read the brick
+	return (pFile->Seek(static_cast<int32>(nOffset)) && pFile->Read(pnData, 1, m_nBrickDataSize) == m_nBrickDataSize);
+}
+
+/**
+*  @brief
+*    Writes the data of a brick into the brick data files and updates the brick range
+*/
+bool BrickedVolume::WriteBrick(uint32 nBrick, const uint8 *pnData)
+{
+	// Update the brick range
+	uint16 &nMinimum = m_pnBrickRanges[nBrick*2];
+	uint16 &nMaximum = m_pnBrickRanges[nBrick*2 + 1];
+	if (m_nBytesPerVoxel == 1)
+		GetVoxelRange(pnData, m_nBrickDataSize, nMinimum, nMaximum);
+	else
+		GetVoxelRange(reinterpret_cast<const uint16*>(pnData), m_nBrickDataSize/2, nMinimum, nMaximum);
+
+	// Write the brick
+	File *pFile = m_lstFiles[nBrick/m_nBricksPerFile];
+	const uint32 nOffset = (nBrick%m_nBricksPerFile)*m_nBrickDataSize;
+	return (pFile->Seek(static_cast<int32>(nOffset)) && pFile->Write(pnData, 1, m_nBrickDataSize) == m_nBrickDataSize);
+}
+
+/**
+*  @brief
+*    Splits the slab of the original resolution into bricks and writes them
+*/
+bool BrickedVolume::WriteSlab()
+{
+	const Level &sLevel = m_pLevels[0];
+	const int	 nBrickSize	   = static_cast<int>(m_nBrickSize);
+	const uint32 nBrickRowSize = m_nBrickSize*m_nBytesPerVoxel;
+	const uint32 nRowSize	   = sLevel.vSize.x*m_nBytesPerVoxel;
+	const uint32 nSliceSize	   = nRowSize*sLevel.vSize.y;
+
+	// The slab is the last brick layer added so far
+	Vector3i vBrick(0, 0, static_cast<int>((m_nNumOfSlices - 1)/m_nBrickSize));
+	for (vBrick.y=0; vBrick.y<sLevel.vNumOfBricks.y; vBrick.y++) {
+		for (vBrick.x=0; vBrick.x<sLevel.vNumOfBricks.x; vBrick.x++) {
+			// Copy the valid region of the brick row by row
+			const int nStartX = vBrick.x*nBrickSize;
+			const int nStartY = vBrick.y*nBrickSize;
+			const Vector3i vValid(Math::Min(nBrickSize, sLevel.vSize.x - nStartX), Math::Min(nBrickSize, sLevel.vSize.y - nStartY), static_cast<int>(m_nNumOfSlabSlices));
+			for (int z=0; z<vValid.z; z++) {
+				for (int y=0; y<vValid.y; y++)
+					MemoryManager::Copy(m_pnBrickBuffer + (z*nBrickSize + y)*nBrickRowSize, m_pnSlab + z*nSliceSize + (nStartY + y)*nRowSize + nStartX*m_nBytesPerVoxel, vValid.x*m_nBytesPerVoxel);
+			}
+
+			// Pad and write the brick
+			PadBrick(m_pnBrickBuffer, vValid);
+			if (!WriteBrick(GetBrickIndex(0, vBrick), m_pnBrickBuffer))
+				return false; // Error!
+		}
+	}
+
+	// The slab is empty again
+	m_nNumOfSlabSlices = 0;
+
+	// Done
+	return true;
+}
+
+/**
+*  @brief
+*    Builds a resolution level by downsampling the previous resolution level
+*/
+bool BrickedVolume::BuildLevel(uint32 nLevel)
+{
+	const Level &sLevel		  = m_pLevels[nLevel];
+	const Level &sSourceLevel = m_pLevels[nLevel - 1];
+	const int	 nBrickSize	  = static_cast<int>(m_nBrickSize);
+	const int	 nHalfSize	  = nBrickSize/2;
+	Vector3i vBrick;
+	for (vBrick.z=0; vBrick.z<sLevel.vNumOfBricks.z; vBrick.z++) {
+		for (vBrick.y=0; vBrick.y<sLevel.vNumOfBricks.y; vBrick.y++) {
+			for (vBrick.x=0; vBrick.x<sLevel.vNumOfBricks.x; vBrick.x++) {
+				// Each of the up to eight source bricks covers one octant of the brick, octants without a source
+				// brick are outside of the volume and are filled by the padding
+				Vector3i vOctant;
+				for (vOctant.z=0; vOctant.z<2; vOctant.z++) {
+					for (vOctant.y=0; vOctant.y<2; vOctant.y++) {
+						for (vOctant.x=0; vOctant.x<2; vOctant.x++) {
+							const Vector3i vSourceBrick(vBrick.x*2 + vOctant.x, vBrick.y*2 + vOctant.y, vBrick.z*2 + vOctant.z);
+							if (vSourceBrick.x < sSourceLevel.vNumOfBricks.x && vSourceBrick.y < sSourceLevel.vNumOfBricks.y && vSourceBrick.z < sSourceLevel.vNumOfBricks.z) {
+								// Get the source brick, the border of the source level is padded so there's no special border handling required
+								const uint8 *pnSource = GetBrick(nLevel - 1, vSourceBrick);
+								if (!pnSource)
+									return false; // Error!
+
+								// Downsample the source brick into the octant
+								const Vector3i vOffset(vOctant.x*nHalfSize, vOctant.y*nHalfSize, vOctant.z*nHalfSize);
+								if (m_nBytesPerVoxel == 1)
+									DownsampleOctant(pnSource, m_pnBrickBuffer, m_nBrickSize, vOffset);
+								else
+									DownsampleOctant(reinterpret_cast<const uint16*>(pnSource), reinterpret_cast<uint16*>(m_pnBrickBuffer), m_nBrickSize, vOffset);
+							}
+						}
+					}
+				}
+
+				// Pad and write the brick
+				const Vector3i vStart(vBrick.x*nBrickSize, vBrick.y*nBrickSize, vBrick.z*nBrickSize);
+				PadBrick(m_pnBrickBuffer, Vector3i(Math::Min(nBrickSize, sLevel.vSize.x - vStart.x),
+												   Math::Min(nBrickSize, sLevel.vSize.y - vStart.y),
+												   Math::Min(nBrickSize, sLevel.vSize.z - vStart.z)));
+				if (!WriteBrick(GetBrickIndex(nLevel, vBrick), m_pnBrickBuffer))
+					return false; // Error!
+			}
+		}
+	}
+
+	// Done
+	return true;
+}
+
+/**
+*  @brief
+*    Pads a brick by repeating the border voxels of the valid brick region
+*/
+void BrickedVolume::PadBrick(uint8 *pnData, const Vector3i &vValid) const
+{
+	const int	 nBrickSize	   = static_cast<int>(m_nBrickSize);
+	const uint32 nRowSize	   = m_nBrickSize*m_nBytesPerVoxel;
+	const uint32 nSliceSize	   = nRowSize*m_nBrickSize;
+	const uint32 nValidRowSize = vValid.x*m_nBytesPerVoxel;
+
+	// Repeat the last valid voxel of each valid row
+	if (vValid.x < nBrickSize) {
+		for (int z=0; z<vValid.z; z++) {
+			for (int y=0; y<vValid.y; y++) {
+				uint8 *pnRow = pnData + z*nSliceSize + y*nRowSize;
+				for (uint32 nOffset=nValidRowSize; nOffset<nRowSize; nOffset+=m_nBytesPerVoxel)
+					MemoryManager::Copy(pnRow + nOffset, pnRow + nValidRowSize - m_nBytesPerVoxel, m_nBytesPerVoxel);
+			}
+		}
+	}
+
+	// Repeat the last valid row of each valid slice
+	for (int z=0; z<vValid.z; z++) {
+		uint8 *pnSlice = pnData + z*nSliceSize;
+		for (int y=vValid.y; y<nBrickSize; y++)
+			MemoryManager::Copy(pnSlice + y*nRowSize, pnSlice + (vValid.y - 1)*nRowSize, nRowSize);
+	}
+
+	// Repeat the last valid slice
+	for (int z=vValid.z; z<nBrickSize; z++)
+		MemoryManager::Copy(pnData + z*nSliceSize, pnData + (vValid.z - 1)*nSliceSize, nSliceSize);
+}
+
+/**
+*  @brief
+*    Writes the header file
+*/
+bool BrickedVolume::WriteHeader() const
+{
+	File cFile(m_sFilename);
+	if (cFile.Open(File::FileCreate | File::FileWrite)) {
+		// Write the header: Magic, version, width, height, depth, bytes per voxel and brick size
+		const Vector3i &vSize = m_pLevels[0].vSize;
+		const uint32 nHeader[7] = { HeaderMagic, HeaderVersion, static_cast<uint32>(vSize.x), static_cast<uint32>(vSize.y), static_cast<uint32>(vSize.z), m_nBytesPerVoxel, m_nBrickSize };
+
+		// Write the header and the brick ranges
+		const uint32 nBrickRangesSize = m_nNumOfBricks*2*sizeof(uint16);
+		return (cFile.Write(nHeader, sizeof(nHeader), 1) == 1 && cFile.Write(m_pnBrickRanges, 1, nBrickRangesSize) == nBrickRangesSize);
+	}
+
+	// Error!
+	return false;
+}
+
+/**
+*  @brief
+*    Discards all cached bricks and sets up the brick cache slots
+*/
+void BrickedVolume::ResetCache()
+{
+	// Free the previous brick cache
+	FreeCache();
+
+	// Setup the brick cache slots, at least a few bricks are always cached and there's no need for more slots than bricks
+	if (m_nNumOfBricks) {
+		m_nNumOfCacheSlots = Math::Min(Math::Max(m_nMemoryBudget/m_nBrickDataSize, MinNumOfCacheSlots), m_nNumOfBricks);
+		m_pCacheSlots	   = new CacheSlot[m_nNumOfCacheSlots];
+		for (uint32 i=0; i<m_nNumOfCacheSlots; i++) {
+			CacheSlot &sSlot = m_pCacheSlots[i];
+			sSlot.pnData	= nullptr;
+			sSlot.nBrick	= InvalidIndex;
+			sSlot.nPrevious	= InvalidIndex;
+			sSlot.nNext		= InvalidIndex;
+		}
+		for (uint32 i=0; i<m_nNumOfBricks; i++)
+			m_pnBrickSlots[i] = InvalidIndex;
+	}
+}
+
+/**
+*  @brief
+*    Frees the brick cache
+*/
+void BrickedVolume::FreeCache()
+{
+	if (m_pCacheSlots) {
+		for (uint32 i=0; i<m_nNumOfUsedSlots; i++)
+			delete [] m_pCacheSlots[i].pnData;
+		delete [] m_pCacheSlots;
+		m_pCacheSlots = nullptr;
+	}
+	m_nNumOfCacheSlots = 0;
+	m_nNumOfUsedSlots  = 0;
+	m_nMostRecentSlot  = InvalidIndex;
+	m_nLeastRecentSlot = InvalidIndex;
+}
+
+/**
+*  @brief
+*    Links a brick cache slot
+*/
+void BrickedVolume::LinkSlot(uint32 nSlot, bool bMostRecent)
+{
+	CacheSlot &sSlot = m_pCacheSlots[nSlot];
+	if (bMostRecent) {
+		sSlot.nPrevious = InvalidIndex;
+		sSlot.nNext		= m_nMostRecentSlot;
+		if (m_nMostRecentSlot != InvalidIndex)
+			m_pCacheSlots[m_nMostRecentSlot].nPrevious = nSlot;
+		else
+			m_nLeastRecentSlot = nSlot;
+		m_nMostRecentSlot = nSlot;
+	} else {
+		sSlot.nPrevious = m_nLeastRecentSlot;
+		sSlot.nNext		= InvalidIndex;
+		if (m_nLeastRecentSlot != InvalidIndex)
+			m_pCacheSlots[m_nLeastRecentSlot].nNext = nSlot;
+		else
+			m_nMostRecentSlot = nSlot;
+		m_nLeastRecentSlot = nSlot;
+	}
+}
+
+/**
+*  @brief
+*    Unlinks a brick cache slot
+*/
+void BrickedVolume::UnlinkSlot(uint32 nSlot)
+{
+	CacheSlot &sSlot = m_pCacheSlots[nSlot];
+	if (sSlot.nPrevious != InvalidIndex)
+		m_pCacheSlots[sSlot.nPrevious].nNext = sSlot.nNext;
+	else
+		m_nMostRecentSlot = sSlot.nNext;
+	if (sSlot.nNext != InvalidIndex)
+		m_pCacheSlots[sSlot.nNext].nPrevious = sSlot.nPrevious;
+	else
+		m_nLeastRecentSlot = sSlot.nPrevious;
+	sSlot.nPrevious = InvalidIndex;
+	sSlot.nNext		= InvalidIndex;
+}
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+} // PLVolume
@@ -31,6 +31,7 @@
 #include <PLGraphics/Image/ImagePart.h>
 #include <PLGraphics/Image/ImageBuffer.h>
 #include "PLVolume/Volume.h"
+#include "PLVolume/BrickedVolume.h"
 #include "PLVolume/TransferFunction.h"
 #include "PLVolume/Loader/VolumeLoaderDAT.h"
 
@@ -153,12 +154,17 @@ bool VolumeLoaderDAT::Load(Volume &cVolume, File &cFile)
 		// Open the raw file
 		File cRawFile(sRawFilename);
 		if (cRawFile.Open(File::FileRead)) {
-			// Create image buffer
-			ImageBuffer *pImageBuffer = cImage.CreatePart()->CreateMipmap();
-			pImageBuffer->CreateImage(nFormat, ColorGrayscale, vResolution);
-
-			// Read the data
-			cRawFile.Read(pImageBuffer->GetData(), 1, pImageBuffer->GetDataSize());
+			// Huge volume? If so, stream it slice by slice into the bricked volume instead of reading it at once.
+			const uint32 nBytesPerVoxel = (nFormat == DataByte) ? 1 : 2;
+			if (static_cast<uint64>(vResolution.x)*vResolution.y*vResolution.z*nBytesPerVoxel <= cVolume.GetBrickingThreshold() ||
+				!cVolume.GetBrickedVolume().Load(cRawFile, vResolution, nBytesPerVoxel)) {
+				// Create image buffer
+				ImageBuffer *pImageBuffer = cImage.CreatePart()->CreateMipmap();
+				pImageBuffer->CreateImage(nFormat, ColorGrayscale, vResolution);
+
+				// Read the data
+				cRawFile.Read(pImageBuffer->GetData(), 1, pImageBuffer->GetDataSize());
+			}
 
 			// Load the transfer function by using "<filename>.table", or at least try it
 			cVolume.GetTransferFunction().LoadByFilename(cFile.GetUrl().CutExtension() + ".table");
@@ -31,6 +31,7 @@
 #include <PLGraphics/Image/ImagePart.h>
 #include <PLGraphics/Image/ImageBuffer.h>
 #include "PLVolume/Volume.h"
+#include "PLVolume/BrickedVolume.h"
 #include "PLVolume/Loader/VolumeLoaderRAW.h"
 
 
@@ -54,6 +55,14 @@ pl_implement_class(VolumeLoaderRAW)
 //[-------------------------------------------------------]
 bool VolumeLoaderRAW::LoadParams(Volume &cVolume, File &cFile, uint8 nDataType, uint16 nWidth, uint16 nHeight, uint16 nDepth)
 {
+	// Huge 8 bit or 16 bit volume? If so, stream it slice by slice into the bricked volume instead of reading it at once.
+	if (nDataType == DataByte || nDataType == DataWord) {
+		const uint32 nBytesPerVoxel = (nDataType == DataByte) ? 1 : 2;
+		if (static_cast<uint64>(nWidth)*nHeight*nDepth*nBytesPerVoxel > cVolume.GetBrickingThreshold() &&
+			cVolume.GetBrickedVolume().Load(cFile, Vector3i(nWidth, nHeight, nDepth), nBytesPerVoxel))
+			return true; // Done
+	}
+
 	// Get the image holding the volumetric data
 	Image &cImage = cVolume.GetVolumeImage();
 
@@ -53,63 +53,98 @@ void Histogram::Create(uint32 nNumOfBytesPerElement, uint32 nNumOfElements, cons
 {
 	// Check number of bytes per element (pixel/voxel), must be 1 or 2
 	if (nNumOfBytesPerElement == 1 || nNumOfBytesPerElement == 2) {
-		// Initialize minimum and maximum value encountered while creating the histogram
-		m_fMinScalarValue = (nNumOfBytesPerElement == 1) ? 256.0f : 65536.0f;
-		m_fMaxScalarValue = 0.0f;
+		// No elements, yet
+		m_nNumOfElements = 0;
+		m_fMinScalarValue = m_fMaxScalarValue = 0.0f;
 
-		// Initialize the minimum and maximum value within the histogram
-		m_fMinValue = -1.0f;
-		m_fMaxValue = -1.0f;
+		// Allocate the array
+		m_lstData.Resize((nNumOfBytesPerElement == 1) ? 256 : 65536, true, true);
 
-		// Bin with the highest value not initialized, yet
-		m_nBinWithHighestValue = -1;
+		// Initialize the cached values
+		InvalidateCachedValues();
 
-		// Not normalized, yet
-		m_bNormalized = false;
+		// Evaluate luminance data to create the histogram data from
+		Add(nNumOfElements, pnData);
+	}
+}
 
-		// Allocate the array
-		m_lstData.Resize((nNumOfBytesPerElement == 1) ? 256 : 65536, true, true);
+/**
+*  @brief
+*    Adds luminance data (= one component per element) to the histogram data
+*/
+void Histogram::Add(uint32 nNumOfElements, const uint8 *pnData)
+{
+	// Evaluate luminance data to add to the histogram data, must be valid!
+	const uint32 nNumOfBins = m_lstData.GetNumOfElements();
+	if (nNumOfElements && pnData && nNumOfBins) {
+		// Initialize minimum and maximum value encountered while creating the histogram
+		if (!m_nNumOfElements) {
+			m_fMinScalarValue = static_cast<float>(nNumOfBins);
+			m_fMaxScalarValue = 0.0f;
+		}
 
-		// Evaluate luminance data to create the histogram data from, must be valid!
-		if (nNumOfElements && pnData) {
-			float *pfHistogram = m_lstData.GetData();
-			if (nNumOfBytesPerElement == 1) {
-				// One byte per element
-				const uint8 *pnDataEnd = pnData + nNumOfElements;
-				for (const uint8 *pnCurrentData=pnData; pnCurrentData<pnDataEnd; pnCurrentData++) {
-					// Get the current value
-					const uint32 nValue = *pnCurrentData;
-
-					// Update minimum and maximum value encountered while creating the histogram
-					if (m_fMinScalarValue > nValue)
-						m_fMinScalarValue = static_cast<float>(nValue);
-					if (m_fMaxScalarValue < nValue)
-						m_fMaxScalarValue = static_cast<float>(nValue);
-
-					// Update the histogram
-					pfHistogram[nValue] += 1.0f;
-				}
-			} else {
-				// Two bytes per element
-				const uint16 *pnDataEnd = reinterpret_cast<const uint16*>(pnData) + nNumOfElements;
-				for (const uint16 *pnCurrentData=reinterpret_cast<const uint16*>(pnData); pnCurrentData<pnDataEnd; pnCurrentData++) {
-					// Get the current value
-					const uint32 nValue = *pnCurrentData;
-
-					// Update minimum and maximum value encountered while creating the histogram
-					if (m_fMinScalarValue > nValue)
-						m_fMinScalarValue = static_cast<float>(nValue);
-					if (m_fMaxScalarValue < nValue)
-						m_fMaxScalarValue = static_cast<float>(nValue);
-
-					// Update the histogram
-					pfHistogram[nValue] += 1.0f;
-				}
+		// Evaluate luminance data
+		float *pfHistogram = m_lstData.GetData();
+		if (nNumOfBins == 256) {
+			// One byte per element
+			const uint8 *pnDataEnd = pnData + nNumOfElements;
+			for (const uint8 *pnCurrentData=pnData; pnCurrentData<pnDataEnd; pnCurrentData++) {
+				// Get the current value
+				const uint32 nValue = *pnCurrentData;
+
+				// Update minimum and maximum value encountered while creating the histogram
+				if (m_fMinScalarValue > nValue)
+					m_fMinScalarValue = static_cast<float>(nValue);
+				if (m_fMaxScalarValue < nValue)
+					m_fMaxScalarValue = static_cast<float>(nValue);
+
+				// Update the histogram
+				pfHistogram[nValue] += 1.0f;
 			}
 		} else {
-			// Error!
-			m_fMinScalarValue = m_fMaxScalarValue = 0.0f;
+			// Two bytes per element
+			const uint16 *pnDataEnd = reinterpret_cast<const uint16*>(pnData) + nNumOfElements;
+			for (const uint16 *pnCurrentData=reinterpret_cast<const uint16*>(pnData); pnCurrentData<pnDataEnd; pnCurrentData++) {
+				// Get the current value
+				const uint32 nValue = *pnCurrentData;
+
+				// Update minimum and maximum value encountered while creating the histogram
+				if (m_fMinScalarValue > nValue)
+					m_fMinScalarValue = static_cast<float>(nValue);
+				if (m_fMaxScalarValue < nValue)
+					m_fMaxScalarValue = static_cast<float>(nValue);
+
+				// Update the histogram
+				pfHistogram[nValue] += 1.0f;
+			}
 		}
+		m_nNumOfElements += nNumOfElements;
+
+		// The cached values are no longer valid
+		InvalidateCachedValues();
+	}
+}
+
+/**
+*  @brief
+*    Adds a number of elements with the same value to the histogram data
+*/
+void Histogram::AddValue(uint32 nValue, uint32 nNumOfElements)
+{
+	// Check the value
+	if (nNumOfElements && nValue < m_lstData.GetNumOfElements()) {
+		// Update minimum and maximum value encountered while creating the histogram
+		if (!m_nNumOfElements || m_fMinScalarValue > nValue)
+			m_fMinScalarValue = static_cast<float>(nValue);
+		if (!m_nNumOfElements || m_fMaxScalarValue < nValue)
+			m_fMaxScalarValue = static_cast<float>(nValue);
+
+		// Update the histogram
+		m_lstData[nValue] += static_cast<float>(nNumOfElements);
+		m_nNumOfElements += nNumOfElements;
+
+		// The cached values are no longer valid
+		InvalidateCachedValues();
 	}
 }
 
@@ -294,6 +329,27 @@ void Histogram::ToNormalizedImage(uint32 nHeight, Image &cDestinationImage, cons
 }
 
 
+
+//[-------------------------------------------------------]
+//[ Private functions                                     ]
+//[-------------------------------------------------------]
+/**
+*  @brief
+*    Invalidates the cached values which are calculated from the histogram data
+*/
+void Histogram::InvalidateCachedValues()
+{
+	// Initialize the minimum and maximum value within the histogram
+	m_fMinValue = -1.0f;
+	m_fMaxValue = -1.0f;
+
+	// Bin with the highest value not initialized, yet
+	m_nBinWithHighestValue = -1;
+
+	// Not normalized, yet
+	m_bNormalized = false;
+}
+
 //[-------------------------------------------------------]
 //[ Namespace                                             ]
 //[-------------------------------------------------------]
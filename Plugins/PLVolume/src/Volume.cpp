@@ -26,6 +26,7 @@
 //[ Includes                                              ]
 //[-------------------------------------------------------]
 #include <PLGraphics/Image/Image.h>
+#include <PLGraphics/Image/ImagePart.h>
 #include <PLGraphics/Image/ImageBuffer.h>
 #include <PLGraphics/Image/ImageEffects.h>
 #include <PLRenderer/Renderer/Renderer.h>
@@ -33,6 +34,7 @@
 #include "PLVolume/TransferFunctionControl/Histogram.h"
 #include "PLVolume/TransferFunctionControl/TransferFunctionControl.h"
 #include "PLVolume/VolumeManager.h"
+#include "PLVolume/BrickedVolume.h"
 #include "PLVolume/Volume.h"
 
 
@@ -50,6 +52,7 @@ namespace PLVolume {
 //[ Public static data                                    ]
 //[-------------------------------------------------------]
 const Vector3 Volume::DefaultVoxelSize(0.001f, 0.001f, 0.001f);
+const uint32  Volume::DefaultBrickingThreshold = 256*1024*1024;
 
 
 //[-------------------------------------------------------]
@@ -62,6 +65,8 @@ const Vector3 Volume::DefaultVoxelSize(0.001f, 0.001f, 0.001f);
 Volume::Volume(const String &sName, ResourceManager<Volume> *pManager) : PLCore::Resource<Volume>(sName, pManager),
 	m_vVoxelSize(DefaultVoxelSize),
 	m_pTransferFunctionControl(new TransferFunctionControl()),
+	m_pBrickedVolume(new BrickedVolume()),
+	m_nBrickingThreshold(DefaultBrickingThreshold),
 	m_pTextureBufferHandler(new PLRenderer::ResourceHandler())
 {
 	/*
@@ -90,6 +95,9 @@ Volume::~Volume()
 
 	// Destroy the transfer function control instance
 	delete m_pTransferFunctionControl;
+
+	// Destroy the bricked volume instance
+	delete m_pBrickedVolume;
 }
 
 /**
@@ -121,6 +129,10 @@ Vector3i Volume::GetVolumeImageSize() const
 	if (pImageBuffer)
 		return pImageBuffer->GetSize();
 
+	// Is there a bricked volume? (the volume texture buffer may only hold a lower resolution level)
+	if (m_pBrickedVolume->IsOpen())
+		return m_pBrickedVolume->GetSize();
+
 	// Is there a volume texture buffer?
 	TextureBuffer *pTextureBuffer = static_cast<TextureBuffer*>(m_pTextureBufferHandler->GetResource());
 	if (pTextureBuffer)
@@ -130,6 +142,51 @@ Vector3i Volume::GetVolumeImageSize() const
 	return Vector3i::Zero;
 }
 
+/**
+*  @brief
+*    Returns whether or not the volumetric data is held by the bricked volume
+*/
+bool Volume::IsBricked() const
+{
+	return m_pBrickedVolume->IsOpen();
+}
+
+/**
+*  @brief
+*    Returns the bricked volume
+*/
+BrickedVolume &Volume::GetBrickedVolume()
+{
+	return *m_pBrickedVolume;
+}
+
+/**
+*  @brief
+*    Returns the bricked volume
+*/
+const BrickedVolume &Volume::GetBrickedVolume() const
+{
+	return *m_pBrickedVolume;
+}
+
+/**
+*  @brief
+*    Returns the bricking threshold
+*/
+uint32 Volume::GetBrickingThreshold() const
+{
+	return m_nBrickingThreshold;
+}
+
+/**
+*  @brief
+*    Sets the bricking threshold
+*/
+void Volume::SetBrickingThreshold(uint32 nBrickingThreshold)
+{
+	m_nBrickingThreshold = nBrickingThreshold;
+}
+
 /**
 *  @brief
 *    Returns the size of one voxel
@@ -269,6 +326,55 @@ float Volume::GetStepSize(float fVolumeTextureLOD, float fSampleRateFactor, floa
 */
 Histogram *Volume::CreateHistogram()
 {
+	// Bricked volume? Create the histogram brick by brick, this way there's no need to have all volume data at once within the host memory
+	if (!m_cVolumeImage.GetNumOfParts() && m_pBrickedVolume->IsOpen()) {
+		Histogram *pHistogram = new Histogram();
+		pHistogram->Create(m_pBrickedVolume->GetBytesPerVoxel(), 0, nullptr);
+		const Vector3i &vSize		 = m_pBrickedVolume->GetSize();
+		const Vector3i &vNumOfBricks = m_pBrickedVolume->GetNumOfBricks(0);
+		const int		nBrickSize	 = static_cast<int>(m_pBrickedVolume->GetBrickSize());
+		const uint32	nRowSize	 = nBrickSize*m_pBrickedVolume->GetBytesPerVoxel();
+		Vector3i vBrick;
+		for (vBrick.z=0; vBrick.z<vNumOfBricks.z; vBrick.z++) {
+			for (vBrick.y=0; vBrick.y<vNumOfBricks.y; vBrick.y++) {
+				for (vBrick.x=0; vBrick.x<vNumOfBricks.x; vBrick.x++) {
+					// Get the number of voxels within the volume, the rest of the brick is just padding
+					const Vector3i vValid(Math::Min(nBrickSize, vSize.x - vBrick.x*nBrickSize),
+										  Math::Min(nBrickSize, vSize.y - vBrick.y*nBrickSize),
+										  Math::Min(nBrickSize, vSize.z - vBrick.z*nBrickSize));
+
+					// Bricks with only one value don't need to be loaded
+					uint32 nMinimum = 0, nMaximum = 0;
+					m_pBrickedVolume->GetBrickRange(0, vBrick, nMinimum, nMaximum);
+					if (nMinimum == nMaximum) {
+						pHistogram->AddValue(nMinimum, vValid.x*vValid.y*vValid.z);
+					} else {
+						// Get the brick
+						const uint8 *pnBrick = m_pBrickedVolume->GetBrick(0, vBrick);
+						if (!pnBrick) {
+							// Error!
+							delete pHistogram;
+							return nullptr;
+						}
+
+						// Add the complete brick at once or the valid region row by row
+						if (vValid.x == nBrickSize && vValid.y == nBrickSize && vValid.z == nBrickSize) {
+							pHistogram->Add(nBrickSize*nBrickSize*nBrickSize, pnBrick);
+						} else {
+							for (int z=0; z<vValid.z; z++) {
+								for (int y=0; y<vValid.y; y++)
+									pHistogram->Add(vValid.x, pnBrick + (z*nBrickSize + y)*nRowSize);
+							}
+						}
+					}
+				}
+			}
+		}
+
+		// Done
+		return pHistogram;
+	}
+
 	// Get the image holding the volumetric data (internal image data is not copied, just shared, so this is pretty lightweight)
 	Image cImage = m_cVolumeImage;
 
@@ -311,6 +417,31 @@ TextureBuffer *Volume::GetVolumeTextureBuffer() const
 */
 TextureBuffer *Volume::GetVolumeTextureBuffer(Renderer &cRenderer, bool bTextureCompression, bool bMipmaps)
 {
+	// Bricked volume? Assemble the finest resolution level fitting into the GPU brick by brick within the image
+	if (!m_pTextureBufferHandler->GetResource() && !m_cVolumeImage.GetNumOfParts() && m_pBrickedVolume->IsOpen()) {
+		// Get the renderer capabilities instance
+		const Capabilities &cCapabilities = cRenderer.GetCapabilities();
+		const uint32 nMaxSize  = cCapabilities.bTextureBuffer3D ? cCapabilities.nMax3DTextureBufferSize : cCapabilities.nMaxTextureBufferSize;
+		const uint32 nMaxDepth = cCapabilities.bTextureBuffer3D ? cCapabilities.nMax3DTextureBufferSize : cCapabilities.nMaxTextureBuffer2DArrayLayers;
+
+		// Find the resolution level (ignore texture compression which may e.g. only half the required texture memory, the last level always fits into one brick)
+		const uint32 nBytesPerVoxel = m_pBrickedVolume->GetBytesPerVoxel();
+		uint32 nLevel = 0;
+		for (; nLevel<m_pBrickedVolume->GetNumOfLevels()-1; nLevel++) {
+			const Vector3i &vSize = m_pBrickedVolume->GetLevelSize(nLevel);
+			const uint64 nDataSize = static_cast<uint64>(vSize.x)*vSize.y*vSize.z*nBytesPerVoxel;
+			if (static_cast<uint32>(vSize.x) <= nMaxSize && static_cast<uint32>(vSize.y) <= nMaxSize && static_cast<uint32>(vSize.z) <= nMaxDepth &&
+				nDataSize <= 0xFFFFFFFF && (!cCapabilities.nTotalAvailableGPUMemory || nDataSize/1024 <= cCapabilities.nTotalAvailableGPUMemory))
+				break;
+		}
+
+		// Copy the resolution level into the image
+		ImageBuffer *pImageBuffer = m_cVolumeImage.CreatePart()->CreateMipmap();
+		pImageBuffer->CreateImage((nBytesPerVoxel == 1) ? DataByte : DataWord, ColorGrayscale, m_pBrickedVolume->GetLevelSize(nLevel));
+		if (!m_pBrickedVolume->CopyLevel(nLevel, pImageBuffer->GetData()))
+			m_cVolumeImage.Unload();
+	}
+
 	// Create the texture buffer right now?
 	if (!m_pTextureBufferHandler->GetResource() && m_cVolumeImage.GetNumOfParts()) {
 		// Get the image buffer
@@ -384,6 +515,9 @@ bool Volume::Unload()
 	// Unload the image holding the volumetric data
 	m_cVolumeImage.Unload();
 
+	// Close the bricked volume, the brick files are kept so they can be reused
+	m_pBrickedVolume->Close();
+
 	// Unload the transfer function
 	m_pTransferFunctionControl->Unload();
 
@@ -32,6 +32,7 @@
 #include <PLGraphics/Image/ImagePart.h>
 #include <PLGraphics/Image/ImageBuffer.h>
 #include <PLVolume/Volume.h>
+#include <PLVolume/BrickedVolume.h>
 #include "PLVolumeLoaderPVM/PVM_GPL_License/ddsbase.h"	// Lookout! GPL code!
 #include "PLVolumeLoaderPVM/VolumeLoaderPVM.h"
 
@@ -84,11 +85,24 @@ bool VolumeLoaderPVM::LoadParams(Volume &cVolume, File &cFile, bool bForce8Bit)
 
 		// We only support 8 bit and 16 bit
 		if (nComponents == 1 || nComponents == 2) {
+			// Huge volume? If so, put it into the bricked volume so the host memory is released as soon as the bricks are written.
+			// -> The PVM format is compressed as a whole, so the volume must be decompressed at once in here.
+			const Vector3i vSize(nWidth, nHeight, nDepth);
+			if (static_cast<uint64>(nWidth)*nHeight*nDepth*nComponents > cVolume.GetBrickingThreshold()) {
+				BrickedVolume &cBrickedVolume = cVolume.GetBrickedVolume();
+				bResult = (cBrickedVolume.Create(cFile.GetUrl().GetUrl() + ".bricks", vSize, nComponents) &&
+						   cBrickedVolume.AddSlices(pszPVMvolume, nDepth) && cBrickedVolume.Finish());
+				if (!bResult)
+					cBrickedVolume.Close(true);
+			}
+
 			// Create image - don't takeover the data because it was allocated using malloc
-			cImage = Image::CreateImageAndCopyData((nComponents == 1) ? DataByte : DataWord, ColorGrayscale, Vector3i(nWidth, nHeight, nDepth), CompressionNone, pszPVMvolume);
+			if (!bResult) {
+				cImage = Image::CreateImageAndCopyData((nComponents == 1) ? DataByte : DataWord, ColorGrayscale, vSize, CompressionNone, pszPVMvolume);
 
-			// Hooray, success!
-			bResult = true;
+				// Hooray, success!
+				bResult = true;
+			}
 		} else {
 			PL_LOG(Error, "PVM volume loader: Only 8 bit and 16 bit volumes are supported")
 		}
@@ -0,0 +1,148 @@
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include <UnitTest++/UnitTest++.h>
+#include <PLCore/String/String.h>
+#include <PLCore/System/System.h>
+#include <PLCore/Network/Host.h>
+#include <PLCore/Network/Socket.h>
+#include <PLCore/Network/Reactor.h>
+#include <PLCore/Network/Connection.h>
+
+using namespace PLCore;
+
+/*
+* Naming Convention for SUITE:
+* CLASSNAME
+*/
+SUITE(Connection) {
+	/*
+	* Naming Convention for METHOD:
+	* METHODNAME_SCENARIO
+	*/
+
+	//[-------------------------------------------------------]
+	//[ Classes                                               ]
+	//[-------------------------------------------------------]
+	// Connection receiving data manually
+	class ManualConnection : public Connection {
+	public:
+		ManualConnection(Host &cHost) : Connection(cHost)
+		{
+			SetReceiveMode(ReceiveManual);
+		}
+	};
+
+	// Host creating connections receiving data manually
+	class ManualHost : public Host {
+	protected:
+		virtual Connection *CreateOutgoingConnection() override
+		{
+			return new ManualConnection(*this);
+		}
+	};
+
+	// Connection closing itself when it receives data, it stays within the callback for a while after it was closed
+	class ClosingConnection : public Connection {
+	public:
+		static volatile bool bEntered;
+		static volatile bool bLeft;
+		ClosingConnection(Host &cHost) : Connection(cHost)
+		{
+		}
+	protected:
+		virtual void OnReceive(const char *pBuffer, uint32 nSize) override
+		{
+			// The I/O thread must detect that it's closing its own connection, else it would wait for itself
+			Disconnect();
+			bEntered = true;
+			System::GetInstance()->Sleep(200);
+			bLeft = true;
+		}
+	};
+	volatile bool ClosingConnection::bEntered = false;
+	volatile bool ClosingConnection::bLeft	  = false;
+
+	// Host creating connections closing themselves
+	class ClosingHost : public Host {
+	protected:
+		virtual Connection *CreateIncomingConnection() override
+		{
+			return new ClosingConnection(*this);
+		}
+	};
+
+	// Returns a port the given socket can be bound to, ports of the last test run may still be in use for a while
+	uint32 BindFreePort(Socket &cSocket)
+	{
+		for (uint32 nPort=4721; nPort<4741; nPort++) {
+			if (cSocket.Bind(nPort))
+				return nPort;
+		}
+		return 0;
+	}
+
+	TEST(ReadLine_MaxLineLength) {
+		Socket cListenSocket;
+		const uint32 nPort = BindFreePort(cListenSocket);
+		CHECK(nPort);
+		CHECK(cListenSocket.Listen());
+
+		// Connect, the connection is accepted by the listening socket
+		ManualHost cHost;
+		Connection *pConnection = cHost.Connect("127.0.0.1", nPort);
+		CHECK(pConnection);
+		if (pConnection) {
+			Socket cSocket = cListenSocket.Accept();
+			CHECK(cSocket.IsValid());
+
+			// Send two lines, the second one within two chunks, and a line which is too long
+			String sData = "Hello\nWorld";
+			CHECK_EQUAL(static_cast<int>(sData.GetLength()), cSocket.Send(sData.GetASCII(), sData.GetLength()));
+			CHECK_EQUAL("Hello\n", pConnection->ReadLine());
+			sData = "\r\n";
+			for (uint32 i=0; i<Connection::MaxLineLength; i++)
+				sData += 'x';
+			sData += '\n';
+			CHECK_EQUAL(static_cast<int>(sData.GetLength()), cSocket.Send(sData.GetASCII(), sData.GetLength()));
+			CHECK_EQUAL("World\r\n", pConnection->ReadLine());
+
+			// The line which is too long is dropped and the connection is closed
+			CHECK_EQUAL("", pConnection->ReadLine());
+			CHECK(!pConnection->IsConnected());
+			cSocket.Close();
+		}
+		cListenSocket.Close();
+	}
+
+	TEST(RemoveInactiveConnections_IOThread) {
+		if (Reactor::IsSupported()) {
+			ClosingHost cHost;
+			cHost.SetNumOfIOThreads(1);
+			uint32 nPort = 0;
+			{
+				Socket cPortSocket;
+				nPort = BindFreePort(cPortSocket);
+				cPortSocket.Close();
+			}
+			CHECK(nPort);
+			cHost.Listen(nPort);
+
+			// Let the connection of the host close itself within the I/O thread
+			Socket cSocket;
+			CHECK(cSocket.Connect("127.0.0.1", nPort));
+			CHECK_EQUAL(1, cSocket.Send("x", 1));
+			for (uint32 i=0; i<1000 && !ClosingConnection::bEntered; i++)
+				System::GetInstance()->Sleep(5);
+			CHECK(ClosingConnection::bEntered);
+
+			// The closed connection is destroyed after the I/O thread has left its callback
+			cHost.RemoveInactiveConnections();
+			CHECK(ClosingConnection::bLeft);
+			CHECK_EQUAL(0U, cHost.GetConnections().GetNumOfElements());
+
+			cSocket.Close();
+			cHost.Close();
+		}
+	}
+}
@@ -0,0 +1,97 @@
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include <UnitTest++/UnitTest++.h>
+#include <PLCore/Container/FlatHashMap.h>
+
+#include "MapTests.h"
+
+using namespace PLCore;
+
+/*
+* Naming Convention for SUITE:
+* CLASSNAME
+*/
+SUITE(FlatHashMap_Int_Int) {
+	/*
+	* Naming Convention for METHOD:
+	* METHODNAME_SCENARIO
+	*/
+
+	// Our List Test Fixture :)
+	struct ConstructTestFlatHashMap
+	{
+		ConstructTestFlatHashMap() {
+			/* some setup */
+			Hash.Add(1, 1);
+			Hash.Add(2, 2);
+			Hash.Add(3, 3);
+			Hash.Add(4, 4);
+		}
+		~ConstructTestFlatHashMap() {
+			/* some teardown */
+		}
+
+		// Container for testing
+		FlatHashMap<int, int> Hash;
+	};
+
+	TEST_FIXTURE(ConstructTestFlatHashMap, DerivedMapFunctions) {
+		CheckDerivedMapFunctions<int,int>(FlatHashMap<int,int>::Null, Hash);
+	}
+
+	TEST_FIXTURE(ConstructTestFlatHashMap, CopyConstructor) {
+		FlatHashMap<int, int> FlatHashMapCopy = Hash;
+
+		CHECK_EQUAL(Hash.GetNumOfElements(), FlatHashMapCopy.GetNumOfElements());
+		CHECK_EQUAL(Hash.Get(1), FlatHashMapCopy.Get(1));
+		CHECK_EQUAL(Hash.Get(2), FlatHashMapCopy.Get(2));
+		CHECK_EQUAL(Hash.Get(3), FlatHashMapCopy.Get(3));
+		CHECK_EQUAL(Hash.Get(4), FlatHashMapCopy.Get(4));
+		CHECK_EQUAL(Hash.Get(5), FlatHashMapCopy.Get(5));
+	}
+
+	TEST_FIXTURE(ConstructTestFlatHashMap, CopyOperator) {
+		FlatHashMap<int, int> FlatHashMapCopy;
+		FlatHashMapCopy = Hash;
+
+		CHECK_EQUAL(Hash.GetNumOfElements(), FlatHashMapCopy.GetNumOfElements());
+		CHECK_EQUAL(Hash.Get(1), FlatHashMapCopy.Get(1));
+		CHECK_EQUAL(Hash.Get(2), FlatHashMapCopy.Get(2));
+		CHECK_EQUAL(Hash.Get(3), FlatHashMapCopy.Get(3));
+		CHECK_EQUAL(Hash.Get(4), FlatHashMapCopy.Get(4));
+		CHECK_EQUAL(Hash.Get(5), FlatHashMapCopy.Get(5));
+	}
+
+	TEST(GrowAndRemove) {
+		FlatHashMap<int, int> Hash;
+
+		// Add enough elements to force the map to grow several times
+		for (int i=0; i<1000; i++)
+			CHECK(Hash.Add(i, i*2));
+		CHECK_EQUAL(1000U, Hash.GetNumOfElements());
+		CHECK(Hash.GetNumOfSlots() >= 1000U);
+		for (int i=0; i<1000; i++)
+			CHECK_EQUAL(i*2, Hash.Get(i));
+
+		// Remove every second element, the remaining ones must still be found
+		for (int i=0; i<1000; i+=2)
+			CHECK(Hash.Remove(i));
+		CHECK_EQUAL(500U, Hash.GetNumOfElements());
+		for (int i=0; i<1000; i++) {
+			if (i%2)
+				CHECK_EQUAL(i*2, Hash.Get(i));
+			else
+				CHECK_EQUAL(0, Hash.Get(i));
+		}
+
+		// Iterate over all remaining elements
+		uint32 nNumOfElements = 0;
+		PLCore::Iterator<int> cIterator = Hash.GetKeyIterator();
+		while (cIterator.HasNext()) {
+			CHECK(cIterator.Next()%2);
+			nNumOfElements++;
+		}
+		CHECK_EQUAL(500U, nNumOfElements);
+	}
+}
\ No newline at end of file
@@ -0,0 +1,124 @@
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include <UnitTest++/UnitTest++.h>
+#include <PLCore/String/String.h>
+#include <PLCore/Base/Event/Event.h>
+#include <PLCore/Base/Event/EventHandler.h>
+
+using namespace PLCore;
+
+/*
+* Naming Convention for SUITE:
+* CLASSNAME
+*/
+SUITE(Event) {
+	/*
+	* Naming Convention for METHOD:
+	* METHODNAME_SCENARIO
+	*/
+
+	//[-------------------------------------------------------]
+	//[ Classes                                               ]
+	//[-------------------------------------------------------]
+	// Event handler writing its number into a log, optionally it disconnects another event handler when it's called
+	class Receiver {
+	public:
+		EventHandler<int> EventHandlerTest;
+		Receiver(uint32 nNumber, String &sLog) :
+			EventHandlerTest(&Receiver::OnTest, this),
+			m_nNumber(nNumber),
+			m_sLog(sLog),
+			m_pEvent(nullptr),
+			m_pDisconnect(nullptr)
+		{
+		}
+		void SetDisconnect(Event<int> &cEvent, Receiver &cReceiver)
+		{
+			m_pEvent	  = &cEvent;
+			m_pDisconnect = &cReceiver;
+		}
+	private:
+		void OnTest(int nValue)
+		{
+			m_sLog += m_nNumber;
+			if (m_pDisconnect)
+				m_pEvent->Disconnect(m_pDisconnect->EventHandlerTest);
+		}
+		uint32		m_nNumber;
+		String	   &m_sLog;
+		Event<int> *m_pEvent;
+		Receiver   *m_pDisconnect;
+	};
+
+	TEST(Disconnect_Order) {
+		String sLog;
+		Event<int> cEvent;
+		Receiver cReceiver0(0, sLog), cReceiver1(1, sLog), cReceiver2(2, sLog), cReceiver3(3, sLog), cReceiver4(4, sLog);
+		cEvent.Connect(cReceiver0.EventHandlerTest);
+		cEvent.Connect(cReceiver1.EventHandlerTest);
+		cEvent.Connect(cReceiver2.EventHandlerTest);
+		cEvent.Connect(cReceiver3.EventHandlerTest);
+		cEvent.Connect(cReceiver4.EventHandlerTest);
+		cEvent(0);
+		CHECK_EQUAL("01234", sLog);
+
+		// The remaining event handlers are called in the order they were connected
+		cEvent.Disconnect(cReceiver1.EventHandlerTest);
+		sLog = "";
+		cEvent(0);
+		CHECK_EQUAL("0234", sLog);
+		CHECK_EQUAL(4U, cEvent.GetNumOfConnects());
+
+		// Disconnecting most of the event handlers removes the disconnected slots, a connected event handler is added at the end
+		cEvent.Disconnect(cReceiver0.EventHandlerTest);
+		cEvent.Disconnect(cReceiver3.EventHandlerTest);
+		cEvent.Connect(cReceiver1.EventHandlerTest);
+		sLog = "";
+		cEvent(0);
+		CHECK_EQUAL("241", sLog);
+		CHECK_EQUAL(3U, cEvent.GetNumOfConnects());
+
+		// Connecting an event handler twice has no effect
+		cEvent.Connect(cReceiver2.EventHandlerTest);
+		CHECK_EQUAL(3U, cEvent.GetNumOfConnects());
+	}
+
+	TEST(Disconnect_DuringEmission) {
+		String sLog;
+		Event<int> cEvent;
+		Receiver cReceiver0(0, sLog), cReceiver1(1, sLog), cReceiver2(2, sLog), cReceiver3(3, sLog);
+		cEvent.Connect(cReceiver0.EventHandlerTest);
+		cEvent.Connect(cReceiver1.EventHandlerTest);
+		cEvent.Connect(cReceiver2.EventHandlerTest);
+		cEvent.Connect(cReceiver3.EventHandlerTest);
+
+		// An event handler disconnected during the emission is not called any longer
+		cReceiver1.SetDisconnect(cEvent, cReceiver2);
+		cEvent(0);
+		CHECK_EQUAL("013", sLog);
+		CHECK_EQUAL(3U, cEvent.GetNumOfConnects());
+
+		// The order is kept after the emission
+		sLog = "";
+		cEvent(0);
+		CHECK_EQUAL("013", sLog);
+	}
+
+	TEST(Destroy_Handler) {
+		String sLog;
+		Event<int> cEvent;
+		Receiver cReceiver0(0, sLog), cReceiver2(2, sLog);
+		cEvent.Connect(cReceiver0.EventHandlerTest);
+		{
+			Receiver cReceiver1(1, sLog);
+			cEvent.Connect(cReceiver1.EventHandlerTest);
+			cEvent.Connect(cReceiver2.EventHandlerTest);
+		}
+
+		// A destroyed event handler disconnects itself
+		cEvent(0);
+		CHECK_EQUAL("02", sLog);
+		CHECK_EQUAL(2U, cEvent.GetNumOfConnects());
+	}
+}
@@ -0,0 +1,193 @@
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include <UnitTest++/UnitTest++.h>
+#include <PLCore/File/File.h>
+#include <PLCore/File/Directory.h>
+#include <PLCore/File/FileIndex.h>
+#include <PLCore/File/ZipHandle.h>
+#include <PLCore/Tools/LoadableManager.h>
+
+#include "UnitTest++AddIns/PLCheckMacros.h"
+#include "UnitTest++AddIns/PLChecks.h"
+
+using namespace PLCore;
+
+/*
+* Naming Convention for SUITE:
+* CLASSNAME
+*/
+SUITE(FileIndex) {
+	/*
+	* Naming Convention for METHOD:
+	* METHODNAME_SCENARIO
+	*/
+
+	TEST(Normalize) {
+		CHECK_EQUAL("Data/Textures/Stone.dds", FileIndex::Normalize("Data/Textures/Stone.dds"));
+		CHECK_EQUAL("Data/Textures/Stone.dds", FileIndex::Normalize("Data\\Textures\\Stone.dds"));
+		CHECK_EQUAL("Data/Textures/Stone.dds", FileIndex::Normalize("./Data//Textures/./Stone.dds"));
+		CHECK_EQUAL("Data/Stone.dds", FileIndex::Normalize("Data/Textures/../Stone.dds"));
+		CHECK_EQUAL("../Stone.dds", FileIndex::Normalize("../Stone.dds"));
+		CHECK_EQUAL("", FileIndex::Normalize("Data/.."));
+	}
+
+	TEST(AddFile_Get) {
+		FileIndex cFileIndex;
+		CHECK(cFileIndex.AddFile("Data/Stone.dds", 1));
+		CHECK(!cFileIndex.AddFile("Data/./Stone.dds", 2));
+		CHECK_EQUAL(1U, cFileIndex.GetNumOfEntries());
+
+		// The first added directory wins
+		const FileIndex::Entry *pEntry = cFileIndex.Get("Data\\Stone.dds");
+		CHECK(pEntry != nullptr);
+		if (pEntry) {
+			CHECK_EQUAL(1U, pEntry->m_nDirectory);
+			CHECK(!pEntry->m_bZipEntry);
+		}
+		CHECK(cFileIndex.Get("Data/Wood.dds") == nullptr);
+
+		// After removing the file, it can be added with another directory
+		CHECK(cFileIndex.RemoveFile("Data/Stone.dds"));
+		CHECK(!cFileIndex.RemoveFile("Data/Stone.dds"));
+		CHECK(cFileIndex.AddFile("Data/Stone.dds", 2));
+		pEntry = cFileIndex.Get("Data/Stone.dds");
+		CHECK(pEntry != nullptr);
+		if (pEntry)
+			CHECK_EQUAL(2U, pEntry->m_nDirectory);
+
+		cFileIndex.Clear();
+		CHECK_EQUAL(0U, cFileIndex.GetNumOfEntries());
+		CHECK(cFileIndex.Get("Data/Stone.dds") == nullptr);
+	}
+
+	TEST(AddDirectory_Zip) {
+		FileIndex cFileIndex;
+		CHECK(cFileIndex.AddDirectory("../Data/unitTestData/FileSystemTest.zip/", 3));
+
+		// Files which are already within the index are not changed
+		CHECK(cFileIndex.AddDirectory("../Data/unitTestData/FileSystemTest.zip/", 4));
+
+		// 'dir/' is a directory and not added
+		CHECK_EQUAL(2U, cFileIndex.GetNumOfEntries());
+		CHECK(cFileIndex.Get("dir") == nullptr);
+		CHECK(cFileIndex.Get("Main.zip") != nullptr);
+		const FileIndex::Entry *pEntry = cFileIndex.Get("aTestLog.txt");
+		CHECK(pEntry != nullptr);
+		if (pEntry) {
+			CHECK_EQUAL(3U, pEntry->m_nDirectory);
+			CHECK(pEntry->m_bZipEntry);
+			CHECK_EQUAL(195U, pEntry->m_nSize);
+
+			// The stored entry can be used to locate the file without searching the ZIP-file
+			ZipHandle cZipFile;
+			CHECK(cZipFile.Open("../Data/unitTestData/FileSystemTest.zip", ""));
+			CHECK(cZipFile.LocateFile(pEntry->m_nZipEntryIndex, pEntry->m_nZipEntryPosition));
+			CHECK_EQUAL("aTestLog.txt", cZipFile.GetCurrentFile().m_sFilename);
+			CHECK(!cZipFile.LocateFile(pEntry->m_nZipEntryIndex, 0));
+
+			// The same file opened through the stored entry and through the search by name
+			File cFile;
+			cFile.Assign(Url("../Data/unitTestData/FileSystemTest.zip/aTestLog.txt"), pEntry->m_nZipEntryIndex, pEntry->m_nZipEntryPosition);
+			CHECK(cFile.IsFile());
+			File cFileByName("../Data/unitTestData/FileSystemTest.zip/aTestLog.txt");
+			CHECK(cFileByName.Open(File::FileRead) && cFile.Open(File::FileRead));
+			CHECK_EQUAL(195U, cFile.GetSize());
+			CHECK_EQUAL(cFileByName.GetContentAsString(), cFile.GetContentAsString());
+		}
+	}
+
+	TEST(AddDirectory_FileSystem) {
+		FileIndex cFileIndex;
+		CHECK(cFileIndex.AddDirectory("../Data/unitTestData", 0));
+		CHECK(!cFileIndex.AddDirectory("../Data/unitTestData/ThisDirectoryDoesNotExist/", 1));
+
+		// ZIP-files within a regular directory are regular files
+		const FileIndex::Entry *pEntry = cFileIndex.Get("FileSystemTest.zip");
+		CHECK(pEntry != nullptr);
+		if (pEntry)
+			CHECK(!pEntry->m_bZipEntry);
+		CHECK(cFileIndex.Get("FileSystemTest.zip/aTestLog.txt") == nullptr);
+	}
+
+	TEST(LoadableManager_OpenFile) {
+		LoadableManager *pLoadableManager = LoadableManager::GetInstance();
+		const String sBaseDir = "../Data/unitTestData/FileSystemTest.zip/";
+		CHECK(pLoadableManager->AddBaseDir(sBaseDir));
+
+		// The same file has to be found with and without file index
+		CHECK(pLoadableManager->GetUseFileIndex());
+		const String sIndexed = pLoadableManager->LoadStringFromFile("aTestLog.txt");
+		pLoadableManager->SetUseFileIndex(false);
+		const String sNotIndexed = pLoadableManager->LoadStringFromFile("aTestLog.txt");
+		pLoadableManager->SetUseFileIndex(true);
+		CHECK(sIndexed.GetLength() > 0);
+		CHECK_EQUAL(sNotIndexed, sIndexed);
+		CHECK_EQUAL("", pLoadableManager->LoadStringFromFile("ThisFileDoesNotExist.txt"));
+
+		CHECK(pLoadableManager->RemoveBaseDir(sBaseDir));
+	}
+
+	TEST(LoadableManager_OpenFile_Priority) {
+		LoadableManager *pLoadableManager = LoadableManager::GetInstance();
+		const String sHighPriorityBaseDir = "../Data/unitTestData/FileIndexTest/";
+		const String sLowPriorityBaseDir  = "../Data/unitTestData/FileSystemTest.zip/";
+		Directory cDirectory(sHighPriorityBaseDir);
+		CHECK(cDirectory.Create());
+		CHECK(pLoadableManager->AddBaseDir(sHighPriorityBaseDir));
+		CHECK(pLoadableManager->AddBaseDir(sLowPriorityBaseDir));
+		const String sZipContent = pLoadableManager->LoadStringFromFile("aTestLog.txt");
+		CHECK(sZipContent.GetLength() > 0);
+
+		// A file created within a higher priority base directory replaces the known one
+		File cFile;
+		CHECK(pLoadableManager->OpenFile(cFile, "aTestLog.txt", true));
+		cFile.PutS("HighPriority");
+		cFile.Close();
+		CHECK_EQUAL("HighPriority", pLoadableManager->LoadStringFromFile("aTestLog.txt"));
+
+		// When the file is not where the file index expects it, the other base directories are checked
+		CHECK(File(sHighPriorityBaseDir + "aTestLog.txt").Delete());
+		CHECK_EQUAL(sZipContent, pLoadableManager->LoadStringFromFile("aTestLog.txt"));
+
+		CHECK(pLoadableManager->RemoveBaseDir(sLowPriorityBaseDir));
+		CHECK(pLoadableManager->RemoveBaseDir(sHighPriorityBaseDir));
+		CHECK(cDirectory.Delete());
+	}
+
+	TEST(LoadableManager_OpenFile_CreatedLater) {
+		LoadableManager *pLoadableManager = LoadableManager::GetInstance();
+		const String sHighPriorityBaseDir = "../Data/unitTestData/FileIndexTest/";
+		const String sLowPriorityBaseDir  = "../Data/unitTestData/FileSystemTest.zip/";
+		Directory cDirectory(sHighPriorityBaseDir);
+		CHECK(cDirectory.Create());
+		CHECK(pLoadableManager->AddBaseDir(sHighPriorityBaseDir));
+		CHECK(pLoadableManager->AddBaseDir(sLowPriorityBaseDir));
+		CHECK(pLoadableManager->GetUseFileIndex());
+		const String sZipContent = pLoadableManager->LoadStringFromFile("aTestLog.txt");
+		CHECK(sZipContent.GetLength() > 0);
+		CHECK_EQUAL("", pLoadableManager->LoadStringFromFile("CreatedLater.txt"));
+
+		// Files created within a regular base directory by other means than the loadable manager are found without invalidating the file index
+		File cFile(sHighPriorityBaseDir + "CreatedLater.txt");
+		CHECK(cFile.Open(File::FileWrite | File::FileCreate));
+		cFile.PutS("CreatedLater");
+		cFile.Close();
+		File cHighPriorityFile(sHighPriorityBaseDir + "aTestLog.txt");
+		CHECK(cHighPriorityFile.Open(File::FileWrite | File::FileCreate));
+		cHighPriorityFile.PutS("HighPriority");
+		cHighPriorityFile.Close();
+		CHECK_EQUAL("CreatedLater", pLoadableManager->LoadStringFromFile("CreatedLater.txt"));
+		CHECK_EQUAL("HighPriority", pLoadableManager->LoadStringFromFile("aTestLog.txt"));
+
+		// Deleted files are no longer found
+		CHECK(cFile.Delete());
+		CHECK(cHighPriorityFile.Delete());
+		CHECK_EQUAL("", pLoadableManager->LoadStringFromFile("CreatedLater.txt"));
+		CHECK_EQUAL(sZipContent, pLoadableManager->LoadStringFromFile("aTestLog.txt"));
+
+		CHECK(pLoadableManager->RemoveBaseDir(sLowPriorityBaseDir));
+		CHECK(pLoadableManager->RemoveBaseDir(sHighPriorityBaseDir));
+		CHECK(cDirectory.Delete());
+	}
+}
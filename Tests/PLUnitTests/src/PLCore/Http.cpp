@@ -0,0 +1,238 @@
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include <UnitTest++/UnitTest++.h>
+#include <PLCore/String/String.h>
+#include <PLCore/File/File.h>
+#include <PLCore/Network/Http/HttpHeader.h>
+#include <PLCore/Network/Http/HttpFileCache.h>
+
+using namespace PLCore;
+
+/*
+* Naming Convention for SUITE:
+* CLASSNAME
+*/
+SUITE(HttpHeader) {
+	/*
+	* Naming Convention for METHOD:
+	* METHODNAME_SCENARIO
+	*/
+
+	// Parses a request with the given additional header line
+	void ParseRequest(HttpHeader &cHttpHeader, const String &sProtocol, const String &sLine)
+	{
+		cHttpHeader.Clear();
+		cHttpHeader.AddEntry("GET /index.html " + sProtocol);
+		if (sLine.GetLength())
+			cHttpHeader.AddEntry(sLine);
+		cHttpHeader.AddEntry("");
+		cHttpHeader.Parse();
+	}
+
+	TEST(Parse_Range) {
+		HttpHeader cHttpHeader;
+
+		// Closed range
+		ParseRequest(cHttpHeader, "HTTP/1.1", "Range: bytes=100-199");
+		CHECK(cHttpHeader.IsComplete());
+		CHECK_EQUAL(HttpGet, cHttpHeader.GetRequest());
+		CHECK_EQUAL("/index.html", cHttpHeader.GetRequestUrl());
+		CHECK(cHttpHeader.IsPartial());
+		CHECK_EQUAL(100U, cHttpHeader.GetRangeMin());
+		CHECK_EQUAL(199U, cHttpHeader.GetRangeMax());
+
+		// Single byte
+		ParseRequest(cHttpHeader, "HTTP/1.1", "Range: bytes=0-0");
+		CHECK(cHttpHeader.IsPartial());
+		CHECK_EQUAL(0U, cHttpHeader.GetRangeMin());
+		CHECK_EQUAL(0U, cHttpHeader.GetRangeMax());
+
+		// Open end, all data up to the end of the file is requested
+		ParseRequest(cHttpHeader, "HTTP/1.1", "Range: bytes=21010-");
+		CHECK(cHttpHeader.IsPartial());
+		CHECK_EQUAL(21010U, cHttpHeader.GetRangeMin());
+		CHECK_EQUAL(0xFFFFFFFFU, cHttpHeader.GetRangeMax());
+	}
+
+	TEST(Parse_Range_Unsupported) {
+		HttpHeader cHttpHeader;
+
+		// No range
+		ParseRequest(cHttpHeader, "HTTP/1.1", "");
+		CHECK(!cHttpHeader.IsPartial());
+
+		// Multiple ranges are answered with the full data
+		ParseRequest(cHttpHeader, "HTTP/1.1", "Range: bytes=0-99,200-299");
+		CHECK(!cHttpHeader.IsPartial());
+
+		// Suffix ranges are answered with the full data
+		ParseRequest(cHttpHeader, "HTTP/1.1", "Range: bytes=-500");
+		CHECK(!cHttpHeader.IsPartial());
+
+		// Invalid range
+		ParseRequest(cHttpHeader, "HTTP/1.1", "Range: bytes=200-100");
+		CHECK(!cHttpHeader.IsPartial());
+
+		// Other units
+		ParseRequest(cHttpHeader, "HTTP/1.1", "Range: items=0-9");
+		CHECK(!cHttpHeader.IsPartial());
+	}
+
+	TEST(Parse_ContentRange) {
+		HttpHeader cHttpHeader;
+		cHttpHeader.AddEntry("HTTP/1.1 206 Partial Content");
+		cHttpHeader.AddEntry("Content-Range: bytes 21010-47021/47022");
+		cHttpHeader.AddEntry("");
+		cHttpHeader.Parse();
+		CHECK_EQUAL(HttpResponse, cHttpHeader.GetMessageType());
+		CHECK_EQUAL(206U, cHttpHeader.GetStatusCode());
+		CHECK(cHttpHeader.IsPartial());
+		CHECK_EQUAL(21010U, cHttpHeader.GetRangeMin());
+		CHECK_EQUAL(47021U, cHttpHeader.GetRangeMax());
+		CHECK_EQUAL(47022U, cHttpHeader.GetRangeTotal());
+	}
+
+	TEST(Parse_ConnectionType) {
+		HttpHeader cHttpHeader;
+
+		// HTTP 1.1 keeps the connection open by default
+		ParseRequest(cHttpHeader, "HTTP/1.1", "");
+		CHECK_EQUAL(Http11, cHttpHeader.GetProtocol());
+		CHECK_EQUAL(ConnectionKeepAlive, cHttpHeader.GetConnectionType());
+		ParseRequest(cHttpHeader, "HTTP/1.1", "Connection: close");
+		CHECK_EQUAL(ConnectionClose, cHttpHeader.GetConnectionType());
+
+		// HTTP 1.0 closes the connection by default
+		ParseRequest(cHttpHeader, "HTTP/1.0", "");
+		CHECK_EQUAL(Http10, cHttpHeader.GetProtocol());
+		CHECK_EQUAL(ConnectionClose, cHttpHeader.GetConnectionType());
+		ParseRequest(cHttpHeader, "HTTP/1.0", "Connection: keep-alive");
+		CHECK_EQUAL(ConnectionKeepAlive, cHttpHeader.GetConnectionType());
+	}
+}
+
+/*
+* Naming Convention for SUITE:
+* CLASSNAME
+*/
+SUITE(HttpFileCache) {
+	/*
+	* Naming Convention for METHOD:
+	* METHODNAME_SCENARIO
+	*/
+
+	// Adds a file of the given size filled with the given value to the cache
+	const HttpFileCache::Entry *AddFile(HttpFileCache &cCache, const String &sFilename, uint64 nModificationTime, uint32 nSize, uint8 nValue)
+	{
+		uint8 nData[1024];
+		for (uint32 i=0; i<nSize; i++)
+			nData[i] = nValue;
+		File cFile(nData, nSize);
+		return cCache.Add(sFilename, nModificationTime, cFile);
+	}
+
+	// Checks whether or not a file is cached, the entry is released at once
+	bool IsCached(HttpFileCache &cCache, const String &sFilename, uint64 nModificationTime)
+	{
+		const HttpFileCache::Entry *pEntry = cCache.Get(sFilename, nModificationTime);
+		if (pEntry) {
+			cCache.Release(*pEntry);
+			return true;
+		}
+		return false;
+	}
+
+	TEST(Get) {
+		HttpFileCache cCache;
+		const HttpFileCache::Entry *pEntry = AddFile(cCache, "a.html", 1, 100, 'a');
+		CHECK(pEntry);
+		if (pEntry) {
+			CHECK_EQUAL(100U, pEntry->nSize);
+			CHECK_EQUAL('a', pEntry->pnData[99]);
+			cCache.Release(*pEntry);
+		}
+		CHECK_EQUAL(100U, cCache.GetSize());
+
+		// Same modification time
+		pEntry = cCache.Get("a.html", 1);
+		CHECK(pEntry);
+		if (pEntry) {
+			CHECK_EQUAL("a.html", pEntry->sFilename);
+			CHECK_EQUAL(100U, pEntry->nSize);
+			cCache.Release(*pEntry);
+		}
+		CHECK(!IsCached(cCache, "b.html", 1));
+
+		// The file was modified, the outdated content is removed from the cache
+		CHECK(!IsCached(cCache, "a.html", 2));
+		CHECK(!IsCached(cCache, "a.html", 1));
+		CHECK_EQUAL(0U, cCache.GetSize());
+	}
+
+	TEST(Add_NotCached) {
+		HttpFileCache cCache;
+		cCache.SetMaxFileSize(200);
+
+		// Unknown modification time
+		CHECK(!AddFile(cCache, "a.html", 0, 100, 'a'));
+
+		// File too large
+		CHECK(!AddFile(cCache, "b.html", 1, 201, 'b'));
+
+		// Cache disabled
+		cCache.SetMaxSize(0);
+		CHECK(!AddFile(cCache, "c.html", 1, 100, 'c'));
+		CHECK_EQUAL(0U, cCache.GetSize());
+	}
+
+	TEST(Add_LeastRecentlyUsed) {
+		HttpFileCache cCache;
+		cCache.SetMaxSize(300);
+		cCache.Release(*AddFile(cCache, "a.html", 1, 100, 'a'));
+		cCache.Release(*AddFile(cCache, "b.html", 1, 100, 'b'));
+		cCache.Release(*AddFile(cCache, "c.html", 1, 100, 'c'));
+		CHECK_EQUAL(300U, cCache.GetSize());
+
+		// "a.html" is used again, so "b.html" is the least recently used file now
+		CHECK(IsCached(cCache, "a.html", 1));
+		cCache.Release(*AddFile(cCache, "d.html", 1, 100, 'd'));
+		CHECK_EQUAL(300U, cCache.GetSize());
+		CHECK(!IsCached(cCache, "b.html", 1));
+		CHECK(IsCached(cCache, "a.html", 1));
+		CHECK(IsCached(cCache, "c.html", 1));
+		CHECK(IsCached(cCache, "d.html", 1));
+
+		// A large file removes several files
+		cCache.Release(*AddFile(cCache, "e.html", 1, 250, 'e'));
+		CHECK_EQUAL(250U, cCache.GetSize());
+		CHECK(!IsCached(cCache, "a.html", 1));
+		CHECK(!IsCached(cCache, "c.html", 1));
+		CHECK(!IsCached(cCache, "d.html", 1));
+		CHECK(IsCached(cCache, "e.html", 1));
+
+		// Reducing the maximum size removes files as well
+		cCache.SetMaxSize(200);
+		CHECK_EQUAL(0U, cCache.GetSize());
+	}
+
+	TEST(Release_Removed) {
+		HttpFileCache cCache;
+		const HttpFileCache::Entry *pEntry = AddFile(cCache, "a.html", 1, 100, 'a');
+		CHECK(pEntry);
+		if (pEntry) {
+			// Replacing the file content or clearing the cache doesn't destroy an entry which is still used
+			const HttpFileCache::Entry *pNewEntry = AddFile(cCache, "a.html", 2, 50, 'b');
+			CHECK(pNewEntry);
+			cCache.Clear();
+			CHECK_EQUAL(0U, cCache.GetSize());
+			CHECK_EQUAL(100U, pEntry->nSize);
+			CHECK_EQUAL('a', pEntry->pnData[99]);
+			if (pNewEntry) {
+				CHECK_EQUAL('b', pNewEntry->pnData[49]);
+				cCache.Release(*pNewEntry);
+			}
+			cCache.Release(*pEntry);
+		}
+	}
+}
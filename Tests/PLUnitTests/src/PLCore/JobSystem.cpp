@@ -0,0 +1,162 @@
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include <UnitTest++/UnitTest++.h>
+#include <PLCore/System/Atomic.h>
+#include <PLCore/System/JobSystem.h>
+
+using namespace PLCore;
+
+// Job incrementing the given counter
+void IncrementJob(void *pData)
+{
+	Atomic::Increment(*static_cast<volatile int32*>(pData));
+}
+
+// Job checking that its dependency has been executed before
+struct DependencyData {
+	volatile int32 nFirst;
+	volatile int32 nSecond;
+	volatile int32 nFailed;
+};
+void SecondJob(void *pData)
+{
+	DependencyData *pDependencyData = static_cast<DependencyData*>(pData);
+	if (Atomic::Get(pDependencyData->nFirst) != 100)
+		Atomic::Increment(pDependencyData->nFailed);
+	Atomic::Increment(pDependencyData->nSecond);
+}
+void FirstJob(void *pData)
+{
+	Atomic::Increment(static_cast<DependencyData*>(pData)->nFirst);
+}
+
+// Job submitting and waiting for other jobs
+void NestedJob(void *pData)
+{
+	JobCounter cCounter;
+	for (int i=0; i<10; i++)
+		JobSystem::GetInstance()->Submit(&IncrementJob, pData, &cCounter);
+	JobSystem::GetInstance()->Wait(cCounter);
+}
+
+// Parallel for function marking each element once
+void MarkFunction(uint32 nBegin, uint32 nEnd, void *pData)
+{
+	int32 *pnData = static_cast<int32*>(pData);
+	for (uint32 i=nBegin; i<nEnd; i++)
+		pnData[i]++;
+}
+
+/*
+* Naming Convention for SUITE:
+* CLASSNAME
+*/
+SUITE(JobSystem) {
+	/*
+	* Naming Convention for METHOD:
+	* METHODNAME_SCENARIO
+	*/
+
+	TEST(Submit_Wait) {
+		JobSystem *pJobSystem = JobSystem::GetInstance();
+		CHECK(pJobSystem);
+
+		// Test with a different number of worker threads, including none
+		for (uint32 nNumOfWorkers=0; nNumOfWorkers<4; nNumOfWorkers++) {
+			pJobSystem->SetNumOfWorkers(nNumOfWorkers);
+			CHECK_EQUAL(nNumOfWorkers, pJobSystem->GetNumOfWorkers());
+
+			volatile int32 nValue = 0;
+			JobCounter cCounter;
+			for (int i=0; i<1000; i++)
+				pJobSystem->Submit(&IncrementJob, const_cast<int32*>(&nValue), &cCounter);
+			pJobSystem->Wait(cCounter);
+			CHECK(cCounter.IsDone());
+			CHECK_EQUAL(0U, cCounter.GetValue());
+			CHECK_EQUAL(1000, nValue);
+		}
+	}
+
+	TEST(Submit_Dependency) {
+		JobSystem *pJobSystem = JobSystem::GetInstance();
+		for (uint32 nNumOfWorkers=0; nNumOfWorkers<4; nNumOfWorkers++) {
+			pJobSystem->SetNumOfWorkers(nNumOfWorkers);
+
+			DependencyData sData = { 0, 0, 0 };
+			JobCounter cFirstCounter, cSecondCounter;
+			for (int i=0; i<100; i++)
+				pJobSystem->Submit(&FirstJob, &sData, &cFirstCounter);
+			for (int i=0; i<100; i++)
+				pJobSystem->Submit(&SecondJob, &sData, &cSecondCounter, &cFirstCounter);
+			pJobSystem->Wait(cSecondCounter);
+			CHECK(cFirstCounter.IsDone());
+			CHECK_EQUAL(100, sData.nSecond);
+			CHECK_EQUAL(0, sData.nFailed);
+		}
+	}
+
+	TEST(Submit_Nested) {
+		JobSystem *pJobSystem = JobSystem::GetInstance();
+		pJobSystem->SetNumOfWorkers(2);
+
+		volatile int32 nValue = 0;
+		JobCounter cCounter;
+		for (int i=0; i<100; i++)
+			pJobSystem->Submit(&NestedJob, const_cast<int32*>(&nValue), &cCounter);
+		pJobSystem->Wait(cCounter);
+		CHECK_EQUAL(1000, nValue);
+	}
+
+	TEST(Submit_Wait_Shutdown) {
+		JobSystem *pJobSystem = JobSystem::GetInstance();
+		pJobSystem->SetNumOfWorkers(3);
+
+		// Stop the workers while they are still executing jobs submitting and waiting for other jobs and while
+		// jobs are waiting for a dependency, just like when the application is shutting down
+		volatile int32 nValue = 0;
+		DependencyData sData = { 0, 0, 0 };
+		JobCounter cCounter, cFirstCounter, cSecondCounter;
+		for (int i=0; i<100; i++)
+			pJobSystem->Submit(&NestedJob, const_cast<int32*>(&nValue), &cCounter);
+		for (int i=0; i<100; i++)
+			pJobSystem->Submit(&FirstJob, &sData, &cFirstCounter);
+		for (int i=0; i<100; i++)
+			pJobSystem->Submit(&SecondJob, &sData, &cSecondCounter, &cFirstCounter);
+		pJobSystem->SetNumOfWorkers(0);
+		CHECK_EQUAL(0U, pJobSystem->GetNumOfWorkers());
+
+		// No job must get lost, the remaining ones are executed by the waiting thread
+		pJobSystem->Wait(cCounter);
+		pJobSystem->Wait(cSecondCounter);
+		CHECK_EQUAL(1000, nValue);
+		CHECK(cFirstCounter.IsDone());
+		CHECK_EQUAL(100, sData.nSecond);
+		CHECK_EQUAL(0, sData.nFailed);
+
+		// Submitting and waiting must still work without workers
+		nValue = 0;
+		for (int i=0; i<10; i++)
+			pJobSystem->Submit(&IncrementJob, const_cast<int32*>(&nValue), &cCounter);
+		pJobSystem->Wait(cCounter);
+		CHECK_EQUAL(10, nValue);
+	}
+
+	TEST(ParallelFor) {
+		JobSystem *pJobSystem = JobSystem::GetInstance();
+		for (uint32 nNumOfWorkers=0; nNumOfWorkers<4; nNumOfWorkers++) {
+			pJobSystem->SetNumOfWorkers(nNumOfWorkers);
+
+			// Each element must be processed exactly once, with automatic and with explicit granularity
+			int32 nData[1001] = { 0 };
+			pJobSystem->ParallelFor(1001, 0, &MarkFunction, nData);
+			pJobSystem->ParallelFor(1001, 7, &MarkFunction, nData);
+			bool bAllTwice = true;
+			for (int i=0; i<1001; i++) {
+				if (nData[i] != 2)
+					bAllTwice = false;
+			}
+			CHECK(bAllTwice);
+		}
+	}
+}
@@ -0,0 +1,229 @@
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include <UnitTest++/UnitTest++.h>
+#include <PLCore/String/String.h>
+#include <PLCore/System/System.h>
+#include <PLCore/Network/Host.h>
+#include <PLCore/Network/Socket.h>
+#include <PLCore/Network/Reactor.h>
+#include <PLCore/Network/Connection.h>
+
+using namespace PLCore;
+
+/*
+* Naming Convention for SUITE:
+* CLASSNAME
+*/
+SUITE(Reactor) {
+	/*
+	* Naming Convention for METHOD:
+	* METHODNAME_SCENARIO
+	*/
+
+	//[-------------------------------------------------------]
+	//[ Classes                                               ]
+	//[-------------------------------------------------------]
+	// Connection sending received data back, counts the connect and disconnect callbacks
+	class EchoConnection : public Connection {
+	public:
+		static volatile uint32 nNumOfConnects;
+		static volatile uint32 nNumOfDisconnects;
+		EchoConnection(Host &cHost) : Connection(cHost)
+		{
+		}
+	protected:
+		virtual void OnConnect() override
+		{
+			nNumOfConnects++;
+		}
+		virtual void OnDisconnect() override
+		{
+			nNumOfDisconnects++;
+		}
+		virtual void OnReceive(const char *pBuffer, uint32 nSize) override
+		{
+			Send(pBuffer, nSize);
+		}
+	};
+	volatile uint32 EchoConnection::nNumOfConnects	  = 0;
+	volatile uint32 EchoConnection::nNumOfDisconnects = 0;
+
+	// Host creating echo connections
+	class EchoHost : public Host {
+	protected:
+		virtual Connection *CreateIncomingConnection() override
+		{
+			return new EchoConnection(*this);
+		}
+	};
+
+	// Connection disconnecting the other connection of a pair when it receives data, the pair is assigned to two I/O threads
+	class PairConnection : public Connection {
+	public:
+		static PairConnection *pConnections[2];
+		static volatile uint32 nNumOfConnections;
+		static volatile uint32 nNumOfEntered;
+		static volatile uint32 nNumOfLeft;
+		PairConnection(Host &cHost) : Connection(cHost),
+			m_nIndex(nNumOfConnections)
+		{
+			if (m_nIndex < 2)
+				pConnections[m_nIndex] = this;
+			nNumOfConnections++;
+		}
+	protected:
+		virtual void OnReceive(const char *pBuffer, uint32 nSize) override
+		{
+			// Wait until the other I/O thread is within the callback of the other connection as well, then both I/O
+			// threads remove the connection of the other one at the same time
+			nNumOfEntered++;
+			for (uint32 i=0; i<1000 && nNumOfEntered < 2; i++)
+				System::GetInstance()->Sleep(2);
+			if (m_nIndex < 2)
+				pConnections[1 - m_nIndex]->Disconnect();
+			nNumOfLeft++;
+		}
+	private:
+		uint32 m_nIndex;
+	};
+	PairConnection *PairConnection::pConnections[2]		 = { nullptr, nullptr };
+	volatile uint32 PairConnection::nNumOfConnections	 = 0;
+	volatile uint32 PairConnection::nNumOfEntered		 = 0;
+	volatile uint32 PairConnection::nNumOfLeft			 = 0;
+
+	// Host creating connection pairs
+	class PairHost : public Host {
+	protected:
+		virtual Connection *CreateIncomingConnection() override
+		{
+			return new PairConnection(*this);
+		}
+	};
+
+	// Returns a port a host can listen at, ports of the last test run may still be in use for a while
+	uint32 GetFreePort()
+	{
+		for (uint32 nPort=4741; nPort<4761; nPort++) {
+			Socket cSocket;
+			if (cSocket.Bind(nPort)) {
+				cSocket.Close();
+				return nPort;
+			}
+		}
+		return 0;
+	}
+
+	// Waits until the given value has reached the expected value, returns 'false' on timeout
+	bool WaitFor(volatile uint32 &nValue, uint32 nExpected)
+	{
+		for (uint32 i=0; i<1000 && nValue < nExpected; i++)
+			System::GetInstance()->Sleep(5);
+		return (nValue >= nExpected);
+	}
+
+	TEST(Connect_IOThreads) {
+		if (Reactor::IsSupported()) {
+			EchoConnection::nNumOfConnects	  = 0;
+			EchoConnection::nNumOfDisconnects = 0;
+			EchoHost cHost;
+			cHost.SetNumOfIOThreads(2);
+			const uint32 nPort = GetFreePort();
+			CHECK(nPort);
+			cHost.Listen(nPort);
+
+			// Connect several clients, the connections are distributed across the I/O threads
+			const uint32 NumOfSockets = 5;
+			Socket cSockets[NumOfSockets];
+			for (uint32 i=0; i<NumOfSockets; i++)
+				CHECK(cSockets[i].Connect("127.0.0.1", nPort));
+			CHECK(WaitFor(EchoConnection::nNumOfConnects, NumOfSockets));
+
+			// Each client gets back what it has sent
+			for (uint32 i=0; i<NumOfSockets; i++) {
+				const String sData = String("Hello ") + i;
+				CHECK_EQUAL(static_cast<int>(sData.GetLength()), cSockets[i].Send(sData.GetASCII(), sData.GetLength()));
+				char szBuffer[64];
+				uint32 nReceived = 0;
+				while (nReceived < sData.GetLength()) {
+					const int nBytes = cSockets[i].Receive(&szBuffer[nReceived], 63 - nReceived);
+					if (nBytes <= 0)
+						break;
+					nReceived += nBytes;
+				}
+				szBuffer[nReceived] = '\0';
+				CHECK_EQUAL(sData, String(szBuffer));
+			}
+
+			for (uint32 i=0; i<NumOfSockets; i++)
+				cSockets[i].Close();
+			cHost.Close();
+		}
+	}
+
+	TEST(Disconnect_IOThreads) {
+		if (Reactor::IsSupported()) {
+			EchoConnection::nNumOfConnects	  = 0;
+			EchoConnection::nNumOfDisconnects = 0;
+			EchoHost cHost;
+			cHost.SetNumOfIOThreads(2);
+			const uint32 nPort = GetFreePort();
+			CHECK(nPort);
+			cHost.Listen(nPort);
+			Socket cSocket1, cSocket2;
+			CHECK(cSocket1.Connect("127.0.0.1", nPort));
+			CHECK(cSocket2.Connect("127.0.0.1", nPort));
+			CHECK(WaitFor(EchoConnection::nNumOfConnects, 2));
+
+			// The I/O thread detects that the other side has closed the connection
+			cSocket1.Close();
+			CHECK(WaitFor(EchoConnection::nNumOfDisconnects, 1));
+			cHost.RemoveInactiveConnections();
+			CHECK_EQUAL(1U, cHost.GetConnections().GetNumOfElements());
+
+			// The user closes the remaining connection, the other side receives the end of the stream
+			Connection *pConnection = cHost.GetConnections().Get(0);
+			CHECK(pConnection && pConnection->Disconnect());
+			CHECK_EQUAL(2U, EchoConnection::nNumOfDisconnects);
+			char szBuffer[16];
+			CHECK(cSocket2.Receive(szBuffer, 16) <= 0);
+			cHost.RemoveInactiveConnections();
+			CHECK_EQUAL(0U, cHost.GetConnections().GetNumOfElements());
+
+			cSocket2.Close();
+			cHost.Close();
+		}
+	}
+
+	TEST(RemoveConnection_OtherIOThread) {
+		if (Reactor::IsSupported()) {
+			PairHost cHost;
+			cHost.SetNumOfIOThreads(2);
+			const uint32 nPort = GetFreePort();
+			CHECK(nPort);
+			cHost.Listen(nPort);
+			Socket cSocket1, cSocket2;
+			CHECK(cSocket1.Connect("127.0.0.1", nPort));
+			CHECK(cSocket2.Connect("127.0.0.1", nPort));
+			CHECK(WaitFor(PairConnection::nNumOfConnections, 2));
+
+			// Each I/O thread removes the connection of the other I/O thread while it's dispatching events, this must not deadlock
+			CHECK_EQUAL(1, cSocket1.Send("x", 1));
+			CHECK_EQUAL(1, cSocket2.Send("x", 1));
+			CHECK(WaitFor(PairConnection::nNumOfLeft, 2));
+			CHECK(!PairConnection::pConnections[0]->IsConnected());
+			CHECK(!PairConnection::pConnections[1]->IsConnected());
+
+			// Both connections were closed
+			char szBuffer[16];
+			CHECK(cSocket1.Receive(szBuffer, 16) <= 0);
+			CHECK(cSocket2.Receive(szBuffer, 16) <= 0);
+			cHost.RemoveInactiveConnections();
+			CHECK_EQUAL(0U, cHost.GetConnections().GetNumOfElements());
+
+			cSocket1.Close();
+			cSocket2.Close();
+			cHost.Close();
+		}
+	}
+}
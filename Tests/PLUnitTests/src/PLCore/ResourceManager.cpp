@@ -1,82 +1,239 @@
-//[-------------------------------------------------------]
-//[ Includes                                              ]
-//[-------------------------------------------------------]
-#include <UnitTest++/UnitTest++.h>
-#include <PLCore/String/String.h>
-#include <PLCore/Container/ResourceManager.h>
-#include "UnitTest++AddIns/PLCheckMacros.h"
-#include "UnitTest++AddIns/PLChecks.h"
-
-using namespace PLCore;
-
-/*
-* Naming Convention for SUITE:
-* CLASSNAME
-*/
-SUITE(ResourceManager) {
-	/*
-	* Naming Convention for METHOD:
-	* METHODNAME_SCENARIO
-	*/
-
-	//[-------------------------------------------------------]
-	//[ Classes                                               ]
-	//[-------------------------------------------------------]
-	class MiniClass : public Resource<MiniClass> {
-	public:
-		int i;
-		MiniClass(const String &sName, ResourceManager<MiniClass> *pManager) :
-		Resource<MiniClass>(sName, pManager)
-		{
-			i = 0;
-		}
-	};
-
-	class MyManager : public ResourceManager<MiniClass> {
-	private:
-		virtual MiniClass *CreateResource(const String &sName)
-		{
-			return new MiniClass(sName, this);
-		}
-	};
-
-	// Our Array Test Fixture :)
-	struct ConstructTest
-	{
-		ConstructTest()
-		{
-			/* some setup */
-		}
-		~ConstructTest() {
-			/* some teardown */
-		}
-
-		// testing objects
-		MyManager lstManager;
-	};
-
-	TEST_FIXTURE(ConstructTest, ResourceManager) {
-		// Create resources
-		MiniClass *pMini0 = lstManager.Create("Mini 0");
-		MiniClass *pMini1 = lstManager.Create("Mini 1");
-		MiniClass *pMini2 = lstManager.Create("Mini 2");
-
-		CHECK(pMini0);
-		CHECK(pMini1);
-		CHECK(pMini2);
-
-		CHECK_EQUAL(3U, lstManager.GetNumOfElements());
-
-		CHECK_EQUAL(pMini0, lstManager.GetByIndex(0));
-		CHECK_EQUAL(pMini0, lstManager.GetByName("Mini 0"));
-		CHECK_EQUAL(pMini1, lstManager.GetByIndex(1));
-		CHECK_EQUAL(pMini1, lstManager.GetByName("Mini 1"));
-		CHECK_EQUAL(pMini2, lstManager.GetByIndex(2));
-		CHECK_EQUAL(pMini2, lstManager.GetByName("Mini 2"));
-
-		CHECK(lstManager.Clear());
-		CHECK(!lstManager.GetNumOfElements());
-	}
-
-
-}
\ No newline at end of file
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include <UnitTest++/UnitTest++.h>
+#include <PLCore/String/String.h>
+#include <PLCore/System/System.h>
+#include <PLCore/File/File.h>
+#include <PLCore/Tools/LoadableManager.h>
+#include <PLCore/Container/ResourceManager.h>
+#include "UnitTest++AddIns/PLCheckMacros.h"
+#include "UnitTest++AddIns/PLChecks.h"
+
+using namespace PLCore;
+
+/*
+* Naming Convention for SUITE:
+* CLASSNAME
+*/
+SUITE(ResourceManager) {
+	/*
+	* Naming Convention for METHOD:
+	* METHODNAME_SCENARIO
+	*/
+
+	//[-------------------------------------------------------]
+	//[ Classes                                               ]
+	//[-------------------------------------------------------]
+	class MiniClass : public Resource<MiniClass> {
+	public:
+		int i;
+		MiniClass(const String &sName, ResourceManager<MiniClass> *pManager) :
+		Resource<MiniClass>(sName, pManager)
+		{
+			i = 0;
+		}
+	};
+
+	class MyManager : public ResourceManager<MiniClass> {
+	private:
+		virtual MiniClass *CreateResource(const String &sName)
+		{
+			return new MiniClass(sName, this);
+		}
+	};
+
+	// Resource which can be loaded asynchronously, it just remembers the content of the loaded file
+	class LoadableClass : public Resource<LoadableClass> {
+	public:
+		String sContent;
+		LoadableClass(const String &sName, ResourceManager<LoadableClass> *pManager) :
+		Resource<LoadableClass>(sName, pManager)
+		{
+		}
+		virtual bool LoadByFile(File &cFile, const String &sParams = "", const String &sMethod = "") override
+		{
+			sContent = cFile.GetContentAsString();
+			return true;
+		}
+	};
+
+	class LoadableManagerClass : public ResourceManager<LoadableClass> {
+	public:
+		LoadableManagerClass()
+		{
+			SetStandard(Create("Standard"));
+		}
+	private:
+		virtual LoadableClass *CreateResource(const String &sName) override
+		{
+			return new LoadableClass(sName, this);
+		}
+	};
+
+	// Manager decoding the file content by a worker thread, only the decoded content is given to the resource by the owning thread
+	class DecodingManagerClass : public LoadableManagerClass {
+	public:
+		handle nOwnerThreadID;
+		bool bDecodedByOtherThread;
+		DecodingManagerClass() :
+			nOwnerThreadID(System::GetInstance()->GetCurrentThreadID()),
+			bDecodedByOtherThread(false)
+		{
+		}
+	private:
+		class DecodingLoadRequest : public ResourceLoadRequest {
+		public:
+			String sDecodedContent;
+			handle nDecodeThreadID;
+			DecodingLoadRequest(DecodingManagerClass &cManager, LoadableClass &cResource, const String &sFilename, float fPriority) :
+				ResourceLoadRequest(cManager, cResource, sFilename, fPriority),
+				nDecodeThreadID(0)
+			{
+			}
+		protected:
+			virtual bool OnDecode() override
+			{
+				sDecodedContent = GetFile().GetContentAsString();
+				nDecodeThreadID = System::GetInstance()->GetCurrentThreadID();
+				return true;
+			}
+			virtual bool OnFinalize() override
+			{
+				if (!m_pResource)
+					return false;
+				static_cast<DecodingManagerClass*>(m_pManager)->bDecodedByOtherThread = (nDecodeThreadID && nDecodeThreadID != static_cast<DecodingManagerClass*>(m_pManager)->nOwnerThreadID);
+				m_pResource->sContent = sDecodedContent;
+				return true;
+			}
+		};
+		virtual ResourceLoadRequest *CreateLoadRequest(LoadableClass &cResource, const String &sFilename, float fPriority) override
+		{
+			return new DecodingLoadRequest(*this, cResource, sFilename, fPriority);
+		}
+	};
+
+	// Updates the asynchronous loading until all requests are destroyed, returns 'false' on timeout
+	bool WaitForAsyncRequests()
+	{
+		LoadableManager *pLoadableManager = LoadableManager::GetInstance();
+		for (uint32 i=0; i<1000 && pLoadableManager->GetNumOfAsyncRequests(); i++) {
+			pLoadableManager->UpdateAsync();
+			System::GetInstance()->Sleep(5);
+		}
+		return !pLoadableManager->GetNumOfAsyncRequests();
+	}
+
+	// Our Array Test Fixture :)
+	struct ConstructTest
+	{
+		ConstructTest()
+		{
+			/* some setup */
+		}
+		~ConstructTest() {
+			/* some teardown */
+		}
+
+		// testing objects
+		MyManager lstManager;
+	};
+
+	TEST_FIXTURE(ConstructTest, ResourceManager) {
+		// Create resources
+		MiniClass *pMini0 = lstManager.Create("Mini 0");
+		MiniClass *pMini1 = lstManager.Create("Mini 1");
+		MiniClass *pMini2 = lstManager.Create("Mini 2");
+
+		CHECK(pMini0);
+		CHECK(pMini1);
+		CHECK(pMini2);
+
+		CHECK_EQUAL(3U, lstManager.GetNumOfElements());
+
+		CHECK_EQUAL(pMini0, lstManager.GetByIndex(0));
+		CHECK_EQUAL(pMini0, lstManager.GetByName("Mini 0"));
+		CHECK_EQUAL(pMini1, lstManager.GetByIndex(1));
+		CHECK_EQUAL(pMini1, lstManager.GetByName("Mini 1"));
+		CHECK_EQUAL(pMini2, lstManager.GetByIndex(2));
+		CHECK_EQUAL(pMini2, lstManager.GetByName("Mini 2"));
+
+		CHECK(lstManager.Clear());
+		CHECK(!lstManager.GetNumOfElements());
+	}
+
+	TEST(LoadResourceAsync) {
+		LoadableManager *pLoadableManager = LoadableManager::GetInstance();
+		const String sBaseDir = "../Data/unitTestData/FileSystemTest.zip/";
+		CHECK(pLoadableManager->AddBaseDir(sBaseDir));
+
+		LoadableManagerClass cManager;
+		LoadableClass *pStandard = cManager.GetStandard();
+		LoadableClass *pResource = cManager.LoadResourceAsync("aTestLog.txt");
+		CHECK(pResource);
+		if (pResource) {
+			// The resource is finalized by "LoadableManager::UpdateAsync()", until then the standard resource is used
+			CHECK(cManager.IsResourceLoading(*pResource));
+			CHECK_EQUAL(pStandard, &cManager.GetUsableResource(*pResource));
+			CHECK_EQUAL(pResource, cManager.LoadResourceAsync("aTestLog.txt"));
+			CHECK(cManager.SetLoadPriority(*pResource, 1.0f));
+
+			CHECK(WaitForAsyncRequests());
+			CHECK(!cManager.IsResourceLoading(*pResource));
+			CHECK_EQUAL(pResource, &cManager.GetUsableResource(*pResource));
+			CHECK_EQUAL(pLoadableManager->LoadStringFromFile("aTestLog.txt"), pResource->sContent);
+		}
+
+		CHECK(pLoadableManager->RemoveBaseDir(sBaseDir));
+	}
+
+	TEST(LoadResourceAsync_Decode) {
+		LoadableManager *pLoadableManager = LoadableManager::GetInstance();
+		const String sBaseDir = "../Data/unitTestData/FileSystemTest.zip/";
+		CHECK(pLoadableManager->AddBaseDir(sBaseDir));
+
+		// Each resource knows whether or not it's loading, also when there are multiple requests
+		DecodingManagerClass cManager;
+		LoadableClass *pResource = cManager.LoadResourceAsync("aTestLog.txt");
+		LoadableClass *pMissingResource = cManager.LoadResourceAsync("ThisFileDoesNotExist.txt");
+		CHECK(pResource);
+		CHECK(pMissingResource);
+		if (pResource && pMissingResource) {
+			CHECK(cManager.IsResourceLoading(*pResource));
+			CHECK(cManager.IsResourceLoading(*pMissingResource));
+			CHECK(!cManager.IsResourceLoading(*cManager.GetStandard()));
+
+			// The file content is decoded by another thread and given to the resource by the owning thread
+			CHECK(WaitForAsyncRequests());
+			CHECK(!cManager.IsResourceLoading(*pResource));
+			CHECK(!cManager.IsResourceLoading(*pMissingResource));
+			CHECK(cManager.bDecodedByOtherThread);
+			CHECK_EQUAL(pLoadableManager->LoadStringFromFile("aTestLog.txt"), pResource->sContent);
+			CHECK_EQUAL("", pMissingResource->sContent);
+		}
+
+		CHECK(pLoadableManager->RemoveBaseDir(sBaseDir));
+	}
+
+	TEST(LoadResourceAsync_DeleteResource) {
+		LoadableManagerClass cManager;
+		LoadableClass *pResource = cManager.LoadResourceAsync("../Data/unitTestData/FileSystemTest.zip/aTestLog.txt");
+		CHECK(pResource);
+
+		// Destroying the resource cancels its request
+		delete pResource;
+		CHECK(WaitForAsyncRequests());
+		CHECK_EQUAL(1U, cManager.GetNumOfElements());
+	}
+
+	TEST(LoadResourceAsync_DeleteManager) {
+		LoadableManagerClass *pManager = new LoadableManagerClass();
+		CHECK(pManager->LoadResourceAsync("../Data/unitTestData/FileSystemTest.zip/aTestLog.txt"));
+		CHECK(pManager->LoadResourceAsync("ThisFileDoesNotExist.txt"));
+		CHECK_EQUAL(2U, LoadableManager::GetInstance()->GetNumOfAsyncRequests());
+
+		// The requests are canceled and no longer know the destroyed manager
+		delete pManager;
+		CHECK(WaitForAsyncRequests());
+	}
+}
@@ -0,0 +1,112 @@
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include <UnitTest++/UnitTest++.h>
+#include <PLCore/System/System.h>
+#include <PLCore/Tools/LoadRequest.h>
+#include <PLCore/Tools/LoadableManager.h>
+
+#include "UnitTest++AddIns/PLCheckMacros.h"
+#include "UnitTest++AddIns/PLChecks.h"
+
+using namespace PLCore;
+
+/*
+* Naming Convention for SUITE:
+* CLASSNAME
+*/
+SUITE(LoadRequest) {
+	/*
+	* Naming Convention for METHOD:
+	* METHODNAME_SCENARIO
+	*/
+
+	//[-------------------------------------------------------]
+	//[ Classes                                               ]
+	//[-------------------------------------------------------]
+	// Load request remembering what happened to it, the results are written into the given variables because the request is destroyed by the loadable manager
+	class TestRequest : public LoadRequest {
+	public:
+		TestRequest(const String &sFilename, bool &bDecoded, bool &bFailed, String &sContent) : LoadRequest(sFilename),
+			m_bDecoded(bDecoded),
+			m_bFailed(bFailed),
+			m_sContent(sContent)
+		{
+		}
+	protected:
+		virtual bool OnDecode() override
+		{
+			m_bDecoded = true;
+			return true;
+		}
+		virtual bool OnFinalize() override
+		{
+			m_sContent = GetFile().GetContentAsString();
+			return true;
+		}
+		virtual void OnFailure() override
+		{
+			m_bFailed = true;
+		}
+	private:
+		bool   &m_bDecoded;
+		bool   &m_bFailed;
+		String &m_sContent;
+	};
+
+	// Updates the asynchronous loading until all requests are destroyed, returns 'false' on timeout
+	bool WaitForAsyncRequests()
+	{
+		LoadableManager *pLoadableManager = LoadableManager::GetInstance();
+		for (uint32 i=0; i<1000 && pLoadableManager->GetNumOfAsyncRequests(); i++) {
+			pLoadableManager->UpdateAsync();
+			System::GetInstance()->Sleep(5);
+		}
+		return !pLoadableManager->GetNumOfAsyncRequests();
+	}
+
+	TEST(LoadAsync) {
+		LoadableManager *pLoadableManager = LoadableManager::GetInstance();
+		const String sBaseDir = "../Data/unitTestData/FileSystemTest.zip/";
+		CHECK(pLoadableManager->AddBaseDir(sBaseDir));
+
+		bool bDecoded = false;
+		bool bFailed = false;
+		String sContent;
+		CHECK(pLoadableManager->LoadAsync(new TestRequest("aTestLog.txt", bDecoded, bFailed, sContent)));
+		CHECK(WaitForAsyncRequests());
+		CHECK(bDecoded);
+		CHECK(!bFailed);
+		CHECK_EQUAL(pLoadableManager->LoadStringFromFile("aTestLog.txt"), sContent);
+
+		CHECK(pLoadableManager->RemoveBaseDir(sBaseDir));
+	}
+
+	TEST(LoadAsync_Failure) {
+		LoadableManager *pLoadableManager = LoadableManager::GetInstance();
+		bool bDecoded = false;
+		bool bFailed = false;
+		String sContent;
+		CHECK(pLoadableManager->LoadAsync(new TestRequest("ThisFileDoesNotExist.txt", bDecoded, bFailed, sContent)));
+		CHECK(WaitForAsyncRequests());
+		CHECK(!bDecoded);
+		CHECK(bFailed);
+		CHECK_EQUAL("", sContent);
+		CHECK(!pLoadableManager->LoadAsync(nullptr));
+	}
+
+	TEST(CancelAsync) {
+		LoadableManager *pLoadableManager = LoadableManager::GetInstance();
+		bool bDecoded = false;
+		bool bFailed = false;
+		String sContent;
+		TestRequest *pRequest = new TestRequest("../Data/unitTestData/FileSystemTest.zip/aTestLog.txt", bDecoded, bFailed, sContent);
+		CHECK(pLoadableManager->LoadAsync(pRequest));
+		pLoadableManager->CancelAsync(*pRequest);
+
+		// A canceled request is neither finalized nor is a failure reported
+		CHECK(WaitForAsyncRequests());
+		CHECK(!bFailed);
+		CHECK_EQUAL("", sContent);
+	}
+}
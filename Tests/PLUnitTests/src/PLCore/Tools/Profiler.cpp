@@ -0,0 +1,172 @@
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include <UnitTest++/UnitTest++.h>
+#include <PLCore/File/File.h>
+#include <PLCore/System/Thread.h>
+#include <PLCore/Tools/Profiler.h>
+
+using namespace PLCore;
+
+// Zone and counter names, the profiler only stores the pointers
+static const char *ProfilerOuterZone	= "Outer zone";
+static const char *ProfilerInnerZone	= "Inner zone";
+static const char *ProfilerCounter		= "Counter";
+static const char *ProfilerThreadZone	= "Thread zone";
+
+// Thread function recording more events than its ring buffer can hold
+int RecordZonesFunction(void *pData)
+{
+	Profiler *pProfiler = static_cast<Profiler*>(pData);
+	for (int i=0; i<100; i++) {
+		pProfiler->BeginZone(ProfilerThreadZone);
+		pProfiler->BeginZone(ProfilerThreadZone);
+		pProfiler->EndZone();
+		pProfiler->EndZone();
+	}
+	return 0;
+}
+
+// Returns the index of the first captured event with the given type and name, -1 if there's no such event
+int FindEvent(const Array<Profiler::Event> &lstCapture, uint32 nType, const char *pszName)
+{
+	for (uint32 i=0; i<lstCapture.GetNumOfElements(); i++) {
+		const Profiler::Event &sEvent = lstCapture[i];
+		if (sEvent.nType == nType && sEvent.pszName == pszName)
+			return static_cast<int>(i);
+	}
+	return -1;
+}
+
+/*
+* Naming Convention for SUITE:
+* CLASSNAME
+*/
+SUITE(Profiler) {
+	/*
+	* Naming Convention for METHOD:
+	* METHODNAME_SCENARIO
+	*/
+
+	TEST(Disabled) {
+		Profiler *pProfiler = Profiler::GetInstance();
+		CHECK(pProfiler);
+		pProfiler->SetEnabled(false);
+		CHECK(!Profiler::GetRecordingInstance());
+
+		// Nothing must be recorded
+		pProfiler->SetCapturing(true);
+		pProfiler->ClearCapture();
+		{
+			PL_PROFILE_ZONE(ProfilerOuterZone);
+			PL_PROFILE_COUNTER(ProfilerCounter, 1);
+		}
+		pProfiler->Collect();
+		CHECK_EQUAL(0U, pProfiler->GetCapture().GetNumOfElements());
+		pProfiler->SetCapturing(false);
+	}
+
+	TEST(Zones_Counters) {
+		Profiler *pProfiler = Profiler::GetInstance();
+		pProfiler->SetEnabled(true);
+		CHECK(Profiler::GetRecordingInstance() == pProfiler);
+		pProfiler->Collect();
+		pProfiler->SetCapturing(true);
+		pProfiler->ClearCapture();
+		{
+			PL_PROFILE_ZONE(ProfilerOuterZone);
+			{
+				PL_PROFILE_ZONE(ProfilerInnerZone);
+			}
+			PL_PROFILE_COUNTER(ProfilerCounter, 42);
+		}
+		pProfiler->Collect();
+		pProfiler->SetCapturing(false);
+		pProfiler->SetEnabled(false);
+
+		// Check the recorded order: outer begin, inner begin, inner end, counter, outer end
+		const Array<Profiler::Event> &lstCapture = pProfiler->GetCapture();
+		CHECK_EQUAL(5U, lstCapture.GetNumOfElements());
+		const int nOuter = FindEvent(lstCapture, Profiler::ZoneBegin, ProfilerOuterZone);
+		CHECK_EQUAL(0, nOuter);
+		if (nOuter == 0 && lstCapture.GetNumOfElements() == 5) {
+			CHECK_EQUAL(static_cast<uint32>(Profiler::ZoneBegin), lstCapture[1].nType);
+			CHECK(lstCapture[1].pszName == ProfilerInnerZone);
+			CHECK_EQUAL(static_cast<uint32>(Profiler::ZoneEnd), lstCapture[2].nType);
+			CHECK_EQUAL(static_cast<uint32>(Profiler::Counter), lstCapture[3].nType);
+			CHECK_EQUAL(42.0, lstCapture[3].dValue);
+			CHECK_EQUAL(static_cast<uint32>(Profiler::ZoneEnd), lstCapture[4].nType);
+
+			// Timestamps must be monotonic
+			for (uint32 i=1; i<lstCapture.GetNumOfElements(); i++)
+				CHECK(lstCapture[i].nTimestamp >= lstCapture[i - 1].nTimestamp);
+		}
+		pProfiler->ClearCapture();
+	}
+
+	TEST(DroppedEvents) {
+		Profiler *pProfiler = Profiler::GetInstance();
+		const uint32 nThreadBufferSize = pProfiler->GetThreadBufferSize();
+		pProfiler->SetThreadBufferSize(15);
+		CHECK_EQUAL(16U, pProfiler->GetThreadBufferSize());
+		pProfiler->SetEnabled(true);
+		pProfiler->SetCapturing(true);
+		pProfiler->ClearCapture();
+		const uint32 nNumOfDroppedEvents = pProfiler->GetNumOfDroppedEvents();
+
+		// Record 400 events within a new thread using the small ring buffer
+		Thread cThread(&RecordZonesFunction, pProfiler);
+		cThread.Start();
+		cThread.Join();
+		pProfiler->Collect();
+		pProfiler->SetCapturing(false);
+		pProfiler->SetEnabled(false);
+		pProfiler->SetThreadBufferSize(nThreadBufferSize);
+		CHECK(pProfiler->GetNumOfDroppedEvents() > nNumOfDroppedEvents);
+
+		// Zones are never left half recorded
+		const Array<Profiler::Event> &lstCapture = pProfiler->GetCapture();
+		CHECK(lstCapture.GetNumOfElements() > 0 && lstCapture.GetNumOfElements() <= 16);
+		int nDepth = 0;
+		bool bValid = true;
+		for (uint32 i=0; i<lstCapture.GetNumOfElements(); i++) {
+			if (lstCapture[i].nType == Profiler::ZoneBegin)
+				nDepth++;
+			else if (lstCapture[i].nType == Profiler::ZoneEnd && --nDepth < 0)
+				bValid = false;
+		}
+		CHECK(bValid);
+		CHECK_EQUAL(0, nDepth);
+		pProfiler->ClearCapture();
+	}
+
+	TEST(ExportChromeTrace) {
+		Profiler *pProfiler = Profiler::GetInstance();
+		pProfiler->SetEnabled(true);
+		pProfiler->SetCapturing(true);
+		pProfiler->ClearCapture();
+		pProfiler->SetThreadName("Main");
+		{
+			PL_PROFILE_ZONE(ProfilerOuterZone);
+			PL_PROFILE_COUNTER(ProfilerCounter, 1);
+		}
+		pProfiler->Collect();
+		pProfiler->SetCapturing(false);
+		pProfiler->SetEnabled(false);
+
+		const String sFilename = "ProfilerTrace.json";
+		CHECK(pProfiler->ExportChromeTrace(sFilename));
+		File cFile(sFilename);
+		CHECK(cFile.Exists());
+		if (cFile.Open(File::FileRead)) {
+			const String sContent = cFile.GetContentAsString();
+			cFile.Close();
+			CHECK(sContent.IndexOf("\"traceEvents\"") >= 0);
+			CHECK(sContent.IndexOf("\"Outer zone\"") >= 0);
+			CHECK(sContent.IndexOf("\"Counter\"") >= 0);
+			CHECK(sContent.IndexOf("\"Main\"") >= 0);
+		}
+		cFile.Delete();
+		pProfiler->ClearCapture();
+	}
+}
@@ -0,0 +1,214 @@
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include <UnitTest++/UnitTest++.h>
+#include <PLCore/System/JobSystem.h>
+#include <PLMath/Vector3i.h>
+#include <PLGraphics/Image/ImageBuffer.h>
+#include <PLGraphics/Image/Effects/IEScale.h>
+#include <PLGraphics/Image/Effects/IEConvert.h>
+
+using namespace PLCore;
+using namespace PLMath;
+using namespace PLGraphics;
+
+/*
+* Naming Convention for SUITE:
+* CLASSNAME
+*/
+SUITE(ImageEffects) {
+	/*
+	* Naming Convention for METHOD:
+	* METHODNAME_SCENARIO
+	*/
+
+	// Creates an image buffer filled with a pattern, float values are partly outside [0, 255] to test the saturation
+	void CreateImageBuffer(ImageBuffer &cImageBuffer, EDataFormat nDataFormat, EColorFormat nColorFormat, int nWidth, int nHeight)
+	{
+		cImageBuffer.CreateImage(nDataFormat, nColorFormat, Vector3i(nWidth, nHeight, 1));
+		if (nDataFormat == DataFloat) {
+			float *pfData = reinterpret_cast<float*>(cImageBuffer.GetData());
+			const uint32 nNumOfValues = cImageBuffer.GetDataSize()/sizeof(float);
+			for (uint32 i=0; i<nNumOfValues; i++)
+				pfData[i] = static_cast<float>(static_cast<int>((i*7 + i/nWidth)%300) - 20) + 0.5f;
+		} else {
+			uint8 *pnData = cImageBuffer.GetData();
+			for (uint32 i=0; i<cImageBuffer.GetDataSize(); i++)
+				pnData[i] = static_cast<uint8>(i*7 + i/nWidth);
+		}
+	}
+
+	// Applies the given image effect to a copy of the given image buffer, either in the parallel execution mode using worker threads
+	// and SIMD kernels or in the serial execution mode using the generic code
+	void Apply(ImageEffect &cImageEffect, const ImageBuffer &cSourceImageBuffer, ImageBuffer &cImageBuffer, bool bParallel)
+	{
+		JobSystem::GetInstance()->SetNumOfWorkers(bParallel ? 3 : 0);
+		cImageEffect.SetParallel(bParallel);
+		cImageBuffer = cSourceImageBuffer;
+		cImageBuffer.ApplyEffect(cImageEffect);
+	}
+
+	// Returns the number of different bytes of the given image buffers, or the data size if the formats are different
+	uint32 GetNumOfDifferences(const ImageBuffer &cFirst, const ImageBuffer &cSecond)
+	{
+		if (cFirst.GetDataFormat() != cSecond.GetDataFormat() || cFirst.GetColorFormat() != cSecond.GetColorFormat() ||
+			cFirst.GetSize() != cSecond.GetSize() || cFirst.GetDataSize() != cSecond.GetDataSize())
+			return cFirst.GetDataSize() ? cFirst.GetDataSize() : 1;
+		uint32 nDifferences = 0;
+		for (uint32 i=0; i<cFirst.GetDataSize(); i++) {
+			if (cFirst.GetData()[i] != cSecond.GetData()[i])
+				nDifferences++;
+		}
+		return nDifferences;
+	}
+
+	// Checks that the parallel execution mode produces exactly the same result as the serial execution mode
+	void CheckParallel(ImageEffect &cImageEffect, const ImageBuffer &cSourceImageBuffer, ImageBuffer &cResult)
+	{
+		ImageBuffer cReference;
+		Apply(cImageEffect, cSourceImageBuffer, cReference, false);
+		Apply(cImageEffect, cSourceImageBuffer, cResult, true);
+		CHECK(cResult.HasData());
+		CHECK_EQUAL(0U, GetNumOfDifferences(cReference, cResult));
+	}
+
+	// Converts an image using both execution modes
+	void CheckConvert(EDataFormat nDataFormat, EColorFormat nColorFormat, EDataFormat nNewDataFormat, EColorFormat nNewColorFormat, ImageBuffer &cSource, ImageBuffer &cResult)
+	{
+		// Odd width so that the SIMD kernels have to deal with remaining pixels
+		CreateImageBuffer(cSource, nDataFormat, nColorFormat, 517, 300);
+		IEConvert cConvert(nNewDataFormat, nNewColorFormat);
+		CheckParallel(cConvert, cSource, cResult);
+		CHECK_EQUAL(nNewDataFormat, cResult.GetDataFormat());
+		CHECK_EQUAL(nNewColorFormat, cResult.GetColorFormat());
+	}
+
+	// Scales an image down using both execution modes
+	void CheckScale(EDataFormat nDataFormat, EColorFormat nColorFormat, int nWidth, int nHeight, int nNewWidth, int nNewHeight, IEScale::EFilter nFilter, ImageBuffer &cSource, ImageBuffer &cResult)
+	{
+		CreateImageBuffer(cSource, nDataFormat, nColorFormat, nWidth, nHeight);
+		IEScale cScale(Vector3i(nNewWidth, nNewHeight, 1), false, nFilter);
+		CheckParallel(cScale, cSource, cResult);
+		CHECK(cResult.GetSize() == Vector3i(nNewWidth, nNewHeight, 1));
+	}
+
+	TEST(IEConvert_Byte_RGBA_BGRA) {
+		ImageBuffer cSource, cResult;
+		CheckConvert(DataByte, ColorRGBA, DataByte, ColorBGRA, cSource, cResult);
+
+		// Red and blue are swapped
+		uint32 nErrors = 0;
+		for (uint32 nPixel=0; nPixel<cSource.GetNumOfPixels(); nPixel++) {
+			const uint8 *pnOld = &cSource.GetData()[nPixel*4];
+			const uint8 *pnNew = &cResult.GetData()[nPixel*4];
+			if (pnNew[0] != pnOld[2] || pnNew[1] != pnOld[1] || pnNew[2] != pnOld[0] || pnNew[3] != pnOld[3])
+				nErrors++;
+		}
+		CHECK_EQUAL(0U, nErrors);
+	}
+
+	TEST(IEConvert_Byte_BGRA_RGBA) {
+		ImageBuffer cSource, cResult;
+		CheckConvert(DataByte, ColorBGRA, DataByte, ColorRGBA, cSource, cResult);
+	}
+
+	TEST(IEConvert_Byte_RGB_RGBA) {
+		ImageBuffer cSource, cResult;
+		CheckConvert(DataByte, ColorRGB, DataByte, ColorRGBA, cSource, cResult);
+	}
+
+	TEST(IEConvert_Byte_RGB_Grayscale) {
+		ImageBuffer cSource, cResult;
+		CheckConvert(DataByte, ColorRGB, DataByte, ColorGrayscale, cSource, cResult);
+	}
+
+	TEST(IEConvert_Byte_Float_RGBA) {
+		ImageBuffer cSource, cResult;
+		CheckConvert(DataByte, ColorRGBA, DataFloat, ColorRGBA, cSource, cResult);
+
+		// The float range is the same as the byte range
+		uint32 nErrors = 0;
+		const float *pfNew = reinterpret_cast<const float*>(cResult.GetData());
+		for (uint32 i=0; i<cSource.GetDataSize(); i++) {
+			if (pfNew[i] != static_cast<float>(cSource.GetData()[i]))
+				nErrors++;
+		}
+		CHECK_EQUAL(0U, nErrors);
+	}
+
+	TEST(IEConvert_Float_Byte_RGBA) {
+		ImageBuffer cSource, cResult;
+		CheckConvert(DataFloat, ColorRGBA, DataByte, ColorRGBA, cSource, cResult);
+
+		// Values are truncated, values outside [0, 255] are saturated
+		uint32 nErrors = 0;
+		const float *pfOld = reinterpret_cast<const float*>(cSource.GetData());
+		for (uint32 i=0; i<cResult.GetDataSize(); i++) {
+			const uint8 nExpected = (pfOld[i] <= 0.0f) ? 0 : ((pfOld[i] >= 255.0f) ? 255 : static_cast<uint8>(pfOld[i]));
+			if (cResult.GetData()[i] != nExpected)
+				nErrors++;
+		}
+		CHECK_EQUAL(0U, nErrors);
+	}
+
+	TEST(IEScale_Byte_RGB_Weighted3x3) {
+		ImageBuffer cSource, cResult;
+		CheckScale(DataByte, ColorRGB, 512, 512, 256, 256, IEScale::Weighted3x3, cSource, cResult);
+	}
+
+	TEST(IEScale_Byte_RGBA_Weighted3x3) {
+		ImageBuffer cSource, cResult;
+		CheckScale(DataByte, ColorRGBA, 512, 512, 256, 256, IEScale::Weighted3x3, cSource, cResult);
+	}
+
+	TEST(IEScale_Byte_RGBA_Box_Half) {
+		ImageBuffer cSource, cResult;
+		CheckScale(DataByte, ColorRGBA, 514, 300, 257, 150, IEScale::Box, cSource, cResult);
+
+		// Average of the 2x2 original pixels, rounded down
+		uint32 nErrors = 0;
+		const uint8 *pnOld = cSource.GetData();
+		for (uint32 nY=0; nY<150; nY++) {
+			for (uint32 nX=0; nX<257; nX++) {
+				for (uint32 nComponent=0; nComponent<4; nComponent++) {
+					const uint32 nSum = pnOld[((nY*2  )*514 + nX*2)*4 + nComponent] + pnOld[((nY*2  )*514 + nX*2 + 1)*4 + nComponent] +
+										pnOld[((nY*2+1)*514 + nX*2)*4 + nComponent] + pnOld[((nY*2+1)*514 + nX*2 + 1)*4 + nComponent];
+					if (cResult.GetData()[(nY*257 + nX)*4 + nComponent] != nSum/4)
+						nErrors++;
+				}
+			}
+		}
+		CHECK_EQUAL(0U, nErrors);
+	}
+
+	TEST(IEScale_Byte_RGBA_Bilinear_Half) {
+		ImageBuffer cSource, cResult;
+		CheckScale(DataByte, ColorRGBA, 514, 300, 257, 150, IEScale::Bilinear, cSource, cResult);
+
+		// At the exact half size, the bilinear filter gives the same result as the box filter
+		ImageBuffer cBox;
+		IEScale cScale(Vector3i(257, 150, 1), false, IEScale::Box);
+		Apply(cScale, cSource, cBox, false);
+		CHECK_EQUAL(0U, GetNumOfDifferences(cBox, cResult));
+	}
+
+	TEST(IEScale_Byte_RGBA_Box) {
+		ImageBuffer cSource, cResult;
+		CheckScale(DataByte, ColorRGBA, 512, 512, 200, 130, IEScale::Box, cSource, cResult);
+	}
+
+	TEST(IEScale_Byte_RGB_Bilinear) {
+		ImageBuffer cSource, cResult;
+		CheckScale(DataByte, ColorRGB, 512, 512, 200, 130, IEScale::Bilinear, cSource, cResult);
+	}
+
+	TEST(IEScale_Float_RGBA_Box) {
+		ImageBuffer cSource, cResult;
+		CheckScale(DataFloat, ColorRGBA, 512, 512, 256, 256, IEScale::Box, cSource, cResult);
+	}
+
+	TEST(IEScale_Float_RGBA_Weighted3x3) {
+		ImageBuffer cSource, cResult;
+		CheckScale(DataFloat, ColorRGBA, 512, 512, 256, 256, IEScale::Weighted3x3, cSource, cResult);
+	}
+}
@@ -3,6 +3,7 @@
 //[-------------------------------------------------------]
 #include <UnitTest++/UnitTest++.h>
 #include <PLMath/Graph/Graph.h>
+#include <PLMath/Graph/GraphPath.h>
 
 #include "UnitTest++AddIns/PLCheckMacros.h"
 #include "UnitTest++AddIns/PLChecks.h"
@@ -35,81 +36,157 @@ SUITE(Graph) {
 			/* some teardown */
 		}
 
+		//	Test graph:                  Shortest paths: ('source'->'target' = nodes to pass)
+		//
+		//	+------5------+              A->A: A
+		//	|             |              A->B: A->B
+		//	|  /-2--B--3--C--5-\         A->C: A->D->E->C
+		//	| /     |    /|     \        A->D: A->D
+		//	+-A     2 /3/ 1      F       A->E: A->D->E
+		//	  \     |/    |     /        A->F: A->D->E->F
+		//	   \-1--D--1--E--2-/
+		void CreateGraph() {
+			pNodeA = graph.Create("A");
+			pNodeB = graph.Create("B");
+			pNodeC = graph.Create("C");
+			pNodeD = graph.Create("D");
+			pNodeE = graph.Create("E");
+			pNodeF = graph.Create("F");
+
+			// Set node positions
+			if (bUsePosition) {
+				pNodeF->SetPos(19.0f, 0.0f, 2.0f);
+				pNodeA->SetPos( 0.0f, 0.0f, 2.0f);
+				pNodeB->SetPos( 6.0f, 0.0f, 0.0f);
+				pNodeC->SetPos(12.0f, 0.0f, 0.0f);
+				pNodeD->SetPos( 6.0f, 0.0f, 4.0f);
+				pNodeE->SetPos(12.0f, 0.0f, 4.0f);
+			}
+
+			// Setup node neighbours
+			// Node A (0)
+			pNodeA->AddNeighbour(*pNodeC, bUsePosition ? -1.0f : 5.0f);
+			pNodeA->AddNeighbour(*pNodeB, bUsePosition ? -1.0f : 2.0f);
+			pNodeA->AddNeighbour(*pNodeD, bUsePosition ? -1.0f : 1.0f);
+
+			// Node B (1)
+			pNodeB->AddNeighbour(*pNodeA, bUsePosition ? -1.0f : 2.0f);
+			pNodeB->AddNeighbour(*pNodeC, bUsePosition ? -1.0f : 3.0f);
+			pNodeB->AddNeighbour(*pNodeD, bUsePosition ? -1.0f : 2.0f);
+
+			// Node C (2)
+			pNodeC->AddNeighbour(*pNodeA, bUsePosition ? -1.0f : 5.0f);
+			pNodeC->AddNeighbour(*pNodeB, bUsePosition ? -1.0f : 3.0f);
+			pNodeC->AddNeighbour(*pNodeD, bUsePosition ? -1.0f : 3.0f);
+			pNodeC->AddNeighbour(*pNodeE, bUsePosition ? -1.0f : 1.0f);
+			pNodeC->AddNeighbour(*pNodeF, bUsePosition ? -1.0f : 5.0f);
+
+			// Node D (3)
+			pNodeD->AddNeighbour(*pNodeA, bUsePosition ? -1.0f : 1.0f);
+			pNodeD->AddNeighbour(*pNodeB, bUsePosition ? -1.0f : 2.0f);
+			pNodeD->AddNeighbour(*pNodeC, bUsePosition ? -1.0f : 3.0f);
+			pNodeD->AddNeighbour(*pNodeE, bUsePosition ? -1.0f : 1.0f);
+
+			// Node E (4)
+			pNodeE->AddNeighbour(*pNodeD, bUsePosition ? -1.0f : 1.0f);
+			pNodeE->AddNeighbour(*pNodeC, bUsePosition ? -1.0f : 1.0f);
+			pNodeE->AddNeighbour(*pNodeF, bUsePosition ? -1.0f : 2.0f);
+
+			// Node F (5)
+			pNodeF->AddNeighbour(*pNodeC, bUsePosition ? -1.0f : 5.0f);
+			pNodeF->AddNeighbour(*pNodeE, bUsePosition ? -1.0f : 2.0f);
+		}
+
+		// Returns the names of the nodes of a path, an empty string if there's no path (the path is destroyed)
+		PLCore::String GetPathNodes(PLMath::GraphPath *pPath) {
+			PLCore::String sNodes;
+			if (pPath) {
+				for (PLCore::uint32 i=0; i<pPath->GetNumOfNodes(); i++)
+					sNodes += pPath->GetNode(i)->GetName();
+				delete pPath;
+			}
+			return sNodes;
+		}
+
 		// Container for testing
 		PLMath::Graph graph;
 		PLMath::GraphNode *pNodeA, *pNodeB, *pNodeC, *pNodeD, *pNodeE, *pNodeF;
 		bool bUsePosition;
 	};
 
-	//	Test graph:                  Shortest paths: ('source'->'target' = nodes to pass)
-	//
-	//	+------5------+              A->A: A
-	//	|             |              A->B: A->B
-	//	|  /-2--B--3--C--5-\         A->C: A->D->C
-	//	| /     |    /|     \        A->D: A->D
-	//	+-A     2 /3/ 1      F       A->E: A->D->E
-	//	  \     |/    |     /        A->F: A->D->E->F
-	//	   \-1--D--1--E--2-/
-
-	// TODO: use this as test? It seems it wasn't completed in PLTestBase
-	/*
-	TEST_FIXTURE(ConstructTest, Test) {
-		pNodeA = graph.Create("A");
-		pNodeB = graph.Create("B");
-		pNodeC = graph.Create("C");
-		pNodeD = graph.Create("D");
-		pNodeE = graph.Create("E");
-		pNodeF = graph.Create("F");
-
-		// Set node positions
-		if (bUsePosition) {
-			pNodeF->SetPos(19.0f, 0.0f, 2.0f);
-			pNodeA->SetPos( 0.0f, 0.0f, 2.0f);
-			pNodeB->SetPos( 6.0f, 0.0f, 0.0f);
-			pNodeC->SetPos(12.0f, 0.0f, 0.0f);
-			pNodeD->SetPos( 6.0f, 0.0f, 4.0f);
-			pNodeE->SetPos(12.0f, 0.0f, 4.0f);
+	TEST_FIXTURE(ConstructTest, FindShortestPath) {
+		bUsePosition = false;
+		CreateGraph();
+
+		// Ask twice, the second time the paths are taken from the path cache
+		for (int i=0; i<2; i++) {
+			CHECK_EQUAL("A",	GetPathNodes(graph.FindShortestPath(0, 0)));
+			CHECK_EQUAL("AB",	GetPathNodes(graph.FindShortestPath(0, 1)));
+			CHECK_EQUAL("ADEC",	GetPathNodes(graph.FindShortestPath(0, 2)));
+			CHECK_EQUAL("AD",	GetPathNodes(graph.FindShortestPath(0, 3)));
+			CHECK_EQUAL("ADE",	GetPathNodes(graph.FindShortestPath(0, 4)));
+			CHECK_EQUAL("ADEF",	GetPathNodes(graph.FindShortestPath(0, 5)));
+			CHECK_EQUAL("FEDB",	GetPathNodes(graph.FindShortestPath(5, 1)));
 		}
 
-		// Setup node neighbours
-		// Node A (0)
-		pNodeA->AddNeighbour(*pNodeC, bUsePosition ? -1.0f : 5.0f);
-		pNodeA->AddNeighbour(*pNodeB, bUsePosition ? -1.0f : 2.0f);
-		pNodeA->AddNeighbour(*pNodeD, bUsePosition ? -1.0f : 1.0f);
-
-		// Node B (1)
-		pNodeB->AddNeighbour(*pNodeA, bUsePosition ? -1.0f : 2.0f);
-		pNodeB->AddNeighbour(*pNodeC, bUsePosition ? -1.0f : 3.0f);
-		pNodeB->AddNeighbour(*pNodeD, bUsePosition ? -1.0f : 2.0f);
-
-		// Node C (2)
-		pNodeC->AddNeighbour(*pNodeA, bUsePosition ? -1.0f : 5.0f);
-		pNodeC->AddNeighbour(*pNodeB, bUsePosition ? -1.0f : 3.0f);
-		pNodeC->AddNeighbour(*pNodeD, bUsePosition ? -1.0f : 3.0f);
-		pNodeC->AddNeighbour(*pNodeE, bUsePosition ? -1.0f : 1.0f);
-		pNodeC->AddNeighbour(*pNodeF, bUsePosition ? -1.0f : 5.0f);
-
-		// Node D (3)
-		pNodeD->AddNeighbour(*pNodeA, bUsePosition ? -1.0f : 1.0f);
-		pNodeD->AddNeighbour(*pNodeB, bUsePosition ? -1.0f : 2.0f);
-		pNodeD->AddNeighbour(*pNodeC, bUsePosition ? -1.0f : 3.0f);
-		pNodeD->AddNeighbour(*pNodeE, bUsePosition ? -1.0f : 1.0f);
-
-		// Node E (4)
-		pNodeE->AddNeighbour(*pNodeD, bUsePosition ? -1.0f : 1.0f);
-		pNodeE->AddNeighbour(*pNodeC, bUsePosition ? -1.0f : 1.0f);
-		pNodeE->AddNeighbour(*pNodeF, bUsePosition ? -1.0f : 2.0f);
-
-		// Node F (5)
-		pNodeF->AddNeighbour(*pNodeC, bUsePosition ? -1.0f : 5.0f);
-		pNodeF->AddNeighbour(*pNodeE, bUsePosition ? -1.0f : 2.0f);
+		// Invalid nodes
+		CHECK(!graph.FindShortestPath(0, 6));
+		CHECK(!graph.FindShortestPath(6, 0));
 	}
 
-	// [TODO]
-	// Find shortest path
-	/*
-	GraphPath *pPath = cGraph.FindShortestPath(1, 5);
-	if (pPath) {
-		delete pPath;
-	}*/
-}
\ No newline at end of file
+	TEST_FIXTURE(ConstructTest, FindShortestPath_Position) {
+		CreateGraph();
+
+		// The neighbour distances are calculated by using the node positions
+		CHECK_EQUAL("ACF",	GetPathNodes(graph.FindShortestPath(0, 5)));
+		CHECK_EQUAL("ADE",	GetPathNodes(graph.FindShortestPath(0, 4)));
+
+		// Move node C away, the cached path must not be used any longer
+		pNodeC->SetPos(12.0f, 0.0f, -10.0f);
+		CHECK_EQUAL("ADEF",	GetPathNodes(graph.FindShortestPath(0, 5)));
+	}
+
+	TEST_FIXTURE(ConstructTest, FindShortestPath_GraphChanged) {
+		bUsePosition = false;
+		CreateGraph();
+		CHECK_EQUAL("ADE",	GetPathNodes(graph.FindShortestPath(0, 4)));
+
+		// Remove a connection
+		pNodeD->RemoveNeighbour(*pNodeE);
+		CHECK_EQUAL("ADCE",	GetPathNodes(graph.FindShortestPath(0, 4)));
+
+		// Add a node which can't be reached
+		PLMath::GraphNode *pNodeG = graph.Create("G");
+		CHECK(!graph.FindShortestPath(0, 6));
+
+		// Connect the new node
+		pNodeA->AddNeighbour(*pNodeG, 1.0f);
+		CHECK_EQUAL("AG",	GetPathNodes(graph.FindShortestPath(0, 6)));
+
+		// Destroy a node, the indices of the nodes behind it are changed (A=0, B=1, D=2, E=3, F=4, G=5)
+		delete pNodeC;
+		CHECK_EQUAL("AG",	GetPathNodes(graph.FindShortestPath(0, 5)));
+		CHECK_EQUAL("EDA",	GetPathNodes(graph.FindShortestPath(3, 0)));
+		CHECK(!graph.FindShortestPath(0, 3));
+	}
+
+	TEST_FIXTURE(ConstructTest, FindShortestPaths) {
+		bUsePosition = false;
+		CreateGraph();
+
+		// Disable the path cache, the result must be the same
+		graph.SetPathCacheSize(0);
+		const PLCore::uint32 nStartNodes[] = { 0, 0, 0, 0, 0, 0, 5, 0 };
+		const PLCore::uint32 nEndNodes[]   = { 0, 1, 2, 3, 4, 5, 1, 6 };
+		PLMath::GraphPath *pPaths[8];
+		CHECK_EQUAL(7U, graph.FindShortestPaths(8, nStartNodes, nEndNodes, pPaths));
+		CHECK_EQUAL("A",	GetPathNodes(pPaths[0]));
+		CHECK_EQUAL("AB",	GetPathNodes(pPaths[1]));
+		CHECK_EQUAL("ADEC",	GetPathNodes(pPaths[2]));
+		CHECK_EQUAL("AD",	GetPathNodes(pPaths[3]));
+		CHECK_EQUAL("ADE",	GetPathNodes(pPaths[4]));
+		CHECK_EQUAL("ADEF",	GetPathNodes(pPaths[5]));
+		CHECK_EQUAL("FEDB",	GetPathNodes(pPaths[6]));
+		CHECK(!pPaths[7]);
+	}
+}
@@ -237,6 +237,42 @@ SUITE(Matrix3x4) {
 		CHECK_CLOSE(5.0f, vV3.z, Math::Epsilon);
 	}
 
+	// TransformPoints() must give the same result as transforming each point on it's own
+	TEST_FIXTURE(ConstructTest, TransformPoints) {
+		mM.FromEulerAngleY(static_cast<float>(30.0f*Math::DegToRad));
+		mM.SetTranslation(2.0f, -3.0f, 4.0f);
+		mM.xy = 0.5f;	// Shear, so each matrix element has an influence
+
+		// Tightly packed, the number of points is no multiple of four so the remaining points are tested as well
+		Vector3 vSource[7], vDestination[7];
+		for (int i=0; i<7; i++)
+			vSource[i].SetXYZ(static_cast<float>(i) - 3.0f, static_cast<float>(i*i)*0.5f, 1.0f - static_cast<float>(i)*0.25f);
+		mM.TransformPoints(vSource, vDestination, 7);
+		for (int i=0; i<7; i++) {
+			vV3 = vSource[i];
+			vV3 *= mM;
+			CHECK_CLOSE(vV3.x, vDestination[i].x, 0.0001f);
+			CHECK_CLOSE(vV3.y, vDestination[i].y, 0.0001f);
+			CHECK_CLOSE(vV3.z, vDestination[i].z, 0.0001f);
+		}
+
+		// Interleaved data (position and one more float) transformed in place, the extra float must not be touched
+		float fData[7*4];
+		for (int i=0; i<7; i++) {
+			fData[i*4]     = vSource[i].x;
+			fData[i*4 + 1] = vSource[i].y;
+			fData[i*4 + 2] = vSource[i].z;
+			fData[i*4 + 3] = static_cast<float>(i);
+		}
+		mM.TransformPoints(fData, fData, 7, sizeof(float)*4, sizeof(float)*4);
+		for (int i=0; i<7; i++) {
+			CHECK_CLOSE(vDestination[i].x, fData[i*4],     0.0001f);
+			CHECK_CLOSE(vDestination[i].y, fData[i*4 + 1], 0.0001f);
+			CHECK_CLOSE(vDestination[i].z, fData[i*4 + 2], 0.0001f);
+			CHECK_EQUAL(static_cast<float>(i), fData[i*4 + 3]);
+		}
+	}
+
 	// Matrix operations
 	// IsZero()
 	TEST_FIXTURE(ConstructTest, IsZero) {
@@ -2,6 +2,7 @@
 //[ Includes                                              ]
 //[-------------------------------------------------------]
 #include <UnitTest++/UnitTest++.h>
+#include <PLMath/Matrix3x4.h>
 #include <PLMath/Matrix4x4.h>
 #include <PLMath/Vector3.h>
 #include <PLMath/Vector4.h>
@@ -39,6 +40,15 @@ SUITE(Matrix4x4) {
 		Vector4 vV4;
 	};
 
+	// Fills a matrix with a general transform (rotation, non uniform scale, translation and projection)
+	void SetGeneralMatrix(Matrix4x4 &mM)
+	{
+		for (PLCore::uint32 nRow=0; nRow<4; nRow++) {
+			for (PLCore::uint32 nColumn=0; nColumn<4; nColumn++)
+				mM(nRow, nColumn) = static_cast<float>(((nRow*7 + nColumn*3) % 11) - 5)*0.25f + ((nRow == nColumn) ? 3.0f : 0.0f);
+		}
+	}
+
 	bool CheckAxisAngle(float fX, float fY, float fZ, float fAngle, float fExpectedAngle)
 	{
 		float fXT, fYT, fZT, fAngleT;
@@ -561,6 +571,93 @@ SUITE(Matrix4x4) {
 		CHECK(Matrix4x4::Identity == Matrix4x4::Identity.GetInverted());
 	}
 
+	// Invert() of a general matrix, the result multiplied by the source must be the identity
+	TEST_FIXTURE(ConstructTest, Invert_General) {
+		SetGeneralMatrix(mM);
+		mMT = mM;
+		CHECK(mMT.Invert());
+		const Matrix4x4 mResult = mM*mMT;
+		for (PLCore::uint32 nRow=0; nRow<4; nRow++) {
+			for (PLCore::uint32 nColumn=0; nColumn<4; nColumn++)
+				CHECK_CLOSE((nRow == nColumn) ? 1.0f : 0.0f, mResult(nRow, nColumn), 0.0001f);
+		}
+
+		// GetInverted() must give the same result
+		const Matrix4x4 mInverted = mM.GetInverted();
+		for (int i=0; i<16; i++)
+			CHECK_CLOSE(mMT.fM[i], mInverted.fM[i], 0.0001f);
+
+		// A singular matrix can't be inverted
+		mM.SetZero();
+		CHECK(!mM.Invert());
+	}
+
+	// Matrix4x4 * Matrix4x4, compared against a straight forward implementation
+	TEST_FIXTURE(ConstructTest, Multiplication_Matrix4x4) {
+		SetGeneralMatrix(mM);
+		mMT = Matrix4x4(fT);
+		const Matrix4x4 mResult = mM*mMT;
+		for (PLCore::uint32 nRow=0; nRow<4; nRow++) {
+			for (PLCore::uint32 nColumn=0; nColumn<4; nColumn++) {
+				float fExpected = 0.0f;
+				for (PLCore::uint32 i=0; i<4; i++)
+					fExpected += mM(nRow, i)*mMT(i, nColumn);
+				CHECK_CLOSE(fExpected, mResult(nRow, nColumn), 0.0001f);
+			}
+		}
+	}
+
+	// Matrix4x4 * Matrix3x4, the 3x4 matrix is treated as 4x4 matrix with (0, 0, 0, 1) as last row
+	TEST_FIXTURE(ConstructTest, Multiplication_Matrix3x4) {
+		SetGeneralMatrix(mM);
+		Matrix3x4 m3x4;
+		for (int i=0; i<12; i++)
+			m3x4.fM[i] = static_cast<float>(i) - 5.5f;
+		const Matrix4x4 mResult = mM*m3x4;
+		for (PLCore::uint32 nRow=0; nRow<4; nRow++) {
+			for (PLCore::uint32 nColumn=0; nColumn<4; nColumn++) {
+				float fExpected = mM(nRow, 3)*((nColumn == 3) ? 1.0f : 0.0f);
+				for (PLCore::uint32 i=0; i<3; i++)
+					fExpected += mM(nRow, i)*m3x4.fM[nColumn*3 + i];
+				CHECK_CLOSE(fExpected, mResult(nRow, nColumn), 0.0001f);
+			}
+		}
+	}
+
+	// TransformPoints() must give the same result as transforming each point on it's own
+	TEST_FIXTURE(ConstructTest, TransformPoints) {
+		SetGeneralMatrix(mM);
+
+		// Tightly packed, the number of points is no multiple of four so the remaining points are tested as well
+		Vector3 vSource[7], vDestination[7];
+		for (int i=0; i<7; i++)
+			vSource[i].SetXYZ(static_cast<float>(i) - 3.0f, static_cast<float>(i*i)*0.5f, 1.0f - static_cast<float>(i)*0.25f);
+		mM.TransformPoints(vSource, vDestination, 7);
+		for (int i=0; i<7; i++) {
+			vV3 = vSource[i];
+			vV3 *= mM;
+			CHECK_CLOSE(vV3.x, vDestination[i].x, 0.0001f);
+			CHECK_CLOSE(vV3.y, vDestination[i].y, 0.0001f);
+			CHECK_CLOSE(vV3.z, vDestination[i].z, 0.0001f);
+		}
+
+		// Interleaved data (position and one more float) transformed in place, the extra float must not be touched
+		float fData[7*4];
+		for (int i=0; i<7; i++) {
+			fData[i*4]     = vSource[i].x;
+			fData[i*4 + 1] = vSource[i].y;
+			fData[i*4 + 2] = vSource[i].z;
+			fData[i*4 + 3] = static_cast<float>(i);
+		}
+		mM.TransformPoints(fData, fData, 7, sizeof(float)*4, sizeof(float)*4);
+		for (int i=0; i<7; i++) {
+			CHECK_CLOSE(vDestination[i].x, fData[i*4],     0.0001f);
+			CHECK_CLOSE(vDestination[i].y, fData[i*4 + 1], 0.0001f);
+			CHECK_CLOSE(vDestination[i].z, fData[i*4 + 2], 0.0001f);
+			CHECK_EQUAL(static_cast<float>(i), fData[i*4 + 3]);
+		}
+	}
+
 	// Scale
 	// GetScale(float fX, float fY, float fZ)
 	TEST_FIXTURE(ConstructTest, GetScale_Float) {
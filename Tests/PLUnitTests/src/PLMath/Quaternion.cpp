@@ -1,6 +1,7 @@
 //[-------------------------------------------------------]
 //[ Includes                                              ]
 //[-------------------------------------------------------]
+#include <math.h>
 #include <UnitTest++/UnitTest++.h>
 #include <PLMath/Quaternion.h>
 
@@ -30,4 +31,47 @@ SUITE(Quaternion) {
 		// Container for testing
 		PLMath::Quaternion quat;
 	};
+
+	// Straight forward spherical linear interpolation used as reference
+	PLMath::Quaternion ReferenceSlerp(const PLMath::Quaternion &qQ1, const PLMath::Quaternion &qQ2, float fTime)
+	{
+		double fCosom = qQ1.w*qQ2.w + qQ1.x*qQ2.x + qQ1.y*qQ2.y + qQ1.z*qQ2.z;
+		double fSign = 1.0;
+		if (fCosom < 0.0) {
+			fCosom = -fCosom;
+			fSign  = -1.0;
+		}
+		double fScale0 = 1.0 - fTime, fScale1 = fTime;
+		if (fCosom < 0.999) {
+			const double fOmega = acos(fCosom);
+			const double fSinom = sin(fOmega);
+			fScale0 = sin((1.0 - fTime)*fOmega)/fSinom;
+			fScale1 = sin(fTime*fOmega)/fSinom;
+		}
+		fScale1 *= fSign;
+		return PLMath::Quaternion(static_cast<float>(fScale0*qQ1.w + fScale1*qQ2.w), static_cast<float>(fScale0*qQ1.x + fScale1*qQ2.x),
+								  static_cast<float>(fScale0*qQ1.y + fScale1*qQ2.y), static_cast<float>(fScale0*qQ1.z + fScale1*qQ2.z));
+	}
+
+	// Slerp(), including quaternions in different hemispheres and almost identical quaternions
+	TEST_FIXTURE(ConstructTest, Slerp) {
+		PLMath::Quaternion qQ[4];
+		qQ[0].FromAxisAngle(1.0f, 0.0f, 0.0f, 0.3f);
+		qQ[1].FromAxisAngle(0.0f, 0.6f, 0.8f, 2.5f);
+		qQ[2].FromAxisAngle(0.0f, 0.6f, 0.8f, -2.9f);
+		qQ[3].FromAxisAngle(1.0f, 0.0f, 0.0f, 0.3001f);
+		for (int nFrom=0; nFrom<4; nFrom++) {
+			for (int nTo=0; nTo<4; nTo++) {
+				for (int i=0; i<=4; i++) {
+					const float fTime = static_cast<float>(i)*0.25f;
+					quat.Slerp(qQ[nFrom], qQ[nTo], fTime);
+					const PLMath::Quaternion qExpected = ReferenceSlerp(qQ[nFrom], qQ[nTo], fTime);
+					CHECK_CLOSE(qExpected.w, quat.w, 0.001f);
+					CHECK_CLOSE(qExpected.x, quat.x, 0.001f);
+					CHECK_CLOSE(qExpected.y, quat.y, 0.001f);
+					CHECK_CLOSE(qExpected.z, quat.z, 0.001f);
+				}
+			}
+		}
+	}
 }
\ No newline at end of file
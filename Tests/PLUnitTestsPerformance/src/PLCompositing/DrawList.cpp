@@ -0,0 +1,201 @@
+/*********************************************************\
+ *  File: DrawList.cpp                                   *
+ *
+ *  Copyright (C) 2002-2013 The PixelLight Team (http://www.pixellight.org/)
+ *
+ *  This file is part of PixelLight.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ *  and associated documentation files (the "Software"), to deal in the Software without
+ *  restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ *  Software is furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all copies or
+ *  substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ *  BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ *  DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ *  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include <UnitTest++/UnitTest++.h>
+#include <PLMath/Math.h>
+#include <PLCompositing/DrawList.h>
+#include <algorithm>
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+using namespace std;
+using namespace PLCore;
+using namespace PLMath;
+using namespace PLCompositing;
+
+
+/*
+* Naming Convention for SUITE:
+* CLASSNAME
+*/
+SUITE(DrawList) {
+	/*
+	* Naming Convention for METHOD:
+	* METHODNAME_SCENARIO
+	*/
+	// Pointers identifying states, the sort keys only use their addresses
+	char Programs[4], Materials[4], Textures[4];
+
+	// Sort entry of the reference
+	struct ReferenceEntry {
+		uint64 nSortKey;
+		uint32 nIndex;
+		bool operator <(const ReferenceEntry &sEntry) const
+		{
+			return nSortKey < sEntry.nSortKey;
+		}
+	};
+
+	// Adds items with the given sort keys, the user data is the index of the item
+	void AddItems(DrawList &cDrawList, const uint64 *pnSortKeys, uint32 nNumOfItems)
+	{
+		for (uint32 i=0; i<nNumOfItems; i++) {
+			DrawList::Item &cItem = cDrawList.AddItem();
+			CHECK_EQUAL(0U, cItem.nUserData);
+			cItem.nSortKey	= pnSortKeys[i];
+			cItem.nUserData	= i;
+		}
+	}
+
+	// Sorts the draw list and compares the order with a stable comparison sort, returns the number of wrong items
+	uint32 SortAndCompare(DrawList &cDrawList)
+	{
+		const uint32 nNumOfItems = cDrawList.GetNumOfItems();
+		ReferenceEntry *pReference = new ReferenceEntry[nNumOfItems];
+		for (uint32 i=0; i<nNumOfItems; i++) {
+			pReference[i].nSortKey = cDrawList.GetItem(i).nSortKey;
+			pReference[i].nIndex   = cDrawList.GetItem(i).nUserData;
+		}
+		stable_sort(pReference, pReference + nNumOfItems);
+		cDrawList.Sort();
+		uint32 nErrors = 0;
+		for (uint32 i=0; i<nNumOfItems; i++) {
+			if (cDrawList.GetSortedItem(i).nUserData != pReference[i].nIndex)
+				nErrors++;
+		}
+		delete [] pReference;
+		return nErrors;
+	}
+
+	TEST(GetStateSortKey_Order) {
+		// The pass is the most significant part
+		CHECK(DrawList::GetStateSortKey(0, &Programs[1], &Materials[1], &Textures[1], 100.0f) < DrawList::GetStateSortKey(1, &Programs[0], &Materials[0], &Textures[0], 1.0f));
+
+		// Identical states are ordered front to back
+		CHECK(DrawList::GetStateSortKey(0, &Programs[0], &Materials[0], &Textures[0], 1.0f) < DrawList::GetStateSortKey(0, &Programs[0], &Materials[0], &Textures[0], 2.0f));
+		CHECK(DrawList::GetStateSortKey(0, &Programs[0], &Materials[0], &Textures[0], 0.0f) < DrawList::GetStateSortKey(0, &Programs[0], &Materials[0], &Textures[0], 0.001f));
+		CHECK_EQUAL(DrawList::GetStateSortKey(0, &Programs[0], &Materials[0], &Textures[0], 0.0f), DrawList::GetStateSortKey(0, &Programs[0], &Materials[0], &Textures[0], -1.0f));
+
+		// The states are more significant than the depth, items using the same states are next to each other
+		for (uint32 i=0; i<4; i++) {
+			const uint64 nKey  = DrawList::GetStateSortKey(0, &Programs[i], &Materials[i], &Textures[i], 0.0f);
+			const uint64 nNear = DrawList::GetStateSortKey(0, &Programs[i], &Materials[i], &Textures[i], 1.0f);
+			const uint64 nFar  = DrawList::GetStateSortKey(0, &Programs[i], &Materials[i], &Textures[i], 1000000.0f);
+			CHECK_EQUAL(nKey >> 20, nNear >> 20);
+			CHECK_EQUAL(nKey >> 20, nFar  >> 20);
+			CHECK(nNear < nFar);
+		}
+
+		// Only the lower 4 bits of the pass are used
+		CHECK_EQUAL(DrawList::GetStateSortKey(1, nullptr, nullptr, nullptr, 1.0f), DrawList::GetStateSortKey(17, nullptr, nullptr, nullptr, 1.0f));
+	}
+
+	TEST(GetDepthSortKey_Order) {
+		// The pass is the most significant part
+		CHECK(DrawList::GetDepthSortKey(0, &Programs[0], &Materials[0], &Textures[0], 1.0f) < DrawList::GetDepthSortKey(1, &Programs[0], &Materials[0], &Textures[0], 100.0f));
+
+		// Items are ordered back to front, independent of their states
+		for (uint32 i=0; i<4; i++) {
+			for (uint32 j=0; j<4; j++) {
+				CHECK(DrawList::GetDepthSortKey(0, &Programs[i], &Materials[i], &Textures[i], 10.0f) < DrawList::GetDepthSortKey(0, &Programs[j], &Materials[j], &Textures[j], 5.0f));
+				CHECK(DrawList::GetDepthSortKey(0, &Programs[i], &Materials[i], &Textures[i], 1.0f) < DrawList::GetDepthSortKey(0, &Programs[j], &Materials[j], &Textures[j], 0.0f));
+			}
+		}
+
+		// Items with identical depths are grouped by their states
+		const uint64 nKey = DrawList::GetDepthSortKey(0, &Programs[2], &Materials[1], &Textures[3], 3.0f);
+		CHECK_EQUAL(nKey, DrawList::GetDepthSortKey(0, &Programs[2], &Materials[1], &Textures[3], 3.0f));
+		CHECK_EQUAL(nKey >> 40, DrawList::GetDepthSortKey(0, &Programs[0], &Materials[0], &Textures[0], 3.0f) >> 40);
+	}
+
+	TEST(Sort_Random) {
+		// Random keys with many duplicates, the stable order of identical keys must be kept
+		const uint32 NumOfItems = 5000;
+		uint64 nSortKeys[NumOfItems];
+		srand(0);
+		for (uint32 i=0; i<NumOfItems; i++)
+			nSortKeys[i] = (static_cast<uint64>(Math::GetRand()%8) << 61) | (static_cast<uint64>(Math::GetRand()%16) << 24) | (Math::GetRand()%4);
+		DrawList cDrawList;
+		AddItems(cDrawList, nSortKeys, NumOfItems);
+		CHECK_EQUAL(NumOfItems, cDrawList.GetNumOfItems());
+		CHECK_EQUAL(0U, SortAndCompare(cDrawList));
+
+		// The sorted items are the collected ones
+		for (uint32 i=0; i<NumOfItems; i++) {
+			const DrawList::Item &cItem = cDrawList.GetSortedItem(i);
+			CHECK_EQUAL(&cItem, &cDrawList.GetItem(cItem.nUserData));
+		}
+	}
+
+	TEST(Sort_StateSortKeys) {
+		// Several items per state with different depths, a realistic draw list
+		const uint32 NumOfItems = 1000;
+		uint64 nSortKeys[NumOfItems];
+		srand(1);
+		for (uint32 i=0; i<NumOfItems; i++)
+			nSortKeys[i] = DrawList::GetStateSortKey(i%2, &Programs[Math::GetRand()%4], &Materials[Math::GetRand()%4], &Textures[Math::GetRand()%4], Math::GetRandFloat()*1000.0f);
+		DrawList cDrawList;
+		AddItems(cDrawList, nSortKeys, NumOfItems);
+		CHECK_EQUAL(0U, SortAndCompare(cDrawList));
+
+		// All items of the first pass are drawn first
+		for (uint32 i=0; i<NumOfItems; i++)
+			CHECK_EQUAL((i < NumOfItems/2) ? 0U : 1U, cDrawList.GetSortedItem(i).nUserData%2);
+	}
+
+	TEST(Sort_Reuse) {
+		DrawList cDrawList;
+
+		// Empty draw list
+		cDrawList.Sort();
+		CHECK_EQUAL(0U, cDrawList.GetNumOfItems());
+
+		// Identical keys, all bytes are skipped and the collect order is kept
+		const uint64 nIdentical[5] = { 42, 42, 42, 42, 42 };
+		AddItems(cDrawList, nIdentical, 5);
+		cDrawList.Sort();
+		for (uint32 i=0; i<5; i++)
+			CHECK_EQUAL(i, cDrawList.GetSortedItem(i).nUserData);
+
+		// A larger draw list after clearing the draw list
+		cDrawList.Clear();
+		CHECK_EQUAL(0U, cDrawList.GetNumOfItems());
+		const uint64 nSortKeys[7] = { 0xFF00000000000000ULL, 3, 0x100, 2, 0xFF00000000000000ULL, 0, 0x100 };
+		AddItems(cDrawList, nSortKeys, 7);
+		CHECK_EQUAL(0U, SortAndCompare(cDrawList));
+
+		// A smaller draw list afterwards
+		cDrawList.Clear();
+		const uint64 nReverse[3] = { 3, 2, 1 };
+		AddItems(cDrawList, nReverse, 3);
+		cDrawList.Sort();
+		for (uint32 i=0; i<3; i++)
+			CHECK_EQUAL(2 - i, cDrawList.GetSortedItem(i).nUserData);
+	}
+}
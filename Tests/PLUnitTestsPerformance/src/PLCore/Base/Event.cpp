@@ -0,0 +1,118 @@
+/*********************************************************\
+ *  File: Event.cpp                                      *
+ *
+ *  Copyright (C) 2002-2013 The PixelLight Team (http://www.pixellight.org/)
+ *
+ *  This file is part of PixelLight.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ *  and associated documentation files (the "Software"), to deal in the Software without
+ *  restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ *  Software is furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all copies or
+ *  substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ *  BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ *  DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ *  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include <UnitTest++/UnitTest++.h>
+#include <PLCore/Base/Event/Event.h>
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+using namespace std;
+using namespace PLCore;
+
+
+//[-------------------------------------------------------]
+//[ Global variables                                      ]
+//[-------------------------------------------------------]
+extern ofstream outputFile;
+
+
+//[-------------------------------------------------------]
+//[ Classes                                               ]
+//[-------------------------------------------------------]
+// Event receiver, the event handler is connected to the event like a scene node modifier is connected to the scene context update event
+class EventReceiver {
+	public:
+		EventHandler<uint32> EventHandlerValue;
+		uint32				 m_nSum;
+
+		EventReceiver() :
+			EventHandlerValue(&EventReceiver::OnValue, this),
+			m_nSum(0)
+		{
+		}
+
+	private:
+		void OnValue(uint32 nValue)
+		{
+			m_nSum += nValue;
+		}
+};
+
+
+/*
+* Naming Convention for SUITE:
+* CLASSNAME
+*/
+SUITE(Event_Performance) {
+	/*
+	* Naming Convention for METHOD:
+	* METHODNAME_SCENARIO
+	*/
+	// general objects for testing
+	const uint32 NumOfReceivers = 50000;	// number of event receivers
+	const uint32 TestLoops      = 10;		// number of iterations
+	const uint32 NumOfEmits     = 100;		// number of emits per iteration
+
+	TEST(Emit){
+		Event<uint32> cEvent;
+		EventReceiver *pReceivers = new EventReceiver[NumOfReceivers];
+		for (uint32 i=0; i<NumOfReceivers; i++)
+			cEvent.Connect(pReceivers[i].EventHandlerValue);
+		for (uint32 nLoop=0; nLoop<TestLoops*NumOfEmits; nLoop++)
+			cEvent(nLoop);
+		delete [] pReceivers;
+	}
+
+	TEST(Connect_Disconnect){
+		Event<uint32> cEvent;
+		EventReceiver *pReceivers = new EventReceiver[NumOfReceivers];
+		for (uint32 nLoop=0; nLoop<TestLoops; nLoop++) {
+			for (uint32 i=0; i<NumOfReceivers; i++)
+				cEvent.Connect(pReceivers[i].EventHandlerValue);
+
+			// Disconnect in a scattered order, first every second receiver, then the rest
+			for (uint32 i=0; i<NumOfReceivers; i+=2)
+				cEvent.Disconnect(pReceivers[i].EventHandlerValue);
+			for (uint32 i=1; i<NumOfReceivers; i+=2)
+				cEvent.Disconnect(pReceivers[i].EventHandlerValue);
+		}
+		delete [] pReceivers;
+	}
+
+	TEST(Connect_Destroy){
+		Event<uint32> cEvent;
+		for (uint32 nLoop=0; nLoop<TestLoops; nLoop++) {
+			// The destructors of the event handlers disconnect them from the event
+			EventReceiver *pReceivers = new EventReceiver[NumOfReceivers];
+			for (uint32 i=0; i<NumOfReceivers; i++)
+				cEvent.Connect(pReceivers[i].EventHandlerValue);
+			delete [] pReceivers;
+		}
+	}
+}
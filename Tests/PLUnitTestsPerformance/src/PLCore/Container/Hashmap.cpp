@@ -28,6 +28,7 @@
 #include <map>
 #include <UnitTest++/UnitTest++.h>
 #include "PLCore/Container/HashMap.h"
+#include "PLCore/Container/FlatHashMap.h"
 
 
 //[-------------------------------------------------------]
@@ -55,6 +56,7 @@ SUITE(Hashmap_Performance) {
 	// general objects for testing
 	int testloops = 10000;	// number of iterations
 	HashMap<char, int> PLHashmap;
+	FlatHashMap<char, int> PLFlatHashmap;
 	std::map<char, int> CHashmap;
 	
 
@@ -62,6 +64,11 @@ SUITE(Hashmap_Performance) {
 		for (int i=0; i<testloops; i++)
 			PLHashmap.Add(static_cast<char>(i+48), i);
 	}
+
+	TEST(PL_FlatHashmap_Add){
+		for (int i=0; i<testloops; i++)
+			PLFlatHashmap.Add(static_cast<char>(i+48), i);
+	}
 	
 	TEST(C_Hashmap_Add){
 		for (int i=0; i<testloops; i++)
@@ -73,6 +80,11 @@ SUITE(Hashmap_Performance) {
 			PLHashmap.Replace(static_cast<char>(i+48), i);
 	}
 
+	TEST(PL_FlatHashmap_Replace){
+		for (int i=0; i<testloops; i++)
+			PLFlatHashmap.Replace(static_cast<char>(i+48), i);
+	}
+
 	TEST(C_Hashmap_Replace){
 		for (int i=0; i<testloops; i++)
 			CHashmap[48] = i;
@@ -83,6 +95,11 @@ SUITE(Hashmap_Performance) {
 			PLHashmap.Set(48, i);
 	}
 
+	TEST(PL_FlatHashmap_Set){
+		for (int i=0; i<testloops; i++)
+			PLFlatHashmap.Set(48, i);
+	}
+
 	TEST(C_Hashmap_Set){
 		for (int i=0; i<testloops; i++)
 			CHashmap.insert(std::pair<char,int>(48,300));
@@ -93,6 +110,11 @@ SUITE(Hashmap_Performance) {
 			PLHashmap.Get(static_cast<char>(testloops-i));
 	}
 
+	TEST(PL_FlatHashmap_Get){
+		for (int i=0; i<testloops; i++)
+			PLFlatHashmap.Get(static_cast<char>(testloops-i));
+	}
+
 	TEST(C_Hashmap_Get){
 		for (int i=0; i<testloops; i++)
 			CHashmap.find(static_cast<char>(testloops-i));
@@ -103,6 +125,11 @@ SUITE(Hashmap_Performance) {
 			PLHashmap.Remove(i);
 	}
 
+	TEST(PL_FlatHashmap_Remove_Forwards){
+		for (int i=0; i<testloops; i++)
+			PLFlatHashmap.Remove(i);
+	}
+
 	TEST(C_Hashmap_Remove_Forwards){
 		for (int i=0; i<testloops; i++)
 			CHashmap.erase(static_cast<char>(i));
@@ -113,8 +140,128 @@ SUITE(Hashmap_Performance) {
 			PLHashmap.Remove(testloops-i);
 	}
 
+	TEST(PL_FlatHashmap_Remove_Backwards){
+		for (int i=0; i<testloops; i++)
+			PLFlatHashmap.Remove(testloops-i);
+	}
+
 	TEST(C_Hashmap_Remove_Backwards){
 		for (int i=0; i<testloops; i++)
 			CHashmap.erase(static_cast<char>(testloops-i));
 	}
-}
\ No newline at end of file
+}
+
+
+/*
+* Naming Convention for SUITE:
+* CLASSNAME
+*/
+SUITE(Hashmap_Int_Performance) {
+	/*
+	* Naming Convention for METHOD:
+	* METHODNAME_SCENARIO
+	*/
+	// general objects for testing, the number of elements is high enough to let the maps grow several times
+	int testloops = 100000;	// number of iterations
+	HashMap<int, int> PLHashmap;
+	FlatHashMap<int, int> PLFlatHashmap;
+	std::map<int, int> CHashmap;
+
+	TEST(PL_Hashmap_Add){
+		for (int i=0; i<testloops; i++)
+			PLHashmap.Add(i, i);
+	}
+
+	TEST(PL_FlatHashmap_Add){
+		for (int i=0; i<testloops; i++)
+			PLFlatHashmap.Add(i, i);
+	}
+
+	TEST(C_Hashmap_Add){
+		for (int i=0; i<testloops; i++)
+			CHashmap[i] = i;
+	}
+
+	TEST(PL_Hashmap_Get_Hit){
+		uint64 nSum = 0;
+		for (int i=0; i<testloops; i++)
+			nSum += PLHashmap.Get(i);
+		CHECK(nSum != 0);
+	}
+
+	TEST(PL_FlatHashmap_Get_Hit){
+		uint64 nSum = 0;
+		for (int i=0; i<testloops; i++)
+			nSum += PLFlatHashmap.Get(i);
+		CHECK(nSum != 0);
+	}
+
+	TEST(C_Hashmap_Get_Hit){
+		uint64 nSum = 0;
+		for (int i=0; i<testloops; i++)
+			nSum += CHashmap.find(i)->second;
+		CHECK(nSum != 0);
+	}
+
+	TEST(PL_Hashmap_Get_Miss){
+		uint64 nSum = 0;
+		for (int i=0; i<testloops; i++)
+			nSum += PLHashmap.Get(testloops+i);
+		CHECK_EQUAL(0U, nSum);
+	}
+
+	TEST(PL_FlatHashmap_Get_Miss){
+		uint64 nSum = 0;
+		for (int i=0; i<testloops; i++)
+			nSum += PLFlatHashmap.Get(testloops+i);
+		CHECK_EQUAL(0U, nSum);
+	}
+
+	TEST(C_Hashmap_Get_Miss){
+		int nMisses = 0;
+		for (int i=0; i<testloops; i++)
+			nMisses += (CHashmap.find(testloops+i) == CHashmap.end());
+		CHECK_EQUAL(testloops, nMisses);
+	}
+
+	TEST(PL_Hashmap_Iterate){
+		uint64 nSum = 0;
+		Iterator<int> cIterator = PLHashmap.GetIterator();
+		while (cIterator.HasNext())
+			nSum += cIterator.Next();
+		CHECK(nSum != 0);
+	}
+
+	TEST(PL_FlatHashmap_Iterate){
+		uint64 nSum = 0;
+		Iterator<int> cIterator = PLFlatHashmap.GetIterator();
+		while (cIterator.HasNext())
+			nSum += cIterator.Next();
+		CHECK(nSum != 0);
+	}
+
+	TEST(C_Hashmap_Iterate){
+		uint64 nSum = 0;
+		for (std::map<int, int>::const_iterator cIterator=CHashmap.begin(); cIterator!=CHashmap.end(); ++cIterator)
+			nSum += cIterator->second;
+		CHECK(nSum != 0);
+	}
+
+	TEST(PL_Hashmap_Remove){
+		for (int i=0; i<testloops; i++)
+			PLHashmap.Remove(i);
+		CHECK(PLHashmap.IsEmpty());
+	}
+
+	TEST(PL_FlatHashmap_Remove){
+		for (int i=0; i<testloops; i++)
+			PLFlatHashmap.Remove(i);
+		CHECK(PLFlatHashmap.IsEmpty());
+	}
+
+	TEST(C_Hashmap_Remove){
+		for (int i=0; i<testloops; i++)
+			CHashmap.erase(i);
+		CHECK(CHashmap.empty());
+	}
+}
@@ -0,0 +1,132 @@
+/*********************************************************\
+ *  File: JobSystem.cpp                                  *
+ *
+ *  Copyright (C) 2002-2013 The PixelLight Team (http://www.pixellight.org/)
+ *
+ *  This file is part of PixelLight.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ *  and associated documentation files (the "Software"), to deal in the Software without
+ *  restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ *  Software is furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all copies or
+ *  substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ *  BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ *  DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ *  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include <UnitTest++/UnitTest++.h>
+#include <PLCore/System/System.h>
+#include <PLCore/System/JobSystem.h>
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+using namespace std;
+using namespace PLCore;
+
+
+//[-------------------------------------------------------]
+//[ Global variables                                      ]
+//[-------------------------------------------------------]
+extern ofstream outputFile;
+
+
+//[-------------------------------------------------------]
+//[ Global functions                                      ]
+//[-------------------------------------------------------]
+// Job doing nothing, used to measure the scheduling overhead
+void EmptyJob(void *pData)
+{
+}
+
+// Parallel for function doing some floating point work per element
+void WorkFunction(uint32 nBegin, uint32 nEnd, void *pData)
+{
+	float *pfData = static_cast<float*>(pData);
+	for (uint32 i=nBegin; i<nEnd; i++) {
+		float fValue = pfData[i];
+		for (int j=0; j<64; j++)
+			fValue = fValue*0.999f + 0.5f;
+		pfData[i] = fValue;
+	}
+}
+
+
+/*
+* Naming Convention for SUITE:
+* CLASSNAME
+*/
+SUITE(JobSystem_Performance) {
+	/*
+	* Naming Convention for METHOD:
+	* METHODNAME_SCENARIO
+	*/
+	// general objects for testing
+	const uint32 NumOfJobs     = 100000;	// number of empty jobs
+	const uint32 NumOfElements = 1000000;	// number of parallel for elements
+	float fData[NumOfElements];
+
+	// Processes all elements using a parallel for with the given number of worker threads
+	void ParallelForWithWorkers(uint32 nNumOfWorkers)
+	{
+		JobSystem *pJobSystem = JobSystem::GetInstance();
+		pJobSystem->SetNumOfWorkers(nNumOfWorkers);
+		pJobSystem->ParallelFor(NumOfElements, 0, &WorkFunction, fData);
+	}
+
+	TEST(Submit_EmptyJobs){
+		JobSystem *pJobSystem = JobSystem::GetInstance();
+		pJobSystem->SetNumOfWorkers(System::GetInstance()->GetNumOfCPUs() - 1);
+		JobCounter cCounter;
+		for (uint32 i=0; i<NumOfJobs; i++)
+			pJobSystem->Submit(&EmptyJob, nullptr, &cCounter);
+		pJobSystem->Wait(cCounter);
+	}
+
+	TEST(Submit_EmptyJobs_Dependency){
+		JobSystem *pJobSystem = JobSystem::GetInstance();
+		pJobSystem->SetNumOfWorkers(System::GetInstance()->GetNumOfCPUs() - 1);
+		JobCounter cFirstCounter, cSecondCounter;
+		for (uint32 i=0; i<NumOfJobs/2; i++)
+			pJobSystem->Submit(&EmptyJob, nullptr, &cFirstCounter);
+		for (uint32 i=0; i<NumOfJobs/2; i++)
+			pJobSystem->Submit(&EmptyJob, nullptr, &cSecondCounter, &cFirstCounter);
+		pJobSystem->Wait(cSecondCounter);
+	}
+
+	TEST(ParallelFor_Serial){
+		WorkFunction(0, NumOfElements, fData);
+	}
+
+	TEST(ParallelFor_0_Workers){
+		ParallelForWithWorkers(0);
+	}
+
+	TEST(ParallelFor_1_Worker){
+		ParallelForWithWorkers(1);
+	}
+
+	TEST(ParallelFor_3_Workers){
+		ParallelForWithWorkers(3);
+	}
+
+	TEST(ParallelFor_7_Workers){
+		ParallelForWithWorkers(7);
+	}
+
+	TEST(ParallelFor_CPU_Workers){
+		ParallelForWithWorkers(System::GetInstance()->GetNumOfCPUs() - 1);
+	}
+}
@@ -0,0 +1,133 @@
+/*********************************************************\
+ *  File: LoadableManager.cpp                            *
+ *
+ *  Copyright (C) 2002-2013 The PixelLight Team (http://www.pixellight.org/)
+ *
+ *  This file is part of PixelLight.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ *  and associated documentation files (the "Software"), to deal in the Software without
+ *  restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ *  Software is furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all copies or
+ *  substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ *  BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ *  DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ *  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include <UnitTest++/UnitTest++.h>
+#include <PLCore/File/File.h>
+#include <PLCore/File/Directory.h>
+#include <PLCore/Tools/LoadableManager.h>
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+using namespace std;
+using namespace PLCore;
+
+
+//[-------------------------------------------------------]
+//[ Global variables                                      ]
+//[-------------------------------------------------------]
+extern ofstream outputFile;
+
+
+/*
+* Naming Convention for SUITE:
+* CLASSNAME
+*/
+SUITE(LoadableManager_Performance) {
+	/*
+	* Naming Convention for METHOD:
+	* METHODNAME_SCENARIO
+	*/
+	// general objects for testing
+	const uint32 NumOfBaseDirs    = 32;	// number of base directories
+	const uint32 NumOfFilesPerDir = 64;	// number of files within each base directory
+	const uint32 TestLoops        = 5;	// number of iterations
+	const String Path             = "PLUnitTestsPerformance_LoadableManager/";	// directory the base directories are created in
+
+	// Returns the name of a base directory
+	String GetBaseDir(uint32 nBaseDir)
+	{
+		return Path + "Dir" + nBaseDir + '/';
+	}
+
+	// Returns the name of a file within a base directory, each file is only within one base directory
+	String GetFilename(uint32 nBaseDir, uint32 nFile)
+	{
+		return String("Data/File") + nBaseDir + '_' + nFile + ".txt";
+	}
+
+	// Creates the base directories with the files and adds them to the loadable manager
+	void CreateBaseDirs()
+	{
+		LoadableManager *pLoadableManager = LoadableManager::GetInstance();
+		for (uint32 nBaseDir=0; nBaseDir<NumOfBaseDirs; nBaseDir++) {
+			Directory(GetBaseDir(nBaseDir) + "Data").CreateRecursive();
+			for (uint32 nFile=0; nFile<NumOfFilesPerDir; nFile++) {
+				File cFile(GetBaseDir(nBaseDir) + GetFilename(nBaseDir, nFile));
+				if (cFile.Open(File::FileCreate | File::FileWrite)) {
+					cFile.PutS("PixelLight");
+					cFile.Close();
+				}
+			}
+			pLoadableManager->AddBaseDir(GetBaseDir(nBaseDir));
+		}
+	}
+
+	// Removes the base directories from the loadable manager and deletes them
+	void DestroyBaseDirs()
+	{
+		LoadableManager *pLoadableManager = LoadableManager::GetInstance();
+		for (uint32 nBaseDir=0; nBaseDir<NumOfBaseDirs; nBaseDir++) {
+			pLoadableManager->RemoveBaseDir(GetBaseDir(nBaseDir));
+			for (uint32 nFile=0; nFile<NumOfFilesPerDir; nFile++)
+				File(GetBaseDir(nBaseDir) + GetFilename(nBaseDir, nFile)).Delete();
+			Directory(GetBaseDir(nBaseDir) + "Data").Delete();
+			Directory(GetBaseDir(nBaseDir)).Delete();
+		}
+		Directory(Path).Delete();
+	}
+
+	// Opens all files by using the base directories, including the time to build the file index
+	void OpenFiles(bool bUseFileIndex)
+	{
+		CreateBaseDirs();
+		LoadableManager *pLoadableManager = LoadableManager::GetInstance();
+		pLoadableManager->SetUseFileIndex(bUseFileIndex);
+		uint32 nNumOfOpenedFiles = 0;
+		for (uint32 nLoop=0; nLoop<TestLoops; nLoop++) {
+			for (uint32 nBaseDir=0; nBaseDir<NumOfBaseDirs; nBaseDir++) {
+				for (uint32 nFile=0; nFile<NumOfFilesPerDir; nFile++) {
+					File cFile;
+					if (pLoadableManager->OpenFile(cFile, GetFilename(nBaseDir, nFile)))
+						nNumOfOpenedFiles++;
+				}
+			}
+		}
+		pLoadableManager->SetUseFileIndex(true);
+		DestroyBaseDirs();
+		CHECK_EQUAL(TestLoops*NumOfBaseDirs*NumOfFilesPerDir, nNumOfOpenedFiles);
+	}
+
+	TEST(Reference_OpenFile){
+		OpenFiles(false);
+	}
+
+	TEST(PL_OpenFile){
+		OpenFiles(true);
+	}
+}
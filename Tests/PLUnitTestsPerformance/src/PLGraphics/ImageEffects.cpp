@@ -0,0 +1,190 @@
+/*********************************************************\
+ *  File: ImageEffects.cpp                               *
+ *
+ *  Copyright (C) 2002-2013 The PixelLight Team (http://www.pixellight.org/)
+ *
+ *  This file is part of PixelLight.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ *  and associated documentation files (the "Software"), to deal in the Software without
+ *  restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ *  Software is furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all copies or
+ *  substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ *  BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ *  DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ *  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include <UnitTest++/UnitTest++.h>
+#include <PLCore/System/System.h>
+#include <PLCore/System/JobSystem.h>
+#include <PLMath/Vector3i.h>
+#include <PLGraphics/Image/ImageBuffer.h>
+#include <PLGraphics/Image/Effects/IEScale.h>
+#include <PLGraphics/Image/Effects/IEConvert.h>
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+using namespace std;
+using namespace PLCore;
+using namespace PLMath;
+using namespace PLGraphics;
+
+
+//[-------------------------------------------------------]
+//[ Global variables                                      ]
+//[-------------------------------------------------------]
+extern ofstream outputFile;
+
+
+/*
+* Naming Convention for SUITE:
+* CLASSNAME
+*/
+SUITE(ImageEffects_Performance) {
+	/*
+	* Naming Convention for METHOD:
+	* METHODNAME_SCENARIO
+	*/
+	// general objects for testing
+	const int    ImageSize = 1024;	// width and height of the image
+	const uint32 TestLoops = 10;	// number of iterations
+
+	// Creates an image buffer filled with a pattern
+	void CreateImageBuffer(ImageBuffer &cImageBuffer, EDataFormat nDataFormat, EColorFormat nColorFormat)
+	{
+		cImageBuffer.CreateImage(nDataFormat, nColorFormat, Vector3i(ImageSize, ImageSize, 1));
+		if (nDataFormat == DataFloat) {
+			float *pfData = reinterpret_cast<float*>(cImageBuffer.GetData());
+			const uint32 nNumOfValues = cImageBuffer.GetDataSize()/sizeof(float);
+			for (uint32 i=0; i<nNumOfValues; i++)
+				pfData[i] = static_cast<float>((i*7 + i/ImageSize)%256)/255.0f;
+		} else {
+			uint8 *pnData = cImageBuffer.GetData();
+			for (uint32 i=0; i<cImageBuffer.GetDataSize(); i++)
+				pnData[i] = static_cast<uint8>(i*7 + i/ImageSize);
+		}
+	}
+
+	// Applies the given image effect multiple times to a copy of the given image buffer, either in the parallel execution mode using one worker thread per additional CPU or in the serial execution mode as reference
+	void Apply(ImageEffect &cImageEffect, const ImageBuffer &cSourceImageBuffer, bool bParallel)
+	{
+		JobSystem::GetInstance()->SetNumOfWorkers(bParallel ? System::GetInstance()->GetNumOfCPUs() - 1 : 0);
+		cImageEffect.SetParallel(bParallel);
+		for (uint32 nLoop=0; nLoop<TestLoops; nLoop++) {
+			// The copy shares the data with the source image buffer, the image effect creates new data
+			ImageBuffer cImageBuffer = cSourceImageBuffer;
+			cImageBuffer.ApplyEffect(cImageEffect);
+		}
+	}
+
+	// Scales an image down to the half size
+	void Scale(EDataFormat nDataFormat, EColorFormat nColorFormat, IEScale::EFilter nFilter, bool bParallel)
+	{
+		ImageBuffer cImageBuffer;
+		CreateImageBuffer(cImageBuffer, nDataFormat, nColorFormat);
+		IEScale cScale(Vector3i(ImageSize/2, ImageSize/2, 1), false, nFilter);
+		Apply(cScale, cImageBuffer, bParallel);
+	}
+
+	// Converts an image into the given format
+	void Convert(EDataFormat nDataFormat, EColorFormat nColorFormat, EDataFormat nNewDataFormat, EColorFormat nNewColorFormat, bool bParallel)
+	{
+		ImageBuffer cImageBuffer;
+		CreateImageBuffer(cImageBuffer, nDataFormat, nColorFormat);
+		IEConvert cConvert(nNewDataFormat, nNewColorFormat);
+		Apply(cConvert, cImageBuffer, bParallel);
+	}
+
+	TEST(Reference_IEScale_Byte_RGB){
+		Scale(DataByte, ColorRGB, IEScale::Weighted3x3, false);
+	}
+
+	TEST(PL_IEScale_Byte_RGB){
+		Scale(DataByte, ColorRGB, IEScale::Weighted3x3, true);
+	}
+
+	TEST(Reference_IEScale_Byte_RGBA){
+		Scale(DataByte, ColorRGBA, IEScale::Weighted3x3, false);
+	}
+
+	TEST(PL_IEScale_Byte_RGBA){
+		Scale(DataByte, ColorRGBA, IEScale::Weighted3x3, true);
+	}
+
+	TEST(Reference_IEScale_Byte_RGBA_Box){
+		Scale(DataByte, ColorRGBA, IEScale::Box, false);
+	}
+
+	TEST(PL_IEScale_Byte_RGBA_Box){
+		Scale(DataByte, ColorRGBA, IEScale::Box, true);
+	}
+
+	TEST(Reference_IEScale_Byte_RGBA_Bilinear){
+		Scale(DataByte, ColorRGBA, IEScale::Bilinear, false);
+	}
+
+	TEST(PL_IEScale_Byte_RGBA_Bilinear){
+		Scale(DataByte, ColorRGBA, IEScale::Bilinear, true);
+	}
+
+	TEST(Reference_IEScale_Float_RGBA){
+		Scale(DataFloat, ColorRGBA, IEScale::Weighted3x3, false);
+	}
+
+	TEST(PL_IEScale_Float_RGBA){
+		Scale(DataFloat, ColorRGBA, IEScale::Weighted3x3, true);
+	}
+
+	TEST(Reference_IEConvert_Byte_RGB_RGBA){
+		Convert(DataByte, ColorRGB, DataByte, ColorRGBA, false);
+	}
+
+	TEST(PL_IEConvert_Byte_RGB_RGBA){
+		Convert(DataByte, ColorRGB, DataByte, ColorRGBA, true);
+	}
+
+	TEST(Reference_IEConvert_Byte_RGBA_BGRA){
+		Convert(DataByte, ColorRGBA, DataByte, ColorBGRA, false);
+	}
+
+	TEST(PL_IEConvert_Byte_RGBA_BGRA){
+		Convert(DataByte, ColorRGBA, DataByte, ColorBGRA, true);
+	}
+
+	TEST(Reference_IEConvert_Byte_RGB_Grayscale){
+		Convert(DataByte, ColorRGB, DataByte, ColorGrayscale, false);
+	}
+
+	TEST(PL_IEConvert_Byte_RGB_Grayscale){
+		Convert(DataByte, ColorRGB, DataByte, ColorGrayscale, true);
+	}
+
+	TEST(Reference_IEConvert_Byte_Float_RGBA){
+		Convert(DataByte, ColorRGBA, DataFloat, ColorRGBA, false);
+	}
+
+	TEST(PL_IEConvert_Byte_Float_RGBA){
+		Convert(DataByte, ColorRGBA, DataFloat, ColorRGBA, true);
+	}
+
+	TEST(Reference_IEConvert_Float_Byte_RGBA){
+		Convert(DataFloat, ColorRGBA, DataByte, ColorRGBA, false);
+	}
+
+	TEST(PL_IEConvert_Float_Byte_RGBA){
+		Convert(DataFloat, ColorRGBA, DataByte, ColorRGBA, true);
+	}
+}
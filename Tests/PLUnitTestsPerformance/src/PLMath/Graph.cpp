@@ -0,0 +1,168 @@
+/*********************************************************\
+ *  File: Graph.cpp                                      *
+ *
+ *  Copyright (C) 2002-2013 The PixelLight Team (http://www.pixellight.org/)
+ *
+ *  This file is part of PixelLight.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ *  and associated documentation files (the "Software"), to deal in the Software without
+ *  restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ *  Software is furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all copies or
+ *  substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ *  BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ *  DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ *  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include <UnitTest++/UnitTest++.h>
+#include <PLCore/System/System.h>
+#include <PLCore/System/JobSystem.h>
+#include <PLMath/Math.h>
+#include <PLMath/Graph/Graph.h>
+#include <PLMath/Graph/GraphPath.h>
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+using namespace std;
+using namespace PLCore;
+using namespace PLMath;
+
+
+//[-------------------------------------------------------]
+//[ Global variables                                      ]
+//[-------------------------------------------------------]
+extern ofstream outputFile;
+
+
+/*
+* Naming Convention for SUITE:
+* CLASSNAME
+*/
+SUITE(Graph_Performance) {
+	/*
+	* Naming Convention for METHOD:
+	* METHODNAME_SCENARIO
+	*/
+	// general objects for testing
+	const uint32 GridSize      = 200;	// the graph is a grid of GridSize*GridSize waypoints
+	const uint32 NumOfQueries  = 1000;	// number of different path queries per iteration
+	const uint32 TestLoops     = 2;		// number of iterations
+	Graph		*pGraph		 = nullptr;	// graph the paths are searched in
+	uint32		 nStartNodes[NumOfQueries];
+	uint32		 nEndNodes[NumOfQueries];
+	GraphPath	*pPaths[NumOfQueries];
+	bool		 bInitialized = false;
+
+	// Creates the waypoint grid with slightly jittered positions and the path queries, use always the same graph and queries
+	void Initialize()
+	{
+		if (!bInitialized) {
+			bInitialized = true;
+			pGraph = new Graph();
+
+			// Create the waypoints
+			srand(0);
+			for (uint32 nZ=0; nZ<GridSize; nZ++) {
+				for (uint32 nX=0; nX<GridSize; nX++)
+					pGraph->Create()->SetPos(nX + Math::GetRandFloat()*0.5f, 0.0f, nZ + Math::GetRandFloat()*0.5f);
+			}
+
+			// Connect each waypoint with its direct neighbours, leave out some connections so the paths are not just straight lines
+			for (uint32 nZ=0; nZ<GridSize; nZ++) {
+				for (uint32 nX=0; nX<GridSize; nX++) {
+					GraphNode *pNode = pGraph->GetByIndex(nZ*GridSize + nX);
+					if (nX+1 < GridSize && Math::GetRandFloat() > 0.1f) {
+						GraphNode *pNeighbour = pGraph->GetByIndex(nZ*GridSize + nX + 1);
+						pNode->AddNeighbour(*pNeighbour);
+						pNeighbour->AddNeighbour(*pNode);
+					}
+					if (nZ+1 < GridSize && Math::GetRandFloat() > 0.1f) {
+						GraphNode *pNeighbour = pGraph->GetByIndex((nZ+1)*GridSize + nX);
+						pNode->AddNeighbour(*pNeighbour);
+						pNeighbour->AddNeighbour(*pNode);
+					}
+				}
+			}
+
+			// Create the path queries
+			for (uint32 i=0; i<NumOfQueries; i++) {
+				nStartNodes[i] = static_cast<uint32>(Math::GetRand()%pGraph->GetNumOfElements());
+				nEndNodes[i]   = static_cast<uint32>(Math::GetRand()%pGraph->GetNumOfElements());
+			}
+
+			// Build the internal search data right now so that this is not part of the measured queries
+			delete pGraph->FindShortestPath(0, 0);
+		}
+	}
+
+	// Destroys the found paths and returns the number of found paths
+	uint32 DestroyPaths()
+	{
+		uint32 nNumOfPaths = 0;
+		for (uint32 i=0; i<NumOfQueries; i++) {
+			if (pPaths[i]) {
+				nNumOfPaths++;
+				delete pPaths[i];
+			}
+		}
+		return nNumOfPaths;
+	}
+
+	// Performs the path queries one after another, with or without the path cache
+	void FindSingle(uint32 nPathCacheSize)
+	{
+		Initialize();
+		pGraph->SetPathCacheSize(nPathCacheSize);
+		uint32 nNumOfPaths = 0;
+		for (uint32 nLoop=0; nLoop<TestLoops; nLoop++) {
+			for (uint32 i=0; i<NumOfQueries; i++)
+				pPaths[i] = pGraph->FindShortestPath(nStartNodes[i], nEndNodes[i]);
+			nNumOfPaths += DestroyPaths();
+		}
+		outputFile << "Graph_Performance: " << nNumOfPaths << " paths found" << endl;
+	}
+
+	// Performs the path queries as batch using the given number of worker threads, without the path cache
+	void FindBatch(uint32 nNumOfWorkers)
+	{
+		Initialize();
+		JobSystem::GetInstance()->SetNumOfWorkers(nNumOfWorkers);
+		pGraph->SetPathCacheSize(0);
+		uint32 nNumOfPaths = 0;
+		for (uint32 nLoop=0; nLoop<TestLoops; nLoop++) {
+			pGraph->FindShortestPaths(NumOfQueries, nStartNodes, nEndNodes, pPaths);
+			nNumOfPaths += DestroyPaths();
+		}
+		outputFile << "Graph_Performance: " << nNumOfPaths << " paths found" << endl;
+	}
+
+	TEST(FindShortestPath){
+		FindSingle(0);
+	}
+
+	TEST(FindShortestPath_Cached){
+		// The first iteration fills the path cache, the following ones are served by it
+		FindSingle(NumOfQueries);
+	}
+
+	TEST(FindShortestPaths_0_Workers){
+		FindBatch(0);
+	}
+
+	TEST(FindShortestPaths_CPU_Workers){
+		FindBatch(System::GetInstance()->GetNumOfCPUs() - 1);
+	}
+}
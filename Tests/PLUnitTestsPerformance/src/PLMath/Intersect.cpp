@@ -0,0 +1,173 @@
+/*********************************************************\
+ *  File: Intersect.cpp                                  *
+ *
+ *  Copyright (C) 2002-2013 The PixelLight Team (http://www.pixellight.org/)
+ *
+ *  This file is part of PixelLight.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ *  and associated documentation files (the "Software"), to deal in the Software without
+ *  restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ *  Software is furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all copies or
+ *  substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ *  BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ *  DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ *  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include <UnitTest++/UnitTest++.h>
+#include <PLMath/Math.h>
+#include <PLMath/Sphere.h>
+#include <PLMath/PlaneSet.h>
+#include <PLMath/Intersect.h>
+#include <PLMath/Matrix4x4.h>
+#include <PLMath/AABoundingBox.h>
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+using namespace std;
+using namespace PLCore;
+using namespace PLMath;
+
+
+//[-------------------------------------------------------]
+//[ Global variables                                      ]
+//[-------------------------------------------------------]
+extern ofstream outputFile;
+
+
+/*
+* Naming Convention for SUITE:
+* CLASSNAME
+*/
+SUITE(Intersect_Performance) {
+	/*
+	* Naming Convention for METHOD:
+	* METHODNAME_SCENARIO
+	*/
+	// general objects for testing
+	const uint32 NumOfObjects = 100000;	// number of boxes, spheres, triangles and rays
+	const uint32 TestLoops    = 20;		// number of iterations
+	const float  WorldSize    = 1000.0f;	// objects are placed within [0, WorldSize]
+	AABoundingBox cBoxes[NumOfObjects];
+	Sphere		  cSpheres[NumOfObjects];
+	Vector3		  vTriangles[NumOfObjects*3];
+	Vector3		  vTriangleNormals[NumOfObjects];
+	Vector3		  vRayOrigins[NumOfObjects];
+	Vector3		  vRayDirections[NumOfObjects];
+	PlaneSet	  cFrustum;
+	uint32		  nResult      = 0;			// number of intersections, written so the work can't be optimized away
+	bool		  bInitialized = false;
+
+	// Returns a random position within the world
+	Vector3 GetRandomPosition()
+	{
+		return Vector3(Math::GetRandFloat()*WorldSize, Math::GetRandFloat()*WorldSize, Math::GetRandFloat()*WorldSize);
+	}
+
+	// Fills the objects with some pseudo random data, always the same
+	void Initialize()
+	{
+		if (!bInitialized) {
+			srand(0);
+			for (uint32 i=0; i<NumOfObjects; i++) {
+				const Vector3 vPos = GetRandomPosition();
+				const float fSize = 0.5f + Math::GetRandFloat()*10.0f;
+				cBoxes[i] = AABoundingBox(vPos - Vector3(fSize, fSize, fSize), vPos + Vector3(fSize, fSize, fSize));
+				cSpheres[i].SetPos(GetRandomPosition());
+				cSpheres[i].SetRadius(fSize);
+				Vector3 *pvTriangle = &vTriangles[i*3];
+				pvTriangle[0] = vPos;
+				pvTriangle[1] = vPos + Vector3(fSize, 0.0f, 0.0f);
+				pvTriangle[2] = vPos + Vector3(0.0f, fSize, fSize*0.5f);
+				vTriangleNormals[i] = (pvTriangle[1] - pvTriangle[0]).CrossProduct(pvTriangle[2] - pvTriangle[0]).Normalize();
+				vRayOrigins[i]    = GetRandomPosition();
+				vRayDirections[i] = (GetRandomPosition() - vRayOrigins[i]).Normalize();
+			}
+
+			// A camera frustum in the middle of the world looking along the z axis
+			Matrix4x4 mView, mProjection;
+			mView.LookAt(Vector3(WorldSize*0.5f, WorldSize*0.5f, 0.0f), Vector3(WorldSize*0.5f, WorldSize*0.5f, WorldSize), Vector3::UnitY);
+			mProjection.PerspectiveFov(static_cast<float>(90.0f*Math::DegToRad), 4.0f/3.0f, 0.1f, WorldSize);
+			cFrustum.CreateViewPlanes(mProjection*mView);
+
+			bInitialized = true;
+		}
+	}
+
+	TEST(AABoxAABox){
+		Initialize();
+		for (uint32 nLoop=0; nLoop<TestLoops; nLoop++) {
+			for (uint32 i=0; i<NumOfObjects; i++) {
+				if (Intersect::AABoxAABox(cBoxes[i], cBoxes[(i + nLoop + 1)%NumOfObjects]))
+					nResult++;
+			}
+		}
+	}
+
+	TEST(SphereAABox){
+		Initialize();
+		for (uint32 nLoop=0; nLoop<TestLoops; nLoop++) {
+			for (uint32 i=0; i<NumOfObjects; i++) {
+				if (Intersect::SphereAABox(cSpheres[i], cBoxes[(i + nLoop)%NumOfObjects]))
+					nResult++;
+			}
+		}
+	}
+
+	TEST(AABoxLine){
+		Initialize();
+		for (uint32 nLoop=0; nLoop<TestLoops; nLoop++) {
+			for (uint32 i=0; i<NumOfObjects; i++) {
+				const AABoundingBox &cBox = cBoxes[(i + nLoop)%NumOfObjects];
+				if (Intersect::AABoxLine(cBox.vMin, cBox.vMax, vRayOrigins[i], vRayOrigins[i] + vRayDirections[i]*WorldSize))
+					nResult++;
+			}
+		}
+	}
+
+	TEST(TriangleRay){
+		Initialize();
+		Vector3 vIntersection;
+		for (uint32 nLoop=0; nLoop<TestLoops; nLoop++) {
+			for (uint32 i=0; i<NumOfObjects; i++) {
+				const uint32 nTriangle = (i + nLoop)%NumOfObjects;
+				const Vector3 *pvTriangle = &vTriangles[nTriangle*3];
+				if (Intersect::TriangleRay(pvTriangle[0], pvTriangle[1], pvTriangle[2], vTriangleNormals[nTriangle], vRayOrigins[i], vRayDirections[i], vIntersection))
+					nResult++;
+			}
+		}
+	}
+
+	TEST(PlaneSetAABox){
+		Initialize();
+		for (uint32 nLoop=0; nLoop<TestLoops; nLoop++) {
+			for (uint32 i=0; i<NumOfObjects; i++) {
+				if (Intersect::PlaneSetAABox(cFrustum, cBoxes[i].vMin, cBoxes[i].vMax))
+					nResult++;
+			}
+		}
+	}
+
+	TEST(PlaneSetSphere){
+		Initialize();
+		for (uint32 nLoop=0; nLoop<TestLoops; nLoop++) {
+			for (uint32 i=0; i<NumOfObjects; i++) {
+				if (Intersect::PlaneSetSphere(cFrustum, cSpheres[i].GetPos(), cSpheres[i].GetRadius()))
+					nResult++;
+			}
+		}
+	}
+}
@@ -0,0 +1,116 @@
+/*********************************************************\
+ *  File: Matrix3x4.cpp                                  *
+ *
+ *  Copyright (C) 2002-2013 The PixelLight Team (http://www.pixellight.org/)
+ *
+ *  This file is part of PixelLight.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ *  and associated documentation files (the "Software"), to deal in the Software without
+ *  restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ *  Software is furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all copies or
+ *  substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ *  BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ *  DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ *  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include <UnitTest++/UnitTest++.h>
+#include <PLMath/Matrix3x4.h>
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+using namespace std;
+using namespace PLCore;
+using namespace PLMath;
+
+
+//[-------------------------------------------------------]
+//[ Global variables                                      ]
+//[-------------------------------------------------------]
+extern ofstream outputFile;
+
+
+/*
+* Naming Convention for SUITE:
+* CLASSNAME
+*/
+SUITE(Matrix3x4_Performance) {
+	/*
+	* Naming Convention for METHOD:
+	* METHODNAME_SCENARIO
+	*/
+	// general objects for testing
+	const uint32 NumOfMatrices = 100;		// number of matrices
+	const uint32 NumOfPoints   = 100000;	// number of points
+	Matrix3x4 mMatrices[NumOfMatrices];
+	Vector3   vPoints[NumOfPoints];
+	float     fVertices[NumOfPoints*8];		// interleaved vertices (position, normal, texture coordinate)
+	Vector3   vResults[NumOfPoints];		// results are written into this array so the work can't be optimized away
+	bool      bInitialized = false;
+
+	// Fills the matrices and points with some pseudo random data
+	void Initialize()
+	{
+		if (!bInitialized) {
+			for (uint32 i=0; i<NumOfMatrices; i++) {
+				mMatrices[i].FromEulerAngleY(static_cast<float>(i));
+				mMatrices[i].SetTranslation(static_cast<float>(i%7), static_cast<float>(i%11), static_cast<float>(i%13));
+			}
+			for (uint32 i=0; i<NumOfPoints; i++) {
+				vPoints[i].SetXYZ(static_cast<float>(i%23), static_cast<float>(i%29), static_cast<float>(i%31));
+				fVertices[i*8]   = vPoints[i].x;
+				fVertices[i*8+1] = vPoints[i].y;
+				fVertices[i*8+2] = vPoints[i].z;
+			}
+			bInitialized = true;
+		}
+	}
+
+	// C++ reference implementation, used to show the gain of the compile-time selected SIMD code path
+	void ScalarTransform(const Matrix3x4 &mM, const Vector3 &vV, Vector3 &vDestination)
+	{
+		vDestination.x = mM.xx*vV.x + mM.xy*vV.y + mM.xz*vV.z + mM.xw;
+		vDestination.y = mM.yx*vV.x + mM.yy*vV.y + mM.yz*vV.z + mM.yw;
+		vDestination.z = mM.zx*vV.x + mM.zy*vV.y + mM.zz*vV.z + mM.zw;
+	}
+
+	TEST(PL_TransformPoints){
+		Initialize();
+		for (uint32 nLoop=0; nLoop<NumOfMatrices; nLoop++)
+			mMatrices[nLoop].TransformPoints(vPoints, vResults, NumOfPoints);
+	}
+
+	TEST(PL_TransformPoints_InPlace){
+		Initialize();
+		for (uint32 nLoop=0; nLoop<NumOfMatrices; nLoop++)
+			mMatrices[nLoop].TransformPoints(vResults, vResults, NumOfPoints);
+	}
+
+	TEST(PL_TransformPoints_Interleaved){
+		Initialize();
+		for (uint32 nLoop=0; nLoop<NumOfMatrices; nLoop++)
+			mMatrices[nLoop].TransformPoints(fVertices, fVertices, NumOfPoints, sizeof(float)*8, sizeof(float)*8);
+	}
+
+	TEST(Scalar_TransformPoints){
+		Initialize();
+		for (uint32 nLoop=0; nLoop<NumOfMatrices; nLoop++) {
+			const Matrix3x4 &mM = mMatrices[nLoop];
+			for (uint32 i=0; i<NumOfPoints; i++)
+				ScalarTransform(mM, vPoints[i], vResults[i]);
+		}
+	}
+}
@@ -0,0 +1,170 @@
+/*********************************************************\
+ *  File: Matrix4x4.cpp                                  *
+ *
+ *  Copyright (C) 2002-2013 The PixelLight Team (http://www.pixellight.org/)
+ *
+ *  This file is part of PixelLight.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ *  and associated documentation files (the "Software"), to deal in the Software without
+ *  restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ *  Software is furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all copies or
+ *  substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ *  BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ *  DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ *  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include <UnitTest++/UnitTest++.h>
+#include <PLMath/Matrix4x4.h>
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+using namespace std;
+using namespace PLCore;
+using namespace PLMath;
+
+
+//[-------------------------------------------------------]
+//[ Global variables                                      ]
+//[-------------------------------------------------------]
+extern ofstream outputFile;
+
+
+/*
+* Naming Convention for SUITE:
+* CLASSNAME
+*/
+SUITE(Matrix4x4_Performance) {
+	/*
+	* Naming Convention for METHOD:
+	* METHODNAME_SCENARIO
+	*/
+	// general objects for testing
+	const uint32 NumOfMatrices = 1024;		// number of matrices
+	const uint32 NumOfPoints   = 100000;	// number of points
+	const uint32 TestLoops     = 1000;		// number of iterations
+	Matrix4x4 mMatrices[NumOfMatrices];
+	Vector3   vPoints[NumOfPoints];
+	Matrix4x4 mResults[NumOfMatrices];		// results are written into the following objects so the work can't be optimized away
+	Vector3   vResults[NumOfPoints];
+	bool      bInitialized = false;
+
+	// Fills the matrices and points with some pseudo random data
+	void Initialize()
+	{
+		if (!bInitialized) {
+			for (uint32 i=0; i<NumOfMatrices; i++) {
+				mMatrices[i].FromEulerAngleY(static_cast<float>(i));
+				mMatrices[i].SetTranslation(static_cast<float>(i%7), static_cast<float>(i%11), static_cast<float>(i%13));
+				mMatrices[i].wx = 0.001f*(i%3);
+			}
+			for (uint32 i=0; i<NumOfPoints; i++)
+				vPoints[i].SetXYZ(static_cast<float>(i%23), static_cast<float>(i%29), static_cast<float>(i%31));
+			bInitialized = true;
+		}
+	}
+
+	// C++ reference implementations, used to show the gain of the compile-time selected SIMD code path
+	void ScalarMultiply(const Matrix4x4 &mA, const Matrix4x4 &mB, Matrix4x4 &mDestination)
+	{
+		for (int nColumn=0; nColumn<4; nColumn++) {
+			for (int nRow=0; nRow<4; nRow++)
+				mDestination.fM[nColumn*4+nRow] = mA.fM[nRow]*mB.fM[nColumn*4] + mA.fM[4+nRow]*mB.fM[nColumn*4+1] + mA.fM[8+nRow]*mB.fM[nColumn*4+2] + mA.fM[12+nRow]*mB.fM[nColumn*4+3];
+		}
+	}
+
+	void ScalarInvert(const Matrix4x4 &mM, Matrix4x4 &mDestination)
+	{
+		const float xx = mM.xx, xy = mM.xy, xz = mM.xz, xw = mM.xw, yx = mM.yx, yy = mM.yy, yz = mM.yz, yw = mM.yw;
+		const float zx = mM.zx, zy = mM.zy, zz = mM.zz, zw = mM.zw, wx = mM.wx, wy = mM.wy, wz = mM.wz, ww = mM.ww;
+		float fDet = (xx*yy - yx*xy)*(zz*ww - wz*zw) - (xx*zy - zx*xy)*(yz*ww - wz*yw) +
+					 (xx*wy - wx*xy)*(yz*zw - zz*yw) + (yx*zy - zx*yy)*(xz*ww - wz*xw) -
+					 (yx*wy - wx*yy)*(xz*zw - zz*xw) + (zx*wy - wx*zy)*(xz*yw - yz*xw);
+		if (fDet) {
+			fDet = 1.0f/fDet;
+			mDestination.Set(fDet*(yy*(zz*ww - wz*zw) + zy*(wz*yw - yz*ww) + wy*(yz*zw - zz*yw)), fDet*(zy*(xz*ww - wz*xw) + wy*(zz*xw - xz*zw) + xy*(wz*zw - zz*ww)), fDet*(wy*(xz*yw - yz*xw) + xy*(yz*ww - wz*yw) + yy*(wz*xw - xz*ww)), fDet*(xy*(zz*yw - yz*zw) + yy*(xz*zw - zz*xw) + zy*(yz*xw - xz*yw)),
+							 fDet*(yz*(zx*ww - wx*zw) + zz*(wx*yw - yx*ww) + wz*(yx*zw - zx*yw)), fDet*(zz*(xx*ww - wx*xw) + wz*(zx*xw - xx*zw) + xz*(wx*zw - zx*ww)), fDet*(wz*(xx*yw - yx*xw) + xz*(yx*ww - wx*yw) + yz*(wx*xw - xx*ww)), fDet*(xz*(zx*yw - yx*zw) + yz*(xx*zw - zx*xw) + zz*(yx*xw - xx*yw)),
+							 fDet*(yw*(zx*wy - wx*zy) + zw*(wx*yy - yx*wy) + ww*(yx*zy - zx*yy)), fDet*(zw*(xx*wy - wx*xy) + ww*(zx*xy - xx*zy) + xw*(wx*zy - zx*wy)), fDet*(ww*(xx*yy - yx*xy) + xw*(yx*wy - wx*yy) + yw*(wx*xy - xx*wy)), fDet*(xw*(zx*yy - yx*zy) + yw*(xx*zy - zx*xy) + zw*(yx*xy - xx*yy)),
+							 fDet*(yx*(wy*zz - zy*wz) + zx*(yy*wz - wy*yz) + wx*(zy*yz - yy*zz)), fDet*(zx*(wy*xz - xy*wz) + wx*(xy*zz - zy*xz) + xx*(zy*wz - wy*zz)), fDet*(wx*(yy*xz - xy*yz) + xx*(wy*yz - yy*wz) + yx*(xy*wz - wy*xz)), fDet*(xx*(yy*zz - zy*yz) + yx*(zy*xz - xy*zz) + zx*(xy*yz - yy*xz)));
+		} else {
+			mDestination = Matrix4x4::Identity;
+		}
+	}
+
+	void ScalarTransform(const Matrix4x4 &mM, const Vector3 &vV, Vector3 &vDestination)
+	{
+		const float fInvW = 1.0f/(mM.wx*vV.x + mM.wy*vV.y + mM.wz*vV.z + mM.ww);
+		vDestination.x = (mM.xx*vV.x + mM.xy*vV.y + mM.xz*vV.z + mM.xw)*fInvW;
+		vDestination.y = (mM.yx*vV.x + mM.yy*vV.y + mM.yz*vV.z + mM.yw)*fInvW;
+		vDestination.z = (mM.zx*vV.x + mM.zy*vV.y + mM.zz*vV.z + mM.zw)*fInvW;
+	}
+
+	TEST(PL_Multiply){
+		Initialize();
+		for (uint32 nLoop=0; nLoop<TestLoops; nLoop++) {
+			for (uint32 i=0; i<NumOfMatrices; i++)
+				mResults[i] = mMatrices[i]*mMatrices[(i+nLoop)%NumOfMatrices];
+		}
+	}
+
+	TEST(Scalar_Multiply){
+		Initialize();
+		for (uint32 nLoop=0; nLoop<TestLoops; nLoop++) {
+			for (uint32 i=0; i<NumOfMatrices; i++)
+				ScalarMultiply(mMatrices[i], mMatrices[(i+nLoop)%NumOfMatrices], mResults[i]);
+		}
+	}
+
+	TEST(PL_GetInverted){
+		Initialize();
+		for (uint32 nLoop=0; nLoop<TestLoops; nLoop++) {
+			for (uint32 i=0; i<NumOfMatrices; i++)
+				mResults[i] = mMatrices[i].GetInverted();
+		}
+	}
+
+	TEST(Scalar_GetInverted){
+		Initialize();
+		for (uint32 nLoop=0; nLoop<TestLoops; nLoop++) {
+			for (uint32 i=0; i<NumOfMatrices; i++)
+				ScalarInvert(mMatrices[i], mResults[i]);
+		}
+	}
+
+	TEST(PL_TransformPoints){
+		Initialize();
+		for (uint32 nLoop=0; nLoop<TestLoops/10; nLoop++)
+			mMatrices[nLoop].TransformPoints(vPoints, vResults, NumOfPoints);
+	}
+
+	TEST(PL_Vector3_Transform){
+		Initialize();
+		for (uint32 nLoop=0; nLoop<TestLoops/10; nLoop++) {
+			const Matrix4x4 &mM = mMatrices[nLoop];
+			for (uint32 i=0; i<NumOfPoints; i++)
+				vResults[i] = mM*vPoints[i];
+		}
+	}
+
+	TEST(Scalar_TransformPoints){
+		Initialize();
+		for (uint32 nLoop=0; nLoop<TestLoops/10; nLoop++) {
+			const Matrix4x4 &mM = mMatrices[nLoop];
+			for (uint32 i=0; i<NumOfPoints; i++)
+				ScalarTransform(mM, vPoints[i], vResults[i]);
+		}
+	}
+}
@@ -0,0 +1,117 @@
+/*********************************************************\
+ *  File: Quaternion.cpp                                 *
+ *
+ *  Copyright (C) 2002-2013 The PixelLight Team (http://www.pixellight.org/)
+ *
+ *  This file is part of PixelLight.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ *  and associated documentation files (the "Software"), to deal in the Software without
+ *  restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ *  Software is furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all copies or
+ *  substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ *  BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ *  DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ *  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include <UnitTest++/UnitTest++.h>
+#include <PLMath/Quaternion.h>
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+using namespace std;
+using namespace PLCore;
+using namespace PLMath;
+
+
+//[-------------------------------------------------------]
+//[ Global variables                                      ]
+//[-------------------------------------------------------]
+extern ofstream outputFile;
+
+
+/*
+* Naming Convention for SUITE:
+* CLASSNAME
+*/
+SUITE(Quaternion_Performance) {
+	/*
+	* Naming Convention for METHOD:
+	* METHODNAME_SCENARIO
+	*/
+	// general objects for testing
+	const uint32 NumOfQuaternions = 1024;		// number of quaternions
+	const uint32 TestLoops        = 1000;		// number of iterations
+	Quaternion qQuaternions[NumOfQuaternions];
+	Quaternion qResults[NumOfQuaternions];		// results are written into this array so the work can't be optimized away
+	bool       bInitialized = false;
+
+	// Fills the quaternions with some pseudo random rotations
+	void Initialize()
+	{
+		if (!bInitialized) {
+			for (uint32 i=0; i<NumOfQuaternions; i++) {
+				qQuaternions[i].FromAxisAngle(static_cast<float>(i%3), static_cast<float>(i%5 + 1), static_cast<float>(i%7), static_cast<float>(i));
+				qQuaternions[i].Normalize();
+			}
+			bInitialized = true;
+		}
+	}
+
+	// C++ reference implementation, used to show the gain of the compile-time selected SIMD code path
+	void ScalarSlerp(const Quaternion &qQ1, const Quaternion &qQ2, float fTime, Quaternion &qDestination)
+	{
+		float fCosom = qQ1.w*qQ2.w + qQ1.x*qQ2.x + qQ1.y*qQ2.y + qQ1.z*qQ2.z;
+		float fSign = 1.0f;
+		if (fCosom < 0.0f) {
+			fCosom = -fCosom;
+			fSign  = -1.0f;
+		}
+		float fScale0, fScale1;
+		if ((1.0f-fCosom) > Math::Epsilon) {
+			const float fOmega = Math::ACos(fCosom);
+			const float fSinom = Math::Sin(fOmega);
+			fScale0 = Math::Sin((1.0f - fTime)*fOmega)/fSinom;
+			fScale1 = Math::Sin(fTime*fOmega)/fSinom;
+		} else {
+			fScale0 = 1.0f - fTime;
+			fScale1 = fTime;
+		}
+		fScale1 *= fSign;
+		qDestination.w = fScale0*qQ1.w + fScale1*qQ2.w;
+		qDestination.x = fScale0*qQ1.x + fScale1*qQ2.x;
+		qDestination.y = fScale0*qQ1.y + fScale1*qQ2.y;
+		qDestination.z = fScale0*qQ1.z + fScale1*qQ2.z;
+	}
+
+	TEST(PL_Slerp){
+		Initialize();
+		for (uint32 nLoop=0; nLoop<TestLoops; nLoop++) {
+			const float fTime = static_cast<float>(nLoop)/TestLoops;
+			for (uint32 i=0; i<NumOfQuaternions; i++)
+				qResults[i].Slerp(qQuaternions[i], qQuaternions[(i+nLoop)%NumOfQuaternions], fTime);
+		}
+	}
+
+	TEST(Scalar_Slerp){
+		Initialize();
+		for (uint32 nLoop=0; nLoop<TestLoops; nLoop++) {
+			const float fTime = static_cast<float>(nLoop)/TestLoops;
+			for (uint32 i=0; i<NumOfQuaternions; i++)
+				ScalarSlerp(qQuaternions[i], qQuaternions[(i+nLoop)%NumOfQuaternions], fTime, qResults[i]);
+		}
+	}
+}
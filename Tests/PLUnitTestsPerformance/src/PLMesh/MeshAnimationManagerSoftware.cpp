@@ -0,0 +1,600 @@
+/*********************************************************\
+ *  File: MeshAnimationManagerSoftware.cpp               *
+ *
+ *  Copyright (C) 2002-2013 The PixelLight Team (http://www.pixellight.org/)
+ *
+ *  This file is part of PixelLight.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ *  and associated documentation files (the "Software"), to deal in the Software without
+ *  restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ *  Software is furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all copies or
+ *  substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ *  BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ *  DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ *  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include <stdlib.h>
+#include <UnitTest++/UnitTest++.h>
+#include <PLCore/Runtime.h>
+#include <PLCore/System/System.h>
+#include <PLCore/System/JobSystem.h>
+#include <PLRenderer/RendererContext.h>
+#include <PLRenderer/Renderer/VertexBuffer.h>
+#include <PLMesh/Joint.h>
+#include <PLMesh/Weight.h>
+#include <PLMesh/Skeleton.h>
+#include <PLMesh/MeshHandler.h>
+#include <PLMesh/JointHandler.h>
+#include <PLMesh/MeshManager.h>
+#include <PLMesh/VertexWeights.h>
+#include <PLMesh/MeshMorphTarget.h>
+#include <PLMesh/SkeletonHandler.h>
+#include <PLMesh/SkeletonManager.h>
+#include <PLMesh/MeshAnimationManagerSoftware.h>
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+using namespace std;
+using namespace PLCore;
+using namespace PLMath;
+using namespace PLRenderer;
+using namespace PLMesh;
+
+
+//[-------------------------------------------------------]
+//[ Global variables                                      ]
+//[-------------------------------------------------------]
+extern ofstream outputFile;
+
+
+/*
+* Naming Convention for SUITE:
+* CLASSNAME
+*/
+SUITE(MeshAnimationManagerSoftware) {
+	/*
+	* Naming Convention for METHOD:
+	* METHODNAME_SCENARIO
+	*/
+	// general objects for testing
+	const uint32 NumOfJoints			= 16;		// number of skeleton joints
+	const uint32 MaxNumOfWeights		= 4;		// maximum number of joint weights per vertex, some vertices have no weights at all
+	const uint32 NumOfLargeMeshVertices = 5003;		// number of vertices of the large mesh, several skinning ranges and not a multiple of four
+	const uint32 NumOfSmallMeshVertices = 999;		// number of vertices of the small mesh, a single skinning range and not a multiple of four
+	const uint32 NumOfMeshHandlers		= 3;		// number of mesh handlers per mesh, each one with another pose
+	const float  Epsilon				= 0.001f;	// maximum allowed difference of a vertex component
+	RendererContext	   *pRendererContext = nullptr;
+	MeshManager		   *pMeshManager	 = nullptr;
+	Array<MeshHandler*>	lstMeshHandlers;			// mesh handlers of the large mesh followed by the mesh handlers of the small mesh
+	bool				bInitialized	 = false;
+
+	// Returns a random value within [-fRange, fRange]
+	float GetRandom(float fRange)
+	{
+		return (static_cast<float>(rand())/RAND_MAX*2.0f - 1.0f)*fRange;
+	}
+
+	// Fills the position of all vertices of the given vertex buffer with random values
+	void FillRandomPositions(VertexBuffer &cVertexBuffer, float fRange)
+	{
+		if (cVertexBuffer.Lock(Lock::WriteOnly)) {
+			for (uint32 i=0; i<cVertexBuffer.GetNumOfElements(); i++) {
+				float *pfPosition = static_cast<float*>(cVertexBuffer.GetData(i, VertexBuffer::Position));
+				pfPosition[Vector3::X] = GetRandom(fRange);
+				pfPosition[Vector3::Y] = GetRandom(fRange);
+				pfPosition[Vector3::Z] = GetRandom(fRange);
+			}
+			cVertexBuffer.Unlock();
+		}
+	}
+
+	// Creates a skinned mesh with a position and a normal per vertex, the vertices have a varying number of weights
+	// with different biases and there's one relative morph target for all vertices and one for only some vertices
+	Mesh *CreateMesh(uint32 nNumOfVertices)
+	{
+		Mesh *pMesh = pMeshManager->CreateMesh();
+
+		// Fill the vertex buffer
+		VertexBuffer *pVertexBuffer = pMesh->GetMorphTarget(0)->GetVertexBuffer();
+		pVertexBuffer->AddVertexAttribute(VertexBuffer::Position, 0, VertexBuffer::Float3);
+		pVertexBuffer->AddVertexAttribute(VertexBuffer::Normal,   0, VertexBuffer::Float3);
+		pVertexBuffer->Allocate(nNumOfVertices, Usage::Dynamic);
+		FillRandomPositions(*pVertexBuffer, 10.0f);
+		if (pVertexBuffer->Lock(Lock::ReadWrite)) {
+			for (uint32 i=0; i<nNumOfVertices; i++) {
+				const Vector3 vNormal = Vector3(GetRandom(1.0f), GetRandom(1.0f), 1.0f).Normalize();
+				float *pfNormal = static_cast<float*>(pVertexBuffer->GetData(i, VertexBuffer::Normal));
+				pfNormal[Vector3::X] = vNormal.x;
+				pfNormal[Vector3::Y] = vNormal.y;
+				pfNormal[Vector3::Z] = vNormal.z;
+			}
+			pVertexBuffer->Unlock();
+		}
+
+		// Relative morph target moving all vertices
+		MeshMorphTarget *pMorphTarget = pMesh->AddMorphTarget();
+		pMorphTarget->SetRelative(true);
+		pVertexBuffer = pMorphTarget->GetVertexBuffer();
+		pVertexBuffer->AddVertexAttribute(VertexBuffer::Position, 0, VertexBuffer::Float3);
+		pVertexBuffer->Allocate(nNumOfVertices, Usage::Dynamic);
+		FillRandomPositions(*pVertexBuffer, 1.0f);
+
+		// Relative morph target moving every third vertex and the last one
+		pMorphTarget = pMesh->AddMorphTarget();
+		pMorphTarget->SetRelative(true);
+		for (uint32 i=0; i<nNumOfVertices-1; i+=3)
+			pMorphTarget->GetVertexIDs().Add(i);
+		pMorphTarget->GetVertexIDs().Add(nNumOfVertices - 1);
+		pVertexBuffer = pMorphTarget->GetVertexBuffer();
+		pVertexBuffer->AddVertexAttribute(VertexBuffer::Position, 0, VertexBuffer::Float3);
+		pVertexBuffer->Allocate(pMorphTarget->GetVertexIDs().GetNumOfElements(), Usage::Dynamic);
+		FillRandomPositions(*pVertexBuffer, 1.0f);
+
+		// Create a simple joint chain
+		Skeleton *pSkeleton = pMesh->GetSkeletonManager().Create("Skeleton");
+		pSkeleton->GetJoints().Resize(NumOfJoints);
+		for (uint32 i=0; i<NumOfJoints; i++) {
+			Joint *pJoint = pSkeleton->Create(String("Joint") + i);
+			pJoint->SetID(i);
+			pJoint->SetParent(static_cast<int>(i) - 1);
+			pJoint->SetTranslation(Vector3(0.0f, 1.0f, 0.0f));
+			pJoint->SetRotation(Quaternion(Vector3::UnitZ, static_cast<float>(i)*0.01f));
+		}
+		pSkeleton->UpdateJointInformation();
+		SkeletonHandler *pSkeletonHandler = new SkeletonHandler();
+		pSkeletonHandler->SetResource(pSkeleton);
+		pMesh->GetSkeletonHandlers().Add(pSkeletonHandler);
+
+		// Add the joint weights, vertex "i" has "i%(MaxNumOfWeights + 1)" weights with different biases summing up to one
+		Array<Weight>        &lstWeights       = pMesh->GetWeights();
+		Array<VertexWeights> &lstVertexWeights = pMesh->GetVertexWeights();
+		lstVertexWeights.Resize(nNumOfVertices);
+		for (uint32 i=0; i<nNumOfVertices; i++) {
+			const uint32 nNumOfWeights = i%(MaxNumOfWeights + 1);
+			for (uint32 nWeight=0; nWeight<nNumOfWeights; nWeight++) {
+				lstVertexWeights[i].GetWeights().Add(lstWeights.GetNumOfElements());
+				Weight &cWeight = lstWeights.Add();
+				cWeight.SetJoint((i + nWeight*7)%NumOfJoints);
+				cWeight.SetBias(static_cast<float>(nWeight + 1)/(nNumOfWeights*(nNumOfWeights + 1)/2));
+			}
+		}
+
+		// Done
+		return pMesh;
+	}
+
+	// Creates a mesh handler with a software mesh animation manager using the given mesh, each mesh handler has other morph target weights and another pose
+	MeshHandler *CreateMeshHandler(Mesh &cMesh, uint32 nPose)
+	{
+		MeshHandler *pMeshHandler = new MeshHandler();
+		pMeshHandler->SetMesh(&cMesh);
+		pMeshHandler->CreateMeshAnimationManager("PLMesh::MeshAnimationManagerSoftware");
+
+		// Morph target weights
+		for (uint32 i=1; i<cMesh.GetNumOfMorphTargets(); i++) {
+			const float fWeight = static_cast<float>(i + nPose)*0.3f;
+			pMeshHandler->GetBaseMorphTargetWeights()[i] = fWeight;
+			pMeshHandler->GetMorphTargetWeights()[i] = fWeight;
+		}
+
+		// Pose, the joints are user controlled so that the mesh animation manager keeps their absolute states
+		Array<JointHandler> &lstJointHandlers = pMeshHandler->GetSkeletonHandler()->GetJointHandlers();
+		for (uint32 i=0; i<lstJointHandlers.GetNumOfElements(); i++) {
+			JointHandler &cJointHandler = lstJointHandlers[i];
+			cJointHandler.SetUserControlled(true);
+			cJointHandler.SetTranslationAbsolute(Vector3(0.1f*nPose, static_cast<float>(i), -0.05f*i));
+			cJointHandler.SetRotationAbsolute(Quaternion(Vector3(1.0f, static_cast<float>(nPose), static_cast<float>(i)).Normalize(), 0.1f + 0.05f*(i + nPose)));
+		}
+
+		// After this the mesh handler owns a vertex buffer
+		pMeshHandler->MeshUpdateRequired();
+		pMeshHandler->Update(0.0f);
+		return pMeshHandler;
+	}
+
+	// Creates the renderer, the meshes and the mesh handlers, returns 'false' if the null renderer is not available
+	bool Initialize()
+	{
+		if (!bInitialized) {
+			bInitialized = true;
+
+			// Create the null renderer
+			Runtime::ScanDirectoryPlugins();
+			pRendererContext = RendererContext::CreateInstance("PLRendererNull::Renderer", NULL_HANDLE);
+			if (pRendererContext) {
+				pMeshManager = new MeshManager(pRendererContext->GetRenderer());
+				srand(1);
+
+				// Create the meshes and the mesh handlers
+				Mesh *pLargeMesh = CreateMesh(NumOfLargeMeshVertices);
+				Mesh *pSmallMesh = CreateMesh(NumOfSmallMeshVertices);
+				for (uint32 i=0; i<NumOfMeshHandlers; i++)
+					lstMeshHandlers.Add(CreateMeshHandler(*pLargeMesh, i));
+				for (uint32 i=0; i<NumOfMeshHandlers; i++)
+					lstMeshHandlers.Add(CreateMeshHandler(*pSmallMesh, i));
+			}
+		}
+		return (pRendererContext != nullptr);
+	}
+
+	// Unoptimized reference implementation, returns the expected position and normal (six floats) per vertex
+	float *ReferenceApply(MeshHandler &cMeshHandler)
+	{
+		// Calculate the current skeleton handler joint states
+		cMeshHandler.GetMeshAnimationManager()->MeshAnimationManager::Apply(cMeshHandler);
+
+		// Set base morph target
+		Mesh		 &cMesh			 = *cMeshHandler.GetMesh();
+		VertexBuffer &cVB			 = *cMesh.GetMorphTarget(0)->GetVertexBuffer();
+		const uint32  nNumOfVertices = cVB.GetNumOfElements();
+		float *pfResult = new float[nNumOfVertices*6];
+		cVB.Lock(Lock::ReadOnly);
+		for (uint32 nVertex=0; nVertex<nNumOfVertices; nVertex++) {
+			const float *pfPosition = static_cast<const float*>(cVB.GetData(nVertex, VertexBuffer::Position));
+			const float *pfNormal   = static_cast<const float*>(cVB.GetData(nVertex, VertexBuffer::Normal));
+			for (uint32 i=0; i<3; i++) {
+				pfResult[nVertex*6 + i]     = pfPosition[i];
+				pfResult[nVertex*6 + 3 + i] = pfNormal[i];
+			}
+		}
+		cVB.Unlock();
+
+		// Add the weighted deltas of the relative morph targets
+		for (uint32 nMorphTarget=1; nMorphTarget<cMesh.GetNumOfMorphTargets(); nMorphTarget++) {
+			MeshMorphTarget &cMorphTarget = *cMesh.GetMorphTarget(nMorphTarget);
+			VertexBuffer    &cVBMT		  = *cMorphTarget.GetVertexBuffer();
+			const float      fWeight	  = cMeshHandler.GetMorphTargetWeights()[nMorphTarget];
+			cVBMT.Lock(Lock::ReadOnly);
+			for (uint32 nDelta=0; nDelta<cVBMT.GetNumOfElements(); nDelta++) {
+				const uint32 nVertex = cMorphTarget.GetVertexIDs().GetNumOfElements() ? cMorphTarget.GetVertexIDs()[nDelta] : nDelta;
+				const float *pfDelta = static_cast<const float*>(cVBMT.GetData(nDelta, VertexBuffer::Position));
+				for (uint32 i=0; i<3; i++)
+					pfResult[nVertex*6 + i] += pfDelta[i]*fWeight;
+			}
+			cVBMT.Unlock();
+		}
+
+		// Skin the vertices, vertices without weights are kept as they are
+		const Array<Weight>		   &lstWeights		 = cMesh.GetWeights();
+		const Array<VertexWeights> &lstVertexWeights = cMesh.GetVertexWeights();
+		const Array<JointHandler>  &lstJointHandlers = cMeshHandler.GetSkeletonHandler()->GetJointHandlers();
+		for (uint32 nVertex=0; nVertex<nNumOfVertices; nVertex++) {
+			const Array<uint32> &lstVWeights = lstVertexWeights[nVertex].GetWeights();
+			if (lstVWeights.GetNumOfElements()) {
+				const Vector3 vPosition(&pfResult[nVertex*6]);
+				const Vector3 vNormal(&pfResult[nVertex*6 + 3]);
+				Vector3 vPositionT = Vector3::Zero;
+				Vector3 vNormalT   = Vector3::Zero;
+				for (uint32 nWeight=0; nWeight<lstVWeights.GetNumOfElements(); nWeight++) {
+					const Weight       &cWeight = lstWeights[lstVWeights[nWeight]];
+					const JointHandler &cJH     = lstJointHandlers[cWeight.GetJoint()];
+					vPositionT += ((cJH.GetMatrixTransform()*vPosition)+cJH.GetTranslationJointSpace())*cWeight.GetBias();
+					vNormalT   += (cJH.GetMatrixTransform()*vNormal)*cWeight.GetBias();
+				}
+				for (uint32 i=0; i<3; i++) {
+					pfResult[nVertex*6 + i]     = vPositionT[i];
+					pfResult[nVertex*6 + 3 + i] = vNormalT[i];
+				}
+			}
+		}
+
+		// Done
+		return pfResult;
+	}
+
+	// Overwrites the vertex buffer of the given mesh handler so that results of a previous apply can't be mistaken for the current ones
+	void ClearVertexBuffer(MeshHandler &cMeshHandler)
+	{
+		VertexBuffer &cVBT = *cMeshHandler.GetVertexBuffer();
+		if (cVBT.Lock(Lock::WriteOnly)) {
+			for (uint32 nVertex=0; nVertex<cVBT.GetNumOfElements(); nVertex++) {
+				float *pfPosition = static_cast<float*>(cVBT.GetData(nVertex, VertexBuffer::Position));
+				float *pfNormal   = static_cast<float*>(cVBT.GetData(nVertex, VertexBuffer::Normal));
+				for (uint32 i=0; i<3; i++) {
+					pfPosition[i] = 1000.0f;
+					pfNormal[i]   = 1000.0f;
+				}
+			}
+			cVBT.Unlock();
+		}
+	}
+
+	// Returns the number of vertices of the given mesh handler differing from the reference implementation
+	uint32 CheckVertexBuffer(MeshHandler &cMeshHandler)
+	{
+		float *pfExpected = ReferenceApply(cMeshHandler);
+		VertexBuffer &cVBT = *cMeshHandler.GetVertexBuffer();
+		uint32 nNumOfErrors = 0;
+		cVBT.Lock(Lock::ReadOnly);
+		for (uint32 nVertex=0; nVertex<cVBT.GetNumOfElements(); nVertex++) {
+			const float *pfPosition = static_cast<const float*>(cVBT.GetData(nVertex, VertexBuffer::Position));
+			const float *pfNormal   = static_cast<const float*>(cVBT.GetData(nVertex, VertexBuffer::Normal));
+			for (uint32 i=0; i<3; i++) {
+				if (!Math::AreEqual(pfPosition[i], pfExpected[nVertex*6 + i], Epsilon) || !Math::AreEqual(pfNormal[i], pfExpected[nVertex*6 + 3 + i], Epsilon)) {
+					nNumOfErrors++;
+					break;
+				}
+			}
+		}
+		cVBT.Unlock();
+		delete [] pfExpected;
+		return nNumOfErrors;
+	}
+
+	// Applies all mesh handlers one after another using the given number of worker threads, returns the number of mesh handlers differing from the reference implementation
+	uint32 CheckApply(uint32 nNumOfWorkers)
+	{
+		JobSystem *pJobSystem = JobSystem::GetInstance();
+		const uint32 nPreviousNumOfWorkers = pJobSystem->GetNumOfWorkers();
+		pJobSystem->SetNumOfWorkers(nNumOfWorkers);
+		uint32 nNumOfErrors = 0;
+		for (uint32 i=0; i<lstMeshHandlers.GetNumOfElements(); i++) {
+			MeshHandler &cMeshHandler = *lstMeshHandlers[i];
+			ClearVertexBuffer(cMeshHandler);
+			if (!cMeshHandler.GetMeshAnimationManager()->Apply(cMeshHandler) || CheckVertexBuffer(cMeshHandler))
+				nNumOfErrors++;
+		}
+		pJobSystem->SetNumOfWorkers(nPreviousNumOfWorkers);
+		return nNumOfErrors;
+	}
+
+	TEST(Apply_0_Workers){
+		if (Initialize())
+			CHECK_EQUAL(0U, CheckApply(0));
+	}
+
+	TEST(Apply_Workers){
+		// At least one worker thread, else the threaded path is not used
+		if (Initialize())
+			CHECK_EQUAL(0U, CheckApply(Math::Max(System::GetInstance()->GetNumOfCPUs(), 2U) - 1));
+	}
+
+	TEST(ApplyMultiple_Workers){
+		if (Initialize()) {
+			JobSystem *pJobSystem = JobSystem::GetInstance();
+			const uint32 nPreviousNumOfWorkers = pJobSystem->GetNumOfWorkers();
+			pJobSystem->SetNumOfWorkers(Math::Max(System::GetInstance()->GetNumOfCPUs(), 2U) - 1);
+			for (uint32 i=0; i<lstMeshHandlers.GetNumOfElements(); i++)
+				ClearVertexBuffer(*lstMeshHandlers[i]);
+			CHECK_EQUAL(lstMeshHandlers.GetNumOfElements(), MeshAnimationManagerSoftware::ApplyMultiple(lstMeshHandlers));
+			for (uint32 i=0; i<lstMeshHandlers.GetNumOfElements(); i++)
+				CHECK_EQUAL(0U, CheckVertexBuffer(*lstMeshHandlers[i]));
+			pJobSystem->SetNumOfWorkers(nPreviousNumOfWorkers);
+		}
+	}
+}
+
+/*
+* Naming Convention for SUITE:
+* CLASSNAME
+*/
+SUITE(MeshAnimationManagerSoftware_Performance) {
+	/*
+	* Naming Convention for METHOD:
+	* METHODNAME_SCENARIO
+	*/
+	// general objects for testing
+	const uint32 NumOfJoints            = 64;		// number of skeleton joints
+	const uint32 NumOfWeightsPerVertex  = 4;		// number of joint weights per vertex
+	const uint32 NumOfLargeMeshVertices = 100000;	// number of vertices of the large mesh
+	const uint32 NumOfCrowdMeshVertices = 2000;		// number of vertices of a crowd mesh
+	const uint32 NumOfCrowdMeshHandlers = 256;		// number of crowd mesh handlers
+	const uint32 TestLoops              = 20;		// number of iterations
+	RendererContext	   *pRendererContext  = nullptr;
+	MeshManager		   *pMeshManager	  = nullptr;
+	MeshHandler		   *pLargeMeshHandler = nullptr;	// mesh handler of the large mesh
+	Array<MeshHandler*>	lstCrowdMeshHandlers;			// mesh handlers sharing the same crowd mesh
+	bool				bInitialized	  = false;
+
+	// Creates a skinned mesh with a position and a normal per vertex, each vertex is influenced by some of the joints
+	Mesh *CreateSkinnedMesh(uint32 nNumOfVertices)
+	{
+		Mesh *pMesh = pMeshManager->CreateMesh();
+
+		// Fill the vertex buffer
+		VertexBuffer *pVertexBuffer = pMesh->GetMorphTarget(0)->GetVertexBuffer();
+		pVertexBuffer->AddVertexAttribute(VertexBuffer::Position, 0, VertexBuffer::Float3);
+		pVertexBuffer->AddVertexAttribute(VertexBuffer::Normal,   0, VertexBuffer::Float3);
+		pVertexBuffer->Allocate(nNumOfVertices, Usage::Dynamic);
+		if (pVertexBuffer->Lock(Lock::WriteOnly)) {
+			for (uint32 i=0; i<nNumOfVertices; i++) {
+				float *pfPosition = static_cast<float*>(pVertexBuffer->GetData(i, VertexBuffer::Position));
+				pfPosition[0] = static_cast<float>(i%100);
+				pfPosition[1] = static_cast<float>(i/100%100);
+				pfPosition[2] = static_cast<float>(i/10000);
+				float *pfNormal = static_cast<float*>(pVertexBuffer->GetData(i, VertexBuffer::Normal));
+				pfNormal[0] = 0.0f;
+				pfNormal[1] = 1.0f;
+				pfNormal[2] = 0.0f;
+			}
+			pVertexBuffer->Unlock();
+		}
+
+		// Create a simple joint chain
+		Skeleton *pSkeleton = pMesh->GetSkeletonManager().Create("Skeleton");
+		pSkeleton->GetJoints().Resize(NumOfJoints);
+		for (uint32 i=0; i<NumOfJoints; i++) {
+			Joint *pJoint = pSkeleton->Create(String("Joint") + i);
+			pJoint->SetID(i);
+			pJoint->SetParent(static_cast<int>(i) - 1);
+			pJoint->SetTranslation(Vector3(0.0f, 1.0f, 0.0f));
+			pJoint->SetRotation(Quaternion(Vector3::UnitZ, static_cast<float>(i)*0.01f));
+		}
+		pSkeleton->UpdateJointInformation();
+		SkeletonHandler *pSkeletonHandler = new SkeletonHandler();
+		pSkeletonHandler->SetResource(pSkeleton);
+		pMesh->GetSkeletonHandlers().Add(pSkeletonHandler);
+
+		// Add the joint weights
+		Array<Weight>        &lstWeights       = pMesh->GetWeights();
+		Array<VertexWeights> &lstVertexWeights = pMesh->GetVertexWeights();
+		lstVertexWeights.Resize(nNumOfVertices);
+		for (uint32 i=0; i<nNumOfVertices; i++) {
+			for (uint32 nWeight=0; nWeight<NumOfWeightsPerVertex; nWeight++) {
+				lstVertexWeights[i].GetWeights().Add(lstWeights.GetNumOfElements());
+				Weight &cWeight = lstWeights.Add();
+				cWeight.SetJoint((i + nWeight*7)%NumOfJoints);
+				cWeight.SetBias(1.0f/NumOfWeightsPerVertex);
+			}
+		}
+
+		// Done
+		return pMesh;
+	}
+
+	// Creates a mesh handler with a software mesh animation manager using the given mesh, after this the mesh handler owns a vertex buffer
+	MeshHandler *CreateMeshHandler(Mesh &cMesh)
+	{
+		MeshHandler *pMeshHandler = new MeshHandler();
+		pMeshHandler->SetMesh(&cMesh);
+		pMeshHandler->CreateMeshAnimationManager("PLMesh::MeshAnimationManagerSoftware");
+		pMeshHandler->MeshUpdateRequired();
+		pMeshHandler->Update(0.0f);
+		return pMeshHandler;
+	}
+
+	// Creates the renderer and the meshes, returns 'false' if the null renderer is not available
+	bool Initialize()
+	{
+		if (!bInitialized) {
+			bInitialized = true;
+
+			// Create the null renderer
+			Runtime::ScanDirectoryPlugins();
+			pRendererContext = RendererContext::CreateInstance("PLRendererNull::Renderer", NULL_HANDLE);
+			if (pRendererContext) {
+				pMeshManager = new MeshManager(pRendererContext->GetRenderer());
+
+				// Create the meshes
+				pLargeMeshHandler = CreateMeshHandler(*CreateSkinnedMesh(NumOfLargeMeshVertices));
+				Mesh *pCrowdMesh = CreateSkinnedMesh(NumOfCrowdMeshVertices);
+				for (uint32 i=0; i<NumOfCrowdMeshHandlers; i++)
+					lstCrowdMeshHandlers.Add(CreateMeshHandler(*pCrowdMesh));
+			} else {
+				outputFile << "MeshAnimationManagerSoftware_Performance: The renderer \"PLRendererNull::Renderer\" is not available, skipping the tests" << endl;
+			}
+		}
+		return (pRendererContext != nullptr);
+	}
+
+	// Reference implementation of the previous skinning, walks through all weights of a vertex for every vertex attribute
+	void ReferenceApply(MeshHandler &cMeshHandler)
+	{
+		// Calculate the current skeleton handler joint states
+		const MeshAnimationManager &cManager = *cMeshHandler.GetMeshAnimationManager();
+		cManager.MeshAnimationManager::Apply(cMeshHandler);
+
+		// Lock the vertex buffers
+		Mesh         &cMesh = *cMeshHandler.GetMesh();
+		VertexBuffer &cVB   = *cMesh.GetMorphTarget(0)->GetVertexBuffer();
+		VertexBuffer &cVBT  = *cMeshHandler.GetVertexBuffer();
+		cVB. Lock(Lock::ReadOnly);
+		cVBT.Lock(Lock::ReadWrite);
+
+		// Skin the vertices
+		const Array<Weight>		   &lstWeights		 = cMesh.GetWeights();
+		const Array<VertexWeights> &lstVertexWeights = cMesh.GetVertexWeights();
+		const Array<JointHandler>  &lstJointHandlers = cMeshHandler.GetSkeletonHandler()->GetJointHandlers();
+		for (uint32 nVertex=0; nVertex<cVBT.GetNumOfElements(); nVertex++) {
+			const Array<uint32> &lstVWeights = lstVertexWeights[nVertex].GetWeights();
+
+			// Position
+			const float *pfPosition  = static_cast<const float*>(cVB.GetData(nVertex, VertexBuffer::Position));
+			float		*pfPositionT = static_cast<float*>(cVBT.GetData(nVertex, VertexBuffer::Position));
+			const Vector3 vPosition(pfPosition);
+			Vector3 vV = Vector3::Zero;
+			for (uint32 nWeight=0; nWeight<lstVWeights.GetNumOfElements(); nWeight++) {
+				const Weight       &cWeight = lstWeights[lstVWeights[nWeight]];
+				const JointHandler &cJH     = lstJointHandlers[cWeight.GetJoint()];
+				vV += ((cJH.GetMatrixTransform()*vPosition)+cJH.GetTranslationJointSpace())*cWeight.GetBias();
+			}
+			pfPositionT[Vector3::X] = vV.x;
+			pfPositionT[Vector3::Y] = vV.y;
+			pfPositionT[Vector3::Z] = vV.z;
+
+			// Normal
+			const float *pfNormal  = static_cast<const float*>(cVB.GetData(nVertex, VertexBuffer::Normal));
+			float		*pfNormalT = static_cast<float*>(cVBT.GetData(nVertex, VertexBuffer::Normal));
+			const Vector3 vNormal(pfNormal);
+			vV = Vector3::Zero;
+			for (uint32 nWeight=0; nWeight<lstVWeights.GetNumOfElements(); nWeight++) {
+				const Weight       &cWeight = lstWeights[lstVWeights[nWeight]];
+				const JointHandler &cJH     = lstJointHandlers[cWeight.GetJoint()];
+				vV += (cJH.GetMatrixTransform()*vNormal)*cWeight.GetBias();
+			}
+			pfNormalT[Vector3::X] = vV.x;
+			pfNormalT[Vector3::Y] = vV.y;
+			pfNormalT[Vector3::Z] = vV.z;
+		}
+
+		// Unlock the vertex buffers
+		cVB. Unlock();
+		cVBT.Unlock();
+	}
+
+	// Applies the large mesh using the given number of worker threads
+	void ApplyLargeMesh(uint32 nNumOfWorkers)
+	{
+		if (Initialize()) {
+			JobSystem::GetInstance()->SetNumOfWorkers(nNumOfWorkers);
+			for (uint32 nLoop=0; nLoop<TestLoops; nLoop++)
+				pLargeMeshHandler->GetMeshAnimationManager()->Apply(*pLargeMeshHandler);
+		}
+	}
+
+	TEST(Reference_Apply_LargeMesh){
+		if (Initialize()) {
+			for (uint32 nLoop=0; nLoop<TestLoops; nLoop++)
+				ReferenceApply(*pLargeMeshHandler);
+		}
+	}
+
+	TEST(PL_Apply_LargeMesh_0_Workers){
+		ApplyLargeMesh(0);
+	}
+
+	TEST(PL_Apply_LargeMesh_CPU_Workers){
+		ApplyLargeMesh(System::GetInstance()->GetNumOfCPUs() - 1);
+	}
+
+	TEST(Reference_Apply_Crowd){
+		if (Initialize()) {
+			for (uint32 nLoop=0; nLoop<TestLoops; nLoop++) {
+				for (uint32 i=0; i<NumOfCrowdMeshHandlers; i++)
+					ReferenceApply(*lstCrowdMeshHandlers[i]);
+			}
+		}
+	}
+
+	TEST(PL_Apply_Crowd){
+		if (Initialize()) {
+			JobSystem::GetInstance()->SetNumOfWorkers(System::GetInstance()->GetNumOfCPUs() - 1);
+			for (uint32 nLoop=0; nLoop<TestLoops; nLoop++) {
+				for (uint32 i=0; i<NumOfCrowdMeshHandlers; i++)
+					lstCrowdMeshHandlers[i]->GetMeshAnimationManager()->Apply(*lstCrowdMeshHandlers[i]);
+			}
+		}
+	}
+
+	TEST(PL_ApplyMultiple_Crowd_CPU_Workers){
+		if (Initialize()) {
+			JobSystem::GetInstance()->SetNumOfWorkers(System::GetInstance()->GetNumOfCPUs() - 1);
+			for (uint32 nLoop=0; nLoop<TestLoops; nLoop++)
+				MeshAnimationManagerSoftware::ApplyMultiple(lstCrowdMeshHandlers);
+		}
+	}
+}
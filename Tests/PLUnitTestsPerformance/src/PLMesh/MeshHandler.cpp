@@ -0,0 +1,365 @@
+/*********************************************************\
+ *  File: MeshHandler.cpp                                *
+ *
+ *  Copyright (C) 2002-2013 The PixelLight Team (http://www.pixellight.org/)
+ *
+ *  This file is part of PixelLight.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ *  and associated documentation files (the "Software"), to deal in the Software without
+ *  restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ *  Software is furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all copies or
+ *  substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ *  BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ *  DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ *  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include <UnitTest++/UnitTest++.h>
+#include <PLCore/Runtime.h>
+#include <PLMath/Math.h>
+#include <PLMath/Intersect.h>
+#include <PLRenderer/RendererContext.h>
+#include <PLRenderer/Renderer/IndexBuffer.h>
+#include <PLRenderer/Renderer/VertexBuffer.h>
+#include <PLMesh/Mesh.h>
+#include <PLMesh/Geometry.h>
+#include <PLMesh/MeshHandler.h>
+#include <PLMesh/MeshManager.h>
+#include <PLMesh/MeshLODLevel.h>
+#include <PLMesh/MeshMorphTarget.h>
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+using namespace std;
+using namespace PLCore;
+using namespace PLMath;
+using namespace PLRenderer;
+using namespace PLMesh;
+
+
+//[-------------------------------------------------------]
+//[ Global variables                                      ]
+//[-------------------------------------------------------]
+extern ofstream outputFile;
+
+
+/*
+* Naming Convention for SUITE:
+* CLASSNAME
+*/
+SUITE(MeshHandler_Performance) {
+	/*
+	* Naming Convention for METHOD:
+	* METHODNAME_SCENARIO
+	*/
+	// general objects for testing
+	const uint32 NumOfRays  = 100000;	// number of rays per iteration
+	const uint32 TestLoops  = 5;		// number of iterations
+	const uint32 BuildLoops = 10;		// number of triangle bounding volume hierarchy builds
+	RendererContext *pRendererContext = nullptr;
+	MeshManager		*pMeshManager	  = nullptr;
+	Mesh			*pMesh			  = nullptr;	// sphere mesh with about 160000 triangles and a radius of 0.5
+	MeshHandler		*pMeshHandler	  = nullptr;
+	Array<Vector3>	 lstRays;						// line start and end positions
+	bool			 bInitialized	  = false;
+
+	// Creates the renderer, the mesh and the rays, returns 'false' if the null renderer is not available
+	bool Initialize()
+	{
+		if (!bInitialized) {
+			bInitialized = true;
+
+			// Create the null renderer
+			Runtime::ScanDirectoryPlugins();
+			pRendererContext = RendererContext::CreateInstance("PLRendererNull::Renderer", NULL_HANDLE);
+			if (pRendererContext) {
+				pMeshManager = new MeshManager(pRendererContext->GetRenderer());
+				pMesh = pMeshManager->CreateMesh("PLMesh::MeshCreatorSphere", true, "Detail=\"400\"");
+				pMeshHandler = new MeshHandler();
+				pMeshHandler->SetMesh(pMesh);
+
+				// Rays from random positions around the sphere towards random positions near the center, use always the same rays
+				srand(0);
+				for (uint32 i=0; i<NumOfRays; i++) {
+					Vector3 vStart(Math::GetRandNegFloat(), Math::GetRandNegFloat(), Math::GetRandNegFloat());
+					vStart.SetLength(2.0f);
+					lstRays.Add(vStart);
+					lstRays.Add(Vector3(Math::GetRandNegFloat()*0.2f, Math::GetRandNegFloat()*0.2f, Math::GetRandNegFloat()*0.2f));
+				}
+			} else {
+				outputFile << "MeshHandler_Performance: The renderer \"PLRendererNull::Renderer\" is not available, skipping the tests" << endl;
+			}
+		}
+		return (pRendererContext != nullptr && pMesh != nullptr);
+	}
+
+	TEST(FindTriangle_BuildBVH){
+		if (Initialize()) {
+			// The first query builds the triangle bounding volume hierarchy of the LOD level
+			for (uint32 nLoop=0; nLoop<BuildLoops; nLoop++) {
+				pMesh->GetLODLevel(0)->DestroyBVH();
+				uint32 nTriangle;
+				pMeshHandler->FindTriangle(lstRays[0], lstRays[1], nTriangle);
+			}
+		}
+	}
+
+	TEST(FindTriangle_Rays){
+		if (Initialize()) {
+			for (uint32 nLoop=0; nLoop<TestLoops; nLoop++) {
+				for (uint32 i=0; i<NumOfRays; i++) {
+					uint32 nTriangle;
+					pMeshHandler->FindTriangle(lstRays[i*2], lstRays[i*2 + 1], nTriangle);
+				}
+			}
+		}
+	}
+}
+
+/*
+* Naming Convention for SUITE:
+* CLASSNAME
+*/
+SUITE(MeshHandler) {
+	/*
+	* Naming Convention for METHOD:
+	* METHODNAME_SCENARIO
+	*/
+	// general objects for testing
+	const uint32 NumOfVertices = 600;	// number of mesh vertices
+	const uint32 NumOfRays     = 2000;	// number of rays per check
+	RendererContext *pRendererContext	  = nullptr;
+	MeshManager		*pMeshManager		  = nullptr;
+	Mesh			*pMesh				  = nullptr;	// random triangles within several geometries and a relative morph target
+	MeshHandler		*pMeshHandler		  = nullptr;	// mesh handler using the bounding volume hierarchy of the mesh LOD level
+	MeshHandler		*pAnimatedMeshHandler = nullptr;	// mesh handler with an own vertex buffer and therefore an own bounding volume hierarchy
+	bool			 bInitialized		  = false;
+
+	// Returns a random position within [-fSize, fSize]
+	Vector3 GetRandomPosition(float fSize)
+	{
+		return Vector3(Math::GetRandNegFloat()*fSize, Math::GetRandNegFloat()*fSize, Math::GetRandNegFloat()*fSize);
+	}
+
+	// Creates the renderer and the mesh, returns 'false' if the null renderer is not available
+	bool Initialize()
+	{
+		if (!bInitialized) {
+			bInitialized = true;
+
+			// Create the null renderer
+			Runtime::ScanDirectoryPlugins();
+			pRendererContext = RendererContext::CreateInstance("PLRendererNull::Renderer", NULL_HANDLE);
+			if (pRendererContext) {
+				pMeshManager = new MeshManager(pRendererContext->GetRenderer());
+				pMesh = pMeshManager->CreateMesh();
+				srand(1);
+
+				// Random vertex positions
+				VertexBuffer *pVertexBuffer = pMesh->GetMorphTarget(0)->GetVertexBuffer();
+				pVertexBuffer->AddVertexAttribute(VertexBuffer::Position, 0, VertexBuffer::Float3);
+				pVertexBuffer->Allocate(NumOfVertices, Usage::Dynamic);
+				if (pVertexBuffer->Lock(Lock::WriteOnly)) {
+					for (uint32 i=0; i<NumOfVertices; i++) {
+						const Vector3 vPosition = GetRandomPosition(1.0f);
+						float *pfPosition = static_cast<float*>(pVertexBuffer->GetData(i, VertexBuffer::Position));
+						pfPosition[Vector3::X] = vPosition.x;
+						pfPosition[Vector3::Y] = vPosition.y;
+						pfPosition[Vector3::Z] = vPosition.z;
+					}
+					pVertexBuffer->Unlock();
+				}
+
+				// Relative morph target moving each vertex, used as animation
+				MeshMorphTarget *pMorphTarget = pMesh->AddMorphTarget();
+				pMorphTarget->SetRelative(true);
+				pVertexBuffer = pMorphTarget->GetVertexBuffer();
+				pVertexBuffer->AddVertexAttribute(VertexBuffer::Position, 0, VertexBuffer::Float3);
+				pVertexBuffer->Allocate(NumOfVertices, Usage::Dynamic);
+				if (pVertexBuffer->Lock(Lock::WriteOnly)) {
+					for (uint32 i=0; i<NumOfVertices; i++) {
+						const Vector3 vDelta = GetRandomPosition(0.5f);
+						float *pfPosition = static_cast<float*>(pVertexBuffer->GetData(i, VertexBuffer::Position));
+						pfPosition[Vector3::X] = vDelta.x;
+						pfPosition[Vector3::Y] = vDelta.y;
+						pfPosition[Vector3::Z] = vDelta.z;
+					}
+					pVertexBuffer->Unlock();
+				}
+
+				// Geometries using all primitive types providing triangles, the last one is inactive
+				static const Primitive::Enum nPrimitiveType[] = { Primitive::TriangleList, Primitive::TriangleStrip, Primitive::TriangleFan, Primitive::TriangleList, Primitive::TriangleList };
+				static const uint32			 nIndexSize[]	  = { 300, 150, 60, 240, 150 };
+				const uint32 nNumOfGeometries = sizeof(nIndexSize)/sizeof(uint32);
+				uint32 nNumOfIndices = 0;
+				for (uint32 i=0; i<nNumOfGeometries; i++)
+					nNumOfIndices += nIndexSize[i];
+				MeshLODLevel *pLODLevel = pMesh->GetLODLevel(0);
+				IndexBuffer *pIndexBuffer = pLODLevel->GetIndexBuffer();
+				pIndexBuffer->SetElementTypeByMaximumIndex(NumOfVertices - 1);
+				pIndexBuffer->Allocate(nNumOfIndices, Usage::Static);
+				if (pIndexBuffer->Lock(Lock::WriteOnly)) {
+					for (uint32 i=0; i<nNumOfIndices; i++)
+						pIndexBuffer->SetData(i, rand()%NumOfVertices);
+					pIndexBuffer->Unlock();
+				}
+				Array<Geometry> &lstGeometries = *pLODLevel->GetGeometries();
+				uint32 nStartIndex = 0;
+				for (uint32 i=0; i<nNumOfGeometries; i++) {
+					Geometry &cGeometry = lstGeometries.Add();
+					cGeometry.SetPrimitiveType(nPrimitiveType[i]);
+					cGeometry.SetStartIndex(nStartIndex);
+					cGeometry.SetIndexSize(nIndexSize[i]);
+					nStartIndex += nIndexSize[i];
+				}
+				lstGeometries[nNumOfGeometries - 1].SetActive(false);
+
+				// Create the mesh handlers, the animated one gets an own vertex buffer
+				pMeshHandler = new MeshHandler();
+				pMeshHandler->SetMesh(pMesh);
+				pAnimatedMeshHandler = new MeshHandler();
+				pAnimatedMeshHandler->SetMesh(pMesh);
+				pAnimatedMeshHandler->CreateMeshAnimationManager("PLMesh::MeshAnimationManagerSoftware");
+				pAnimatedMeshHandler->MeshUpdateRequired();
+				pAnimatedMeshHandler->Update(0.0f);
+			} else {
+				outputFile << "MeshHandler: The renderer \"PLRendererNull::Renderer\" is not available, skipping the tests" << endl;
+			}
+		}
+		return (pRendererContext != nullptr && pMesh != nullptr);
+	}
+
+	// Reference implementation of the previous brute force search testing each and every triangle
+	bool ReferenceFindTriangle(const MeshHandler &cMeshHandler, const Vector3 &vLineStartPos, const Vector3 &vLineEndPos,
+							   uint32 &nTriangle, uint32 &nGeometry, Vector3 &vCollisionPoint, const Array<uint32> *plstGeometries, Cull::Enum nCull)
+	{
+		const MeshLODLevel	  &cLODLevel	 = *cMeshHandler.GetLODLevel();
+		const Array<Geometry> &lstGeometries = *cLODLevel.GetGeometries();
+		VertexBuffer		  &cVertexBuffer = *cMeshHandler.GetVertexBuffer();
+		const Vector3 vDirection = vLineEndPos - vLineStartPos;
+		const Vector3 vNormalizedDirection = Vector3(vDirection).Normalize();
+		float fSquaredDistance = -1.0f;
+		cVertexBuffer.Lock(Lock::ReadOnly);
+		for (uint32 nGeo=0; nGeo<lstGeometries.GetNumOfElements(); nGeo++) {
+			if (lstGeometries[nGeo].IsActive() && (!plstGeometries || plstGeometries->IsElement(nGeo))) {
+				for (uint32 nTri=0; nTri<lstGeometries[nGeo].GetNumOfTriangles(); nTri++) {
+					uint32 nVertex1, nVertex2, nVertex3;
+					cLODLevel.GetTriangle(nGeo, nTri, nVertex1, nVertex2, nVertex3);
+					const Vector3 vV1(static_cast<const float*>(cVertexBuffer.GetData(nVertex1, VertexBuffer::Position)));
+					const Vector3 vV2(static_cast<const float*>(cVertexBuffer.GetData(nVertex2, VertexBuffer::Position)));
+					const Vector3 vV3(static_cast<const float*>(cVertexBuffer.GetData(nVertex3, VertexBuffer::Position)));
+					Vector3 vN;
+					vN.GetFaceNormal(vV1, vV2, vV3);
+
+					// Perform culling?
+					const float fDotProduct = vN.DotProduct(vNormalizedDirection);
+					if ((nCull == Cull::CW && fDotProduct < 0.0f) || (nCull == Cull::CCW && fDotProduct > 0.0f))
+						continue;
+
+					// Check triangle intersection
+					Vector3 vIntersectionPointPos;
+					if (Intersect::TriangleRay(vV1, vV2, vV3, vN, vLineStartPos, vDirection, vIntersectionPointPos)) {
+						const float fCurrentSquaredDistance = (vIntersectionPointPos - vLineStartPos).GetSquaredLength();
+						if (fSquaredDistance < 0.0f || fCurrentSquaredDistance < fSquaredDistance) {
+							fSquaredDistance = fCurrentSquaredDistance;
+							nTriangle		 = nTri;
+							nGeometry		 = nGeo;
+							vCollisionPoint	 = vIntersectionPointPos;
+						}
+					}
+				}
+			}
+		}
+		cVertexBuffer.Unlock();
+		return (fSquaredDistance >= 0.0f);
+	}
+
+	// Compares the results of the bounding volume hierarchy with the ones of the brute force search, returns the number of rays hitting a triangle
+	uint32 CheckFindTriangle(const MeshHandler &cMeshHandler, const Array<uint32> *plstGeometries, Cull::Enum nCull)
+	{
+		uint32 nNumOfHits = 0;
+		srand(2);
+		for (uint32 i=0; i<NumOfRays; i++) {
+			// Rays from random positions around the mesh towards random positions near the center
+			Vector3 vLineStartPos = GetRandomPosition(1.0f);
+			vLineStartPos.SetLength(3.0f);
+			const Vector3 vLineEndPos = GetRandomPosition(0.5f);
+
+			// Compare the results
+			uint32 nTriangle = 0, nGeometry = 0, nReferenceTriangle = 0, nReferenceGeometry = 0;
+			Vector3 vCollisionPoint, vReferenceCollisionPoint;
+			const bool bFound		   = cMeshHandler.FindTriangle(vLineStartPos, vLineEndPos, nTriangle, &nGeometry, &vCollisionPoint, const_cast<Array<uint32>*>(plstGeometries), nCull);
+			const bool bReferenceFound = ReferenceFindTriangle(cMeshHandler, vLineStartPos, vLineEndPos, nReferenceTriangle, nReferenceGeometry, vReferenceCollisionPoint, plstGeometries, nCull);
+			CHECK_EQUAL(bReferenceFound, bFound);
+			if (bFound && bReferenceFound) {
+				nNumOfHits++;
+				CHECK_EQUAL(nReferenceGeometry, nGeometry);
+				CHECK_EQUAL(nReferenceTriangle, nTriangle);
+				CHECK_CLOSE(0.0f, (vReferenceCollisionPoint - vCollisionPoint).GetLength(), 0.001f);
+			}
+		}
+		return nNumOfHits;
+	}
+
+	TEST(FindTriangle_BruteForce){
+		if (Initialize()) {
+			CHECK(CheckFindTriangle(*pMeshHandler, nullptr, Cull::None) > NumOfRays/2);
+		}
+	}
+
+	TEST(FindTriangle_Cull){
+		if (Initialize()) {
+			CHECK(CheckFindTriangle(*pMeshHandler, nullptr, Cull::CW) > 0);
+			CHECK(CheckFindTriangle(*pMeshHandler, nullptr, Cull::CCW) > 0);
+		}
+	}
+
+	TEST(FindTriangle_Geometries){
+		if (Initialize()) {
+			// Some of the geometries, the last one is inactive and therefore ignored as well
+			Array<uint32> lstGeometries;
+			lstGeometries.Add(1);
+			lstGeometries.Add(2);
+			lstGeometries.Add(4);
+			CHECK(CheckFindTriangle(*pMeshHandler, &lstGeometries, Cull::None) > 0);
+			CHECK(CheckFindTriangle(*pMeshHandler, &lstGeometries, Cull::CW) > 0);
+
+			// Only the inactive geometry
+			lstGeometries.Clear();
+			lstGeometries.Add(4);
+			CHECK_EQUAL(0U, CheckFindTriangle(*pMeshHandler, &lstGeometries, Cull::None));
+		}
+	}
+
+	TEST(FindTriangle_Refit){
+		if (Initialize()) {
+			// The mesh handler has an own vertex buffer and therefore an own bounding volume hierarchy
+			CHECK(pAnimatedMeshHandler->GetVertexBuffer() != pMesh->GetMorphTarget(0)->GetVertexBuffer());
+			CHECK(CheckFindTriangle(*pAnimatedMeshHandler, nullptr, Cull::None) > 0);
+
+			// Animate the vertices, the bounding volume hierarchy is refitted
+			for (uint32 nStep=1; nStep<=4; nStep++) {
+				const float fWeight = static_cast<float>(nStep)*0.25f;
+				pAnimatedMeshHandler->GetBaseMorphTargetWeights()[1] = fWeight;
+				pAnimatedMeshHandler->GetMorphTargetWeights()[1] = fWeight;
+				pAnimatedMeshHandler->MeshUpdateRequired();
+				pAnimatedMeshHandler->Update(0.0f);
+				CHECK(CheckFindTriangle(*pAnimatedMeshHandler, nullptr, Cull::None) > 0);
+				CHECK(CheckFindTriangle(*pAnimatedMeshHandler, nullptr, Cull::CCW) > 0);
+			}
+		}
+	}
+}
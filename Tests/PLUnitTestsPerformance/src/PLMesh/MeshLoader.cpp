@@ -0,0 +1,118 @@
+/*********************************************************\
+ *  File: MeshLoader.cpp                                 *
+ *
+ *  Copyright (C) 2002-2013 The PixelLight Team (http://www.pixellight.org/)
+ *
+ *  This file is part of PixelLight.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ *  and associated documentation files (the "Software"), to deal in the Software without
+ *  restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ *  Software is furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all copies or
+ *  substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ *  BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ *  DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ *  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include <UnitTest++/UnitTest++.h>
+#include <PLCore/Runtime.h>
+#include <PLCore/File/File.h>
+#include <PLRenderer/RendererContext.h>
+#include <PLMesh/Mesh.h>
+#include <PLMesh/MeshManager.h>
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+using namespace std;
+using namespace PLCore;
+using namespace PLRenderer;
+using namespace PLMesh;
+
+
+//[-------------------------------------------------------]
+//[ Global variables                                      ]
+//[-------------------------------------------------------]
+extern ofstream outputFile;
+
+
+/*
+* Naming Convention for SUITE:
+* CLASSNAME
+*/
+SUITE(MeshLoader_Performance) {
+	/*
+	* Naming Convention for METHOD:
+	* METHODNAME_SCENARIO
+	*/
+	// general objects for testing
+	const uint32 TestLoops = 10;	// number of iterations
+	const String BinaryFilename = "PLUnitTestsPerformance_MeshLoader.mesh";
+	const String XmlFilename    = "PLUnitTestsPerformance_MeshLoader.xmesh";
+	const String MappedFilename = "PLUnitTestsPerformance_MeshLoader.mmesh";
+	RendererContext *pRendererContext = nullptr;
+	MeshManager		*pMeshManager	  = nullptr;
+	Mesh			*pMesh			  = nullptr;	// mesh the files are loaded into
+	bool			 bInitialized	  = false;
+
+	// Creates the renderer and writes the mesh files, returns 'false' if the null renderer is not available
+	bool Initialize()
+	{
+		if (!bInitialized) {
+			bInitialized = true;
+
+			// Create the null renderer
+			Runtime::ScanDirectoryPlugins();
+			pRendererContext = RendererContext::CreateInstance("PLRendererNull::Renderer", NULL_HANDLE);
+			if (pRendererContext) {
+				pMeshManager = new MeshManager(pRendererContext->GetRenderer());
+
+				// Create a sphere with about 80000 vertices and save it using all PixelLight mesh formats
+				Mesh *pSphereMesh = pMeshManager->CreateMesh("PLMesh::MeshCreatorSphere", true, "Detail=\"400\"");
+				if (pSphereMesh) {
+					pSphereMesh->SaveByFilename(BinaryFilename);
+					pSphereMesh->SaveByFilename(XmlFilename);
+					pSphereMesh->SaveByFilename(MappedFilename);
+				}
+				pMesh = pMeshManager->CreateMesh();
+			} else {
+				outputFile << "MeshLoader_Performance: The renderer \"PLRendererNull::Renderer\" is not available, skipping the tests" << endl;
+			}
+		}
+		return (pRendererContext != nullptr);
+	}
+
+	// Loads the given mesh file multiple times and removes it afterwards
+	void Load(const String &sFilename)
+	{
+		if (Initialize()) {
+			for (uint32 nLoop=0; nLoop<TestLoops; nLoop++)
+				pMesh->LoadByFilename(sFilename);
+			File(sFilename).Delete();
+		}
+	}
+
+	TEST(MeshLoaderPL_Load){
+		Load(BinaryFilename);
+	}
+
+	TEST(MeshLoaderPLXml_Load){
+		Load(XmlFilename);
+	}
+
+	TEST(MeshLoaderPLMapped_Load){
+		Load(MappedFilename);
+	}
+}
@@ -0,0 +1,472 @@
+/*********************************************************\
+ *  File: MeshLoaderPLMapped.cpp                         *
+ *
+ *  Copyright (C) 2002-2013 The PixelLight Team (http://www.pixellight.org/)
+ *
+ *  This file is part of PixelLight.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ *  and associated documentation files (the "Software"), to deal in the Software without
+ *  restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ *  Software is furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all copies or
+ *  substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ *  BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ *  DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ *  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include <string.h>
+#include <UnitTest++/UnitTest++.h>
+#include <PLCore/Runtime.h>
+#include <PLCore/File/File.h>
+#include <PLRenderer/RendererContext.h>
+#include <PLRenderer/Renderer/IndexBuffer.h>
+#include <PLRenderer/Renderer/VertexBuffer.h>
+#include <PLMesh/Joint.h>
+#include <PLMesh/Weight.h>
+#include <PLMesh/Geometry.h>
+#include <PLMesh/Skeleton.h>
+#include <PLMesh/MeshManager.h>
+#include <PLMesh/MeshLODLevel.h>
+#include <PLMesh/VertexWeights.h>
+#include <PLMesh/MeshMorphTarget.h>
+#include <PLMesh/SkeletonHandler.h>
+#include <PLMesh/SkeletonManager.h>
+#include <PLMesh/Loader/MeshFileMapped.h>
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+using namespace std;
+using namespace PLCore;
+using namespace PLMath;
+using namespace PLRenderer;
+using namespace PLMesh;
+
+
+//[-------------------------------------------------------]
+//[ Global variables                                      ]
+//[-------------------------------------------------------]
+extern ofstream outputFile;
+
+
+/*
+* Naming Convention for SUITE:
+* CLASSNAME
+*/
+SUITE(MeshLoaderPLMapped) {
+	/*
+	* Naming Convention for METHOD:
+	* METHODNAME_SCENARIO
+	*/
+	// general objects for testing
+	const uint32 NumOfJoints	 = 3;	// number of skeleton joints
+	const uint32 NumOfFrames	 = 4;	// number of skeleton animation frames
+	const String BinaryFilename	 = "PLUnitTestsPerformance_MeshLoaderPLMapped.mesh";
+	const String MappedFilename	 = "PLUnitTestsPerformance_MeshLoaderPLMapped.mmesh";
+	const String CorruptFilename = "PLUnitTestsPerformance_MeshLoaderPLMapped_Corrupt.mmesh";
+	RendererContext *pRendererContext = nullptr;
+	MeshManager		*pMeshManager	  = nullptr;
+	Mesh			*pSourceMesh	  = nullptr;	// mesh which was saved
+	Mesh			*pBinaryMesh	  = nullptr;	// mesh loaded by the chunk based mesh loader
+	Mesh			*pMappedMesh	  = nullptr;	// mesh loaded by the memory mapped mesh loader
+	Array<uint8>	 lstMappedData;					// content of the memory mappable mesh file
+	bool			 bBinaryLoaded	  = false;
+	bool			 bMappedLoaded	  = false;
+	bool			 bInitialized	  = false;
+
+	// Creates a sphere with an additional relative morph target, joint weights and an animated skeleton
+	Mesh *CreateMesh()
+	{
+		Mesh *pMesh = pMeshManager->CreateMesh("PLMesh::MeshCreatorSphere", false, "Detail=\"8\"");
+		if (!pMesh)
+			return nullptr;
+		const uint32 nNumOfVertices = pMesh->GetMorphTarget(0)->GetVertexBuffer()->GetNumOfElements();
+
+		// Relative morph target moving every second vertex
+		MeshMorphTarget *pMorphTarget = pMesh->AddMorphTarget();
+		pMorphTarget->SetName("Bulge");
+		pMorphTarget->SetRelative(true);
+		for (uint32 i=0; i<nNumOfVertices; i+=2)
+			pMorphTarget->GetVertexIDs().Add(i);
+		VertexBuffer *pVertexBuffer = pMorphTarget->GetVertexBuffer();
+		pVertexBuffer->AddVertexAttribute(VertexBuffer::Position, 0, VertexBuffer::Float3);
+		pVertexBuffer->Allocate(pMorphTarget->GetVertexIDs().GetNumOfElements(), Usage::Software);
+		if (pVertexBuffer->Lock(Lock::WriteOnly)) {
+			for (uint32 i=0; i<pVertexBuffer->GetNumOfElements(); i++) {
+				float *pfPosition = static_cast<float*>(pVertexBuffer->GetData(i, VertexBuffer::Position));
+				pfPosition[Vector3::X] = 0.1f*i;
+				pfPosition[Vector3::Y] = -0.2f*i;
+				pfPosition[Vector3::Z] = 0.3f;
+			}
+			pVertexBuffer->Unlock();
+		}
+
+		// Skeleton with a joint chain, the root joint animates its position and the other ones their rotation
+		Skeleton *pSkeleton = pMesh->GetSkeletonManager().Create("Skeleton");
+		Array<Skeleton::AniJoint> &lstJoints = pSkeleton->GetJoints();
+		lstJoints.Resize(NumOfJoints);
+		uint32 nAnimatedComponents = 0;
+		for (uint32 i=0; i<NumOfJoints; i++) {
+			Joint *pJoint = pSkeleton->Create(String("Joint") + i);
+			pJoint->SetID(i);
+			pJoint->SetParent(static_cast<int>(i) - 1);
+			pJoint->SetTranslation(Vector3(0.0f, 1.0f + i, 0.5f));
+			pJoint->SetRotation(Quaternion(Vector3::UnitZ, 0.1f*(i + 1)));
+			pJoint->SetTranslationJointSpace(Vector3(0.0f, -1.0f*i, 0.0f));
+			pJoint->SetRotationJointSpace(Quaternion(Vector3::UnitX, -0.1f*i));
+			if (i) {
+				lstJoints[i].nAnimatedComponents = Skeleton::AYaw | Skeleton::APitch | Skeleton::ARoll | Skeleton::AW;
+				nAnimatedComponents += 4;
+			} else {
+				lstJoints[i].nAnimatedComponents = Skeleton::AX | Skeleton::AY | Skeleton::AZ;
+				nAnimatedComponents += 3;
+			}
+		}
+		Array<Skeleton::FrameKeys> &lstFrameKeys = pSkeleton->GetFrameKeys();
+		lstFrameKeys.Resize(NumOfFrames);
+		for (uint32 nFrame=0; nFrame<NumOfFrames; nFrame++) {
+			Array<float> &lstFrameKeysT = lstFrameKeys[nFrame].lstFrameKeys;
+			lstFrameKeysT.Resize(nAnimatedComponents);
+			for (uint32 i=0; i<nAnimatedComponents; i++)
+				lstFrameKeysT[i] = 0.01f*(nFrame*nAnimatedComponents + i);
+		}
+		pSkeleton->SetEndFrame(NumOfFrames - 1);
+		pSkeleton->UpdateJointInformation();
+		SkeletonHandler *pSkeletonHandler = new SkeletonHandler();
+		pSkeletonHandler->SetResource(pSkeleton);
+		pMesh->GetSkeletonHandlers().Add(pSkeletonHandler);
+
+		// Add the joint weights, vertex "i" has "i%NumOfJoints" weights
+		Array<Weight>        &lstWeights       = pMesh->GetWeights();
+		Array<VertexWeights> &lstVertexWeights = pMesh->GetVertexWeights();
+		lstVertexWeights.Resize(nNumOfVertices);
+		for (uint32 i=0; i<nNumOfVertices; i++) {
+			const uint32 nNumOfWeights = i%NumOfJoints;
+			for (uint32 nWeight=0; nWeight<nNumOfWeights; nWeight++) {
+				lstVertexWeights[i].GetWeights().Add(lstWeights.GetNumOfElements());
+				Weight &cWeight = lstWeights.Add();
+				cWeight.SetJoint((i + nWeight)%NumOfJoints);
+				cWeight.SetBias(1.0f/nNumOfWeights);
+			}
+		}
+
+		// Done
+		return pMesh;
+	}
+
+	// Reads the content of the given file
+	bool ReadFile(const String &sFilename, Array<uint8> &lstData)
+	{
+		File cFile(sFilename);
+		if (cFile.Open(File::FileRead)) {
+			lstData.Resize(cFile.GetSize());
+			const bool bResult = (cFile.Read(lstData.GetData(), 1, lstData.GetNumOfElements()) == lstData.GetNumOfElements());
+			cFile.Close();
+			return bResult;
+		}
+		return false;
+	}
+
+	// Writes the first given number of bytes of the memory mappable mesh file into the corrupt mesh file and tries to load it
+	bool LoadCorrupt(const uint8 *pData, uint32 nSize)
+	{
+		File cFile(CorruptFilename);
+		if (!cFile.Open(File::FileWrite | File::FileCreate))
+			return true; // Error, let the test fail
+		cFile.Write(pData, 1, nSize);
+		cFile.Close();
+		Mesh *pMesh = pMeshManager->CreateMesh();
+		const bool bResult = pMesh->LoadByFilename(CorruptFilename);
+		delete pMesh;
+		cFile.Delete();
+		return bResult;
+	}
+
+	// Creates the renderer, saves the mesh using both binary mesh file formats and loads them again, returns 'false' if the null renderer is not available
+	bool Initialize()
+	{
+		if (!bInitialized) {
+			bInitialized = true;
+
+			// Create the null renderer
+			Runtime::ScanDirectoryPlugins();
+			pRendererContext = RendererContext::CreateInstance("PLRendererNull::Renderer", NULL_HANDLE);
+			if (pRendererContext) {
+				pMeshManager = new MeshManager(pRendererContext->GetRenderer());
+
+				// Save the mesh and load it again, keep the content of the memory mappable mesh file for the corrupt file tests
+				pSourceMesh = CreateMesh();
+				if (pSourceMesh && pSourceMesh->SaveByFilename(BinaryFilename) && pSourceMesh->SaveByFilename(MappedFilename)) {
+					pBinaryMesh = pMeshManager->CreateMesh();
+					pMappedMesh = pMeshManager->CreateMesh();
+					bBinaryLoaded = pBinaryMesh->LoadByFilename(BinaryFilename);
+					bMappedLoaded = pMappedMesh->LoadByFilename(MappedFilename) && ReadFile(MappedFilename, lstMappedData);
+				}
+				File(BinaryFilename).Delete();
+				File(MappedFilename).Delete();
+			} else {
+				outputFile << "MeshLoaderPLMapped: The renderer \"PLRendererNull::Renderer\" is not available, skipping the tests" << endl;
+			}
+		}
+		return (pRendererContext != nullptr);
+	}
+
+	// Returns whether or not the given vertex buffers have the same vertex attributes and data
+	bool AreEqual(VertexBuffer &cVertexBuffer1, VertexBuffer &cVertexBuffer2)
+	{
+		if (cVertexBuffer1.GetNumOfVertexAttributes() != cVertexBuffer2.GetNumOfVertexAttributes() ||
+			cVertexBuffer1.GetNumOfElements() != cVertexBuffer2.GetNumOfElements() || cVertexBuffer1.GetSize() != cVertexBuffer2.GetSize())
+			return false;
+		for (uint32 i=0; i<cVertexBuffer1.GetNumOfVertexAttributes(); i++) {
+			const VertexBuffer::Attribute &cAttribute1 = *cVertexBuffer1.GetVertexAttribute(i);
+			const VertexBuffer::Attribute &cAttribute2 = *cVertexBuffer2.GetVertexAttribute(i);
+			if (cAttribute1.nSemantic != cAttribute2.nSemantic || cAttribute1.nChannel != cAttribute2.nChannel ||
+				cAttribute1.nType != cAttribute2.nType || cAttribute1.nOffset != cAttribute2.nOffset)
+				return false;
+		}
+		if (!cVertexBuffer1.GetSize())
+			return true;
+		const void *pData1 = cVertexBuffer1.Lock(Lock::ReadOnly);
+		const void *pData2 = cVertexBuffer2.Lock(Lock::ReadOnly);
+		const bool bResult = (pData1 && pData2 && !memcmp(pData1, pData2, cVertexBuffer1.GetSize()));
+		cVertexBuffer1.Unlock();
+		cVertexBuffer2.Unlock();
+		return bResult;
+	}
+
+	// Returns whether or not the given index buffers have the same element type and data
+	bool AreEqual(IndexBuffer &cIndexBuffer1, IndexBuffer &cIndexBuffer2)
+	{
+		if (cIndexBuffer1.GetElementType() != cIndexBuffer2.GetElementType() ||
+			cIndexBuffer1.GetNumOfElements() != cIndexBuffer2.GetNumOfElements() || cIndexBuffer1.GetSize() != cIndexBuffer2.GetSize())
+			return false;
+		if (!cIndexBuffer1.GetSize())
+			return true;
+		const void *pData1 = cIndexBuffer1.Lock(Lock::ReadOnly);
+		const void *pData2 = cIndexBuffer2.Lock(Lock::ReadOnly);
+		const bool bResult = (pData1 && pData2 && !memcmp(pData1, pData2, cIndexBuffer1.GetSize()));
+		cIndexBuffer1.Unlock();
+		cIndexBuffer2.Unlock();
+		return bResult;
+	}
+
+	// Returns whether or not the LOD levels of the given meshes have the same index buffers and geometries
+	bool AreLODLevelsEqual(const Mesh &cMesh1, const Mesh &cMesh2)
+	{
+		if (!cMesh1.GetNumOfLODLevels() || cMesh1.GetNumOfLODLevels() != cMesh2.GetNumOfLODLevels())
+			return false;
+		for (uint32 nLODLevel=0; nLODLevel<cMesh1.GetNumOfLODLevels(); nLODLevel++) {
+			const MeshLODLevel &cLODLevel1 = *cMesh1.GetLODLevel(nLODLevel);
+			const MeshLODLevel &cLODLevel2 = *cMesh2.GetLODLevel(nLODLevel);
+			if (cLODLevel1.GetLODDistance() != cLODLevel2.GetLODDistance() ||
+				!cLODLevel1.GetIndexBuffer() || !cLODLevel2.GetIndexBuffer() || !AreEqual(*cLODLevel1.GetIndexBuffer(), *cLODLevel2.GetIndexBuffer()))
+				return false;
+			const Array<Geometry> &lstGeometries1 = *cLODLevel1.GetGeometries();
+			const Array<Geometry> &lstGeometries2 = *cLODLevel2.GetGeometries();
+			if (!lstGeometries1.GetNumOfElements() || lstGeometries1.GetNumOfElements() != lstGeometries2.GetNumOfElements())
+				return false;
+			for (uint32 i=0; i<lstGeometries1.GetNumOfElements(); i++) {
+				const Geometry &cGeometry1 = lstGeometries1[i];
+				const Geometry &cGeometry2 = lstGeometries2[i];
+				if (cGeometry1.GetName() != cGeometry2.GetName() || cGeometry1.GetFlags() != cGeometry2.GetFlags() ||
+					cGeometry1.IsActive() != cGeometry2.IsActive() || cGeometry1.GetPrimitiveType() != cGeometry2.GetPrimitiveType() ||
+					cGeometry1.GetMaterial() != cGeometry2.GetMaterial() || cGeometry1.GetStartIndex() != cGeometry2.GetStartIndex() ||
+					cGeometry1.GetIndexSize() != cGeometry2.GetIndexSize())
+					return false;
+			}
+		}
+		return true;
+	}
+
+	// Returns whether or not the given meshes have the same morph targets including their vertex buffers
+	bool AreMorphTargetsEqual(const Mesh &cMesh1, const Mesh &cMesh2)
+	{
+		if (!cMesh1.GetNumOfMorphTargets() || cMesh1.GetNumOfMorphTargets() != cMesh2.GetNumOfMorphTargets())
+			return false;
+		for (uint32 i=0; i<cMesh1.GetNumOfMorphTargets(); i++) {
+			MeshMorphTarget &cMorphTarget1 = *cMesh1.GetMorphTarget(i);
+			MeshMorphTarget &cMorphTarget2 = *cMesh2.GetMorphTarget(i);
+			if (cMorphTarget1.GetName() != cMorphTarget2.GetName() || cMorphTarget1.IsRelative() != cMorphTarget2.IsRelative() ||
+				cMorphTarget1.GetVertexIDs() != cMorphTarget2.GetVertexIDs() ||
+				!AreEqual(*cMorphTarget1.GetVertexBuffer(), *cMorphTarget2.GetVertexBuffer()))
+				return false;
+		}
+		return true;
+	}
+
+	// Returns whether or not the given meshes have the same joint weights
+	bool AreWeightsEqual(Mesh &cMesh1, Mesh &cMesh2)
+	{
+		const Array<Weight> &lstWeights1 = cMesh1.GetWeights();
+		const Array<Weight> &lstWeights2 = cMesh2.GetWeights();
+		if (!lstWeights1.GetNumOfElements() || lstWeights1.GetNumOfElements() != lstWeights2.GetNumOfElements())
+			return false;
+		for (uint32 i=0; i<lstWeights1.GetNumOfElements(); i++) {
+			if (lstWeights1[i].GetJoint() != lstWeights2[i].GetJoint() || lstWeights1[i].GetBias() != lstWeights2[i].GetBias())
+				return false;
+		}
+		Array<VertexWeights> &lstVertexWeights1 = cMesh1.GetVertexWeights();
+		Array<VertexWeights> &lstVertexWeights2 = cMesh2.GetVertexWeights();
+		if (lstVertexWeights1.GetNumOfElements() != lstVertexWeights2.GetNumOfElements())
+			return false;
+		for (uint32 i=0; i<lstVertexWeights1.GetNumOfElements(); i++) {
+			if (lstVertexWeights1[i].GetWeights() != lstVertexWeights2[i].GetWeights())
+				return false;
+		}
+		return true;
+	}
+
+	// Returns whether or not the given meshes have the same skeletons including their base frames and frame keys
+	bool AreSkeletonsEqual(Mesh &cMesh1, Mesh &cMesh2)
+	{
+		Array<SkeletonHandler*> &lstSkeletonHandlers1 = cMesh1.GetSkeletonHandlers();
+		Array<SkeletonHandler*> &lstSkeletonHandlers2 = cMesh2.GetSkeletonHandlers();
+		if (!lstSkeletonHandlers1.GetNumOfElements() || lstSkeletonHandlers1.GetNumOfElements() != lstSkeletonHandlers2.GetNumOfElements())
+			return false;
+		for (uint32 nSkeleton=0; nSkeleton<lstSkeletonHandlers1.GetNumOfElements(); nSkeleton++) {
+			Skeleton *pSkeleton1 = lstSkeletonHandlers1[nSkeleton]->GetResource();
+			Skeleton *pSkeleton2 = lstSkeletonHandlers2[nSkeleton]->GetResource();
+			if (!pSkeleton1 || !pSkeleton2 || pSkeleton1->GetName() != pSkeleton2->GetName() ||
+				pSkeleton1->GetNumOfElements() != pSkeleton2->GetNumOfElements() || pSkeleton1->GetEndFrame() != pSkeleton2->GetEndFrame())
+				return false;
+
+			// Joints and base frame
+			for (uint32 i=0; i<pSkeleton1->GetNumOfElements(); i++) {
+				const Joint &cJoint1 = *pSkeleton1->GetByIndex(i);
+				const Joint &cJoint2 = *pSkeleton2->GetByIndex(i);
+				if (cJoint1.GetName() != cJoint2.GetName() || !(cJoint1 == cJoint2) ||
+					!(static_cast<const JointState&>(cJoint1) == static_cast<const JointState&>(cJoint2)) ||
+					pSkeleton1->GetJoints()[i].nAnimatedComponents != pSkeleton2->GetJoints()[i].nAnimatedComponents)
+					return false;
+			}
+
+			// Frame keys
+			const Array<Skeleton::FrameKeys> &lstFrameKeys1 = pSkeleton1->GetFrameKeys();
+			const Array<Skeleton::FrameKeys> &lstFrameKeys2 = pSkeleton2->GetFrameKeys();
+			if (!lstFrameKeys1.GetNumOfElements() || lstFrameKeys1.GetNumOfElements() != lstFrameKeys2.GetNumOfElements())
+				return false;
+			for (uint32 i=0; i<lstFrameKeys1.GetNumOfElements(); i++) {
+				if (lstFrameKeys1[i].lstFrameKeys != lstFrameKeys2[i].lstFrameKeys)
+					return false;
+			}
+		}
+		return true;
+	}
+
+	TEST(SaveLoad_Mesh){
+		if (Initialize()) {
+			CHECK(pSourceMesh);
+			CHECK(bBinaryLoaded);
+			CHECK(bMappedLoaded);
+		}
+	}
+
+	TEST(SaveLoad_IndexBuffers){
+		if (Initialize() && bBinaryLoaded && bMappedLoaded) {
+			CHECK(AreLODLevelsEqual(*pSourceMesh, *pMappedMesh));
+			CHECK(AreLODLevelsEqual(*pBinaryMesh, *pMappedMesh));
+		}
+	}
+
+	TEST(SaveLoad_MorphTargets){
+		if (Initialize() && bBinaryLoaded && bMappedLoaded) {
+			CHECK(AreMorphTargetsEqual(*pSourceMesh, *pMappedMesh));
+			CHECK(AreMorphTargetsEqual(*pBinaryMesh, *pMappedMesh));
+		}
+	}
+
+	TEST(SaveLoad_Weights){
+		if (Initialize() && bBinaryLoaded && bMappedLoaded) {
+			CHECK(AreWeightsEqual(*pSourceMesh, *pMappedMesh));
+			CHECK(AreWeightsEqual(*pBinaryMesh, *pMappedMesh));
+		}
+	}
+
+	TEST(SaveLoad_Skeleton){
+		if (Initialize() && bBinaryLoaded && bMappedLoaded) {
+			CHECK(AreSkeletonsEqual(*pSourceMesh, *pMappedMesh));
+			CHECK(AreSkeletonsEqual(*pBinaryMesh, *pMappedMesh));
+		}
+	}
+
+	TEST(SaveLoad_BoundingBox){
+		if (Initialize() && bBinaryLoaded && bMappedLoaded) {
+			Vector3 vBinaryMin, vBinaryMax, vMappedMin, vMappedMax;
+			pBinaryMesh->GetBoundingBox(vBinaryMin, vBinaryMax);
+			pMappedMesh->GetBoundingBox(vMappedMin, vMappedMax);
+			CHECK(vBinaryMin == vMappedMin);
+			CHECK(vBinaryMax == vMappedMax);
+		}
+	}
+
+	TEST(Load_Truncated){
+		if (Initialize() && bMappedLoaded) {
+			const uint32 nSize = lstMappedData.GetNumOfElements();
+
+			// Empty file, incomplete header and a file cut within the data blocks or right before the end
+			CHECK(!LoadCorrupt(lstMappedData.GetData(), 0));
+			CHECK(!LoadCorrupt(lstMappedData.GetData(), sizeof(MeshFileMapped::Header) - 1));
+			CHECK(!LoadCorrupt(lstMappedData.GetData(), nSize/2));
+			CHECK(!LoadCorrupt(lstMappedData.GetData(), nSize - 1));
+
+			// The complete file is still fine
+			CHECK(LoadCorrupt(lstMappedData.GetData(), nSize));
+		}
+	}
+
+	TEST(Load_Corrupt){
+		if (Initialize() && bMappedLoaded) {
+			const uint32 nSize = lstMappedData.GetNumOfElements();
+			Array<uint8> lstData;
+
+			// Wrong magic number
+			lstData = lstMappedData;
+			reinterpret_cast<MeshFileMapped::Header*>(lstData.GetData())->nMagic++;
+			CHECK(!LoadCorrupt(lstData.GetData(), nSize));
+
+			// Unknown version
+			lstData = lstMappedData;
+			reinterpret_cast<MeshFileMapped::Header*>(lstData.GetData())->nVersion++;
+			CHECK(!LoadCorrupt(lstData.GetData(), nSize));
+
+			// File size larger than the file
+			lstData = lstMappedData;
+			reinterpret_cast<MeshFileMapped::Header*>(lstData.GetData())->nFileSize = nSize + 1;
+			CHECK(!LoadCorrupt(lstData.GetData(), nSize));
+
+			// Data block behind the end of the file
+			lstData = lstMappedData;
+			reinterpret_cast<MeshFileMapped::Header*>(lstData.GetData())->nLODLevelsOffset = nSize - sizeof(MeshFileMapped::LODLevel)/2;
+			CHECK(!LoadCorrupt(lstData.GetData(), nSize));
+
+			// Number of elements which would overflow a 32 bit size calculation
+			lstData = lstMappedData;
+			reinterpret_cast<MeshFileMapped::Header*>(lstData.GetData())->nWeights = 0x80000000;
+			CHECK(!LoadCorrupt(lstData.GetData(), nSize));
+
+			// Morph target vertex data behind the end of the file
+			lstData = lstMappedData;
+			MeshFileMapped::MorphTarget *pMorphTarget = reinterpret_cast<MeshFileMapped::MorphTarget*>(lstData.GetData() + reinterpret_cast<MeshFileMapped::Header*>(lstData.GetData())->nMorphTargetsOffset);
+			pMorphTarget->nVertexSize = nSize;
+			CHECK(!LoadCorrupt(lstData.GetData(), nSize));
+
+			// Skeleton frame keys behind the end of the file
+			lstData = lstMappedData;
+			MeshFileMapped::Skeleton *pSkeleton = reinterpret_cast<MeshFileMapped::Skeleton*>(lstData.GetData() + reinterpret_cast<MeshFileMapped::Header*>(lstData.GetData())->nSkeletonsOffset);
+			pSkeleton->nFrames = nSize;
+			CHECK(!LoadCorrupt(lstData.GetData(), nSize));
+		}
+	}
+}
@@ -0,0 +1,184 @@
+/*********************************************************\
+ *  File: ParticleSorter.cpp                             *
+ *
+ *  Copyright (C) 2002-2013 The PixelLight Team (http://www.pixellight.org/)
+ *
+ *  This file is part of PixelLight.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ *  and associated documentation files (the "Software"), to deal in the Software without
+ *  restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ *  Software is furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all copies or
+ *  substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ *  BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ *  DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ *  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include <UnitTest++/UnitTest++.h>
+#include <PLMath/Math.h>
+#include <PLParticleGroups/ParticleSorter.h>
+#include <algorithm>
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+using namespace std;
+using namespace PLCore;
+using namespace PLMath;
+using namespace PLParticleGroups;
+
+
+//[-------------------------------------------------------]
+//[ Global variables                                      ]
+//[-------------------------------------------------------]
+extern ofstream outputFile;
+
+
+/*
+* Naming Convention for SUITE:
+* CLASSNAME
+*/
+SUITE(ParticleSorter_Performance) {
+	/*
+	* Naming Convention for METHOD:
+	* METHODNAME_SCENARIO
+	*/
+	// general objects for testing
+	const uint32 TestLoops      = 100;		// number of sorted frames
+	const float  Angle          = 0.5f;		// camera rotation in degree per frame
+	const float  Speed          = 0.005f;	// maximum particle movement per frame, the particles are within [-1, 1]
+	const float  CoherentSpeed  = 0.00001f;	// maximum particle movement per frame while the camera stands still, the order hardly changes
+
+	// Particles within [-1, 1] moving linear
+	struct Particles {
+		Vector3 *pvPosition;
+		Vector3 *pvVelocity;
+		uint32   nNumOfParticles;
+
+		Particles(uint32 nNumOfParticles, float fSpeed) :
+			pvPosition(new Vector3[nNumOfParticles]),
+			pvVelocity(new Vector3[nNumOfParticles]),
+			nNumOfParticles(nNumOfParticles)
+		{
+			// Use always the same particles
+			srand(0);
+			for (uint32 i=0; i<nNumOfParticles; i++) {
+				pvPosition[i].SetXYZ(Math::GetRandNegFloat(), Math::GetRandNegFloat(), Math::GetRandNegFloat());
+				pvVelocity[i].SetXYZ(Math::GetRandNegFloat()*fSpeed, Math::GetRandNegFloat()*fSpeed, Math::GetRandNegFloat()*fSpeed);
+			}
+		}
+
+		~Particles()
+		{
+			delete [] pvPosition;
+			delete [] pvVelocity;
+		}
+
+		void Move()
+		{
+			for (uint32 i=0; i<nNumOfParticles; i++)
+				pvPosition[i] += pvVelocity[i];
+		}
+	};
+
+	// Compares the depth of two particles, used by the reference
+	struct DepthGreater {
+		const float *pfDepth;
+		bool operator ()(uint32 nA, uint32 nB) const
+		{
+			return pfDepth[nA] > pfDepth[nB];
+		}
+	};
+
+	// Reference: Sorts the particles back to front by using a full comparison sort each frame
+	void ReferenceSort(uint32 nNumOfParticles)
+	{
+		Particles cParticles(nNumOfParticles, Speed);
+		float  *pfDepth = new float[nNumOfParticles];
+		uint32 *pnOrder = new uint32[nNumOfParticles];
+		Matrix4x4 mView;
+		for (uint32 nLoop=0; nLoop<TestLoops; nLoop++) {
+			cParticles.Move();
+			mView.FromEulerAngleY(static_cast<float>(nLoop*Angle*Math::DegToRad));
+			for (uint32 i=0; i<nNumOfParticles; i++) {
+				const Vector3 &vPos = cParticles.pvPosition[i];
+				pfDepth[i] = -(mView.zx*vPos.x + mView.zy*vPos.y + mView.zz*vPos.z);
+				pnOrder[i] = i;
+			}
+			DepthGreater sDepthGreater;
+			sDepthGreater.pfDepth = pfDepth;
+			sort(pnOrder, pnOrder + nNumOfParticles, sDepthGreater);
+		}
+		delete [] pfDepth;
+		delete [] pnOrder;
+	}
+
+	// Sorts the particles back to front by using the particle sorter, the camera is rotated by the given angle per frame
+	void Sort(uint32 nNumOfParticles, float fAngle, float fSpeed)
+	{
+		Particles cParticles(nNumOfParticles, fSpeed);
+		ParticleSorter cParticleSorter;
+		cParticleSorter.Allocate(nNumOfParticles);
+		Matrix4x4 mView;
+		uint32 nNumOfIncrementalSorts = 0;
+		for (uint32 nLoop=0; nLoop<TestLoops; nLoop++) {
+			cParticles.Move();
+			mView.FromEulerAngleY(static_cast<float>(nLoop*fAngle*Math::DegToRad));
+			cParticleSorter.SetView(mView);
+			for (uint32 i=0; i<nNumOfParticles; i++)
+				cParticleSorter.SetPosition(i, cParticles.pvPosition[i]);
+			cParticleSorter.Sort(nNumOfParticles);
+			if (cParticleSorter.IsIncremental())
+				nNumOfIncrementalSorts++;
+		}
+		outputFile << "ParticleSorter_Performance: " << nNumOfParticles << " particles, " << nNumOfIncrementalSorts << " of " << TestLoops << " sorts were incremental" << endl;
+	}
+
+	TEST(Reference_Sort_10000){
+		ReferenceSort(10000);
+	}
+
+	TEST(PL_Sort_10000){
+		Sort(10000, Angle, Speed);
+	}
+
+	TEST(PL_Sort_Coherent_10000){
+		Sort(10000, 0.0f, CoherentSpeed);
+	}
+
+	TEST(Reference_Sort_50000){
+		ReferenceSort(50000);
+	}
+
+	TEST(PL_Sort_50000){
+		Sort(50000, Angle, Speed);
+	}
+
+	TEST(PL_Sort_Coherent_50000){
+		Sort(50000, 0.0f, CoherentSpeed);
+	}
+
+	TEST(Reference_Sort_200000){
+		ReferenceSort(200000);
+	}
+
+	TEST(PL_Sort_200000){
+		Sort(200000, Angle, Speed);
+	}
+
+	TEST(PL_Sort_Coherent_200000){
+		Sort(200000, 0.0f, CoherentSpeed);
+	}
+}
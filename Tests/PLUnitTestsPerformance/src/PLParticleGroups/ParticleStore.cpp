@@ -0,0 +1,366 @@
+/*********************************************************\
+ *  File: ParticleStore.cpp                              *
+ *
+ *  Copyright (C) 2002-2013 The PixelLight Team (http://www.pixellight.org/)
+ *
+ *  This file is part of PixelLight.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ *  and associated documentation files (the "Software"), to deal in the Software without
+ *  restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ *  Software is furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all copies or
+ *  substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ *  BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ *  DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ *  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include <float.h>
+#include <UnitTest++/UnitTest++.h>
+#include <PLCore/System/System.h>
+#include <PLCore/System/JobSystem.h>
+#include <PLCore/Container/FastPool.h>
+#include <PLMath/Math.h>
+#include <PLParticleGroups/SNParticleGroup.h>
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+using namespace std;
+using namespace PLCore;
+using namespace PLMath;
+using namespace PLParticleGroups;
+
+
+//[-------------------------------------------------------]
+//[ Global variables                                      ]
+//[-------------------------------------------------------]
+extern ofstream outputFile;
+
+
+/*
+* Naming Convention for SUITE:
+* CLASSNAME
+*/
+SUITE(ParticleStore_Performance) {
+	/*
+	* Naming Convention for METHOD:
+	* METHODNAME_SCENARIO
+	*/
+	// general objects for testing
+	const uint32 NumOfParticles = 100000;	// number of particles, particles without energy are replaced by new ones after each update
+	const uint32 TestLoops      = 100;		// number of iterations
+	const float  TimeDiff       = 0.01f;	// past time per update in seconds
+	const float  Gravity        = -9.81f;	// gravity along the y axis
+
+	// Returns the energy of a new particle, the particles live between 0.5 and 1.5 seconds
+	float GetNewEnergy()
+	{
+		return 0.5f + Math::GetRandFloat();
+	}
+
+	// Reference: Updates the particle list like the particle groups did before the particle store was introduced, including the bounding box pass
+	TEST(Reference_Update){
+		srand(0);
+		FastPool<SNParticleGroup::Particle> lstParticles;
+		uint32 nNumOfRemoved = 0;
+		for (uint32 nLoop=0; nLoop<TestLoops; nLoop++) {
+			// Emit new particles
+			while (lstParticles.GetNumOfElements() < NumOfParticles) {
+				SNParticleGroup::Particle &cParticle = lstParticles.Add();
+				cParticle.vPos.SetXYZ(Math::GetRandNegFloat(), Math::GetRandNegFloat(), Math::GetRandNegFloat());
+				cParticle.vVelocity.SetXYZ(Math::GetRandNegFloat(), Math::GetRandFloat()*10.0f, Math::GetRandNegFloat());
+				cParticle.fEnergy = GetNewEnergy();
+				cParticle.fSize	  = 0.1f;
+			}
+
+			// Update
+			Iterator<SNParticleGroup::Particle> cIterator = lstParticles.GetIterator();
+			while (cIterator.HasNext()) {
+				SNParticleGroup::Particle &cParticle = cIterator.Next();
+				cParticle.fEnergy -= TimeDiff;
+				if (cParticle.fEnergy < 0.0f) {
+					lstParticles.RemoveElement(cParticle);
+					nNumOfRemoved++;
+				} else {
+					cParticle.fSize		 += TimeDiff*4;
+					cParticle.vColor.a	  = cParticle.fEnergy;
+					cParticle.vVelocity.y += Gravity*TimeDiff;
+					cParticle.vPos		 += cParticle.vVelocity*TimeDiff;
+				}
+			}
+
+			// Bounding box
+			Vector3 vMin = lstParticles.Get(0).vPos, vMax = vMin;
+			cIterator = lstParticles.GetIterator();
+			while (cIterator.HasNext()) {
+				const SNParticleGroup::Particle &cParticle = cIterator.Next();
+				for (int i=0; i<3; i++) {
+					if (vMin[i] > cParticle.vPos[i] - cParticle.fSize)
+						vMin[i] = cParticle.vPos[i] - cParticle.fSize;
+					if (vMax[i] < cParticle.vPos[i] + cParticle.fSize)
+						vMax[i] = cParticle.vPos[i] + cParticle.fSize;
+				}
+			}
+		}
+		outputFile << "ParticleStore_Performance: " << nNumOfRemoved << " particles removed" << endl;
+	}
+
+	// Updates the particle store using the given number of worker threads
+	void Update(bool bParallel, uint32 nNumOfWorkers)
+	{
+		JobSystem::GetInstance()->SetNumOfWorkers(nNumOfWorkers);
+		srand(0);
+		ParticleStore cParticleStore;
+		cParticleStore.Allocate(NumOfParticles);
+		ParticleStore::Physics sPhysics;
+		sPhysics.fTimeDiff			 = TimeDiff;
+		sPhysics.vAcceleration		 = Vector3(0.0f, Gravity, 0.0f);
+		sPhysics.fEnergyLoss		 = 1.0f;
+		sPhysics.fSizeGrowth		 = 4.0f;
+		sPhysics.fAlphaScale		 = 1.0f;
+		sPhysics.fAnimationFrameTime = 0.0f;
+		sPhysics.nAnimationSteps	 = 1;
+		uint32 nNumOfRemoved = 0;
+		for (uint32 nLoop=0; nLoop<TestLoops; nLoop++) {
+			// Emit new particles
+			const uint32 nFirst = cParticleStore.GetNumOfParticles();
+			const uint32 nEnd	= nFirst + cParticleStore.Add(NumOfParticles - nFirst);
+			float *pfEnergy = cParticleStore.GetStream(ParticleStore::Energy);
+			float *pfSize	= cParticleStore.GetStream(ParticleStore::Size);
+			for (uint32 i=nFirst; i<nEnd; i++) {
+				cParticleStore.SetPosition(i, Vector3(Math::GetRandNegFloat(), Math::GetRandNegFloat(), Math::GetRandNegFloat()));
+				cParticleStore.SetVelocity(i, Vector3(Math::GetRandNegFloat(), Math::GetRandFloat()*10.0f, Math::GetRandNegFloat()));
+				pfEnergy[i] = GetNewEnergy();
+				pfSize[i]	= 0.1f;
+			}
+
+			// Update, including the bounding box
+			cParticleStore.Update(sPhysics, bParallel);
+			nNumOfRemoved += NumOfParticles - cParticleStore.GetNumOfParticles();
+		}
+		outputFile << "ParticleStore_Performance: " << nNumOfRemoved << " particles removed" << endl;
+	}
+
+	TEST(PL_Update){
+		Update(false, 0);
+	}
+
+	TEST(PL_Update_Parallel_0_Workers){
+		Update(true, 0);
+	}
+
+	TEST(PL_Update_Parallel_CPU_Workers){
+		Update(true, System::GetInstance()->GetNumOfCPUs() - 1);
+	}
+}
+
+/*
+* Naming Convention for SUITE:
+* CLASSNAME
+*/
+SUITE(ParticleStore) {
+	/*
+	* Naming Convention for METHOD:
+	* METHODNAME_SCENARIO
+	*/
+	// general objects for testing
+	const uint32 NumOfParticles = 10003;	// number of particles, not a multiple of four so the remaining particles of the SIMD method are covered as well
+	const uint32 NumOfUpdates   = 8;		// number of updates
+	const float  Epsilon        = 0.0001f;	// maximum difference between the particle store and the reference
+
+	// Particle as used by the reference implementation, the red color component is the particle ID because the particle order isn't stable
+	struct ReferenceParticle {
+		float  fPosition[3];
+		float  fVelocity[3];
+		float  fEnergy;
+		float  fSize;
+		float  fAlpha;
+		float  fAnimationTimer;
+		uint32 nAnimationStep;
+	};
+
+	// Returns the simulation parameters used by the tests
+	ParticleStore::Physics GetPhysics()
+	{
+		ParticleStore::Physics sPhysics;
+		sPhysics.fTimeDiff			 = 0.05f;
+		sPhysics.vAcceleration		 = Vector3(0.5f, -9.81f, 0.25f);
+		sPhysics.fEnergyLoss		 = 1.0f;
+		sPhysics.fSizeGrowth		 = 2.0f;
+		sPhysics.fAlphaScale		 = 2.0f;
+		sPhysics.fAnimationFrameTime = 0.08f;
+		sPhysics.nAnimationSteps	 = 3;
+		return sPhysics;
+	}
+
+	// Fills the particle store and the reference particles with the same random particles, some of them run out of energy during the updates
+	void Initialize(ParticleStore &cParticleStore, ReferenceParticle *pParticles)
+	{
+		srand(0);
+		cParticleStore.Allocate(NumOfParticles);
+		cParticleStore.Add(NumOfParticles);
+		float *pfEnergy = cParticleStore.GetStream(ParticleStore::Energy);
+		float *pfSize	= cParticleStore.GetStream(ParticleStore::Size);
+		float *pfID		= cParticleStore.GetStream(ParticleStore::ColorR);
+		for (uint32 i=0; i<NumOfParticles; i++) {
+			ReferenceParticle &sParticle = pParticles[i];
+			for (int nAxis=0; nAxis<3; nAxis++) {
+				sParticle.fPosition[nAxis] = Math::GetRandNegFloat()*10.0f;
+				sParticle.fVelocity[nAxis] = Math::GetRandNegFloat()*5.0f;
+			}
+			sParticle.fEnergy		  = Math::GetRandFloat()*0.5f;
+			sParticle.fSize			  = Math::GetRandFloat();
+			sParticle.fAlpha		  = 0.0f;
+			sParticle.fAnimationTimer = 0.0f;
+			sParticle.nAnimationStep  = 0;
+			cParticleStore.SetPosition(i, Vector3(sParticle.fPosition));
+			cParticleStore.SetVelocity(i, Vector3(sParticle.fVelocity));
+			pfEnergy[i] = sParticle.fEnergy;
+			pfSize[i]	= sParticle.fSize;
+			pfID[i]		= static_cast<float>(i);
+		}
+	}
+
+	// Reference implementation: Updates the particles one after another as documented by "ParticleStore::Update()", without SIMD
+	void ReferenceUpdate(ReferenceParticle *pParticles, const ParticleStore::Physics &sPhysics, Vector3 &vMin, Vector3 &vMax)
+	{
+		vMin = Vector3( FLT_MAX,  FLT_MAX,  FLT_MAX);
+		vMax = Vector3(-FLT_MAX, -FLT_MAX, -FLT_MAX);
+		for (uint32 i=0; i<NumOfParticles; i++) {
+			ReferenceParticle &sParticle = pParticles[i];
+			if (sParticle.fEnergy >= 0.0f) {
+				sParticle.fEnergy -= sPhysics.fEnergyLoss*sPhysics.fTimeDiff;
+				sParticle.fSize	  += sPhysics.fSizeGrowth*sPhysics.fTimeDiff;
+				sParticle.fAlpha   = Math::Min(Math::Max(sParticle.fEnergy*sPhysics.fAlphaScale, 0.0f), 1.0f);
+				for (int nAxis=0; nAxis<3; nAxis++) {
+					sParticle.fVelocity[nAxis] += sPhysics.vAcceleration[nAxis]*sPhysics.fTimeDiff;
+					sParticle.fPosition[nAxis] += sParticle.fVelocity[nAxis]*sPhysics.fTimeDiff;
+				}
+				sParticle.fAnimationTimer += sPhysics.fTimeDiff;
+				if (sParticle.fAnimationTimer > sPhysics.fAnimationFrameTime) {
+					sParticle.fAnimationTimer = 0.0f;
+					sParticle.nAnimationStep  = (sParticle.nAnimationStep + 1)%sPhysics.nAnimationSteps;
+				}
+				if (sParticle.fEnergy >= 0.0f) {
+					for (int nAxis=0; nAxis<3; nAxis++) {
+						vMin[nAxis] = Math::Min(vMin[nAxis], sParticle.fPosition[nAxis] - sParticle.fSize);
+						vMax[nAxis] = Math::Max(vMax[nAxis], sParticle.fPosition[nAxis] + sParticle.fSize);
+					}
+				}
+			}
+		}
+	}
+
+	// Checks the particles of the particle store against the reference particles, returns the number of living reference particles
+	uint32 CheckParticles(ParticleStore &cParticleStore, const ReferenceParticle *pParticles)
+	{
+		// Each particle within the store must match its reference particle
+		const float  *pfPositionX		= cParticleStore.GetStream(ParticleStore::PositionX);
+		const float  *pfPositionY		= cParticleStore.GetStream(ParticleStore::PositionY);
+		const float  *pfPositionZ		= cParticleStore.GetStream(ParticleStore::PositionZ);
+		const float  *pfVelocityY		= cParticleStore.GetStream(ParticleStore::VelocityY);
+		const float  *pfEnergy			= cParticleStore.GetStream(ParticleStore::Energy);
+		const float  *pfSize			= cParticleStore.GetStream(ParticleStore::Size);
+		const float  *pfAlpha			= cParticleStore.GetStream(ParticleStore::ColorA);
+		const float  *pfID				= cParticleStore.GetStream(ParticleStore::ColorR);
+		const uint32 *pnAnimationSteps	= cParticleStore.GetAnimationSteps();
+		for (uint32 i=0; i<cParticleStore.GetNumOfParticles(); i++) {
+			const ReferenceParticle &sParticle = pParticles[static_cast<uint32>(pfID[i])];
+			CHECK(sParticle.fEnergy >= 0.0f);
+			CHECK_CLOSE(sParticle.fPosition[0], pfPositionX[i], Epsilon);
+			CHECK_CLOSE(sParticle.fPosition[1], pfPositionY[i], Epsilon);
+			CHECK_CLOSE(sParticle.fPosition[2], pfPositionZ[i], Epsilon);
+			CHECK_CLOSE(sParticle.fVelocity[1], pfVelocityY[i], Epsilon);
+			CHECK_CLOSE(sParticle.fEnergy,		pfEnergy[i],	Epsilon);
+			CHECK_CLOSE(sParticle.fSize,		pfSize[i],		Epsilon);
+			CHECK_CLOSE(sParticle.fAlpha,		pfAlpha[i],		Epsilon);
+			CHECK_EQUAL(sParticle.nAnimationStep, pnAnimationSteps[i]);
+		}
+
+		// The store must contain exactly the living particles
+		uint32 nNumOfParticles = 0;
+		for (uint32 i=0; i<NumOfParticles; i++) {
+			if (pParticles[i].fEnergy >= 0.0f)
+				nNumOfParticles++;
+		}
+		CHECK_EQUAL(nNumOfParticles, cParticleStore.GetNumOfParticles());
+		return nNumOfParticles;
+	}
+
+	// Compares the particle store update with the reference update
+	void CheckUpdate(bool bParallel)
+	{
+		ParticleStore cParticleStore;
+		ReferenceParticle *pParticles = new ReferenceParticle[NumOfParticles];
+		Initialize(cParticleStore, pParticles);
+		const ParticleStore::Physics sPhysics = GetPhysics();
+		for (uint32 nUpdate=0; nUpdate<NumOfUpdates; nUpdate++) {
+			Vector3 vMin, vMax;
+			ReferenceUpdate(pParticles, sPhysics, vMin, vMax);
+			cParticleStore.Update(sPhysics, bParallel);
+			const uint32 nNumOfParticles = CheckParticles(cParticleStore, pParticles);
+
+			// Bounding box
+			const AABoundingBox &cBoundingBox = cParticleStore.GetBoundingBox();
+			if (nNumOfParticles) {
+				for (int nAxis=0; nAxis<3; nAxis++) {
+					CHECK_CLOSE(vMin[nAxis], cBoundingBox.vMin[nAxis], Epsilon);
+					CHECK_CLOSE(vMax[nAxis], cBoundingBox.vMax[nAxis], Epsilon);
+				}
+			}
+		}
+
+		// After the last update, some but not all particles have run out of energy
+		CHECK(cParticleStore.GetNumOfParticles() > 0);
+		CHECK(cParticleStore.GetNumOfParticles() < NumOfParticles);
+		delete [] pParticles;
+	}
+
+	TEST(Update){
+		CheckUpdate(false);
+	}
+
+	TEST(Update_Parallel_0_Workers){
+		JobSystem::GetInstance()->SetNumOfWorkers(0);
+		CheckUpdate(true);
+	}
+
+	TEST(Update_Parallel_CPU_Workers){
+		JobSystem::GetInstance()->SetNumOfWorkers(Math::Max(System::GetInstance()->GetNumOfCPUs() - 1, 1U));
+		CheckUpdate(true);
+	}
+
+	TEST(Remove){
+		ParticleStore cParticleStore;
+		cParticleStore.Allocate(4);
+		CHECK_EQUAL(4U, cParticleStore.Add(5));
+		float *pfID = cParticleStore.GetStream(ParticleStore::ColorR);
+		for (uint32 i=0; i<4; i++)
+			pfID[i] = static_cast<float>(i);
+
+		// The last particle is moved into the gap
+		cParticleStore.Remove(1);
+		CHECK_EQUAL(3U, cParticleStore.GetNumOfParticles());
+		CHECK_EQUAL(0.0f, pfID[0]);
+		CHECK_EQUAL(3.0f, pfID[1]);
+		CHECK_EQUAL(2.0f, pfID[2]);
+
+		// Removing the last particle doesn't move anything
+		cParticleStore.Remove(2);
+		CHECK_EQUAL(2U, cParticleStore.GetNumOfParticles());
+		CHECK_EQUAL(0.0f, pfID[0]);
+		CHECK_EQUAL(3.0f, pfID[1]);
+	}
+}
@@ -0,0 +1,299 @@
+/*********************************************************\
+ *  File: CommandBuffer.cpp                              *
+ *
+ *  Copyright (C) 2002-2013 The PixelLight Team (http://www.pixellight.org/)
+ *
+ *  This file is part of PixelLight.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ *  and associated documentation files (the "Software"), to deal in the Software without
+ *  restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ *  Software is furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all copies or
+ *  substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ *  BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ *  DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ *  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include <UnitTest++/UnitTest++.h>
+#include <PLCore/Runtime.h>
+#include <PLCore/System/System.h>
+#include <PLCore/System/JobSystem.h>
+#include <PLMath/Rectangle.h>
+#include <PLGraphics/Color/Color4.h>
+#include <PLRenderer/RendererContext.h>
+#include <PLRenderer/Renderer/Renderer.h>
+#include <PLRenderer/Renderer/IndexBuffer.h>
+#include <PLRenderer/Renderer/CommandBuffer.h>
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+using namespace std;
+using namespace PLCore;
+using namespace PLMath;
+using namespace PLGraphics;
+using namespace PLRenderer;
+
+
+//[-------------------------------------------------------]
+//[ Global variables                                      ]
+//[-------------------------------------------------------]
+extern ofstream outputFile;
+
+
+/*
+* Naming Convention for SUITE:
+* CLASSNAME
+*/
+SUITE(CommandBuffer_Performance) {
+	/*
+	* Naming Convention for METHOD:
+	* METHODNAME_SCENARIO
+	*/
+	// general objects for testing
+	const uint32 NumOfDrawCalls		 = 10000;	// number of draw calls per iteration
+	const uint32 NumOfCommandBuffers = 16;		// number of command buffers used for the parallel recording
+	const uint32 TestLoops			 = 50;		// number of iterations
+	RendererContext *pRendererContext = nullptr;
+	IndexBuffer		*pIndexBuffer	  = nullptr;
+	CommandBuffer	 cCommandBuffers[NumOfCommandBuffers];
+	bool			 bInitialized	  = false;
+
+	// Creates the renderer and the index buffer used by the draw calls, returns 'false' if the null renderer is not available
+	bool Initialize()
+	{
+		if (!bInitialized) {
+			bInitialized = true;
+
+			// Create the null renderer
+			Runtime::ScanDirectoryPlugins();
+			pRendererContext = RendererContext::CreateInstance("PLRendererNull::Renderer", NULL_HANDLE);
+			if (pRendererContext) {
+				pIndexBuffer = pRendererContext->GetRenderer().CreateIndexBuffer();
+				pIndexBuffer->SetElementType(IndexBuffer::UShort);
+				pIndexBuffer->Allocate(300, Usage::Static);
+			} else {
+				outputFile << "CommandBuffer_Performance: The renderer \"PLRendererNull::Renderer\" is not available, skipping the tests" << endl;
+			}
+		}
+		return (pRendererContext != nullptr);
+	}
+
+	// Issues the renderer calls of the draw calls within the given range, the renderer can be the real one or a command buffer
+	template <typename T>
+	void Draw(T &cRenderer, uint32 nFirstDrawCall, uint32 nLastDrawCall)
+	{
+		for (uint32 i=nFirstDrawCall; i<nLastDrawCall; i++) {
+			cRenderer.SetRenderState(RenderState::CullMode, (i & 1) ? Cull::CW : Cull::CCW);
+			cRenderer.SetRenderState(RenderState::BlendEnable, (i & 2) != 0);
+			cRenderer.SetSamplerState(0, Sampler::MagFilter, (i & 4) ? TextureFiltering::Point : TextureFiltering::Linear);
+			cRenderer.SetTextureBuffer(0, nullptr);
+			cRenderer.SetIndexBuffer(pIndexBuffer);
+			cRenderer.DrawIndexedPrimitives(Primitive::TriangleList, 0, 99, (i%100)*3, 3);
+		}
+	}
+
+	// Parallel for function recording a part of the draw calls into the command buffer of the part
+	void RecordCommandBuffers(uint32 nFirst, uint32 nLast, void *pData)
+	{
+		for (uint32 nPart=nFirst; nPart<nLast; nPart++) {
+			CommandBuffer &cCommandBuffer = cCommandBuffers[nPart];
+			cCommandBuffer.Reset();
+			Draw(cCommandBuffer, nPart*NumOfDrawCalls/NumOfCommandBuffers, (nPart + 1)*NumOfDrawCalls/NumOfCommandBuffers);
+		}
+	}
+
+	// Records the draw calls using the given number of worker threads and replays them afterwards
+	void RecordAndExecuteParallel(uint32 nNumOfWorkers)
+	{
+		if (Initialize()) {
+			Renderer &cRenderer = pRendererContext->GetRenderer();
+			JobSystem::GetInstance()->SetNumOfWorkers(nNumOfWorkers);
+			for (uint32 nLoop=0; nLoop<TestLoops; nLoop++) {
+				JobSystem::GetInstance()->ParallelFor(NumOfCommandBuffers, 1, &RecordCommandBuffers, nullptr);
+				for (uint32 nPart=0; nPart<NumOfCommandBuffers; nPart++)
+					cCommandBuffers[nPart].Execute(cRenderer);
+			}
+		}
+	}
+
+	// Renderer state and statistics changes compared by the replay tests
+	struct RendererState {
+		int			   nRenderStates[RenderState::Number];
+		int			   nSamplerStates[Sampler::Number];
+		Rectangle	   cViewport;
+		float		   fMinZ;
+		float		   fMaxZ;
+		Rectangle	   cScissorRect;
+		bool		   bColorMask[4];
+		TextureBuffer *pTextureBuffer;
+		IndexBuffer	  *pIndexBuffer;
+		Statistics	   sStatistics;
+	};
+
+	// Issues the renderer calls of a frame within the given range of draw calls, the frame setup is done together with the first draw
+	// call and some additional draw calls are done together with the last draw call
+	const uint32 NumOfFrameDrawCalls = 100;
+	template <typename T>
+	void DrawFrame(T &cRenderer, uint32 nFirstDrawCall, uint32 nLastDrawCall)
+	{
+		if (!nFirstDrawCall) {
+			const Rectangle cRectangle(10.0f, 20.0f, 300.0f, 200.0f);
+			cRenderer.SetViewport(&cRectangle, 0.1f, 0.9f);
+			cRenderer.SetScissorRect(&cRectangle);
+			cRenderer.SetColorMask(true, false, true, false);
+			cRenderer.Clear(Clear::Color | Clear::ZBuffer, Color4::Red, 1.0f, 0);
+			cRenderer.SetRenderState(RenderState::ZWriteEnable, false);
+		}
+		Draw(cRenderer, nFirstDrawCall, nLastDrawCall);
+		if (nLastDrawCall == NumOfFrameDrawCalls) {
+			cRenderer.DrawIndexedPrimitives(Primitive::TriangleStrip, 0, 99, 0, 10);
+			cRenderer.DrawIndexedPrimitives(Primitive::PointList, 0, 99, 0, 5);
+		}
+	}
+
+	// Resets the renderer and returns the statistics before the frame is drawn
+	Statistics BeginFrame(Renderer &cRenderer)
+	{
+		cRenderer.Reset();
+		return cRenderer.GetStatistics();
+	}
+
+	// Returns the current renderer state and the statistics changes since the frame was begun
+	void EndFrame(Renderer &cRenderer, const Statistics &sStatistics, RendererState &sState)
+	{
+		for (uint32 i=0; i<RenderState::Number; i++)
+			sState.nRenderStates[i] = cRenderer.GetRenderState(static_cast<RenderState::Enum>(i));
+		for (uint32 i=0; i<Sampler::Number; i++)
+			sState.nSamplerStates[i] = cRenderer.GetSamplerState(0, static_cast<Sampler::Enum>(i));
+		sState.cViewport	= cRenderer.GetViewport(&sState.fMinZ, &sState.fMaxZ);
+		sState.cScissorRect	= cRenderer.GetScissorRect();
+		cRenderer.GetColorMask(sState.bColorMask[0], sState.bColorMask[1], sState.bColorMask[2], sState.bColorMask[3]);
+		sState.pTextureBuffer = cRenderer.GetTextureBuffer(0);
+		sState.pIndexBuffer	  = cRenderer.GetIndexBuffer();
+		sState.sStatistics	  = cRenderer.GetStatistics();
+		sState.sStatistics.nRenderStateChanges	   -= sStatistics.nRenderStateChanges;
+		sState.sStatistics.nSamplerStateChanges	   -= sStatistics.nSamplerStateChanges;
+		sState.sStatistics.nRedundantRenderStates  -= sStatistics.nRedundantRenderStates;
+		sState.sStatistics.nRedundantSamplerStates -= sStatistics.nRedundantSamplerStates;
+		sState.sStatistics.nDrawPrimitivCalls	   -= sStatistics.nDrawPrimitivCalls;
+		sState.sStatistics.nVertices			   -= sStatistics.nVertices;
+		sState.sStatistics.nTriangles			   -= sStatistics.nTriangles;
+	}
+
+	// Checks that replaying the commands resulted in the same renderer state and statistics as the direct renderer calls
+	void CheckState(const RendererState &sExpected, const RendererState &sState)
+	{
+		for (uint32 i=0; i<RenderState::Number; i++)
+			CHECK_EQUAL(sExpected.nRenderStates[i], sState.nRenderStates[i]);
+		for (uint32 i=0; i<Sampler::Number; i++)
+			CHECK_EQUAL(sExpected.nSamplerStates[i], sState.nSamplerStates[i]);
+		CHECK(sExpected.cViewport.vMin == sState.cViewport.vMin && sExpected.cViewport.vMax == sState.cViewport.vMax);
+		CHECK_EQUAL(sExpected.fMinZ, sState.fMinZ);
+		CHECK_EQUAL(sExpected.fMaxZ, sState.fMaxZ);
+		CHECK(sExpected.cScissorRect.vMin == sState.cScissorRect.vMin && sExpected.cScissorRect.vMax == sState.cScissorRect.vMax);
+		for (uint32 i=0; i<4; i++)
+			CHECK_EQUAL(sExpected.bColorMask[i], sState.bColorMask[i]);
+		CHECK(sExpected.pTextureBuffer == sState.pTextureBuffer);
+		CHECK(sExpected.pIndexBuffer == sState.pIndexBuffer);
+		CHECK_EQUAL(sExpected.sStatistics.nRenderStateChanges,	   sState.sStatistics.nRenderStateChanges);
+		CHECK_EQUAL(sExpected.sStatistics.nSamplerStateChanges,	   sState.sStatistics.nSamplerStateChanges);
+		CHECK_EQUAL(sExpected.sStatistics.nRedundantRenderStates,  sState.sStatistics.nRedundantRenderStates);
+		CHECK_EQUAL(sExpected.sStatistics.nRedundantSamplerStates, sState.sStatistics.nRedundantSamplerStates);
+		CHECK_EQUAL(sExpected.sStatistics.nDrawPrimitivCalls,	   sState.sStatistics.nDrawPrimitivCalls);
+		CHECK_EQUAL(sExpected.sStatistics.nVertices,			   sState.sStatistics.nVertices);
+		CHECK_EQUAL(sExpected.sStatistics.nTriangles,			   sState.sStatistics.nTriangles);
+	}
+
+	TEST(Execute_Equivalence){
+		if (Initialize()) {
+			Renderer &cRenderer = pRendererContext->GetRenderer();
+
+			// Direct renderer calls
+			RendererState sExpected;
+			Statistics sStatistics = BeginFrame(cRenderer);
+			DrawFrame(cRenderer, 0, NumOfFrameDrawCalls);
+			EndFrame(cRenderer, sStatistics, sExpected);
+			CHECK_EQUAL(NumOfFrameDrawCalls + 2, sExpected.sStatistics.nDrawPrimitivCalls);
+
+			// Replay of a single command buffer
+			CommandBuffer cCommandBuffer;
+			DrawFrame(cCommandBuffer, 0, NumOfFrameDrawCalls);
+			RendererState sState;
+			sStatistics = BeginFrame(cRenderer);
+			CHECK_EQUAL(cCommandBuffer.GetNumOfCommands(), cCommandBuffer.Execute(cRenderer));
+			EndFrame(cRenderer, sStatistics, sState);
+			CheckState(sExpected, sState);
+
+			// Replay of command buffers recorded separately and appended to each other, the first one is reused after a reset
+			CommandBuffer cFirstCommandBuffer, cSecondCommandBuffer;
+			DrawFrame(cFirstCommandBuffer, 0, NumOfFrameDrawCalls);
+			cFirstCommandBuffer.Reset();
+			DrawFrame(cFirstCommandBuffer, 0, 37);
+			DrawFrame(cSecondCommandBuffer, 37, NumOfFrameDrawCalls);
+			cFirstCommandBuffer.Append(cSecondCommandBuffer);
+			CHECK_EQUAL(cCommandBuffer.GetNumOfCommands(), cFirstCommandBuffer.GetNumOfCommands());
+			sStatistics = BeginFrame(cRenderer);
+			CHECK_EQUAL(cFirstCommandBuffer.GetNumOfCommands(), cFirstCommandBuffer.Execute(cRenderer));
+			EndFrame(cRenderer, sStatistics, sState);
+			CheckState(sExpected, sState);
+		}
+	}
+
+	TEST(Direct){
+		if (Initialize()) {
+			Renderer &cRenderer = pRendererContext->GetRenderer();
+			for (uint32 nLoop=0; nLoop<TestLoops; nLoop++)
+				Draw(cRenderer, 0, NumOfDrawCalls);
+		}
+	}
+
+	TEST(Record){
+		if (Initialize()) {
+			for (uint32 nLoop=0; nLoop<TestLoops; nLoop++) {
+				cCommandBuffers[0].Reset();
+				Draw(cCommandBuffers[0], 0, NumOfDrawCalls);
+			}
+		}
+	}
+
+	TEST(Execute){
+		if (Initialize()) {
+			// Uses the command buffer recorded by the previous test
+			Renderer &cRenderer = pRendererContext->GetRenderer();
+			for (uint32 nLoop=0; nLoop<TestLoops; nLoop++)
+				cCommandBuffers[0].Execute(cRenderer);
+		}
+	}
+
+	TEST(RecordAndExecute){
+		if (Initialize()) {
+			Renderer &cRenderer = pRendererContext->GetRenderer();
+			for (uint32 nLoop=0; nLoop<TestLoops; nLoop++) {
+				cCommandBuffers[0].Reset();
+				Draw(cCommandBuffers[0], 0, NumOfDrawCalls);
+				cCommandBuffers[0].Execute(cRenderer);
+			}
+		}
+	}
+
+	TEST(RecordAndExecute_Parallel_0_Workers){
+		RecordAndExecuteParallel(0);
+	}
+
+	TEST(RecordAndExecute_Parallel_CPU_Workers){
+		RecordAndExecuteParallel(System::GetInstance()->GetNumOfCPUs() - 1);
+	}
+}
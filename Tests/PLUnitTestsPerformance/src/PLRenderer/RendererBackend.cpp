@@ -0,0 +1,118 @@
+/*********************************************************\
+ *  File: RendererBackend.cpp                            *
+ *
+ *  Copyright (C) 2002-2013 The PixelLight Team (http://www.pixellight.org/)
+ *
+ *  This file is part of PixelLight.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ *  and associated documentation files (the "Software"), to deal in the Software without
+ *  restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ *  Software is furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all copies or
+ *  substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ *  BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ *  DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ *  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include <UnitTest++/UnitTest++.h>
+#include <PLCore/Runtime.h>
+#include <PLRenderer/RendererContext.h>
+#include <PLRenderer/Renderer/Renderer.h>
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+using namespace std;
+using namespace PLCore;
+using namespace PLRenderer;
+
+
+//[-------------------------------------------------------]
+//[ Global variables                                      ]
+//[-------------------------------------------------------]
+extern ofstream outputFile;
+
+
+/*
+* Naming Convention for SUITE:
+* CLASSNAME
+*/
+SUITE(RendererBackend_Performance) {
+	/*
+	* Naming Convention for METHOD:
+	* METHODNAME_SCENARIO
+	*/
+	// general objects for testing
+	const uint32 NumOfDrawCalls = 10000;	// number of simulated draw calls per iteration
+	const uint32 TestLoops		= 50;		// number of iterations
+	RendererContext *pRendererContext = nullptr;
+	bool			 bInitialized	  = false;
+
+	// Creates the renderer, returns 'false' if the null renderer is not available
+	bool Initialize()
+	{
+		if (!bInitialized) {
+			bInitialized = true;
+
+			// Create the null renderer
+			Runtime::ScanDirectoryPlugins();
+			pRendererContext = RendererContext::CreateInstance("PLRendererNull::Renderer", NULL_HANDLE);
+			if (!pRendererContext)
+				outputFile << "RendererBackend_Performance: The renderer \"PLRendererNull::Renderer\" is not available, skipping the tests" << endl;
+		}
+		return (pRendererContext != nullptr);
+	}
+
+	// Sets the states of the simulated draw calls, every n-th draw call changes the states, writes the state change statistics of the last iteration into the output file
+	void SetStates(const char *pszScenario, uint32 nChangeInterval)
+	{
+		if (Initialize()) {
+			Renderer &cRenderer = pRendererContext->GetRenderer();
+			for (uint32 nLoop=0; nLoop<TestLoops; nLoop++) {
+				// Start a new frame, this resets the per frame statistics
+				cRenderer.Update();
+
+				for (uint32 i=0; i<NumOfDrawCalls; i++) {
+					const uint32 nBatch = i/nChangeInterval;
+					cRenderer.SetRenderState(RenderState::CullMode, (nBatch & 1) ? Cull::CW : Cull::CCW);
+					cRenderer.SetRenderState(RenderState::BlendEnable, (nBatch & 2) != 0);
+					cRenderer.SetRenderState(RenderState::ZWriteEnable, true);
+					cRenderer.SetSamplerState(0, Sampler::MagFilter, (nBatch & 4) ? TextureFiltering::Point : TextureFiltering::Linear);
+					cRenderer.SetSamplerState(0, Sampler::AddressU, TextureAddressing::Wrap);
+					cRenderer.SetTextureBuffer(0, nullptr);
+					cRenderer.SetProgram(nullptr);
+				}
+			}
+
+			// Write the statistics of the last frame
+			const Statistics &sStatistics = cRenderer.GetStatistics();
+			outputFile << "RendererBackend_Performance: " << pszScenario << ": "
+					   << sStatistics.nRenderStateChanges << " render state changes (" << sStatistics.nRedundantRenderStates << " redundant), "
+					   << sStatistics.nSamplerStateChanges << " sampler state changes (" << sStatistics.nRedundantSamplerStates << " redundant), "
+					   << sStatistics.nTextureBufferBinds << " texture buffer binds (" << sStatistics.nRedundantTextureBuffers << " redundant), "
+					   << sStatistics.nProgramChanges << " program changes (" << sStatistics.nRedundantPrograms << " redundant)" << endl;
+		}
+	}
+
+	TEST(SetStates_Sorted){
+		// Draw calls sorted by state, the states change every 100 draw calls
+		SetStates("Sorted", 100);
+	}
+
+	TEST(SetStates_Unsorted){
+		// Draw calls not sorted by state, the states change with every draw call
+		SetStates("Unsorted", 1);
+	}
+}
@@ -0,0 +1,565 @@
+/*********************************************************\
+ *  File: RendererSoftware.cpp                           *
+ *
+ *  Copyright (C) 2002-2013 The PixelLight Team (http://www.pixellight.org/)
+ *
+ *  This file is part of PixelLight.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ *  and associated documentation files (the "Software"), to deal in the Software without
+ *  restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ *  Software is furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all copies or
+ *  substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ *  BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ *  DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ *  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include <UnitTest++/UnitTest++.h>
+#include <PLCore/Runtime.h>
+#include <PLCore/Tools/Tools.h>
+#include <PLGraphics/Image/Image.h>
+#include <PLGraphics/Image/ImageBuffer.h>
+#include <PLRenderer/RendererContext.h>
+#include <PLRenderer/Renderer/FixedFunctions.h>
+#include <PLRenderer/Renderer/VertexBuffer.h>
+#include <PLRenderer/Renderer/TextureBuffer2D.h>
+#include <PLRenderer/Renderer/SurfaceTextureBuffer.h>
+#include <PLRendererSoftware/Renderer.h>
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+using namespace std;
+using namespace PLCore;
+using namespace PLMath;
+using namespace PLGraphics;
+using namespace PLRenderer;
+
+
+//[-------------------------------------------------------]
+//[ Global variables                                      ]
+//[-------------------------------------------------------]
+extern ofstream outputFile;
+
+
+/*
+* Naming Convention for SUITE:
+* CLASSNAME
+*/
+SUITE(RendererSoftware) {
+	/*
+	* Naming Convention for METHOD:
+	* METHODNAME_SCENARIO
+	*/
+	// general objects for testing
+	const int	 Size		 = 16;	// width and height of the render target in pixels
+	const uint32 MaxVertices = 16;	// maximum number of vertices per draw call
+	RendererContext		 *pRendererContext = nullptr;
+	SurfaceTextureBuffer *pSurface		   = nullptr;
+	VertexBuffer		 *pVertexBuffer	   = nullptr;
+	bool				  bInitialized	   = false;
+	uint8				  nPixels[Size*Size*4];
+
+	// Creates the renderer and resets all states, returns 'false' if the software renderer is not available
+	bool Initialize()
+	{
+		if (!bInitialized) {
+			bInitialized = true;
+
+			// Create the software renderer, a render target and a vertex buffer with clip space positions and texture coordinates
+			Runtime::ScanDirectoryPlugins();
+			pRendererContext = RendererContext::CreateInstance("PLRendererSoftware::Renderer", NULL_HANDLE);
+			if (pRendererContext) {
+				Renderer &cRenderer = pRendererContext->GetRenderer();
+				pSurface	  = cRenderer.CreateSurfaceTextureBuffer2D(Vector2i(Size, Size), TextureBuffer::R8G8B8A8, SurfaceTextureBuffer::Depth);
+				pVertexBuffer = cRenderer.CreateVertexBuffer();
+				pVertexBuffer->AddVertexAttribute(VertexBuffer::Position, 0, VertexBuffer::Float3);
+				pVertexBuffer->AddVertexAttribute(VertexBuffer::TexCoord, 0, VertexBuffer::Float2);
+				pVertexBuffer->Allocate(MaxVertices, Usage::WriteOnly);
+			} else {
+				outputFile << "RendererSoftware: The renderer \"PLRendererSoftware::Renderer\" is not available, skipping the tests" << endl;
+			}
+		}
+		if (pRendererContext) {
+			// Default states, a black render target and a white color
+			Renderer &cRenderer = pRendererContext->GetRenderer();
+			cRenderer.Reset();
+			cRenderer.SetRenderTarget(pSurface);
+			cRenderer.Clear(Clear::Color | Clear::ZBuffer, Color4::Black, 1.0f);
+			cRenderer.GetFixedFunctions()->SetColor(Color4::White);
+		}
+		return (pRendererContext != nullptr);
+	}
+
+	// Returns the clip space coordinate of a pixel center
+	float ToClipSpace(int nPixel)
+	{
+		return (nPixel + 0.5f)/Size*2.0f - 1.0f;
+	}
+
+	// Draws primitives, a vertex is given as (x, y, z) clip space position followed by the (u, v) texture coordinate
+	bool Draw(Primitive::Enum nType, const float fVertices[][5], uint32 nNumOfVertices)
+	{
+		if (pVertexBuffer->Lock(Lock::WriteOnly)) {
+			for (uint32 i=0; i<nNumOfVertices; i++) {
+				float *pfPosition = static_cast<float*>(pVertexBuffer->GetData(i, VertexBuffer::Position));
+				pfPosition[0] = fVertices[i][0];
+				pfPosition[1] = fVertices[i][1];
+				pfPosition[2] = fVertices[i][2];
+				float *pfTexCoord = static_cast<float*>(pVertexBuffer->GetData(i, VertexBuffer::TexCoord));
+				pfTexCoord[0] = fVertices[i][3];
+				pfTexCoord[1] = fVertices[i][4];
+			}
+			pVertexBuffer->Unlock();
+		}
+		Renderer &cRenderer = pRendererContext->GetRenderer();
+		cRenderer.GetFixedFunctions()->SetVertexBuffer(pVertexBuffer);
+		return cRenderer.DrawPrimitives(nType, 0, nNumOfVertices);
+	}
+
+	// Draws a counterclockwise quad as two triangles, the texture coordinates are going from (0, 0) at the minimum to (1, 1) at the maximum
+	bool DrawQuad(float fMinX, float fMinY, float fMaxX, float fMaxY, float fZ)
+	{
+		const float fVertices[6][5] = {
+			{ fMinX, fMinY, fZ, 0.0f, 0.0f }, { fMaxX, fMinY, fZ, 1.0f, 0.0f }, { fMaxX, fMaxY, fZ, 1.0f, 1.0f },
+			{ fMinX, fMinY, fZ, 0.0f, 0.0f }, { fMaxX, fMaxY, fZ, 1.0f, 1.0f }, { fMinX, fMaxY, fZ, 0.0f, 1.0f }
+		};
+		return Draw(Primitive::TriangleList, fVertices, 6);
+	}
+
+	// Reads the pixels of a texture buffer of the render target size
+	void ReadPixels(const TextureBuffer &cTextureBuffer)
+	{
+		MemoryManager::Set(nPixels, 0, sizeof(nPixels));
+		cTextureBuffer.CopyDataTo(0, TextureBuffer::R8G8B8A8, nPixels);
+	}
+
+	// Returns a channel of a pixel read by "ReadPixels()", (0, 0) is the bottom left pixel
+	uint8 GetPixel(int nX, int nY, int nChannel = 0)
+	{
+		return nPixels[(nY*Size + nX)*4 + nChannel];
+	}
+
+	// Returns the number of pixels read by "ReadPixels()" with the given red value
+	int CountPixels(uint8 nRed)
+	{
+		int nCount = 0;
+		for (int nY=0; nY<Size; nY++) {
+			for (int nX=0; nX<Size; nX++) {
+				if (GetPixel(nX, nY) == nRed)
+					nCount++;
+			}
+		}
+		return nCount;
+	}
+
+	// C++ shader discarding pixels with an u texture coordinate below 0.5 and writing the u texture coordinate as red color
+	class TestShader : public PLRendererSoftware::Shader {
+		public:
+			TestShader() :
+				m_pPosition(nullptr),
+				m_pTexCoord(nullptr)
+			{
+			}
+
+			virtual bool Setup(const Renderer &cRenderer, const VertexBuffer &cVertexBuffer) override
+			{
+				m_pPosition = cVertexBuffer.GetVertexAttribute(VertexBuffer::Position);
+				m_pTexCoord = cVertexBuffer.GetVertexAttribute(VertexBuffer::TexCoord);
+				return (m_pPosition && m_pTexCoord);
+			}
+
+			virtual uint32 GetNumOfVaryings() const override
+			{
+				return 1;
+			}
+
+			virtual void ProcessVertex(const uint8 *pnVertex, float fPosition[4], float fVarying[]) const override
+			{
+				float fTexCoord[4];
+				ReadAttribute(pnVertex, *m_pPosition, fPosition);
+				ReadAttribute(pnVertex, *m_pTexCoord, fTexCoord);
+				fVarying[0] = fTexCoord[0];
+			}
+
+			virtual bool ProcessPixel(const float fVarying[], float fColor[4]) const override
+			{
+				if (fVarying[0] < 0.5f)
+					return false;
+				fColor[0] = fVarying[0];
+				fColor[1] = fColor[2] = 0.0f;
+				fColor[3] = 1.0f;
+				return true;
+			}
+
+		private:
+			const VertexBuffer::Attribute *m_pPosition;
+			const VertexBuffer::Attribute *m_pTexCoord;
+	};
+
+	TEST(DrawPrimitives_Coverage) {
+		if (Initialize()) {
+			Renderer &cRenderer = pRendererContext->GetRenderer();
+
+			// Additive blending without depth test, a pixel drawn twice gets twice the color
+			cRenderer.SetRenderState(RenderState::ZEnable,		false);
+			cRenderer.SetRenderState(RenderState::BlendEnable,	true);
+			cRenderer.SetRenderState(RenderState::SrcBlendFunc, BlendFunc::One);
+			cRenderer.SetRenderState(RenderState::DstBlendFunc, BlendFunc::One);
+			cRenderer.GetFixedFunctions()->SetColor(Color4(0.25f, 0.25f, 0.25f, 1.0f));
+
+			// Two triangles sharing the diagonal, which is crossing pixel centers
+			CHECK(DrawQuad(-1.0f, -1.0f, 1.0f, 1.0f, 0.0f));
+			ReadPixels(*pSurface->GetTextureBuffer());
+			CHECK_EQUAL(Size*Size, CountPixels(64));
+
+			// Triangle fan around an arbitrary point, every pixel must be drawn exactly once
+			static const float fFan[][5] = {
+				{  0.13f, -0.07f, 0.0f, 0.0f, 0.0f },
+				{ -1.0f,  -1.0f,  0.0f, 0.0f, 0.0f }, {  0.3f,  -1.0f,  0.0f, 0.0f, 0.0f }, {  1.0f, -1.0f,  0.0f, 0.0f, 0.0f },
+				{  1.0f,   0.4f,  0.0f, 0.0f, 0.0f }, {  1.0f,   1.0f,  0.0f, 0.0f, 0.0f }, { -0.2f,  1.0f,  0.0f, 0.0f, 0.0f },
+				{ -1.0f,   1.0f,  0.0f, 0.0f, 0.0f }, { -1.0f,  -0.35f, 0.0f, 0.0f, 0.0f }, { -1.0f, -1.0f,  0.0f, 0.0f, 0.0f }
+			};
+			cRenderer.Clear(Clear::Color);
+			CHECK(Draw(Primitive::TriangleFan, fFan, sizeof(fFan)/sizeof(fFan[0])));
+			ReadPixels(*pSurface->GetTextureBuffer());
+			CHECK_EQUAL(Size*Size, CountPixels(64));
+		}
+	}
+
+	TEST(DrawPrimitives_Culling) {
+		if (Initialize()) {
+			Renderer &cRenderer = pRendererContext->GetRenderer();
+			static const float fClockwise[][5] = {
+				{ -1.0f, -1.0f, 0.0f, 0.0f, 0.0f }, { -1.0f, 1.0f, 0.0f, 0.0f, 0.0f }, { 1.0f, -1.0f, 0.0f, 0.0f, 0.0f }
+			};
+
+			// By default, clockwise triangles are culled
+			CHECK(Draw(Primitive::TriangleList, fClockwise, 3));
+			ReadPixels(*pSurface->GetTextureBuffer());
+			CHECK_EQUAL(Size*Size, CountPixels(0));
+
+			// Without culling, the lower left half including the diagonal is drawn
+			cRenderer.SetRenderState(RenderState::CullMode, Cull::None);
+			CHECK(Draw(Primitive::TriangleList, fClockwise, 3));
+			ReadPixels(*pSurface->GetTextureBuffer());
+			CHECK_EQUAL(255, GetPixel(0, 0));
+			CHECK_EQUAL(255, GetPixel(7, 7));
+			CHECK_EQUAL(0,   GetPixel(15, 15));
+		}
+	}
+
+	TEST(DrawPrimitives_DepthTest) {
+		if (Initialize()) {
+			FixedFunctions &cFixedFunctions = *pRendererContext->GetRenderer().GetFixedFunctions();
+
+			// Red in the middle, green behind it and blue in front of the left half
+			cFixedFunctions.SetColor(Color4::Red);
+			CHECK(DrawQuad(-1.0f, -1.0f, 1.0f, 1.0f, 0.5f));
+			cFixedFunctions.SetColor(Color4::Green);
+			CHECK(DrawQuad(-1.0f, -1.0f, 1.0f, 1.0f, 0.8f));
+			cFixedFunctions.SetColor(Color4::Blue);
+			CHECK(DrawQuad(-1.0f, -1.0f, 0.0f, 1.0f, -0.5f));
+			ReadPixels(*pSurface->GetTextureBuffer());
+			for (int nY=0; nY<Size; nY++) {
+				for (int nX=0; nX<Size; nX++) {
+					CHECK_EQUAL((nX <  Size/2) ? 0 : 255, GetPixel(nX, nY, 0));
+					CHECK_EQUAL(0,						  GetPixel(nX, nY, 1));
+					CHECK_EQUAL((nX >= Size/2) ? 0 : 255, GetPixel(nX, nY, 2));
+				}
+			}
+		}
+	}
+
+	TEST(DrawPrimitives_Texture) {
+		if (Initialize()) {
+			Renderer &cRenderer = pRendererContext->GetRenderer();
+
+			// 2x2 texture, the first row is at v = 0: red, green, blue, white
+			static const uint8 nTexels[16] = { 255, 0, 0, 255,   0, 255, 0, 255,   0, 0, 255, 255,   255, 255, 255, 255 };
+			Image cImage = Image::CreateImage(DataByte, ColorRGBA, Vector3i(2, 2, 1));
+			MemoryManager::Copy(cImage.GetBuffer()->GetData(), nTexels, sizeof(nTexels));
+			TextureBuffer *pTextureBuffer = cRenderer.CreateTextureBuffer2D(cImage, TextureBuffer::Unknown, 0);
+			CHECK(pTextureBuffer);
+			if (pTextureBuffer) {
+				cRenderer.SetTextureBuffer(0, pTextureBuffer);
+				cRenderer.SetSamplerState(0, Sampler::MagFilter, TextureFiltering::Point);
+				cRenderer.SetSamplerState(0, Sampler::MinFilter, TextureFiltering::Point);
+				cRenderer.SetSamplerState(0, Sampler::MipFilter, TextureFiltering::None);
+
+				// Each texel covers a quarter of the render target
+				CHECK(DrawQuad(-1.0f, -1.0f, 1.0f, 1.0f, 0.0f));
+				ReadPixels(*pSurface->GetTextureBuffer());
+				for (int nY=0; nY<Size; nY++) {
+					for (int nX=0; nX<Size; nX++) {
+						const uint8 *pnTexel = &nTexels[((nY >= Size/2)*2 + (nX >= Size/2))*4];
+						CHECK_EQUAL(pnTexel[0], GetPixel(nX, nY, 0));
+						CHECK_EQUAL(pnTexel[1], GetPixel(nX, nY, 1));
+						CHECK_EQUAL(pnTexel[2], GetPixel(nX, nY, 2));
+					}
+				}
+
+				// Modulated with the color
+				cRenderer.GetFixedFunctions()->SetColor(Color4(0.5f, 0.5f, 0.5f, 1.0f));
+				CHECK(DrawQuad(-1.0f, -1.0f, 1.0f, 1.0f, 0.0f));
+				ReadPixels(*pSurface->GetTextureBuffer());
+				CHECK_EQUAL(128, GetPixel(0, 0, 0));
+				CHECK_EQUAL(0,	 GetPixel(0, 0, 1));
+				CHECK_EQUAL(128, GetPixel(Size - 1, Size - 1, 1));
+
+				cRenderer.SetTextureBuffer(0, nullptr);
+				delete pTextureBuffer;
+			}
+		}
+	}
+
+	TEST(DrawPrimitives_PointsAndLines) {
+		if (Initialize()) {
+			Renderer &cRenderer = pRendererContext->GetRenderer();
+
+			// Point with a size of one pixel
+			const float fPoint[1][5] = { { ToClipSpace(3), ToClipSpace(3), 0.0f, 0.0f, 0.0f } };
+			CHECK(Draw(Primitive::PointList, fPoint, 1));
+			ReadPixels(*pSurface->GetTextureBuffer());
+			CHECK_EQUAL(255, GetPixel(3, 3));
+			CHECK_EQUAL(1, CountPixels(255));
+
+			// Point with a size of three pixels
+			const float fLargePoint[1][5] = { { ToClipSpace(10), ToClipSpace(4), 0.0f, 0.0f, 0.0f } };
+			cRenderer.SetRenderState(RenderState::PointSize, Tools::FloatToUInt32(3.0f));
+			CHECK(Draw(Primitive::PointList, fLargePoint, 1));
+			ReadPixels(*pSurface->GetTextureBuffer());
+			CHECK_EQUAL(255, GetPixel(9,  3));
+			CHECK_EQUAL(255, GetPixel(11, 5));
+			CHECK_EQUAL(0,	 GetPixel(12, 4));
+			CHECK_EQUAL(0,	 GetPixel(10, 6));
+			CHECK_EQUAL(1 + 9, CountPixels(255));
+
+			// Line between pixel centers, the last pixel is not drawn
+			const float fLine[2][5] = { { ToClipSpace(2), ToClipSpace(13), 0.0f, 0.0f, 0.0f }, { ToClipSpace(12), ToClipSpace(13), 0.0f, 0.0f, 0.0f } };
+			CHECK(Draw(Primitive::LineList, fLine, 2));
+			ReadPixels(*pSurface->GetTextureBuffer());
+			for (int nX=2; nX<12; nX++)
+				CHECK_EQUAL(255, GetPixel(nX, 13));
+			CHECK_EQUAL(0, GetPixel(1,  13));
+			CHECK_EQUAL(0, GetPixel(12, 13));
+			CHECK_EQUAL(1 + 9 + 10, CountPixels(255));
+
+			// Triangle drawn with the line fill mode, the inside is not drawn
+			const float fTriangle[3][5] = {
+				{ ToClipSpace(1), ToClipSpace(6), 0.0f, 0.0f, 0.0f }, { ToClipSpace(7), ToClipSpace(6), 0.0f, 0.0f, 0.0f }, { ToClipSpace(1), ToClipSpace(12), 0.0f, 0.0f, 0.0f }
+			};
+			cRenderer.Clear(Clear::Color);
+			cRenderer.SetRenderState(RenderState::FillMode, Fill::Line);
+			CHECK(Draw(Primitive::TriangleList, fTriangle, 3));
+			ReadPixels(*pSurface->GetTextureBuffer());
+			CHECK_EQUAL(255, GetPixel(4, 6));
+			CHECK_EQUAL(255, GetPixel(1, 9));
+			CHECK_EQUAL(0,	 GetPixel(3, 8));
+		}
+	}
+
+	TEST(SetRenderTarget_TextureBuffer) {
+		if (Initialize()) {
+			Renderer &cRenderer = pRendererContext->GetRenderer();
+			Image cImage = Image::CreateImage(DataByte, ColorRGBA, Vector3i(Size, Size, 1));
+			Image cSmallImage = Image::CreateImage(DataByte, ColorRGBA, Vector3i(Size/2, Size/2, 1));
+			TextureBuffer *pColorTarget = cRenderer.CreateTextureBuffer2D(cImage, TextureBuffer::R8G8B8A8, 0);
+			TextureBuffer *pDepthTarget = cRenderer.CreateTextureBuffer2D(cImage, TextureBuffer::R8G8B8A8, 0);
+			TextureBuffer *pSmallTarget = cRenderer.CreateTextureBuffer2D(cSmallImage, TextureBuffer::R8G8B8A8, 0);
+			CHECK(pColorTarget && pDepthTarget && pSmallTarget);
+			if (pColorTarget && pDepthTarget && pSmallTarget) {
+				// The render targets must have the size of the surface
+				CHECK(!cRenderer.SetColorRenderTarget(pSmallTarget));
+				CHECK(!cRenderer.SetDepthRenderTarget(pSmallTarget));
+
+				// Draw the left half into the render targets
+				CHECK(cRenderer.SetColorRenderTarget(pColorTarget));
+				CHECK(cRenderer.SetDepthRenderTarget(pDepthTarget));
+				cRenderer.Clear(Clear::Color | Clear::ZBuffer, Color4::Black, 1.0f);
+				CHECK(DrawQuad(-1.0f, -1.0f, 0.0f, 1.0f, 0.0f));
+				CHECK(cRenderer.SetColorRenderTarget(nullptr));
+				CHECK(cRenderer.SetDepthRenderTarget(nullptr));
+
+				// The color is within the color render target
+				ReadPixels(*pColorTarget);
+				CHECK_EQUAL(255, GetPixel(2,  8));
+				CHECK_EQUAL(0,	 GetPixel(13, 8));
+
+				// The depth is within the depth render target
+				ReadPixels(*pDepthTarget);
+				CHECK_EQUAL(128, GetPixel(2,  8));
+				CHECK_EQUAL(255, GetPixel(13, 8));
+
+				// The texture buffer of the surface is untouched
+				ReadPixels(*pSurface->GetTextureBuffer());
+				CHECK_EQUAL(Size*Size, CountPixels(0));
+			}
+			delete pColorTarget;
+			delete pDepthTarget;
+			delete pSmallTarget;
+		}
+	}
+
+	TEST(DrawPrimitives_Lighting) {
+		if (Initialize()) {
+			Renderer &cRenderer = pRendererContext->GetRenderer();
+			FixedFunctions *pFixedFunctions = cRenderer.GetFixedFunctions();
+			CHECK(pFixedFunctions->GetCapabilities().nMaxActiveLights > 0);
+
+			// The vertices have no normal, so (0, 0, 1) is used like within OpenGL
+			pFixedFunctions->SetRenderState(FixedFunctions::RenderState::Lighting, true);
+			pFixedFunctions->SetRenderState(FixedFunctions::RenderState::Ambient,  Color4::ToUInt32(0.25f, 0.25f, 0.25f, 1.0f));
+			FixedFunctions::Light sLight;
+			pFixedFunctions->GetDefaultLightSettings(sLight);
+			sLight.nType	  = FixedFunctions::LightType::Directional;
+			sLight.cDiffuse	  = Color4(0.5f, 0.5f, 0.5f, 1.0f);
+			sLight.vDirection = Vector3(0.0f, 0.0f, 1.0f);
+			CHECK(pFixedFunctions->SetLight(0, sLight));
+			CHECK(pFixedFunctions->SetLightEnabled(0, true));
+			CHECK(pFixedFunctions->IsLightEnabled(0));
+
+			// Ambient plus diffuse of a light in front of the surface, the ambient color is stored with 8 bit per component
+			CHECK(DrawQuad(-1.0f, -1.0f, 1.0f, 1.0f, 0.0f));
+			ReadPixels(*pSurface->GetTextureBuffer());
+			CHECK_CLOSE(191, GetPixel(8, 8), 1);
+
+			// Only ambient of a light behind the surface
+			sLight.vDirection = Vector3(0.0f, 0.0f, -1.0f);
+			CHECK(pFixedFunctions->SetLight(0, sLight));
+			CHECK(DrawQuad(-1.0f, -1.0f, 1.0f, 1.0f, 0.0f));
+			ReadPixels(*pSurface->GetTextureBuffer());
+			CHECK_CLOSE(64, GetPixel(8, 8), 1);
+
+			// Specular is added to the ambient and diffuse color
+			sLight.vDirection = Vector3(0.0f, 0.0f, 1.0f);
+			sLight.cSpecular  = Color4(0.25f, 0.25f, 0.25f, 1.0f);
+			CHECK(pFixedFunctions->SetLight(0, sLight));
+			pFixedFunctions->SetMaterialState(FixedFunctions::MaterialState::Specular, Color4::White.ToUInt32());
+			CHECK(DrawQuad(-1.0f, -1.0f, 1.0f, 1.0f, 0.0f));
+			ReadPixels(*pSurface->GetTextureBuffer());
+			CHECK_CLOSE(255, GetPixel(8, 8), 1);
+
+			// The lighting is done per vertex, a point light close to the bottom left corner lights it more than the top right corner
+			pFixedFunctions->SetRenderState(FixedFunctions::RenderState::Ambient, 0);
+			pFixedFunctions->SetMaterialState(FixedFunctions::MaterialState::Specular, Color4::Black.ToUInt32());
+			sLight.nType	 = FixedFunctions::LightType::Point;
+			sLight.vPosition = Vector3(-1.0f, -1.0f, 0.5f);
+			CHECK(pFixedFunctions->SetLight(0, sLight));
+			CHECK(DrawQuad(-1.0f, -1.0f, 1.0f, 1.0f, 0.0f));
+			ReadPixels(*pSurface->GetTextureBuffer());
+			CHECK(GetPixel(0, 0) > GetPixel(Size - 1, Size - 1));
+			CHECK(GetPixel(Size - 1, Size - 1) > 0);
+
+			// No light at all if the light is disabled
+			CHECK(pFixedFunctions->SetLightEnabled(0, false));
+			CHECK(DrawQuad(-1.0f, -1.0f, 1.0f, 1.0f, 0.0f));
+			ReadPixels(*pSurface->GetTextureBuffer());
+			CHECK_EQUAL(Size*Size, CountPixels(0));
+		}
+	}
+
+	TEST(DrawPrimitives_TextureStages) {
+		if (Initialize()) {
+			Renderer &cRenderer = pRendererContext->GetRenderer();
+
+			// White texture at stage 0 and a gray light map at stage 1 which is modulated with the result of stage 0
+			Image cImage = Image::CreateImage(DataByte, ColorRGBA, Vector3i(1, 1, 1));
+			static const uint8 nWhite[4] = { 255, 255, 255, 255 };
+			static const uint8 nGray[4]  = { 128, 128, 128, 255 };
+			MemoryManager::Copy(cImage.GetBuffer()->GetData(), nWhite, sizeof(nWhite));
+			TextureBuffer *pTextureBuffer0 = cRenderer.CreateTextureBuffer2D(cImage, TextureBuffer::Unknown, 0);
+			MemoryManager::Copy(cImage.GetBuffer()->GetData(), nGray, sizeof(nGray));
+			TextureBuffer *pTextureBuffer1 = cRenderer.CreateTextureBuffer2D(cImage, TextureBuffer::Unknown, 0);
+			CHECK(pTextureBuffer0 && pTextureBuffer1);
+			if (pTextureBuffer0 && pTextureBuffer1) {
+				cRenderer.SetTextureBuffer(0, pTextureBuffer0);
+				cRenderer.SetTextureBuffer(1, pTextureBuffer1);
+				CHECK(DrawQuad(-1.0f, -1.0f, 1.0f, 1.0f, 0.0f));
+				ReadPixels(*pSurface->GetTextureBuffer());
+				CHECK_EQUAL(Size*Size, CountPixels(128));
+
+				// Replace ignores the result of stage 0
+				cRenderer.GetFixedFunctions()->SetColor(Color4(0.5f, 0.5f, 0.5f, 1.0f));
+				cRenderer.SetTextureBuffer(1, pTextureBuffer0);
+				cRenderer.GetFixedFunctions()->SetTextureStageState(1, FixedFunctions::TextureStage::ColorTexEnv, FixedFunctions::TextureEnvironment::Replace);
+				CHECK(DrawQuad(-1.0f, -1.0f, 1.0f, 1.0f, 0.0f));
+				ReadPixels(*pSurface->GetTextureBuffer());
+				CHECK_EQUAL(Size*Size, CountPixels(255));
+			}
+			cRenderer.SetTextureBuffer(0, nullptr);
+			cRenderer.SetTextureBuffer(1, nullptr);
+			delete pTextureBuffer0;
+			delete pTextureBuffer1;
+		}
+	}
+
+	TEST(TakeDepthBufferFromSurfaceTextureBuffer_DepthTest) {
+		if (Initialize()) {
+			Renderer &cRenderer = pRendererContext->GetRenderer();
+			SurfaceTextureBuffer *pOtherSurface = cRenderer.CreateSurfaceTextureBuffer2D(Vector2i(Size, Size), TextureBuffer::R8G8B8A8, SurfaceTextureBuffer::Depth);
+			CHECK(pOtherSurface);
+			if (pOtherSurface) {
+				// Fill the depth buffer of the left half
+				CHECK(DrawQuad(-1.0f, -1.0f, 0.0f, 1.0f, 0.0f));
+
+				// The other surface is using the filled depth buffer, so the left half fails the depth test
+				pOtherSurface->TakeDepthBufferFromSurfaceTextureBuffer(*pSurface);
+				cRenderer.SetRenderTarget(pOtherSurface);
+				cRenderer.Clear(Clear::Color, Color4::Black);
+				CHECK(DrawQuad(-1.0f, -1.0f, 1.0f, 1.0f, 0.5f));
+				ReadPixels(*pOtherSurface->GetTextureBuffer());
+				CHECK_EQUAL(0,	 GetPixel(2,  8));
+				CHECK_EQUAL(255, GetPixel(13, 8));
+
+				// Give the depth buffer back
+				cRenderer.SetRenderTarget(pSurface);
+				pSurface->TakeDepthBufferFromSurfaceTextureBuffer(*pOtherSurface);
+				delete pOtherSurface;
+			}
+		}
+	}
+
+	TEST(DrawPatches_NotSupported) {
+		if (Initialize()) {
+			// There's no tessellation support, so drawing patches must fail
+			Renderer &cRenderer = pRendererContext->GetRenderer();
+			CHECK(!cRenderer.DrawPatches(3, 0, 3));
+			CHECK(!cRenderer.DrawPatchesInstanced(3, 0, 3, 2));
+		}
+	}
+
+	TEST(SetShader_Custom) {
+		if (Initialize()) {
+			PLRendererSoftware::Renderer &cRenderer = static_cast<PLRendererSoftware::Renderer&>(pRendererContext->GetRenderer());
+			TestShader cShader;
+			cRenderer.SetShader(&cShader);
+			CHECK(cRenderer.GetShader() == &cShader);
+
+			// The left half is discarded, the red color of the right half is the interpolated texture coordinate
+			CHECK(DrawQuad(-1.0f, -1.0f, 1.0f, 1.0f, 0.0f));
+			ReadPixels(*pSurface->GetTextureBuffer());
+			for (int nX=0; nX<Size; nX++) {
+				const int nRed = (nX < Size/2) ? 0 : static_cast<int>((nX + 0.5f)/Size*255.0f + 0.5f);
+				CHECK_CLOSE(nRed, GetPixel(nX, 5), 1);
+			}
+
+			// Back to the fixed functions pipeline
+			cRenderer.SetShader(nullptr);
+			CHECK(!cRenderer.GetShader());
+			CHECK(DrawQuad(-1.0f, -1.0f, 1.0f, 1.0f, 0.0f));
+			ReadPixels(*pSurface->GetTextureBuffer());
+			CHECK_EQUAL(Size*Size, CountPixels(255));
+		}
+	}
+}
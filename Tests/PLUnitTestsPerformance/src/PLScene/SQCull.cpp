@@ -0,0 +1,233 @@
+/*********************************************************\
+ *  File: SQCull.cpp                                     *
+ *
+ *  Copyright (C) 2002-2013 The PixelLight Team (http://www.pixellight.org/)
+ *
+ *  This file is part of PixelLight.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ *  and associated documentation files (the "Software"), to deal in the Software without
+ *  restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ *  Software is furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all copies or
+ *  substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ *  BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ *  DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ *  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include <UnitTest++/UnitTest++.h>
+#include <PLCore/Runtime.h>
+#include <PLCore/System/System.h>
+#include <PLCore/System/JobSystem.h>
+#include <PLCore/Container/Array.h>
+#include <PLMath/Math.h>
+#include <PLMath/Frustum.h>
+#include <PLRenderer/RendererContext.h>
+#include <PLScene/Scene/SceneContext.h>
+#include <PLScene/Scene/SceneContainer.h>
+#include <PLScene/Scene/SceneHierarchy.h>
+#include <PLScene/Scene/SceneHierarchyNode.h>
+#include <PLScene/Visibility/SQCull.h>
+#include <PLScene/Visibility/VisContainer.h>
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+using namespace std;
+using namespace PLCore;
+using namespace PLMath;
+using namespace PLRenderer;
+using namespace PLScene;
+
+
+//[-------------------------------------------------------]
+//[ Global variables                                      ]
+//[-------------------------------------------------------]
+extern ofstream outputFile;
+
+
+/*
+* Naming Convention for SUITE:
+* CLASSNAME
+*/
+SUITE(SQCull_Performance) {
+	/*
+	* Naming Convention for METHOD:
+	* METHODNAME_SCENARIO
+	*/
+	// general objects for testing
+	const uint32 NumOfSceneNodes = 100000;	// number of scene nodes within the scene container
+	const uint32 NumOfCameras    = 16;		// number of different camera orientations per iteration
+	const uint32 TestLoops       = 10;		// number of iterations
+	const float  WorldSize       = 1000.0f;	// scene nodes are placed within [0, WorldSize]
+	RendererContext *pRendererContext = nullptr;
+	SceneContext	*pSceneContext	  = nullptr;
+	SceneContainer	*pContainer		  = nullptr;
+	bool			 bInitialized	  = false;
+
+	// Creates the renderer, the scene context and the scene container, returns 'false' if the null renderer is not available
+	bool Initialize()
+	{
+		if (!bInitialized) {
+			bInitialized = true;
+
+			// Create the null renderer
+			Runtime::ScanDirectoryPlugins();
+			pRendererContext = RendererContext::CreateInstance("PLRendererNull::Renderer", NULL_HANDLE);
+			if (pRendererContext) {
+				pSceneContext = new SceneContext(*pRendererContext);
+
+				// Create the scene container and fill it with randomly placed scene nodes, use always the same scene nodes
+				pContainer = static_cast<SceneContainer*>(pSceneContext->GetRoot()->Create("PLScene::SceneContainer", "", "Hierarchy=\"PLScene::SHKdTree\""));
+				pContainer->SetAABBMin(Vector3::Zero);
+				pContainer->SetAABBMax(Vector3(WorldSize, WorldSize, WorldSize));
+				srand(0);
+				for (uint32 i=0; i<NumOfSceneNodes; i++) {
+					SceneNode *pSceneNode = pContainer->Create("PLScene::SNHelper");
+					pSceneNode->SetPosition(Vector3(Math::GetRandFloat()*WorldSize, Math::GetRandFloat()*WorldSize, Math::GetRandFloat()*WorldSize));
+					const float fSize = 0.5f + Math::GetRandFloat()*2.0f;
+					pSceneNode->SetAABoundingBox(AABoundingBox(-fSize, -fSize, -fSize, fSize, fSize, fSize));
+				}
+
+				// Build the hierarchy right now so that this is not part of the measured culling
+				pContainer->GetHierarchyInstance()->GetRootNode().Touch(true);
+			} else {
+				outputFile << "SQCull_Performance: The renderer \"PLRendererNull::Renderer\" is not available, skipping the tests" << endl;
+			}
+		}
+		return (pRendererContext != nullptr);
+	}
+
+	// Creates a cull query using the given cull mode, the camera is placed in the middle of the world
+	SQCull *CreateCullQuery(SQCull::EMode nMode)
+	{
+		SQCull *pCullQuery = static_cast<SQCull*>(pContainer->CreateQuery("PLScene::SQCull"));
+		if (pCullQuery) {
+			pCullQuery->SetMode(nMode);
+			pCullQuery->SetFlags(0);
+
+			// Setup the camera
+			Matrix4x4 mProjection;
+			mProjection.PerspectiveFov(static_cast<float>(60.0f*Math::DegToRad), 4.0f/3.0f, 0.1f, WorldSize);
+			pCullQuery->SetCameraContainer(nullptr);
+			pCullQuery->SetCameraPosition(Vector3(WorldSize*0.5f, WorldSize*0.5f, WorldSize*0.5f));
+			pCullQuery->SetProjectionMatrix(mProjection);
+		}
+		return pCullQuery;
+	}
+
+	// Rotates the camera of the given cull query to the given camera orientation and performs the visibility determination
+	void PerformQuery(SQCull &cCullQuery, uint32 nCamera)
+	{
+		const Vector3 &vCameraPosition = cCullQuery.GetCameraPosition();
+		const float fAngle = static_cast<float>(Math::Pi2*nCamera/NumOfCameras);
+		Matrix4x4 mView;
+		mView.LookAt(vCameraPosition, vCameraPosition + Vector3(Math::Sin(fAngle), 0.0f, Math::Cos(fAngle)), Vector3::UnitY);
+		const Matrix4x4 mViewProjection = cCullQuery.GetProjectionMatrix()*mView;
+		Frustum cFrustum;
+		cFrustum.CreateViewPlanes(mViewProjection, false);
+		cCullQuery.SetViewFrustum(cFrustum);
+		cCullQuery.SetViewMatrix(mView);
+		cCullQuery.SetViewProjectionMatrix(mViewProjection);
+		cCullQuery.PerformQuery();
+	}
+
+	// Returns the visible scene nodes of the given cull query in the order they were added to the visibility container
+	void GetVisibleSceneNodes(const SQCull &cCullQuery, Array<const SceneNode*> &lstSceneNodes)
+	{
+		lstSceneNodes.Clear();
+		Iterator<VisNode*> cIterator = cCullQuery.GetVisContainer().GetVisNodes().GetIterator();
+		while (cIterator.HasNext())
+			lstSceneNodes.Add(cIterator.Next()->GetSceneNode());
+	}
+
+	// Checks whether or not the parallel frustum culling is producing the same visible scene nodes as the frustum culling
+	void CheckParallelFrustum(uint32 nNumOfWorkers)
+	{
+		if (Initialize()) {
+			JobSystem::GetInstance()->SetNumOfWorkers(nNumOfWorkers);
+			SQCull *pFrustumQuery		  = CreateCullQuery(SQCull::Frustum);
+			SQCull *pParallelFrustumQuery = CreateCullQuery(SQCull::ParallelFrustum);
+			CHECK(pFrustumQuery && pParallelFrustumQuery);
+			if (pFrustumQuery && pParallelFrustumQuery) {
+				Array<const SceneNode*> lstExpected, lstResult;
+				for (uint32 nCamera=0; nCamera<NumOfCameras; nCamera++) {
+					PerformQuery(*pFrustumQuery, nCamera);
+					PerformQuery(*pParallelFrustumQuery, nCamera);
+					GetVisibleSceneNodes(*pFrustumQuery, lstExpected);
+					GetVisibleSceneNodes(*pParallelFrustumQuery, lstResult);
+
+					// The camera is within a densely filled world, so there must be something visible
+					CHECK(lstExpected.GetNumOfElements() > 0);
+
+					// Same scene nodes in the same order
+					CHECK_EQUAL(lstExpected.GetNumOfElements(), lstResult.GetNumOfElements());
+					if (lstExpected.GetNumOfElements() == lstResult.GetNumOfElements()) {
+						uint32 nMismatches = 0;
+						for (uint32 i=0; i<lstExpected.GetNumOfElements(); i++) {
+							if (lstExpected[i] != lstResult[i])
+								nMismatches++;
+						}
+						CHECK_EQUAL(0U, nMismatches);
+					}
+				}
+			}
+
+			// Cleanup
+			if (pFrustumQuery)
+				pContainer->DestroyQuery(*pFrustumQuery);
+			if (pParallelFrustumQuery)
+				pContainer->DestroyQuery(*pParallelFrustumQuery);
+		}
+	}
+
+	// Culls the scene container using the given cull mode and number of worker threads, the camera is rotating in the middle of the world
+	void Cull(SQCull::EMode nMode, uint32 nNumOfWorkers)
+	{
+		if (Initialize()) {
+			JobSystem::GetInstance()->SetNumOfWorkers(nNumOfWorkers);
+			SQCull *pCullQuery = CreateCullQuery(nMode);
+			if (pCullQuery) {
+				// Perform the visibility determination
+				for (uint32 nLoop=0; nLoop<TestLoops; nLoop++) {
+					for (uint32 nCamera=0; nCamera<NumOfCameras; nCamera++)
+						PerformQuery(*pCullQuery, nCamera);
+				}
+
+				// Cleanup
+				pContainer->DestroyQuery(*pCullQuery);
+			}
+		}
+	}
+
+	TEST(Frustum){
+		Cull(SQCull::Frustum, 0);
+	}
+
+	TEST(ParallelFrustum_0_Workers){
+		Cull(SQCull::ParallelFrustum, 0);
+	}
+
+	TEST(ParallelFrustum_CPU_Workers){
+		Cull(SQCull::ParallelFrustum, System::GetInstance()->GetNumOfCPUs() - 1);
+	}
+
+	TEST(ParallelFrustum_SameResult_0_Workers){
+		CheckParallelFrustum(0);
+	}
+
+	TEST(ParallelFrustum_SameResult_CPU_Workers){
+		CheckParallelFrustum(Math::Max(System::GetInstance()->GetNumOfCPUs(), 2U) - 1);
+	}
+}
@@ -0,0 +1,260 @@
+/*********************************************************\
+ *  File: SceneHierarchy.cpp                             *
+ *
+ *  Copyright (C) 2002-2013 The PixelLight Team (http://www.pixellight.org/)
+ *
+ *  This file is part of PixelLight.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ *  and associated documentation files (the "Software"), to deal in the Software without
+ *  restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ *  Software is furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all copies or
+ *  substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ *  BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ *  DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ *  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include <UnitTest++/UnitTest++.h>
+#include <PLCore/Runtime.h>
+#include <PLCore/Container/Array.h>
+#include <PLCore/Container/Bitset.h>
+#include <PLCore/Base/Event/EventHandler.h>
+#include <PLMath/Math.h>
+#include <PLRenderer/RendererContext.h>
+#include <PLScene/Scene/SceneContext.h>
+#include <PLScene/Scene/SceneContainer.h>
+#include <PLScene/Scene/SceneHierarchy.h>
+#include <PLScene/Scene/SceneHierarchyNode.h>
+#include <PLScene/Scene/SceneQueries/SQLine.h>
+#include <PLScene/Scene/SceneQueries/SQSphere.h>
+#include <PLScene/Scene/SceneQueries/SQAABoundingBox.h>
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+using namespace std;
+using namespace PLCore;
+using namespace PLMath;
+using namespace PLRenderer;
+using namespace PLScene;
+
+
+//[-------------------------------------------------------]
+//[ Global variables                                      ]
+//[-------------------------------------------------------]
+extern ofstream outputFile;
+
+
+/*
+* Naming Convention for SUITE:
+* CLASSNAME
+*/
+SUITE(SceneHierarchy_Performance) {
+	/*
+	* Naming Convention for METHOD:
+	* METHODNAME_SCENARIO
+	*/
+	// general objects for testing
+	const uint32 NumOfSceneNodes = 100000;	// number of scene nodes within each scene container
+	const uint32 NumOfQueries    = 1000;	// number of queries per test
+	const float  WorldSize       = 1000.0f;	// scene nodes are placed within [0, WorldSize]
+	RendererContext *pRendererContext = nullptr;
+	SceneContext	*pSceneContext	  = nullptr;
+	SceneContainer	*pKdTree		  = nullptr;	// scene container using "PLScene::SHKdTree"
+	SceneContainer	*pFlatKdTree	  = nullptr;	// scene container using "PLScene::SHFlatKdTree"
+	bool			 bInitialized	  = false;
+	Array<uint32>	*pFoundSceneNodes = nullptr;	// receives the indices of the scene nodes found by a query, can be a null pointer
+
+	// Creates a scene container using the given hierarchy and fills it with randomly placed scene nodes
+	SceneContainer *CreateContainer(const String &sHierarchy)
+	{
+		SceneContainer *pContainer = static_cast<SceneContainer*>(pSceneContext->GetRoot()->Create("PLScene::SceneContainer", "", "Hierarchy=\"" + sHierarchy + '\"'));
+		pContainer->SetAABBMin(Vector3::Zero);
+		pContainer->SetAABBMax(Vector3(WorldSize, WorldSize, WorldSize));
+
+		// Use always the same scene nodes, the name is "Node<index>" so that the scene nodes of different scene containers can be compared
+		srand(0);
+		for (uint32 i=0; i<NumOfSceneNodes; i++) {
+			SceneNode *pSceneNode = pContainer->Create("PLScene::SNHelper", String::Format("Node%d", i));
+			pSceneNode->SetPosition(Vector3(Math::GetRandFloat()*WorldSize, Math::GetRandFloat()*WorldSize, Math::GetRandFloat()*WorldSize));
+			const float fSize = 0.5f + Math::GetRandFloat()*2.0f;
+			pSceneNode->SetAABoundingBox(AABoundingBox(-fSize, -fSize, -fSize, fSize, fSize, fSize));
+		}
+
+		// Build the hierarchy right now so that this is not part of the measured queries
+		pContainer->GetHierarchyInstance()->GetRootNode().Touch(true);
+
+		// Done
+		return pContainer;
+	}
+
+	// Creates the renderer, the scene context and the scene containers, returns 'false' if the null renderer is not available
+	bool Initialize()
+	{
+		if (!bInitialized) {
+			bInitialized = true;
+
+			// Create the null renderer
+			Runtime::ScanDirectoryPlugins();
+			pRendererContext = RendererContext::CreateInstance("PLRendererNull::Renderer", NULL_HANDLE);
+			if (pRendererContext) {
+				pSceneContext = new SceneContext(*pRendererContext);
+
+				// Create the scene containers
+				pKdTree     = CreateContainer("PLScene::SHKdTree");
+				pFlatKdTree = CreateContainer("PLScene::SHFlatKdTree");
+			} else {
+				outputFile << "SceneHierarchy_Performance: The renderer \"PLRendererNull::Renderer\" is not available, skipping the tests" << endl;
+			}
+		}
+		return (pRendererContext != nullptr);
+	}
+
+	// Called by a scene query when a scene node was found, adds the index of the scene node to the current list of found scene nodes
+	void OnSceneNode(SceneQuery &cQuery, SceneNode &cSceneNode)
+	{
+		if (pFoundSceneNodes)
+			pFoundSceneNodes->Add(cSceneNode.GetName().GetSubstring(4).GetUInt32());
+	}
+
+	// Sets up the given axis aligned bounding box query, the query parameters only depend on the given query index
+	void SetupAABoundingBox(SceneQuery &cQuery, uint32 nQuery)
+	{
+		srand(1 + nQuery*3);
+		const Vector3 vPos(Math::GetRandFloat()*WorldSize, Math::GetRandFloat()*WorldSize, Math::GetRandFloat()*WorldSize);
+		static_cast<SQAABoundingBox&>(cQuery).GetAABoundingBox() = AABoundingBox(vPos, vPos + Vector3(25.0f, 25.0f, 25.0f));
+	}
+
+	// Sets up the given sphere query, the query parameters only depend on the given query index
+	void SetupSphere(SceneQuery &cQuery, uint32 nQuery)
+	{
+		srand(2 + nQuery*3);
+		SQSphere &cSphereQuery = static_cast<SQSphere&>(cQuery);
+		cSphereQuery.GetSphere().SetPos(Math::GetRandFloat()*WorldSize, Math::GetRandFloat()*WorldSize, Math::GetRandFloat()*WorldSize);
+		cSphereQuery.GetSphere().SetRadius(20.0f);
+	}
+
+	// Sets up the given line (ray) query through the whole scene container, the query parameters only depend on the given query index
+	void SetupLine(SceneQuery &cQuery, uint32 nQuery)
+	{
+		srand(3 + nQuery*3);
+		static_cast<SQLine&>(cQuery).GetLine().Set(Vector3(Math::GetRandFloat()*WorldSize, Math::GetRandFloat()*WorldSize, 0.0f),
+												   Vector3(Math::GetRandFloat()*WorldSize, Math::GetRandFloat()*WorldSize, WorldSize));
+	}
+
+	// Performs queries of the given class within the given scene container
+	void Query(SceneContainer &cContainer, const String &sQuery, void (*pSetup)(SceneQuery&, uint32))
+	{
+		SceneQuery *pQuery = cContainer.CreateQuery(sQuery);
+		for (uint32 i=0; i<NumOfQueries; i++) {
+			pSetup(*pQuery, i);
+			pQuery->PerformQuery();
+		}
+		cContainer.DestroyQuery(*pQuery);
+	}
+
+	// Returns the number of scene nodes within the first list which are not within the second list
+	uint32 GetNumOfMissingSceneNodes(const Array<uint32> &lstFirst, const Array<uint32> &lstSecond)
+	{
+		Bitset lstSecondSet;
+		lstSecondSet.Resize(NumOfSceneNodes, true, true);
+		for (uint32 i=0; i<lstSecond.GetNumOfElements(); i++)
+			lstSecondSet.Set(lstSecond[i]);
+		uint32 nMissing = 0;
+		for (uint32 i=0; i<lstFirst.GetNumOfElements(); i++) {
+			if (!lstSecondSet.IsSet(lstFirst[i]))
+				nMissing++;
+		}
+		return nMissing;
+	}
+
+	// Checks whether or not the queries of the given class find the same scene nodes within the flat kd tree as within the kd tree
+	void CheckQuery(const String &sQuery, void (*pSetup)(SceneQuery&, uint32))
+	{
+		if (Initialize()) {
+			EventHandler<SceneQuery&, SceneNode&> cEventHandler(&OnSceneNode);
+			SceneQuery *pKdTreeQuery	 = pKdTree    ->CreateQuery(sQuery);
+			SceneQuery *pFlatKdTreeQuery = pFlatKdTree->CreateQuery(sQuery);
+			pKdTreeQuery    ->SignalSceneNode.Connect(cEventHandler);
+			pFlatKdTreeQuery->SignalSceneNode.Connect(cEventHandler);
+			Array<uint32> lstExpected, lstResult;
+			uint32 nNumOfFound = 0, nNumOfMissing = 0, nNumOfUnexpected = 0;
+			for (uint32 i=0; i<NumOfQueries/10; i++) {
+				// Perform the same query within both scene containers
+				lstExpected.Reset();
+				pFoundSceneNodes = &lstExpected;
+				pSetup(*pKdTreeQuery, i);
+				pKdTreeQuery->PerformQuery();
+				lstResult.Reset();
+				pFoundSceneNodes = &lstResult;
+				pSetup(*pFlatKdTreeQuery, i);
+				pFlatKdTreeQuery->PerformQuery();
+				pFoundSceneNodes = nullptr;
+
+				// Compare the found scene nodes, the order is not relevant
+				nNumOfFound		 += lstExpected.GetNumOfElements();
+				nNumOfMissing	 += GetNumOfMissingSceneNodes(lstExpected, lstResult);
+				nNumOfUnexpected += GetNumOfMissingSceneNodes(lstResult, lstExpected);
+			}
+			CHECK(nNumOfFound > 0);
+			CHECK_EQUAL(0U, nNumOfMissing);
+			CHECK_EQUAL(0U, nNumOfUnexpected);
+			pKdTree    ->DestroyQuery(*pKdTreeQuery);
+			pFlatKdTree->DestroyQuery(*pFlatKdTreeQuery);
+		}
+	}
+
+	TEST(SHFlatKdTree_SameResult_QueryAABoundingBox){
+		CheckQuery("PLScene::SQAABoundingBox", &SetupAABoundingBox);
+	}
+
+	TEST(SHFlatKdTree_SameResult_QuerySphere){
+		CheckQuery("PLScene::SQSphere", &SetupSphere);
+	}
+
+	TEST(SHFlatKdTree_SameResult_QueryLine){
+		CheckQuery("PLScene::SQLine", &SetupLine);
+	}
+
+	TEST(SHKdTree_QueryAABoundingBox){
+		if (Initialize())
+			Query(*pKdTree, "PLScene::SQAABoundingBox", &SetupAABoundingBox);
+	}
+
+	TEST(SHFlatKdTree_QueryAABoundingBox){
+		if (Initialize())
+			Query(*pFlatKdTree, "PLScene::SQAABoundingBox", &SetupAABoundingBox);
+	}
+
+	TEST(SHKdTree_QuerySphere){
+		if (Initialize())
+			Query(*pKdTree, "PLScene::SQSphere", &SetupSphere);
+	}
+
+	TEST(SHFlatKdTree_QuerySphere){
+		if (Initialize())
+			Query(*pFlatKdTree, "PLScene::SQSphere", &SetupSphere);
+	}
+
+	TEST(SHKdTree_QueryLine){
+		if (Initialize())
+			Query(*pKdTree, "PLScene::SQLine", &SetupLine);
+	}
+
+	TEST(SHFlatKdTree_QueryLine){
+		if (Initialize())
+			Query(*pFlatKdTree, "PLScene::SQLine", &SetupLine);
+	}
+}
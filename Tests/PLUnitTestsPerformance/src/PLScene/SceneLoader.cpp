@@ -0,0 +1,114 @@
+/*********************************************************\
+ *  File: SceneLoader.cpp                                *
+ *
+ *  Copyright (C) 2002-2013 The PixelLight Team (http://www.pixellight.org/)
+ *
+ *  This file is part of PixelLight.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ *  and associated documentation files (the "Software"), to deal in the Software without
+ *  restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ *  Software is furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all copies or
+ *  substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ *  BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ *  DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ *  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include <UnitTest++/UnitTest++.h>
+#include <PLCore/Runtime.h>
+#include <PLCore/File/File.h>
+#include <PLMath/Math.h>
+#include <PLRenderer/RendererContext.h>
+#include <PLScene/Scene/SceneContext.h>
+#include <PLScene/Scene/SceneContainer.h>
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+using namespace std;
+using namespace PLCore;
+using namespace PLMath;
+using namespace PLRenderer;
+using namespace PLScene;
+
+
+//[-------------------------------------------------------]
+//[ Global variables                                      ]
+//[-------------------------------------------------------]
+extern ofstream outputFile;
+
+
+/*
+* Naming Convention for SUITE:
+* CLASSNAME
+*/
+SUITE(SceneLoader_Performance) {
+	/*
+	* Naming Convention for METHOD:
+	* METHODNAME_SCENARIO
+	*/
+	// general objects for testing
+	const uint32 NumOfSceneNodes = 10000;	// number of scene nodes within the scene
+	const uint32 TestLoops       = 5;		// number of iterations
+	const float  WorldSize       = 1000.0f;	// scene nodes are placed within [0, WorldSize]
+	const String Filename        = "PLUnitTestsPerformance_SceneLoader.scene";
+	RendererContext *pRendererContext = nullptr;
+	SceneContext	*pSceneContext	  = nullptr;
+	SceneContainer	*pContainer		  = nullptr;	// scene container the scene is created in, saved and loaded into
+	bool			 bInitialized	  = false;
+
+	// Creates the renderer, the scene context and the scene container with the scene to save, returns 'false' if the null renderer is not available
+	bool Initialize()
+	{
+		if (!bInitialized) {
+			bInitialized = true;
+
+			// Create the null renderer
+			Runtime::ScanDirectoryPlugins();
+			pRendererContext = RendererContext::CreateInstance("PLRendererNull::Renderer", NULL_HANDLE);
+			if (pRendererContext) {
+				pSceneContext = new SceneContext(*pRendererContext);
+				pContainer = static_cast<SceneContainer*>(pSceneContext->GetRoot()->Create("PLScene::SceneContainer"));
+
+				// Fill the scene container with randomly placed scene nodes, each with a modifier, use always the same scene nodes
+				srand(0);
+				for (uint32 i=0; i<NumOfSceneNodes; i++) {
+					SceneNode *pSceneNode = pContainer->Create("PLScene::SNHelper", String("Node") + i);
+					pSceneNode->SetPosition(Vector3(Math::GetRandFloat()*WorldSize, Math::GetRandFloat()*WorldSize, Math::GetRandFloat()*WorldSize));
+					pSceneNode->AddModifier("PLScene::SNMRotationLinearAnimation", "Velocity=\"0 20 0\"");
+				}
+			} else {
+				outputFile << "SceneLoader_Performance: The renderer \"PLRendererNull::Renderer\" is not available, skipping the tests" << endl;
+			}
+		}
+		return (pRendererContext != nullptr);
+	}
+
+	TEST(SceneLoaderPL_Save){
+		if (Initialize()) {
+			for (uint32 nLoop=0; nLoop<TestLoops; nLoop++)
+				pContainer->SaveByFilename(Filename);
+		}
+	}
+
+	TEST(SceneLoaderPL_Load){
+		if (Initialize()) {
+			// Load the scene saved by the previous test, the previous content of the scene container is removed automatically
+			for (uint32 nLoop=0; nLoop<TestLoops; nLoop++)
+				pContainer->LoadByFilename(Filename);
+			File(Filename).Delete();
+		}
+	}
+}
@@ -0,0 +1,403 @@
+/*********************************************************\
+ *  File: BrickedVolume.cpp                              *
+ *
+ *  Copyright (C) 2002-2013 The PixelLight Team (http://www.pixellight.org/)
+ *
+ *  This file is part of PixelLight.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ *  and associated documentation files (the "Software"), to deal in the Software without
+ *  restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ *  Software is furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all copies or
+ *  substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ *  BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ *  DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ *  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include <UnitTest++/UnitTest++.h>
+#include <PLCore/File/File.h>
+#include <PLVolume/BrickedVolume.h>
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+using namespace PLCore;
+using namespace PLMath;
+using namespace PLVolume;
+
+
+/*
+* Naming Convention for SUITE:
+* CLASSNAME
+*/
+SUITE(BrickedVolume) {
+	/*
+	* Naming Convention for METHOD:
+	* METHODNAME_SCENARIO
+	*/
+	// general objects for testing
+	const String   Filename	 = "PLUnitTestsPerformance_BrickedVolume.bricks";
+	const Vector3i Size(37, 20, 18);	// number of voxels, not a multiple of the brick size so the padding of the border bricks is covered as well
+	const uint32   BrickSize = 8;		// number of voxels along each brick axis, results in 4 resolution levels
+
+	// Returns the voxel value of the original resolution
+	uint16 GetSourceVoxel(int x, int y, int z)
+	{
+		return static_cast<uint16>((x*7 + y*131 + z*1009) & 0xFFFF);
+	}
+
+	// Voxels of all resolution levels as the bricked volume should deliver them
+	struct Reference {
+		Vector3i  vSize[4];
+		uint16	 *pnVoxels[4];
+
+		Reference()
+		{
+			// Original resolution
+			vSize[0]	= Size;
+			pnVoxels[0] = new uint16[Size.x*Size.y*Size.z];
+			for (int z=0; z<Size.z; z++) {
+				for (int y=0; y<Size.y; y++) {
+					for (int x=0; x<Size.x; x++)
+						pnVoxels[0][(z*Size.y + y)*Size.x + x] = GetSourceVoxel(x, y, z);
+				}
+			}
+
+			// Each further resolution level averages 2x2x2 voxels of the previous level, the border voxels are repeated
+			for (int nLevel=1; nLevel<4; nLevel++) {
+				const Vector3i &vPrevious = vSize[nLevel - 1];
+				vSize[nLevel].x = (vPrevious.x + 1)/2;
+				vSize[nLevel].y = (vPrevious.y + 1)/2;
+				vSize[nLevel].z = (vPrevious.z + 1)/2;
+				const Vector3i &vLevel = vSize[nLevel];
+				pnVoxels[nLevel] = new uint16[vLevel.x*vLevel.y*vLevel.z];
+				for (int z=0; z<vLevel.z; z++) {
+					for (int y=0; y<vLevel.y; y++) {
+						for (int x=0; x<vLevel.x; x++) {
+							uint32 nSum = 0;
+							for (int i=0; i<8; i++)
+								nSum += GetVoxel(nLevel - 1, x*2 + (i & 1), y*2 + ((i >> 1) & 1), z*2 + (i >> 2));
+							pnVoxels[nLevel][(z*vLevel.y + y)*vLevel.x + x] = static_cast<uint16>((nSum + 4)/8);
+						}
+					}
+				}
+			}
+		}
+
+		~Reference()
+		{
+			for (int nLevel=0; nLevel<4; nLevel++)
+				delete [] pnVoxels[nLevel];
+		}
+
+		// Returns a voxel, positions outside the resolution level are clamped to the border
+		uint16 GetVoxel(int nLevel, int x, int y, int z) const
+		{
+			const Vector3i &vLevel = vSize[nLevel];
+			x = (x < vLevel.x) ? x : vLevel.x - 1;
+			y = (y < vLevel.y) ? y : vLevel.y - 1;
+			z = (z < vLevel.z) ? z : vLevel.z - 1;
+			return pnVoxels[nLevel][(z*vLevel.y + y)*vLevel.x + x];
+		}
+
+		// Returns whether or not the given brick data including the padding is correct
+		bool CheckBrick(int nLevel, const Vector3i &vBrick, const uint8 *pnBrick) const
+		{
+			if (!pnBrick)
+				return false;
+			const uint16 *pnBrickVoxels = reinterpret_cast<const uint16*>(pnBrick);
+			const int nSize = static_cast<int>(BrickSize);
+			for (int z=0; z<nSize; z++) {
+				for (int y=0; y<nSize; y++) {
+					for (int x=0; x<nSize; x++) {
+						if (pnBrickVoxels[(z*nSize + y)*nSize + x] != GetVoxel(nLevel, vBrick.x*nSize + x, vBrick.y*nSize + y, vBrick.z*nSize + z))
+							return false;
+					}
+				}
+			}
+			return true;
+		}
+
+		// Returns whether or not the given brick range is correct
+		bool CheckBrickRange(int nLevel, const Vector3i &vBrick, uint32 nMinimum, uint32 nMaximum) const
+		{
+			uint32 nReferenceMinimum = 0xFFFF, nReferenceMaximum = 0;
+			const int nSize = static_cast<int>(BrickSize);
+			for (int z=0; z<nSize; z++) {
+				for (int y=0; y<nSize; y++) {
+					for (int x=0; x<nSize; x++) {
+						const uint32 nVoxel = GetVoxel(nLevel, vBrick.x*nSize + x, vBrick.y*nSize + y, vBrick.z*nSize + z);
+						if (nReferenceMinimum > nVoxel)
+							nReferenceMinimum = nVoxel;
+						if (nReferenceMaximum < nVoxel)
+							nReferenceMaximum = nVoxel;
+					}
+				}
+			}
+			return (nMinimum == nReferenceMinimum && nMaximum == nReferenceMaximum);
+		}
+	};
+
+	// Returns the position of a brick of a resolution level by using its index, the bricks are ordered along x first
+	Vector3i GetBrickPosition(const Vector3i &vNumOfBricks, uint32 nBrick)
+	{
+		return Vector3i(nBrick%vNumOfBricks.x, (nBrick/vNumOfBricks.x)%vNumOfBricks.y, nBrick/(vNumOfBricks.x*vNumOfBricks.y));
+	}
+
+	// Builds the brick files slice by slice
+	bool Create(BrickedVolume &cBrickedVolume)
+	{
+		uint16 *pnSlice = new uint16[Size.x*Size.y];
+		bool bResult = cBrickedVolume.Create(Filename, Size, 2, BrickSize);
+		for (int z=0; z<Size.z && bResult; z++) {
+			for (int y=0; y<Size.y; y++) {
+				for (int x=0; x<Size.x; x++)
+					pnSlice[y*Size.x + x] = GetSourceVoxel(x, y, z);
+			}
+			bResult = cBrickedVolume.AddSlices(reinterpret_cast<const uint8*>(pnSlice), 1);
+		}
+		delete [] pnSlice;
+		return (bResult && cBrickedVolume.Finish());
+	}
+
+	// Reads a complete file into memory, returns the number of bytes
+	uint32 ReadFile(const String &sFilename, uint8 **ppnData)
+	{
+		File cFile(sFilename);
+		*ppnData = nullptr;
+		if (cFile.Open(File::FileRead)) {
+			const uint32 nSize = cFile.GetSize();
+			*ppnData = new uint8[nSize];
+			const uint32 nRead = cFile.Read(*ppnData, 1, nSize);
+			cFile.Close();
+			return nRead;
+		}
+		return 0;
+	}
+
+	// Overwrites a complete file
+	bool WriteFile(const String &sFilename, const uint8 *pnData, uint32 nSize)
+	{
+		File cFile(sFilename);
+		if (cFile.Open(File::FileCreate | File::FileWrite)) {
+			const bool bResult = (cFile.Write(pnData, 1, nSize) == nSize);
+			cFile.Close();
+			return bResult;
+		}
+		return false;
+	}
+
+	TEST(GetBrick_Addressing) {
+		const Reference cReference;
+		BrickedVolume cBrickedVolume;
+		CHECK(Create(cBrickedVolume));
+		CHECK(cBrickedVolume.IsOpen());
+		CHECK_EQUAL(4U, cBrickedVolume.GetNumOfLevels());
+		if (cBrickedVolume.GetNumOfLevels() == 4) {
+			for (uint32 nLevel=0; nLevel<4; nLevel++) {
+				// Resolution level and number of bricks
+				const Vector3i &vLevelSize = cBrickedVolume.GetLevelSize(nLevel);
+				const Vector3i &vNumOfBricks = cBrickedVolume.GetNumOfBricks(nLevel);
+				CHECK(vLevelSize == cReference.vSize[nLevel]);
+				CHECK(vNumOfBricks == Vector3i((vLevelSize.x + BrickSize - 1)/BrickSize, (vLevelSize.y + BrickSize - 1)/BrickSize, (vLevelSize.z + BrickSize - 1)/BrickSize));
+
+				// Each brick must contain the voxels at its position, including the padding
+				Vector3i vBrick;
+				for (vBrick.z=0; vBrick.z<vNumOfBricks.z; vBrick.z++) {
+					for (vBrick.y=0; vBrick.y<vNumOfBricks.y; vBrick.y++) {
+						for (vBrick.x=0; vBrick.x<vNumOfBricks.x; vBrick.x++) {
+							uint32 nMinimum = 0, nMaximum = 0;
+							CHECK(cBrickedVolume.GetBrickRange(nLevel, vBrick, nMinimum, nMaximum));
+							CHECK(cReference.CheckBrickRange(nLevel, vBrick, nMinimum, nMaximum));
+							CHECK(cReference.CheckBrick(nLevel, vBrick, cBrickedVolume.GetBrick(nLevel, vBrick)));
+						}
+					}
+				}
+
+				// Bricks outside the resolution level
+				uint32 nMinimum = 0, nMaximum = 0;
+				CHECK(!cBrickedVolume.GetBrick(nLevel, Vector3i(-1, 0, 0)));
+				CHECK(!cBrickedVolume.GetBrick(nLevel, Vector3i(vNumOfBricks.x, 0, 0)));
+				CHECK(!cBrickedVolume.GetBrick(nLevel, Vector3i(0, vNumOfBricks.y, 0)));
+				CHECK(!cBrickedVolume.GetBrick(nLevel, Vector3i(0, 0, vNumOfBricks.z)));
+				CHECK(!cBrickedVolume.GetBrickRange(nLevel, vNumOfBricks, nMinimum, nMaximum));
+			}
+			CHECK(!cBrickedVolume.GetBrick(4, Vector3i(0, 0, 0)));
+		}
+		cBrickedVolume.Close(true);
+		CHECK(!File(Filename).Exists());
+	}
+
+	TEST(GetBrick_CacheEviction) {
+		const Reference cReference;
+		BrickedVolume cBrickedVolume;
+		CHECK(Create(cBrickedVolume));
+		const Vector3i &vNumOfBricks = cBrickedVolume.GetNumOfBricks(0);
+		const uint32 nNumOfBricks = vNumOfBricks.x*vNumOfBricks.y*vNumOfBricks.z;
+
+		// The smallest memory budget still caches a few bricks, get their number by using all bricks of the original resolution
+		cBrickedVolume.SetMemoryBudget(0);
+		CHECK_EQUAL(0U, cBrickedVolume.GetNumOfCachedBricks());
+		for (uint32 i=0; i<nNumOfBricks; i++)
+			cBrickedVolume.GetBrick(0, GetBrickPosition(vNumOfBricks, i));
+		const uint32 nNumOfSlots = cBrickedVolume.GetNumOfCachedBricks();
+		CHECK(nNumOfSlots > 4 && nNumOfSlots < nNumOfBricks);
+		if (nNumOfSlots > 4 && nNumOfSlots < nNumOfBricks) {
+			// Fill the cache, each brick gets its own slot
+			cBrickedVolume.SetMemoryBudget(0);
+			const uint8 **ppnSlots = new const uint8*[nNumOfSlots];
+			for (uint32 i=0; i<nNumOfSlots; i++) {
+				ppnSlots[i] = cBrickedVolume.GetBrick(0, GetBrickPosition(vNumOfBricks, i));
+				CHECK(ppnSlots[i]);
+			}
+			CHECK_EQUAL(nNumOfSlots, cBrickedVolume.GetNumOfCachedBricks());
+
+			// Cached bricks are not read again
+			const Vector3i vBrick0 = GetBrickPosition(vNumOfBricks, 0);
+			const Vector3i vBrick1 = GetBrickPosition(vNumOfBricks, 1);
+			const Vector3i vBrick2 = GetBrickPosition(vNumOfBricks, 2);
+			CHECK(cBrickedVolume.GetBrick(0, vBrick0) == ppnSlots[0]);
+
+			// Brick 0 was used again, so brick 1 is the least recently used one and its slot is used for the new brick
+			const Vector3i vNewBrick0 = GetBrickPosition(vNumOfBricks, nNumOfBricks - 1);
+			const uint8 *pnNewBrick = cBrickedVolume.GetBrick(0, vNewBrick0);
+			CHECK(pnNewBrick == ppnSlots[1]);
+			CHECK(cReference.CheckBrick(0, vNewBrick0, pnNewBrick));
+			CHECK_EQUAL(nNumOfSlots, cBrickedVolume.GetNumOfCachedBricks());
+
+			// Brick 0 and brick 2 are still cached, brick 3 is the least recently used one now
+			CHECK(cBrickedVolume.GetBrick(0, vBrick0) == ppnSlots[0]);
+			CHECK(cBrickedVolume.GetBrick(0, vBrick2) == ppnSlots[2]);
+			const Vector3i vNewBrick1 = GetBrickPosition(vNumOfBricks, nNumOfBricks - 2);
+			pnNewBrick = cBrickedVolume.GetBrick(0, vNewBrick1);
+			CHECK(pnNewBrick == ppnSlots[3]);
+			CHECK(cReference.CheckBrick(0, vNewBrick1, pnNewBrick));
+
+			// The evicted brick 1 is read again into the slot of brick 4
+			pnNewBrick = cBrickedVolume.GetBrick(0, vBrick1);
+			CHECK(pnNewBrick == ppnSlots[4]);
+			CHECK(cReference.CheckBrick(0, vBrick1, pnNewBrick));
+			CHECK_EQUAL(nNumOfSlots, cBrickedVolume.GetNumOfCachedBricks());
+			delete [] ppnSlots;
+		}
+
+		// A memory budget for all bricks caches each brick once
+		cBrickedVolume.SetMemoryBudget(BrickedVolume::DefaultMemoryBudget);
+		uint32 nNumOfAllBricks = 0;
+		for (uint32 nLevel=0; nLevel<cBrickedVolume.GetNumOfLevels(); nLevel++) {
+			const Vector3i &vNumOfLevelBricks = cBrickedVolume.GetNumOfBricks(nLevel);
+			nNumOfAllBricks += vNumOfLevelBricks.x*vNumOfLevelBricks.y*vNumOfLevelBricks.z;
+			uint16 *pnLevel = new uint16[cReference.vSize[nLevel].x*cReference.vSize[nLevel].y*cReference.vSize[nLevel].z];
+			CHECK(cBrickedVolume.CopyLevel(nLevel, reinterpret_cast<uint8*>(pnLevel)));
+			CHECK(cBrickedVolume.CopyLevel(nLevel, reinterpret_cast<uint8*>(pnLevel)));
+			delete [] pnLevel;
+		}
+		CHECK_EQUAL(nNumOfAllBricks, cBrickedVolume.GetNumOfCachedBricks());
+		cBrickedVolume.Close(true);
+	}
+
+	TEST(Open_HeaderRoundTrip) {
+		const Reference cReference;
+		BrickedVolume cBrickedVolume;
+		CHECK(Create(cBrickedVolume));
+		const uint32 nNumOfLevels = cBrickedVolume.GetNumOfLevels();
+		uint32 nMinimum[64], nMaximum[64], nNumOfBricks = 0;
+		Vector3i vBrick;
+		for (uint32 nLevel=0; nLevel<nNumOfLevels; nLevel++) {
+			const Vector3i &vNumOfBricks = cBrickedVolume.GetNumOfBricks(nLevel);
+			for (vBrick.z=0; vBrick.z<vNumOfBricks.z; vBrick.z++) {
+				for (vBrick.y=0; vBrick.y<vNumOfBricks.y; vBrick.y++) {
+					for (vBrick.x=0; vBrick.x<vNumOfBricks.x && nNumOfBricks<64; vBrick.x++, nNumOfBricks++)
+						cBrickedVolume.GetBrickRange(nLevel, vBrick, nMinimum[nNumOfBricks], nMaximum[nNumOfBricks]);
+				}
+			}
+		}
+		cBrickedVolume.Close();
+
+		// Open the brick files again, everything must be as it was after building them
+		CHECK(cBrickedVolume.Open(Filename));
+		CHECK(cBrickedVolume.IsOpen());
+		CHECK(cBrickedVolume.GetSize() == Size);
+		CHECK_EQUAL(2U, cBrickedVolume.GetBytesPerVoxel());
+		CHECK_EQUAL(BrickSize, cBrickedVolume.GetBrickSize());
+		CHECK_EQUAL(BrickSize*BrickSize*BrickSize*2, cBrickedVolume.GetBrickDataSize());
+		CHECK_EQUAL(nNumOfLevels, cBrickedVolume.GetNumOfLevels());
+		if (nNumOfLevels == cBrickedVolume.GetNumOfLevels()) {
+			uint32 nBrick = 0;
+			for (uint32 nLevel=0; nLevel<nNumOfLevels; nLevel++) {
+				CHECK(cBrickedVolume.GetLevelSize(nLevel) == cReference.vSize[nLevel]);
+				const Vector3i &vNumOfBricks = cBrickedVolume.GetNumOfBricks(nLevel);
+				for (vBrick.z=0; vBrick.z<vNumOfBricks.z; vBrick.z++) {
+					for (vBrick.y=0; vBrick.y<vNumOfBricks.y; vBrick.y++) {
+						for (vBrick.x=0; vBrick.x<vNumOfBricks.x && nBrick<64; vBrick.x++, nBrick++) {
+							uint32 nBrickMinimum = 0, nBrickMaximum = 0;
+							CHECK(cBrickedVolume.GetBrickRange(nLevel, vBrick, nBrickMinimum, nBrickMaximum));
+							CHECK_EQUAL(nMinimum[nBrick], nBrickMinimum);
+							CHECK_EQUAL(nMaximum[nBrick], nBrickMaximum);
+							CHECK(cReference.CheckBrick(nLevel, vBrick, cBrickedVolume.GetBrick(nLevel, vBrick)));
+						}
+					}
+				}
+			}
+			CHECK_EQUAL(nNumOfBricks, nBrick);
+		}
+		cBrickedVolume.Close();
+
+		// Brick files older than the source are not used
+		const uint64 nModificationTime = File(Filename).GetModificationTime();
+		CHECK(cBrickedVolume.Open(Filename, nModificationTime));
+		CHECK(!cBrickedVolume.Open(Filename, nModificationTime + 1));
+		CHECK(!cBrickedVolume.IsOpen());
+
+		// Invalid header: Wrong version, then a brick size which is no power of two
+		uint8 *pnHeader = nullptr;
+		const uint32 nHeaderSize = ReadFile(Filename, &pnHeader);
+		CHECK(nHeaderSize > 7*sizeof(uint32));
+		if (nHeaderSize > 7*sizeof(uint32)) {
+			uint32 *pnHeaderValues = reinterpret_cast<uint32*>(pnHeader);
+			pnHeaderValues[1]++;
+			CHECK(WriteFile(Filename, pnHeader, nHeaderSize));
+			CHECK(!cBrickedVolume.Open(Filename));
+			pnHeaderValues[1]--;
+			pnHeaderValues[6]++;
+			CHECK(WriteFile(Filename, pnHeader, nHeaderSize));
+			CHECK(!cBrickedVolume.Open(Filename));
+			pnHeaderValues[6]--;
+
+			// Missing brick ranges
+			CHECK(WriteFile(Filename, pnHeader, nHeaderSize - 1));
+			CHECK(!cBrickedVolume.Open(Filename));
+			CHECK(WriteFile(Filename, pnHeader, nHeaderSize));
+			CHECK(cBrickedVolume.Open(Filename));
+		}
+		delete [] pnHeader;
+
+		// Truncated brick data file
+		uint8 *pnBricks = nullptr;
+		const uint32 nBricksSize = ReadFile(Filename + ".0", &pnBricks);
+		CHECK_EQUAL(nNumOfBricks*cBrickedVolume.GetBrickDataSize(), nBricksSize);
+		cBrickedVolume.Close();
+		CHECK(WriteFile(Filename + ".0", pnBricks, nBricksSize - 1));
+		CHECK(!cBrickedVolume.Open(Filename));
+		CHECK(WriteFile(Filename + ".0", pnBricks, nBricksSize));
+		delete [] pnBricks;
+
+		// Remove the brick files
+		CHECK(cBrickedVolume.Open(Filename));
+		cBrickedVolume.Close(true);
+		CHECK(!File(Filename).Exists());
+		CHECK(!File(Filename + ".0").Exists());
+	}
+}
@@ -41,15 +41,20 @@ using namespace PLCore;
 //[ Global variables                                      ]
 //[-------------------------------------------------------]
 extern ofstream outputFile;
+extern ofstream trendFile;
+extern string runTimestamp;
 string lastsuitename;
+bool lasttestfailed = false;
 Stopwatch Counter;
 
 void MyPerformanceReporter::ReportTestStart(UnitTest::TestDetails const& test)
 {
+	lasttestfailed = false;
 	Counter.Start();
 }
 void MyPerformanceReporter::ReportFailure(UnitTest::TestDetails const& test, char const* failure)
 {
+	lasttestfailed = true;
 	printf("*!Failed: %s/%s at line %d\n\t*!Msg   : %s\n\n", test.suiteName, test.testName, test.lineNumber, failure);
 }
 void MyPerformanceReporter::ReportTestFinish(UnitTest::TestDetails const& test, float secondsElapsed)
@@ -61,6 +66,9 @@ void MyPerformanceReporter::ReportTestFinish(UnitTest::TestDetails const& test,
 		lastsuitename = test.suiteName;
 	}
 	outputFile << test.testName << ";" << (secondsElapsed*1000) << "ms" << endl;
+
+	// One self-contained line per test within the trend file
+	trendFile << runTimestamp << ";" << test.suiteName << ";" << test.testName << ";" << (secondsElapsed*1000) << ";" << (lasttestfailed ? 1 : 0) << endl;
 	
 }
 void MyPerformanceReporter::ReportSummary(int totalTestCount, int failedTestCount, int failureCount, float secondsElapsed)
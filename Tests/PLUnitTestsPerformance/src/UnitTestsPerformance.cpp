@@ -39,6 +39,8 @@
 //[ Global variables                                      ]
 //[-------------------------------------------------------]
 std::ofstream outputFile;
+std::ofstream trendFile;		// Machine readable results of all runs, one line per test, for tracking the performance over time
+std::string   runTimestamp;	// Start time of this run as "YYYY-MM-DD hh:mm:ss", the first column of the trend file
 
 
 //[-------------------------------------------------------]
@@ -46,24 +48,16 @@ std::ofstream outputFile;
 //[-------------------------------------------------------]
 int UnitTestsPerformance()
 {
-	// Get the current time as ASCII string
+	// Get the current time as ASCII string (':' is not valid within filenames)
+	const time_t nTime = time(nullptr);
+	const struct tm *pTime = localtime(&nTime);
 	char szTime[9];
-	char szDate[11];
-
-	#ifdef WIN32
-		_strtime(szTime);
-		_strdate(szDate);
-		// replace ':' (not valid within filenames) by '-'
-		szTime[2] = szTime[5] = '-';
-		szDate[2] = szDate[5] = '-';
-
-	#else
-		struct tm sTime;
-		struct timeval sNow;
-		gettimeofday(&sNow, nullptr);
-		localtime_r(&sNow.tv_sec, &sTime);
-		sprintf(szTime, "%2d_%2d_%2d_%2d-%2d-%2d", sTime.tm_hour, sTime.tm_min, sTime.tm_sec, sTime.tm_yday, sTime.tm_mon, sTime.tm_year);
-	#endif
+	char szDate[9];
+	char szTimestamp[20];
+	strftime(szTime, sizeof(szTime), "%H-%M-%S", pTime);
+	strftime(szDate, sizeof(szDate), "%m-%d-%y", pTime);
+	strftime(szTimestamp, sizeof(szTimestamp), "%Y-%m-%d %H:%M:%S", pTime);
+	runTimestamp = szTimestamp;
 
 	// Open the results output file
 	char szFilename[256];
@@ -71,13 +65,20 @@ int UnitTestsPerformance()
 	sprintf(szFilename, "PLUnitTestsPerformance_Result_[%s][%s].csv", szTime, szDate);
 	outputFile.open(szFilename);
 
+	// Open the trend file, the results are appended so the file grows with each run
+	trendFile.open("PLUnitTestsPerformance_Trend.csv", std::ios::out | std::ios::app);
+	trendFile.seekp(0, std::ios::end);
+	if (trendFile.tellp() == std::streampos(0))
+		trendFile << "Timestamp;Suite;Test;Milliseconds;Failed" << std::endl;
+
 	// Create an reporter instance
 	MyPerformanceReporter cReporter;
 
 	// Run all unit tests
 	const int nResult = UnitTest::RunAllTests(cReporter);
 
-	// Close the results output file
+	// Close the results output files
+	trendFile.close();
 	outputFile.close();
 
 	// Done
@@ -219,6 +219,7 @@ _pixellight_find_lib(PL_PLRENDERERNULL			PLRendererNull/PLRendererNull.h				PLRe
 _pixellight_find_lib(PL_PLRENDEREROPENGL		PLRendererOpenGL/PLRendererOpenGL.h			PLRendererOpenGL		Plugins/PLRendererOpenGL/include)
 _pixellight_find_lib(PL_PLRENDEREROPENGLCG		PLRendererOpenGLCg/PLRendererOpenGLCg.h		PLRendererOpenGLCg		Plugins/PLRendererOpenGLCg/include)
 _pixellight_find_lib(PL_PLRENDEREROPENGLES2		PLRendererOpenGLES2/PLRendererOpenGLES2.h	PLRendererOpenGLES2		Plugins/PLRendererOpenGLES2/include)
+_pixellight_find_lib(PL_PLRENDERERSOFTWARE		PLRendererSoftware/PLRendererSoftware.h		PLRendererSoftware		Plugins/PLRendererSoftware/include)
 # Script plugins
 _pixellight_find_lib(PL_PLSCRIPTANGELSCRIPT		PLScriptAngelScript/PLScriptAngelScript.h	PLScriptAngelScript		Plugins/PLScriptAngelScript/include)
 _pixellight_find_lib(PL_PLSCRIPTBINDINGS		PLScriptBindings/PLScriptBindings.h			PLScriptBindings		Plugins/PLScriptBindings/include)
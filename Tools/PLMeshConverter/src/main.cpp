@@ -0,0 +1,127 @@
+/*********************************************************\
+ *  File: main.cpp                                       *
+ *
+ *  Copyright (C) 2002-2013 The PixelLight Team (http://www.pixellight.org/)
+ *
+ *  This file is part of PixelLight.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ *  and associated documentation files (the "Software"), to deal in the Software without
+ *  restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ *  Software is furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all copies or
+ *  substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ *  BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ *  DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ *  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include <PLCore/Main.h>
+#include <PLCore/Runtime.h>
+#include <PLCore/System/Console.h>
+#include <PLRenderer/RendererContext.h>
+#include <PLMesh/Mesh.h>
+#include <PLMesh/MeshManager.h>
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+using namespace PLCore;
+using namespace PLRenderer;
+using namespace PLMesh;
+
+
+//[-------------------------------------------------------]
+//[ Helper functions                                      ]
+//[-------------------------------------------------------]
+/**
+*  @brief
+*    Output message
+*/
+void Message(const String &sMessage)
+{
+	System::GetInstance()->GetConsole().Print(sMessage + '\n');
+}
+
+/**
+*  @brief
+*    Converts the given mesh file
+*
+*  @param[in] cMeshManager
+*    Mesh manager to use
+*  @param[in] sInputFilename
+*    Filename of the mesh to load, the loader is chosen by the filename extension (e.g. "mesh" or "xmesh")
+*  @param[in] sOutputFilename
+*    Filename of the mesh to save, the loader is chosen by the filename extension (e.g. "mmesh")
+*
+*  @return
+*    'true' if all went fine, else 'false'
+*/
+bool Convert(MeshManager &cMeshManager, const String &sInputFilename, const String &sOutputFilename)
+{
+	bool bResult = false; // Error by default
+
+	// Load the mesh and save it again, the null renderer keeps the buffer data within the system memory
+	Mesh *pMesh = cMeshManager.CreateMesh();
+	if (pMesh) {
+		if (!pMesh->LoadByFilename(sInputFilename))
+			Message("!! Failed to load \"" + sInputFilename + '\"');
+		else if (!pMesh->SaveByFilename(sOutputFilename))
+			Message("!! Failed to save \"" + sOutputFilename + '\"');
+		else
+			bResult = true;
+		cMeshManager.Unload(*pMesh);
+	}
+
+	// Done
+	return bResult;
+}
+
+
+//[-------------------------------------------------------]
+//[ Program entry point                                   ]
+//[-------------------------------------------------------]
+int PLMain(const String &sExecutableFilename, const Array<String> &lstArguments)
+{
+	// Check the arguments
+	if (lstArguments.GetNumOfElements() < 2 || (lstArguments.GetNumOfElements() % 2)) {
+		Message("Converts meshes between all formats supported by PLMesh, e.g. into the memory mappable \"mmesh\" format");
+		Message("Usage: PLMeshConverter <input filename> <output filename> [<input filename> <output filename> ...]");
+		return 1;
+	}
+
+	// Scan for plugins, the null renderer is all we need to hold the mesh data
+	Runtime::ScanDirectoryPlugins();
+	RendererContext *pRendererContext = RendererContext::CreateInstance("PLRendererNull::Renderer", NULL_HANDLE);
+	if (!pRendererContext) {
+		Message("!! The renderer \"PLRendererNull::Renderer\" is not available");
+		return 1;
+	}
+
+	// Convert all given meshes
+	uint32 nErrors = 0;
+	{
+		MeshManager cMeshManager(pRendererContext->GetRenderer());
+		for (uint32 i=0; i<lstArguments.GetNumOfElements(); i+=2) {
+			Message("-- Converting \"" + lstArguments[i] + "\" into \"" + lstArguments[i+1] + '\"');
+			if (!Convert(cMeshManager, lstArguments[i], lstArguments[i+1]))
+				nErrors++;
+		}
+	}
+
+	// Cleanup
+	delete pRendererContext;
+
+	// Done
+	return nErrors ? 1 : 0;
+}
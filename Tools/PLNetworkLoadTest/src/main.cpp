@@ -0,0 +1,354 @@
+/*********************************************************\
+ *  File: main.cpp                                       *
+ *
+ *  Copyright (C) 2002-2013 The PixelLight Team (http://www.pixellight.org/)
+ *
+ *  This file is part of PixelLight.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ *  and associated documentation files (the "Software"), to deal in the Software without
+ *  restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ *  Software is furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all copies or
+ *  substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ *  BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ *  DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ *  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include <string.h>
+#include <stdlib.h>
+#include <PLCore/Main.h>
+#include <PLCore/System/System.h>
+#include <PLCore/System/Thread.h>
+#include <PLCore/System/Console.h>
+#include <PLCore/Network/Host.h>
+#include <PLCore/Network/Socket.h>
+#include <PLCore/Network/Reactor.h>
+#include <PLCore/Network/Connection.h>
+#include <PLCore/Network/Http/HttpServer.h>
+#include <PLCore/Network/Http/HttpServerConnection.h>
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+using namespace PLCore;
+
+
+//[-------------------------------------------------------]
+//[ Definitions                                           ]
+//[-------------------------------------------------------]
+static const uint32 Port		= 4711;		/**< Loopback port the server is listening at */
+static const char	Request[]	= "ping\n";	/**< Request each client connection sends, the echo server echoes it and closes the connection */
+static const uint32 RequestSize	= 5;		/**< Size of the request in bytes */
+
+/**
+*  @brief
+*    Test mode
+*/
+enum EMode {
+	EchoMode,			/**< One connection to the echo server per request */
+	HttpCloseMode,		/**< One connection to the HTTP server per request */
+	HttpKeepAliveMode	/**< One connection to the HTTP server per client thread, kept open for all requests */
+};
+
+
+//[-------------------------------------------------------]
+//[ Classes                                               ]
+//[-------------------------------------------------------]
+/**
+*  @brief
+*    Echo server connection, echoes all received data and closes the connection after the end of the line
+*/
+class EchoConnection : public Connection {
+	public:
+		EchoConnection(Host &cHost) : Connection(cHost)
+		{
+		}
+
+	protected:
+		virtual void OnReceive(const char *pBuffer, uint32 nSize) override
+		{
+			Send(pBuffer, nSize);
+			if (pBuffer[nSize-1] == '\n')
+				Disconnect();
+		}
+};
+
+/**
+*  @brief
+*    Echo server
+*/
+class EchoServer : public Host {
+	protected:
+		virtual Connection *CreateIncomingConnection() override
+		{
+			return new EchoConnection(*this);
+		}
+};
+
+/**
+*  @brief
+*    HTTP server answering each GET request with the same file
+*/
+class FileServer : public HttpServer {
+	public:
+		FileServer(const String &sFilename) :
+			m_sFilename(sFilename)
+		{
+		}
+
+	protected:
+		virtual void OnGet(HttpServerConnection *pConnection, const HttpHeader *pHeader) override
+		{
+			pConnection->SendFile(Http_200_OK, m_sFilename);
+		}
+
+	private:
+		String m_sFilename;	/**< File to send */
+};
+
+/**
+*  @brief
+*    Client thread, sends requests one after another and measures the time until the response was received
+*/
+class ClientThread : public Thread {
+	public:
+		EMode  m_nMode;				/**< Test mode */
+		uint32 m_nNumOfRequests;	/**< Number of requests to send */
+		uint32 m_nNumOfFailed;		/**< Number of failed requests */
+		uint64 m_nTotalLatency;		/**< Sum of the latencies of all successful requests in microseconds */
+		uint64 m_nMaxLatency;		/**< Maximum latency in microseconds */
+		uint64 m_nReceived;			/**< Total number of received bytes */
+
+		ClientThread(EMode nMode, uint32 nNumOfRequests) :
+			m_nMode(nMode),
+			m_nNumOfRequests(nNumOfRequests),
+			m_nNumOfFailed(0),
+			m_nTotalLatency(0),
+			m_nMaxLatency(0),
+			m_nReceived(0)
+		{
+		}
+
+	private:
+		/**
+		*  @brief
+		*    Receive a HTTP response
+		*
+		*  @return
+		*    Number of received bytes, 0 on error
+		*/
+		uint32 ReceiveHttpResponse(Socket &cSocket)
+		{
+			// Receive the header
+			char szBuffer[65536];
+			uint32 nReceived = 0;
+			const char *pszHeaderEnd = nullptr;
+			while (!pszHeaderEnd) {
+				const int nBytes = cSocket.Receive(szBuffer + nReceived, sizeof(szBuffer) - 1 - nReceived);
+				if (nBytes <= 0)
+					return 0; // Error!
+				nReceived += nBytes;
+				szBuffer[nReceived] = '\0';
+				pszHeaderEnd = strstr(szBuffer, "\r\n\r\n");
+				if (!pszHeaderEnd && nReceived == sizeof(szBuffer) - 1)
+					return 0; // Error!
+			}
+
+			// Receive the content
+			const char *pszContentLength = strstr(szBuffer, "Content-Length: ");
+			if (!pszContentLength || pszContentLength > pszHeaderEnd)
+				return 0; // Error!
+			const uint32 nTotal = static_cast<uint32>(pszHeaderEnd + 4 - szBuffer) + strtoul(pszContentLength + 16, nullptr, 10);
+			while (nReceived < nTotal) {
+				const int nBytes = cSocket.Receive(szBuffer, sizeof(szBuffer));
+				if (nBytes <= 0)
+					return 0; // Error!
+				nReceived += nBytes;
+			}
+			return nReceived;
+		}
+
+		virtual int Run() override
+		{
+			Socket *pKeepAliveSocket = nullptr;
+			for (uint32 i=0; i<m_nNumOfRequests; i++) {
+				const uint64 nStartTime = System::GetInstance()->GetMicroseconds();
+				uint32 nReceived = 0;
+				if (m_nMode == HttpKeepAliveMode) {
+					// Connect once and send all requests over this connection
+					static const char szHttpRequest[] = "GET /file HTTP/1.1\r\nHost: 127.0.0.1\r\n\r\n";
+					if (!pKeepAliveSocket) {
+						pKeepAliveSocket = new Socket();
+						if (!pKeepAliveSocket->Connect("127.0.0.1", Port)) {
+							pKeepAliveSocket->Close();
+							delete pKeepAliveSocket;
+							pKeepAliveSocket = nullptr;
+						}
+					}
+					if (pKeepAliveSocket && pKeepAliveSocket->Send(szHttpRequest, sizeof(szHttpRequest) - 1) == sizeof(szHttpRequest) - 1)
+						nReceived = ReceiveHttpResponse(*pKeepAliveSocket);
+				} else {
+					// Connect, send the request and wait until the server has answered it and closed the connection
+					static const char szHttpRequest[] = "GET /file HTTP/1.1\r\nHost: 127.0.0.1\r\nConnection: close\r\n\r\n";
+					const char *pszRequest = (m_nMode == EchoMode) ? Request : szHttpRequest;
+					const uint32 nRequestSize = (m_nMode == EchoMode) ? RequestSize : sizeof(szHttpRequest) - 1;
+					Socket cSocket;
+					if (cSocket.Connect("127.0.0.1", Port) && cSocket.Send(pszRequest, nRequestSize) == static_cast<int>(nRequestSize)) {
+						char szBuffer[65536];
+						int nBytes;
+						while ((nBytes = cSocket.Receive(szBuffer, sizeof(szBuffer))) > 0)
+							nReceived += nBytes;
+					}
+					cSocket.Close();
+					if (m_nMode == EchoMode && nReceived != RequestSize)
+						nReceived = 0;
+				}
+
+				// Update the statistics
+				if (nReceived) {
+					const uint64 nLatency = System::GetInstance()->GetMicroseconds() - nStartTime;
+					m_nTotalLatency += nLatency;
+					if (m_nMaxLatency < nLatency)
+						m_nMaxLatency = nLatency;
+					m_nReceived += nReceived;
+				} else {
+					m_nNumOfFailed++;
+
+					// Reconnect on the next request
+					if (pKeepAliveSocket) {
+						pKeepAliveSocket->Close();
+						delete pKeepAliveSocket;
+						pKeepAliveSocket = nullptr;
+					}
+				}
+			}
+			if (pKeepAliveSocket) {
+				pKeepAliveSocket->Close();
+				delete pKeepAliveSocket;
+			}
+
+			// Done
+			return 0;
+		}
+};
+
+
+//[-------------------------------------------------------]
+//[ Helper functions                                      ]
+//[-------------------------------------------------------]
+/**
+*  @brief
+*    Output message
+*/
+void Message(const String &sMessage)
+{
+	System::GetInstance()->GetConsole().Print(sMessage + '\n');
+}
+
+/**
+*  @brief
+*    Run the client threads and report the results
+*
+*  @return
+*    Number of failed requests
+*/
+uint32 RunClients(const String &sName, EMode nMode, uint32 nNumOfClients, uint32 nNumOfRequests)
+{
+	// Start the client threads and wait until they're done
+	ClientThread **ppClients = new ClientThread*[nNumOfClients];
+	const uint64 nStartTime = System::GetInstance()->GetMicroseconds();
+	for (uint32 i=0; i<nNumOfClients; i++) {
+		ppClients[i] = new ClientThread(nMode, nNumOfRequests);
+		ppClients[i]->Start();
+	}
+	uint32 nNumOfFailed = 0;
+	uint64 nTotalLatency = 0, nMaxLatency = 0, nReceived = 0;
+	for (uint32 i=0; i<nNumOfClients; i++) {
+		ppClients[i]->Join();
+		nNumOfFailed  += ppClients[i]->m_nNumOfFailed;
+		nTotalLatency += ppClients[i]->m_nTotalLatency;
+		nReceived     += ppClients[i]->m_nReceived;
+		if (nMaxLatency < ppClients[i]->m_nMaxLatency)
+			nMaxLatency = ppClients[i]->m_nMaxLatency;
+		delete ppClients[i];
+	}
+	const uint64 nTime = System::GetInstance()->GetMicroseconds() - nStartTime;
+	delete [] ppClients;
+
+	// Report
+	const uint32 nNumOfSucceeded = nNumOfClients*nNumOfRequests - nNumOfFailed;
+	Message(sName + ':');
+	Message(String("  Requests:           ") + nNumOfSucceeded + " succeeded, " + nNumOfFailed + " failed");
+	Message(String("  Time:               ") + static_cast<float>(nTime/1000.0) + " ms");
+	Message(String("  Requests/second:    ") + (nTime ? static_cast<float>(nNumOfSucceeded*1000000.0/nTime) : 0.0f));
+	Message(String("  Received MiB/s:     ") + (nTime ? static_cast<float>(nReceived/1048576.0*1000000.0/nTime) : 0.0f));
+	Message(String("  Average latency:    ") + (nNumOfSucceeded ? static_cast<float>(nTotalLatency/1000.0/nNumOfSucceeded) : 0.0f) + " ms");
+	Message(String("  Maximum latency:    ") + static_cast<float>(nMaxLatency/1000.0) + " ms");
+
+	// Done
+	return nNumOfFailed;
+}
+
+
+//[-------------------------------------------------------]
+//[ Program entry point                                   ]
+//[-------------------------------------------------------]
+int PLMain(const String &sExecutableFilename, const Array<String> &lstArguments)
+{
+	// Get the arguments
+	if (lstArguments.GetNumOfElements() > 4) {
+		Message("Loopback load test of the PLCore network classes: Clients send requests to a server one after another");
+		Message("Usage: PLNetworkLoadTest [<I/O threads, 0 = one thread per connection> [<client threads> [<requests per client thread> [<file served by HTTP>]]]]");
+		Message("Without a file, an echo server is used, else the file is requested from a HTTP server using a new connection per request and using keep-alive");
+		return 1;
+	}
+	const uint32 nNumOfIOThreads	= (lstArguments.GetNumOfElements() > 0) ? lstArguments[0].GetUInt32() : 2;
+	const uint32 nNumOfClients		= (lstArguments.GetNumOfElements() > 1) ? lstArguments[1].GetUInt32() : 16;
+	const uint32 nNumOfRequests		= (lstArguments.GetNumOfElements() > 2) ? lstArguments[2].GetUInt32() : 1000;
+	const String sFilename			= (lstArguments.GetNumOfElements() > 3) ? lstArguments[3] : "";
+	if (nNumOfIOThreads && !Reactor::IsSupported())
+		Message("-- Event driven network I/O is not supported on this platform, using one thread per connection");
+	Message(String("-- ") + nNumOfIOThreads + " I/O threads, " + nNumOfClients + " client threads, " + nNumOfRequests + " requests per client thread");
+
+	// Run the test
+	uint32 nNumOfFailed = 0;
+	if (sFilename.GetLength()) {
+		// Start the HTTP server
+		FileServer cServer(sFilename);
+		cServer.SetNumOfIOThreads(nNumOfIOThreads);
+		cServer.Listen(Port);
+
+		// Request the file using a new connection per request (the only mode supported by former versions of the HTTP server), then using keep-alive
+		nNumOfFailed += RunClients("HTTP, connection per request", HttpCloseMode, nNumOfClients, nNumOfRequests);
+		nNumOfFailed += RunClients("HTTP, keep-alive", HttpKeepAliveMode, nNumOfClients, nNumOfRequests);
+
+		// Shut down the HTTP server
+		cServer.Close();
+	} else {
+		// Start the echo server
+		EchoServer cServer;
+		cServer.SetNumOfIOThreads(nNumOfIOThreads);
+		cServer.Listen(Port);
+
+		// Connect to the echo server
+		nNumOfFailed += RunClients("Echo, connection per request", EchoMode, nNumOfClients, nNumOfRequests);
+
+		// Shut down the echo server
+		cServer.Close();
+	}
+
+	// Done
+	return nNumOfFailed ? 1 : 0;
+}